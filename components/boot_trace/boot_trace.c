@@ -0,0 +1,208 @@
+#include "boot_trace.h"
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+
+static const char *TAG = "Boot Trace";
+
+// 时间线事件(ph为Chrome trace-event的事件类型，'X'完整时间段，'i'瞬时事件)
+typedef struct {
+    const char *name;
+    int64_t ts_us;
+    int32_t dur_us;
+    int32_t arg;
+    int16_t tid;
+    char ph;
+    bool ready;                         ///< 其余字段写完后置位(release)，读取方只读已置位的事件
+} boot_trace_event_t;
+
+static boot_trace_event_t trace_events[BOOT_TRACE_MAX_EVENTS];
+static uint32_t trace_next = 0;         ///< 下一个写入位置(原子递增，可在ISR中使用)；位置分配后字段可能还没写完
+static uint32_t trace_dropped = 0;      ///< 缓冲区满后丢弃的事件数
+
+static int trace_frames = 0;            ///< 需要记录的帧数
+static int trace_frame_idx = 0;         ///< 已记录的帧数
+
+static boot_trace_event_t *trace_alloc(void) {
+    uint32_t idx = __atomic_fetch_add(&trace_next, 1, __ATOMIC_RELAXED);
+    if (idx >= BOOT_TRACE_MAX_EVENTS) {
+        __atomic_fetch_add(&trace_dropped, 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    return &trace_events[idx];
+}
+
+/**
+ * @brief 事件字段写完后发布，之后读取方才能看到它
+ */
+static void trace_commit(boot_trace_event_t *ev) {
+    __atomic_store_n(&ev->ready, true, __ATOMIC_RELEASE);
+}
+
+void boot_trace_span(const char *name, int64_t start_us, int64_t end_us, int tid, int32_t arg) {
+    boot_trace_event_t *ev = trace_alloc();
+    if (ev == NULL) {
+        return;
+    }
+    ev->name = name;
+    ev->ts_us = start_us;
+    ev->dur_us = (int32_t)(end_us - start_us);
+    ev->arg = arg;
+    ev->tid = (int16_t)tid;
+    ev->ph = 'X';
+    trace_commit(ev);
+}
+
+void boot_trace_end(const char *name, int64_t start_us) {
+    boot_trace_span(name, start_us, esp_timer_get_time(), xPortGetCoreID(), -1);
+}
+
+void boot_trace_instant(const char *name) {
+    boot_trace_event_t *ev = trace_alloc();
+    if (ev == NULL) {
+        return;
+    }
+    ev->name = name;
+    ev->ts_us = esp_timer_get_time();
+    ev->dur_us = 0;
+    ev->arg = -1;
+    ev->tid = (int16_t)xPortGetCoreID();
+    ev->ph = 'i';
+    trace_commit(ev);
+}
+
+/**
+ * @brief 已分配位置的事件数，包括还没写完的
+ */
+static size_t trace_claimed(void) {
+    uint32_t count = __atomic_load_n(&trace_next, __ATOMIC_RELAXED);
+    return count > BOOT_TRACE_MAX_EVENTS ? BOOT_TRACE_MAX_EVENTS : count;
+}
+
+size_t boot_trace_count(uint32_t *dropped) {
+    size_t claimed = trace_claimed();
+    size_t count = 0;
+    // 不同任务/中断写完的顺序可能与分配顺序不同，只返回开头连续已发布的部分
+    while (count < claimed && __atomic_load_n(&trace_events[count].ready, __ATOMIC_ACQUIRE)) {
+        count++;
+    }
+    if (dropped) {
+        *dropped = __atomic_load_n(&trace_dropped, __ATOMIC_RELAXED);
+    }
+    return count;
+}
+
+bool boot_trace_find_overlap(const char *a, const char *b, int64_t *at_us) {
+    size_t count = boot_trace_count(NULL);
+    for (size_t i = 0; i < count; i++) {
+        const boot_trace_event_t *x = &trace_events[i];
+        if (x->ph != 'X' || x->name == NULL || strcmp(x->name, a) != 0) {
+            continue;
+        }
+        for (size_t j = 0; j < count; j++) {
+            const boot_trace_event_t *y = &trace_events[j];
+            if (y->ph != 'X' || y->name == NULL || strcmp(y->name, b) != 0) {
+                continue;
+            }
+            if (x->ts_us < y->ts_us + y->dur_us && y->ts_us < x->ts_us + x->dur_us) {
+                if (at_us) {
+                    *at_us = x->ts_us > y->ts_us ? x->ts_us : y->ts_us;
+                }
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void boot_trace_dump(void) {
+    static const struct {
+        int tid;
+        const char *name;
+    } tracks[] = {
+        {BOOT_TRACE_TID_CORE0, "core0"},
+        {BOOT_TRACE_TID_CORE1, "core1"},
+        {BOOT_TRACE_TID_LVGL, "lvgl render"},
+        {BOOT_TRACE_TID_SPI, "spi flush"},
+    };
+    uint32_t dropped = 0;
+    size_t count = boot_trace_count(&dropped);
+
+    printf("BOOT_TRACE_BEGIN\n{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (size_t i = 0; i < sizeof(tracks) / sizeof(tracks[0]); i++) {
+        printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}},\n",
+               tracks[i].tid, tracks[i].name);
+    }
+    for (size_t i = 0; i < count; i++) {
+        const boot_trace_event_t *ev = &trace_events[i];
+        printf("{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%lld",
+               ev->name, ev->ph, ev->tid, (long long)ev->ts_us);
+        if (ev->ph == 'X') {
+            printf(",\"dur\":%ld", (long)ev->dur_us);
+        } else {
+            printf(",\"s\":\"t\"");
+        }
+        if (ev->arg >= 0) {
+            printf(",\"args\":{\"n\":%ld}", (long)ev->arg);
+        }
+        printf("}%s\n", (i + 1 < count) ? "," : "");
+    }
+    printf("]}\nBOOT_TRACE_END\n");
+
+    if (dropped) {
+        ESP_LOGW(TAG, "%lu events dropped, increase BOOT_TRACE_MAX_EVENTS", (unsigned long)dropped);
+    }
+}
+
+/****************    LVGL帧记录 ↓   *************************/
+
+static void boot_trace_dump_task(void *arg) {
+    // 等待正在写入的事件(如最后一帧的刷屏段)发布，超时后只导出已发布的部分
+    TickType_t wait = pdMS_TO_TICKS(BOOT_TRACE_DUMP_WAIT_MS);
+    for (TickType_t t = 0; t < wait && boot_trace_count(NULL) < trace_claimed(); t++) {
+        vTaskDelay(1);
+    }
+    boot_trace_dump();
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief 帧统计的时间段回调，按类型记录到LVGL/SPI轨道
+ * @note 刷屏段在传输完成中断中回调，boot_trace_span本身是ISR安全的
+ */
+static void trace_frame_span(perf_span_t kind, int64_t start_us, int64_t end_us,
+                             uint32_t frame, uint32_t px, void *ctx) {
+    switch (kind) {
+        case PERF_SPAN_RENDER:
+            boot_trace_span("render", start_us, end_us, BOOT_TRACE_TID_LVGL, (int32_t)frame);
+            break;
+        case PERF_SPAN_FLUSH:
+            boot_trace_span("flush", start_us, end_us, BOOT_TRACE_TID_SPI, (int32_t)px);
+            break;
+        case PERF_SPAN_FRAME:
+            boot_trace_span("frame", start_us, end_us, BOOT_TRACE_TID_LVGL, (int32_t)frame);
+            if (++trace_frame_idx >= trace_frames) {
+                // 停止记录；最后一帧的传输可能还未完成，导出任务先等待已分配的事件写完
+                perf_monitor_set_span_cb(NULL, NULL);
+                // 导出放到低优先级任务，避免串口输出阻塞LVGL任务
+                xTaskCreate(boot_trace_dump_task, "boot_trace", 3072, NULL, 1, NULL);
+            }
+            break;
+    }
+}
+
+esp_err_t boot_trace_capture_frames(int frames) {
+    if (frames <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (trace_frames != 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    trace_frames = frames;
+    trace_frame_idx = 0;
+    perf_monitor_set_span_cb(trace_frame_span, NULL);
+    ESP_LOGI(TAG, "Tracing first %d LVGL frames", frames);
+    return ESP_OK;
+}
@@ -0,0 +1,86 @@
+#ifndef BOOT_TRACE_H
+#define BOOT_TRACE_H
+// 启动时间线：记录命名时间段，导出为Chrome trace-event JSON
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "perf_monitor.h"
+
+/* ========== 时间线配置 ========== */
+#define BOOT_TRACE_MAX_EVENTS   (256)   // 静态事件缓冲区容量，写满后丢弃新事件
+#define BOOT_TRACE_FRAMES       (5)     // 默认记录的LVGL帧数
+#define BOOT_TRACE_FILL_COMPARE (0)     // 为1时清屏阶段先逐行填充一次，对比两种整屏填充的耗时
+#define BOOT_TRACE_DUMP_WAIT_MS (50)    // 帧记录结束后导出前等待正在写入的事件的最长时间
+
+/* ========== 轨道(trace viewer中的tid) ========== */
+#define BOOT_TRACE_TID_CORE0    (0)     // 核心0上的时间段
+#define BOOT_TRACE_TID_CORE1    (1)     // 核心1上的时间段
+#define BOOT_TRACE_TID_LVGL     (10)    // LVGL帧/渲染
+#define BOOT_TRACE_TID_SPI      (11)    // SPI刷屏传输
+
+/**
+ * @brief 开始一个时间段，返回开始时间
+ * @note 与boot_trace_end配对使用，名称需为静态字符串
+ */
+static inline int64_t boot_trace_begin(void) {
+    return esp_timer_get_time();
+}
+
+/**
+ * @brief 结束一个时间段并记录到当前核心的轨道
+ * @param name     时间段名称(静态字符串)
+ * @param start_us boot_trace_begin的返回值
+ */
+void boot_trace_end(const char *name, int64_t start_us);
+
+/**
+ * @brief 记录一个完整时间段
+ * @param name     时间段名称(静态字符串)
+ * @param start_us 开始时间(esp_timer时间)
+ * @param end_us   结束时间(esp_timer时间)
+ * @param tid      轨道号
+ * @param arg      附加参数(导出为args.n)，不需要时传-1
+ */
+void boot_trace_span(const char *name, int64_t start_us, int64_t end_us, int tid, int32_t arg);
+
+/**
+ * @brief 记录一个瞬时事件
+ * @param name 事件名称(静态字符串)
+ */
+void boot_trace_instant(const char *name);
+
+/**
+ * @brief 记录前frames帧的渲染和刷屏时间段
+ * @note 时间段来自perf_monitor的帧统计，需先调用perf_monitor_attach
+ * @param frames 记录的帧数，记录完后自动导出时间线
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t boot_trace_capture_frames(int frames);
+
+/**
+ * @brief 以Chrome trace-event JSON格式输出时间线到控制台
+ * @note 输出位于BOOT_TRACE_BEGIN/BOOT_TRACE_END两行之间，可直接粘贴到chrome://tracing或Perfetto
+ */
+void boot_trace_dump(void);
+
+/**
+ * @brief 获取已记录的事件数量
+ * @note 只计开头连续已写完的事件，正在其他任务或中断中写入的事件及其后的事件不计入
+ * @param dropped 输出因缓冲区已满而丢弃的事件数，可为NULL
+ * @return size_t 已记录的事件数
+ */
+size_t boot_trace_count(uint32_t *dropped);
+
+/**
+ * @brief 查找两个名称的时间段是否在时间上重叠
+ * @note 用于检查本应串行的启动步骤，例如清屏(black_fill)与LVGL刷屏(flush)不能交错
+ * @param a     第一个时间段名称
+ * @param b     第二个时间段名称
+ * @param at_us 输出第一处重叠的开始时间，可为NULL
+ * @return true 存在重叠
+ */
+bool boot_trace_find_overlap(const char *a, const char *b, int64_t *at_us);
+
+#endif // BOOT_TRACE_H
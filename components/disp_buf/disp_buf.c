@@ -0,0 +1,412 @@
+#include "disp_buf.h"
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_lcd_panel_commands.h"
+#include "esp_log.h"
+
+static const char *TAG = "Disp Buf";
+
+#define DISP_BUF_INTERNAL_CAPS  (MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL)
+
+/**
+ * @brief 一种布局占用的全部缓冲区
+ * @note 环形布局的绘图缓冲区都在ring中，buf1/buf2为NULL
+ */
+typedef struct {
+    void *buf1;                         ///< 绘图缓冲区(非环形布局)
+    void *buf2;
+    void *ring[DISP_BUF_RING_DEPTH];    ///< 环形布局的绘图缓冲区
+    uint8_t *bounce[2];                 ///< SPIRAM布局的中转缓冲区
+} disp_buf_mem_t;
+
+/**
+ * @brief 缓冲区状态
+ * @note ring_inflight和ring_blocked由LVGL任务和传输完成中断共同读写，用ring_lock保护
+ */
+static struct {
+    lv_disp_t *disp;
+    esp_lcd_panel_handle_t panel;
+    esp_lcd_panel_io_handle_t io;
+    disp_buf_cfg_t cfg;
+    disp_buf_plan_t plan;
+    disp_buf_mem_t mem;                 ///< 当前布局的缓冲区
+    uint8_t ring_cur;                   ///< LVGL正在渲染的缓冲区
+    volatile uint8_t ring_inflight;     ///< 在途的缓冲区数量(按提交顺序完成)
+    volatile bool ring_blocked;         ///< LVGL在等待下一块缓冲区
+    lv_coord_t win_x1;                  ///< 当前显存窗口的列范围
+    lv_coord_t win_x2;
+    lv_coord_t win_next_y;              ///< 续写时下一条应从哪一行开始，-1表示需要重新设置窗口
+} disp_buf;
+
+static portMUX_TYPE ring_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char *const layout_names[DISP_BUF_LAYOUT_COUNT] = {
+    [DISP_BUF_INTERNAL_RING] = "internal ring",
+    [DISP_BUF_INTERNAL_DOUBLE] = "internal x2",
+    [DISP_BUF_INTERNAL_SINGLE] = "internal x1",
+    [DISP_BUF_SPIRAM_BOUNCE] = "spiram+bounce",
+};
+
+const char *disp_buf_layout_name(disp_buf_layout_t layout) {
+    return layout < DISP_BUF_LAYOUT_COUNT ? layout_names[layout] : "?";
+}
+
+/****************    规划 ↓   *************************/
+
+void disp_buf_plan_layout(const disp_buf_cfg_t *cfg, disp_buf_layout_t layout, uint16_t rows, disp_buf_plan_t *plan) {
+    if (rows > cfg->vres) {
+        rows = cfg->vres;
+    }
+    memset(plan, 0, sizeof(*plan));
+    plan->layout = layout;
+    plan->rows = rows;
+    plan->draw_bytes = (uint32_t)cfg->hres * rows * sizeof(lv_color_t);
+    switch (layout) {
+    case DISP_BUF_INTERNAL_RING:
+        plan->internal_bytes = plan->draw_bytes * DISP_BUF_RING_DEPTH;
+        break;
+    case DISP_BUF_INTERNAL_DOUBLE:
+        plan->internal_bytes = plan->draw_bytes * 2;
+        break;
+    case DISP_BUF_INTERNAL_SINGLE:
+        plan->internal_bytes = plan->draw_bytes;
+        break;
+    default:
+        plan->bounce_bytes = DISP_BUF_BOUNCE_BYTES;
+        plan->internal_bytes = DISP_BUF_BOUNCE_BYTES * 2;
+        break;
+    }
+}
+
+esp_err_t disp_buf_plan(const disp_buf_cfg_t *cfg, disp_buf_plan_t *plan) {
+    const size_t row_bytes = (size_t)cfg->hres * sizeof(lv_color_t);
+    size_t free_bytes = heap_caps_get_free_size(DISP_BUF_INTERNAL_CAPS);
+    size_t largest = heap_caps_get_largest_free_block(DISP_BUF_INTERNAL_CAPS);
+    size_t avail = free_bytes > cfg->reserve_bytes ? free_bytes - cfg->reserve_bytes : 0;
+    uint16_t max_rows = cfg->max_rows < cfg->vres ? cfg->max_rows : cfg->vres;
+
+    // 多块缓冲区：每块不超过可用内存的1/N，也不超过最大连续块
+    size_t each = avail / DISP_BUF_RING_DEPTH < largest ? avail / DISP_BUF_RING_DEPTH : largest;
+    size_t rows = each / row_bytes;
+    if (rows >= cfg->min_rows) {
+        disp_buf_plan_layout(cfg, DISP_BUF_INTERNAL_RING, rows < max_rows ? rows : max_rows, plan);
+        return ESP_OK;
+    }
+
+    each = avail / 2 < largest ? avail / 2 : largest;
+    rows = each / row_bytes;
+    if (rows >= cfg->min_rows) {
+        disp_buf_plan_layout(cfg, DISP_BUF_INTERNAL_DOUBLE, rows < max_rows ? rows : max_rows, plan);
+        return ESP_OK;
+    }
+
+    rows = (avail < largest ? avail : largest) / row_bytes;
+    if (rows >= cfg->min_rows) {
+        disp_buf_plan_layout(cfg, DISP_BUF_INTERNAL_SINGLE, rows < max_rows ? rows : max_rows, plan);
+        return ESP_OK;
+    }
+
+    disp_buf_plan_layout(cfg, DISP_BUF_SPIRAM_BOUNCE, cfg->spiram_rows, plan);
+    if (heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM) < plan->draw_bytes ||
+        largest < DISP_BUF_BOUNCE_BYTES) {
+        ESP_LOGE(TAG, "No memory for draw buffer (internal DMA free %u, largest %u)",
+                 (unsigned)free_bytes, (unsigned)largest);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+/****************    刷屏 ↓   *************************/
+
+/**
+ * @brief SPIRAM布局的刷屏：分块复制到两块中转缓冲区轮流传输，CPU复制下一块时上一块在总线上
+ * @note 同步完成整个区域后通知LVGL；中间每块传输完成时的flush_ready不影响结果，
+ *       因为LVGL要等本回调返回后才会继续
+ */
+static void disp_buf_bounce_flush(lv_disp_drv_t *drv, const lv_area_t *area, const lv_color_t *color_map) {
+    int width = lv_area_get_width(area);
+    int chunk_rows = disp_buf.plan.bounce_bytes / (width * sizeof(lv_color_t));
+    if (chunk_rows < 1) {
+        chunk_rows = 1;     // 中转缓冲区至少能放下一整行(行宽不超过2048像素)
+    }
+
+    const uint8_t *src = (const uint8_t *)color_map;
+    for (int y = area->y1, n = 0; y <= area->y2; y += chunk_rows, n ^= 1) {
+        int rows = (area->y2 + 1 - y) < chunk_rows ? (area->y2 + 1 - y) : chunk_rows;
+        size_t bytes = (size_t)width * rows * sizeof(lv_color_t);
+        memcpy(disp_buf.mem.bounce[n], src, bytes);
+        src += bytes;
+        esp_lcd_panel_draw_bitmap(disp_buf.panel, area->x1, y, area->x2 + 1, y + rows, disp_buf.mem.bounce[n]);
+    }
+    // 轮询命令会等待所有在途传输完成
+    esp_lcd_panel_io_tx_param(disp_buf.io, LCD_CMD_NOP, NULL, 0);
+    lv_disp_flush_ready(drv);
+}
+
+/**
+ * @brief 环形布局的刷屏：排队传输后立即让LVGL渲染下一块缓冲区
+ * @note 显存窗口的行范围设到屏幕底部，同宽且紧接上一条的条带不带命令续写显存，
+ *       esp_lcd只在带命令时等待在途传输，所以最多DISP_BUF_RING_DEPTH条同时排队。
+ *       LVGL在等待flushing之前就取走buf_act作为下一条的缓冲区，所以这里总是先换到下一块，
+ *       下一块还在途时不通知LVGL，由它的传输完成中断通知
+ */
+static void disp_buf_ring_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+    size_t bytes = (size_t)lv_area_get_size(area) * sizeof(lv_color_t);
+    bool last = lv_disp_flush_is_last(drv);
+    int cmd = -1;
+    if (area->x1 != disp_buf.win_x1 || area->x2 != disp_buf.win_x2 || area->y1 != disp_buf.win_next_y) {
+        // 轮询命令会等待所有在途传输完成
+        const uint16_t y_end = disp_buf.cfg.vres - 1;
+        const uint8_t caset[4] = { area->x1 >> 8, area->x1 & 0xFF, area->x2 >> 8, area->x2 & 0xFF };
+        const uint8_t raset[4] = { area->y1 >> 8, area->y1 & 0xFF, y_end >> 8, y_end & 0xFF };
+        esp_lcd_panel_io_tx_param(disp_buf.io, LCD_CMD_CASET, caset, sizeof(caset));
+        esp_lcd_panel_io_tx_param(disp_buf.io, LCD_CMD_RASET, raset, sizeof(raset));
+        disp_buf.win_x1 = area->x1;
+        disp_buf.win_x2 = area->x2;
+        cmd = LCD_CMD_RAMWR;
+    }
+    // 一帧结束后重新设置窗口，不依赖帧之间没有别的代码写屏
+    disp_buf.win_next_y = last ? -1 : area->y2 + 1;
+
+    portENTER_CRITICAL(&ring_lock);
+    disp_buf.ring_inflight++;
+    portEXIT_CRITICAL(&ring_lock);
+    esp_lcd_panel_io_tx_color(disp_buf.io, cmd, color_map, bytes);
+
+    disp_buf.ring_cur = (disp_buf.ring_cur + 1) % DISP_BUF_RING_DEPTH;
+    drv->draw_buf->buf1 = disp_buf.mem.ring[disp_buf.ring_cur];
+    drv->draw_buf->buf_act = disp_buf.mem.ring[disp_buf.ring_cur];
+
+    // 在途的是最近提交的ring_inflight块，全部在途时下一块就是最早提交、最先完成的那块
+    portENTER_CRITICAL(&ring_lock);
+    bool ready = disp_buf.ring_inflight < DISP_BUF_RING_DEPTH;
+    disp_buf.ring_blocked = !ready;
+    portEXIT_CRITICAL(&ring_lock);
+    if (ready) {
+        lv_disp_flush_ready(drv);
+    }
+}
+
+static void disp_buf_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+    if (disp_buf.plan.layout == DISP_BUF_SPIRAM_BOUNCE) {
+        disp_buf_bounce_flush(drv, area, color_map);
+        return;
+    }
+    if (disp_buf.plan.layout == DISP_BUF_INTERNAL_RING) {
+        disp_buf_ring_flush(drv, area, color_map);
+        return;
+    }
+    // 内部DMA缓冲区直接传输，完成后由on_color_trans_done通知LVGL
+    esp_lcd_panel_draw_bitmap(disp_buf.panel, area->x1, area->y1, area->x2 + 1, area->y2 + 1, color_map);
+}
+
+void disp_buf_trans_done(lv_disp_drv_t *drv) {
+    if (disp_buf.plan.layout != DISP_BUF_INTERNAL_RING) {
+        lv_disp_flush_ready(drv);
+        return;
+    }
+    portENTER_CRITICAL_ISR(&ring_lock);
+    if (disp_buf.ring_inflight > 0) {
+        disp_buf.ring_inflight--;
+    }
+    bool ready = disp_buf.ring_blocked;
+    disp_buf.ring_blocked = false;
+    portEXIT_CRITICAL_ISR(&ring_lock);
+    if (ready) {
+        lv_disp_flush_ready(drv);
+    }
+}
+
+static bool disp_buf_color_trans_done(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx) {
+    disp_buf_trans_done((lv_disp_drv_t *)user_ctx);
+    return false;
+}
+
+void disp_buf_wait_idle(void) {
+    if (disp_buf.disp == NULL) {
+        return;
+    }
+    lv_disp_draw_buf_t *draw_buf = disp_buf.disp->driver->draw_buf;
+    while (draw_buf->flushing || disp_buf.ring_inflight > 0) {
+        taskYIELD();
+    }
+}
+
+/****************    缓冲区管理 ↓   *************************/
+
+static void disp_buf_mem_free(disp_buf_mem_t *mem) {
+    heap_caps_free(mem->buf1);
+    heap_caps_free(mem->buf2);
+    for (int i = 0; i < DISP_BUF_RING_DEPTH; i++) {
+        heap_caps_free(mem->ring[i]);
+    }
+    for (int i = 0; i < 2; i++) {
+        heap_caps_free(mem->bounce[i]);
+    }
+    memset(mem, 0, sizeof(*mem));
+}
+
+/**
+ * @brief 按规划分配一种布局的全部缓冲区，失败时释放已分配的部分
+ * @param first 不为NULL时作为第一块绘图缓冲区(lvgl_port_add_disp已分配的)，失败时不释放
+ */
+static esp_err_t disp_buf_mem_alloc(const disp_buf_plan_t *plan, void *first, disp_buf_mem_t *mem) {
+    memset(mem, 0, sizeof(*mem));
+    bool ok = true;
+    if (plan->layout == DISP_BUF_INTERNAL_RING) {
+        for (int i = 0; i < DISP_BUF_RING_DEPTH && ok; i++) {
+            mem->ring[i] = (i == 0 && first) ? first : heap_caps_malloc(plan->draw_bytes, DISP_BUF_INTERNAL_CAPS);
+            ok = mem->ring[i] != NULL;
+        }
+    } else {
+        uint32_t caps = plan->layout == DISP_BUF_SPIRAM_BOUNCE ? MALLOC_CAP_SPIRAM : DISP_BUF_INTERNAL_CAPS;
+        mem->buf1 = first ? first : heap_caps_malloc(plan->draw_bytes, caps);
+        ok = mem->buf1 != NULL;
+        if (ok && plan->layout == DISP_BUF_INTERNAL_DOUBLE) {
+            mem->buf2 = heap_caps_malloc(plan->draw_bytes, caps);
+            ok = mem->buf2 != NULL;
+        }
+    }
+    for (int i = 0; i < 2 && ok && plan->layout == DISP_BUF_SPIRAM_BOUNCE; i++) {
+        mem->bounce[i] = heap_caps_malloc(plan->bounce_bytes, DISP_BUF_INTERNAL_CAPS);
+        ok = mem->bounce[i] != NULL;
+    }
+    if (!ok) {
+        if (first) {
+            // 不释放调用者的缓冲区
+            mem->ring[0] = mem->ring[0] == first ? NULL : mem->ring[0];
+            mem->buf1 = mem->buf1 == first ? NULL : mem->buf1;
+        }
+        disp_buf_mem_free(mem);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief 换上一组缓冲区，环形布局从第一块开始
+ */
+static void disp_buf_mem_install(const disp_buf_plan_t *plan, const disp_buf_mem_t *mem) {
+    disp_buf.mem = *mem;
+    disp_buf.plan = *plan;
+    disp_buf.ring_cur = 0;
+    disp_buf.ring_inflight = 0;
+    disp_buf.ring_blocked = false;
+    disp_buf.win_next_y = -1;
+}
+
+static void disp_buf_log_plan(const disp_buf_plan_t *plan) {
+    ESP_LOGI(TAG, "Draw buffer: %s, %u rows, %u B each, internal RAM %u B",
+             disp_buf_layout_name(plan->layout), plan->rows,
+             (unsigned)plan->draw_bytes, (unsigned)plan->internal_bytes);
+}
+
+esp_err_t disp_buf_attach(lv_disp_t *disp, esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io,
+                          const disp_buf_cfg_t *cfg, const disp_buf_plan_t *plan) {
+    if (disp == NULL || panel == NULL || io == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (disp_buf.disp != NULL) {
+        return ESP_ERR_INVALID_STATE;  // 只支持一个显示
+    }
+    lv_disp_draw_buf_t *draw_buf = disp->driver->draw_buf;
+    disp_buf_plan_t applied = *plan;
+    disp_buf_mem_t mem = { .buf1 = draw_buf->buf1, .buf2 = draw_buf->buf2 };
+    esp_err_t ret = ESP_OK;
+    if (applied.layout == DISP_BUF_INTERNAL_RING || applied.layout == DISP_BUF_SPIRAM_BOUNCE) {
+        ret = disp_buf_mem_alloc(&applied, draw_buf->buf1, &mem);
+    }
+    if (ret != ESP_OK && applied.layout == DISP_BUF_SPIRAM_BOUNCE) {
+        ESP_LOGE(TAG, "Not enough memory for bounce buffers");
+        return ret;
+    }
+    if (ret != ESP_OK) {
+        // 退回lvgl_port_add_disp分配的那一块
+        ESP_LOGW(TAG, "Not enough memory for ring buffers, using a single buffer");
+        disp_buf_plan_layout(cfg, DISP_BUF_INTERNAL_SINGLE, plan->rows, &applied);
+        mem = (disp_buf_mem_t){ .buf1 = draw_buf->buf1 };
+    }
+    // 传输完成后由disp_buf_trans_done决定何时通知LVGL
+    const esp_lcd_panel_io_callbacks_t cbs = {
+        .on_color_trans_done = disp_buf_color_trans_done,
+    };
+    ret = esp_lcd_panel_io_register_event_callbacks(io, &cbs, disp->driver);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    disp_buf.disp = disp;
+    disp_buf.panel = panel;
+    disp_buf.io = io;
+    disp_buf.cfg = *cfg;
+    disp_buf_mem_install(&applied, &mem);
+    disp->driver->flush_cb = disp_buf_flush_cb;
+    disp_buf_log_plan(&applied);
+    return ESP_OK;
+}
+
+esp_err_t disp_buf_apply(const disp_buf_plan_t *plan) {
+    if (disp_buf.disp == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    lv_disp_draw_buf_t *draw_buf = disp_buf.disp->driver->draw_buf;
+
+    // 等待在途传输完成后才能释放正在使用的缓冲区
+    disp_buf_wait_idle();
+
+    // 先在保留旧缓冲区的情况下分配新布局
+    disp_buf_plan_t applied = *plan;
+    disp_buf_mem_t old = disp_buf.mem;
+    disp_buf_mem_t mem;
+    esp_err_t ret = disp_buf_mem_alloc(&applied, NULL, &mem);
+    if (ret != ESP_OK) {
+        // 内存不够时要释放旧缓冲区再试：先留住一块最小的单缓冲区作为退路，保证释放后总有绘图缓冲区可用
+        disp_buf_plan_t spare_plan;
+        disp_buf_mem_t spare;
+        disp_buf_plan_layout(&disp_buf.cfg, DISP_BUF_INTERNAL_SINGLE, disp_buf.cfg.min_rows, &spare_plan);
+        if (disp_buf_mem_alloc(&spare_plan, NULL, &spare) != ESP_OK) {
+            ESP_LOGW(TAG, "Cannot allocate %s with %u rows, keeping %s", disp_buf_layout_name(plan->layout),
+                     plan->rows, disp_buf_layout_name(disp_buf.plan.layout));
+            return ESP_ERR_NO_MEM;
+        }
+        disp_buf_mem_free(&old);
+        ret = disp_buf_mem_alloc(&applied, NULL, &mem);
+        if (ret != ESP_OK) {
+            // 指定布局放不下，恢复原来的布局，仍不行时使用退路
+            ESP_LOGW(TAG, "Cannot allocate %s with %u rows, restoring the previous layout",
+                     disp_buf_layout_name(plan->layout), plan->rows);
+            applied = disp_buf.plan;
+            if (disp_buf_mem_alloc(&applied, NULL, &mem) != ESP_OK) {
+                applied = spare_plan;
+                mem = spare;
+                spare = (disp_buf_mem_t){ 0 };
+            }
+        }
+        disp_buf_mem_free(&spare);
+    } else {
+        disp_buf_mem_free(&old);
+    }
+
+    disp_buf_mem_install(&applied, &mem);
+    void *buf1 = applied.layout == DISP_BUF_INTERNAL_RING ? mem.ring[0] : mem.buf1;
+    lv_disp_draw_buf_init(draw_buf, buf1, mem.buf2, (uint32_t)disp_buf.cfg.hres * applied.rows);
+    lv_obj_invalidate(lv_disp_get_scr_act(disp_buf.disp));
+    disp_buf_log_plan(&applied);
+    return ret;
+}
+
+esp_err_t disp_buf_apply_layout(disp_buf_layout_t layout, uint16_t rows) {
+    disp_buf_plan_t plan;
+    disp_buf_plan_layout(&disp_buf.cfg, layout, rows, &plan);
+    return disp_buf_apply(&plan);
+}
+
+bool disp_buf_get_plan(disp_buf_plan_t *plan) {
+    if (disp_buf.disp == NULL) {
+        return false;
+    }
+    *plan = disp_buf.plan;
+    return true;
+}
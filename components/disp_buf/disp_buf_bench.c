@@ -0,0 +1,153 @@
+#include "disp_buf.h"
+#include <stdio.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "perf_monitor.h"
+
+static const char *TAG = "Disp Bench";
+
+#define BENCH_BARS      (6)     // 渐变色条数量
+
+static lv_obj_t *bench_scr = NULL;
+static lv_obj_t *bench_prev_scr = NULL;
+
+/**
+ * @brief 基准界面：渐变色条、圆弧和文字，覆盖常见的填充/抗锯齿/字体绘制
+ */
+static void bench_create_screen(lv_obj_t **arc, lv_obj_t **result) {
+    bench_scr = lv_obj_create(NULL);
+    lv_obj_clear_flag(bench_scr, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_color(bench_scr, lv_color_hex(0x101820), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    for (int i = 0; i < BENCH_BARS; i++) {
+        lv_obj_t *bar = lv_obj_create(bench_scr);
+        lv_obj_remove_style_all(bar);
+        lv_obj_set_size(bar, lv_pct(100), lv_pct(100 / BENCH_BARS));
+        lv_obj_set_pos(bar, 0, lv_pct(i * 100 / BENCH_BARS));
+        lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_style_bg_color(bar, lv_palette_main(LV_PALETTE_RED + i * 3), LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_style_bg_grad_color(bar, lv_palette_darken(LV_PALETTE_RED + i * 3, 4), LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_style_bg_grad_dir(bar, LV_GRAD_DIR_HOR, LV_PART_MAIN | LV_STATE_DEFAULT);
+    }
+
+    *arc = lv_arc_create(bench_scr);
+    lv_obj_set_size(*arc, 120, 120);
+    lv_obj_align(*arc, LV_ALIGN_LEFT_MID, 10, 0);
+    lv_arc_set_range(*arc, 0, 100);
+    lv_obj_clear_flag(*arc, LV_OBJ_FLAG_CLICKABLE);
+
+    *result = lv_label_create(bench_scr);
+    lv_obj_set_width(*result, 170);
+    lv_obj_align(*result, LV_ALIGN_RIGHT_MID, -6, 0);
+    lv_obj_set_style_bg_color(*result, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(*result, LV_OPA_70, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_all(*result, 4, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_color(*result, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(*result, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_label_set_text(*result, "Draw buffer benchmark\nrunning...");
+}
+
+/**
+ * @brief 重绘一次整屏并等待最后一次传输完成
+ * @note 经过刷新钩子重绘，帧同样计入perf_monitor的统计
+ */
+static uint32_t bench_frame(lv_disp_t *disp) {
+    int64_t start = esp_timer_get_time();
+    lv_obj_invalidate(bench_scr);
+    perf_monitor_refresh(disp);
+    disp_buf_wait_idle();
+    return (uint32_t)(esp_timer_get_time() - start);
+}
+
+static void bench_close_event_cb(lv_event_t *e) {
+    if (bench_prev_scr == NULL) {
+        return;
+    }
+    lv_scr_load(bench_prev_scr);
+    lv_obj_del_async(bench_scr);
+    bench_scr = NULL;
+    bench_prev_scr = NULL;
+}
+
+esp_err_t disp_buf_bench_run(int frames, disp_buf_bench_result_t results[DISP_BUF_LAYOUT_COUNT]) {
+    disp_buf_plan_t orig;
+    if (!disp_buf_get_plan(&orig)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (bench_scr != NULL) {
+        return ESP_ERR_INVALID_STATE;  // 基准界面已经打开
+    }
+    if (frames <= 0) {
+        frames = DISP_BUF_BENCH_FRAMES;
+    }
+
+    lv_disp_t *disp = lv_disp_get_default();
+    lv_obj_t *arc, *result;
+    bench_prev_scr = lv_scr_act();
+    bench_create_screen(&arc, &result);
+    lv_scr_load(bench_scr);
+
+    disp_buf_bench_result_t res[DISP_BUF_LAYOUT_COUNT] = { 0 };
+    for (int l = 0; l < DISP_BUF_LAYOUT_COUNT; l++) {
+        res[l].plan.layout = (disp_buf_layout_t)l;
+        res[l].plan.rows = orig.rows;
+        if (disp_buf_apply_layout((disp_buf_layout_t)l, orig.rows) != ESP_OK) {
+            ESP_LOGW(TAG, "%s skipped: not enough memory", disp_buf_layout_name((disp_buf_layout_t)l));
+            continue;
+        }
+        disp_buf_get_plan(&res[l].plan);
+        bench_frame(disp);                  // 第一帧包含布局切换后的重绘，不计入
+
+        uint64_t total = 0;
+        res[l].min_us = UINT32_MAX;
+        for (int f = 0; f < frames; f++) {
+            lv_arc_set_value(arc, (f * 100) / frames);
+            uint32_t us = bench_frame(disp);
+            total += us;
+            if (us < res[l].min_us) {
+                res[l].min_us = us;
+            }
+        }
+        res[l].frame_us = (uint32_t)(total / frames);
+        res[l].ok = true;
+        ESP_LOGI(TAG, "%-14s %2u rows: avg %u us, min %u us", disp_buf_layout_name((disp_buf_layout_t)l),
+                 res[l].plan.rows, (unsigned)res[l].frame_us, (unsigned)res[l].min_us);
+    }
+    disp_buf_apply(&orig);
+
+    char text[160];
+    int len = snprintf(text, sizeof(text), "Full frame, %u rows\n", orig.rows);
+    for (int l = 0; l < DISP_BUF_LAYOUT_COUNT && len < (int)sizeof(text); l++) {
+        if (res[l].ok) {
+            len += snprintf(text + len, sizeof(text) - len, "%s: %u.%u ms\n", disp_buf_layout_name((disp_buf_layout_t)l),
+                            (unsigned)(res[l].frame_us / 1000), (unsigned)(res[l].frame_us % 1000 / 100));
+        } else {
+            len += snprintf(text + len, sizeof(text) - len, "%s: n/a\n", disp_buf_layout_name((disp_buf_layout_t)l));
+        }
+    }
+    if (len < (int)sizeof(text)) {
+        snprintf(text + len, sizeof(text) - len, "Tap to return");
+    }
+    lv_label_set_text(result, text);
+    lv_obj_add_event_cb(bench_scr, bench_close_event_cb, LV_EVENT_CLICKED, NULL);
+
+    if (results) {
+        memcpy(results, res, sizeof(res));
+    }
+    return ESP_OK;
+}
+
+static void bench_timer_cb(lv_timer_t *timer) {
+    disp_buf_bench_run(0, NULL);
+}
+
+static void bench_open_event_cb(lv_event_t *e) {
+    // 在定时器里运行，避免在输入设备事件处理中切换缓冲区
+    lv_timer_t *timer = lv_timer_create(bench_timer_cb, 0, NULL);
+    lv_timer_set_repeat_count(timer, 1);
+}
+
+void disp_buf_bench_bind(lv_obj_t *obj) {
+    lv_obj_add_event_cb(obj, bench_open_event_cb, LV_EVENT_LONG_PRESSED, NULL);
+}
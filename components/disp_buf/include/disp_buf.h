@@ -0,0 +1,150 @@
+#ifndef DISP_BUF_H
+#define DISP_BUF_H
+// LVGL绘图缓冲区规划：按运行时可用的内部DMA内存选择缓冲区布局，并负责刷屏回调
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+#include "lvgl.h"
+
+/* ========== 规划配置 ========== */
+#define DISP_BUF_BOUNCE_BYTES       (4096)          // SPIRAM布局下每块中转缓冲区的大小
+#define DISP_BUF_RESERVE_BYTES      (48 * 1024)     // 规划后至少保留的内部DMA内存
+#define DISP_BUF_RING_DEPTH         (3)             // 环形布局的缓冲区数量(不超过面板IO的trans_queue_depth)
+
+// 缓冲区布局
+typedef enum {
+    DISP_BUF_INTERNAL_RING,     ///< DISP_BUF_RING_DEPTH块内部DMA缓冲区轮流使用，最多RING_DEPTH-1条在途时继续渲染
+    DISP_BUF_INTERNAL_DOUBLE,   ///< 两块内部DMA缓冲区：渲染下一条时上一条在传输
+    DISP_BUF_INTERNAL_SINGLE,   ///< 一块内部DMA缓冲区：渲染和传输交替进行
+    DISP_BUF_SPIRAM_BOUNCE,     ///< SPIRAM绘图缓冲区，刷屏时经两块内部DMA中转缓冲区传输
+    DISP_BUF_LAYOUT_COUNT,
+} disp_buf_layout_t;
+
+// 规划参数
+typedef struct {
+    uint16_t hres;              ///< 水平分辨率
+    uint16_t vres;              ///< 垂直分辨率
+    uint16_t max_rows;          ///< 内部缓冲区最多行数
+    uint16_t min_rows;          ///< 内部缓冲区最少行数，放不下时改用SPIRAM
+    uint16_t spiram_rows;       ///< SPIRAM缓冲区行数
+    uint32_t reserve_bytes;     ///< 规划后至少保留的内部DMA内存
+} disp_buf_cfg_t;
+
+#define DISP_BUF_DEFAULT_CONFIG(h, v)   \
+    {                                   \
+        .hres = (h),                    \
+        .vres = (v),                    \
+        .max_rows = 40,                 \
+        .min_rows = 10,                 \
+        .spiram_rows = 40,              \
+        .reserve_bytes = DISP_BUF_RESERVE_BYTES, \
+    }
+
+// 规划结果
+typedef struct {
+    disp_buf_layout_t layout;   ///< 缓冲区布局
+    uint16_t rows;              ///< 绘图缓冲区行数
+    uint32_t draw_bytes;        ///< 每块绘图缓冲区字节数
+    uint32_t bounce_bytes;      ///< 每块中转缓冲区字节数(仅SPIRAM布局)
+    uint32_t internal_bytes;    ///< 占用的内部RAM总字节数
+} disp_buf_plan_t;
+
+/**
+ * @brief 按当前空闲的内部DMA内存选择缓冲区布局
+ * @note 按环形、两块、一块内部缓冲区的顺序选择，都放不下min_rows行时使用SPIRAM+中转缓冲区
+ * @param cfg  规划参数
+ * @param plan 输出规划结果
+ * @return esp_err_t 返回ESP_OK表示成功，内存完全不够时返回ESP_ERR_NO_MEM
+ */
+esp_err_t disp_buf_plan(const disp_buf_cfg_t *cfg, disp_buf_plan_t *plan);
+
+/**
+ * @brief 按指定布局和行数生成规划结果(不检查内存)
+ */
+void disp_buf_plan_layout(const disp_buf_cfg_t *cfg, disp_buf_layout_t layout, uint16_t rows, disp_buf_plan_t *plan);
+
+/**
+ * @brief 接管显示的刷屏回调并记录当前布局
+ * @note 在lvgl_port_add_disp(按规划结果分配缓冲区，环形布局只分配第一块)之后、
+ *       perf_monitor_attach之前调用；环形布局时分配其余缓冲区，SPIRAM布局时分配中转缓冲区。
+ *       同时注册面板IO的on_color_trans_done回调(见disp_buf_trans_done)
+ * @param disp  LVGL显示
+ * @param panel 面板句柄
+ * @param io    面板IO句柄
+ * @param cfg   规划参数(保存一份，用于disp_buf_apply_layout)
+ * @param plan  lvgl_port_add_disp所用的规划结果
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t disp_buf_attach(lv_disp_t *disp, esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io,
+                          const disp_buf_cfg_t *cfg, const disp_buf_plan_t *plan);
+
+/**
+ * @brief 一次颜色传输完成(中断上下文)
+ * @note 环形布局释放最早的在途缓冲区，LVGL正在等它时通知LVGL；其他布局直接lv_disp_flush_ready。
+ *       perf_monitor接管on_color_trans_done后应通过perf_monitor_set_flush_ready_cb转调此函数
+ */
+void disp_buf_trans_done(lv_disp_drv_t *drv);
+
+/**
+ * @brief 等待在途的传输全部完成
+ * @note 需在LVGL锁内调用；环形布局下LVGL的flushing标志清除时可能还有传输在途
+ */
+void disp_buf_wait_idle(void);
+
+/**
+ * @brief 运行时切换缓冲区布局
+ * @note 需在LVGL锁内调用；等待当前传输完成后重新分配缓冲区并整屏重绘。
+ *       先在保留旧缓冲区的情况下分配；放不下时留住一块min_rows行的单缓冲区作为退路，释放旧缓冲区再试，
+ *       仍失败时恢复原布局(恢复不了时使用退路)并返回ESP_ERR_NO_MEM，不会没有绘图缓冲区
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t disp_buf_apply(const disp_buf_plan_t *plan);
+
+/**
+ * @brief 按指定布局和行数切换(disp_buf_plan_layout + disp_buf_apply)
+ */
+esp_err_t disp_buf_apply_layout(disp_buf_layout_t layout, uint16_t rows);
+
+/**
+ * @brief 获取当前使用的布局
+ * @return bool 尚未调用disp_buf_attach时返回false
+ */
+bool disp_buf_get_plan(disp_buf_plan_t *plan);
+
+/**
+ * @brief 布局名称(用于日志和基准界面)
+ */
+const char *disp_buf_layout_name(disp_buf_layout_t layout);
+
+/****************    基准界面 ↓   *************************/
+
+#define DISP_BUF_BENCH_FRAMES   (20)    // 每种布局测量的整屏帧数
+
+// 单个布局的基准结果
+typedef struct {
+    disp_buf_plan_t plan;       ///< 测量时的布局
+    bool ok;                    ///< 缓冲区分配成功并完成测量
+    uint32_t frame_us;          ///< 平均整屏帧耗时(渲染到最后一次传输完成)
+    uint32_t min_us;            ///< 最短帧耗时
+} disp_buf_bench_result_t;
+
+/**
+ * @brief 打开基准界面，依次用每种布局重绘整屏并计时，结束后恢复原布局
+ * @note 需在LVGL锁内调用，会阻塞到测量完成；各布局使用相同行数，只比较布局本身。
+ *       结果显示在基准界面上，点击界面返回原界面
+ * @param frames  每种布局的帧数，0表示DISP_BUF_BENCH_FRAMES
+ * @param results 输出每种布局的结果(按disp_buf_layout_t排列)，可为NULL
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t disp_buf_bench_run(int frames, disp_buf_bench_result_t results[DISP_BUF_LAYOUT_COUNT]);
+
+/**
+ * @brief 长按指定对象时打开基准界面
+ * @note 需在LVGL锁内调用
+ */
+void disp_buf_bench_bind(lv_obj_t *obj);
+
+#endif // DISP_BUF_H
@@ -0,0 +1,135 @@
+#include "disp_inv.h"
+#include <string.h>
+#include "esp_log.h"
+#include "perf_monitor.h"
+
+static const char *TAG = "Disp Inv";
+
+static struct {
+    lv_disp_t *disp;
+    bool use_cost;              ///< false时按LVGL默认条件合并
+    disp_inv_cost_t cost;
+    disp_inv_stats_t stats;
+    uint32_t overflow_base;     ///< 清零统计时的disp->inv_overflow_cnt
+} inv;
+
+/**
+ * @brief 区域按绘图缓冲区分块刷屏的块数(与lv_refr.c的get_max_row一致，不考虑rounder_cb)
+ */
+static uint32_t disp_inv_chunks(const lv_area_t *area) {
+    uint32_t w = lv_area_get_width(area);
+    uint32_t h = lv_area_get_height(area);
+    uint32_t rows = inv.disp->driver->draw_buf->size / w;
+    if (rows == 0) {
+        rows = 1;
+    }
+    return (h + rows - 1) / rows;
+}
+
+uint64_t disp_inv_area_cost_ns(const lv_area_t *area) {
+    if (inv.disp == NULL || !inv.use_cost) {
+        return 0;
+    }
+    return (uint64_t)disp_inv_chunks(area) * inv.cost.area_ns + (uint64_t)lv_area_get_size(area) * inv.cost.px_ns;
+}
+
+static bool disp_inv_join_cb(lv_disp_drv_t *drv, const lv_area_t *a1, const lv_area_t *a2, const lv_area_t *joined) {
+    uint32_t size1 = lv_area_get_size(a1);
+    uint32_t size2 = lv_area_get_size(a2);
+    uint32_t size = lv_area_get_size(joined);
+    bool on = _lv_area_is_on(a1, a2);
+    bool join;
+    if (inv.use_cost) {
+        join = disp_inv_area_cost_ns(joined) < disp_inv_area_cost_ns(a1) + disp_inv_area_cost_ns(a2);
+    } else {
+        join = on && size < size1 + size2;
+    }
+    if (join) {
+        inv.stats.joins++;
+        inv.stats.disjoint_joins += !on;
+        inv.stats.px_out += size;
+        inv.stats.px_out -= size1 + size2;
+    }
+    return join;
+}
+
+/**
+ * @brief 刷新前统计合并前的脏区域，合并在LVGL的刷新定时器里进行
+ */
+static void disp_inv_refr_start(lv_disp_t *disp, void *ctx) {
+    if (disp->inv_p > 0) {
+        inv.stats.frames++;
+        inv.stats.areas_in += disp->inv_p;
+        for (uint16_t i = 0; i < disp->inv_p; i++) {
+            uint32_t size = lv_area_get_size(&disp->inv_areas[i]);
+            inv.stats.px_in += size;
+            inv.stats.px_out += size;
+        }
+    }
+}
+
+/**
+ * @brief 第一次调用时接管显示的join_cb并注册刷新前钩子
+ */
+static esp_err_t disp_inv_install(lv_disp_t *disp) {
+    if (disp == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (inv.disp != NULL && inv.disp != disp) {
+        return ESP_ERR_INVALID_STATE;  // 只支持一个显示
+    }
+    if (inv.disp == NULL) {
+        esp_err_t ret = perf_monitor_add_refr_hook(disp, disp_inv_refr_start, NULL, NULL);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        inv.disp = disp;
+        disp->driver->join_cb = disp_inv_join_cb;
+        disp_inv_reset_stats();
+    }
+    return ESP_OK;
+}
+
+esp_err_t disp_inv_set_cost(lv_disp_t *disp, const disp_inv_cost_t *cost) {
+    esp_err_t ret = disp_inv_install(disp);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    inv.use_cost = cost != NULL;
+    if (cost != NULL) {
+        inv.cost = *cost;
+        ESP_LOGI(TAG, "Join dirty areas by cost: %lu ns per area, %lu ns per pixel", (unsigned long)cost->area_ns,
+                 (unsigned long)cost->px_ns);
+    }
+    disp_inv_reset_stats();
+    return ESP_OK;
+}
+
+esp_err_t disp_inv_set_merge(lv_disp_t *disp, bool enable) {
+    esp_err_t ret = disp_inv_install(disp);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    disp->driver->inv_merge = enable;
+    return ESP_OK;
+}
+
+bool disp_inv_get_cost(disp_inv_cost_t *out) {
+    *out = inv.cost;
+    return inv.disp != NULL && inv.use_cost;
+}
+
+void disp_inv_get_stats(disp_inv_stats_t *out) {
+    *out = inv.stats;
+    out->areas_out = inv.stats.areas_in - inv.stats.joins;
+    if (inv.disp != NULL) {
+        out->overflows = inv.disp->inv_overflow_cnt - inv.overflow_base;
+    }
+}
+
+void disp_inv_reset_stats(void) {
+    memset(&inv.stats, 0, sizeof(inv.stats));
+    if (inv.disp != NULL) {
+        inv.overflow_base = inv.disp->inv_overflow_cnt;
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef DISP_INV_H
+#define DISP_INV_H
+// 脏区域合并策略：按代价模型(每个刷新区域的固定开销 + 每像素开销)决定两个脏区域是否合并成一个外接矩形，
+// 刷新前由LVGL的lv_refr_join_area通过join_cb调用；
+// 以及加入脏区域时就合并(LVGL的inv_merge)，缓冲区满时合并最近的两个区域而不是重绘整屏
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+// 代价模型
+typedef struct {
+    uint32_t area_ns;       ///< 每次刷屏的固定开销：设置窗口(CASET/RASET/RAMWR)、启动DMA、LVGL逐区域遍历对象
+    uint32_t px_ns;         ///< 每像素开销：渲染加传输
+} disp_inv_cost_t;
+
+// 合并统计
+typedef struct {
+    uint32_t frames;        ///< 有脏区域的刷新次数
+    uint32_t areas_in;      ///< 合并前的脏区域数
+    uint32_t areas_out;     ///< 合并后实际刷新的区域数
+    uint32_t joins;         ///< 合并次数
+    uint32_t disjoint_joins;///< 其中两个区域不相交的合并次数(LVGL默认策略不会合并)
+    uint64_t px_in;         ///< 合并前的像素总数(重叠部分重复计算)
+    uint64_t px_out;        ///< 合并后的像素总数
+    uint32_t overflows;     ///< 脏区域缓冲区(LV_INV_BUF_SIZE)已满的次数，未开启inv_merge时每次都重绘整屏
+} disp_inv_stats_t;
+
+/**
+ * @brief 按代价模型合并脏区域
+ * @note 需在LVGL锁内调用；只支持一个显示。区域按绘图缓冲区能容纳的行数分块刷屏，
+ *       每块都计一次固定开销。合并后的代价小于两者之和时合并
+ * @param disp LVGL显示
+ * @param cost 代价模型，NULL表示恢复LVGL默认策略(只合并相交且外接矩形小于两者之和的区域)，统计照常进行
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t disp_inv_set_cost(lv_disp_t *disp, const disp_inv_cost_t *cost);
+
+/**
+ * @brief 开关加入脏区域时的合并
+ * @note 需在LVGL锁内调用。开启后新区域覆盖的区域被去掉，与之相交且外接矩形更小的区域被合并；
+ *       缓冲区满时合并外接矩形多出像素最少的两个区域，不再整屏重绘
+ * @param disp LVGL显示
+ * @param enable true开启
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t disp_inv_set_merge(lv_disp_t *disp, bool enable);
+
+/**
+ * @brief 获取当前代价模型
+ * @return 使用LVGL默认策略时返回false
+ */
+bool disp_inv_get_cost(disp_inv_cost_t *out);
+
+/**
+ * @brief 按当前代价模型估算刷新一个区域的开销(纳秒)，未设置代价模型时返回0
+ */
+uint64_t disp_inv_area_cost_ns(const lv_area_t *area);
+
+/**
+ * @brief 获取统计(自disp_inv_set_cost或上次disp_inv_reset_stats起)
+ * @note 需在LVGL锁内调用
+ */
+void disp_inv_get_stats(disp_inv_stats_t *out);
+
+/**
+ * @brief 清零统计
+ * @note 需在LVGL锁内调用
+ */
+void disp_inv_reset_stats(void);
+
+#endif // DISP_INV_H
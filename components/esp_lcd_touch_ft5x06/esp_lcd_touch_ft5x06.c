@@ -13,9 +13,9 @@
 #include "esp_log.h"
 #include "esp_check.h"
 #include "driver/gpio.h"
-#include "driver/i2c.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_touch.h"
+#include "esp_lcd_touch_ft5x06.h"
 
 static const char *TAG = "FT5x06";
 
@@ -75,6 +75,17 @@ static const char *TAG = "FT5x06";
 #define FT5x06_ID_G_FT5201ID            (0xA8)
 #define FT5x06_ID_G_ERR                 (0xA9)
 
+/* Touch point record layout (6 bytes per point, starting at FT5x06_TOUCH1_XH) */
+#define FT5x06_POINT_SIZE       (6)
+#define FT5x06_MAX_POINTS       (5)
+
+/* Private driver structure, the public handle points to the first member */
+typedef struct {
+    esp_lcd_touch_t base;
+    esp_lcd_touch_ft5x06_frame_t frame; /* Last frame with event flags and touch IDs, protected by base.data.lock */
+    uint8_t last_points;                /* Count of points parsed by the last read */
+} esp_lcd_touch_ft5x06_t;
+
 /*******************************************************************************
 * Function definitions
 *******************************************************************************/
@@ -86,6 +97,9 @@ static esp_err_t esp_lcd_touch_ft5x06_del(esp_lcd_touch_handle_t tp);
 static esp_err_t touch_ft5x06_i2c_write(esp_lcd_touch_handle_t tp, uint8_t reg, uint8_t data);
 static esp_err_t touch_ft5x06_i2c_read(esp_lcd_touch_handle_t tp, uint8_t reg, uint8_t *data, uint8_t len);
 
+/* Touch data parsing */
+static void touch_ft5x06_parse(esp_lcd_touch_handle_t tp, const uint8_t *data, uint8_t points);
+
 /* FT5x06 init */
 static esp_err_t touch_ft5x06_init(esp_lcd_touch_handle_t tp);
 
@@ -101,7 +115,7 @@ esp_err_t esp_lcd_touch_new_i2c_ft5x06(const esp_lcd_panel_io_handle_t io, const
     assert(out_touch != NULL);
 
     /* Prepare main structure */
-    esp_lcd_touch_handle_t esp_lcd_touch_ft5x06 = heap_caps_calloc(1, sizeof(esp_lcd_touch_t), MALLOC_CAP_DEFAULT);
+    esp_lcd_touch_handle_t esp_lcd_touch_ft5x06 = heap_caps_calloc(1, sizeof(esp_lcd_touch_ft5x06_t), MALLOC_CAP_DEFAULT);
     ESP_GOTO_ON_FALSE(esp_lcd_touch_ft5x06, ESP_ERR_NO_MEM, err, TAG, "no mem for FT5x06 controller");
 
     /* Communication interface */
@@ -155,42 +169,74 @@ err:
     return ret;
 }
 
+esp_err_t esp_lcd_touch_ft5x06_get_frame(esp_lcd_touch_handle_t tp, esp_lcd_touch_ft5x06_frame_t *frame)
+{
+    ESP_RETURN_ON_FALSE(tp && frame, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    taskENTER_CRITICAL(&tp->data.lock);
+    *frame = ((esp_lcd_touch_ft5x06_t *)tp)->frame;
+    taskEXIT_CRITICAL(&tp->data.lock);
+
+    return ESP_OK;
+}
+
 static esp_err_t esp_lcd_touch_ft5x06_read_data(esp_lcd_touch_handle_t tp)
 {
     esp_err_t err;
-    uint8_t data[30];
+    /* TD_STATUS followed by the point records, parsed in place */
+    uint8_t data[1 + FT5x06_POINT_SIZE * FT5x06_MAX_POINTS];
     uint8_t points;
-    size_t i = 0;
 
     assert(tp != NULL);
 
-    err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH_POINTS, &points, 1);
+#if ESP_LCD_TOUCH_FT5x06_BURST_READ
+    esp_lcd_touch_ft5x06_t *ft5x06 = (esp_lcd_touch_ft5x06_t *)tp;
+    /*
+     * Read TD_STATUS and as many point records as the last read reported (at least one) in a single transaction,
+     * so idle polls and single touches, including touch down, cost one transaction with or without INT.
+     * Only when more fingers come down are the remaining records fetched by a second transaction.
+     */
+    uint8_t burst = (ft5x06->last_points > 0 ? ft5x06->last_points : 1);
+    err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH_POINTS, data, 1 + FT5x06_POINT_SIZE * burst);
     ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
 
-    if (points > 5 || points == 0) {
+    points = data[0] & 0x0F;
+    if (points > FT5x06_MAX_POINTS) {
         return ESP_OK;
     }
-
-    /* Number of touched points */
     points = (points > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : points);
+    if (points > burst) {
+        err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH1_XH + FT5x06_POINT_SIZE * burst,
+                                    &data[1 + FT5x06_POINT_SIZE * burst], FT5x06_POINT_SIZE * (points - burst));
+        ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
+    }
 
-    err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH1_XH, data, 6 * points);
+    touch_ft5x06_parse(tp, &data[1], points);
+    return ESP_OK;
+#else
+    err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH_POINTS, &points, 1);
     ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
 
-    taskENTER_CRITICAL(&tp->data.lock);
+    points &= 0x0F;
+    if (points > FT5x06_MAX_POINTS) {
+        return ESP_OK;
+    }
+
+    if (points == 0) {
+        touch_ft5x06_parse(tp, data, 0);
+        return ESP_OK;
+    }
 
     /* Number of touched points */
-    tp->data.points = points;
+    points = (points > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : points);
 
-    /* Fill all coordinates */
-    for (i = 0; i < points; i++) {
-        tp->data.coords[i].x = (((uint16_t)data[(i * 6) + 0] & 0x0f) << 8) + data[(i * 6) + 1];
-        tp->data.coords[i].y = (((uint16_t)data[(i * 6) + 2] & 0x0f) << 8) + data[(i * 6) + 3];
-    }
+    err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH1_XH, data, FT5x06_POINT_SIZE * points);
+    ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
 
-    taskEXIT_CRITICAL(&tp->data.lock);
+    touch_ft5x06_parse(tp, data, points);
 
     return ESP_OK;
+#endif
 }
 
 static bool esp_lcd_touch_ft5x06_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
@@ -280,6 +326,38 @@ static esp_err_t touch_ft5x06_init(esp_lcd_touch_handle_t tp)
     return ret;
 }
 
+/*
+ * Each point record: XH = event flag[7:6] | X[11:8], XL, YH = touch ID[7:4] | Y[11:8], YL, weight, area[7:4]
+ */
+static void touch_ft5x06_parse(esp_lcd_touch_handle_t tp, const uint8_t *data, uint8_t points)
+{
+    esp_lcd_touch_ft5x06_t *ft5x06 = (esp_lcd_touch_ft5x06_t *)tp;
+
+    taskENTER_CRITICAL(&tp->data.lock);
+
+    /* Number of touched points */
+    tp->data.points = points;
+    ft5x06->frame.points = points;
+    ft5x06->last_points = points;
+
+    /* Fill all coordinates */
+    for (size_t i = 0; i < points; i++) {
+        const uint8_t *p = &data[i * FT5x06_POINT_SIZE];
+        tp->data.coords[i].x = (((uint16_t)p[0] & 0x0f) << 8) + p[1];
+        tp->data.coords[i].y = (((uint16_t)p[2] & 0x0f) << 8) + p[3];
+        tp->data.coords[i].strength = p[4];
+
+        ft5x06->frame.point[i].x = tp->data.coords[i].x;
+        ft5x06->frame.point[i].y = tp->data.coords[i].y;
+        ft5x06->frame.point[i].event = (esp_lcd_touch_ft5x06_event_t)(p[0] >> 6);
+        ft5x06->frame.point[i].id = p[2] >> 4;
+        ft5x06->frame.point[i].weight = p[4];
+        ft5x06->frame.point[i].area = p[5] >> 4;
+    }
+
+    taskEXIT_CRITICAL(&tp->data.lock);
+}
+
 static esp_err_t touch_ft5x06_i2c_write(esp_lcd_touch_handle_t tp, uint8_t reg, uint8_t data)
 {
     assert(tp != NULL);
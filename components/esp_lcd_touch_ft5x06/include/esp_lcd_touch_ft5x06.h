@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: 2022 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "esp_lcd_touch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Read TD_STATUS and the point records in one I2C transaction
+ *
+ * @note The burst covers as many records as the previous read reported (at least one), so idle polls,
+ *       touch down and single touches cost one transaction, whether or not INT is wired; a second
+ *       transaction is needed only when the count of fingers grows. With 0, every touched poll reads
+ *       TD_STATUS first and then the point records in a second transaction.
+ */
+#ifndef ESP_LCD_TOUCH_FT5x06_BURST_READ
+#define ESP_LCD_TOUCH_FT5x06_BURST_READ (1)
+#endif
+
+/**
+ * @brief Event flag of a touch point record
+ */
+typedef enum {
+    ESP_LCD_TOUCH_FT5x06_EVENT_DOWN = 0,    /*!< First contact */
+    ESP_LCD_TOUCH_FT5x06_EVENT_UP = 1,      /*!< Lift up */
+    ESP_LCD_TOUCH_FT5x06_EVENT_CONTACT = 2, /*!< Contact continues */
+    ESP_LCD_TOUCH_FT5x06_EVENT_NONE = 3,    /*!< No event */
+} esp_lcd_touch_ft5x06_event_t;
+
+/**
+ * @brief Touch frame of the last read, including the fields not covered by esp_lcd_touch_get_coordinates()
+ */
+typedef struct {
+    uint8_t points; /*!< Count of touch points */
+    struct {
+        uint16_t x;                         /*!< X coordinate (raw, before swap/mirror) */
+        uint16_t y;                         /*!< Y coordinate (raw, before swap/mirror) */
+        esp_lcd_touch_ft5x06_event_t event; /*!< Event flag */
+        uint8_t id;                         /*!< Touch ID, stays the same while the finger is down */
+        uint8_t weight;                     /*!< Touch weight */
+        uint8_t area;                       /*!< Touch area */
+    } point[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+} esp_lcd_touch_ft5x06_frame_t;
+
+/**
+ * @brief Create a new FT5x06 touch driver
+ *
+ * @note The I2C communication should be initialized before use this function.
+ *
+ * @param io LCD/Touch panel IO handle
+ * @param config: Touch configuration
+ * @param out_touch: Touch instance handle
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_NO_MEM            if there is no memory for allocating main structure
+ */
+esp_err_t esp_lcd_touch_new_i2c_ft5x06(const esp_lcd_panel_io_handle_t io, const esp_lcd_touch_config_t *config, esp_lcd_touch_handle_t *out_touch);
+
+/**
+ * @brief Get the touch frame parsed by the last esp_lcd_touch_read_data()
+ *
+ * @note Unlike esp_lcd_touch_get_coordinates(), the data is not invalidated.
+ *
+ * @param tp: Touch instance handle created by esp_lcd_touch_new_i2c_ft5x06()
+ * @param frame: Returned frame
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if tp or frame is NULL
+ */
+esp_err_t esp_lcd_touch_ft5x06_get_frame(esp_lcd_touch_handle_t tp, esp_lcd_touch_ft5x06_frame_t *frame);
+
+/**
+ * @brief I2C address of the FT5x06 controller
+ *
+ */
+#define ESP_LCD_TOUCH_IO_I2C_FT5x06_ADDRESS (0x38)
+
+/**
+ * @brief Touch IO configuration structure
+ *
+ */
+#define ESP_LCD_TOUCH_IO_I2C_FT5x06_CONFIG()           \
+    {                                       \
+        .dev_addr = ESP_LCD_TOUCH_IO_I2C_FT5x06_ADDRESS, \
+        .control_phase_bytes = 1,           \
+        .dc_bit_offset = 0,                 \
+        .lcd_cmd_bits = 8,                  \
+        .flags =                            \
+        {                                   \
+            .disable_control_phase = 1,     \
+        }                                   \
+    }
+
+
+#ifdef __cplusplus
+}
+#endif
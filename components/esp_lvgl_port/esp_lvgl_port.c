@@ -37,6 +37,11 @@ LV_IMG_DECLARE(img_cursor)
 #define LVGL_PORT_HANDLE_FLUSH_READY 1
 #endif
 
+/* Wake the LVGL task when another task releases the LVGL mutex and has left work for it (invalidated areas or timers due) */
+#ifndef LVGL_PORT_TASK_WAKE_ON_UNLOCK
+#define LVGL_PORT_TASK_WAKE_ON_UNLOCK 1
+#endif
+
 static const char *TAG = "LVGL";
 
 /*******************************************************************************
@@ -73,8 +78,16 @@ typedef struct {
 typedef struct lvgl_port_ctx_s {
     SemaphoreHandle_t   lvgl_mux;
     esp_timer_handle_t  tick_timer;
+    TaskHandle_t        lvgl_task;
     bool                running;
+    bool                timers_stopped;
     int                 task_max_sleep_ms;
+    uint32_t            lock_depth;     /* Recursive depth of the LVGL mutex, changed only by its holder */
+    uint32_t            sleep_until;    /* lv_tick at which the LVGL task wakes up by itself, set under the mutex */
+    volatile uint32_t   task_wakeups;
+    volatile uint32_t   task_notified;
+    volatile uint32_t   tick_irqs;
+    volatile bool       touch_pending;
 #ifdef ESP_LVGL_PORT_USB_HOST_HID_COMPONENT
     lvgl_port_usb_hid_ctx_t hid_ctx;
 #endif
@@ -133,6 +146,9 @@ static int lvgl_port_timer_period_ms = 5;
 static void lvgl_port_task(void *arg);
 static esp_err_t lvgl_port_tick_init(void);
 static void lvgl_port_task_deinit(void);
+#if LVGL_PORT_TASK_WAKE_ON_UNLOCK
+static bool lvgl_port_work_pending(void);
+#endif
 
 // LVGL callbacks
 #if LVGL_PORT_HANDLE_FLUSH_READY
@@ -142,6 +158,7 @@ static void lvgl_port_flush_callback(lv_disp_drv_t *drv, const lv_area_t *area,
 static void lvgl_port_update_callback(lv_disp_drv_t *drv);
 #ifdef ESP_LVGL_PORT_TOUCH_COMPONENT
 static void lvgl_port_touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
+static void lvgl_port_touch_interrupt_callback(esp_lcd_touch_handle_t tp);
 #endif
 #ifdef ESP_LVGL_PORT_KNOB_COMPONENT
 static void lvgl_port_encoder_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
@@ -189,9 +206,9 @@ esp_err_t lvgl_port_init(const lvgl_port_cfg_t *cfg)
 
     BaseType_t res;
     if (cfg->task_affinity < 0) {
-        res = xTaskCreate(lvgl_port_task, "LVGL task", cfg->task_stack, NULL, cfg->task_priority, NULL);
+        res = xTaskCreate(lvgl_port_task, "LVGL task", cfg->task_stack, NULL, cfg->task_priority, &lvgl_port_ctx.lvgl_task);
     } else {
-        res = xTaskCreatePinnedToCore(lvgl_port_task, "LVGL task", cfg->task_stack, NULL, cfg->task_priority, NULL, cfg->task_affinity);
+        res = xTaskCreatePinnedToCore(lvgl_port_task, "LVGL task", cfg->task_stack, NULL, cfg->task_priority, &lvgl_port_ctx.lvgl_task, cfg->task_affinity);
     }
     ESP_GOTO_ON_FALSE(res == pdPASS, ESP_FAIL, err, TAG, "Create LVGL task fail!");
 
@@ -207,10 +224,24 @@ esp_err_t lvgl_port_resume(void)
 {
     esp_err_t ret = ESP_ERR_INVALID_STATE;
 
+#if LV_TICK_CUSTOM
+    /* LVGL reads esp_timer_get_time() itself, there is no tick timer to restart */
+    if (lvgl_port_ctx.lvgl_mux != NULL) {
+        lv_timer_enable(true);
+        lvgl_port_ctx.timers_stopped = false;
+        ret = ESP_OK;
+    }
+#else
     if (lvgl_port_ctx.tick_timer != NULL) {
         lv_timer_enable(true);
+        lvgl_port_ctx.timers_stopped = false;
         ret = esp_timer_start_periodic(lvgl_port_ctx.tick_timer, lvgl_port_timer_period_ms * 1000);
     }
+#endif
+    if (ret == ESP_OK) {
+        /* Stopped LVGL task sleeps task_max_sleep_ms, do not wait for it */
+        lvgl_port_task_wake();
+    }
 
     return ret;
 }
@@ -219,10 +250,19 @@ esp_err_t lvgl_port_stop(void)
 {
     esp_err_t ret = ESP_ERR_INVALID_STATE;
 
+#if LV_TICK_CUSTOM
+    if (lvgl_port_ctx.lvgl_mux != NULL) {
+        lv_timer_enable(false);
+        lvgl_port_ctx.timers_stopped = true;
+        ret = ESP_OK;
+    }
+#else
     if (lvgl_port_ctx.tick_timer != NULL) {
         lv_timer_enable(false);
+        lvgl_port_ctx.timers_stopped = true;
         ret = esp_timer_stop(lvgl_port_ctx.tick_timer);
     }
+#endif
 
     return ret;
 }
@@ -385,6 +425,11 @@ lv_indev_t *lvgl_port_add_touch(const lvgl_port_touch_cfg_t *touch_cfg)
     touch_ctx->indev_drv.disp = touch_cfg->disp;
     touch_ctx->indev_drv.read_cb = lvgl_port_touchpad_read;
     touch_ctx->indev_drv.user_data = touch_ctx;
+
+    /* Wake the LVGL task on touch interrupt instead of waiting for the next read period */
+    if (touch_cfg->handle->config.int_gpio_num != GPIO_NUM_NC) {
+        esp_lcd_touch_register_interrupt_callback(touch_cfg->handle, lvgl_port_touch_interrupt_callback);
+    }
     return lv_indev_drv_register(&touch_ctx->indev_drv);
 }
 
@@ -658,13 +703,59 @@ bool lvgl_port_lock(uint32_t timeout_ms)
     assert(lvgl_port_ctx.lvgl_mux && "lvgl_port_init must be called first");
 
     const TickType_t timeout_ticks = (timeout_ms == 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
-    return xSemaphoreTakeRecursive(lvgl_port_ctx.lvgl_mux, timeout_ticks) == pdTRUE;
+    if (xSemaphoreTakeRecursive(lvgl_port_ctx.lvgl_mux, timeout_ticks) != pdTRUE) {
+        return false;
+    }
+    lvgl_port_ctx.lock_depth++;
+    return true;
 }
 
 void lvgl_port_unlock(void)
 {
     assert(lvgl_port_ctx.lvgl_mux && "lvgl_port_init must be called first");
+    assert(lvgl_port_ctx.lock_depth > 0 && "LVGL mutex is not taken");
+    bool outermost = --lvgl_port_ctx.lock_depth == 0;
+#if LVGL_PORT_TASK_WAKE_ON_UNLOCK
+    /* Inner unlocks and read-only callers (statistics, pausing a timer) don't wake the LVGL task */
+    bool wake = outermost && xTaskGetCurrentTaskHandle() != lvgl_port_ctx.lvgl_task && lvgl_port_work_pending();
+#else
+    (void)outermost;
+#endif
     xSemaphoreGiveRecursive(lvgl_port_ctx.lvgl_mux);
+#if LVGL_PORT_TASK_WAKE_ON_UNLOCK
+    if (wake) {
+        lvgl_port_task_wake();
+    }
+#endif
+}
+
+void lvgl_port_task_wake(void)
+{
+    if (lvgl_port_ctx.lvgl_task) {
+        xTaskNotifyGive(lvgl_port_ctx.lvgl_task);
+    }
+}
+
+void lvgl_port_task_wake_from_isr(BaseType_t *higher_priority_task_woken)
+{
+    if (lvgl_port_ctx.lvgl_task) {
+        vTaskNotifyGiveFromISR(lvgl_port_ctx.lvgl_task, higher_priority_task_woken);
+    }
+}
+
+void lvgl_port_get_task_stats(lvgl_port_task_stats_t *stats)
+{
+    assert(stats);
+    stats->wakeups = lvgl_port_ctx.task_wakeups;
+    stats->notified = lvgl_port_ctx.task_notified;
+    stats->tick_irqs = lvgl_port_ctx.tick_irqs;
+}
+
+void lvgl_port_reset_task_stats(void)
+{
+    lvgl_port_ctx.task_wakeups = 0;
+    lvgl_port_ctx.task_notified = 0;
+    lvgl_port_ctx.tick_irqs = 0;
 }
 
 void lvgl_port_flush_ready(lv_disp_t *disp)
@@ -680,23 +771,71 @@ void lvgl_port_flush_ready(lv_disp_t *disp)
 * Private functions
 *******************************************************************************/
 
+#if LVGL_PORT_TASK_WAKE_ON_UNLOCK
+/**
+ * Called with the LVGL mutex held: has the caller left work that the LVGL task would not do before it wakes
+ * up by itself? Invalidated areas, or a timer that became due earlier (lv_timer_ready, resumed, created).
+ */
+static bool lvgl_port_work_pending(void)
+{
+    for (lv_disp_t *disp = lv_disp_get_next(NULL); disp; disp = lv_disp_get_next(disp)) {
+        if (disp->inv_p > 0) {
+            return true;
+        }
+    }
+    for (lv_timer_t *timer = lv_timer_get_next(NULL); timer; timer = lv_timer_get_next(timer)) {
+        if (!timer->paused && (int32_t)(timer->last_run + timer->period - lvgl_port_ctx.sleep_until) < 0) {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
 static void lvgl_port_task(void *arg)
 {
     uint32_t task_delay_ms = lvgl_port_ctx.task_max_sleep_ms;
+    bool notified = false;
 
     ESP_LOGI(TAG, "Starting LVGL task");
     lvgl_port_ctx.running = true;
     while (lvgl_port_ctx.running) {
         if (lvgl_port_lock(0)) {
+#ifdef ESP_LVGL_PORT_TOUCH_COMPONENT
+            /* Touch interrupt: read pointer devices now instead of at the next read period */
+            if (lvgl_port_ctx.touch_pending) {
+                lvgl_port_ctx.touch_pending = false;
+                for (lv_indev_t *indev = lv_indev_get_next(NULL); indev; indev = lv_indev_get_next(indev)) {
+                    if (indev->driver->type == LV_INDEV_TYPE_POINTER && indev->driver->read_timer) {
+                        lv_timer_ready(indev->driver->read_timer);
+                    }
+                }
+            }
+#endif
+            /* Woken up on demand: refresh invalidated displays now instead of at the next refresh period */
+            if (notified) {
+                for (lv_disp_t *disp = lv_disp_get_next(NULL); disp; disp = lv_disp_get_next(disp)) {
+                    if (disp->inv_p > 0 && disp->refr_timer) {
+                        lv_timer_ready(disp->refr_timer);
+                    }
+                }
+            }
             task_delay_ms = lv_timer_handler();
+            /* lv_timer_handler() returns 1 when timers are disabled; with a millisecond tick it is also a real deadline */
+            if ((task_delay_ms > lvgl_port_ctx.task_max_sleep_ms) || lvgl_port_ctx.timers_stopped) {
+                task_delay_ms = lvgl_port_ctx.task_max_sleep_ms;
+            } else if (task_delay_ms < 1) {
+                task_delay_ms = 1;
+            }
+            lvgl_port_ctx.sleep_until = lv_tick_get() + task_delay_ms;
             lvgl_port_unlock();
         }
-        if ((task_delay_ms > lvgl_port_ctx.task_max_sleep_ms) || (1 == task_delay_ms)) {
-            task_delay_ms = lvgl_port_ctx.task_max_sleep_ms;
-        } else if (task_delay_ms < 1) {
-            task_delay_ms = 1;
+        /* Sleep until the next LVGL timer deadline or until somebody calls lvgl_port_task_wake() */
+        notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(task_delay_ms)) > 0;
+        if (notified) {
+            lvgl_port_ctx.task_notified++;
         }
-        vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+        lvgl_port_ctx.task_wakeups++;
     }
 
     lvgl_port_task_deinit();
@@ -824,6 +963,17 @@ static void lvgl_port_touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *
         data->state = LV_INDEV_STATE_RELEASED;
     }
 }
+
+static void IRAM_ATTR lvgl_port_touch_interrupt_callback(esp_lcd_touch_handle_t tp)
+{
+    BaseType_t higher_priority_task_woken = pdFALSE;
+
+    lvgl_port_ctx.touch_pending = true;
+    lvgl_port_task_wake_from_isr(&higher_priority_task_woken);
+    if (higher_priority_task_woken) {
+        portYIELD_FROM_ISR();
+    }
+}
 #endif
 
 #ifdef ESP_LVGL_PORT_KNOB_COMPONENT
@@ -1257,14 +1407,21 @@ static void lvgl_port_usb_hid_callback(hid_host_device_handle_t hid_device_handl
 }
 #endif
 
+#if !LV_TICK_CUSTOM
 static void lvgl_port_tick_increment(void *arg)
 {
     /* Tell LVGL how many milliseconds have elapsed */
     lv_tick_inc(lvgl_port_timer_period_ms);
+    lvgl_port_ctx.tick_irqs++;
 }
+#endif
 
 static esp_err_t lvgl_port_tick_init(void)
 {
+#if LV_TICK_CUSTOM
+    /* Tickless: LV_TICK_CUSTOM_SYS_TIME_EXPR reads esp_timer_get_time(), no periodic interrupt is needed */
+    return ESP_OK;
+#else
     // Tick interface for LVGL (using esp_timer to generate 2ms periodic event)
     const esp_timer_create_args_t lvgl_tick_timer_args = {
         .callback = &lvgl_port_tick_increment,
@@ -1272,4 +1429,5 @@ static esp_err_t lvgl_port_tick_init(void)
     };
     ESP_RETURN_ON_ERROR(esp_timer_create(&lvgl_tick_timer_args, &lvgl_port_ctx.tick_timer), TAG, "Creating LVGL timer filed!");
     return esp_timer_start_periodic(lvgl_port_ctx.tick_timer, lvgl_port_timer_period_ms * 1000);
+#endif
 }
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_ops.h"
 #include "lvgl.h"
@@ -48,7 +49,7 @@ typedef struct {
     int task_stack;         /*!< LVGL task stack size */
     int task_affinity;      /*!< LVGL task pinned to core (-1 is no affinity) */
     int task_max_sleep_ms;  /*!< Maximum sleep in LVGL task */
-    int timer_period_ms;    /*!< LVGL timer tick period in ms */
+    int timer_period_ms;    /*!< LVGL timer tick period in ms (unused with LV_TICK_CUSTOM) */
 } lvgl_port_cfg_t;
 
 /**
@@ -298,9 +299,48 @@ bool lvgl_port_lock(uint32_t timeout_ms);
 /**
  * @brief Give LVGL mutex
  *
+ * @note The outermost unlock from a task other than the LVGL task wakes the LVGL task when work is pending:
+ *       invalidated areas or a timer due before the LVGL task would wake up by itself. Inner (recursive)
+ *       unlocks and read-only critical sections don't wake it.
  */
 void lvgl_port_unlock(void);
 
+/**
+ * @brief LVGL task wake-up statistics
+ */
+typedef struct {
+    uint32_t wakeups;       /*!< LVGL task wake-ups (timer deadlines and notifications) */
+    uint32_t notified;      /*!< Wake-ups requested by lvgl_port_task_wake() */
+    uint32_t tick_irqs;     /*!< lv_tick_inc() timer callbacks (always 0 with LV_TICK_CUSTOM) */
+} lvgl_port_task_stats_t;
+
+/**
+ * @brief Wake LVGL task to handle pending timers and invalidated areas now
+ *
+ * @note The LVGL task sleeps until the next LVGL timer deadline. lvgl_port_unlock() called from another task
+ *       with work pending and touch interrupts wake it automatically.
+ */
+void lvgl_port_task_wake(void);
+
+/**
+ * @brief Wake LVGL task from ISR
+ *
+ * @param higher_priority_task_woken Set to pdTRUE if a context switch should be requested before the ISR exits
+ */
+void lvgl_port_task_wake_from_isr(BaseType_t *higher_priority_task_woken);
+
+/**
+ * @brief Get LVGL task wake-up statistics
+ *
+ * @param stats Output statistics
+ */
+void lvgl_port_get_task_stats(lvgl_port_task_stats_t *stats);
+
+/**
+ * @brief Reset LVGL task wake-up statistics
+ */
+void lvgl_port_reset_task_stats(void);
+
 /**
  * @brief Notify LVGL, that data was flushed to LCD display
  *
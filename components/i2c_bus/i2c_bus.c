@@ -0,0 +1,378 @@
+#include "i2c_bus.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esp_lcd_panel_io_interface.h"
+
+static const char *TAG = "I2C Bus";
+
+// 一个排队的请求，每个设备预先分配I2C_BUS_QUEUE_DEPTH个
+typedef struct {
+    const i2c_bus_xfer_t *xfers;
+    size_t count;
+    int64_t submit_us;
+    esp_err_t err;
+    SemaphoreHandle_t done;             ///< 总线任务执行完成后释放
+} i2c_bus_req_t;
+
+struct i2c_bus_dev {
+    i2c_master_dev_handle_t handle;
+    QueueHandle_t pending;              ///< 等待执行的请求
+    QueueHandle_t free;                 ///< 空闲的请求
+    i2c_bus_req_t reqs[I2C_BUS_QUEUE_DEPTH];
+    i2c_bus_dev_stats_t stats;
+};
+
+/**
+ * @brief 总线状态
+ * @note 设备列表按优先级从高到低排列，添加设备和总线任务选取请求都在lock内进行；
+ *       总线和设备的统计也只在lock内修改，i2c_bus_get_stats读到的是一致的快照
+ */
+static struct {
+    i2c_master_bus_handle_t bus;
+    uint32_t max_scl_hz;
+    TaskHandle_t task;
+    SemaphoreHandle_t work;             ///< 所有设备排队中的请求数
+    SemaphoreHandle_t lock;
+    struct i2c_bus_dev *devs[I2C_BUS_MAX_DEVICES];
+    uint8_t dev_count;
+    i2c_bus_stats_t stats;
+    int64_t stats_start_us;
+} bus;
+
+/**
+ * @brief 取优先级最高的设备排队的请求，同优先级的设备之间先提交的先执行
+ */
+static struct i2c_bus_dev *i2c_bus_next(i2c_bus_req_t **req) {
+    struct i2c_bus_dev *best = NULL;
+    int64_t best_submit = 0;
+    xSemaphoreTake(bus.lock, portMAX_DELAY);
+    for (int i = 0; i < bus.dev_count; i++) {
+        struct i2c_bus_dev *dev = bus.devs[i];
+        if (best && dev->stats.prio < best->stats.prio) {
+            break;
+        }
+        i2c_bus_req_t *head;
+        if (xQueuePeek(dev->pending, &head, 0) == pdTRUE && (best == NULL || head->submit_us < best_submit)) {
+            best = dev;
+            best_submit = head->submit_us;
+        }
+    }
+    if (best) {
+        xQueueReceive(best->pending, req, 0);
+    }
+    xSemaphoreGive(bus.lock);
+    return best;
+}
+
+static esp_err_t i2c_bus_run_xfer(struct i2c_bus_dev *dev, const i2c_bus_xfer_t *xfer) {
+    if (xfer->wlen && xfer->rlen) {
+        return i2c_master_transmit_receive(dev->handle, xfer->wbuf, xfer->wlen, xfer->rbuf, xfer->rlen,
+                                           I2C_BUS_XFER_TIMEOUT_MS);
+    } else if (xfer->wlen) {
+        return i2c_master_transmit(dev->handle, xfer->wbuf, xfer->wlen, I2C_BUS_XFER_TIMEOUT_MS);
+    }
+    return i2c_master_receive(dev->handle, xfer->rbuf, xfer->rlen, I2C_BUS_XFER_TIMEOUT_MS);
+}
+
+/**
+ * @brief 执行一个请求的全部事务，统计等待和占用时间
+ * @note 执行事务时不持有lock，执行完后在lock内一次更新统计
+ */
+static void i2c_bus_run(struct i2c_bus_dev *dev, i2c_bus_req_t *req) {
+    int64_t start = esp_timer_get_time();
+    uint32_t wait = (uint32_t)(start - req->submit_us);
+    uint32_t transactions = 0;
+    uint32_t bytes = 0;
+
+    req->err = ESP_OK;
+    for (size_t i = 0; i < req->count && req->err == ESP_OK; i++) {
+        req->err = i2c_bus_run_xfer(dev, &req->xfers[i]);
+        transactions++;
+        bytes += (uint32_t)(req->xfers[i].wlen + req->xfers[i].rlen);
+    }
+    uint32_t busy = (uint32_t)(esp_timer_get_time() - start);
+
+    xSemaphoreTake(bus.lock, portMAX_DELAY);
+    dev->stats.wait_us += wait;
+    if (wait > dev->stats.wait_max_us) {
+        dev->stats.wait_max_us = wait;
+    }
+    dev->stats.transactions += transactions;
+    dev->stats.busy_us += busy;
+    dev->stats.requests++;
+    bus.stats.transactions += transactions;
+    bus.stats.bytes += bytes;
+    bus.stats.busy_us += busy;
+    bus.stats.requests++;
+    if (req->err != ESP_OK) {
+        dev->stats.errors++;
+    }
+    xSemaphoreGive(bus.lock);
+
+    if (req->err != ESP_OK) {
+        ESP_LOGD(TAG, "%s: %s", dev->stats.name, esp_err_to_name(req->err));
+    }
+    xSemaphoreGive(req->done);
+}
+
+/**
+ * @brief 总线任务：被唤醒后连续执行所有已排队的请求，每个请求都重新按优先级选取
+ */
+static void i2c_bus_task(void *arg) {
+    for (;;) {
+        xSemaphoreTake(bus.work, portMAX_DELAY);
+        xSemaphoreTake(bus.lock, portMAX_DELAY);
+        bus.stats.batches++;
+        xSemaphoreGive(bus.lock);
+        do {
+            i2c_bus_req_t *req;
+            struct i2c_bus_dev *dev = i2c_bus_next(&req);
+            if (dev) {
+                i2c_bus_run(dev, req);
+            }
+        } while (xSemaphoreTake(bus.work, 0) == pdTRUE);
+    }
+}
+
+esp_err_t i2c_bus_init(i2c_port_num_t port, gpio_num_t sda, gpio_num_t scl, uint32_t max_scl_hz) {
+    ESP_RETURN_ON_FALSE(bus.bus == NULL, ESP_ERR_INVALID_STATE, TAG, "already initialized");
+    const i2c_master_bus_config_t bus_config = {
+        .i2c_port = port,
+        .sda_io_num = sda,
+        .scl_io_num = scl,
+        .clk_source = I2C_CLK_SRC_DEFAULT,
+        .glitch_ignore_cnt = 7,
+        .flags.enable_internal_pullup = true,
+    };
+    bus.lock = xSemaphoreCreateMutex();
+    bus.work = xSemaphoreCreateCounting(I2C_BUS_MAX_DEVICES * I2C_BUS_QUEUE_DEPTH, 0);
+    ESP_RETURN_ON_FALSE(bus.lock && bus.work, ESP_ERR_NO_MEM, TAG, "no mem for bus semaphores");
+    ESP_RETURN_ON_ERROR(i2c_new_master_bus(&bus_config, &bus.bus), TAG, "create master bus failed");
+    bus.max_scl_hz = max_scl_hz;
+    bus.stats_start_us = esp_timer_get_time();
+    if (xTaskCreate(i2c_bus_task, "i2c_bus", I2C_BUS_TASK_STACK, NULL, I2C_BUS_TASK_PRIORITY, &bus.task) != pdPASS) {
+        i2c_del_master_bus(bus.bus);
+        bus.bus = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t i2c_bus_add_device(const i2c_bus_dev_config_t *config, i2c_bus_dev_handle_t *ret_dev) {
+    ESP_RETURN_ON_FALSE(config && ret_dev, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(bus.bus, ESP_ERR_INVALID_STATE, TAG, "bus not initialized");
+
+    struct i2c_bus_dev *dev = calloc(1, sizeof(*dev));
+    ESP_RETURN_ON_FALSE(dev, ESP_ERR_NO_MEM, TAG, "no mem for device");
+    dev->pending = xQueueCreate(I2C_BUS_QUEUE_DEPTH, sizeof(i2c_bus_req_t *));
+    dev->free = xQueueCreate(I2C_BUS_QUEUE_DEPTH, sizeof(i2c_bus_req_t *));
+    esp_err_t ret = dev->pending && dev->free ? ESP_OK : ESP_ERR_NO_MEM;
+    for (int i = 0; i < I2C_BUS_QUEUE_DEPTH && ret == ESP_OK; i++) {
+        dev->reqs[i].done = xSemaphoreCreateBinary();
+        if (dev->reqs[i].done == NULL) {
+            ret = ESP_ERR_NO_MEM;
+            break;
+        }
+        i2c_bus_req_t *req = &dev->reqs[i];
+        xQueueSend(dev->free, &req, 0);
+    }
+
+    uint32_t scl_hz = config->max_scl_hz && config->max_scl_hz < bus.max_scl_hz ? config->max_scl_hz : bus.max_scl_hz;
+    if (ret == ESP_OK) {
+        const i2c_device_config_t dev_config = {
+            .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+            .device_address = config->addr,
+            .scl_speed_hz = scl_hz,
+        };
+        ret = i2c_master_bus_add_device(bus.bus, &dev_config, &dev->handle);
+    }
+
+    // 按优先级插入，同优先级先添加的在前
+    xSemaphoreTake(bus.lock, portMAX_DELAY);
+    if (ret == ESP_OK && bus.dev_count >= I2C_BUS_MAX_DEVICES) {
+        ret = ESP_ERR_NO_MEM;
+    }
+    if (ret == ESP_OK) {
+        dev->stats.name = config->name ? config->name : "?";
+        dev->stats.prio = config->prio;
+        dev->stats.scl_hz = scl_hz;
+        int pos = bus.dev_count;
+        while (pos > 0 && bus.devs[pos - 1]->stats.prio < config->prio) {
+            bus.devs[pos] = bus.devs[pos - 1];
+            pos--;
+        }
+        bus.devs[pos] = dev;
+        bus.dev_count++;
+    }
+    xSemaphoreGive(bus.lock);
+
+    if (ret != ESP_OK) {
+        if (dev->handle) {
+            i2c_master_bus_rm_device(dev->handle);
+        }
+        for (int i = 0; i < I2C_BUS_QUEUE_DEPTH; i++) {
+            if (dev->reqs[i].done) {
+                vSemaphoreDelete(dev->reqs[i].done);
+            }
+        }
+        if (dev->pending) {
+            vQueueDelete(dev->pending);
+        }
+        if (dev->free) {
+            vQueueDelete(dev->free);
+        }
+        free(dev);
+        ESP_LOGE(TAG, "add device 0x%02x failed: %s", config->addr, esp_err_to_name(ret));
+        return ret;
+    }
+    ESP_LOGI(TAG, "%s at 0x%02x: %u Hz, priority %d", dev->stats.name, config->addr, (unsigned)scl_hz, config->prio);
+    *ret_dev = dev;
+    return ESP_OK;
+}
+
+esp_err_t i2c_bus_transfer(i2c_bus_dev_handle_t dev, const i2c_bus_xfer_t *xfers, size_t count) {
+    ESP_RETURN_ON_FALSE(dev && xfers && count, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    i2c_bus_req_t *req;
+    if (xQueueReceive(dev->free, &req, pdMS_TO_TICKS(I2C_BUS_SUBMIT_TIMEOUT_MS)) != pdTRUE) {
+        xSemaphoreTake(bus.lock, portMAX_DELAY);
+        dev->stats.queue_full++;
+        xSemaphoreGive(bus.lock);
+        return ESP_ERR_TIMEOUT;
+    }
+    req->xfers = xfers;
+    req->count = count;
+    req->submit_us = esp_timer_get_time();
+    xQueueSend(dev->pending, &req, 0);
+    xSemaphoreGive(bus.work);
+
+    // 事务都有超时，总线任务总会完成请求，请求在完成前不能放回空闲队列
+    xSemaphoreTake(req->done, portMAX_DELAY);
+    esp_err_t err = req->err;
+    xQueueSend(dev->free, &req, 0);
+    return err;
+}
+
+esp_err_t i2c_bus_write_read(i2c_bus_dev_handle_t dev, const uint8_t *wbuf, size_t wlen, uint8_t *rbuf, size_t rlen) {
+    const i2c_bus_xfer_t xfer = { .wbuf = wbuf, .wlen = wlen, .rbuf = rbuf, .rlen = rlen };
+    return i2c_bus_transfer(dev, &xfer, 1);
+}
+
+esp_err_t i2c_bus_write(i2c_bus_dev_handle_t dev, const uint8_t *wbuf, size_t wlen) {
+    const i2c_bus_xfer_t xfer = { .wbuf = wbuf, .wlen = wlen };
+    return i2c_bus_transfer(dev, &xfer, 1);
+}
+
+/****************    面板IO ↓   *************************/
+
+typedef struct {
+    esp_lcd_panel_io_t base;
+    i2c_bus_dev_handle_t dev;
+} i2c_bus_panel_io_t;
+
+static esp_err_t i2c_bus_io_rx_param(esp_lcd_panel_io_t *io, int lcd_cmd, void *param, size_t param_size) {
+    i2c_bus_panel_io_t *bus_io = __containerof(io, i2c_bus_panel_io_t, base);
+    uint8_t cmd = (uint8_t)lcd_cmd;
+    return i2c_bus_write_read(bus_io->dev, &cmd, lcd_cmd >= 0 ? 1 : 0, param, param_size);
+}
+
+static esp_err_t i2c_bus_io_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size) {
+    i2c_bus_panel_io_t *bus_io = __containerof(io, i2c_bus_panel_io_t, base);
+    ESP_RETURN_ON_FALSE(param_size <= I2C_BUS_PANEL_IO_MAX_PARAM, ESP_ERR_INVALID_SIZE, TAG, "param too long");
+    uint8_t buf[1 + I2C_BUS_PANEL_IO_MAX_PARAM];
+    size_t len = 0;
+    if (lcd_cmd >= 0) {
+        buf[len++] = (uint8_t)lcd_cmd;
+    }
+    if (param_size) {
+        memcpy(&buf[len], param, param_size);
+        len += param_size;
+    }
+    return i2c_bus_write(bus_io->dev, buf, len);
+}
+
+/**
+ * @brief 触摸等按寄存器读写的驱动只用rx_param/tx_param，调用到这里说明面板IO用错了设备
+ * @note 调试构建直接断言失败，关闭断言时返回ESP_ERR_NOT_SUPPORTED
+ */
+static esp_err_t i2c_bus_io_tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size) {
+    i2c_bus_panel_io_t *bus_io = __containerof(io, i2c_bus_panel_io_t, base);
+    ESP_LOGE(TAG, "%s: tx_color is not supported by the bus panel io", bus_io->dev->stats.name);
+    assert(false && "i2c_bus panel io does not support tx_color");
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static esp_err_t i2c_bus_io_register_event_callbacks(esp_lcd_panel_io_t *io, const esp_lcd_panel_io_callbacks_t *cbs,
+                                                     void *user_ctx) {
+    return ESP_OK;      // 没有颜色传输，不会产生事件
+}
+
+static esp_err_t i2c_bus_io_del(esp_lcd_panel_io_t *io) {
+    free(__containerof(io, i2c_bus_panel_io_t, base));
+    return ESP_OK;
+}
+
+esp_err_t i2c_bus_new_panel_io(i2c_bus_dev_handle_t dev, esp_lcd_panel_io_handle_t *ret_io) {
+    ESP_RETURN_ON_FALSE(dev && ret_io, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    i2c_bus_panel_io_t *io = calloc(1, sizeof(i2c_bus_panel_io_t));
+    ESP_RETURN_ON_FALSE(io, ESP_ERR_NO_MEM, TAG, "no mem for panel io");
+    io->dev = dev;
+    io->base.rx_param = i2c_bus_io_rx_param;
+    io->base.tx_param = i2c_bus_io_tx_param;
+    io->base.tx_color = i2c_bus_io_tx_color;
+    io->base.del = i2c_bus_io_del;
+    io->base.register_event_callbacks = i2c_bus_io_register_event_callbacks;
+    *ret_io = &io->base;
+    return ESP_OK;
+}
+
+/****************    统计 ↓   *************************/
+
+void i2c_bus_get_stats(i2c_bus_stats_t *out) {
+    if (bus.lock == NULL) {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    xSemaphoreTake(bus.lock, portMAX_DELAY);
+    *out = bus.stats;
+    out->device_count = bus.dev_count;
+    for (int i = 0; i < bus.dev_count; i++) {
+        out->dev[i] = bus.devs[i]->stats;
+        if (out->dev[i].requests) {
+            out->dev[i].wait_avg_us = (uint32_t)(out->dev[i].wait_us / out->dev[i].requests);
+        }
+    }
+    out->elapsed_us = (uint64_t)(esp_timer_get_time() - bus.stats_start_us);
+    xSemaphoreGive(bus.lock);
+    if (out->elapsed_us > 0) {
+        out->busy_permille = (uint32_t)(out->busy_us * 1000 / out->elapsed_us);
+    }
+}
+
+void i2c_bus_reset_stats(void) {
+    if (bus.lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(bus.lock, portMAX_DELAY);
+    memset(&bus.stats, 0, sizeof(bus.stats));
+    for (int i = 0; i < bus.dev_count; i++) {
+        i2c_bus_dev_stats_t *s = &bus.devs[i]->stats;
+        const char *name = s->name;
+        i2c_bus_prio_t prio = s->prio;
+        uint32_t scl_hz = s->scl_hz;
+        memset(s, 0, sizeof(*s));
+        s->name = name;
+        s->prio = prio;
+        s->scl_hz = scl_hz;
+    }
+    bus.stats_start_us = esp_timer_get_time();
+    xSemaphoreGive(bus.lock);
+}
@@ -0,0 +1,136 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+// I2C总线管理：基于i2c_master驱动，所有设备的事务按设备排队，由总线任务按设备优先级执行，
+// 一次唤醒连续执行所有已排队的事务，每个设备以它支持的最高时钟运行
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+#include "driver/i2c_master.h"
+#include "esp_lcd_panel_io.h"
+
+/* ========== I2C总线配置 ========== */
+#define I2C_BUS_TASK_PRIORITY       (6)     // 高于触摸采样任务，事务提交后立即执行
+#define I2C_BUS_TASK_STACK          (3072)
+#define I2C_BUS_MAX_DEVICES         (4)     // 总线上的设备数
+#define I2C_BUS_QUEUE_DEPTH         (4)     // 每个设备可同时排队的请求数
+#define I2C_BUS_XFER_TIMEOUT_MS     (20)    // 单个事务的超时
+#define I2C_BUS_SUBMIT_TIMEOUT_MS   (100)   // 设备队列满时等待空位的时间
+#define I2C_BUS_PANEL_IO_MAX_PARAM  (32)    // 面板IO一次写入的参数字节数上限
+
+// 设备优先级，总线空闲时先执行优先级高的设备排队的请求
+typedef enum {
+    I2C_BUS_PRIO_LOW = 0,
+    I2C_BUS_PRIO_NORMAL,
+    I2C_BUS_PRIO_HIGH,
+} i2c_bus_prio_t;
+
+// 设备配置
+typedef struct {
+    const char *name;           ///< 统计中显示的名称
+    uint16_t addr;              ///< 7位地址
+    uint32_t max_scl_hz;        ///< 设备支持的最高时钟，实际时钟取它和总线上限中的较小值
+    i2c_bus_prio_t prio;
+} i2c_bus_dev_config_t;
+
+typedef struct i2c_bus_dev *i2c_bus_dev_handle_t;
+
+// 一个事务：先写后读，任一阶段长度可为0
+typedef struct {
+    const uint8_t *wbuf;
+    size_t wlen;
+    uint8_t *rbuf;
+    size_t rlen;
+} i2c_bus_xfer_t;
+
+// 单个设备的统计
+typedef struct {
+    const char *name;
+    i2c_bus_prio_t prio;
+    uint32_t scl_hz;            ///< 实际时钟
+    uint32_t requests;          ///< 提交次数(一次提交可含多个事务)
+    uint32_t transactions;      ///< 执行的事务数
+    uint32_t errors;            ///< 失败的请求数
+    uint32_t queue_full;        ///< 队列满、提交超时的次数
+    uint64_t wait_us;           ///< 从提交到开始执行的累计等待时间
+    uint32_t wait_avg_us;
+    uint32_t wait_max_us;
+    uint64_t busy_us;           ///< 执行该设备事务累计占用总线的时间
+} i2c_bus_dev_stats_t;
+
+// 总线统计
+typedef struct {
+    uint32_t requests;
+    uint32_t transactions;
+    uint32_t batches;           ///< 总线任务被唤醒的次数，每次连续执行所有已排队的请求
+    uint32_t bytes;             ///< 读写的数据字节数(不含地址字节)
+    uint64_t busy_us;           ///< 执行事务累计占用总线的时间
+    uint64_t elapsed_us;        ///< 统计时长
+    uint32_t busy_permille;     ///< 总线占用率(‰)
+    uint8_t device_count;
+    i2c_bus_dev_stats_t dev[I2C_BUS_MAX_DEVICES];   ///< 按优先级从高到低排列
+} i2c_bus_stats_t;
+
+/**
+ * @brief 创建I2C主机总线和总线任务
+ * @param port I2C外设
+ * @param sda SDA引脚
+ * @param scl SCL引脚
+ * @param max_scl_hz 总线时钟上限(由上拉电阻和走线决定)
+ * @return esp_err_t 返回ESP_OK表示成功，已初始化时返回ESP_ERR_INVALID_STATE
+ */
+esp_err_t i2c_bus_init(i2c_port_num_t port, gpio_num_t sda, gpio_num_t scl, uint32_t max_scl_hz);
+
+/**
+ * @brief 在总线上添加设备
+ * @note 可以在其他任务使用总线时调用
+ * @param config 设备配置
+ * @param ret_dev 返回设备句柄
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t i2c_bus_add_device(const i2c_bus_dev_config_t *config, i2c_bus_dev_handle_t *ret_dev);
+
+/**
+ * @brief 提交一组事务并等待执行完成
+ * @note 一组事务连续执行，中间不插入其他设备的事务；遇到失败的事务时停止执行剩余的事务。
+ *       不能在ISR中调用
+ * @param dev 设备句柄
+ * @param xfers 事务数组，执行完成前必须保持有效
+ * @param count 事务数
+ * @return esp_err_t 返回ESP_OK表示全部成功，队列满时返回ESP_ERR_TIMEOUT
+ */
+esp_err_t i2c_bus_transfer(i2c_bus_dev_handle_t dev, const i2c_bus_xfer_t *xfers, size_t count);
+
+/**
+ * @brief 先写后读一个事务
+ */
+esp_err_t i2c_bus_write_read(i2c_bus_dev_handle_t dev, const uint8_t *wbuf, size_t wlen, uint8_t *rbuf, size_t rlen);
+
+/**
+ * @brief 只写一个事务
+ */
+esp_err_t i2c_bus_write(i2c_bus_dev_handle_t dev, const uint8_t *wbuf, size_t wlen);
+
+/**
+ * @brief 创建经总线管理访问设备的面板IO，供esp_lcd_touch等按寄存器读写的驱动使用
+ * @note 8位命令(寄存器地址)：rx_param先写命令再读参数，tx_param把命令和参数作为一次写入。
+ *       不支持tx_color，调用时断言失败，只能交给不传输颜色数据的驱动(如esp_lcd_touch)
+ * @param dev 设备句柄
+ * @param ret_io 返回面板IO句柄，用esp_lcd_panel_io_del释放
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t i2c_bus_new_panel_io(i2c_bus_dev_handle_t dev, esp_lcd_panel_io_handle_t *ret_io);
+
+/**
+ * @brief 获取统计(自i2c_bus_init或上次i2c_bus_reset_stats起)
+ */
+void i2c_bus_get_stats(i2c_bus_stats_t *out);
+
+/**
+ * @brief 清零统计
+ */
+void i2c_bus_reset_stats(void);
+
+#endif // I2C_BUS_H
@@ -0,0 +1,161 @@
+#include "img_asset.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "Img Asset";
+
+#define IMG_ASSET_OP_DIFF       (0x40)
+#define IMG_ASSET_OP_LUMA       (0x80)
+#define IMG_ASSET_OP_RUN        (0xC0)
+#define IMG_ASSET_OP_RUN_LONG   (0xE0)
+#define IMG_ASSET_OP_RAW        (0xFF)
+#define IMG_ASSET_RUN_SHORT_MAX (32)
+
+static img_asset_stats_t asset_stats;
+static portMUX_TYPE asset_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static inline uint16_t rgb565_pack(int r, int g, int b) {
+    return (uint16_t)(((r & 0x1F) << 11) | ((g & 0x3F) << 5) | (b & 0x1F));
+}
+
+static inline int rgb565_hash(uint16_t v) {
+    return ((v >> 11) * 3 + ((v >> 5) & 0x3F) * 5 + (v & 0x1F) * 7) % IMG_ASSET_INDEX_SIZE;
+}
+
+esp_err_t img_asset_info(const img_asset_t *asset, int *width, int *height) {
+    if (asset == NULL || asset->data == NULL || asset->size < IMG_ASSET_HEADER_SIZE ||
+        memcmp(asset->data, "I565", 4) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (width) {
+        *width = asset->data[4] | asset->data[5] << 8;
+    }
+    if (height) {
+        *height = asset->data[6] | asset->data[7] << 8;
+    }
+    return ESP_OK;
+}
+
+esp_err_t img_asset_decoder_init(img_asset_decoder_t *dec, const img_asset_t *asset) {
+    int width, height;
+    esp_err_t ret = img_asset_info(asset, &width, &height);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Invalid asset header");
+        return ret;
+    }
+    memset(dec, 0, sizeof(*dec));
+    dec->src = asset->data + IMG_ASSET_HEADER_SIZE;
+    dec->end = asset->data + asset->size;
+    dec->remaining = (uint32_t)width * height;
+    return ESP_OK;
+}
+
+esp_err_t img_asset_decode(img_asset_decoder_t *dec, uint8_t *dst, size_t count) {
+    if (count > dec->remaining) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    int64_t start = esp_timer_get_time();
+    const uint8_t *src = dec->src;
+    const uint8_t *end = dec->end;
+    uint16_t prev = dec->prev;
+    size_t left = count;
+    esp_err_t ret = ESP_OK;
+
+    while (left > 0) {
+        // 先输出未完成的游程
+        if (dec->run > 0) {
+            size_t n = dec->run < left ? dec->run : left;
+            if (dst) {
+                for (size_t i = 0; i < n; i++) {
+                    dst[0] = prev >> 8;
+                    dst[1] = prev & 0xFF;
+                    dst += 2;
+                }
+            }
+            dec->run -= n;
+            left -= n;
+            continue;
+        }
+        if (src >= end) {
+            ret = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+
+        uint8_t op = *src++;
+        uint16_t px;
+        if (op < IMG_ASSET_OP_DIFF) {
+            px = dec->index[op];
+        } else if (op < IMG_ASSET_OP_LUMA) {
+            px = rgb565_pack((prev >> 11) + ((op >> 4) & 0x03) - 2,
+                             ((prev >> 5) & 0x3F) + ((op >> 2) & 0x03) - 2,
+                             (prev & 0x1F) + (op & 0x03) - 2);
+        } else if (op < IMG_ASSET_OP_RUN) {
+            if (src >= end) {
+                ret = ESP_ERR_INVALID_SIZE;
+                break;
+            }
+            int dg = (op & 0x3F) - 32;
+            int half = (dg + 32) / 2 - 16;      // floor(dg/2)，避免对负数移位
+            uint8_t rb = *src++;
+            px = rgb565_pack((prev >> 11) + half + (rb >> 4) - 8,
+                             ((prev >> 5) & 0x3F) + dg,
+                             (prev & 0x1F) + half + (rb & 0x0F) - 8);
+        } else if (op < IMG_ASSET_OP_RUN_LONG) {
+            dec->run = (op & 0x1F) + 1;
+            continue;
+        } else if (op < 0xF0) {
+            if (src >= end) {
+                ret = ESP_ERR_INVALID_SIZE;
+                break;
+            }
+            dec->run = (uint16_t)(((op & 0x0F) << 8 | *src++) + IMG_ASSET_RUN_SHORT_MAX + 1);
+            continue;
+        } else if (op == IMG_ASSET_OP_RAW) {
+            if (end - src < 2) {
+                ret = ESP_ERR_INVALID_SIZE;
+                break;
+            }
+            px = (uint16_t)(src[0] << 8 | src[1]);
+            src += 2;
+        } else {
+            ret = ESP_ERR_INVALID_SIZE;         // 保留的操作码
+            break;
+        }
+
+        dec->index[rgb565_hash(px)] = px;
+        prev = px;
+        if (dst) {
+            dst[0] = px >> 8;
+            dst[1] = px & 0xFF;
+            dst += 2;
+        }
+        left--;
+    }
+
+    dec->src = src;
+    dec->prev = prev;
+    dec->remaining -= (uint32_t)(count - left);
+    dec->pixels += (uint32_t)(count - left);
+    dec->decode_us += (uint32_t)(esp_timer_get_time() - start);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Corrupted asset data, %u bytes left", (unsigned)(end - src));
+    }
+    return ret;
+}
+
+void img_asset_decoder_end(img_asset_decoder_t *dec, const img_asset_t *asset) {
+    portENTER_CRITICAL(&asset_lock);
+    asset_stats.images++;
+    asset_stats.bytes_in += (uint64_t)(dec->src - asset->data);
+    asset_stats.pixels += dec->pixels;
+    asset_stats.decode_us += dec->decode_us;
+    portEXIT_CRITICAL(&asset_lock);
+}
+
+void img_asset_get_stats(img_asset_stats_t *stats) {
+    portENTER_CRITICAL(&asset_lock);
+    *stats = asset_stats;
+    portEXIT_CRITICAL(&asset_lock);
+}
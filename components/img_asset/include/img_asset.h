@@ -0,0 +1,88 @@
+#ifndef IMG_ASSET_H
+#define IMG_ASSET_H
+// 压缩RGB565图片资源：由tools/img_asset_pack.py生成，按像素顺序流式解码到任意大小的缓冲区
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/*
+ * 数据格式(多字节字段为小端)：
+ *   头部8字节：'I' '5' '6' '5'，宽度u16，高度u16
+ *   之后是操作码流，按行优先顺序产生像素。像素值v为屏幕字节顺序(大端)的RGB565，
+ *   分量r=v>>11(5位)、g=(v>>5)&0x3F(6位)、b=v&0x1F(5位)，分量差值按各自位宽回绕。
+ *   解码器维护上一个像素prev(初始为0)和64项最近像素表index(初始全0)，
+ *   除游程外每产生一个像素都写入index[(r*3+g*5+b*7)%64]。
+ *
+ *   00iiiiii                    INDEX  像素 = index[i]
+ *   01rrggbb                    DIFF   dr/dg/db各为-2..1(存储值+2)
+ *   10gggggg rrrrbbbb           LUMA   dg为-32..31(+32)；dr-h、db-h为-8..7(+8)，h=floor(dg/2)
+ *   110nnnnn                    RUN    重复prev共n+1次(1..32)
+ *   1110nnnn nnnnnnnn           RUN    重复prev共n+33次(33..4128)
+ *   11111111 hi lo              RAW    像素 = hi<<8|lo
+ */
+
+#define IMG_ASSET_HEADER_SIZE   (8)
+#define IMG_ASSET_INDEX_SIZE    (64)
+
+// 压缩图片资源
+typedef struct {
+    const uint8_t *data;    ///< 头部+操作码流，一般直接指向Flash
+    size_t size;            ///< 数据总字节数
+} img_asset_t;
+
+// 流式解码状态，可以分多次解码，游程可以跨越两次调用
+typedef struct {
+    const uint8_t *src;     ///< 下一个操作码
+    const uint8_t *end;     ///< 数据结尾
+    uint32_t remaining;     ///< 剩余未解码的像素数
+    uint16_t prev;          ///< 上一个像素
+    uint16_t run;           ///< 当前游程还剩的像素数
+    uint16_t index[IMG_ASSET_INDEX_SIZE];
+    uint32_t pixels;        ///< 已解码的像素数
+    uint32_t decode_us;     ///< 累计解码耗时
+} img_asset_decoder_t;
+
+// 解码统计(所有通过img_asset_decoder_end结束的解码)
+typedef struct {
+    uint32_t images;        ///< 解码的图片数
+    uint64_t bytes_in;      ///< 读取的压缩字节数
+    uint64_t pixels;        ///< 输出的像素数
+    uint64_t decode_us;     ///< 累计解码耗时
+} img_asset_stats_t;
+
+/**
+ * @brief 读取图片尺寸并检查头部
+ * @param asset  图片资源
+ * @param width  输出宽度，可为NULL
+ * @param height 输出高度，可为NULL
+ * @return esp_err_t 返回ESP_OK表示成功，头部无效返回ESP_ERR_INVALID_ARG
+ */
+esp_err_t img_asset_info(const img_asset_t *asset, int *width, int *height);
+
+/**
+ * @brief 初始化解码状态，从第一个像素开始
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t img_asset_decoder_init(img_asset_decoder_t *dec, const img_asset_t *asset);
+
+/**
+ * @brief 按顺序解码接下来的count个像素
+ * @param dec   解码状态
+ * @param dst   输出缓冲区(屏幕字节顺序，每像素2字节)，为NULL时跳过这些像素(用于裁剪)
+ * @param count 像素数
+ * @return esp_err_t 返回ESP_OK表示成功，数据损坏或超出图片范围返回ESP_ERR_INVALID_SIZE
+ */
+esp_err_t img_asset_decode(img_asset_decoder_t *dec, uint8_t *dst, size_t count);
+
+/**
+ * @brief 结束一次解码，把耗时和字节数计入全局统计
+ */
+void img_asset_decoder_end(img_asset_decoder_t *dec, const img_asset_t *asset);
+
+/**
+ * @brief 获取解码统计
+ */
+void img_asset_get_stats(img_asset_stats_t *stats);
+
+#endif // IMG_ASSET_H
@@ -0,0 +1,116 @@
+#ifndef INIT_GRAPH_H
+#define INIT_GRAPH_H
+// 启动阶段依赖图：按依赖关系在双核上并行执行初始化阶段
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/* ========== 依赖图配置 ========== */
+#define INIT_GRAPH_MAX_STAGES   (24)    // 事件组可用位数限制(configUSE_16_BIT_TICKS=0时为24)
+#define INIT_GRAPH_ANY_CORE     (-1)    // 阶段可在任意核心上运行
+
+/**
+ * @brief 依赖位掩码，INIT_DEP(i)表示依赖第i个阶段
+ */
+#define INIT_DEP(_idx)          (1UL << (_idx))
+
+/**
+ * @brief 阶段执行函数
+ * @param arg 阶段参数
+ * @return esp_err_t 返回ESP_OK表示成功，失败时依赖该阶段的后续阶段将被跳过
+ */
+typedef esp_err_t (*init_stage_fn_t)(void *arg);
+
+// 阶段执行状态
+typedef enum {
+    INIT_STAGE_PENDING,     ///< 尚未执行
+    INIT_STAGE_RUNNING,     ///< 正在执行
+    INIT_STAGE_DONE,        ///< 执行成功
+    INIT_STAGE_FAILED,      ///< 执行失败
+    INIT_STAGE_SKIPPED,     ///< 依赖失败而跳过
+} init_stage_state_t;
+
+// 启动阶段描述
+typedef struct {
+    const char *name;           ///< 阶段名称(用于计时报告)
+    init_stage_fn_t fn;         ///< 阶段函数
+    void *arg;                  ///< 阶段参数
+    uint32_t deps;              ///< 依赖的阶段位掩码(INIT_DEP组合)
+    int core;                   ///< 指定核心，INIT_GRAPH_ANY_CORE表示不限
+    uint32_t est_us;            ///< 预估耗时(微秒)，仅用于调度模拟
+
+    /* 以下字段由运行器填写 */
+    init_stage_state_t state;   ///< 执行状态
+    esp_err_t result;           ///< 阶段返回值
+    int ran_on_core;            ///< 实际执行的核心
+    int64_t start_us;           ///< 开始时间(相对于图启动)
+    int64_t end_us;             ///< 结束时间(相对于图启动)
+} init_stage_t;
+
+/**
+ * @brief 阶段结束回调(在工作任务中调用)
+ * @param stage 刚结束的阶段
+ * @param t0_us 图启动的绝对时间，stage->start_us/end_us加上它即为esp_timer时间
+ */
+typedef void (*init_stage_done_cb_t)(const init_stage_t *stage, int64_t t0_us);
+
+// 依赖图运行配置
+typedef struct {
+    int workers;                ///< 工作任务数量(通常等于核心数)
+    int worker_stack;           ///< 工作任务栈大小
+    int worker_priority;        ///< 工作任务优先级
+    init_stage_done_cb_t on_stage_done; ///< 阶段结束回调，可为NULL
+} init_graph_cfg_t;
+
+#define INIT_GRAPH_DEFAULT_CONFIG() \
+    {                               \
+        .workers = 2,               \
+        .worker_stack = 4096,       \
+        .worker_priority = 5,       \
+        .on_stage_done = NULL,      \
+    }
+
+/**
+ * @brief 检查依赖图是否合法(阶段数量、依赖越界、循环依赖)
+ * @param stages 阶段数组
+ * @param count  阶段数量
+ * @return esp_err_t ESP_OK表示合法
+ */
+esp_err_t init_graph_validate(const init_stage_t *stages, size_t count);
+
+/**
+ * @brief 按依赖关系并行执行所有阶段，阻塞直到全部完成
+ * @param stages 阶段数组(运行结果写回各阶段)
+ * @param count  阶段数量
+ * @param cfg    运行配置，NULL表示使用默认配置
+ * @return esp_err_t 全部成功返回ESP_OK，否则返回第一个失败阶段的错误码
+ */
+esp_err_t init_graph_run(init_stage_t *stages, size_t count, const init_graph_cfg_t *cfg);
+
+/**
+ * @brief 检查运行结果是否满足依赖顺序(每个阶段都在其依赖结束之后才开始)
+ * @param stages 已执行的阶段数组
+ * @param count  阶段数量
+ * @return esp_err_t ESP_OK表示顺序正确
+ */
+esp_err_t init_graph_check_order(const init_stage_t *stages, size_t count);
+
+/**
+ * @brief 不执行阶段函数，只按预估耗时模拟多核调度
+ * @note 纯计算，不依赖FreeRTOS，可在主机上验证依赖图
+ * @param stages 阶段数组(模拟的开始/结束时间写回各阶段)
+ * @param count  阶段数量
+ * @param cores  模拟的核心数
+ * @return int64_t 模拟的总耗时(微秒)，图非法时返回-1
+ */
+int64_t init_graph_simulate(init_stage_t *stages, size_t count, int cores);
+
+/**
+ * @brief 输出各阶段计时报告
+ * @param stages 已执行的阶段数组
+ * @param count  阶段数量
+ */
+void init_graph_log_report(const init_stage_t *stages, size_t count);
+
+#endif // INIT_GRAPH_H
@@ -0,0 +1,363 @@
+#include "init_graph.h"
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "Init Graph";
+
+// 依赖图运行上下文(各工作任务共享)
+typedef struct {
+    init_stage_t *stages;
+    size_t count;
+    uint32_t all_mask;              ///< 全部阶段位
+    uint32_t claimed;               ///< 已被工作任务领取的阶段
+    uint32_t finished;              ///< 已结束的阶段(成功/失败/跳过)
+    uint32_t failed;                ///< 失败或跳过的阶段
+    int64_t t0;                     ///< 图启动时间
+    init_stage_done_cb_t on_stage_done; ///< 阶段结束回调
+    SemaphoreHandle_t lock;         ///< 保护上述状态
+    EventGroupHandle_t done_bits;   ///< 每个阶段结束时置位
+    SemaphoreHandle_t exit_sem;     ///< 工作任务退出计数
+} init_graph_ctx_t;
+
+typedef struct {
+    init_graph_ctx_t *ctx;
+    int core;
+} init_worker_arg_t;
+
+static uint32_t stage_mask(size_t count) {
+    return (count >= 32) ? 0xFFFFFFFFUL : ((1UL << count) - 1);
+}
+
+esp_err_t init_graph_validate(const init_stage_t *stages, size_t count) {
+    if (stages == NULL || count == 0 || count > INIT_GRAPH_MAX_STAGES) {
+        ESP_LOGE(TAG, "Invalid stage count: %d", (int)count);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const uint32_t all = stage_mask(count);
+    for (size_t i = 0; i < count; i++) {
+        if (stages[i].fn == NULL) {
+            ESP_LOGE(TAG, "Stage %d has no function", (int)i);
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (stages[i].deps & ~all) {
+            ESP_LOGE(TAG, "Stage %s depends on unknown stage", stages[i].name);
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (stages[i].deps & INIT_DEP(i)) {
+            ESP_LOGE(TAG, "Stage %s depends on itself", stages[i].name);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    // Kahn拓扑排序，无法排完说明存在循环依赖
+    uint32_t resolved = 0;
+    bool progress = true;
+    while (resolved != all && progress) {
+        progress = false;
+        for (size_t i = 0; i < count; i++) {
+            if (!(resolved & INIT_DEP(i)) && (stages[i].deps & ~resolved) == 0) {
+                resolved |= INIT_DEP(i);
+                progress = true;
+            }
+        }
+    }
+    if (resolved != all) {
+        for (size_t i = 0; i < count; i++) {
+            if (!(resolved & INIT_DEP(i))) {
+                ESP_LOGE(TAG, "Dependency cycle involving stage %s", stages[i].name);
+            }
+        }
+        return ESP_ERR_INVALID_STATE;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief 查找当前核心可执行的就绪阶段
+ * @note 调用者需持有ctx->lock
+ * @return 阶段下标，无可执行阶段返回-1
+ */
+static int find_ready_stage(init_graph_ctx_t *ctx, int core) {
+    for (size_t i = 0; i < ctx->count; i++) {
+        const init_stage_t *stage = &ctx->stages[i];
+        if (ctx->claimed & INIT_DEP(i)) {
+            continue;
+        }
+        if (stage->core != INIT_GRAPH_ANY_CORE && stage->core != core) {
+            continue;
+        }
+        if ((stage->deps & ~ctx->finished) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static void init_graph_worker(void *arg) {
+    init_worker_arg_t *worker = (init_worker_arg_t *)arg;
+    init_graph_ctx_t *ctx = worker->ctx;
+
+    while (1) {
+        xSemaphoreTake(ctx->lock, portMAX_DELAY);
+        if (ctx->claimed == ctx->all_mask) {
+            xSemaphoreGive(ctx->lock);
+            break;
+        }
+
+        int idx = find_ready_stage(ctx, worker->core);
+        if (idx < 0) {
+            // 没有就绪阶段，等待任意一个尚未结束的阶段完成(超时后重新扫描)
+            uint32_t waiting = ctx->all_mask & ~ctx->finished;
+            xSemaphoreGive(ctx->lock);
+            xEventGroupWaitBits(ctx->done_bits, waiting, pdFALSE, pdFALSE, pdMS_TO_TICKS(50));
+            continue;
+        }
+
+        init_stage_t *stage = &ctx->stages[idx];
+        ctx->claimed |= INIT_DEP(idx);
+        stage->ran_on_core = worker->core;
+        stage->start_us = esp_timer_get_time() - ctx->t0;
+
+        if (stage->deps & ctx->failed) {
+            // 依赖失败，跳过本阶段
+            stage->state = INIT_STAGE_SKIPPED;
+            stage->result = ESP_ERR_INVALID_STATE;
+            stage->end_us = stage->start_us;
+            ctx->failed |= INIT_DEP(idx);
+            ctx->finished |= INIT_DEP(idx);
+            xSemaphoreGive(ctx->lock);
+            xEventGroupSetBits(ctx->done_bits, INIT_DEP(idx));
+            continue;
+        }
+        stage->state = INIT_STAGE_RUNNING;
+        xSemaphoreGive(ctx->lock);
+
+        esp_err_t ret = stage->fn(stage->arg);
+
+        xSemaphoreTake(ctx->lock, portMAX_DELAY);
+        stage->end_us = esp_timer_get_time() - ctx->t0;
+        stage->result = ret;
+        if (ret == ESP_OK) {
+            stage->state = INIT_STAGE_DONE;
+        } else {
+            stage->state = INIT_STAGE_FAILED;
+            ctx->failed |= INIT_DEP(idx);
+            ESP_LOGE(TAG, "Stage %s failed: %s", stage->name, esp_err_to_name(ret));
+        }
+        ctx->finished |= INIT_DEP(idx);
+        xSemaphoreGive(ctx->lock);
+        if (ctx->on_stage_done) {
+            ctx->on_stage_done(stage, ctx->t0);
+        }
+        xEventGroupSetBits(ctx->done_bits, INIT_DEP(idx));
+    }
+
+    xSemaphoreGive(ctx->exit_sem);
+    vTaskDelete(NULL);
+}
+
+esp_err_t init_graph_run(init_stage_t *stages, size_t count, const init_graph_cfg_t *cfg) {
+    const init_graph_cfg_t default_cfg = INIT_GRAPH_DEFAULT_CONFIG();
+    if (cfg == NULL) {
+        cfg = &default_cfg;
+    }
+
+    esp_err_t ret = init_graph_validate(stages, count);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    int workers = cfg->workers;
+    if (workers < 1) {
+        workers = 1;
+    }
+    if (workers > configNUM_CORES) {
+        workers = configNUM_CORES;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (stages[i].core >= workers) {
+            ESP_LOGE(TAG, "Stage %s pinned to core %d without worker", stages[i].name, stages[i].core);
+            return ESP_ERR_INVALID_ARG;
+        }
+        stages[i].state = INIT_STAGE_PENDING;
+        stages[i].result = ESP_OK;
+        stages[i].ran_on_core = -1;
+        stages[i].start_us = 0;
+        stages[i].end_us = 0;
+    }
+
+    init_graph_ctx_t ctx = {
+        .stages = stages,
+        .count = count,
+        .all_mask = stage_mask(count),
+        .on_stage_done = cfg->on_stage_done,
+    };
+    init_worker_arg_t worker_args[configNUM_CORES];
+
+    ctx.lock = xSemaphoreCreateMutex();
+    ctx.done_bits = xEventGroupCreate();
+    ctx.exit_sem = xSemaphoreCreateCounting(workers, 0);
+    if (ctx.lock == NULL || ctx.done_bits == NULL || ctx.exit_sem == NULL) {
+        ESP_LOGE(TAG, "Failed to create init graph primitives");
+        ret = ESP_ERR_NO_MEM;
+        goto cleanup;
+    }
+
+    ctx.t0 = esp_timer_get_time();
+    int started = 0;
+    for (int i = 0; i < workers; i++) {
+        worker_args[i].ctx = &ctx;
+        worker_args[i].core = i;
+        if (xTaskCreatePinnedToCore(init_graph_worker, "init_worker", cfg->worker_stack,
+                                    &worker_args[i], cfg->worker_priority, NULL, i) != pdPASS) {
+            ESP_LOGE(TAG, "Failed to create init worker on core %d", i);
+            break;
+        }
+        started++;
+    }
+    if (started == 0) {
+        ret = ESP_ERR_NO_MEM;
+        goto cleanup;
+    }
+    if (started < workers) {
+        // 部分工作任务创建失败，把钉在缺失核心上的阶段放宽到任意核心
+        xSemaphoreTake(ctx.lock, portMAX_DELAY);
+        for (size_t i = 0; i < count; i++) {
+            if (stages[i].core >= started) {
+                stages[i].core = INIT_GRAPH_ANY_CORE;
+            }
+        }
+        xSemaphoreGive(ctx.lock);
+    }
+
+    xEventGroupWaitBits(ctx.done_bits, ctx.all_mask, pdFALSE, pdTRUE, portMAX_DELAY);
+    for (int i = 0; i < started; i++) {
+        xSemaphoreTake(ctx.exit_sem, portMAX_DELAY);
+    }
+
+    ret = ESP_OK;
+    for (size_t i = 0; i < count; i++) {
+        if (stages[i].result != ESP_OK) {
+            ret = stages[i].result;
+            break;
+        }
+    }
+
+cleanup:
+    if (ctx.exit_sem) {
+        vSemaphoreDelete(ctx.exit_sem);
+    }
+    if (ctx.done_bits) {
+        vEventGroupDelete(ctx.done_bits);
+    }
+    if (ctx.lock) {
+        vSemaphoreDelete(ctx.lock);
+    }
+    return ret;
+}
+
+esp_err_t init_graph_check_order(const init_stage_t *stages, size_t count) {
+    esp_err_t ret = ESP_OK;
+    for (size_t i = 0; i < count; i++) {
+        for (size_t d = 0; d < count; d++) {
+            if (!(stages[i].deps & INIT_DEP(d))) {
+                continue;
+            }
+            if (stages[i].start_us < stages[d].end_us) {
+                ESP_LOGE(TAG, "Order violation: %s started before %s finished",
+                         stages[i].name, stages[d].name);
+                ret = ESP_ERR_INVALID_STATE;
+            }
+        }
+    }
+    return ret;
+}
+
+int64_t init_graph_simulate(init_stage_t *stages, size_t count, int cores) {
+    if (count == 0 || count > INIT_GRAPH_MAX_STAGES || cores < 1) {
+        return -1;
+    }
+
+    int64_t core_free[INIT_GRAPH_MAX_STAGES] = {0};
+    if (cores > INIT_GRAPH_MAX_STAGES) {
+        cores = INIT_GRAPH_MAX_STAGES;
+    }
+    const uint32_t all = stage_mask(count);
+    uint32_t scheduled = 0;
+    int64_t makespan = 0;
+
+    // 贪心列表调度：每轮选出最早能够开始的(阶段, 核心)组合
+    while (scheduled != all) {
+        int best_stage = -1;
+        int best_core = -1;
+        int64_t best_start = 0;
+
+        for (size_t i = 0; i < count; i++) {
+            if ((scheduled & INIT_DEP(i)) || (stages[i].deps & ~scheduled)) {
+                continue;
+            }
+            int64_t ready = 0;
+            for (size_t d = 0; d < count; d++) {
+                if ((stages[i].deps & INIT_DEP(d)) && stages[d].end_us > ready) {
+                    ready = stages[d].end_us;
+                }
+            }
+            for (int c = 0; c < cores; c++) {
+                if (stages[i].core != INIT_GRAPH_ANY_CORE && stages[i].core != c) {
+                    continue;
+                }
+                int64_t start = (core_free[c] > ready) ? core_free[c] : ready;
+                if (best_stage < 0 || start < best_start) {
+                    best_stage = (int)i;
+                    best_core = c;
+                    best_start = start;
+                }
+            }
+        }
+        if (best_stage < 0) {
+            return -1;  // 循环依赖或阶段指定的核心不存在
+        }
+
+        init_stage_t *stage = &stages[best_stage];
+        stage->ran_on_core = best_core;
+        stage->start_us = best_start;
+        stage->end_us = best_start + stage->est_us;
+        stage->state = INIT_STAGE_DONE;
+        core_free[best_core] = stage->end_us;
+        scheduled |= INIT_DEP(best_stage);
+        if (stage->end_us > makespan) {
+            makespan = stage->end_us;
+        }
+    }
+    return makespan;
+}
+
+void init_graph_log_report(const init_stage_t *stages, size_t count) {
+    static const char *state_names[] = {"pending", "running", "ok", "FAILED", "skipped"};
+    int64_t total_us = 0;
+    int64_t busy_us = 0;
+
+    ESP_LOGI(TAG, "%-16s %4s %10s %10s  %s", "stage", "core", "start(ms)", "cost(ms)", "state");
+    for (size_t i = 0; i < count; i++) {
+        const init_stage_t *stage = &stages[i];
+        int64_t cost_us = stage->end_us - stage->start_us;
+        ESP_LOGI(TAG, "%-16s %4d %6" PRId64 ".%03" PRId64 " %6" PRId64 ".%03" PRId64 "  %s",
+                 stage->name, stage->ran_on_core,
+                 stage->start_us / 1000, stage->start_us % 1000,
+                 cost_us / 1000, cost_us % 1000,
+                 state_names[stage->state]);
+        busy_us += cost_us;
+        if (stage->end_us > total_us) {
+            total_us = stage->end_us;
+        }
+    }
+    ESP_LOGI(TAG, "wall %" PRId64 ".%03" PRId64 " ms, serial sum %" PRId64 ".%03" PRId64 " ms",
+             total_us / 1000, total_us % 1000, busy_us / 1000, busy_us % 1000);
+}
@@ -294,6 +294,9 @@
 /*1: Draw random colored rectangles over the redrawn areas*/
 #define LV_USE_REFR_DEBUG 0
 
+/*1: Report the draw phases of every object to a callback set by `lv_refr_set_profiler_cb()`*/
+#define LV_USE_REFR_PROFILER 0
+
 /*Change the built in (v)snprintf functions*/
 #define LV_SPRINTF_CUSTOM 0
 #if LV_SPRINTF_CUSTOM
@@ -409,6 +412,11 @@
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
+/*Entries of the per-font direct-mapped cache of code point -> glyph id and glyph pair -> kerning value.
+ *Power of 2, 0: keep only the last looked up letter. Costs about 14 bytes RAM per entry and font
+ *(472 bytes per font with 32 entries), so enable it only for CJK/icon fonts or kern pair tables*/
+#define LV_FONT_FMT_TXT_CACHE_SIZE 0
+
 /*Enable subpixel rendering*/
 #define LV_USE_FONT_SUBPX 0
 #if LV_USE_FONT_SUBPX
@@ -356,6 +356,10 @@ static void obj_del_core(lv_obj_t * obj)
 
     obj->being_deleted = 1;
 
+#if LV_USE_REFR_PROFILER
+    _lv_refr_profiler_obj_del(obj);
+#endif
+
     /*Recursively delete the children*/
     lv_obj_t * child = lv_obj_get_child(obj, 0);
     while(child) {
@@ -26,6 +26,11 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_USE_REFR_PROFILER
+    #define REFR_PROFILE(obj, phase, end) do { if(refr_profiler_cb) refr_profiler_cb(obj, phase, end); } while(0)
+#else
+    #define REFR_PROFILE(obj, phase, end)
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -51,6 +56,7 @@ typedef struct {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void inv_area_add_merged(lv_disp_t * disp, const lv_area_t * area_p);
 static void lv_refr_join_area(void);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
@@ -75,6 +81,10 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
  **********************/
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
+#if LV_USE_REFR_PROFILER
+    static lv_refr_profiler_cb_t refr_profiler_cb;
+    static lv_refr_profiler_del_cb_t refr_profiler_del_cb;
+#endif
 
 #if LV_USE_PERF_MONITOR
     static perf_monitor_t   perf_monitor;
@@ -127,8 +137,28 @@ void lv_refr_now(lv_disp_t * disp)
     }
 }
 
+#if LV_USE_REFR_PROFILER
+void lv_refr_set_profiler_cb(lv_refr_profiler_cb_t cb)
+{
+    refr_profiler_cb = cb;
+}
+
+void lv_refr_set_profiler_del_cb(lv_refr_profiler_del_cb_t cb)
+{
+    refr_profiler_del_cb = cb;
+}
+
+void _lv_refr_profiler_obj_del(lv_obj_t * obj)
+{
+    if(refr_profiler_del_cb) refr_profiler_del_cb(obj);
+}
+#endif
+
 void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 {
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp && disp->driver->draw_obj_cb && disp->driver->draw_obj_cb(disp->driver, draw_ctx, obj)) return;
+
     const lv_area_t * clip_area_ori = draw_ctx->clip_area;
     lv_area_t clip_coords_for_obj;
 
@@ -144,9 +174,11 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     if(should_draw) {
         draw_ctx->clip_area = &clip_coords_for_obj;
 
+        REFR_PROFILE(obj, LV_REFR_PHASE_MAIN, false);
         lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, draw_ctx);
         lv_event_send(obj, LV_EVENT_DRAW_MAIN, draw_ctx);
         lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, draw_ctx);
+        REFR_PROFILE(obj, LV_REFR_PHASE_MAIN, true);
 #if LV_USE_REFR_DEBUG
         lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
         lv_draw_rect_dsc_t draw_dsc;
@@ -177,10 +209,12 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
         draw_ctx->clip_area = &clip_coords_for_children;
         uint32_t i;
         uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+        if(child_cnt) REFR_PROFILE(obj, LV_REFR_PHASE_CHILDREN, false);
         for(i = 0; i < child_cnt; i++) {
             lv_obj_t * child = obj->spec_attr->children[i];
             refr_obj(draw_ctx, child);
         }
+        if(child_cnt) REFR_PROFILE(obj, LV_REFR_PHASE_CHILDREN, true);
     }
 
     /*If the object was visible on the clip area call the post draw events too*/
@@ -188,9 +222,11 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
         draw_ctx->clip_area = &clip_coords_for_obj;
 
         /*If all the children are redrawn make 'post draw' draw*/
+        REFR_PROFILE(obj, LV_REFR_PHASE_POST, false);
         lv_event_send(obj, LV_EVENT_DRAW_POST_BEGIN, draw_ctx);
         lv_event_send(obj, LV_EVENT_DRAW_POST, draw_ctx);
         lv_event_send(obj, LV_EVENT_DRAW_POST_END, draw_ctx);
+        REFR_PROFILE(obj, LV_REFR_PHASE_POST, true);
     }
 
     draw_ctx->clip_area = clip_area_ori;
@@ -241,6 +277,12 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
 
     if(disp->driver->rounder_cb) disp->driver->rounder_cb(disp->driver, &com_area);
 
+    if(disp->driver->inv_merge) {
+        inv_area_add_merged(disp, &com_area);
+        if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+        return;
+    }
+
     /*Save only if this area is not in one of the saved areas*/
     uint16_t i;
     for(i = 0; i < disp->inv_p; i++) {
@@ -252,6 +294,7 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
         lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
     }
     else {   /*If no place for the area add the screen*/
+        disp->inv_overflow_cnt++;
         disp->inv_p = 0;
         lv_area_copy(&disp->inv_areas[disp->inv_p], &scr_area);
     }
@@ -470,6 +513,91 @@ uint32_t lv_refr_get_fps_avg(void)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Remove an area from the invalidated areas. The last area is moved to its place.
+ */
+static void inv_area_remove(lv_disp_t * disp, uint16_t i)
+{
+    disp->inv_p--;
+    disp->inv_areas[i] = disp->inv_areas[disp->inv_p];
+}
+
+/**
+ * Save an invalidated area and merge it with the saved areas:
+ * drop the saved areas which are covered by it and join it with the overlapping areas
+ * if the joined area is smaller than the sum of the two.
+ * If the buffer is full join the two areas (the new one included) which adds the fewest pixels.
+ * @param disp pointer to a display
+ * @param area_p the area to save (already clipped to the screen)
+ */
+static void inv_area_add_merged(lv_disp_t * disp, const lv_area_t * area_p)
+{
+    lv_area_t area = *area_p;
+    lv_area_t joined;
+    uint16_t i = 0;
+    while(i < disp->inv_p) {
+        lv_area_t * saved = &disp->inv_areas[i];
+        if(_lv_area_is_in(&area, saved, 0)) return;
+
+        if(_lv_area_is_in(saved, &area, 0)) {
+            inv_area_remove(disp, i);
+            continue;
+        }
+
+        if(_lv_area_is_on(&area, saved)) {
+            _lv_area_join(&joined, &area, saved);
+            if(lv_area_get_size(&joined) < lv_area_get_size(&area) + lv_area_get_size(saved)) {
+                /*The area grew: check all saved areas again*/
+                area = joined;
+                inv_area_remove(disp, i);
+                i = 0;
+                continue;
+            }
+        }
+        i++;
+    }
+
+    if(disp->inv_p < LV_INV_BUF_SIZE) {
+        lv_area_copy(&disp->inv_areas[disp->inv_p], &area);
+        disp->inv_p++;
+        return;
+    }
+
+    /*The buffer is full. The new area is the last candidate (index `LV_INV_BUF_SIZE`)*/
+    disp->inv_overflow_cnt++;
+    uint16_t best_a = 0;
+    uint16_t best_b = 1;
+    int32_t best_added = INT32_MAX;
+    uint16_t a;
+    uint16_t b;
+    for(a = 0; a < LV_INV_BUF_SIZE; a++) {
+        for(b = a + 1; b <= LV_INV_BUF_SIZE; b++) {
+            const lv_area_t * area_b = b < LV_INV_BUF_SIZE ? &disp->inv_areas[b] : &area;
+            _lv_area_join(&joined, &disp->inv_areas[a], area_b);
+            int32_t added = (int32_t)lv_area_get_size(&joined) - (int32_t)lv_area_get_size(&disp->inv_areas[a]) -
+                            (int32_t)lv_area_get_size(area_b);
+            if(added < best_added) {
+                best_added = added;
+                best_a = a;
+                best_b = b;
+            }
+        }
+    }
+
+    if(best_b == LV_INV_BUF_SIZE) {
+        _lv_area_join(&joined, &disp->inv_areas[best_a], &area);
+        inv_area_remove(disp, best_a);
+        inv_area_add_merged(disp, &joined);
+    }
+    else {
+        _lv_area_join(&joined, &disp->inv_areas[best_a], &disp->inv_areas[best_b]);
+        inv_area_remove(disp, best_b);
+        inv_area_remove(disp, best_a);
+        inv_area_add_merged(disp, &joined);
+        inv_area_add_merged(disp, &area);
+    }
+}
+
 /**
  * Join the areas which has got common parts
  */
@@ -488,6 +616,22 @@ static void lv_refr_join_area(void)
                 continue;
             }
 
+            /*Let the driver's join policy decide if set*/
+            lv_disp_drv_t * drv = disp_refr->driver;
+            if(drv->join_cb) {
+                _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+                if(drv->join_cb(drv, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from],
+                                &joined_area) == false) {
+                    continue;
+                }
+                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+                disp_refr->inv_area_joined[join_from] = 1;
+
+                /*'join_in' grew: check the already skipped areas again*/
+                join_from = UINT32_MAX;
+                continue;
+            }
+
             /*Check if the areas are on each other*/
             if(_lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
                 continue;
@@ -876,9 +1020,11 @@ static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
         }
 
         /*Call the post draw draw function of the parents of the to object*/
+        REFR_PROFILE(parent, LV_REFR_PHASE_POST, false);
         lv_event_send(parent, LV_EVENT_DRAW_POST_BEGIN, (void *)draw_ctx);
         lv_event_send(parent, LV_EVENT_DRAW_POST, (void *)draw_ctx);
         lv_event_send(parent, LV_EVENT_DRAW_POST_END, (void *)draw_ctx);
+        REFR_PROFILE(parent, LV_REFR_PHASE_POST, true);
 
         /*The new border will be the last parents,
          *so the 'younger' brothers of parent will be refreshed*/
@@ -989,7 +1135,9 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 
         if(layer_type == LV_LAYER_TYPE_SIMPLE) flags |= LV_DRAW_LAYER_FLAG_CAN_SUBDIVIDE;
 
+        REFR_PROFILE(obj, LV_REFR_PHASE_LAYER, false);
         lv_draw_layer_ctx_t * layer_ctx = lv_draw_layer_create(draw_ctx, &layer_area_full, flags);
+        REFR_PROFILE(obj, LV_REFR_PHASE_LAYER, true);
         if(layer_ctx == NULL) {
             LV_LOG_WARN("Couldn't create a new layer context");
             return;
@@ -1025,7 +1173,9 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 
         while(layer_ctx->area_act.y1 <= layer_area_full.y2) {
             if(flags & LV_DRAW_LAYER_FLAG_CAN_SUBDIVIDE) {
+                REFR_PROFILE(obj, LV_REFR_PHASE_LAYER, false);
                 layer_alpha_test(obj, draw_ctx, layer_ctx, flags);
+                REFR_PROFILE(obj, LV_REFR_PHASE_LAYER, true);
             }
 
             lv_obj_redraw(draw_ctx, obj);
@@ -1034,7 +1184,9 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
             draw_dsc.pivot.y = obj->coords.y1 + pivot.y - draw_ctx->buf_area->y1;
 
             /*With LV_DRAW_LAYER_FLAG_CAN_SUBDIVIDE it should also go the next chunk*/
+            REFR_PROFILE(obj, LV_REFR_PHASE_LAYER, false);
             lv_draw_layer_blend(draw_ctx, layer_ctx, &draw_dsc);
+            REFR_PROFILE(obj, LV_REFR_PHASE_LAYER, true);
 
             if((flags & LV_DRAW_LAYER_FLAG_CAN_SUBDIVIDE) == 0) break;
 
@@ -1042,7 +1194,9 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
             layer_ctx->area_act.y2 = layer_ctx->area_act.y1 + layer_ctx->max_row_with_no_alpha - 1;
         }
 
+        REFR_PROFILE(obj, LV_REFR_PHASE_LAYER, false);
         lv_draw_layer_destroy(draw_ctx, layer_ctx);
+        REFR_PROFILE(obj, LV_REFR_PHASE_LAYER, true);
     }
 }
 
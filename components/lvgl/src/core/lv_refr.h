@@ -26,6 +26,29 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_REFR_PROFILER
+/** Draw phases of an object reported to the profiler callback*/
+typedef enum {
+    LV_REFR_PHASE_MAIN,         /**< `LV_EVENT_DRAW_MAIN_BEGIN/DRAW_MAIN/DRAW_MAIN_END`*/
+    LV_REFR_PHASE_CHILDREN,     /**< Drawing the children. Their own phases are reported inside it*/
+    LV_REFR_PHASE_POST,         /**< `LV_EVENT_DRAW_POST_BEGIN/DRAW_POST/DRAW_POST_END`*/
+    LV_REFR_PHASE_LAYER,        /**< Creating, blending or destroying the layer of a layered object*/
+    _LV_REFR_PHASE_NUM
+} lv_refr_phase_t;
+
+/**
+ * Called at the beginning (`end == false`) and at the end (`end == true`) of a draw phase.
+ * Phases of the same object don't overlap except `LV_REFR_PHASE_CHILDREN`.
+ */
+typedef void (*lv_refr_profiler_cb_t)(lv_obj_t * obj, lv_refr_phase_t phase, bool end);
+
+/**
+ * Called when an object is deleted, so that the profiler can drop what it recorded for the object
+ * before the address is reused.
+ */
+typedef void (*lv_refr_profiler_del_cb_t)(lv_obj_t * obj);
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -47,6 +70,26 @@ extern "C" {
  */
 void _lv_refr_init(void);
 
+#if LV_USE_REFR_PROFILER
+/**
+ * Set a callback to profile the drawing of the objects
+ * @param cb the callback, NULL to stop profiling
+ */
+void lv_refr_set_profiler_cb(lv_refr_profiler_cb_t cb);
+
+/**
+ * Set a callback to be notified when an object is deleted
+ * @param cb the callback, NULL to stop the notifications
+ */
+void lv_refr_set_profiler_del_cb(lv_refr_profiler_del_cb_t cb);
+
+/**
+ * Notify the profiler about a deleted object. Called by the object deletion.
+ * @param obj the object being deleted
+ */
+void _lv_refr_profiler_obj_del(lv_obj_t * obj);
+#endif
+
 /**
  * Redraw the invalidated areas now.
  * Normally the redrawing is periodically executed in `lv_timer_handler` but a long blocking process
@@ -18,6 +18,9 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_FONT_FMT_TXT_CACHE_SIZE & (LV_FONT_FMT_TXT_CACHE_SIZE - 1)
+    #error "LV_FONT_FMT_TXT_CACHE_SIZE must be a power of 2"
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -32,7 +35,9 @@ typedef enum {
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t search_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static int8_t search_kern_pair(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t gid_left, uint32_t gid_right);
 static int32_t unicode_list_compare(const void * ref, const void * element);
 static int32_t kern_pair_8_compare(const void * ref, const void * element);
 static int32_t kern_pair_16_compare(const void * ref, const void * element);
@@ -202,6 +207,29 @@ void _lv_font_clean_up_fmt_txt(void)
 #endif
 }
 
+bool lv_font_fmt_txt_get_cache_stats(const lv_font_t * font, lv_font_fmt_txt_cache_stats_t * stats)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    if(fdsc == NULL || fdsc->cache == NULL) return false;
+
+    *stats = fdsc->cache->stats;
+    return true;
+#else
+    LV_UNUSED(font);
+    LV_UNUSED(stats);
+    return false;
+#endif
+}
+
+void lv_font_fmt_txt_reset_cache(const lv_font_t * font)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    if(fdsc == NULL || fdsc->cache == NULL) return;
+
+    lv_memset_00(fdsc->cache, sizeof(lv_font_fmt_txt_glyph_cache_t));
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -211,16 +239,38 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
     if(letter == '\0') return 0;
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+    if(cache == NULL) return search_glyph_dsc_id(fdsc, letter);
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE
+    /*Letters not in the font are cached too (glyph_id = 0), e.g. while falling back to an other font*/
+    lv_font_fmt_txt_glyph_cache_entry_t * entry = &cache->glyphs[letter & (LV_FONT_FMT_TXT_CACHE_SIZE - 1)];
+    if(entry->letter == letter) {
+        cache->stats.glyph_hits++;
+        return entry->glyph_id;
+    }
+
+    cache->stats.glyph_misses++;
+    entry->letter = letter;
+    entry->glyph_id = search_glyph_dsc_id(fdsc, letter);
+    return entry->glyph_id;
+#else
+    if(letter == cache->last_letter) return cache->last_glyph_id;
 
-    /*Check the cache first*/
-    if(fdsc->cache && letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
+    cache->last_letter = letter;
+    cache->last_glyph_id = search_glyph_dsc_id(fdsc, letter);
+    return cache->last_glyph_id;
+#endif
+}
 
+static uint32_t search_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
         /*Relative code point*/
         uint32_t rcp = letter - fdsc->cmaps[i].range_start;
-        if(rcp > fdsc->cmaps[i].range_length) continue;
+        if(rcp >= fdsc->cmaps[i].range_length) continue;
         uint32_t glyph_id = 0;
         if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
             glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
@@ -251,20 +301,10 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
             }
         }
 
-        /*Update the cache*/
-        if(fdsc->cache) {
-            fdsc->cache->last_letter = letter;
-            fdsc->cache->last_glyph_id = glyph_id;
-        }
         return glyph_id;
     }
 
-    if(fdsc->cache) {
-        fdsc->cache->last_letter = letter;
-        fdsc->cache->last_glyph_id = 0;
-    }
     return 0;
-
 }
 
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
@@ -276,36 +316,24 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     if(fdsc->kern_classes == 0) {
         /*Kern pairs*/
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
-        if(kdsc->glyph_ids_size == 0) {
-            /*Use binary search to find the kern value.
-             *The pairs are ordered left_id first, then right_id secondly.*/
-            const uint16_t * g_ids = kdsc->glyph_ids;
-            uint16_t g_id_both = (gid_right << 8) + gid_left; /*Create one number from the ids*/
-            uint16_t * kid_p = _lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 2, kern_pair_8_compare);
-
-            /*If the `g_id_both` were found get its index from the pointer*/
-            if(kid_p) {
-                lv_uintptr_t ofs = kid_p - g_ids;
-                value = kdsc->values[ofs];
-            }
-        }
-        else if(kdsc->glyph_ids_size == 1) {
-            /*Use binary search to find the kern value.
-             *The pairs are ordered left_id first, then right_id secondly.*/
-            const uint32_t * g_ids = kdsc->glyph_ids;
-            uint32_t g_id_both = (gid_right << 16) + gid_left; /*Create one number from the ids*/
-            uint32_t * kid_p = _lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 4, kern_pair_16_compare);
-
-            /*If the `g_id_both` were found get its index from the pointer*/
-            if(kid_p) {
-                lv_uintptr_t ofs = kid_p - g_ids;
-                value = kdsc->values[ofs];
+#if LV_FONT_FMT_TXT_CACHE_SIZE
+        lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+        if(cache) {
+            lv_font_fmt_txt_kern_cache_entry_t * entry =
+                &cache->kerns[(gid_left * 31 + gid_right) & (LV_FONT_FMT_TXT_CACHE_SIZE - 1)];
+            if(entry->gid_left == gid_left && entry->gid_right == gid_right) {
+                cache->stats.kern_hits++;
+                return entry->value;
             }
 
+            cache->stats.kern_misses++;
+            entry->gid_left = gid_left;
+            entry->gid_right = gid_right;
+            entry->value = search_kern_pair(kdsc, gid_left, gid_right);
+            return entry->value;
         }
-        else {
-            /*Invalid value*/
-        }
+#endif
+        value = search_kern_pair(kdsc, gid_left, gid_right);
     }
     else {
         /*Kern classes*/
@@ -323,6 +351,43 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     return value;
 }
 
+static int8_t search_kern_pair(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t gid_left, uint32_t gid_right)
+{
+    int8_t value = 0;
+
+    if(kdsc->glyph_ids_size == 0) {
+        /*Use binary search to find the kern value.
+         *The pairs are ordered left_id first, then right_id secondly.*/
+        const uint16_t * g_ids = kdsc->glyph_ids;
+        uint16_t g_id_both = (gid_right << 8) + gid_left; /*Create one number from the ids*/
+        uint16_t * kid_p = _lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 2, kern_pair_8_compare);
+
+        /*If the `g_id_both` were found get its index from the pointer*/
+        if(kid_p) {
+            lv_uintptr_t ofs = kid_p - g_ids;
+            value = kdsc->values[ofs];
+        }
+    }
+    else if(kdsc->glyph_ids_size == 1) {
+        /*Use binary search to find the kern value.
+         *The pairs are ordered left_id first, then right_id secondly.*/
+        const uint32_t * g_ids = kdsc->glyph_ids;
+        uint32_t g_id_both = (gid_right << 16) + gid_left; /*Create one number from the ids*/
+        uint32_t * kid_p = _lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 4, kern_pair_16_compare);
+
+        /*If the `g_id_both` were found get its index from the pointer*/
+        if(kid_p) {
+            lv_uintptr_t ofs = kid_p - g_ids;
+            value = kdsc->values[ofs];
+        }
+
+    }
+    else {
+        /*Invalid value*/
+    }
+    return value;
+}
+
 static int32_t kern_pair_8_compare(const void * ref, const void * element)
 {
     const uint8_t * ref8_p = ref;
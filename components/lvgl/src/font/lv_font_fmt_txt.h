@@ -151,9 +151,36 @@ typedef enum {
     LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER = 1,
 } lv_font_fmt_txt_bitmap_format_t;
 
+/** Hit/miss counters of a font's glyph cache*/
+typedef struct {
+    uint32_t glyph_hits;
+    uint32_t glyph_misses;
+    uint32_t kern_hits;     /**< Only kern pairs are cached, kern classes are looked up directly*/
+    uint32_t kern_misses;
+} lv_font_fmt_txt_cache_stats_t;
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE
+typedef struct {
+    uint32_t letter;        /**< 0: empty*/
+    uint32_t glyph_id;      /**< 0: the letter is not in the font*/
+} lv_font_fmt_txt_glyph_cache_entry_t;
+
+typedef struct {
+    uint16_t gid_left;      /**< 0: empty*/
+    uint16_t gid_right;
+    int8_t value;
+} lv_font_fmt_txt_kern_cache_entry_t;
+#endif
+
 typedef struct {
     uint32_t last_letter;
     uint32_t last_glyph_id;
+#if LV_FONT_FMT_TXT_CACHE_SIZE
+    /*Direct-mapped by the low bits of the code point / glyph ids*/
+    lv_font_fmt_txt_glyph_cache_entry_t glyphs[LV_FONT_FMT_TXT_CACHE_SIZE];
+    lv_font_fmt_txt_kern_cache_entry_t kerns[LV_FONT_FMT_TXT_CACHE_SIZE];
+    lv_font_fmt_txt_cache_stats_t stats;
+#endif
 } lv_font_fmt_txt_glyph_cache_t;
 
 /*Describe store additional data for fonts*/
@@ -225,6 +252,20 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
  */
 void _lv_font_clean_up_fmt_txt(void);
 
+/**
+ * Get the hit/miss counters of a font's glyph cache.
+ * @param font pointer to a font in the native format
+ * @param stats store the counters here
+ * @return false: the font has no cache or `LV_FONT_FMT_TXT_CACHE_SIZE` is 0
+ */
+bool lv_font_fmt_txt_get_cache_stats(const lv_font_t * font, lv_font_fmt_txt_cache_stats_t * stats);
+
+/**
+ * Empty a font's glyph cache and reset its counters.
+ * @param font pointer to a font in the native format
+ */
+void lv_font_fmt_txt_reset_cache(const lv_font_t * font);
+
 /**********************
  *      MACROS
  **********************/
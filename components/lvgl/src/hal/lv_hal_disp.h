@@ -99,6 +99,8 @@ typedef struct _lv_disp_drv_t {
     uint32_t rotated : 2;            /**< 1: turn the display by 90 degree. @warning Does not update coordinates for you!*/
     uint32_t screen_transp : 1;      /**Handle if the screen doesn't have a solid (opa == LV_OPA_COVER) background.
                                        * Use only if required because it's slower.*/
+    uint32_t inv_merge : 1;          /**< 1: Merge invalidated areas already when they are added and join the two closest
+                                       * areas when the buffer is full instead of invalidating the whole screen*/
 
     uint32_t dpi : 10;              /** DPI (dot per inch) of the display. Default value is `LV_DPI_DEF`.*/
 
@@ -110,6 +112,21 @@ typedef struct _lv_disp_drv_t {
      * E.g. round `y` to, 8, 16 ..) on a monochrome display*/
     void (*rounder_cb)(struct _lv_disp_drv_t * disp_drv, lv_area_t * area);
 
+    /** OPTIONAL: Decide whether two invalidated areas are joined into `joined` (their bounding box) before
+     * refreshing. Called for every pair, also for areas which are not on each other.
+     * If not set, overlapping areas are joined when `joined` is smaller than the sum of their sizes*/
+    bool (*join_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * a1, const lv_area_t * a2,
+                    const lv_area_t * joined);
+
+    /** OPTIONAL: Draw an object together with its children in another way, e.g. from a cached bitmap.
+     * Called by `lv_obj_redraw()` for every object. Return `true` if the object was drawn, `false` to draw it
+     * normally*/
+    bool (*draw_obj_cb)(struct _lv_disp_drv_t * disp_drv, lv_draw_ctx_t * draw_ctx, struct _lv_obj_t * obj);
+
+    /** OPTIONAL: Called when an area of an object is invalidated, also if the area is not visible
+     * or invalidation is disabled. Can be used to tell when the content of an object changes*/
+    void (*obj_inv_cb)(struct _lv_disp_drv_t * disp_drv, const struct _lv_obj_t * obj);
+
     /** OPTIONAL: Set a pixel in a buffer according to the special requirements of the display
      * Can be used for color format not supported in LittelvGL. E.g. 2 bit -> 4 gray scales
      * @note Much slower then drawing with supported color formats.*/
@@ -186,6 +203,7 @@ typedef struct _lv_disp_t {
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint16_t inv_p;
     int32_t inv_en_cnt;
+    uint32_t inv_overflow_cnt;      /**< Number of times an area was added to a full `inv_areas` buffer*/
 
     /** Double buffer sync areas */
     lv_ll_t sync_areas;
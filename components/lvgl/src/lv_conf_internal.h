@@ -796,6 +796,15 @@
     #endif
 #endif
 
+/*1: Report the draw phases of every object to a callback set by `lv_refr_set_profiler_cb()`*/
+#ifndef LV_USE_REFR_PROFILER
+    #ifdef CONFIG_LV_USE_REFR_PROFILER
+        #define LV_USE_REFR_PROFILER CONFIG_LV_USE_REFR_PROFILER
+    #else
+        #define LV_USE_REFR_PROFILER 0
+    #endif
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #ifndef LV_SPRINTF_CUSTOM
     #ifdef CONFIG_LV_SPRINTF_CUSTOM
@@ -1229,6 +1238,17 @@
     #endif
 #endif
 
+/*Entries of the per-font direct-mapped cache of code point -> glyph id and glyph pair -> kerning value.
+ *Power of 2, 0: keep only the last looked up letter. Costs about 14 bytes RAM per entry and font
+ *(472 bytes per font with 32 entries), so enable it only for CJK/icon fonts or kern pair tables*/
+#ifndef LV_FONT_FMT_TXT_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_CACHE_SIZE 0
+    #endif
+#endif
+
 /*Enable subpixel rendering*/
 #ifndef LV_USE_FONT_SUBPX
     #ifdef CONFIG_LV_USE_FONT_SUBPX
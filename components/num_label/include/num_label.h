@@ -0,0 +1,66 @@
+#ifndef NUM_LABEL_H
+#define NUM_LABEL_H
+// 定宽数字标签：把已有的lv_label改为显示整数，文字放在预分配的缓冲区里，不经过vsnprintf和LVGL堆；
+// 每位数字占固定宽度的格子，标签尺寸不随数值变化，更新时只重绘变化的格子
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+/* ========== 数字标签配置 ========== */
+#define NUM_LABEL_MAX_LABELS    (4)     // 数字标签数上限
+#define NUM_LABEL_MAX_DIGITS    (11)    // 格子数上限(含负号)，足够显示int32_t
+
+// 更新统计(所有数字标签合计)
+typedef struct {
+    uint32_t updates;           ///< num_label_set_value调用次数
+    uint32_t unchanged;         ///< 数值未变、没有重绘的次数
+    uint32_t cells;             ///< 变化的格子数
+    uint64_t inv_px;            ///< 标记重绘的像素数
+    uint32_t repairs;           ///< 文字被lv_label_set_text等改掉后恢复的次数
+} num_label_stats_t;
+
+/**
+ * @brief 把标签改为定宽数字显示
+ * @note 需在LVGL锁内调用。按取值范围确定格子数，标签内容区宽度固定为 格子数×最宽数字 + 后缀宽度；
+ *       初始值取标签当前文字开头的整数。之后不要再对该标签调用lv_label_set_text，
+ *       否则下次num_label_set_value时会恢复，但多一次LVGL堆分配
+ * @param label 标签
+ * @param min 最小值，小于0时多留一格放负号
+ * @param max 最大值
+ * @param suffix 单位等后缀，可为NULL；必须一直有效(一般用字符串常量)
+ * @return esp_err_t 标签数已满返回ESP_ERR_NO_MEM，范围超过NUM_LABEL_MAX_DIGITS返回ESP_ERR_INVALID_ARG
+ */
+esp_err_t num_label_attach(lv_obj_t *label, int32_t min, int32_t max, const char *suffix);
+
+/**
+ * @brief 恢复为普通标签(按当前数值设置文字，宽度随内容)
+ * @note 需在LVGL锁内调用
+ */
+void num_label_detach(lv_obj_t *label);
+
+/**
+ * @brief 设置数值，超出范围时取边界值；只标记变化的格子需要重绘
+ * @note 需在LVGL锁内调用
+ * @return esp_err_t 标签不是数字标签时返回ESP_ERR_INVALID_ARG
+ */
+esp_err_t num_label_set_value(lv_obj_t *label, int32_t value);
+
+/**
+ * @brief 获取数值
+ * @return 标签不是数字标签时返回false
+ */
+bool num_label_get_value(const lv_obj_t *label, int32_t *out);
+
+/**
+ * @brief 获取统计(自上次num_label_reset_stats起)
+ */
+void num_label_get_stats(num_label_stats_t *out);
+
+/**
+ * @brief 清零统计
+ */
+void num_label_reset_stats(void);
+
+#endif // NUM_LABEL_H
@@ -0,0 +1,282 @@
+#include "num_label.h"
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+
+static const char *TAG = "Num Label";
+
+// 标签文字固定指向这个空字符串，数字和后缀在DRAW_MAIN事件中自行绘制
+static const char num_label_empty[] = "";
+
+// 一个数字标签
+typedef struct {
+    lv_obj_t *label;            ///< NULL表示空闲
+    int32_t min;
+    int32_t max;
+    int32_t value;
+    const char *suffix;
+    uint8_t n_cells;            ///< 格子数
+    char cells[NUM_LABEL_MAX_DIGITS];   ///< 每格的字符，右对齐，空格为不显示
+    lv_coord_t cell_w;          ///< 格子宽度：最宽的数字(或负号)加字距
+    lv_coord_t line_h;
+    const lv_font_t *font;      ///< 计算格子时的字体和字距，样式变化时据此判断是否重新计算
+    lv_coord_t letter_space;
+    lv_coord_t orig_w;          ///< attach前的宽高设置，detach时恢复
+    lv_coord_t orig_h;
+} num_label_t;
+
+static num_label_t labels[NUM_LABEL_MAX_LABELS];
+static num_label_stats_t stats;
+
+static num_label_t *num_label_find(const lv_obj_t *label) {
+    if (label == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < NUM_LABEL_MAX_LABELS; i++) {
+        if (labels[i].label == label) {
+            return &labels[i];
+        }
+    }
+    return NULL;
+}
+
+static uint8_t num_label_digits(uint32_t u) {
+    uint8_t n = 1;
+    while (u >= 10) {
+        u /= 10;
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief 把数值右对齐格式化到格子里，替代vsnprintf
+ */
+static void num_label_format(const num_label_t *nl, int32_t value, char *cells) {
+    uint32_t u = value < 0 ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+    int i = nl->n_cells - 1;
+    do {
+        cells[i--] = (char)('0' + u % 10);
+        u /= 10;
+    } while (u != 0 && i >= 0);
+    if (value < 0 && i >= 0) {
+        cells[i--] = '-';
+    }
+    while (i >= 0) {
+        cells[i--] = ' ';
+    }
+}
+
+/**
+ * @brief 按当前字体计算格子宽度并固定标签内容区大小
+ */
+static void num_label_layout(num_label_t *nl) {
+    const lv_font_t *font = lv_obj_get_style_text_font(nl->label, LV_PART_MAIN);
+    lv_coord_t letter_space = lv_obj_get_style_text_letter_space(nl->label, LV_PART_MAIN);
+    lv_coord_t w = lv_font_get_glyph_width(font, '-', 0);
+    for (char c = '0'; c <= '9'; c++) {
+        lv_coord_t cw = lv_font_get_glyph_width(font, c, 0);
+        if (cw > w) {
+            w = cw;
+        }
+    }
+    nl->font = font;
+    nl->letter_space = letter_space;
+    nl->cell_w = w + letter_space;
+    nl->line_h = lv_font_get_line_height(font);
+
+    lv_coord_t suffix_w = 0;
+    if (nl->suffix != NULL && nl->suffix[0] != '\0') {
+        suffix_w = lv_txt_get_width(nl->suffix, strlen(nl->suffix), font, letter_space, LV_TEXT_FLAG_NONE);
+    }
+    lv_obj_set_content_width(nl->label, nl->cell_w * nl->n_cells + suffix_w);
+    lv_obj_set_content_height(nl->label, nl->line_h);
+}
+
+static void num_label_draw_cb(lv_event_t *e) {
+    lv_obj_t *label = lv_event_get_target(e);
+    num_label_t *nl = num_label_find(label);
+    if (nl == NULL || lv_label_get_text(label) != num_label_empty) {
+        return;
+    }
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(label, LV_PART_MAIN, &dsc);
+
+    lv_area_t content;
+    lv_obj_get_content_coords(label, &content);
+
+    // 只画与本次刷新区域相交的格子
+    lv_point_t pos = { .x = content.x1, .y = content.y1 };
+    for (int i = 0; i < nl->n_cells; i++, pos.x += nl->cell_w) {
+        char c = nl->cells[i];
+        if (c == ' ' || pos.x > draw_ctx->clip_area->x2 || pos.x + nl->cell_w <= draw_ctx->clip_area->x1) {
+            continue;
+        }
+        // 字形在格子里居中，数字宽度不同时也不会左右跳动
+        lv_point_t p = { .x = pos.x + (nl->cell_w - dsc.letter_space - lv_font_get_glyph_width(dsc.font, c, 0)) / 2, .y = pos.y };
+        lv_draw_letter(draw_ctx, &dsc, &p, (uint32_t)c);
+    }
+
+    if (nl->suffix != NULL && nl->suffix[0] != '\0') {
+        lv_area_t suffix_area = { .x1 = pos.x, .y1 = content.y1, .x2 = content.x2, .y2 = content.y2 };
+        lv_draw_label(draw_ctx, &dsc, &suffix_area, nl->suffix, NULL);
+    }
+}
+
+static void num_label_event_cb(lv_event_t *e) {
+    num_label_t *nl = num_label_find(lv_event_get_target(e));
+    if (nl == NULL) {
+        return;
+    }
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_STYLE_CHANGED:
+            // 字体或字距变化后重新计算格子；设置宽高本身也会触发该事件，不变时不再设置
+            if (nl->font != lv_obj_get_style_text_font(nl->label, LV_PART_MAIN) ||
+                nl->letter_space != lv_obj_get_style_text_letter_space(nl->label, LV_PART_MAIN)) {
+                num_label_layout(nl);
+            }
+            break;
+        case LV_EVENT_DELETE:
+            memset(nl, 0, sizeof(*nl));
+            break;
+        default:
+            break;
+    }
+}
+
+esp_err_t num_label_attach(lv_obj_t *label, int32_t min, int32_t max, const char *suffix) {
+    if (label == NULL || min > max) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    num_label_t *nl = num_label_find(label);
+    if (nl == NULL) {
+        for (int i = 0; nl == NULL && i < NUM_LABEL_MAX_LABELS; i++) {
+            if (labels[i].label == NULL) {
+                nl = &labels[i];
+            }
+        }
+        if (nl == NULL) {
+            ESP_LOGE(TAG, "No free number label slot");
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    uint32_t max_abs = max < 0 ? (uint32_t)0 - (uint32_t)max : (uint32_t)max;
+    uint32_t min_abs = min < 0 ? (uint32_t)0 - (uint32_t)min : (uint32_t)min;
+    uint8_t n_cells = num_label_digits(max_abs > min_abs ? max_abs : min_abs) + (min < 0);
+    if (n_cells > NUM_LABEL_MAX_DIGITS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    bool first = nl->label == NULL;
+    if (first) {
+        // 初始值取标签当前文字开头的整数
+        const char *text = lv_label_get_text(label);
+        nl->value = text != NULL ? (int32_t)strtol(text, NULL, 10) : 0;
+        nl->orig_w = lv_obj_get_style_width(label, LV_PART_MAIN);
+        nl->orig_h = lv_obj_get_style_height(label, LV_PART_MAIN);
+        lv_obj_add_event_cb(label, num_label_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+        lv_obj_add_event_cb(label, num_label_event_cb, LV_EVENT_ALL, NULL);
+    }
+    nl->label = label;
+    nl->min = min;
+    nl->max = max;
+    nl->suffix = suffix;
+    nl->n_cells = n_cells;
+    nl->value = LV_CLAMP(min, nl->value, max);
+    num_label_format(nl, nl->value, nl->cells);
+
+    lv_label_set_text_static(label, num_label_empty);
+    num_label_layout(nl);
+    lv_obj_invalidate(label);
+    return ESP_OK;
+}
+
+void num_label_detach(lv_obj_t *label) {
+    num_label_t *nl = num_label_find(label);
+    if (nl == NULL) {
+        return;
+    }
+    lv_obj_remove_event_cb(label, num_label_draw_cb);
+    lv_obj_remove_event_cb(label, num_label_event_cb);
+    lv_obj_set_width(label, nl->orig_w);
+    lv_obj_set_height(label, nl->orig_h);
+    lv_label_set_text_fmt(label, "%" LV_PRId32 "%s", nl->value, nl->suffix != NULL ? nl->suffix : "");
+    memset(nl, 0, sizeof(*nl));
+}
+
+esp_err_t num_label_set_value(lv_obj_t *label, int32_t value) {
+    num_label_t *nl = num_label_find(label);
+    if (nl == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    stats.updates++;
+
+    // 文字被lv_label_set_text等改掉了：恢复并整体重绘
+    if (lv_label_get_text(label) != num_label_empty) {
+        lv_label_set_text_static(label, num_label_empty);
+        num_label_layout(nl);
+        nl->value = LV_CLAMP(nl->min, value, nl->max);
+        num_label_format(nl, nl->value, nl->cells);
+        lv_obj_invalidate(label);
+        stats.repairs++;
+        return ESP_OK;
+    }
+
+    value = LV_CLAMP(nl->min, value, nl->max);
+    if (value == nl->value) {
+        stats.unchanged++;
+        return ESP_OK;
+    }
+    nl->value = value;
+
+    char cells[NUM_LABEL_MAX_DIGITS];
+    num_label_format(nl, value, cells);
+    int first = -1;
+    int last = -1;
+    for (int i = 0; i < nl->n_cells; i++) {
+        if (cells[i] != nl->cells[i]) {
+            if (first < 0) {
+                first = i;
+            }
+            last = i;
+            stats.cells++;
+        }
+    }
+    memcpy(nl->cells, cells, nl->n_cells);
+
+    // 只标记从第一个到最后一个变化格子的区域
+    lv_area_t content;
+    lv_obj_get_content_coords(label, &content);
+    lv_area_t area = {
+        .x1 = content.x1 + first * nl->cell_w,
+        .y1 = content.y1,
+        .x2 = content.x1 + (last + 1) * nl->cell_w - 1,
+        .y2 = content.y1 + nl->line_h - 1,
+    };
+    stats.inv_px += lv_area_get_size(&area);
+    lv_obj_invalidate_area(label, &area);
+    return ESP_OK;
+}
+
+bool num_label_get_value(const lv_obj_t *label, int32_t *out) {
+    num_label_t *nl = num_label_find(label);
+    if (nl == NULL || out == NULL) {
+        return false;
+    }
+    *out = nl->value;
+    return true;
+}
+
+void num_label_get_stats(num_label_stats_t *out) {
+    if (out != NULL) {
+        *out = stats;
+    }
+}
+
+void num_label_reset_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,171 @@
+#ifndef PERF_MONITOR_H
+#define PERF_MONITOR_H
+// 性能统计：每帧渲染/刷屏耗时拆分、脏区像素数、触摸到舵机脉冲的延迟
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+#include "lvgl.h"
+
+/* ========== 统计配置 ========== */
+#define PERF_LATENCY_SAMPLES    (64)    // 延迟统计保留的最近样本数
+#define PERF_AVG_SHIFT          (3)     // 帧统计滑动平均系数 1/8
+#define PERF_FLUSH_FIFO         (8)     // 同时在途的刷屏传输最多记录几个(超出时合并到最后一个)
+#define PERF_REFR_HOOKS_MAX     (8)     // 刷新钩子的最大数量
+
+// 单帧统计(单位：微秒)
+typedef struct {
+    uint32_t seq;           ///< 帧序号
+    int64_t start_us;       ///< 帧开始时间
+    uint32_t render_us;     ///< CPU渲染时间(不含等待刷屏)
+    uint32_t flush_us;      ///< SPI刷屏传输时间
+    uint32_t wait_us;       ///< LVGL等待刷屏完成的时间
+    uint32_t frame_us;      ///< 帧开始到最后一次传输完成
+    uint32_t dirty_px;      ///< 本帧刷新的像素数
+    uint16_t flushes;       ///< 本帧刷屏次数
+    uint8_t overlap_pct;    ///< 重叠效率：渲染和传输同时进行的时间占较短一方的百分比
+} perf_frame_t;
+
+// 时间段类型(用于时间线观察者)
+typedef enum {
+    PERF_SPAN_RENDER,       ///< 一次渲染段(在LVGL任务中回调)
+    PERF_SPAN_FLUSH,        ///< 一次SPI传输(在中断中回调)
+    PERF_SPAN_FRAME,        ///< 一整帧(在LVGL任务中回调)
+} perf_span_t;
+
+/**
+ * @brief 时间段观察者
+ * @note PERF_SPAN_FLUSH在中断上下文中调用，实现必须是ISR安全的
+ * @param kind     时间段类型
+ * @param start_us 开始时间
+ * @param end_us   结束时间
+ * @param frame    帧序号
+ * @param px       像素数(渲染/刷屏段)
+ * @param ctx      注册时传入的上下文
+ */
+typedef void (*perf_span_cb_t)(perf_span_t kind, int64_t start_us, int64_t end_us,
+                               uint32_t frame, uint32_t px, void *ctx);
+
+// 延迟百分位(单位：微秒)
+typedef struct {
+    uint32_t count;         ///< 参与统计的样本数
+    uint32_t p50;
+    uint32_t p90;
+    uint32_t p99;
+    uint32_t max;
+} perf_latency_t;
+
+/**
+ * @brief 刷新钩子：在LVGL刷新定时器的一次刷新之前或之后调用(LVGL任务中，持有LVGL锁)
+ * @param disp LVGL显示
+ * @param ctx  注册时传入的上下文
+ */
+typedef void (*perf_refr_hook_cb_t)(lv_disp_t *disp, void *ctx);
+
+/**
+ * @brief 注册刷新钩子
+ * @note 显示的刷新定时器只被替换一次，各组件(帧统计、脏区域统计、渲染分析、位图缓存等)都注册到这里，
+ *       不再各自替换timer_cb。后注册的钩子在外层：刷新前先调用，刷新后最后调用。需在LVGL锁内调用
+ * @param disp LVGL显示(只支持一个)
+ * @param pre  刷新前调用，可为NULL
+ * @param post 刷新后调用，可为NULL
+ * @param ctx  传给钩子的上下文
+ * @return esp_err_t 返回ESP_OK表示成功，钩子已满时返回ESP_ERR_NO_MEM
+ */
+esp_err_t perf_monitor_add_refr_hook(lv_disp_t *disp, perf_refr_hook_cb_t pre, perf_refr_hook_cb_t post, void *ctx);
+
+/**
+ * @brief 移除perf_monitor_add_refr_hook注册的钩子(pre、post和ctx都相同)
+ * @note 需在LVGL锁内调用
+ */
+esp_err_t perf_monitor_remove_refr_hook(lv_disp_t *disp, perf_refr_hook_cb_t pre, perf_refr_hook_cb_t post, void *ctx);
+
+/**
+ * @brief 立即执行一次刷新(经过所有刷新钩子，与刷新定时器到期时相同)
+ * @note 需在LVGL锁内调用；用于基准测试逐帧重绘
+ */
+void perf_monitor_refresh(lv_disp_t *disp);
+
+/**
+ * @brief 注册刷新钩子并接管显示驱动的flush_cb和传输完成回调，开始统计每帧耗时
+ * @note 需在LVGL锁内调用；会替换面板IO的on_color_trans_done回调，完成后仍通知LVGL(见perf_monitor_set_flush_ready_cb)；
+ *       同时接管wait_cb以记录LVGL等待缓冲区的时间
+ * @param disp      LVGL显示
+ * @param io_handle 面板IO句柄
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t perf_monitor_attach(lv_disp_t *disp, esp_lcd_panel_io_handle_t io_handle);
+
+/**
+ * @brief 传输完成后通知显示驱动的函数
+ * @note 在中断上下文中调用
+ */
+typedef void (*perf_flush_ready_cb_t)(lv_disp_drv_t *drv);
+
+/**
+ * @brief 设置传输完成后调用的函数，默认lv_disp_flush_ready
+ * @note 刷屏回调自己管理多块缓冲区时(例如disp_buf的环形布局)由它决定何时通知LVGL
+ */
+void perf_monitor_set_flush_ready_cb(perf_flush_ready_cb_t cb);
+
+/**
+ * @brief 设置时间段观察者(只有一个，传NULL取消)
+ */
+void perf_monitor_set_span_cb(perf_span_cb_t cb, void *ctx);
+
+/**
+ * @brief 设置忽略区域：刷新区域全部落在该区域内的帧不计入统计
+ * @note 用于排除性能浮层自身的重绘，传NULL取消
+ */
+void perf_monitor_set_ignore_area(const lv_area_t *area);
+
+/**
+ * @brief 获取最近一帧统计
+ * @return true 获取成功, false 还没有完整的帧
+ */
+bool perf_monitor_get_last(perf_frame_t *out);
+
+/**
+ * @brief 获取滑动平均后的帧统计
+ */
+bool perf_monitor_get_avg(perf_frame_t *out);
+
+/**
+ * @brief 接管触摸输入设备的read_cb，记录最近一次按下的采样时间
+ * @note 需在LVGL锁内调用
+ */
+esp_err_t perf_monitor_attach_indev(lv_indev_t *indev);
+
+/**
+ * @brief 返回最近一次按下样本采样时间的函数，0表示没有
+ */
+typedef int64_t (*perf_input_stamp_cb_t)(void);
+
+/**
+ * @brief 设置按下样本的采样时间来源
+ * @note 读取回调只从缓冲区取样本时(例如touch_sampler)，采样时间早于read_cb被调用的时间；
+ *       不设置时取调用read_cb的时间
+ */
+void perf_monitor_set_input_stamp_cb(perf_input_stamp_cb_t cb);
+
+/**
+ * @brief 获取最近一次触摸按下的采样时间，据此计算输入延迟
+ * @note UI消息不携带时间；处理消息的任务在执行动作前调用，UI消息从发送到处理远短于触摸读取周期，
+ *       取到的就是触发该消息的样本
+ * @return int64_t esp_timer时间，没有触摸时为当前时间
+ */
+int64_t perf_monitor_input_stamp(void);
+
+/**
+ * @brief 记录一次延迟样本(例如触摸到舵机PWM更新)
+ * @param stamp_us perf_monitor_input_stamp返回的输入时间
+ */
+void perf_monitor_latency_record(int64_t stamp_us);
+
+/**
+ * @brief 计算最近PERF_LATENCY_SAMPLES个延迟样本的百分位
+ */
+void perf_monitor_get_latency(perf_latency_t *out);
+
+#endif // PERF_MONITOR_H
@@ -0,0 +1,40 @@
+#ifndef PERF_OVERLAY_H
+#define PERF_OVERLAY_H
+// 性能浮层：在lv_layer_top()上显示帧耗时、脏区像素、输入延迟、任务CPU占比和堆内存
+
+#include <stdbool.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+/* ========== 浮层配置 ========== */
+#define PERF_OVERLAY_PERIOD_MS  (500)   // 刷新周期，降低浮层自身对统计的影响
+#define PERF_OVERLAY_WIDTH      (176)   // 固定尺寸，文字更新只重绘这一小块区域
+#define PERF_OVERLAY_HEIGHT     (82)
+#define PERF_OVERLAY_TOP_TASKS  (2)     // 显示CPU占比最高的任务数(不含IDLE)
+
+/**
+ * @brief 创建性能浮层(默认隐藏)
+ * @note 需在LVGL锁内调用；帧统计需先调用perf_monitor_attach
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t perf_overlay_create(void);
+
+/**
+ * @brief 显示或隐藏性能浮层
+ * @note 需在LVGL锁内调用；隐藏时暂停刷新定时器
+ */
+void perf_overlay_show(bool show);
+
+/**
+ * @brief 切换性能浮层的显示状态
+ * @note 需在LVGL锁内调用
+ */
+void perf_overlay_toggle(void);
+
+/**
+ * @brief 长按指定对象时切换性能浮层
+ * @note 需在LVGL锁内调用
+ */
+void perf_overlay_bind_toggle(lv_obj_t *obj);
+
+#endif // PERF_OVERLAY_H
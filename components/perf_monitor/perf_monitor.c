@@ -0,0 +1,420 @@
+#include "perf_monitor.h"
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "Perf Monitor";
+
+/**
+ * @brief 显示统计状态
+ * @note cur和在途传输记录由LVGL任务和传输完成中断共同写入，用perf_lock保护。
+ *       传输按提交顺序完成，前一个完成时下一个才开始占用总线
+ */
+static struct {
+    lv_disp_drv_t *drv;
+    void (*orig_flush_cb)(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+    void (*orig_wait_cb)(lv_disp_drv_t *drv);
+    perf_flush_ready_cb_t flush_ready_cb;
+    perf_span_cb_t span_cb;
+    void *span_ctx;
+    lv_area_t ignore;                   ///< 忽略区域
+    bool ignore_valid;
+    bool counted;                       ///< 当前帧是否有忽略区域以外的刷新
+    uint32_t seq;                       ///< 下一帧序号
+    int64_t mark_us;                    ///< 当前渲染段开始时间
+    int64_t refr_end_us;                ///< 当前帧刷新定时器返回的时间
+    int64_t wait_start_us;              ///< LVGL开始等待刷屏的时间，0表示没有在等
+    volatile int64_t ready_us;          ///< 上一次传输完成后LVGL可以继续的时间
+    volatile int64_t flush_done_us;     ///< 上一次刷屏完成时间
+    int64_t busy_since_us;              ///< 最早的在途传输开始占用总线的时间
+    uint32_t flush_px[PERF_FLUSH_FIFO]; ///< 在途传输的像素数(按提交顺序)
+    uint8_t flush_head;
+    uint8_t flush_count;
+    perf_frame_t cur;                   ///< 正在统计的帧
+    perf_frame_t last;                  ///< 最近一帧
+    perf_frame_t avg;                   ///< 滑动平均
+    bool has_last;
+} perf_disp;
+
+// 刷新钩子(只在LVGL任务中、持有LVGL锁时访问)
+static struct {
+    lv_disp_t *disp;
+    lv_timer_cb_t orig_refr_cb;         ///< LVGL原来的刷新定时器回调
+    struct {
+        perf_refr_hook_cb_t pre;
+        perf_refr_hook_cb_t post;
+        void *ctx;
+    } hooks[PERF_REFR_HOOKS_MAX];
+    uint8_t count;
+} perf_refr;
+
+static struct {
+    lv_indev_drv_t *drv;
+    void (*orig_read_cb)(lv_indev_drv_t *drv, lv_indev_data_t *data);
+    volatile int64_t press_us;          ///< 最近一次按下的采样时间
+    perf_input_stamp_cb_t stamp_cb;     ///< 采样时间来源，NULL时取调用read_cb的时间
+} perf_indev;
+
+static struct {
+    uint32_t samples[PERF_LATENCY_SAMPLES];
+    uint32_t next;                      ///< 总写入次数
+} perf_latency;
+
+static portMUX_TYPE perf_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/****************    刷新钩子 ↓   *************************/
+
+static void perf_refr_timer_cb(lv_timer_t *timer) {
+    lv_disp_t *disp = perf_refr.disp;
+    for (int i = perf_refr.count - 1; i >= 0; i--) {
+        if (perf_refr.hooks[i].pre) {
+            perf_refr.hooks[i].pre(disp, perf_refr.hooks[i].ctx);
+        }
+    }
+    perf_refr.orig_refr_cb(timer);
+    for (int i = 0; i < perf_refr.count; i++) {
+        if (perf_refr.hooks[i].post) {
+            perf_refr.hooks[i].post(disp, perf_refr.hooks[i].ctx);
+        }
+    }
+}
+
+esp_err_t perf_monitor_add_refr_hook(lv_disp_t *disp, perf_refr_hook_cb_t pre, perf_refr_hook_cb_t post, void *ctx) {
+    if (disp == NULL || (pre == NULL && post == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (perf_refr.disp != NULL && perf_refr.disp != disp) {
+        return ESP_ERR_INVALID_STATE;  // 只支持一个显示
+    }
+    if (perf_refr.count >= PERF_REFR_HOOKS_MAX) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (perf_refr.disp == NULL) {
+        perf_refr.disp = disp;
+        perf_refr.orig_refr_cb = disp->refr_timer->timer_cb;
+        disp->refr_timer->timer_cb = perf_refr_timer_cb;
+    }
+    perf_refr.hooks[perf_refr.count].pre = pre;
+    perf_refr.hooks[perf_refr.count].post = post;
+    perf_refr.hooks[perf_refr.count].ctx = ctx;
+    perf_refr.count++;
+    return ESP_OK;
+}
+
+esp_err_t perf_monitor_remove_refr_hook(lv_disp_t *disp, perf_refr_hook_cb_t pre, perf_refr_hook_cb_t post, void *ctx) {
+    if (disp == NULL || disp != perf_refr.disp) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (int i = 0; i < perf_refr.count; i++) {
+        if (perf_refr.hooks[i].pre == pre && perf_refr.hooks[i].post == post && perf_refr.hooks[i].ctx == ctx) {
+            memmove(&perf_refr.hooks[i], &perf_refr.hooks[i + 1], (perf_refr.count - i - 1) * sizeof(perf_refr.hooks[0]));
+            perf_refr.count--;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+void perf_monitor_refresh(lv_disp_t *disp) {
+    lv_timer_t *timer = disp->refr_timer;
+    timer->timer_cb(timer);
+}
+
+/****************    帧统计 ↓   *************************/
+
+static inline uint32_t perf_avg_step(uint32_t avg, uint32_t value) {
+    return avg - (avg >> PERF_AVG_SHIFT) + (value >> PERF_AVG_SHIFT);
+}
+
+/**
+ * @brief 发布上一帧统计
+ * @note 上一帧最后一次传输在刷新定时器返回后才完成，所以推迟到下一次刷新开始时发布
+ */
+static void perf_frame_publish(void) {
+    portENTER_CRITICAL(&perf_lock);
+    if (perf_disp.cur.flushes > 0 && perf_disp.counted) {
+        // 帧在最后一次传输完成时结束；重叠时间 = 渲染 + 传输 - 帧耗时
+        int64_t end = perf_disp.flush_done_us > perf_disp.refr_end_us ? perf_disp.flush_done_us : perf_disp.refr_end_us;
+        perf_frame_t *cur = &perf_disp.cur;
+        cur->frame_us = (uint32_t)(end - cur->start_us);
+        uint32_t busy = cur->render_us + cur->flush_us;
+        uint32_t shorter = cur->render_us < cur->flush_us ? cur->render_us : cur->flush_us;
+        if (busy > cur->frame_us && shorter > 0) {
+            uint32_t pct = (busy - cur->frame_us) * 100ULL / shorter;
+            cur->overlap_pct = pct > 100 ? 100 : pct;
+        }
+
+        perf_disp.last = perf_disp.cur;
+        if (!perf_disp.has_last) {
+            perf_disp.avg = perf_disp.cur;
+            perf_disp.has_last = true;
+        } else {
+            perf_disp.avg.seq = perf_disp.cur.seq;
+            perf_disp.avg.start_us = perf_disp.cur.start_us;
+            perf_disp.avg.render_us = perf_avg_step(perf_disp.avg.render_us, perf_disp.cur.render_us);
+            perf_disp.avg.flush_us = perf_avg_step(perf_disp.avg.flush_us, perf_disp.cur.flush_us);
+            perf_disp.avg.wait_us = perf_avg_step(perf_disp.avg.wait_us, perf_disp.cur.wait_us);
+            perf_disp.avg.frame_us = perf_avg_step(perf_disp.avg.frame_us, perf_disp.cur.frame_us);
+            // 百分比数值小，放大后再平均以减少截断误差
+            perf_disp.avg.overlap_pct = perf_avg_step(perf_disp.avg.overlap_pct << 4, perf_disp.cur.overlap_pct << 4) >> 4;
+            perf_disp.avg.dirty_px = perf_avg_step(perf_disp.avg.dirty_px, perf_disp.cur.dirty_px);
+            perf_disp.avg.flushes = perf_disp.cur.flushes;
+        }
+    }
+    memset(&perf_disp.cur, 0, sizeof(perf_disp.cur));
+    perf_disp.counted = false;
+    portEXIT_CRITICAL(&perf_lock);
+}
+
+static void perf_refr_start(lv_disp_t *disp, void *ctx) {
+    perf_frame_publish();
+
+    int64_t start = esp_timer_get_time();
+    perf_disp.cur.seq = perf_disp.seq;
+    perf_disp.cur.start_us = start;
+    perf_disp.mark_us = start;
+}
+
+static void perf_refr_end(lv_disp_t *disp, void *ctx) {
+    perf_disp.refr_end_us = esp_timer_get_time();
+
+    if (perf_disp.cur.flushes == 0) {
+        return;  // 没有脏区域，不算一帧
+    }
+    perf_span_cb_t cb = perf_disp.span_cb;
+    if (cb) {
+        cb(PERF_SPAN_FRAME, perf_disp.cur.start_us, esp_timer_get_time(), perf_disp.seq, perf_disp.cur.dirty_px,
+           perf_disp.span_ctx);
+    }
+    perf_disp.seq++;
+}
+
+/**
+ * @brief LVGL等待缓冲区时反复调用，记录开始等待的时间
+ */
+static void perf_wait_cb(lv_disp_drv_t *drv) {
+    if (perf_disp.wait_start_us == 0) {
+        perf_disp.wait_start_us = esp_timer_get_time();
+    }
+    if (perf_disp.orig_wait_cb) {
+        perf_disp.orig_wait_cb(drv);
+    }
+}
+
+static void perf_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+    int64_t now = esp_timer_get_time();
+    uint32_t px = lv_area_get_size(area);
+    // 单缓冲在渲染前等待，双缓冲在提交前等待，两种情况都在本次回调前结束
+    uint32_t wait = 0;
+    if (perf_disp.wait_start_us) {
+        int64_t ready = perf_disp.ready_us;
+        wait = (uint32_t)((ready > perf_disp.wait_start_us ? ready : now) - perf_disp.wait_start_us);
+        perf_disp.wait_start_us = 0;
+    }
+    uint32_t render = (uint32_t)(now - perf_disp.mark_us);
+    render = render > wait ? render - wait : 0;
+
+    portENTER_CRITICAL(&perf_lock);
+    perf_disp.cur.render_us += render;
+    perf_disp.cur.wait_us += wait;
+    perf_disp.cur.dirty_px += px;
+    perf_disp.cur.flushes++;
+    if (!perf_disp.ignore_valid || !_lv_area_is_in(area, &perf_disp.ignore, 0)) {
+        perf_disp.counted = true;
+    }
+    if (perf_disp.flush_count == 0) {
+        perf_disp.busy_since_us = now;
+    }
+    if (perf_disp.flush_count < PERF_FLUSH_FIFO) {
+        perf_disp.flush_count++;
+    }
+    perf_disp.flush_px[(perf_disp.flush_head + perf_disp.flush_count - 1) % PERF_FLUSH_FIFO] = px;
+    portEXIT_CRITICAL(&perf_lock);
+
+    perf_span_cb_t cb = perf_disp.span_cb;
+    if (cb) {
+        cb(PERF_SPAN_RENDER, now - render, now, perf_disp.seq, px, perf_disp.span_ctx);
+    }
+    perf_disp.orig_flush_cb(drv, area, color_map);
+    perf_disp.mark_us = esp_timer_get_time();
+}
+
+static bool perf_color_trans_done(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx) {
+    lv_disp_drv_t *disp_drv = (lv_disp_drv_t *)user_ctx;
+    int64_t now = esp_timer_get_time();
+    int64_t start = 0;
+    uint32_t px = 0;
+
+    // 一次flush_cb可能对应多次传输(例如经中转缓冲区分块)，多出的完成事件不计时
+    portENTER_CRITICAL_ISR(&perf_lock);
+    if (perf_disp.flush_count > 0) {
+        start = perf_disp.busy_since_us;
+        px = perf_disp.flush_px[perf_disp.flush_head];
+        perf_disp.cur.flush_us += (uint32_t)(now - start);
+        perf_disp.flush_head = (perf_disp.flush_head + 1) % PERF_FLUSH_FIFO;
+        perf_disp.flush_count--;
+        perf_disp.busy_since_us = now;
+    }
+    portEXIT_CRITICAL_ISR(&perf_lock);
+
+    perf_span_cb_t cb = perf_disp.span_cb;
+    if (start && cb) {
+        cb(PERF_SPAN_FLUSH, start, now, perf_disp.seq, px, perf_disp.span_ctx);
+    }
+    perf_disp.flush_done_us = now;
+    perf_disp.flush_ready_cb(disp_drv);
+    if (!disp_drv->draw_buf->flushing) {
+        perf_disp.ready_us = now;
+    }
+    return false;
+}
+
+esp_err_t perf_monitor_attach(lv_disp_t *disp, esp_lcd_panel_io_handle_t io_handle) {
+    if (disp == NULL || io_handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (perf_disp.drv != NULL) {
+        return ESP_ERR_INVALID_STATE;  // 只支持一个显示
+    }
+
+    if (perf_disp.flush_ready_cb == NULL) {
+        perf_disp.flush_ready_cb = lv_disp_flush_ready;
+    }
+    // 替换传输完成回调，记录刷屏结束时间后再通知LVGL
+    const esp_lcd_panel_io_callbacks_t cbs = {
+        .on_color_trans_done = perf_color_trans_done,
+    };
+    esp_err_t ret = esp_lcd_panel_io_register_event_callbacks(io_handle, &cbs, disp->driver);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    // 通常在其他组件之后注册，帧统计在最外层，包含其他钩子的耗时
+    ret = perf_monitor_add_refr_hook(disp, perf_refr_start, perf_refr_end, NULL);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    perf_disp.drv = disp->driver;
+    perf_disp.orig_flush_cb = disp->driver->flush_cb;
+    perf_disp.orig_wait_cb = disp->driver->wait_cb;
+    disp->driver->flush_cb = perf_flush_cb;
+    disp->driver->wait_cb = perf_wait_cb;
+    ESP_LOGI(TAG, "Display frame statistics attached");
+    return ESP_OK;
+}
+
+void perf_monitor_set_flush_ready_cb(perf_flush_ready_cb_t cb) {
+    perf_disp.flush_ready_cb = cb ? cb : lv_disp_flush_ready;
+}
+
+void perf_monitor_set_span_cb(perf_span_cb_t cb, void *ctx) {
+    portENTER_CRITICAL(&perf_lock);
+    perf_disp.span_ctx = ctx;
+    perf_disp.span_cb = cb;
+    portEXIT_CRITICAL(&perf_lock);
+}
+
+void perf_monitor_set_ignore_area(const lv_area_t *area) {
+    portENTER_CRITICAL(&perf_lock);
+    if (area) {
+        perf_disp.ignore = *area;
+        perf_disp.ignore_valid = true;
+    } else {
+        perf_disp.ignore_valid = false;
+    }
+    portEXIT_CRITICAL(&perf_lock);
+}
+
+bool perf_monitor_get_last(perf_frame_t *out) {
+    portENTER_CRITICAL(&perf_lock);
+    bool ok = perf_disp.has_last;
+    if (ok) {
+        *out = perf_disp.last;
+    }
+    portEXIT_CRITICAL(&perf_lock);
+    return ok;
+}
+
+bool perf_monitor_get_avg(perf_frame_t *out) {
+    portENTER_CRITICAL(&perf_lock);
+    bool ok = perf_disp.has_last;
+    if (ok) {
+        *out = perf_disp.avg;
+    }
+    portEXIT_CRITICAL(&perf_lock);
+    return ok;
+}
+
+/****************    输入延迟 ↓   *************************/
+
+static void perf_indev_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
+    // 取读取前的时间，包含触摸芯片的I2C读取时间
+    int64_t now = esp_timer_get_time();
+    perf_indev.orig_read_cb(drv, data);
+    if (data->state == LV_INDEV_STATE_PRESSED) {
+        int64_t stamp = perf_indev.stamp_cb ? perf_indev.stamp_cb() : 0;
+        perf_indev.press_us = stamp ? stamp : now;
+    }
+}
+
+void perf_monitor_set_input_stamp_cb(perf_input_stamp_cb_t cb) {
+    perf_indev.stamp_cb = cb;
+}
+
+esp_err_t perf_monitor_attach_indev(lv_indev_t *indev) {
+    if (indev == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (perf_indev.drv != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    perf_indev.drv = indev->driver;
+    perf_indev.orig_read_cb = indev->driver->read_cb;
+    indev->driver->read_cb = perf_indev_read_cb;
+    return ESP_OK;
+}
+
+int64_t perf_monitor_input_stamp(void) {
+    int64_t stamp = perf_indev.press_us;
+    return stamp ? stamp : esp_timer_get_time();
+}
+
+void perf_monitor_latency_record(int64_t stamp_us) {
+    int64_t delta = esp_timer_get_time() - stamp_us;
+    if (delta < 0) {
+        return;
+    }
+    portENTER_CRITICAL(&perf_lock);
+    perf_latency.samples[perf_latency.next % PERF_LATENCY_SAMPLES] = (uint32_t)delta;
+    perf_latency.next++;
+    portEXIT_CRITICAL(&perf_lock);
+}
+
+static int perf_cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+void perf_monitor_get_latency(perf_latency_t *out) {
+    uint32_t sorted[PERF_LATENCY_SAMPLES];
+    uint32_t count;
+
+    portENTER_CRITICAL(&perf_lock);
+    count = perf_latency.next < PERF_LATENCY_SAMPLES ? perf_latency.next : PERF_LATENCY_SAMPLES;
+    memcpy(sorted, perf_latency.samples, count * sizeof(uint32_t));
+    portEXIT_CRITICAL(&perf_lock);
+
+    memset(out, 0, sizeof(*out));
+    if (count == 0) {
+        return;
+    }
+    qsort(sorted, count, sizeof(uint32_t), perf_cmp_u32);
+    out->count = count;
+    out->p50 = sorted[(count - 1) * 50 / 100];
+    out->p90 = sorted[(count - 1) * 90 / 100];
+    out->p99 = sorted[(count - 1) * 99 / 100];
+    out->max = sorted[count - 1];
+}
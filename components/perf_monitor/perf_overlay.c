@@ -0,0 +1,169 @@
+#include "perf_overlay.h"
+#include <stdio.h>
+#include <string.h>
+#include "perf_monitor.h"
+#include "telemetry.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "Perf Overlay";
+
+static lv_obj_t *overlay_cont = NULL;
+static lv_obj_t *overlay_label = NULL;
+static lv_timer_t *overlay_timer = NULL;
+static uint32_t overlay_last_seq = 0;
+static int64_t overlay_last_us = 0;
+
+// 微秒转为"毫秒.一位小数"的两个整数
+#define US_MS(us)   (unsigned)((us) / 1000), (unsigned)((us) % 1000 / 100)
+
+/**
+ * @brief 取CPU占比最高的任务(不含IDLE)，并累计IDLE任务占比
+ */
+static int overlay_top_tasks(const telemetry_sample_t *s, const telemetry_task_t **top, unsigned *idle_permille) {
+    int n = 0;
+    *idle_permille = 0;
+    for (int i = 0; i < s->task_count; i++) {
+        const telemetry_task_t *t = &s->tasks[i];
+        if (strncmp(t->name, "IDLE", 4) == 0) {
+            *idle_permille += t->cpu_permille;
+            continue;
+        }
+        // 插入排序到前PERF_OVERLAY_TOP_TASKS名
+        int pos = n < PERF_OVERLAY_TOP_TASKS ? n++ : PERF_OVERLAY_TOP_TASKS;
+        while (pos > 0 && top[pos - 1]->cpu_permille < t->cpu_permille) {
+            if (pos < PERF_OVERLAY_TOP_TASKS) {
+                top[pos] = top[pos - 1];
+            }
+            pos--;
+        }
+        if (pos < PERF_OVERLAY_TOP_TASKS) {
+            top[pos] = t;
+        }
+    }
+    return n;
+}
+
+static void overlay_update_cb(lv_timer_t *timer) {
+    static telemetry_sample_t sample;   // 样本较大，只在LVGL任务中使用
+    static char text[192];
+    char line[48];
+    size_t len = 0;
+
+    // 帧统计：刷新率、渲染/刷屏耗时(滑动平均)
+    perf_frame_t avg;
+    if (perf_monitor_get_avg(&avg)) {
+        int64_t now = esp_timer_get_time();
+        unsigned fps = 0;
+        if (overlay_last_us && now > overlay_last_us) {
+            fps = (unsigned)((uint64_t)(avg.seq - overlay_last_seq) * 1000000 / (uint64_t)(now - overlay_last_us));
+        }
+        overlay_last_seq = avg.seq;
+        overlay_last_us = now;
+        len += snprintf(text + len, sizeof(text) - len, "fps %u rnd %u.%u fl %u.%u ms\npx %lu wait %u.%u ms ovl %u%%\n",
+                        fps, US_MS(avg.render_us), US_MS(avg.flush_us),
+                        (unsigned long)avg.dirty_px, US_MS(avg.wait_us), avg.overlap_pct);
+    } else {
+        len += snprintf(text + len, sizeof(text) - len, "fps -\npx -\n");
+    }
+
+    // 触摸到舵机PWM更新的延迟
+    perf_latency_t lat;
+    perf_monitor_get_latency(&lat);
+    if (lat.count) {
+        len += snprintf(text + len, sizeof(text) - len, "lat %u.%u/%u.%u/%u.%u ms\n",
+                        US_MS(lat.p50), US_MS(lat.p90), US_MS(lat.p99));
+    } else {
+        len += snprintf(text + len, sizeof(text) - len, "lat -\n");
+    }
+
+    // 任务CPU占比和堆内存来自遥测最新样本
+    if (telemetry_get_sample(0, &sample)) {
+        const telemetry_task_t *top[PERF_OVERLAY_TOP_TASKS];
+        unsigned idle = 0;
+        int n = overlay_top_tasks(&sample, top, &idle);
+        size_t l = 0;
+        line[0] = '\0';
+        for (int i = 0; i < n; i++) {
+            l += snprintf(line + l, sizeof(line) - l, "%.6s %u%% ", top[i]->name, top[i]->cpu_permille / 10);
+        }
+        len += snprintf(text + len, sizeof(text) - len, "%sidle %u%%\nint %luK dma %luK psr %luK",
+                        line, idle / 10,
+                        (unsigned long)(sample.heap[TELEMETRY_HEAP_INTERNAL].free / 1024),
+                        (unsigned long)(sample.heap[TELEMETRY_HEAP_DMA].free / 1024),
+                        (unsigned long)(sample.heap[TELEMETRY_HEAP_SPIRAM].free / 1024));
+    } else {
+        len += snprintf(text + len, sizeof(text) - len, "cpu -\nheap -");
+    }
+
+    // 内容不变时不设置文字，避免无意义的重绘
+    if (strcmp(lv_label_get_text(overlay_label), text) != 0) {
+        lv_label_set_text(overlay_label, text);
+    }
+}
+
+esp_err_t perf_overlay_create(void) {
+    if (overlay_cont != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // 不透明、无圆角：LVGL重绘时从浮层开始绘制，不再绘制被遮挡的界面
+    overlay_cont = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(overlay_cont, PERF_OVERLAY_WIDTH, PERF_OVERLAY_HEIGHT);
+    lv_obj_align(overlay_cont, LV_ALIGN_TOP_RIGHT, 0, 0);
+    lv_obj_clear_flag(overlay_cont, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_style_radius(overlay_cont, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(overlay_cont, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_color(overlay_cont, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(overlay_cont, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_all(overlay_cont, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    // 固定宽度+裁剪，文字变化不会改变布局
+    overlay_label = lv_label_create(overlay_cont);
+    lv_obj_set_width(overlay_label, lv_pct(100));
+    lv_label_set_long_mode(overlay_label, LV_LABEL_LONG_CLIP);
+    lv_obj_set_style_text_font(overlay_label, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_color(overlay_label, lv_color_hex(0x00FF00), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_label_set_text(overlay_label, "");
+
+    // 只包含浮层自身重绘的帧不计入帧统计
+    lv_obj_update_layout(overlay_cont);
+    lv_area_t area;
+    lv_obj_get_coords(overlay_cont, &area);
+    perf_monitor_set_ignore_area(&area);
+
+    overlay_timer = lv_timer_create(overlay_update_cb, PERF_OVERLAY_PERIOD_MS, NULL);
+    perf_overlay_show(false);
+    ESP_LOGI(TAG, "Performance overlay created");
+    return ESP_OK;
+}
+
+void perf_overlay_show(bool show) {
+    if (overlay_cont == NULL) {
+        return;
+    }
+    if (show) {
+        overlay_last_us = 0;
+        lv_obj_clear_flag(overlay_cont, LV_OBJ_FLAG_HIDDEN);
+        lv_timer_resume(overlay_timer);
+        lv_timer_ready(overlay_timer);
+    } else {
+        lv_obj_add_flag(overlay_cont, LV_OBJ_FLAG_HIDDEN);
+        lv_timer_pause(overlay_timer);
+    }
+}
+
+void perf_overlay_toggle(void) {
+    if (overlay_cont == NULL) {
+        return;
+    }
+    perf_overlay_show(lv_obj_has_flag(overlay_cont, LV_OBJ_FLAG_HIDDEN));
+}
+
+static void overlay_toggle_event_cb(lv_event_t *e) {
+    perf_overlay_toggle();
+}
+
+void perf_overlay_bind_toggle(lv_obj_t *obj) {
+    lv_obj_add_event_cb(obj, overlay_toggle_event_cb, LV_EVENT_LONG_PRESSED, NULL);
+}
@@ -0,0 +1,61 @@
+#ifndef RENDER_PAR_H
+#define RENDER_PAR_H
+// 双核渲染：把LVGL软件渲染中的大块混合(填充/复制)按行切成两条，另一个核心上的工作任务渲染其中一条
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+/* ========== 并行渲染配置 ========== */
+#define RENDER_PAR_ENABLE           (1)     // 启动时是否开启并行渲染(运行时可用render_par_set_enabled切换)
+#define RENDER_PAR_WORKER_CORE      (1)     // 工作任务固定的核心，LVGL任务应固定在另一个核心
+#define RENDER_PAR_TASK_PRIORITY    (5)     // 高于LVGL任务，收到任务后尽快在另一个核心上运行
+#define RENDER_PAR_TASK_STACK       (3072)
+#define RENDER_PAR_MIN_PX           (4096)  // 混合区域小于该像素数时不拆分，唤醒工作任务的开销比收益大
+#define RENDER_PAR_MIN_ROWS         (4)     // 混合区域少于该行数时不拆分
+
+// 并行渲染统计
+typedef struct {
+    uint32_t blends;        ///< 混合调用次数
+    uint32_t splits;        ///< 拆分成两条的次数
+    uint32_t stolen;        ///< 工作任务没来得及开始、由LVGL任务自己完成的次数
+    uint64_t px;            ///< 混合的像素总数
+    uint64_t worker_px;     ///< 由工作任务完成的像素数
+    uint32_t join_wait_us;  ///< LVGL任务完成自己那条后等待工作任务的时间
+} render_par_stats_t;
+
+/**
+ * @brief 创建工作任务并接管显示的软件混合函数
+ * @note 需在LVGL锁内、lvgl_port_add_disp之后调用。
+ *       只拆分不透明度和遮罩都与行无关的混合，两条写入绘图缓冲区中不相交的行，
+ *       LVGL任务等两条都完成后才返回，后续的绘制和刷屏顺序不变
+ * @param disp LVGL显示
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t render_par_attach(lv_disp_t *disp);
+
+/**
+ * @brief 开启或关闭并行渲染
+ * @note 需在LVGL锁内调用
+ */
+void render_par_set_enabled(bool enabled);
+
+/**
+ * @brief 并行渲染是否开启
+ */
+bool render_par_is_enabled(void);
+
+/**
+ * @brief 获取统计(自render_par_attach或上次render_par_reset_stats起)
+ * @note 需在LVGL锁内调用
+ */
+void render_par_get_stats(render_par_stats_t *out);
+
+/**
+ * @brief 清零统计
+ * @note 需在LVGL锁内调用
+ */
+void render_par_reset_stats(void);
+
+#endif // RENDER_PAR_H
@@ -0,0 +1,139 @@
+#include "render_par.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "src/draw/sw/lv_draw_sw.h"
+
+static const char *TAG = "Render Par";
+
+typedef void (*render_par_blend_cb_t)(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc);
+
+// 工作条带的状态，LVGL任务和工作任务用原子操作交接
+enum {
+    JOB_IDLE,       ///< 没有条带
+    JOB_POSTED,     ///< 已发布，等待工作任务领取
+    JOB_RUNNING,    ///< 工作任务正在渲染
+    JOB_DONE,       ///< 工作任务已完成
+};
+
+/**
+ * @brief 并行渲染状态
+ * @note job中的内容由LVGL任务在发布前写好，工作任务领取后只读；stats只在LVGL任务中写
+ */
+static struct {
+    lv_draw_sw_ctx_t *draw_ctx;
+    render_par_blend_cb_t orig_blend;
+    TaskHandle_t worker;
+    bool enabled;
+    struct {
+        lv_draw_ctx_t ctx;                  ///< 绘图上下文副本，裁剪区域换成工作条带
+        lv_area_t clip;
+        const lv_draw_sw_blend_dsc_t *dsc;
+        uint32_t state;
+    } job;
+    render_par_stats_t stats;
+} par;
+
+/**
+ * @brief 工作任务：领取条带并渲染
+ * @note 唤醒时条带可能已经被LVGL任务自己做完，领取失败就继续等待
+ */
+static void render_par_worker(void *arg) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint32_t expected = JOB_POSTED;
+        if (__atomic_compare_exchange_n(&par.job.state, &expected, JOB_RUNNING, false,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            par.orig_blend(&par.job.ctx, par.job.dsc);
+            __atomic_store_n(&par.job.state, JOB_DONE, __ATOMIC_RELEASE);
+        }
+    }
+}
+
+/**
+ * @brief 混合不依赖行顺序，按行拆成上下两条：上条在LVGL任务中渲染，下条交给工作任务
+ * @note 关闭抗锯齿时lv_draw_sw_blend_basic会原地改写整个遮罩，这种情况不拆分
+ */
+static void render_par_blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc) {
+    lv_area_t area;
+    if (!_lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area)) {
+        return;
+    }
+    uint32_t px = lv_area_get_size(&area);
+    par.stats.blends++;
+    par.stats.px += px;
+    lv_coord_t rows = lv_area_get_height(&area);
+    if (!par.enabled || px < RENDER_PAR_MIN_PX || rows < RENDER_PAR_MIN_ROWS ||
+        (dsc->mask_buf && !_lv_refr_get_disp_refreshing()->driver->antialiasing)) {
+        par.orig_blend(draw_ctx, dsc);
+        return;
+    }
+
+    lv_area_t top = area;
+    top.y2 = area.y1 + rows / 2 - 1;
+    par.job.ctx = *draw_ctx;
+    par.job.clip = area;
+    par.job.clip.y1 = top.y2 + 1;
+    par.job.ctx.clip_area = &par.job.clip;
+    par.job.dsc = dsc;
+    __atomic_store_n(&par.job.state, JOB_POSTED, __ATOMIC_RELEASE);
+    xTaskNotifyGive(par.worker);
+
+    lv_draw_ctx_t mine = *draw_ctx;
+    mine.clip_area = &top;
+    par.orig_blend(&mine, dsc);
+
+    // 工作任务还没领取时自己做完下条，否则等它完成
+    uint32_t expected = JOB_POSTED;
+    if (__atomic_compare_exchange_n(&par.job.state, &expected, JOB_IDLE, false,
+                                    __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+        par.orig_blend(&par.job.ctx, dsc);
+        par.stats.stolen++;
+    } else {
+        int64_t start = esp_timer_get_time();
+        while (__atomic_load_n(&par.job.state, __ATOMIC_ACQUIRE) != JOB_DONE) {
+            taskYIELD();    // 两条行数相同，通常很快结束；让出给同核心上同优先级的任务
+        }
+        par.stats.join_wait_us += (uint32_t)(esp_timer_get_time() - start);
+        par.stats.worker_px += lv_area_get_size(&par.job.clip);
+        __atomic_store_n(&par.job.state, JOB_IDLE, __ATOMIC_RELAXED);
+    }
+    par.stats.splits++;
+}
+
+esp_err_t render_par_attach(lv_disp_t *disp) {
+    if (disp == NULL || disp->driver->draw_ctx == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (par.worker != NULL) {
+        return ESP_ERR_INVALID_STATE;  // 只支持一个显示
+    }
+    if (xTaskCreatePinnedToCore(render_par_worker, "render_par", RENDER_PAR_TASK_STACK, NULL,
+                                RENDER_PAR_TASK_PRIORITY, &par.worker, RENDER_PAR_WORKER_CORE) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    par.draw_ctx = (lv_draw_sw_ctx_t *)disp->driver->draw_ctx;
+    par.orig_blend = par.draw_ctx->blend;
+    par.draw_ctx->blend = render_par_blend;
+    par.enabled = RENDER_PAR_ENABLE;
+    ESP_LOGI(TAG, "Parallel blending on core %d %s", RENDER_PAR_WORKER_CORE, par.enabled ? "enabled" : "disabled");
+    return ESP_OK;
+}
+
+void render_par_set_enabled(bool enabled) {
+    par.enabled = enabled;
+}
+
+bool render_par_is_enabled(void) {
+    return par.enabled;
+}
+
+void render_par_get_stats(render_par_stats_t *out) {
+    *out = par.stats;
+}
+
+void render_par_reset_stats(void) {
+    memset(&par.stats, 0, sizeof(par.stats));
+}
@@ -0,0 +1,118 @@
+#ifndef RENDER_PROF_H
+#define RENDER_PROF_H
+// 逐对象渲染分析：LVGL(LV_USE_REFR_PROFILER=1)在绘制每个对象的各阶段前后回调，
+// 按对象、对象类型和用户设置的名字统计耗时与混合的像素数，找出拖慢一帧的控件。
+// 对象删除时自动删除它的统计项和名字。
+// LV_USE_REFR_PROFILER=0时LVGL中不编译任何统计代码，本组件的接口返回ESP_ERR_NOT_SUPPORTED或空结果
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+/* ========== 渲染分析配置 ========== */
+#define RENDER_PROF_MAX_OBJS    (64)    // 统计的对象数上限(2的幂)，表满后新出现的对象不统计
+#define RENDER_PROF_MAX_NAMES   (32)    // 可命名的对象数
+#define RENDER_PROF_MAX_DEPTH   (24)    // 对象树嵌套深度上限，更深的对象不统计
+#define RENDER_PROF_TOP_N       (5)     // 慢帧自动输出的对象数
+
+// 绘制阶段，与LVGL的lv_refr_phase_t一一对应
+typedef enum {
+    RENDER_PROF_PHASE_MAIN,             ///< DRAW_MAIN事件：背景、边框、文字等
+    RENDER_PROF_PHASE_CHILDREN,         ///< 绘制子对象，包含子对象的耗时
+    RENDER_PROF_PHASE_POST,             ///< DRAW_POST事件：滚动条、轮廓等
+    RENDER_PROF_PHASE_LAYER,            ///< 带透明度/变换的对象创建、混合、销毁图层
+    RENDER_PROF_PHASE_NUM,
+} render_prof_phase_t;
+
+// 统计分组
+typedef enum {
+    RENDER_PROF_BY_OBJ,                 ///< 每个对象
+    RENDER_PROF_BY_CLASS,               ///< 对象类型(label、btn……)
+    RENDER_PROF_BY_NAME,                ///< render_prof_set_name设置的名字，同名对象合计，未命名的不计入
+} render_prof_group_t;
+
+// 统计范围
+typedef enum {
+    RENDER_PROF_LAST_FRAME,             ///< 最近一次有绘制的刷新
+    RENDER_PROF_AVERAGE,                ///< 自清零统计以来每帧的平均值
+} render_prof_mode_t;
+
+// 一个对象(或一组对象)的统计
+typedef struct {
+    const lv_obj_t *obj;                ///< 按对象分组时的对象，其他分组为NULL
+    const char *name;                   ///< 名字，未命名为NULL
+    const char *class_name;             ///< 对象类型，按名字分组时取第一个对象的类型
+    uint32_t objs;                      ///< 组内对象数
+    uint32_t draws;                     ///< 绘制次数，每个刷新区域、每个分块各计一次
+    uint32_t self_us;                   ///< 自身耗时：main + post + layer，不含子对象
+    uint32_t phase_us[RENDER_PROF_PHASE_NUM];
+    uint32_t px;                        ///< 自身混合的像素数，不含子对象；只与绘制内容有关，主机上可重复
+} render_prof_entry_t;
+
+// 总体统计
+typedef struct {
+    uint32_t frames;                    ///< 有绘制的刷新次数
+    uint32_t last_frame_us;             ///< 最近一帧所有对象自身耗时之和
+    uint32_t max_frame_us;
+    uint32_t slow_frames;               ///< 超过慢帧阈值的帧数
+    uint32_t objs;                      ///< 统计中的对象数
+    uint32_t dropped;                   ///< 表满或嵌套过深而未统计的绘制次数
+} render_prof_stats_t;
+
+/**
+ * @brief 接管LVGL的对象绘制回调和软件混合函数、注册刷新钩子(perf_monitor_add_refr_hook)并开始统计
+ * @note 需在LVGL锁内、lvgl_port_add_disp和render_par_attach之后调用；只支持一个显示
+ * @param disp LVGL显示
+ * @return esp_err_t 返回ESP_OK表示成功，LV_USE_REFR_PROFILER=0时返回ESP_ERR_NOT_SUPPORTED
+ */
+esp_err_t render_prof_attach(lv_disp_t *disp);
+
+/**
+ * @brief 暂停或恢复统计，暂停时LVGL不再回调
+ * @note 需在LVGL锁内调用
+ */
+void render_prof_set_enabled(bool enabled);
+
+/**
+ * @brief 给对象起名字，用于按名字分组；多个对象可以同名
+ * @note 需在LVGL锁内调用；name必须一直有效(一般用字符串常量)；对象删除时名字随之删除
+ * @return esp_err_t 名字表满时返回ESP_ERR_NO_MEM
+ */
+esp_err_t render_prof_set_name(const lv_obj_t *obj, const char *name);
+
+/**
+ * @brief 设置慢帧阈值：一帧的绘制耗时超过该值时输出该帧最耗时的RENDER_PROF_TOP_N个对象
+ * @param us 阈值，0表示不输出
+ */
+void render_prof_set_slow_frame_us(uint32_t us);
+
+/**
+ * @brief 获取最耗时的n个对象(或分组)，按自身耗时从大到小排列，耗时相同按像素数
+ * @note 需在LVGL锁内调用
+ * @param out 结果
+ * @param n out的容量
+ * @return size_t 实际数量
+ */
+size_t render_prof_get_top(render_prof_group_t group, render_prof_mode_t mode, render_prof_entry_t *out, size_t n);
+
+/**
+ * @brief 输出最耗时的n个对象(或分组)到日志
+ * @note 需在LVGL锁内调用
+ */
+void render_prof_dump(render_prof_group_t group, render_prof_mode_t mode, size_t n);
+
+/**
+ * @brief 获取总体统计
+ * @note 需在LVGL锁内调用
+ */
+void render_prof_get_stats(render_prof_stats_t *out);
+
+/**
+ * @brief 清空所有对象的统计(名字保留)
+ * @note 需在LVGL锁内调用；删除的对象在LV_EVENT_DELETE时已自动删除统计项和名字，不需要为此清零
+ */
+void render_prof_reset(void);
+
+#endif // RENDER_PROF_H
@@ -0,0 +1,446 @@
+#include "render_prof.h"
+#include <stdlib.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "perf_monitor.h"
+#include "src/draw/sw/lv_draw_sw.h"
+
+static const char *TAG = "Render Prof";
+
+#if LV_USE_REFR_PROFILER
+
+typedef void (*render_prof_blend_cb_t)(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc);
+
+// 一帧内(或累计)的计数
+typedef struct {
+    uint32_t draws;
+    uint32_t phase_us[RENDER_PROF_PHASE_NUM];
+    uint32_t px;
+} prof_acc_t;
+
+// 一个对象的统计，按地址散列存放；对象删除时删除统计项，新对象复用地址时重新统计
+typedef struct {
+    const lv_obj_t *obj;
+    const lv_obj_class_t *class_p;      ///< 首次绘制时记录
+    const char *name;
+    prof_acc_t cur;                     ///< 当前帧
+    prof_acc_t last;                    ///< 最近一次有绘制的帧
+    uint64_t total_us[RENDER_PROF_PHASE_NUM];
+    uint64_t total_px;
+    uint32_t total_draws;
+} prof_obj_t;
+
+static struct {
+    lv_disp_t *disp;
+    lv_draw_sw_ctx_t *draw_ctx;
+    render_prof_blend_cb_t orig_blend;
+    bool enabled;
+    uint32_t slow_frame_us;
+    prof_obj_t objs[RENDER_PROF_MAX_OBJS];
+    struct {
+        const lv_obj_t *obj;
+        const char *name;
+    } names[RENDER_PROF_MAX_NAMES];
+    struct {
+        prof_obj_t *o;                  ///< 未统计的对象为NULL
+        int64_t start_us;
+    } stack[RENDER_PROF_MAX_DEPTH];
+    int depth;                          ///< 可能超过RENDER_PROF_MAX_DEPTH，超出部分只计数不入栈
+    render_prof_stats_t stats;
+    render_prof_entry_t scratch[RENDER_PROF_MAX_OBJS];     ///< 分组排序用，避免占用LVGL任务的栈
+} prof;
+
+// 常用控件类型的名字，自定义类型按最近的已知基类显示
+static const struct {
+    const lv_obj_class_t *class_p;
+    const char *name;
+} prof_classes[] = {
+#if LV_USE_LABEL
+    { &lv_label_class, "label" },
+#endif
+#if LV_USE_BTN
+    { &lv_btn_class, "btn" },
+#endif
+#if LV_USE_SLIDER
+    { &lv_slider_class, "slider" },
+#endif
+#if LV_USE_BAR
+    { &lv_bar_class, "bar" },
+#endif
+#if LV_USE_IMG
+    { &lv_img_class, "img" },
+#endif
+#if LV_USE_ARC
+    { &lv_arc_class, "arc" },
+#endif
+    { &lv_obj_class, "obj" },
+};
+
+static const char *render_prof_class_name(const lv_obj_class_t *class_p) {
+    for (; class_p != NULL; class_p = class_p->base_class) {
+        for (size_t i = 0; i < sizeof(prof_classes) / sizeof(prof_classes[0]); i++) {
+            if (prof_classes[i].class_p == class_p) {
+                return prof_classes[i].name;
+            }
+        }
+    }
+    return "?";
+}
+
+static const char *render_prof_lookup_name(const lv_obj_t *obj) {
+    for (size_t i = 0; i < RENDER_PROF_MAX_NAMES && prof.names[i].obj != NULL; i++) {
+        if (prof.names[i].obj == obj) {
+            return prof.names[i].name;
+        }
+    }
+    return NULL;
+}
+
+static uint32_t render_prof_self_us(const prof_acc_t *acc) {
+    return acc->phase_us[RENDER_PROF_PHASE_MAIN] + acc->phase_us[RENDER_PROF_PHASE_POST] +
+           acc->phase_us[RENDER_PROF_PHASE_LAYER];
+}
+
+static uint32_t render_prof_hash(const lv_obj_t *obj) {
+    return (uint32_t)(((uintptr_t)obj >> 3) * 2654435761u) & (RENDER_PROF_MAX_OBJS - 1);
+}
+
+/**
+ * @brief 对象的统计项，没有时返回它应放入的空位(表中至少留一个空位，总能找到)
+ */
+static prof_obj_t *render_prof_slot(const lv_obj_t *obj) {
+    uint32_t i = render_prof_hash(obj);
+    while (prof.objs[i].obj != NULL && prof.objs[i].obj != obj) {
+        i = (i + 1) & (RENDER_PROF_MAX_OBJS - 1);
+    }
+    return &prof.objs[i];
+}
+
+/**
+ * @brief 查找对象的统计项，没有时新建；表满返回NULL
+ */
+static prof_obj_t *render_prof_find(lv_obj_t *obj) {
+    prof_obj_t *o = render_prof_slot(obj);
+    if (o->obj == obj) {
+        return o;
+    }
+    if (prof.stats.objs >= RENDER_PROF_MAX_OBJS - 1) {
+        return NULL;  // 留一个空位，保证查找能结束
+    }
+    o->obj = obj;
+    o->class_p = obj->class_p;
+    o->name = render_prof_lookup_name(obj);
+    prof.stats.objs++;
+    return o;
+}
+
+/**
+ * @brief LVGL删除对象时调用：删除对象的统计项，后面同一探测链上的项前移填补空位(线性探测的删除)，再删除它的名字
+ */
+static void render_prof_del_cb(lv_obj_t *obj) {
+    prof_obj_t *o = render_prof_slot(obj);
+    if (o->obj == obj) {
+        uint32_t i = o - prof.objs;
+        for (uint32_t j = (i + 1) & (RENDER_PROF_MAX_OBJS - 1); prof.objs[j].obj != NULL;
+             j = (j + 1) & (RENDER_PROF_MAX_OBJS - 1)) {
+            // 项j的散列位置不在(i, j]内时可以前移到i
+            uint32_t k = render_prof_hash(prof.objs[j].obj);
+            if (((j - k) & (RENDER_PROF_MAX_OBJS - 1)) >= ((j - i) & (RENDER_PROF_MAX_OBJS - 1))) {
+                prof.objs[i] = prof.objs[j];
+                i = j;
+            }
+        }
+        memset(&prof.objs[i], 0, sizeof(prof.objs[i]));
+        prof.stats.objs--;
+    }
+    for (size_t i = 0; i < RENDER_PROF_MAX_NAMES && prof.names[i].obj != NULL; i++) {
+        if (prof.names[i].obj == obj) {
+            memmove(&prof.names[i], &prof.names[i + 1], (RENDER_PROF_MAX_NAMES - 1 - i) * sizeof(prof.names[0]));
+            memset(&prof.names[RENDER_PROF_MAX_NAMES - 1], 0, sizeof(prof.names[0]));
+            break;
+        }
+    }
+}
+
+/**
+ * @brief LVGL在每个绘制阶段前后调用，阶段耗时记在对象上；子对象阶段嵌套在父对象的CHILDREN阶段内
+ */
+static void render_prof_cb(lv_obj_t *obj, lv_refr_phase_t phase, bool end) {
+    int64_t now = esp_timer_get_time();
+    if (!end) {
+        if (prof.depth < RENDER_PROF_MAX_DEPTH) {
+            prof_obj_t *o = render_prof_find(obj);
+            prof.stack[prof.depth].o = o;
+            prof.stack[prof.depth].start_us = now;
+            if (o != NULL && phase == LV_REFR_PHASE_MAIN) {
+                o->cur.draws++;
+            } else if (o == NULL && phase == LV_REFR_PHASE_MAIN) {
+                prof.stats.dropped++;
+            }
+        } else if (phase == LV_REFR_PHASE_MAIN) {
+            prof.stats.dropped++;
+        }
+        prof.depth++;
+        return;
+    }
+    if (prof.depth == 0) {
+        return;  // 统计中途开启，开始时不在栈中
+    }
+    prof.depth--;
+    if (prof.depth < RENDER_PROF_MAX_DEPTH && prof.stack[prof.depth].o != NULL) {
+        prof.stack[prof.depth].o->cur.phase_us[phase] += (uint32_t)(now - prof.stack[prof.depth].start_us);
+    }
+}
+
+/**
+ * @brief 混合的像素记到当前正在绘制的对象上
+ */
+static void render_prof_blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc) {
+    if (prof.enabled && prof.depth > 0 && prof.depth <= RENDER_PROF_MAX_DEPTH) {
+        prof_obj_t *o = prof.stack[prof.depth - 1].o;
+        lv_area_t area;
+        if (o != NULL && _lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area)) {
+            o->cur.px += lv_area_get_size(&area);
+        }
+    }
+    prof.orig_blend(draw_ctx, dsc);
+}
+
+/**
+ * @brief 刷新结束后把当前帧的计数转为“最近一帧”并累计，超过慢帧阈值时输出该帧最耗时的对象
+ */
+static void render_prof_refr_end(lv_disp_t *disp, void *ctx) {
+    if (!prof.enabled) {
+        return;
+    }
+    prof.depth = 0;
+
+    uint32_t frame_us = 0;
+    bool drawn = false;
+    for (size_t i = 0; i < RENDER_PROF_MAX_OBJS; i++) {
+        if (prof.objs[i].obj != NULL && prof.objs[i].cur.draws > 0) {
+            drawn = true;
+            frame_us += render_prof_self_us(&prof.objs[i].cur);
+        }
+    }
+    if (!drawn) {
+        return;
+    }
+    for (size_t i = 0; i < RENDER_PROF_MAX_OBJS; i++) {
+        prof_obj_t *o = &prof.objs[i];
+        if (o->obj == NULL) {
+            continue;
+        }
+        o->last = o->cur;
+        for (int p = 0; p < RENDER_PROF_PHASE_NUM; p++) {
+            o->total_us[p] += o->cur.phase_us[p];
+        }
+        o->total_px += o->cur.px;
+        o->total_draws += o->cur.draws;
+        memset(&o->cur, 0, sizeof(o->cur));
+    }
+    prof.stats.frames++;
+    prof.stats.last_frame_us = frame_us;
+    if (frame_us > prof.stats.max_frame_us) {
+        prof.stats.max_frame_us = frame_us;
+    }
+    if (prof.slow_frame_us > 0 && frame_us > prof.slow_frame_us) {
+        prof.stats.slow_frames++;
+        ESP_LOGW(TAG, "Slow frame: %lu us", (unsigned long)frame_us);
+        render_prof_dump(RENDER_PROF_BY_OBJ, RENDER_PROF_LAST_FRAME, RENDER_PROF_TOP_N);
+    }
+}
+
+esp_err_t render_prof_attach(lv_disp_t *disp) {
+    if (disp == NULL || disp->driver->draw_ctx == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (prof.disp != NULL) {
+        return ESP_ERR_INVALID_STATE;  // 只支持一个显示
+    }
+    esp_err_t ret = perf_monitor_add_refr_hook(disp, NULL, render_prof_refr_end, NULL);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    prof.disp = disp;
+    prof.draw_ctx = (lv_draw_sw_ctx_t *)disp->driver->draw_ctx;
+    prof.orig_blend = prof.draw_ctx->blend;
+    prof.draw_ctx->blend = render_prof_blend;
+    // 暂停统计时也要删除已删除对象的统计项和名字
+    lv_refr_set_profiler_del_cb(render_prof_del_cb);
+    render_prof_set_enabled(true);
+    ESP_LOGI(TAG, "Per-object render profiling enabled");
+    return ESP_OK;
+}
+
+void render_prof_set_enabled(bool enabled) {
+    if (prof.disp == NULL) {
+        return;
+    }
+    prof.enabled = enabled;
+    prof.depth = 0;
+    lv_refr_set_profiler_cb(enabled ? render_prof_cb : NULL);
+}
+
+esp_err_t render_prof_set_name(const lv_obj_t *obj, const char *name) {
+    for (size_t i = 0; i < RENDER_PROF_MAX_NAMES; i++) {
+        if (prof.names[i].obj == NULL || prof.names[i].obj == obj) {
+            prof.names[i].obj = obj;
+            prof.names[i].name = name;
+            for (size_t j = 0; j < RENDER_PROF_MAX_OBJS; j++) {
+                if (prof.objs[j].obj == obj) {
+                    prof.objs[j].name = name;
+                }
+            }
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+void render_prof_set_slow_frame_us(uint32_t us) {
+    prof.slow_frame_us = us;
+}
+
+static int render_prof_cmp(const void *a, const void *b) {
+    const render_prof_entry_t *x = a, *y = b;
+    if (x->self_us != y->self_us) {
+        return x->self_us < y->self_us ? 1 : -1;
+    }
+    return x->px < y->px ? 1 : (x->px > y->px ? -1 : 0);
+}
+
+/**
+ * @brief 把一个对象的统计加到分组上
+ */
+static void render_prof_add(render_prof_entry_t *e, const prof_obj_t *o, render_prof_mode_t mode) {
+    uint32_t frames = prof.stats.frames ? prof.stats.frames : 1;
+    e->objs++;
+    if (mode == RENDER_PROF_LAST_FRAME) {
+        e->draws += o->last.draws;
+        e->px += o->last.px;
+        for (int p = 0; p < RENDER_PROF_PHASE_NUM; p++) {
+            e->phase_us[p] += o->last.phase_us[p];
+        }
+    } else {
+        e->draws += o->total_draws / frames;
+        e->px += (uint32_t)(o->total_px / frames);
+        for (int p = 0; p < RENDER_PROF_PHASE_NUM; p++) {
+            e->phase_us[p] += (uint32_t)(o->total_us[p] / frames);
+        }
+    }
+    e->self_us = e->phase_us[RENDER_PROF_PHASE_MAIN] + e->phase_us[RENDER_PROF_PHASE_POST] +
+                 e->phase_us[RENDER_PROF_PHASE_LAYER];
+}
+
+/**
+ * @brief 按分组合计到prof.scratch并排序，返回分组数
+ */
+static size_t render_prof_collect(render_prof_group_t group, render_prof_mode_t mode) {
+    size_t count = 0;
+    for (size_t i = 0; i < RENDER_PROF_MAX_OBJS; i++) {
+        const prof_obj_t *o = &prof.objs[i];
+        if (o->obj == NULL || (group == RENDER_PROF_BY_NAME && o->name == NULL)) {
+            continue;
+        }
+        const char *class_name = render_prof_class_name(o->class_p);
+        size_t k = count;
+        if (group != RENDER_PROF_BY_OBJ) {
+            for (k = 0; k < count; k++) {
+                if (group == RENDER_PROF_BY_CLASS ? prof.scratch[k].class_name == class_name
+                                                  : strcmp(prof.scratch[k].name, o->name) == 0) {
+                    break;
+                }
+            }
+        }
+        render_prof_entry_t *e = &prof.scratch[k];
+        if (k == count) {
+            memset(e, 0, sizeof(*e));
+            e->obj = group == RENDER_PROF_BY_OBJ ? o->obj : NULL;
+            e->name = group == RENDER_PROF_BY_CLASS ? NULL : o->name;
+            e->class_name = class_name;
+            count++;
+        }
+        render_prof_add(e, o, mode);
+    }
+
+    // 去掉这一帧没有绘制的对象
+    size_t kept = 0;
+    for (size_t k = 0; k < count; k++) {
+        if (prof.scratch[k].draws > 0 || prof.scratch[k].self_us > 0) {
+            prof.scratch[kept++] = prof.scratch[k];
+        }
+    }
+    qsort(prof.scratch, kept, sizeof(prof.scratch[0]), render_prof_cmp);
+    return kept;
+}
+
+size_t render_prof_get_top(render_prof_group_t group, render_prof_mode_t mode, render_prof_entry_t *out, size_t n) {
+    size_t kept = render_prof_collect(group, mode);
+    if (n > kept) {
+        n = kept;
+    }
+    memcpy(out, prof.scratch, n * sizeof(*out));
+    return n;
+}
+
+void render_prof_dump(render_prof_group_t group, render_prof_mode_t mode, size_t n) {
+    static const char *const group_names[] = { "object", "class", "name" };
+    ESP_LOGI(TAG, "Top %u by %s (%s, %lu frames):", (unsigned)n, group_names[group],
+             mode == RENDER_PROF_LAST_FRAME ? "last frame" : "average", (unsigned long)prof.stats.frames);
+    size_t total = render_prof_collect(group, mode);
+    for (size_t i = 0; i < n && i < total; i++) {
+        const render_prof_entry_t *e = &prof.scratch[i];
+        ESP_LOGI(TAG, "  %-14s %-6s x%-2lu self %5lu us (main %lu post %lu layer %lu) children %5lu us "
+                 "draws %lu px %lu", e->name ? e->name : "-", e->class_name, (unsigned long)e->objs,
+                 (unsigned long)e->self_us, (unsigned long)e->phase_us[RENDER_PROF_PHASE_MAIN],
+                 (unsigned long)e->phase_us[RENDER_PROF_PHASE_POST],
+                 (unsigned long)e->phase_us[RENDER_PROF_PHASE_LAYER],
+                 (unsigned long)e->phase_us[RENDER_PROF_PHASE_CHILDREN], (unsigned long)e->draws,
+                 (unsigned long)e->px);
+    }
+}
+
+void render_prof_get_stats(render_prof_stats_t *out) {
+    *out = prof.stats;
+}
+
+void render_prof_reset(void) {
+    memset(prof.objs, 0, sizeof(prof.objs));
+    memset(&prof.stats, 0, sizeof(prof.stats));
+    prof.depth = 0;
+}
+
+#else // !LV_USE_REFR_PROFILER
+
+esp_err_t render_prof_attach(lv_disp_t *disp) {
+    ESP_LOGD(TAG, "LV_USE_REFR_PROFILER is disabled");
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void render_prof_set_enabled(bool enabled) {
+}
+
+esp_err_t render_prof_set_name(const lv_obj_t *obj, const char *name) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void render_prof_set_slow_frame_us(uint32_t us) {
+}
+
+size_t render_prof_get_top(render_prof_group_t group, render_prof_mode_t mode, render_prof_entry_t *out, size_t n) {
+    return 0;
+}
+
+void render_prof_dump(render_prof_group_t group, render_prof_mode_t mode, size_t n) {
+}
+
+void render_prof_get_stats(render_prof_stats_t *out) {
+    memset(out, 0, sizeof(*out));
+}
+
+void render_prof_reset(void) {
+}
+
+#endif // LV_USE_REFR_PROFILER
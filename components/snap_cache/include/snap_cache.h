@@ -0,0 +1,91 @@
+#ifndef SNAP_CACHE_H
+#define SNAP_CACHE_H
+// 静态控件的位图缓存：标记的对象连同子对象渲染一次到位图，之后重绘时直接贴图，
+// 不再重新绘制圆角、阴影和文字。对象或其子对象被标记为需要重绘(样式、状态、内容、子对象变化)时缓存失效；
+// 缓存总大小有上限，超出时淘汰最久未使用的位图
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+/* ========== 位图缓存配置 ========== */
+#define SNAP_CACHE_MAX_OBJS     (16)                    // 可缓存的对象数
+#define SNAP_CACHE_SETTLE_MS    (200)                   // 失效后该时间内再次绘制时直接绘制，不重建位图，避免动画期间每帧重建
+#define SNAP_CACHE_OBJ_FLAG     LV_OBJ_FLAG_USER_4      // 标记缓存对象的LVGL用户标志
+#define SNAP_CACHE_CAPS         (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)   // 位图放在PSRAM
+#define SNAP_CACHE_INTERNAL_MAX (16 * 1024)             // PSRAM分配失败时位图最多占用的内部RAM，0表示只用PSRAM
+
+// 缓存统计
+typedef struct {
+    uint32_t hits;              ///< 直接贴图的次数(每个刷新区域、每个分块各计一次)
+    uint32_t misses;            ///< 重建位图的次数
+    uint32_t bypasses;          ///< 直接绘制的次数：刚失效、位图超过预算或分配失败
+    uint32_t invalidations;     ///< 位图失效次数
+    uint32_t evictions;         ///< 超出预算被淘汰的位图数
+    uint32_t objs;              ///< 缓存的对象数
+    uint32_t bitmaps;           ///< 当前有效的位图数
+    uint32_t used_bytes;        ///< 当前位图占用
+    uint32_t peak_bytes;
+    uint32_t internal_bytes;    ///< 当前位图占用中放在内部RAM的部分(PSRAM分配失败)，不超过SNAP_CACHE_INTERNAL_MAX
+    uint32_t internal_peak_bytes;
+    uint32_t build_us;          ///< 重建位图的累计耗时
+} snap_cache_stats_t;
+
+/**
+ * @brief 接管显示的对象绘制、失效回调，并注册刷新钩子(perf_monitor_add_refr_hook)
+ * @note 需在LVGL锁内调用；只支持一个显示
+ * @param disp LVGL显示
+ * @param budget_bytes 位图总大小上限
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t snap_cache_attach(lv_disp_t *disp, size_t budget_bytes);
+
+/**
+ * @brief 开关对象的位图缓存
+ * @note 需在LVGL锁内调用。适合内容很少变化的对象；不透明且没有阴影等外扩绘制时位图为RGB565，
+ *       否则为带透明度的格式(每像素3字节)。设置了LV_OBJ_FLAG_OVERFLOW_VISIBLE的对象不缓存。
+ *       对象删除时自动移除
+ * @param obj 对象，连同所有子对象一起缓存
+ * @param enable true开启
+ * @return esp_err_t 对象数已满时返回ESP_ERR_NO_MEM
+ */
+esp_err_t snap_cache_set_obj(lv_obj_t *obj, bool enable);
+
+/**
+ * @brief 暂停或恢复缓存，暂停时所有对象照常绘制，位图保留
+ * @note 需在LVGL锁内调用
+ */
+void snap_cache_set_enabled(bool enabled);
+
+/**
+ * @brief 缓存是否开启
+ */
+bool snap_cache_is_enabled(void);
+
+/**
+ * @brief 修改位图总大小上限，超出的位图立即淘汰
+ * @note 需在LVGL锁内调用
+ */
+void snap_cache_set_budget(size_t budget_bytes);
+
+/**
+ * @brief 释放所有位图，下次绘制时重建
+ * @note 需在LVGL锁内调用
+ */
+void snap_cache_flush(void);
+
+/**
+ * @brief 获取统计(自snap_cache_attach或上次snap_cache_reset_stats起)
+ * @note 需在LVGL锁内调用
+ */
+void snap_cache_get_stats(snap_cache_stats_t *out);
+
+/**
+ * @brief 清零统计(位图占用除外)
+ * @note 需在LVGL锁内调用
+ */
+void snap_cache_reset_stats(void);
+
+#endif // SNAP_CACHE_H
@@ -0,0 +1,381 @@
+#include "snap_cache.h"
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "perf_monitor.h"
+
+static const char *TAG = "Snap Cache";
+
+// 一个缓存对象
+typedef struct {
+    lv_obj_t *obj;
+    lv_img_dsc_t img;           ///< 位图，data为NULL表示没有位图
+    uint32_t buf_size;
+    bool internal;              ///< 位图在内部RAM
+    bool valid;                 ///< 位图与对象当前内容一致
+    bool built;                 ///< 建立过位图，之后的失效才需要等待稳定
+    uint32_t inv_tick;          ///< 最近一次失效的lv_tick
+    uint32_t last_use;          ///< 最近一次贴图的序号，用于LRU淘汰
+    uint32_t last_frame;        ///< 最近一次贴图的刷新序号，当前刷新用过的位图不淘汰
+} snap_entry_t;
+
+static struct {
+    lv_disp_t *disp;
+    uint32_t frame;             ///< 刷新序号
+    bool enabled;
+    bool psram_warned;          ///< 已输出过PSRAM分配失败的日志
+    uint32_t budget;
+    uint32_t use_seq;
+    snap_entry_t entries[SNAP_CACHE_MAX_OBJS];
+    snap_cache_stats_t stats;
+} cache;
+
+static snap_entry_t *snap_cache_find(const lv_obj_t *obj) {
+    for (int i = 0; i < SNAP_CACHE_MAX_OBJS; i++) {
+        if (cache.entries[i].obj == obj) {
+            return &cache.entries[i];
+        }
+    }
+    return NULL;
+}
+
+static void snap_cache_free_bitmap(snap_entry_t *e) {
+    if (e->img.data == NULL) {
+        return;
+    }
+    lv_img_cache_invalidate_src(&e->img);
+    heap_caps_free((void *)e->img.data);
+    cache.stats.used_bytes -= e->buf_size;
+    if (e->internal) {
+        cache.stats.internal_bytes -= e->buf_size;
+    }
+    cache.stats.bitmaps -= e->valid;
+    e->img.data = NULL;
+    e->buf_size = 0;
+    e->internal = false;
+    e->valid = false;
+}
+
+/**
+ * @brief 淘汰最久未使用的位图，直到再放入size字节不超过预算
+ * @note 当前刷新已贴过的位图不淘汰，否则每帧用到的位图超过预算时会轮流淘汰、每次都重建
+ * @param keep 正在重建的对象，不淘汰
+ */
+static bool snap_cache_make_room(uint32_t size, const snap_entry_t *keep) {
+    while (cache.stats.used_bytes + size > cache.budget) {
+        snap_entry_t *lru = NULL;
+        for (int i = 0; i < SNAP_CACHE_MAX_OBJS; i++) {
+            snap_entry_t *e = &cache.entries[i];
+            if (e != keep && e->img.data != NULL && e->last_frame != cache.frame &&
+                (lru == NULL || e->last_use < lru->last_use)) {
+                lru = e;
+            }
+        }
+        if (lru == NULL) {
+            return false;
+        }
+        snap_cache_free_bitmap(lru);
+        cache.stats.evictions++;
+    }
+    return true;
+}
+
+/**
+ * @brief 对象是否完全不透明地覆盖自身区域，此时位图不需要透明度
+ */
+static bool snap_cache_is_opaque(lv_obj_t *obj) {
+    if (_lv_obj_get_ext_draw_size(obj) > 0) {
+        return false;
+    }
+    lv_cover_check_info_t info = { .res = LV_COVER_RES_COVER, .area = &obj->coords };
+    lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+    return info.res == LV_COVER_RES_COVER;
+}
+
+/**
+ * @brief 把对象连同子对象绘制到位图(同lv_snapshot_take_to_buf，不依赖LV_USE_SNAPSHOT)
+ * @note 临时显示没有draw_obj_cb，对象照常绘制
+ */
+static bool snap_cache_render(snap_entry_t *e, lv_area_t *area, lv_img_cf_t cf) {
+    lv_disp_drv_t drv;
+    lv_disp_drv_init(&drv);
+    drv.hor_res = lv_disp_get_hor_res(cache.disp);
+    drv.ver_res = lv_disp_get_ver_res(cache.disp);
+    lv_disp_drv_use_generic_set_px_cb(&drv, cf);
+
+    lv_disp_t fake_disp;
+    memset(&fake_disp, 0, sizeof(fake_disp));
+    fake_disp.driver = &drv;
+
+    lv_draw_ctx_t *draw_ctx = lv_mem_alloc(cache.disp->driver->draw_ctx_size);
+    if (draw_ctx == NULL) {
+        return false;
+    }
+    cache.disp->driver->draw_ctx_init(&drv, draw_ctx);
+    drv.draw_ctx = draw_ctx;
+    draw_ctx->clip_area = area;
+    draw_ctx->buf_area = area;
+    draw_ctx->buf = (void *)e->img.data;
+    memset((void *)e->img.data, 0, e->buf_size);
+
+    lv_disp_t *refr_ori = _lv_refr_get_disp_refreshing();
+    _lv_refr_set_disp_refreshing(&fake_disp);
+    lv_obj_redraw(draw_ctx, e->obj);
+    _lv_refr_set_disp_refreshing(refr_ori);
+
+    cache.disp->driver->draw_ctx_deinit(&drv, draw_ctx);
+    lv_mem_free(draw_ctx);
+    return true;
+}
+
+/**
+ * @brief 在PSRAM分配位图；PSRAM不足时改用内部RAM，但内部RAM上的位图合计不超过SNAP_CACHE_INTERNAL_MAX，
+ *        避免占满显示和任务需要的内部RAM
+ */
+static void *snap_cache_alloc(snap_entry_t *e, uint32_t size) {
+    void *buf = heap_caps_malloc(size, SNAP_CACHE_CAPS);
+    if (buf != NULL) {
+        return buf;
+    }
+    if (!cache.psram_warned) {
+        cache.psram_warned = true;
+        ESP_LOGW(TAG, "No PSRAM for a %lu byte bitmap, using at most %u bytes of internal RAM", (unsigned long)size,
+                 (unsigned)SNAP_CACHE_INTERNAL_MAX);
+    }
+    if (cache.stats.internal_bytes + size > SNAP_CACHE_INTERNAL_MAX) {
+        return NULL;
+    }
+    buf = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (buf != NULL) {
+        e->internal = true;
+        cache.stats.internal_bytes += size;
+        if (cache.stats.internal_bytes > cache.stats.internal_peak_bytes) {
+            cache.stats.internal_peak_bytes = cache.stats.internal_bytes;
+        }
+    }
+    return buf;
+}
+
+/**
+ * @brief 重建对象的位图，尺寸不变时复用原来的缓冲区
+ */
+static bool snap_cache_build(snap_entry_t *e, lv_area_t *area) {
+    if (lv_obj_has_flag(e->obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        return false;  // 子对象可能画到对象外面
+    }
+    int64_t t0 = esp_timer_get_time();
+    lv_img_cf_t cf = snap_cache_is_opaque(e->obj) ? LV_IMG_CF_TRUE_COLOR : LV_IMG_CF_TRUE_COLOR_ALPHA;
+    uint32_t w = lv_area_get_width(area);
+    uint32_t h = lv_area_get_height(area);
+    uint32_t size = w * h * (cf == LV_IMG_CF_TRUE_COLOR ? sizeof(lv_color_t) : LV_IMG_PX_SIZE_ALPHA_BYTE);
+    if (size > cache.budget) {
+        return false;
+    }
+
+    if (e->img.data != NULL && e->buf_size != size) {
+        snap_cache_free_bitmap(e);
+    }
+    if (e->img.data == NULL) {
+        if (!snap_cache_make_room(size, e)) {
+            return false;
+        }
+        void *buf = snap_cache_alloc(e, size);
+        if (buf == NULL) {
+            return false;
+        }
+        e->img.data = buf;
+        e->buf_size = size;
+        cache.stats.used_bytes += size;
+        if (cache.stats.used_bytes > cache.stats.peak_bytes) {
+            cache.stats.peak_bytes = cache.stats.used_bytes;
+        }
+    } else {
+        lv_img_cache_invalidate_src(&e->img);
+        cache.stats.bitmaps -= e->valid;
+    }
+
+    e->img.header.always_zero = 0;
+    e->img.header.cf = cf;
+    e->img.header.w = w;
+    e->img.header.h = h;
+    e->img.data_size = size;
+    e->valid = snap_cache_render(e, area, cf);
+    if (!e->valid) {
+        snap_cache_free_bitmap(e);
+        return false;
+    }
+    e->built = true;
+    cache.stats.bitmaps++;
+    cache.stats.build_us += (uint32_t)(esp_timer_get_time() - t0);
+    return true;
+}
+
+/**
+ * @brief LVGL绘制每个对象前调用：缓存对象直接贴图
+ */
+static bool snap_cache_draw_obj_cb(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx, lv_obj_t *obj) {
+    if (!cache.enabled || !lv_obj_has_flag(obj, SNAP_CACHE_OBJ_FLAG)) {
+        return false;
+    }
+    snap_entry_t *e = snap_cache_find(obj);
+    if (e == NULL) {
+        return false;
+    }
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+    lv_coord_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&area, ext_size, ext_size);
+    lv_area_t clip;
+    if (!_lv_area_intersect(&clip, draw_ctx->clip_area, &area)) {
+        return !lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE);  // 不在刷新区域内，没有要画的
+    }
+
+    if (!e->valid) {
+        if (e->built && lv_tick_elaps(e->inv_tick) < SNAP_CACHE_SETTLE_MS) {
+            cache.stats.bypasses++;
+            return false;
+        }
+        if (!snap_cache_build(e, &area)) {
+            cache.stats.bypasses++;
+            return false;
+        }
+        cache.stats.misses++;
+    } else {
+        cache.stats.hits++;
+    }
+    e->last_use = ++cache.use_seq;
+    e->last_frame = cache.frame;
+
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+    lv_draw_img(draw_ctx, &dsc, &area, &e->img);
+    return true;
+}
+
+/**
+ * @brief 对象的某个区域被标记为需要重绘时调用：该对象及其缓存的祖先对象位图失效
+ */
+static void snap_cache_obj_inv_cb(lv_disp_drv_t *drv, const lv_obj_t *obj) {
+    if (cache.stats.objs == 0) {
+        return;
+    }
+    for (const lv_obj_t *p = obj; p != NULL; p = lv_obj_get_parent(p)) {
+        if (!lv_obj_has_flag(p, SNAP_CACHE_OBJ_FLAG)) {
+            continue;
+        }
+        snap_entry_t *e = snap_cache_find(p);
+        if (e == NULL) {
+            continue;
+        }
+        e->inv_tick = lv_tick_get();
+        if (e->valid) {
+            e->valid = false;
+            cache.stats.bitmaps--;
+            cache.stats.invalidations++;
+        }
+    }
+}
+
+static void snap_cache_refr_start(lv_disp_t *disp, void *ctx) {
+    cache.frame++;
+}
+
+static void snap_cache_remove(snap_entry_t *e) {
+    snap_cache_free_bitmap(e);
+    lv_obj_clear_flag(e->obj, SNAP_CACHE_OBJ_FLAG);
+    memset(e, 0, sizeof(*e));
+    cache.stats.objs--;
+}
+
+/**
+ * @brief 对象删除时释放位图(事件分发中不移除事件回调)
+ */
+static void snap_cache_delete_cb(lv_event_t *e) {
+    snap_entry_t *entry = snap_cache_find(lv_event_get_target(e));
+    if (entry != NULL) {
+        snap_cache_remove(entry);
+    }
+}
+
+esp_err_t snap_cache_attach(lv_disp_t *disp, size_t budget_bytes) {
+    if (disp == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (cache.disp != NULL) {
+        return ESP_ERR_INVALID_STATE;  // 只支持一个显示
+    }
+    esp_err_t ret = perf_monitor_add_refr_hook(disp, snap_cache_refr_start, NULL, NULL);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    cache.disp = disp;
+    cache.budget = budget_bytes;
+    cache.enabled = true;
+    disp->driver->draw_obj_cb = snap_cache_draw_obj_cb;
+    disp->driver->obj_inv_cb = snap_cache_obj_inv_cb;
+    ESP_LOGI(TAG, "Bitmap cache budget %u bytes", (unsigned)budget_bytes);
+    return ESP_OK;
+}
+
+esp_err_t snap_cache_set_obj(lv_obj_t *obj, bool enable) {
+    if (cache.disp == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    snap_entry_t *e = snap_cache_find(obj);
+    if (!enable) {
+        if (e != NULL) {
+            snap_cache_remove(e);
+            lv_obj_remove_event_cb(obj, snap_cache_delete_cb);
+        }
+        return ESP_OK;
+    }
+    if (e != NULL) {
+        return ESP_OK;
+    }
+    e = snap_cache_find(NULL);
+    if (e == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    e->obj = obj;
+    cache.stats.objs++;
+    lv_obj_add_flag(obj, SNAP_CACHE_OBJ_FLAG);
+    lv_obj_add_event_cb(obj, snap_cache_delete_cb, LV_EVENT_DELETE, NULL);
+    return ESP_OK;
+}
+
+void snap_cache_set_enabled(bool enabled) {
+    cache.enabled = enabled;
+}
+
+bool snap_cache_is_enabled(void) {
+    return cache.enabled;
+}
+
+void snap_cache_set_budget(size_t budget_bytes) {
+    cache.budget = budget_bytes;
+    cache.frame++;  // 不在刷新中，所有位图都可淘汰
+    snap_cache_make_room(0, NULL);
+}
+
+void snap_cache_flush(void) {
+    for (int i = 0; i < SNAP_CACHE_MAX_OBJS; i++) {
+        snap_cache_free_bitmap(&cache.entries[i]);
+        cache.entries[i].built = false;
+    }
+}
+
+void snap_cache_get_stats(snap_cache_stats_t *out) {
+    *out = cache.stats;
+}
+
+void snap_cache_reset_stats(void) {
+    snap_cache_stats_t keep = cache.stats;
+    memset(&cache.stats, 0, sizeof(cache.stats));
+    cache.stats.objs = keep.objs;
+    cache.stats.bitmaps = keep.bitmaps;
+    cache.stats.used_bytes = keep.used_bytes;
+    cache.stats.peak_bytes = keep.used_bytes;
+    cache.stats.internal_bytes = keep.internal_bytes;
+    cache.stats.internal_peak_bytes = keep.internal_bytes;
+}
@@ -0,0 +1,129 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+// 运行时遥测：任务CPU占比、栈高水位、各类堆内存和LVGL内存
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/* ========== 遥测配置 ========== */
+#define TELEMETRY_RING_LEN          (8)     // 样本环形缓冲区长度
+#define TELEMETRY_MAX_TASKS         (20)    // 每个样本最多记录的任务数
+#define TELEMETRY_TASK_NAME_LEN     (16)    // 任务名长度(含结束符)
+#define TELEMETRY_REPORT_MAGIC      (0x544C) // 二进制报告魔数 "TL"
+#define TELEMETRY_REPORT_VERSION    (1)
+
+/**
+ * @note 任务CPU占比需要开启 CONFIG_FREERTOS_USE_TRACE_FACILITY 和
+ *       CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS(sdkconfig.defaults已开启)，
+ *       未开启时telemetry_start输出错误日志，cpu_permille恒为0
+ */
+
+// 堆内存统计(单位：字节)
+typedef struct {
+    uint32_t free;              ///< 当前空闲
+    uint32_t min_free;          ///< 历史最小空闲
+    uint32_t largest_block;     ///< 最大可分配块
+    uint32_t total;             ///< 总容量
+} telemetry_heap_t;
+
+// 堆内存区域
+typedef enum {
+    TELEMETRY_HEAP_INTERNAL,    ///< 内部RAM
+    TELEMETRY_HEAP_DMA,         ///< DMA可用内存
+    TELEMETRY_HEAP_SPIRAM,      ///< 外部PSRAM
+    TELEMETRY_HEAP_COUNT,
+} telemetry_heap_region_t;
+
+// 单个任务统计
+typedef struct {
+    char name[TELEMETRY_TASK_NAME_LEN]; ///< 任务名
+    uint16_t cpu_permille;      ///< 本采样周期内占全部核心算力的千分比
+    uint16_t stack_hwm;         ///< 栈剩余最小值(字节)
+    int8_t core;                ///< 绑定的核心，-1表示不绑定
+    uint8_t priority;           ///< 当前优先级
+} telemetry_task_t;
+
+// 一次采样
+typedef struct {
+    int64_t timestamp_us;                           ///< 采样时间
+    uint32_t seq;                                   ///< 样本序号
+    telemetry_heap_t heap[TELEMETRY_HEAP_COUNT];    ///< 各区域堆统计
+    uint32_t lv_mem_total;                          ///< LVGL内存池大小
+    uint32_t lv_mem_free;                           ///< LVGL内存池空闲
+    uint8_t lv_mem_used_pct;                        ///< LVGL内存使用率
+    uint8_t lv_mem_frag_pct;                        ///< LVGL内存碎片率
+    uint8_t task_count;                             ///< tasks中有效的任务数
+    telemetry_task_t tasks[TELEMETRY_MAX_TASKS];    ///< 任务统计
+} telemetry_sample_t;
+
+/**
+ * @brief 二进制报告输出回调
+ * @param data 报告数据
+ * @param len  报告长度
+ */
+typedef void (*telemetry_report_cb_t)(const uint8_t *data, size_t len);
+
+// 遥测配置
+typedef struct {
+    uint32_t period_ms;             ///< 采样周期
+    uint32_t report_every;          ///< 每隔多少个样本输出一次二进制报告，0表示不输出
+    telemetry_report_cb_t report_cb;///< 报告输出回调，NULL表示以十六进制行输出到控制台
+    int task_priority;              ///< 采样任务优先级
+    int task_stack;                 ///< 采样任务栈大小
+} telemetry_cfg_t;
+
+#define TELEMETRY_DEFAULT_CONFIG() \
+    {                              \
+        .period_ms = 1000,         \
+        .report_every = 5,         \
+        .report_cb = NULL,         \
+        .task_priority = 1,        \
+        .task_stack = 4096,        \
+    }
+
+/**
+ * @brief 启动遥测采样任务
+ * @param cfg 配置，NULL表示使用默认配置
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t telemetry_start(const telemetry_cfg_t *cfg);
+
+/**
+ * @brief 立即采样一次并写入环形缓冲区
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t telemetry_sample_now(void);
+
+/**
+ * @brief 获取历史样本
+ * @param age 0为最新样本，1为上一个，依此类推
+ * @param out 输出样本
+ * @return true 获取成功, false 样本不存在
+ */
+bool telemetry_get_sample(uint32_t age, telemetry_sample_t *out);
+
+/**
+ * @brief 在最新样本中按任务名查找任务统计
+ * @param name 任务名
+ * @param out  输出任务统计
+ * @return true 找到, false 未找到
+ */
+bool telemetry_find_task(const char *name, telemetry_task_t *out);
+
+/**
+ * @brief 把样本编码为紧凑的二进制报告(小端)
+ * @param sample 样本
+ * @param buf    输出缓冲区
+ * @param len    缓冲区长度
+ * @return size_t 写入的字节数，缓冲区不足返回0
+ */
+size_t telemetry_encode(const telemetry_sample_t *sample, uint8_t *buf, size_t len);
+
+/**
+ * @brief 以表格形式输出最新样本
+ */
+void telemetry_log_summary(void);
+
+#endif // TELEMETRY_H
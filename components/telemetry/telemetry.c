@@ -0,0 +1,340 @@
+#include "telemetry.h"
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+#include "lvgl.h"
+
+static const char *TAG = "Telemetry";
+
+#define TELEMETRY_REPORT_MAX_LEN    (12 + TELEMETRY_HEAP_COUNT * 12 + 6 + TELEMETRY_MAX_TASKS * 14 + 2)
+#define TELEMETRY_REPORT_NAME_LEN   (8)     // 报告中任务名截断长度
+
+static telemetry_sample_t ring[TELEMETRY_RING_LEN];   ///< 样本环形缓冲区
+static uint32_t ring_count = 0;                        ///< 已写入的样本总数
+static SemaphoreHandle_t ring_lock = NULL;             ///< 保护环形缓冲区
+static SemaphoreHandle_t sample_lock = NULL;           ///< 保护采样暂存和运行时间基准
+static telemetry_sample_t scratch;                     ///< 采样暂存
+static telemetry_cfg_t telemetry_cfg;
+
+#if configUSE_TRACE_FACILITY
+static TaskStatus_t task_status[TELEMETRY_MAX_TASKS + 4];
+#if configGENERATE_RUN_TIME_STATS
+/**
+ * @brief 上一次采样的任务运行时间，用于计算采样周期内的CPU占比
+ */
+static struct {
+    UBaseType_t number;
+    uint32_t runtime;
+} prev_runtime[TELEMETRY_MAX_TASKS + 4];
+static size_t prev_count = 0;
+static uint32_t prev_total = 0;
+#endif
+#endif
+
+static const uint32_t heap_caps_of_region[TELEMETRY_HEAP_COUNT] = {
+    [TELEMETRY_HEAP_INTERNAL] = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+    [TELEMETRY_HEAP_DMA] = MALLOC_CAP_DMA,
+    [TELEMETRY_HEAP_SPIRAM] = MALLOC_CAP_SPIRAM,
+};
+
+static void collect_heap(telemetry_sample_t *sample) {
+    for (int i = 0; i < TELEMETRY_HEAP_COUNT; i++) {
+        multi_heap_info_t info;
+        heap_caps_get_info(&info, heap_caps_of_region[i]);
+        sample->heap[i].free = info.total_free_bytes;
+        sample->heap[i].min_free = info.minimum_free_bytes;
+        sample->heap[i].largest_block = info.largest_free_block;
+        sample->heap[i].total = heap_caps_get_total_size(heap_caps_of_region[i]);
+    }
+}
+
+static void collect_lvgl(telemetry_sample_t *sample) {
+    lv_mem_monitor_t mon;
+
+    // LVGL内存池不是线程安全的，拿不到锁就跳过本次LVGL统计
+    if (!lvgl_port_lock(10)) {
+        return;
+    }
+    lv_mem_monitor(&mon);
+    lvgl_port_unlock();
+
+    sample->lv_mem_total = mon.total_size;
+    sample->lv_mem_free = mon.free_size;
+    sample->lv_mem_used_pct = mon.used_pct;
+    sample->lv_mem_frag_pct = mon.frag_pct;
+}
+
+static void collect_tasks(telemetry_sample_t *sample) {
+#if configUSE_TRACE_FACILITY
+    uint32_t total_runtime = 0;
+    UBaseType_t n = uxTaskGetSystemState(task_status, sizeof(task_status) / sizeof(task_status[0]), &total_runtime);
+    if (n == 0) {
+        ESP_LOGW(TAG, "Too many tasks for telemetry buffer");
+        return;
+    }
+    if (n > TELEMETRY_MAX_TASKS) {
+        n = TELEMETRY_MAX_TASKS;
+    }
+
+#if configGENERATE_RUN_TIME_STATS
+    // 运行时间计数是墙钟时间，多核时总算力为墙钟时间乘以核心数
+    uint64_t capacity = (uint64_t)(total_runtime - prev_total) * configNUM_CORES;
+#endif
+
+    for (UBaseType_t i = 0; i < n; i++) {
+        const TaskStatus_t *status = &task_status[i];
+        telemetry_task_t *task = &sample->tasks[i];
+
+        strlcpy(task->name, status->pcTaskName, sizeof(task->name));
+        task->stack_hwm = (uint16_t)status->usStackHighWaterMark;
+        task->priority = (uint8_t)status->uxCurrentPriority;
+        task->core = (status->xCoreID == tskNO_AFFINITY) ? -1 : (int8_t)status->xCoreID;
+        task->cpu_permille = 0;
+
+#if configGENERATE_RUN_TIME_STATS
+        for (size_t p = 0; p < prev_count; p++) {
+            if (prev_runtime[p].number == status->xTaskNumber) {
+                uint32_t delta = status->ulRunTimeCounter - prev_runtime[p].runtime;
+                if (capacity > 0) {
+                    task->cpu_permille = (uint16_t)(((uint64_t)delta * 1000) / capacity);
+                }
+                break;
+            }
+        }
+#endif
+    }
+    sample->task_count = (uint8_t)n;
+
+#if configGENERATE_RUN_TIME_STATS
+    for (UBaseType_t i = 0; i < n; i++) {
+        prev_runtime[i].number = task_status[i].xTaskNumber;
+        prev_runtime[i].runtime = task_status[i].ulRunTimeCounter;
+    }
+    prev_count = n;
+    prev_total = total_runtime;
+#endif
+#else
+    sample->task_count = 0;
+#endif
+}
+
+esp_err_t telemetry_sample_now(void) {
+    if (ring_lock == NULL || sample_lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(sample_lock, portMAX_DELAY);
+    memset(&scratch, 0, sizeof(scratch));
+    scratch.timestamp_us = esp_timer_get_time();
+    collect_heap(&scratch);
+    collect_lvgl(&scratch);
+    collect_tasks(&scratch);
+
+    xSemaphoreTake(ring_lock, portMAX_DELAY);
+    scratch.seq = ring_count;
+    ring[ring_count % TELEMETRY_RING_LEN] = scratch;
+    ring_count++;
+    xSemaphoreGive(ring_lock);
+    xSemaphoreGive(sample_lock);
+    return ESP_OK;
+}
+
+bool telemetry_get_sample(uint32_t age, telemetry_sample_t *out) {
+    if (ring_lock == NULL || out == NULL) {
+        return false;
+    }
+
+    bool found = false;
+    xSemaphoreTake(ring_lock, portMAX_DELAY);
+    if (age < ring_count && age < TELEMETRY_RING_LEN) {
+        *out = ring[(ring_count - 1 - age) % TELEMETRY_RING_LEN];
+        found = true;
+    }
+    xSemaphoreGive(ring_lock);
+    return found;
+}
+
+bool telemetry_find_task(const char *name, telemetry_task_t *out) {
+    if (ring_lock == NULL || name == NULL || out == NULL) {
+        return false;
+    }
+
+    bool found = false;
+    xSemaphoreTake(ring_lock, portMAX_DELAY);
+    if (ring_count > 0) {
+        const telemetry_sample_t *latest = &ring[(ring_count - 1) % TELEMETRY_RING_LEN];
+        for (int i = 0; i < latest->task_count; i++) {
+            if (strncmp(latest->tasks[i].name, name, TELEMETRY_TASK_NAME_LEN) == 0) {
+                *out = latest->tasks[i];
+                found = true;
+                break;
+            }
+        }
+    }
+    xSemaphoreGive(ring_lock);
+    return found;
+}
+
+static uint8_t *put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+    return p + 4;
+}
+
+/**
+ * 报告格式(小端)：
+ *   u16 magic, u8 version, u8 task_count, u32 seq, u32 timestamp_ms
+ *   heap[3]: u32 free, u32 min_free, u32 largest_block
+ *   u32 lv_mem_free, u8 lv_mem_used_pct, u8 lv_mem_frag_pct
+ *   task[n]: char name[8], u16 cpu_permille, u16 stack_hwm, i8 core, u8 priority
+ *   u16 checksum(以上所有字节之和)
+ */
+size_t telemetry_encode(const telemetry_sample_t *sample, uint8_t *buf, size_t len) {
+    size_t need = 12 + TELEMETRY_HEAP_COUNT * 12 + 6 + sample->task_count * 14 + 2;
+    if (buf == NULL || len < need) {
+        return 0;
+    }
+
+    uint8_t *p = buf;
+    p = put_u16(p, TELEMETRY_REPORT_MAGIC);
+    *p++ = TELEMETRY_REPORT_VERSION;
+    *p++ = sample->task_count;
+    p = put_u32(p, sample->seq);
+    p = put_u32(p, (uint32_t)(sample->timestamp_us / 1000));
+    for (int i = 0; i < TELEMETRY_HEAP_COUNT; i++) {
+        p = put_u32(p, sample->heap[i].free);
+        p = put_u32(p, sample->heap[i].min_free);
+        p = put_u32(p, sample->heap[i].largest_block);
+    }
+    p = put_u32(p, sample->lv_mem_free);
+    *p++ = sample->lv_mem_used_pct;
+    *p++ = sample->lv_mem_frag_pct;
+    for (int i = 0; i < sample->task_count; i++) {
+        const telemetry_task_t *task = &sample->tasks[i];
+        strncpy((char *)p, task->name, TELEMETRY_REPORT_NAME_LEN);
+        p += TELEMETRY_REPORT_NAME_LEN;
+        p = put_u16(p, task->cpu_permille);
+        p = put_u16(p, task->stack_hwm);
+        *p++ = (uint8_t)task->core;
+        *p++ = task->priority;
+    }
+
+    uint16_t sum = 0;
+    for (uint8_t *q = buf; q < p; q++) {
+        sum += *q;
+    }
+    p = put_u16(p, sum);
+    return (size_t)(p - buf);
+}
+
+/**
+ * @brief 默认报告输出：一行"TLM:"加十六进制数据
+ */
+static void telemetry_print_report(const uint8_t *data, size_t len) {
+    printf("TLM:");
+    for (size_t i = 0; i < len; i++) {
+        printf("%02x", data[i]);
+    }
+    printf("\n");
+}
+
+void telemetry_log_summary(void) {
+    static const char *region_names[TELEMETRY_HEAP_COUNT] = {"internal", "dma", "spiram"};
+    telemetry_sample_t sample;
+
+    if (!telemetry_get_sample(0, &sample)) {
+        ESP_LOGW(TAG, "No telemetry sample yet");
+        return;
+    }
+    for (int i = 0; i < TELEMETRY_HEAP_COUNT; i++) {
+        ESP_LOGI(TAG, "heap %-8s free %7lu min %7lu largest %7lu",
+                 region_names[i], (unsigned long)sample.heap[i].free,
+                 (unsigned long)sample.heap[i].min_free, (unsigned long)sample.heap[i].largest_block);
+    }
+    ESP_LOGI(TAG, "lvgl mem free %lu/%lu used %d%% frag %d%%",
+             (unsigned long)sample.lv_mem_free, (unsigned long)sample.lv_mem_total,
+             sample.lv_mem_used_pct, sample.lv_mem_frag_pct);
+    for (int i = 0; i < sample.task_count; i++) {
+        const telemetry_task_t *task = &sample.tasks[i];
+        ESP_LOGI(TAG, "task %-16s cpu %3d.%d%% stack_free %5d core %2d prio %d",
+                 task->name, task->cpu_permille / 10, task->cpu_permille % 10,
+                 task->stack_hwm, task->core, task->priority);
+    }
+}
+
+static void telemetry_task(void *pvParameter) {
+    static uint8_t report[TELEMETRY_REPORT_MAX_LEN];
+    static telemetry_sample_t sample;
+    uint32_t samples = 0;
+
+    ESP_LOGI(TAG, "Starting telemetry task, period %lu ms", (unsigned long)telemetry_cfg.period_ms);
+    TickType_t last_wake = xTaskGetTickCount();
+    while (1) {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(telemetry_cfg.period_ms));
+        if (telemetry_sample_now() != ESP_OK) {
+            continue;
+        }
+        samples++;
+        if (telemetry_cfg.report_every == 0 || (samples % telemetry_cfg.report_every) != 0) {
+            continue;
+        }
+        if (!telemetry_get_sample(0, &sample)) {
+            continue;
+        }
+        size_t len = telemetry_encode(&sample, report, sizeof(report));
+        if (len > 0) {
+            telemetry_cfg.report_cb(report, len);
+        }
+    }
+}
+
+esp_err_t telemetry_start(const telemetry_cfg_t *cfg) {
+    const telemetry_cfg_t default_cfg = TELEMETRY_DEFAULT_CONFIG();
+    telemetry_cfg = cfg ? *cfg : default_cfg;
+    if (telemetry_cfg.period_ms == 0) {
+        telemetry_cfg.period_ms = default_cfg.period_ms;
+    }
+    if (telemetry_cfg.report_cb == NULL) {
+        telemetry_cfg.report_cb = telemetry_print_report;
+    }
+
+    if (ring_lock == NULL) {
+        ring_lock = xSemaphoreCreateMutex();
+        sample_lock = xSemaphoreCreateMutex();
+        if (ring_lock == NULL || sample_lock == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+#if !configUSE_TRACE_FACILITY || !configGENERATE_RUN_TIME_STATS
+    // sdkconfig.defaults开启了两者，这里说明现有sdkconfig覆盖了默认值
+    ESP_LOGE(TAG, "CONFIG_FREERTOS_USE_TRACE_FACILITY and CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS are off: "
+                  "task CPU share will read 0 (see sdkconfig.defaults)");
+#endif
+
+    // 先采一次，建立CPU占比的基准
+    esp_err_t ret = telemetry_sample_now();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (xTaskCreate(telemetry_task, "Telemetry", telemetry_cfg.task_stack, NULL,
+                    telemetry_cfg.task_priority, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create telemetry task");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,126 @@
+#ifndef TOUCH_FILTER_H
+#define TOUCH_FILTER_H
+// 触摸坐标滤波：1€滤波去除静止时的抖动，再按测得的输入延迟沿速度方向外推，减小界面跟随手指的滞后
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_touch.h"
+
+/* ========== 触摸滤波配置 ========== */
+#define TOUCH_FILTER_MIN_CUTOFF_HZ  (1.0f)      // 静止时的截止频率，越小静止时越稳
+#define TOUCH_FILTER_BETA           (0.1f)      // 截止频率随速度(像素/秒)提高的系数，越大移动时越跟手
+#define TOUCH_FILTER_D_CUTOFF_HZ    (5.0f)      // 速度估计的截止频率
+#define TOUCH_FILTER_MAX_LEAD_MS    (40)        // 外推时间上限
+#define TOUCH_FILTER_DEFAULT_LEAD_MS (12)       // 测得输入延迟之前的外推时间；不外推时滤波的滞后使移动时的误差大于原始坐标
+#define TOUCH_FILTER_MAX_PREDICT_PX (24.0f)     // 外推距离上限
+#define TOUCH_FILTER_HYSTERESIS_PX  (0.75f)     // 滤波值离上次输出不到该距离时输出不变，消除±1像素的来回跳动
+#define TOUCH_FILTER_GAP_MS         (25)        // 两次按下的采样间隔超过该值视为新的一次按下
+#define TOUCH_FILTER_STILL_PX_S     (20.0f)     // 滤波后位置的速度低于该值视为静止，用于统计静止时的抖动
+
+// 滤波参数，可在运行时调整
+typedef struct {
+    float min_cutoff_hz;
+    float beta;
+    float d_cutoff_hz;
+    uint32_t max_lead_us;       ///< 外推时间上限，0表示不外推
+    float max_predict_px;
+    float hysteresis_px;
+} touch_filter_config_t;
+
+#define TOUCH_FILTER_DEFAULT_CONFIG()                       \
+    {                                                       \
+        .min_cutoff_hz = TOUCH_FILTER_MIN_CUTOFF_HZ,        \
+        .beta = TOUCH_FILTER_BETA,                          \
+        .d_cutoff_hz = TOUCH_FILTER_D_CUTOFF_HZ,            \
+        .max_lead_us = TOUCH_FILTER_MAX_LEAD_MS * 1000,     \
+        .max_predict_px = TOUCH_FILTER_MAX_PREDICT_PX,      \
+        .hysteresis_px = TOUCH_FILTER_HYSTERESIS_PX,        \
+    }
+
+// 滤波统计
+typedef struct {
+    uint32_t samples;           ///< 处理的按下样本数
+    uint32_t strokes;           ///< 按下次数
+    uint32_t still_samples;     ///< 静止时的样本数
+    uint32_t raw_jitter_cpx;    ///< 静止时原始坐标每个样本的平均变化(0.01像素)
+    uint32_t out_jitter_cpx;    ///< 静止时输出坐标每个样本的平均变化(0.01像素)
+    uint32_t raw_changes;       ///< 原始坐标与上一样本不同的样本数
+    uint32_t out_changes;       ///< 输出坐标与上一样本不同的样本数，每次变化都可能触发控件的VALUE_CHANGED
+    uint32_t predict_avg_cpx;   ///< 平均外推距离(0.01像素)
+    uint32_t lead_us;           ///< 当前外推时间
+} touch_filter_stats_t;
+
+// 滤波状态，x/y两轴分别滤波，截止频率按合成速度计算
+typedef struct {
+    touch_filter_config_t cfg;
+    uint32_t lead_us;
+    bool active;                ///< 当前按下已有样本
+    int64_t last_us;
+    float hat[2];               ///< 滤波后的位置
+    float dhat[2];              ///< 原始坐标的速度估计(像素/秒)，决定截止频率
+    float vhat[2];              ///< 滤波后位置的速度(像素/秒)，用于外推
+    uint16_t raw_last[2];
+    uint16_t out_last[2];
+    struct {
+        uint32_t samples;
+        uint32_t strokes;
+        uint32_t still_samples;
+        uint64_t raw_still_cpx;
+        uint64_t out_still_cpx;
+        uint32_t raw_changes;
+        uint32_t out_changes;
+        uint64_t predict_cpx;
+    } acc;
+} touch_filter_t;
+
+/**
+ * @brief 初始化滤波器，外推时间取TOUCH_FILTER_DEFAULT_LEAD_MS(不超过max_lead_us)
+ * @param f 滤波器
+ * @param config 滤波参数，NULL表示TOUCH_FILTER_DEFAULT_CONFIG
+ */
+void touch_filter_init(touch_filter_t *f, const touch_filter_config_t *config);
+
+/**
+ * @brief 结束当前按下，下一个样本重新开始滤波
+ */
+void touch_filter_reset(touch_filter_t *f);
+
+/**
+ * @brief 设置外推时间，一般取从触摸采样到界面/舵机响应的延迟
+ * @note 超过max_lead_us时取max_lead_us；可在其他任务中调用
+ */
+void touch_filter_set_lead_us(touch_filter_t *f, uint32_t lead_us);
+
+/**
+ * @brief 处理一个按下样本，x/y原地替换为滤波并外推后的坐标
+ * @note 不访问硬件，主机回放和设备上使用同一实现
+ * @param f 滤波器
+ * @param time_us 采样时间
+ * @param x 坐标，限制在[0, x_max]
+ * @param y 坐标，限制在[0, y_max]
+ */
+void touch_filter_update(touch_filter_t *f, int64_t time_us, uint16_t *x, uint16_t *y, uint16_t x_max,
+                         uint16_t y_max);
+
+/**
+ * @brief 获取统计(自touch_filter_init或上次touch_filter_reset_stats起)
+ */
+void touch_filter_get_stats(const touch_filter_t *f, touch_filter_stats_t *out);
+
+/**
+ * @brief 清零统计
+ */
+void touch_filter_reset_stats(touch_filter_t *f);
+
+/**
+ * @brief 把滤波器装到触摸驱动的process_coordinates回调上
+ * @note 占用tp->config.user_data。只处理第一个触摸点；两次回调间隔超过TOUCH_FILTER_GAP_MS
+ *       (中间有过松开)时重新开始滤波
+ * @param tp 触摸芯片句柄
+ * @param f 已初始化的滤波器，使用期间必须保持有效
+ * @return esp_err_t 返回ESP_OK表示成功，已装有回调时返回ESP_ERR_INVALID_STATE
+ */
+esp_err_t touch_filter_attach(esp_lcd_touch_handle_t tp, touch_filter_t *f);
+
+#endif // TOUCH_FILTER_H
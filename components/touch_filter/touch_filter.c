@@ -0,0 +1,165 @@
+#include "touch_filter.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_timer.h"
+
+/**
+ * @brief 一阶低通的平滑系数
+ */
+static float touch_filter_alpha(float cutoff_hz, float dt) {
+    float tau = 1.0f / (2.0f * (float)M_PI * cutoff_hz);
+    return 1.0f / (1.0f + tau / dt);
+}
+
+static float touch_filter_clamp(float v, float max) {
+    return v < 0.0f ? 0.0f : (v > max ? max : v);
+}
+
+void touch_filter_init(touch_filter_t *f, const touch_filter_config_t *config) {
+    const touch_filter_config_t def = TOUCH_FILTER_DEFAULT_CONFIG();
+    memset(f, 0, sizeof(*f));
+    f->cfg = config ? *config : def;
+    touch_filter_set_lead_us(f, TOUCH_FILTER_DEFAULT_LEAD_MS * 1000);
+}
+
+void touch_filter_reset(touch_filter_t *f) {
+    f->active = false;
+}
+
+void touch_filter_set_lead_us(touch_filter_t *f, uint32_t lead_us) {
+    if (lead_us > f->cfg.max_lead_us) {
+        lead_us = f->cfg.max_lead_us;
+    }
+    __atomic_store_n(&f->lead_us, lead_us, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 按下后的第一个样本：原样输出，作为滤波初值
+ */
+static void touch_filter_start(touch_filter_t *f, int64_t time_us, const uint16_t raw[2]) {
+    for (int i = 0; i < 2; i++) {
+        f->hat[i] = raw[i];
+        f->dhat[i] = f->vhat[i] = 0.0f;
+        f->raw_last[i] = f->out_last[i] = raw[i];
+    }
+    f->last_us = time_us;
+    f->active = true;
+    f->acc.strokes++;
+}
+
+/**
+ * @brief 1€滤波：速度估计先低通，截止频率随速度线性提高；静止时强平滑，移动时滞后小
+ * @note 外推量为滤波后位置的速度乘以外推时间，长度限制在max_predict_px以内
+ */
+void touch_filter_update(touch_filter_t *f, int64_t time_us, uint16_t *x, uint16_t *y, uint16_t x_max,
+                         uint16_t y_max) {
+    const uint16_t raw[2] = { *x, *y };
+    const float max[2] = { x_max, y_max };
+    f->acc.samples++;
+    if (f->active && time_us - f->last_us > TOUCH_FILTER_GAP_MS * 1000) {
+        f->active = false;
+    }
+    if (!f->active) {
+        touch_filter_start(f, time_us, raw);
+        return;
+    }
+
+    float dt = (float)(time_us - f->last_us) / 1e6f;
+    if (dt <= 0.0f) {
+        dt = 1e-3f;
+    }
+    f->last_us = time_us;
+
+    float a_d = touch_filter_alpha(f->cfg.d_cutoff_hz, dt);
+    for (int i = 0; i < 2; i++) {
+        float d = (raw[i] - f->hat[i]) / dt;
+        f->dhat[i] += a_d * (d - f->dhat[i]);
+    }
+    float speed = sqrtf(f->dhat[0] * f->dhat[0] + f->dhat[1] * f->dhat[1]);
+    float a = touch_filter_alpha(f->cfg.min_cutoff_hz + f->cfg.beta * speed, dt);
+
+    // 外推用滤波后位置的速度：静止时滤波后位置几乎不动，外推不会放大噪声
+    float lead = (float)__atomic_load_n(&f->lead_us, __ATOMIC_RELAXED) / 1e6f;
+    float hat_prev[2] = { f->hat[0], f->hat[1] };
+    for (int i = 0; i < 2; i++) {
+        f->hat[i] += a * (raw[i] - f->hat[i]);
+        f->vhat[i] += a_d * ((f->hat[i] - hat_prev[i]) / dt - f->vhat[i]);
+    }
+    float vspeed = sqrtf(f->vhat[0] * f->vhat[0] + f->vhat[1] * f->vhat[1]);
+    float shift = vspeed * lead;
+    float scale = shift > f->cfg.max_predict_px ? f->cfg.max_predict_px / shift : 1.0f;
+
+    bool still = vspeed < TOUCH_FILTER_STILL_PX_S;
+    bool raw_changed = false, out_changed = false;
+    uint16_t out[2];
+    for (int i = 0; i < 2; i++) {
+        float target = touch_filter_clamp(f->hat[i] + f->vhat[i] * lead * scale, max[i]);
+        if (fabsf(target - f->out_last[i]) < f->cfg.hysteresis_px) {
+            out[i] = f->out_last[i];
+        } else {
+            out[i] = (uint16_t)lroundf(target);
+        }
+
+        if (still) {
+            f->acc.raw_still_cpx += (uint32_t)abs((int)raw[i] - f->raw_last[i]) * 100;
+            f->acc.out_still_cpx += (uint32_t)abs((int)out[i] - f->out_last[i]) * 100;
+        }
+        raw_changed |= raw[i] != f->raw_last[i];
+        out_changed |= out[i] != f->out_last[i];
+        f->raw_last[i] = raw[i];
+        f->out_last[i] = out[i];
+    }
+    f->acc.still_samples += still;
+    f->acc.raw_changes += raw_changed;
+    f->acc.out_changes += out_changed;
+    f->acc.predict_cpx += (uint64_t)(shift * scale * 100.0f);
+
+    *x = out[0];
+    *y = out[1];
+}
+
+void touch_filter_get_stats(const touch_filter_t *f, touch_filter_stats_t *out) {
+    memset(out, 0, sizeof(*out));
+    out->samples = f->acc.samples;
+    out->strokes = f->acc.strokes;
+    out->still_samples = f->acc.still_samples;
+    out->raw_changes = f->acc.raw_changes;
+    out->out_changes = f->acc.out_changes;
+    out->lead_us = __atomic_load_n(&f->lead_us, __ATOMIC_RELAXED);
+    if (f->acc.still_samples > 0) {
+        out->raw_jitter_cpx = (uint32_t)(f->acc.raw_still_cpx / f->acc.still_samples);
+        out->out_jitter_cpx = (uint32_t)(f->acc.out_still_cpx / f->acc.still_samples);
+    }
+    if (f->acc.samples > f->acc.strokes) {
+        out->predict_avg_cpx = (uint32_t)(f->acc.predict_cpx / (f->acc.samples - f->acc.strokes));
+    }
+}
+
+void touch_filter_reset_stats(touch_filter_t *f) {
+    memset(&f->acc, 0, sizeof(f->acc));
+}
+
+/****************    esp_lcd_touch回调 ↓   *************************/
+
+static void touch_filter_process_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y,
+                                             uint16_t *strength, uint8_t *point_num, uint8_t max_point_num) {
+    if (*point_num == 0) {
+        return;
+    }
+    // 回调在读取触摸芯片之后调用，取当前时间作为采样时间
+    touch_filter_update(tp->config.user_data, esp_timer_get_time(), &x[0], &y[0], tp->config.x_max,
+                        tp->config.y_max);
+}
+
+esp_err_t touch_filter_attach(esp_lcd_touch_handle_t tp, touch_filter_t *f) {
+    if (tp == NULL || f == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (tp->config.process_coordinates != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    tp->config.user_data = f;
+    tp->config.process_coordinates = touch_filter_process_coordinates;
+    return ESP_OK;
+}
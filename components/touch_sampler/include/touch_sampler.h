@@ -0,0 +1,67 @@
+#ifndef TOUCH_SAMPLER_H
+#define TOUCH_SAMPLER_H
+// 触摸采样：独立任务读取触摸芯片，把带时间戳的样本写入无锁环形缓冲区，LVGL的读取回调只从缓冲区取样本
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_touch.h"
+#include "lvgl.h"
+
+/* ========== 触摸采样配置 ========== */
+#define TOUCH_SAMPLER_TASK_PRIORITY (5)     // 高于LVGL任务，按下时按固定周期采样
+#define TOUCH_SAMPLER_TASK_STACK    (3072)
+#define TOUCH_SAMPLER_RING_SIZE     (16)    // 环形缓冲区样本数，必须是2的幂
+#define TOUCH_SAMPLER_ACTIVE_MS     (10)    // 按下时的采样周期
+#define TOUCH_SAMPLER_IDLE_MS       (50)    // 没有INT引脚时，松开后采样周期逐次加倍到该值
+
+// 一个触摸样本
+typedef struct {
+    int64_t time_us;        ///< 读取触摸芯片前的时间(esp_timer)
+    uint16_t x;             ///< 界面坐标(已按触摸配置镜像/交换)
+    uint16_t y;
+    bool pressed;
+} touch_sample_t;
+
+// 触摸采样统计
+typedef struct {
+    uint32_t reads;         ///< 读取触摸芯片的次数
+    uint32_t samples;       ///< 写入环形缓冲区的样本数
+    uint32_t dropped;       ///< 缓冲区满、LVGL来不及取走而丢弃的次数
+    uint32_t interrupts;    ///< INT中断次数
+    uint32_t i2c_us;        ///< 读取触摸芯片累计占用的时间
+    uint64_t elapsed_us;    ///< 统计时长
+    uint32_t read_hz;       ///< 平均每秒读取次数
+    uint32_t sample_hz;     ///< 平均每秒样本数
+    uint32_t i2c_us_per_s;  ///< 平均每秒占用I2C的时间
+    uint16_t period_ms;     ///< 当前采样周期，0表示等待INT中断
+} touch_sampler_stats_t;
+
+/**
+ * @brief 创建采样任务并接管输入设备的读取回调
+ * @note 需在LVGL锁内、lvgl_port_add_touch之后调用。触摸配置了INT引脚时注册中断回调，
+ *       松开后任务阻塞等待中断；否则按TOUCH_SAMPLER_ACTIVE_MS~TOUCH_SAMPLER_IDLE_MS自适应轮询。
+ *       松开且缓冲区为空时暂停LVGL的读取定时器，新样本到来时再恢复并唤醒LVGL任务
+ * @param indev lvgl_port_add_touch返回的输入设备
+ * @param tp 触摸芯片句柄
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t touch_sampler_attach(lv_indev_t *indev, esp_lcd_touch_handle_t tp);
+
+/**
+ * @brief LVGL最近一次取走的按下样本的采样时间，没有时返回0
+ * @note 供perf_monitor统计从触摸采样开始的输入延迟
+ */
+int64_t touch_sampler_last_press_us(void);
+
+/**
+ * @brief 获取统计(自touch_sampler_attach或上次touch_sampler_reset_stats起)
+ */
+void touch_sampler_get_stats(touch_sampler_stats_t *out);
+
+/**
+ * @brief 清零统计
+ */
+void touch_sampler_reset_stats(void);
+
+#endif // TOUCH_SAMPLER_H
@@ -0,0 +1,210 @@
+#include "touch_sampler.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "driver/gpio.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+
+static const char *TAG = "Touch Sampler";
+
+#define RING_MASK   (TOUCH_SAMPLER_RING_SIZE - 1)
+
+_Static_assert((TOUCH_SAMPLER_RING_SIZE & RING_MASK) == 0, "TOUCH_SAMPLER_RING_SIZE must be a power of 2");
+
+/**
+ * @brief 触摸采样状态
+ * @note 环形缓冲区单生产者(采样任务)单消费者(LVGL读取回调)：head只由采样任务写，tail只由LVGL任务写
+ */
+static struct {
+    lv_indev_t *indev;
+    esp_lcd_touch_handle_t tp;
+    TaskHandle_t task;
+    bool use_int;                           ///< 触摸芯片接了INT引脚
+    touch_sample_t ring[TOUCH_SAMPLER_RING_SIZE];
+    uint32_t head;
+    uint32_t tail;
+    bool reader_paused;                     ///< LVGL的读取定时器已暂停，新样本需要恢复它
+    touch_sample_t last;                    ///< LVGL最近取走的样本，缓冲区为空时重复上报
+    int64_t last_press_us;
+    uint16_t period_ms;
+    volatile uint32_t interrupts;
+    touch_sampler_stats_t stats;
+    int64_t stats_start_us;
+} ts;
+
+static bool ring_push(const touch_sample_t *sample) {
+    uint32_t head = ts.head;
+    if (head - __atomic_load_n(&ts.tail, __ATOMIC_ACQUIRE) >= TOUCH_SAMPLER_RING_SIZE) {
+        return false;
+    }
+    ts.ring[head & RING_MASK] = *sample;
+    __atomic_store_n(&ts.head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static bool ring_pop(touch_sample_t *sample) {
+    uint32_t tail = ts.tail;
+    if (tail == __atomic_load_n(&ts.head, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    *sample = ts.ring[tail & RING_MASK];
+    __atomic_store_n(&ts.tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static bool ring_empty(void) {
+    return __atomic_load_n(&ts.tail, __ATOMIC_ACQUIRE) == __atomic_load_n(&ts.head, __ATOMIC_ACQUIRE);
+}
+
+static void IRAM_ATTR touch_sampler_isr(esp_lcd_touch_handle_t tp) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    ts.interrupts++;
+    vTaskNotifyGiveFromISR(ts.task, &higher_priority_task_woken);
+    if (higher_priority_task_woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+/**
+ * @brief 读取一次触摸芯片，统计占用I2C的时间
+ */
+static void touch_sampler_read(touch_sample_t *sample) {
+    uint16_t x = 0, y = 0;
+    uint8_t cnt = 0;
+    sample->time_us = esp_timer_get_time();
+    esp_lcd_touch_read_data(ts.tp);
+    sample->pressed = esp_lcd_touch_get_coordinates(ts.tp, &x, &y, NULL, &cnt, 1) && cnt > 0;
+    sample->x = x;
+    sample->y = y;
+    ts.stats.i2c_us += (uint32_t)(esp_timer_get_time() - sample->time_us);
+    ts.stats.reads++;
+}
+
+/**
+ * @brief 让LVGL的读取定时器立即运行(已暂停时先恢复)，释放LVGL锁时唤醒LVGL任务
+ * @note 按下/松开时总是立即读取；按住移动时读取定时器按采样周期运行，不再逐个样本唤醒
+ */
+static void touch_sampler_kick_reader(bool edge) {
+    if (!__atomic_exchange_n(&ts.reader_paused, false, __ATOMIC_ACQ_REL) && !edge) {
+        return;
+    }
+    lvgl_port_lock(0);
+    lv_timer_resume(ts.indev->driver->read_timer);
+    lv_timer_ready(ts.indev->driver->read_timer);
+    lvgl_port_unlock();
+}
+
+/**
+ * @brief 采样任务：按下时每个周期写入一个样本，松开时只写入状态变化
+ * @note 写入失败时不更新已写入的状态，松开样本会在下个周期重试，不会丢失
+ */
+static void touch_sampler_task(void *arg) {
+    bool pushed_pressed = false;
+    TickType_t wait = pdMS_TO_TICKS(ts.period_ms);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, wait);
+
+        touch_sample_t sample;
+        touch_sampler_read(&sample);
+        if (sample.pressed || sample.pressed != pushed_pressed) {
+            if (ring_push(&sample)) {
+                bool edge = sample.pressed != pushed_pressed;
+                pushed_pressed = sample.pressed;
+                ts.stats.samples++;
+                touch_sampler_kick_reader(edge);
+            } else {
+                ts.stats.dropped++;
+            }
+        }
+
+        // 按下时固定周期；松开后有INT就等中断，没有就逐次加倍轮询周期
+        if (sample.pressed || pushed_pressed) {
+            ts.period_ms = TOUCH_SAMPLER_ACTIVE_MS;
+        } else if (ts.use_int) {
+            ts.period_ms = 0;
+        } else if (ts.period_ms < TOUCH_SAMPLER_IDLE_MS) {
+            ts.period_ms = ts.period_ms * 2 < TOUCH_SAMPLER_IDLE_MS ? ts.period_ms * 2 : TOUCH_SAMPLER_IDLE_MS;
+        }
+        wait = ts.period_ms ? pdMS_TO_TICKS(ts.period_ms) : portMAX_DELAY;
+    }
+}
+
+/**
+ * @brief LVGL读取回调：每次取一个样本，缓冲区里还有样本时让LVGL继续读取
+ * @note 松开、缓冲区为空且没有滚动惯性时暂停读取定时器。先置标志再检查缓冲区，
+ *       与采样任务先写样本再检查标志配合，不会漏掉刚写入的样本
+ */
+static void touch_sampler_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
+    touch_sample_t sample;
+    if (ring_pop(&sample)) {
+        ts.last = sample;
+        if (sample.pressed) {
+            ts.last_press_us = sample.time_us;
+        }
+        data->continue_reading = !ring_empty();
+    } else if (!ts.last.pressed && ts.indev->proc.types.pointer.scroll_obj == NULL) {
+        __atomic_store_n(&ts.reader_paused, true, __ATOMIC_SEQ_CST);
+        if (ring_empty()) {
+            lv_timer_pause(drv->read_timer);
+        } else {
+            __atomic_store_n(&ts.reader_paused, false, __ATOMIC_SEQ_CST);
+        }
+    }
+    data->point.x = ts.last.x;
+    data->point.y = ts.last.y;
+    data->state = ts.last.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+esp_err_t touch_sampler_attach(lv_indev_t *indev, esp_lcd_touch_handle_t tp) {
+    if (indev == NULL || tp == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (ts.indev != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    ts.indev = indev;
+    ts.tp = tp;
+    ts.period_ms = TOUCH_SAMPLER_ACTIVE_MS;
+    ts.stats_start_us = esp_timer_get_time();
+    if (xTaskCreate(touch_sampler_task, "touch_sampler", TOUCH_SAMPLER_TASK_STACK, NULL,
+                    TOUCH_SAMPLER_TASK_PRIORITY, &ts.task) != pdPASS) {
+        ts.indev = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    // 取代esp_lvgl_port注册的中断回调，由采样任务读取后再唤醒LVGL；
+    // 触摸驱动只把INT配置成输入，这里按有效电平设置边沿触发
+    if (tp->config.int_gpio_num != GPIO_NUM_NC) {
+        gpio_set_intr_type(tp->config.int_gpio_num, tp->config.levels.interrupt ? GPIO_INTR_POSEDGE : GPIO_INTR_NEGEDGE);
+        ts.use_int = esp_lcd_touch_register_interrupt_callback(tp, touch_sampler_isr) == ESP_OK;
+    }
+    indev->driver->read_cb = touch_sampler_read_cb;
+    // 读取定时器只在按住时运行，周期与采样周期一致，样本在缓冲区里最多停留一个周期
+    lv_timer_set_period(indev->driver->read_timer, TOUCH_SAMPLER_ACTIVE_MS);
+    ESP_LOGI(TAG, "Touch sampling %s", ts.use_int ? "on INT interrupt" : "by adaptive polling");
+    return ESP_OK;
+}
+
+int64_t touch_sampler_last_press_us(void) {
+    return ts.last_press_us;
+}
+
+void touch_sampler_get_stats(touch_sampler_stats_t *out) {
+    *out = ts.stats;
+    out->interrupts = ts.interrupts;
+    out->period_ms = ts.period_ms;
+    out->elapsed_us = (uint64_t)(esp_timer_get_time() - ts.stats_start_us);
+    if (out->elapsed_us > 0) {
+        out->read_hz = (uint32_t)((uint64_t)out->reads * 1000000 / out->elapsed_us);
+        out->sample_hz = (uint32_t)((uint64_t)out->samples * 1000000 / out->elapsed_us);
+        out->i2c_us_per_s = (uint32_t)((uint64_t)out->i2c_us * 1000000 / out->elapsed_us);
+    }
+}
+
+void touch_sampler_reset_stats(void) {
+    memset(&ts.stats, 0, sizeof(ts.stats));
+    ts.interrupts = 0;
+    ts.stats_start_us = esp_timer_get_time();
+}
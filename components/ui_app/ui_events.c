@@ -5,13 +5,14 @@
 
 #include "ui.h"
 #include "ui_interface.h"
+#include "num_label.h"
 #include <stdio.h>
 
 void zeroDegreeClick(lv_event_t * e)
 {
 	// 发送消息到逻辑层设置舵机角度
 	if (ui_servo_set_angle(0)) {
-		lv_label_set_text_fmt(ui_angleValue, "%d °", 0);
+		num_label_set_value(ui_angleValue, 0);
 		lv_slider_set_value(ui_angleSlider, 0, LV_ANIM_ON);
 	} else {
 		printf("Failed to set servo angle: %d\n", 0);
@@ -23,7 +24,7 @@ void fortyFiveDegreesClick(lv_event_t * e)
 {
 	// 发送消息到逻辑层设置舵机角度
 	if (ui_servo_set_angle(45)) {
-		lv_label_set_text_fmt(ui_angleValue, "%d °", 45);
+		num_label_set_value(ui_angleValue, 45);
 		lv_slider_set_value(ui_angleSlider, 45, LV_ANIM_ON);
 	} else {
 		printf("Failed to set servo angle: %d\n", 45);
@@ -35,7 +36,7 @@ void ninetyDegreesClick(lv_event_t * e)
 {
 	// 发送消息到逻辑层设置舵机角度
 	if (ui_servo_set_angle(90)) {
-		lv_label_set_text_fmt(ui_angleValue, "%d °", 90);
+		num_label_set_value(ui_angleValue, 90);
 		lv_slider_set_value(ui_angleSlider, 90, LV_ANIM_ON);
 	} else {
 		printf("Failed to set servo angle: %d\n", 90);
@@ -47,7 +48,7 @@ void oneHundredAndEightyDegreesClick(lv_event_t * e)
 {
 	// 发送消息到逻辑层设置舵机角度
 	if (ui_servo_set_angle(180)) {
-		lv_label_set_text_fmt(ui_angleValue, "%d °", 180);
+		num_label_set_value(ui_angleValue, 180);
 		lv_slider_set_value(ui_angleSlider, 180, LV_ANIM_ON);
 	} else {
 		printf("Failed to set servo angle: %d\n", 180);
@@ -63,7 +64,7 @@ void SliderChange(lv_event_t * e)
 	
 	// 发送消息到逻辑层设置舵机角度
 	if (ui_servo_set_angle(angle)) {
-		lv_label_set_text_fmt(ui_angleValue, "%d °", angle);
+		num_label_set_value(ui_angleValue, angle);
 	} else {
 		printf("Failed to set servo angle: %d\n", angle);
 	}
@@ -0,0 +1,13 @@
+#ifndef UI_FONT_H
+#define UI_FONT_H
+// 按界面用到的字符裁剪的Montserrat字体，构建时由tools/font_subset.py从LVGL内置字体生成。
+// 依赖ui_font的组件里lv_font_montserrat_12/14/20会被重定向到这里的字体，一般不需要直接引用；
+// 界面新增文字后重新构建即可，只有新增了显示文字的源文件时才需要修改ui_font.cmake的扫描列表
+
+#include "lvgl.h"
+
+LV_FONT_DECLARE(ui_font_montserrat_12)
+LV_FONT_DECLARE(ui_font_montserrat_14)
+LV_FONT_DECLARE(ui_font_montserrat_20)
+
+#endif // UI_FONT_H
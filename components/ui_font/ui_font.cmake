@@ -0,0 +1,57 @@
+# 构建时按界面用到的字符裁剪Montserrat字体(tools/font_subset.py)，设备和主机构建共用。
+# 引用lv_font_montserrat_xx的源码不用修改：依赖ui_font的目标通过UI_FONT_REMAP把它们重定向到子集字体，
+# LVGL的默认字体也改为子集字体，原字体不再被引用，链接时丢弃
+
+get_filename_component(UI_FONT_REPO_ROOT "${CMAKE_CURRENT_LIST_DIR}/../.." ABSOLUTE)
+
+# 裁剪的字号，需在LVGL配置中启用对应的LV_FONT_MONTSERRAT_xx
+set(UI_FONT_SIZES 12 14 20)
+# 默认字体(主题、未设置字体的控件)
+set(UI_FONT_DEFAULT_SIZE 14)
+
+# 扫描字符串的源文件：界面和会在屏幕上显示文字的组件；新增显示文字的源文件需加到这里
+file(GLOB UI_FONT_SCAN_SRCS CONFIGURE_DEPENDS
+    "${UI_FONT_REPO_ROOT}/components/ui_app/*.c"
+    "${UI_FONT_REPO_ROOT}/components/ui_app/screens/*.c"
+    "${UI_FONT_REPO_ROOT}/components/ui_app/components/*.c")
+list(APPEND UI_FONT_SCAN_SRCS
+    "${UI_FONT_REPO_ROOT}/main/main_update.c"
+    "${UI_FONT_REPO_ROOT}/components/perf_monitor/perf_overlay.c"
+    "${UI_FONT_REPO_ROOT}/components/disp_buf/disp_buf_bench.c")
+
+set(UI_FONT_REMAP "")
+foreach(size ${UI_FONT_SIZES})
+    list(APPEND UI_FONT_REMAP "lv_font_montserrat_${size}=ui_font_montserrat_${size}")
+endforeach()
+set(UI_FONT_LVGL_DEFS
+    "LV_FONT_DEFAULT=&ui_font_montserrat_${UI_FONT_DEFAULT_SIZE}"
+    "LV_FONT_CUSTOM_DECLARE=LV_FONT_DECLARE(ui_font_montserrat_${UI_FONT_DEFAULT_SIZE})")
+
+# 子集字体源文件路径
+function(ui_font_outputs out_dir srcs_var)
+    set(srcs "")
+    foreach(size ${UI_FONT_SIZES})
+        list(APPEND srcs "${out_dir}/ui_font_montserrat_${size}.c")
+    endforeach()
+    set(${srcs_var} ${srcs} PARENT_SCOPE)
+endfunction()
+
+# 添加生成子集字体和${out_dir}/ui_font_letters.h的命令，需在使用这些源文件的目标所在目录调用
+function(ui_font_generate python lvgl_dir out_dir)
+    ui_font_outputs("${out_dir}" srcs)
+    set(font_args "")
+    set(font_deps "")
+    foreach(size ${UI_FONT_SIZES})
+        list(APPEND font_args --font "${lvgl_dir}/src/font/lv_font_montserrat_${size}.c:ui_font_montserrat_${size}")
+        list(APPEND font_deps "${lvgl_dir}/src/font/lv_font_montserrat_${size}.c")
+    endforeach()
+    set(tool "${UI_FONT_REPO_ROOT}/tools/font_subset.py")
+    add_custom_command(
+        OUTPUT ${srcs} "${out_dir}/ui_font_letters.h"
+        COMMAND ${python} ${tool} -o "${out_dir}" --letters "${out_dir}/ui_font_letters.h"
+                ${font_args} ${UI_FONT_SCAN_SRCS}
+        DEPENDS ${tool} ${font_deps} ${UI_FONT_SCAN_SRCS} "${lvgl_dir}/src/font/lv_symbol_def.h"
+        COMMENT "Generating UI font subsets"
+        VERBATIM)
+    set_source_files_properties(${srcs} "${out_dir}/ui_font_letters.h" PROPERTIES GENERATED TRUE)
+endfunction()
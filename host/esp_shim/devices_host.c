@@ -0,0 +1,179 @@
+// 主机上的I2C从设备模型：PCA9557 IO扩展芯片和FT5x06触摸芯片，按寄存器行为模拟
+
+#include <pthread.h>
+#include <string.h>
+#include "esp_log.h"
+#include "host_sim.h"
+
+static const char *TAG = "host_devices";
+
+/****************    PCA9557 ↓   *************************/
+
+#define PCA9557_REG_INPUT       (0x00)
+#define PCA9557_REG_OUTPUT      (0x01)
+#define PCA9557_REG_POLARITY    (0x02)
+#define PCA9557_REG_CONFIG      (0x03)
+
+static struct {
+    uint8_t regs[4];            ///< 上电默认值：输出0x00、极性反转0xF0、全部为输入
+    uint8_t pointer;            ///< 寄存器指针，读写后不自动递增
+    pthread_mutex_t lock;
+} pca9557 = {
+    .regs = { 0xFF, 0x00, 0xF0, 0xFF },
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+/**
+ * @brief 输入寄存器：输出引脚读回输出值，输入引脚上拉为1，再按极性寄存器取反
+ */
+static uint8_t pca9557_input_value(void) {
+    uint8_t config = pca9557.regs[PCA9557_REG_CONFIG];
+    uint8_t pins = (uint8_t)((pca9557.regs[PCA9557_REG_OUTPUT] & ~config) | config);
+    return pins ^ pca9557.regs[PCA9557_REG_POLARITY];
+}
+
+static esp_err_t pca9557_write(void *ctx, const uint8_t *data, size_t len) {
+    (void)ctx;
+    if (data[0] > PCA9557_REG_CONFIG) {
+        return ESP_FAIL;
+    }
+    pthread_mutex_lock(&pca9557.lock);
+    pca9557.pointer = data[0];
+    // 后续字节都写入同一个寄存器，最后一个生效
+    for (size_t i = 1; i < len; i++) {
+        if (pca9557.pointer != PCA9557_REG_INPUT) {
+            pca9557.regs[pca9557.pointer] = data[i];
+        }
+    }
+    pthread_mutex_unlock(&pca9557.lock);
+    return ESP_OK;
+}
+
+static esp_err_t pca9557_read(void *ctx, uint8_t *data, size_t len) {
+    (void)ctx;
+    pthread_mutex_lock(&pca9557.lock);
+    uint8_t value = pca9557.pointer == PCA9557_REG_INPUT ? pca9557_input_value() : pca9557.regs[pca9557.pointer];
+    memset(data, value, len);
+    pthread_mutex_unlock(&pca9557.lock);
+    return ESP_OK;
+}
+
+esp_err_t host_pca9557_attach(i2c_port_t port, uint8_t addr) {
+    const host_i2c_device_t dev = {
+        .write = pca9557_write,
+        .read = pca9557_read,
+    };
+    return host_i2c_attach_device(port, addr, &dev);
+}
+
+uint8_t host_pca9557_get_output(void) {
+    pthread_mutex_lock(&pca9557.lock);
+    uint8_t value = pca9557.regs[PCA9557_REG_OUTPUT];
+    pthread_mutex_unlock(&pca9557.lock);
+    return value;
+}
+
+void host_pca9557_power_cycle(void) {
+    static const uint8_t defaults[4] = { 0xFF, 0x00, 0xF0, 0xFF };
+    pthread_mutex_lock(&pca9557.lock);
+    memcpy(pca9557.regs, defaults, sizeof(defaults));
+    pca9557.pointer = 0;
+    pthread_mutex_unlock(&pca9557.lock);
+}
+
+/****************    FT5x06 ↓   *************************/
+
+#define FT5x06_REG_TOUCH_POINTS (0x02)
+#define FT5x06_REG_TOUCH1       (0x03)
+#define FT5x06_POINT_STRIDE     (6)
+#define FT5x06_MAX_POINTS       (5)
+#define FT5x06_EVENT_DOWN       (0x00)
+#define FT5x06_EVENT_UP         (0x01)
+#define FT5x06_EVENT_CONTACT    (0x02)
+
+static struct {
+    uint8_t regs[256];
+    uint8_t pointer;            ///< 寄存器指针，连续读写时自动递增
+    gpio_num_t int_gpio;
+    pthread_mutex_t lock;
+} ft5x06 = {
+    .int_gpio = GPIO_NUM_NC,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static esp_err_t ft5x06_write(void *ctx, const uint8_t *data, size_t len) {
+    (void)ctx;
+    pthread_mutex_lock(&ft5x06.lock);
+    ft5x06.pointer = data[0];
+    for (size_t i = 1; i < len; i++) {
+        ft5x06.regs[ft5x06.pointer++] = data[i];
+    }
+    pthread_mutex_unlock(&ft5x06.lock);
+    return ESP_OK;
+}
+
+static esp_err_t ft5x06_read(void *ctx, uint8_t *data, size_t len) {
+    (void)ctx;
+    pthread_mutex_lock(&ft5x06.lock);
+    for (size_t i = 0; i < len; i++) {
+        data[i] = ft5x06.regs[ft5x06.pointer++];
+    }
+    pthread_mutex_unlock(&ft5x06.lock);
+    return ESP_OK;
+}
+
+esp_err_t host_ft5x06_attach(i2c_port_t port, uint8_t addr, gpio_num_t int_gpio) {
+    const host_i2c_device_t dev = {
+        .write = ft5x06_write,
+        .read = ft5x06_read,
+    };
+    ft5x06.int_gpio = int_gpio;
+    ft5x06.regs[0xA3] = 0x55;   // 芯片ID(FT5x06)
+    ft5x06.regs[0xA6] = 0x01;   // 固件版本
+    if (int_gpio != GPIO_NUM_NC) {
+        host_gpio_set_input(int_gpio, 1);
+    }
+    return host_i2c_attach_device(port, addr, &dev);
+}
+
+void host_ft5x06_set_points(int points, const uint16_t *x, const uint16_t *y) {
+    if (points < 0) {
+        points = 0;
+    } else if (points > FT5x06_MAX_POINTS) {
+        ESP_LOGW(TAG, "FT5x06 supports %d points, %d requested", FT5x06_MAX_POINTS, points);
+        points = FT5x06_MAX_POINTS;
+    }
+
+    pthread_mutex_lock(&ft5x06.lock);
+    int prev_points = ft5x06.regs[FT5x06_REG_TOUCH_POINTS];
+    uint8_t event = prev_points ? FT5x06_EVENT_CONTACT : FT5x06_EVENT_DOWN;
+    ft5x06.regs[FT5x06_REG_TOUCH_POINTS] = (uint8_t)points;
+    // 抬起的触摸点保留坐标，事件改为抬起
+    for (int i = points; i < prev_points && i < FT5x06_MAX_POINTS; i++) {
+        uint8_t *p = &ft5x06.regs[FT5x06_REG_TOUCH1 + i * FT5x06_POINT_STRIDE];
+        p[0] = (uint8_t)((FT5x06_EVENT_UP << 6) | (p[0] & 0x0F));
+    }
+    for (int i = 0; i < points; i++) {
+        uint8_t *p = &ft5x06.regs[FT5x06_REG_TOUCH1 + i * FT5x06_POINT_STRIDE];
+        p[0] = (uint8_t)((event << 6) | ((x[i] >> 8) & 0x0F));
+        p[1] = (uint8_t)(x[i] & 0xFF);
+        p[2] = (uint8_t)((i << 4) | ((y[i] >> 8) & 0x0F));     // 触摸ID
+        p[3] = (uint8_t)(y[i] & 0xFF);
+        p[4] = 0x20;            // 压力
+        p[5] = 0x10;            // 面积
+    }
+    pthread_mutex_unlock(&ft5x06.lock);
+
+    // 有触摸数据时INT保持低电平
+    if (ft5x06.int_gpio != GPIO_NUM_NC) {
+        host_gpio_set_input(ft5x06.int_gpio, points ? 0 : 1);
+    }
+}
+
+void host_ft5x06_write_regs(uint8_t reg, const uint8_t *data, size_t len) {
+    pthread_mutex_lock(&ft5x06.lock);
+    for (size_t i = 0; i < len; i++) {
+        ft5x06.regs[(uint8_t)(reg + i)] = data[i];
+    }
+    pthread_mutex_unlock(&ft5x06.lock);
+}
@@ -0,0 +1,561 @@
+// 主机上的GPIO、LEDC和旧版I2C驱动：记录配置和输出，I2C事务转发给挂在总线上的设备模型
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "driver/gpio.h"
+#include "driver/i2c.h"
+#include "driver/i2c_master.h"
+#include "driver/ledc.h"
+#include "esp_log.h"
+#include "host_sim.h"
+
+static const char *TAG = "host_driver";
+
+/****************    GPIO ↓   *************************/
+
+static struct {
+    gpio_mode_t mode;
+    gpio_int_type_t intr_type;
+    bool intr_enabled;
+    int level;
+    bool driven;        ///< 电平由外设模型驱动(host_gpio_set_input)，gpio_config不再按上拉改写
+    gpio_isr_t isr;
+    void *isr_arg;
+} gpio_pins[GPIO_NUM_MAX];
+static bool gpio_isr_service_installed = false;
+static pthread_mutex_t gpio_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static bool gpio_valid(gpio_num_t gpio_num) {
+    return gpio_num >= 0 && gpio_num < GPIO_NUM_MAX;
+}
+
+esp_err_t gpio_config(const gpio_config_t *cfg) {
+    if (cfg == NULL || cfg->pin_bit_mask == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&gpio_lock);
+    for (int i = 0; i < GPIO_NUM_MAX; i++) {
+        if (cfg->pin_bit_mask & (1ULL << i)) {
+            gpio_pins[i].mode = cfg->mode;
+            gpio_pins[i].intr_type = cfg->intr_type;
+            gpio_pins[i].intr_enabled = cfg->intr_type != GPIO_INTR_DISABLE;
+            if (!gpio_pins[i].driven) {
+                gpio_pins[i].level = cfg->pull_up_en ? 1 : 0;
+            }
+        }
+    }
+    pthread_mutex_unlock(&gpio_lock);
+    return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num) {
+    if (!gpio_valid(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&gpio_lock);
+    memset(&gpio_pins[gpio_num], 0, sizeof(gpio_pins[gpio_num]));
+    pthread_mutex_unlock(&gpio_lock);
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level) {
+    if (!gpio_valid(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&gpio_lock);
+    gpio_pins[gpio_num].level = level ? 1 : 0;
+    pthread_mutex_unlock(&gpio_lock);
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num) {
+    if (!gpio_valid(gpio_num)) {
+        return 0;
+    }
+    pthread_mutex_lock(&gpio_lock);
+    int level = gpio_pins[gpio_num].level;
+    pthread_mutex_unlock(&gpio_lock);
+    return level;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t gpio_num, gpio_int_type_t intr_type) {
+    if (!gpio_valid(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&gpio_lock);
+    gpio_pins[gpio_num].intr_type = intr_type;
+    pthread_mutex_unlock(&gpio_lock);
+    return ESP_OK;
+}
+
+static esp_err_t gpio_intr_set_enabled(gpio_num_t gpio_num, bool enabled) {
+    if (!gpio_valid(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&gpio_lock);
+    gpio_pins[gpio_num].intr_enabled = enabled;
+    pthread_mutex_unlock(&gpio_lock);
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num) {
+    return gpio_intr_set_enabled(gpio_num, true);
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num) {
+    return gpio_intr_set_enabled(gpio_num, false);
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags) {
+    (void)intr_alloc_flags;
+    if (gpio_isr_service_installed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    gpio_isr_service_installed = true;
+    return ESP_OK;
+}
+
+void gpio_uninstall_isr_service(void) {
+    gpio_isr_service_installed = false;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void *args) {
+    if (!gpio_valid(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!gpio_isr_service_installed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    pthread_mutex_lock(&gpio_lock);
+    gpio_pins[gpio_num].isr = isr_handler;
+    gpio_pins[gpio_num].isr_arg = args;
+    pthread_mutex_unlock(&gpio_lock);
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num) {
+    return gpio_isr_handler_add(gpio_num, NULL, NULL);
+}
+
+void host_gpio_set_input(gpio_num_t gpio_num, int level) {
+    if (!gpio_valid(gpio_num)) {
+        return;
+    }
+    level = level ? 1 : 0;
+    pthread_mutex_lock(&gpio_lock);
+    int old = gpio_pins[gpio_num].level;
+    gpio_pins[gpio_num].level = level;
+    gpio_pins[gpio_num].driven = true;
+    bool fire = false;
+    if (gpio_pins[gpio_num].intr_enabled && gpio_pins[gpio_num].isr) {
+        switch (gpio_pins[gpio_num].intr_type) {
+            case GPIO_INTR_POSEDGE: fire = !old && level; break;
+            case GPIO_INTR_NEGEDGE: fire = old && !level; break;
+            case GPIO_INTR_ANYEDGE: fire = old != level; break;
+            case GPIO_INTR_LOW_LEVEL: fire = !level; break;
+            case GPIO_INTR_HIGH_LEVEL: fire = level; break;
+            default: break;
+        }
+    }
+    gpio_isr_t isr = gpio_pins[gpio_num].isr;
+    void *arg = gpio_pins[gpio_num].isr_arg;
+    pthread_mutex_unlock(&gpio_lock);
+    if (fire) {
+        isr(arg);
+    }
+}
+
+/****************    LEDC ↓   *************************/
+
+static struct {
+    uint32_t freq_hz;
+    ledc_timer_bit_t bits;
+} ledc_timers[LEDC_TIMER_MAX];
+
+static struct {
+    bool configured;
+    ledc_timer_t timer;
+    uint32_t duty;              ///< ledc_set_duty写入、尚未生效的占空比
+    uint32_t active_duty;       ///< ledc_update_duty后生效的占空比
+    uint32_t pulse_us;
+    uint32_t updates;
+} ledc_channels[LEDC_CHANNEL_MAX];
+
+static host_ledc_update_cb_t ledc_update_cb = NULL;
+static void *ledc_update_ctx = NULL;
+static pthread_mutex_t ledc_lock = PTHREAD_MUTEX_INITIALIZER;
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t *timer_conf) {
+    if (timer_conf == NULL || timer_conf->timer_num >= LEDC_TIMER_MAX || timer_conf->freq_hz == 0 ||
+        timer_conf->duty_resolution >= LEDC_TIMER_BIT_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&ledc_lock);
+    ledc_timers[timer_conf->timer_num].freq_hz = timer_conf->freq_hz;
+    ledc_timers[timer_conf->timer_num].bits = timer_conf->duty_resolution;
+    pthread_mutex_unlock(&ledc_lock);
+    return ESP_OK;
+}
+
+/**
+ * @brief 按定时器频率和分辨率把占空比换算为高电平时间
+ */
+static uint32_t ledc_duty_to_us(ledc_channel_t channel, uint32_t duty) {
+    ledc_timer_t timer = ledc_channels[channel].timer;
+    if (ledc_timers[timer].freq_hz == 0) {
+        return 0;
+    }
+    uint64_t period_us = 1000000ULL / ledc_timers[timer].freq_hz;
+    return (uint32_t)((duty * period_us + (1ULL << (ledc_timers[timer].bits - 1))) >> ledc_timers[timer].bits);
+}
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t *ledc_conf) {
+    if (ledc_conf == NULL || ledc_conf->channel >= LEDC_CHANNEL_MAX || ledc_conf->timer_sel >= LEDC_TIMER_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&ledc_lock);
+    ledc_channels[ledc_conf->channel].configured = true;
+    ledc_channels[ledc_conf->channel].timer = ledc_conf->timer_sel;
+    ledc_channels[ledc_conf->channel].duty = ledc_conf->duty;
+    ledc_channels[ledc_conf->channel].active_duty = ledc_conf->duty;
+    ledc_channels[ledc_conf->channel].pulse_us = ledc_duty_to_us(ledc_conf->channel, ledc_conf->duty);
+    pthread_mutex_unlock(&ledc_lock);
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_duty(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t duty) {
+    if (speed_mode >= LEDC_SPEED_MODE_MAX || channel >= LEDC_CHANNEL_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&ledc_lock);
+    if (!ledc_channels[channel].configured) {
+        pthread_mutex_unlock(&ledc_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    ledc_channels[channel].duty = duty;
+    pthread_mutex_unlock(&ledc_lock);
+    return ESP_OK;
+}
+
+esp_err_t ledc_update_duty(ledc_mode_t speed_mode, ledc_channel_t channel) {
+    if (speed_mode >= LEDC_SPEED_MODE_MAX || channel >= LEDC_CHANNEL_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&ledc_lock);
+    if (!ledc_channels[channel].configured) {
+        pthread_mutex_unlock(&ledc_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    uint32_t duty = ledc_channels[channel].duty;
+    uint32_t pulse_us = ledc_duty_to_us(channel, duty);
+    ledc_channels[channel].active_duty = duty;
+    ledc_channels[channel].pulse_us = pulse_us;
+    ledc_channels[channel].updates++;
+    host_ledc_update_cb_t cb = ledc_update_cb;
+    void *ctx = ledc_update_ctx;
+    pthread_mutex_unlock(&ledc_lock);
+
+    if (cb) {
+        cb(channel, duty, pulse_us, ctx);
+    }
+    return ESP_OK;
+}
+
+uint32_t ledc_get_duty(ledc_mode_t speed_mode, ledc_channel_t channel) {
+    if (speed_mode >= LEDC_SPEED_MODE_MAX || channel >= LEDC_CHANNEL_MAX) {
+        return 0;
+    }
+    pthread_mutex_lock(&ledc_lock);
+    uint32_t duty = ledc_channels[channel].active_duty;
+    pthread_mutex_unlock(&ledc_lock);
+    return duty;
+}
+
+uint32_t ledc_get_freq(ledc_mode_t speed_mode, ledc_timer_t timer_num) {
+    if (speed_mode >= LEDC_SPEED_MODE_MAX || timer_num >= LEDC_TIMER_MAX) {
+        return 0;
+    }
+    return ledc_timers[timer_num].freq_hz;
+}
+
+esp_err_t ledc_stop(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t idle_level) {
+    (void)idle_level;
+    if (speed_mode >= LEDC_SPEED_MODE_MAX || channel >= LEDC_CHANNEL_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&ledc_lock);
+    ledc_channels[channel].active_duty = 0;
+    ledc_channels[channel].pulse_us = 0;
+    pthread_mutex_unlock(&ledc_lock);
+    return ESP_OK;
+}
+
+void host_ledc_set_update_cb(host_ledc_update_cb_t cb, void *ctx) {
+    pthread_mutex_lock(&ledc_lock);
+    ledc_update_cb = cb;
+    ledc_update_ctx = ctx;
+    pthread_mutex_unlock(&ledc_lock);
+}
+
+uint32_t host_ledc_get_pulse_us(ledc_channel_t channel) {
+    if (channel >= LEDC_CHANNEL_MAX) {
+        return 0;
+    }
+    pthread_mutex_lock(&ledc_lock);
+    uint32_t pulse_us = ledc_channels[channel].pulse_us;
+    pthread_mutex_unlock(&ledc_lock);
+    return pulse_us;
+}
+
+uint32_t host_ledc_get_update_count(ledc_channel_t channel) {
+    if (channel >= LEDC_CHANNEL_MAX) {
+        return 0;
+    }
+    pthread_mutex_lock(&ledc_lock);
+    uint32_t updates = ledc_channels[channel].updates;
+    pthread_mutex_unlock(&ledc_lock);
+    return updates;
+}
+
+/****************    I2C ↓   *************************/
+
+#define HOST_I2C_MAX_DEVICES    (8)
+
+static struct {
+    bool installed;
+    uint32_t clk_speed;
+    struct {
+        uint8_t addr;
+        host_i2c_device_t dev;
+    } devices[HOST_I2C_MAX_DEVICES];
+    int device_count;
+    host_i2c_stats_t stats;
+    pthread_mutex_t lock;       ///< 总线锁，一次事务独占总线
+} i2c_ports[I2C_NUM_MAX] = {
+    [0] = { .lock = PTHREAD_MUTEX_INITIALIZER },
+    [1] = { .lock = PTHREAD_MUTEX_INITIALIZER },
+};
+
+esp_err_t i2c_param_config(i2c_port_t port, const i2c_config_t *conf) {
+    if (port < 0 || port >= I2C_NUM_MAX || conf == NULL || conf->mode != I2C_MODE_MASTER) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    i2c_ports[port].clk_speed = conf->master.clk_speed;
+    return ESP_OK;
+}
+
+esp_err_t i2c_driver_install(i2c_port_t port, i2c_mode_t mode, size_t rx_buf_len, size_t tx_buf_len,
+                             int intr_alloc_flags) {
+    (void)rx_buf_len;
+    (void)tx_buf_len;
+    (void)intr_alloc_flags;
+    if (port < 0 || port >= I2C_NUM_MAX || mode != I2C_MODE_MASTER) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (i2c_ports[port].installed) {
+        return ESP_FAIL;
+    }
+    i2c_ports[port].installed = true;
+    return ESP_OK;
+}
+
+esp_err_t i2c_driver_delete(i2c_port_t port) {
+    if (port < 0 || port >= I2C_NUM_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    i2c_ports[port].installed = false;
+    return ESP_OK;
+}
+
+esp_err_t host_i2c_attach_device(i2c_port_t port, uint8_t addr, const host_i2c_device_t *dev) {
+    if (port < 0 || port >= I2C_NUM_MAX || dev == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&i2c_ports[port].lock);
+    if (i2c_ports[port].device_count >= HOST_I2C_MAX_DEVICES) {
+        pthread_mutex_unlock(&i2c_ports[port].lock);
+        return ESP_ERR_NO_MEM;
+    }
+    int n = i2c_ports[port].device_count++;
+    i2c_ports[port].devices[n].addr = addr;
+    i2c_ports[port].devices[n].dev = *dev;
+    pthread_mutex_unlock(&i2c_ports[port].lock);
+    return ESP_OK;
+}
+
+void host_i2c_get_stats(i2c_port_t port, host_i2c_stats_t *out) {
+    if (port < 0 || port >= I2C_NUM_MAX) {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    pthread_mutex_lock(&i2c_ports[port].lock);
+    *out = i2c_ports[port].stats;
+    pthread_mutex_unlock(&i2c_ports[port].lock);
+}
+
+/**
+ * @brief 执行一次I2C事务：先写后读(任一阶段长度可为0)，按时钟频率模拟总线占用时间
+ * @note 每个字节9个时钟(8位+ACK)，每个阶段一个地址字节，另加起始/停止条件约2个时钟
+ */
+static esp_err_t i2c_transfer_clk(i2c_port_t port, uint8_t addr, uint32_t clk_speed, const uint8_t *wbuf, size_t wlen,
+                                  uint8_t *rbuf, size_t rlen) {
+    if (port < 0 || port >= I2C_NUM_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!i2c_ports[port].installed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    pthread_mutex_lock(&i2c_ports[port].lock);
+    host_i2c_device_t *dev = NULL;
+    for (int i = 0; i < i2c_ports[port].device_count; i++) {
+        if (i2c_ports[port].devices[i].addr == addr) {
+            dev = &i2c_ports[port].devices[i].dev;
+            break;
+        }
+    }
+
+    size_t phases = (wlen ? 1 : 0) + (rlen ? 1 : 0);
+    size_t bytes = wlen + rlen + phases;
+    uint32_t clk = clk_speed ? clk_speed : 100000;
+    uint32_t busy_us = (uint32_t)(((uint64_t)bytes * 9 + phases * 2) * 1000000ULL / clk);
+
+    esp_err_t ret = ESP_OK;
+    if (dev == NULL) {
+        i2c_ports[port].stats.nacks++;
+        busy_us = (uint32_t)(11ULL * 1000000ULL / clk);    // 只发出地址字节就收到NACK
+        ret = ESP_FAIL;
+    } else {
+        if (wlen && dev->write) {
+            ret = dev->write(dev->ctx, wbuf, wlen);
+        }
+        if (ret == ESP_OK && rlen) {
+            ret = dev->read ? dev->read(dev->ctx, rbuf, rlen) : ESP_FAIL;
+        }
+        i2c_ports[port].stats.transactions++;
+        i2c_ports[port].stats.bytes += (uint32_t)bytes;
+    }
+    i2c_ports[port].stats.busy_us += busy_us;
+
+    // 持有总线锁等待，其他事务要排队，和真实总线一致
+    host_sim_bus_delay_us(busy_us);
+    pthread_mutex_unlock(&i2c_ports[port].lock);
+
+    if (ret != ESP_OK) {
+        ESP_LOGD(TAG, "i2c%d addr 0x%02x: %s", port, addr, esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+static esp_err_t i2c_transfer(i2c_port_t port, uint8_t addr, const uint8_t *wbuf, size_t wlen, uint8_t *rbuf,
+                              size_t rlen) {
+    uint32_t clk = (port >= 0 && port < I2C_NUM_MAX) ? i2c_ports[port].clk_speed : 0;
+    return i2c_transfer_clk(port, addr, clk, wbuf, wlen, rbuf, rlen);
+}
+
+esp_err_t i2c_master_write_to_device(i2c_port_t port, uint8_t addr, const uint8_t *write_buffer, size_t write_size,
+                                     TickType_t ticks_to_wait) {
+    (void)ticks_to_wait;
+    return i2c_transfer(port, addr, write_buffer, write_size, NULL, 0);
+}
+
+esp_err_t i2c_master_read_from_device(i2c_port_t port, uint8_t addr, uint8_t *read_buffer, size_t read_size,
+                                      TickType_t ticks_to_wait) {
+    (void)ticks_to_wait;
+    return i2c_transfer(port, addr, NULL, 0, read_buffer, read_size);
+}
+
+esp_err_t i2c_master_write_read_device(i2c_port_t port, uint8_t addr, const uint8_t *write_buffer, size_t write_size,
+                                       uint8_t *read_buffer, size_t read_size, TickType_t ticks_to_wait) {
+    (void)ticks_to_wait;
+    return i2c_transfer(port, addr, write_buffer, write_size, read_buffer, read_size);
+}
+
+/****************    I2C(i2c_master) ↓   *************************/
+
+struct i2c_master_bus_t {
+    i2c_port_t port;
+};
+
+struct i2c_master_dev_t {
+    i2c_master_bus_handle_t bus;
+    uint16_t addr;
+    uint32_t scl_speed_hz;      ///< 每个设备单独的时钟
+};
+
+esp_err_t i2c_new_master_bus(const i2c_master_bus_config_t *bus_config, i2c_master_bus_handle_t *ret_bus_handle) {
+    if (bus_config == NULL || ret_bus_handle == NULL || bus_config->i2c_port < 0 ||
+        bus_config->i2c_port >= I2C_NUM_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // 和设备上一样，同一个端口不能同时使用旧版驱动
+    if (i2c_ports[bus_config->i2c_port].installed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    struct i2c_master_bus_t *bus = calloc(1, sizeof(*bus));
+    if (bus == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    bus->port = bus_config->i2c_port;
+    i2c_ports[bus->port].installed = true;
+    *ret_bus_handle = bus;
+    return ESP_OK;
+}
+
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus_handle) {
+    if (bus_handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    i2c_ports[bus_handle->port].installed = false;
+    free(bus_handle);
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus_handle, const i2c_device_config_t *dev_config,
+                                    i2c_master_dev_handle_t *ret_handle) {
+    if (bus_handle == NULL || dev_config == NULL || ret_handle == NULL || dev_config->scl_speed_hz == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct i2c_master_dev_t *dev = calloc(1, sizeof(*dev));
+    if (dev == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    dev->bus = bus_handle;
+    dev->addr = dev_config->device_address;
+    dev->scl_speed_hz = dev_config->scl_speed_hz;
+    *ret_handle = dev;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t handle) {
+    free(handle);
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t i2c_dev, const uint8_t *write_buffer, size_t write_size,
+                              int xfer_timeout_ms) {
+    (void)xfer_timeout_ms;
+    return i2c_transfer_clk(i2c_dev->bus->port, (uint8_t)i2c_dev->addr, i2c_dev->scl_speed_hz, write_buffer,
+                            write_size, NULL, 0);
+}
+
+esp_err_t i2c_master_receive(i2c_master_dev_handle_t i2c_dev, uint8_t *read_buffer, size_t read_size,
+                             int xfer_timeout_ms) {
+    (void)xfer_timeout_ms;
+    return i2c_transfer_clk(i2c_dev->bus->port, (uint8_t)i2c_dev->addr, i2c_dev->scl_speed_hz, NULL, 0,
+                            read_buffer, read_size);
+}
+
+esp_err_t i2c_master_transmit_receive(i2c_master_dev_handle_t i2c_dev, const uint8_t *write_buffer,
+                                      size_t write_size, uint8_t *read_buffer, size_t read_size, int xfer_timeout_ms) {
+    (void)xfer_timeout_ms;
+    return i2c_transfer_clk(i2c_dev->bus->port, (uint8_t)i2c_dev->addr, i2c_dev->scl_speed_hz, write_buffer,
+                            write_size, read_buffer, read_size);
+}
+
+esp_err_t i2c_master_probe(i2c_master_bus_handle_t bus_handle, uint16_t address, int xfer_timeout_ms) {
+    (void)xfer_timeout_ms;
+    esp_err_t ret = i2c_transfer_clk(bus_handle->port, (uint8_t)address, 100000, NULL, 0, NULL, 0);
+    return ret == ESP_OK ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
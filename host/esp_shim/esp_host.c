@@ -0,0 +1,510 @@
+// 主机上的ESP-IDF系统服务：错误名、日志、esp_timer、heap_caps和总线时间缩放
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "host_sim.h"
+
+/****************    错误名 ↓   *************************/
+
+const char *esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK: return "ESP_OK";
+        case ESP_FAIL: return "ESP_FAIL";
+        case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+        case ESP_ERR_INVALID_RESPONSE: return "ESP_ERR_INVALID_RESPONSE";
+        case ESP_ERR_INVALID_CRC: return "ESP_ERR_INVALID_CRC";
+        case ESP_ERR_INVALID_VERSION: return "ESP_ERR_INVALID_VERSION";
+        case ESP_ERR_NOT_FINISHED: return "ESP_ERR_NOT_FINISHED";
+        default: return "UNKNOWN ERROR";
+    }
+}
+
+/****************    时间 ↓   *************************/
+
+static struct timespec boot_time;
+
+__attribute__((constructor)) static void host_time_init(void) {
+    clock_gettime(CLOCK_MONOTONIC, &boot_time);
+    setvbuf(stdout, NULL, _IOLBF, 0);   // 和串口日志一样逐行输出，崩溃前的日志不丢失
+}
+
+int64_t esp_timer_get_time(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)(now.tv_sec - boot_time.tv_sec) * 1000000LL + (now.tv_nsec - boot_time.tv_nsec) / 1000;
+}
+
+/****************    日志 ↓   *************************/
+
+static esp_log_level_t log_level = ESP_LOG_INFO;
+
+void esp_log_level_set(const char *tag, esp_log_level_t level) {
+    if (tag && strcmp(tag, "*") == 0) {
+        log_level = level;
+    }
+}
+
+uint32_t esp_log_timestamp(void) {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...) {
+    (void)tag;
+    if (level > log_level) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    flockfile(stdout);
+    vprintf(format, args);
+    funlockfile(stdout);
+    va_end(args);
+}
+
+/****************    系统 ↓   *************************/
+
+void esp_restart(void) {
+    fprintf(stderr, "esp_restart() called\n");
+    exit(1);
+}
+
+uint32_t esp_get_free_heap_size(void) {
+    return (uint32_t)heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+}
+
+uint32_t esp_get_minimum_free_heap_size(void) {
+    return (uint32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT);
+}
+
+/****************    esp_timer ↓   *************************/
+
+// 每个定时器一个线程；回调都在定时器线程中执行，相当于ESP_TIMER_TASK分发
+struct host_esp_timer {
+    esp_timer_cb_t callback;
+    void *arg;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint64_t period_us;         ///< 0表示单次
+    int64_t next_us;            ///< 下次触发时间，<0表示未启动
+    bool deleted;
+};
+
+static void *host_timer_thread(void *arg) {
+    struct host_esp_timer *timer = arg;
+    pthread_setname_np(pthread_self(), "esp_timer");
+
+    pthread_mutex_lock(&timer->lock);
+    while (!timer->deleted) {
+        if (timer->next_us < 0) {
+            pthread_cond_wait(&timer->cond, &timer->lock);
+            continue;
+        }
+        int64_t now = esp_timer_get_time();
+        if (now < timer->next_us) {
+            struct timespec ts;
+            int64_t abs_us = timer->next_us;
+            ts.tv_sec = boot_time.tv_sec + (time_t)(abs_us / 1000000);
+            ts.tv_nsec = boot_time.tv_nsec + (long)(abs_us % 1000000) * 1000L;
+            if (ts.tv_nsec >= 1000000000L) {
+                ts.tv_sec++;
+                ts.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait(&timer->cond, &timer->lock, &ts);
+            continue;
+        }
+        if (timer->period_us) {
+            timer->next_us += (int64_t)timer->period_us;
+            if (timer->next_us < now) {
+                timer->next_us = now + (int64_t)timer->period_us;  // 跳过错过的周期
+            }
+        } else {
+            timer->next_us = -1;
+        }
+        pthread_mutex_unlock(&timer->lock);
+        timer->callback(timer->arg);
+        pthread_mutex_lock(&timer->lock);
+    }
+    pthread_mutex_unlock(&timer->lock);
+    pthread_mutex_destroy(&timer->lock);
+    pthread_cond_destroy(&timer->cond);
+    free(timer);
+    return NULL;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out_handle) {
+    if (args == NULL || args->callback == NULL || out_handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct host_esp_timer *timer = calloc(1, sizeof(*timer));
+    if (timer == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    timer->callback = args->callback;
+    timer->arg = args->arg;
+    timer->next_us = -1;
+    pthread_mutex_init(&timer->lock, NULL);
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&timer->cond, &attr);
+    pthread_condattr_destroy(&attr);
+    if (pthread_create(&timer->thread, NULL, host_timer_thread, timer) != 0) {
+        free(timer);
+        return ESP_ERR_NO_MEM;
+    }
+    pthread_detach(timer->thread);
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+static esp_err_t host_timer_start(esp_timer_handle_t timer, uint64_t timeout_us, uint64_t period_us) {
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&timer->lock);
+    if (timer->next_us >= 0) {
+        pthread_mutex_unlock(&timer->lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->period_us = period_us;
+    timer->next_us = esp_timer_get_time() + (int64_t)timeout_us;
+    pthread_cond_signal(&timer->cond);
+    pthread_mutex_unlock(&timer->lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    return host_timer_start(timer, timeout_us, 0);
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us) {
+    return host_timer_start(timer, period_us, period_us);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&timer->lock);
+    bool active = timer->next_us >= 0;
+    timer->next_us = -1;
+    pthread_cond_signal(&timer->cond);
+    pthread_mutex_unlock(&timer->lock);
+    return active ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&timer->lock);
+    if (timer->next_us >= 0) {
+        pthread_mutex_unlock(&timer->lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->deleted = true;
+    pthread_cond_signal(&timer->cond);
+    pthread_mutex_unlock(&timer->lock);
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer) {
+    pthread_mutex_lock(&timer->lock);
+    bool active = timer->next_us >= 0;
+    pthread_mutex_unlock(&timer->lock);
+    return active;
+}
+
+/****************    heap_caps ↓   *************************/
+
+// ESP32-S3：内部RAM全部可DMA，外接8MB PSRAM
+#define HOST_HEAP_INTERNAL_SIZE (320 * 1024)
+#define HOST_HEAP_SPIRAM_SIZE   (8 * 1024 * 1024)
+#define HOST_HEAP_TABLE_SIZE    (4096)      // 同时存活的heap_caps分配数上限(开放寻址)
+
+enum { HEAP_INTERNAL, HEAP_SPIRAM, HEAP_REGIONS };
+
+static struct {
+    size_t total;
+    size_t used;
+    size_t peak;
+    size_t blocks;
+} heap_regions[HEAP_REGIONS] = {
+    [HEAP_INTERNAL] = { .total = HOST_HEAP_INTERNAL_SIZE },
+    [HEAP_SPIRAM] = { .total = HOST_HEAP_SPIRAM_SIZE },
+};
+
+// 设备上heap_caps_malloc得到的内存可以直接free()，所以这里不加块头，用指针表记账
+static struct {
+    void *ptr;
+    size_t size;
+    int region;
+} heap_table[HOST_HEAP_TABLE_SIZE];
+static pthread_mutex_t heap_lock = PTHREAD_MUTEX_INITIALIZER;
+
+#define HEAP_TOMBSTONE  ((void *)1)
+
+static size_t host_heap_hash(const void *ptr) {
+    return (size_t)(((uintptr_t)ptr >> 4) * 2654435761u) % HOST_HEAP_TABLE_SIZE;
+}
+
+static int host_heap_region(uint32_t caps) {
+    return (caps & MALLOC_CAP_SPIRAM) ? HEAP_SPIRAM : HEAP_INTERNAL;
+}
+
+/**
+ * @brief 查询统计时caps匹配的区域：指定SPIRAM只算PSRAM，指定INTERNAL/DMA只算内部RAM，否则两者都算
+ */
+static bool host_heap_region_matches(int region, uint32_t caps) {
+    if (caps & MALLOC_CAP_SPIRAM) {
+        return region == HEAP_SPIRAM;
+    }
+    if (caps & (MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA)) {
+        return region == HEAP_INTERNAL;
+    }
+    return true;
+}
+
+/**
+ * @brief 预留区域容量，成功返回true
+ */
+static bool host_heap_reserve(int region, size_t size) {
+    pthread_mutex_lock(&heap_lock);
+    if (heap_regions[region].used + size > heap_regions[region].total) {
+        pthread_mutex_unlock(&heap_lock);
+        return false;
+    }
+    heap_regions[region].used += size;
+    heap_regions[region].blocks++;
+    if (heap_regions[region].used > heap_regions[region].peak) {
+        heap_regions[region].peak = heap_regions[region].used;
+    }
+    pthread_mutex_unlock(&heap_lock);
+    return true;
+}
+
+static void host_heap_release(int region, size_t size) {
+    pthread_mutex_lock(&heap_lock);
+    heap_regions[region].used -= size;
+    heap_regions[region].blocks--;
+    pthread_mutex_unlock(&heap_lock);
+}
+
+static void host_heap_track(void *ptr, size_t size, int region) {
+    pthread_mutex_lock(&heap_lock);
+    size_t i = host_heap_hash(ptr);
+    for (size_t n = 0; n < HOST_HEAP_TABLE_SIZE; n++, i = (i + 1) % HOST_HEAP_TABLE_SIZE) {
+        if (heap_table[i].ptr == NULL || heap_table[i].ptr == HEAP_TOMBSTONE) {
+            heap_table[i].ptr = ptr;
+            heap_table[i].size = size;
+            heap_table[i].region = region;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&heap_lock);
+}
+
+/**
+ * @brief 从记账表中移除指针，返回是否是heap_caps分配的内存
+ */
+static bool host_heap_untrack(void *ptr) {
+    bool found = false;
+    pthread_mutex_lock(&heap_lock);
+    size_t i = host_heap_hash(ptr);
+    for (size_t n = 0; n < HOST_HEAP_TABLE_SIZE && heap_table[i].ptr != NULL; n++, i = (i + 1) % HOST_HEAP_TABLE_SIZE) {
+        if (heap_table[i].ptr == ptr) {
+            int region = heap_table[i].region;
+            heap_regions[region].used -= heap_table[i].size;
+            heap_regions[region].blocks--;
+            heap_table[i].ptr = HEAP_TOMBSTONE;
+            found = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&heap_lock);
+    return found;
+}
+
+static size_t host_heap_tracked_size(void *ptr) {
+    size_t size = 0;
+    pthread_mutex_lock(&heap_lock);
+    size_t i = host_heap_hash(ptr);
+    for (size_t n = 0; n < HOST_HEAP_TABLE_SIZE && heap_table[i].ptr != NULL; n++, i = (i + 1) % HOST_HEAP_TABLE_SIZE) {
+        if (heap_table[i].ptr == ptr) {
+            size = heap_table[i].size;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&heap_lock);
+    return size;
+}
+
+void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps) {
+    int region = host_heap_region(caps);
+    if (alignment < sizeof(void *)) {
+        alignment = sizeof(void *);
+    }
+    if (!host_heap_reserve(region, size)) {
+        return NULL;
+    }
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, alignment, size ? size : 1) != 0) {
+        host_heap_release(region, size);
+        return NULL;
+    }
+    host_heap_track(ptr, size, region);
+    return ptr;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps) {
+    return heap_caps_aligned_alloc(16, size, caps);
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    void *ptr = heap_caps_malloc(n * size, caps);
+    if (ptr) {
+        memset(ptr, 0, n * size);
+    }
+    return ptr;
+}
+
+void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps) {
+    if (ptr == NULL) {
+        return heap_caps_malloc(size, caps);
+    }
+    size_t old_size = host_heap_tracked_size(ptr);
+    void *out = heap_caps_malloc(size, caps);
+    if (out) {
+        memcpy(out, ptr, old_size < size ? old_size : size);
+        heap_caps_free(ptr);
+    }
+    return out;
+}
+
+void heap_caps_free(void *ptr) {
+    free(ptr);
+}
+
+/**
+ * @brief 链接时用--wrap=free替换组件中的free()，使heap_caps分配的内存无论用哪个接口释放都能正确记账
+ */
+extern void __real_free(void *ptr);
+
+void __wrap_free(void *ptr) {
+    if (ptr) {
+        host_heap_untrack(ptr);
+    }
+    __real_free(ptr);
+}
+
+void heap_caps_get_info(multi_heap_info_t *info, uint32_t caps) {
+    memset(info, 0, sizeof(*info));
+    pthread_mutex_lock(&heap_lock);
+    for (int r = 0; r < HEAP_REGIONS; r++) {
+        if (!host_heap_region_matches(r, caps)) {
+            continue;
+        }
+        size_t free_bytes = heap_regions[r].total - heap_regions[r].used;
+        info->total_free_bytes += free_bytes;
+        info->total_allocated_bytes += heap_regions[r].used;
+        info->minimum_free_bytes += heap_regions[r].total - heap_regions[r].peak;
+        info->allocated_blocks += heap_regions[r].blocks;
+        if (free_bytes > info->largest_free_block) {
+            info->largest_free_block = free_bytes;  // 主机上没有碎片
+        }
+    }
+    pthread_mutex_unlock(&heap_lock);
+    info->total_blocks = info->allocated_blocks;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, caps);
+    return info.total_free_bytes;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, caps);
+    return info.minimum_free_bytes;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, caps);
+    return info.largest_free_block;
+}
+
+size_t heap_caps_get_total_size(uint32_t caps) {
+    size_t total = 0;
+    for (int r = 0; r < HEAP_REGIONS; r++) {
+        if (host_heap_region_matches(r, caps)) {
+            total += heap_regions[r].total;
+        }
+    }
+    return total;
+}
+
+/****************    字符串 ↓   *************************/
+
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+size_t strlcpy(char *dst, const char *src, size_t size) {
+    size_t len = strlen(src);
+    if (size) {
+        size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+#endif
+
+/****************    总线时间缩放 ↓   *************************/
+
+static float bus_time_scale = -1.0f;
+
+float host_sim_get_bus_time_scale(void) {
+    if (bus_time_scale < 0) {
+        const char *env = getenv("HOST_BUS_TIME_SCALE");
+        bus_time_scale = env ? strtof(env, NULL) : 1.0f;
+        if (bus_time_scale < 0) {
+            bus_time_scale = 0;
+        }
+    }
+    return bus_time_scale;
+}
+
+void host_sim_set_bus_time_scale(float scale) {
+    bus_time_scale = scale < 0 ? 0 : scale;
+}
+
+void host_sim_bus_delay_us(uint32_t us) {
+    float scale = host_sim_get_bus_time_scale();
+    if (scale <= 0 || us == 0) {
+        return;
+    }
+    uint64_t ns = (uint64_t)((double)us * scale * 1000.0);
+    struct timespec ts = {
+        .tv_sec = (time_t)(ns / 1000000000ULL),
+        .tv_nsec = (long)(ns % 1000000000ULL),
+    };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
@@ -0,0 +1,663 @@
+// 主机上的FreeRTOS：每个任务一个pthread，队列/信号量/事件组用互斥锁+条件变量实现
+// 优先级只记录不生效，调度交给Linux；xPortGetCoreID返回任务绑定的核心，未绑定的任务轮流分配
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "esp_timer.h"
+
+#define HOST_MAX_TASKS          (64)
+#define HOST_TASK_STACK_MIN     (512 * 1024)    // LVGL绘制递归较深，主机线程栈不按ESP32的字节数分配
+
+struct host_task {
+    pthread_t thread;
+    char name[configMAX_TASK_NAME_LEN];
+    TaskFunction_t fn;
+    void *arg;
+    UBaseType_t priority;
+    BaseType_t core;            ///< 绑定的核心，tskNO_AFFINITY表示不绑定
+    BaseType_t run_core;        ///< xPortGetCoreID返回的核心
+    UBaseType_t number;
+    uint32_t stack_depth;
+    clockid_t cpu_clock;
+    bool has_cpu_clock;
+    bool alive;
+    pthread_mutex_t notify_lock;
+    pthread_cond_t notify_cond;
+    uint32_t notify_value;
+    bool notify_pending;
+};
+
+static pthread_mutex_t task_table_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct host_task *task_table[HOST_MAX_TASKS];
+static UBaseType_t task_next_number = 1;
+static __thread struct host_task *current_task = NULL;
+
+static pthread_mutex_t critical_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+/****************    公共工具 ↓   *************************/
+
+static void host_cond_init(pthread_cond_t *cond) {
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static void host_deadline(TickType_t ticks, struct timespec *ts) {
+    clock_gettime(CLOCK_MONOTONIC, ts);
+    uint64_t ns = (uint64_t)pdTICKS_TO_MS(ticks) * 1000000ULL + (uint64_t)ts->tv_nsec;
+    ts->tv_sec += (time_t)(ns / 1000000000ULL);
+    ts->tv_nsec = (long)(ns % 1000000000ULL);
+}
+
+/**
+ * @brief 带超时等待条件变量
+ * @return false 超时
+ */
+static bool host_cond_wait(pthread_cond_t *cond, pthread_mutex_t *lock, TickType_t ticks, const struct timespec *deadline) {
+    if (ticks == portMAX_DELAY) {
+        pthread_cond_wait(cond, lock);
+        return true;
+    }
+    return pthread_cond_timedwait(cond, lock, deadline) != ETIMEDOUT;
+}
+
+void host_port_enter_critical(portMUX_TYPE *mux) {
+    (void)mux;
+    pthread_mutex_lock(&critical_lock);
+}
+
+void host_port_exit_critical(portMUX_TYPE *mux) {
+    (void)mux;
+    pthread_mutex_unlock(&critical_lock);
+}
+
+BaseType_t xPortInIsrContext(void) {
+    return pdFALSE;
+}
+
+/****************    任务 ↓   *************************/
+
+static struct host_task *host_task_alloc(const char *name, UBaseType_t priority, BaseType_t core) {
+    struct host_task *task = calloc(1, sizeof(*task));
+    if (task == NULL) {
+        return NULL;
+    }
+    strncpy(task->name, name ? name : "", sizeof(task->name) - 1);
+    task->priority = priority;
+    task->core = core;
+    pthread_mutex_init(&task->notify_lock, NULL);
+    host_cond_init(&task->notify_cond);
+
+    pthread_mutex_lock(&task_table_lock);
+    task->number = task_next_number++;
+    task->run_core = (core == tskNO_AFFINITY) ? (BaseType_t)(task->number % configNUM_CORES) : core;
+    for (int i = 0; i < HOST_MAX_TASKS; i++) {
+        if (task_table[i] == NULL) {
+            task_table[i] = task;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&task_table_lock);
+    return task;
+}
+
+static void host_task_remove(struct host_task *task) {
+    pthread_mutex_lock(&task_table_lock);
+    for (int i = 0; i < HOST_MAX_TASKS; i++) {
+        if (task_table[i] == task) {
+            task_table[i] = NULL;
+            break;
+        }
+    }
+    task->alive = false;
+    pthread_mutex_unlock(&task_table_lock);
+}
+
+/**
+ * @brief 当前线程对应的任务，不是由xTaskCreate创建的线程(例如main)首次调用时登记
+ */
+static struct host_task *host_task_self(void) {
+    if (current_task == NULL) {
+        struct host_task *task = host_task_alloc("main", 1, tskNO_AFFINITY);
+        if (task == NULL) {
+            abort();
+        }
+        task->thread = pthread_self();
+        task->has_cpu_clock = pthread_getcpuclockid(task->thread, &task->cpu_clock) == 0;
+        task->alive = true;
+        current_task = task;
+    }
+    return current_task;
+}
+
+static void *host_task_entry(void *arg) {
+    struct host_task *task = arg;
+    current_task = task;
+    pthread_setname_np(pthread_self(), task->name);
+    task->fn(task->arg);
+    // FreeRTOS任务函数不允许返回，这里按自删除处理
+    fprintf(stderr, "task '%s' returned without vTaskDelete\n", task->name);
+    host_task_remove(task);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *out, BaseType_t core) {
+    struct host_task *task = host_task_alloc(name, priority, core);
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    task->fn = fn;
+    task->arg = arg;
+    task->stack_depth = stack_depth;
+    task->alive = true;
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, stack_depth > HOST_TASK_STACK_MIN ? stack_depth : HOST_TASK_STACK_MIN);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    int rc = pthread_create(&task->thread, &attr, host_task_entry, task);
+    pthread_attr_destroy(&attr);
+    if (rc != 0) {
+        host_task_remove(task);
+        free(task);
+        return pdFAIL;
+    }
+    task->has_cpu_clock = pthread_getcpuclockid(task->thread, &task->cpu_clock) == 0;
+    if (out) {
+        *out = task;
+    }
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    struct host_task *self = host_task_self();
+    if (task == NULL || task == self) {
+        host_task_remove(self);
+        pthread_exit(NULL);
+    }
+    // 删除其他任务：在下一个取消点结束线程
+    host_task_remove(task);
+    pthread_cancel(task->thread);
+}
+
+void vTaskDelay(TickType_t ticks) {
+    struct timespec ts = {
+        .tv_sec = pdTICKS_TO_MS(ticks) / 1000,
+        .tv_nsec = (long)(pdTICKS_TO_MS(ticks) % 1000) * 1000000L,
+    };
+    if (ticks == 0) {
+        sched_yield();
+        return;
+    }
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+BaseType_t xTaskDelayUntil(TickType_t *prev_wake, TickType_t increment) {
+    TickType_t target = *prev_wake + increment;
+    TickType_t now = xTaskGetTickCount();
+    *prev_wake = target;
+    if ((int32_t)(target - now) <= 0) {
+        return pdFALSE;
+    }
+    vTaskDelay(target - now);
+    return pdTRUE;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(esp_timer_get_time() / (1000000 / configTICK_RATE_HZ));
+}
+
+TickType_t xTaskGetTickCountFromISR(void) {
+    return xTaskGetTickCount();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return host_task_self();
+}
+
+char *pcTaskGetName(TaskHandle_t task) {
+    return (task ? task : host_task_self())->name;
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task) {
+    return (task ? task : host_task_self())->priority;
+}
+
+BaseType_t xPortGetCoreID(void) {
+    return host_task_self()->run_core;
+}
+
+UBaseType_t uxTaskGetNumberOfTasks(void) {
+    UBaseType_t count = 0;
+    pthread_mutex_lock(&task_table_lock);
+    for (int i = 0; i < HOST_MAX_TASKS; i++) {
+        count += task_table[i] != NULL;
+    }
+    pthread_mutex_unlock(&task_table_lock);
+    return count;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    // 主机线程栈远大于任务栈，无法反映真实用量，返回配置值
+    return (task ? task : host_task_self())->stack_depth;
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *status, UBaseType_t count, uint32_t *total_runtime) {
+    UBaseType_t n = 0;
+    pthread_mutex_lock(&task_table_lock);
+    for (int i = 0; i < HOST_MAX_TASKS; i++) {
+        struct host_task *task = task_table[i];
+        if (task == NULL) {
+            continue;
+        }
+        if (n >= count) {
+            n = 0;  // 与FreeRTOS一致：缓冲区不足返回0
+            break;
+        }
+        uint32_t runtime = 0;
+        struct timespec ts;
+        if (task->has_cpu_clock && clock_gettime(task->cpu_clock, &ts) == 0) {
+            runtime = (uint32_t)((uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL);
+        }
+        status[n] = (TaskStatus_t) {
+            .xHandle = task,
+            .pcTaskName = task->name,
+            .xTaskNumber = task->number,
+            .eCurrentState = (task == current_task) ? eRunning : eBlocked,
+            .uxCurrentPriority = task->priority,
+            .uxBasePriority = task->priority,
+            .ulRunTimeCounter = runtime,
+            .pxStackBase = NULL,
+            .usStackHighWaterMark = task->stack_depth,
+            .xCoreID = task->core,
+        };
+        n++;
+    }
+    pthread_mutex_unlock(&task_table_lock);
+    if (total_runtime) {
+        *total_runtime = (uint32_t)esp_timer_get_time();
+    }
+    return n;
+}
+
+/****************    任务通知 ↓   *************************/
+
+BaseType_t xTaskGenericNotify(TaskHandle_t task, uint32_t value, eNotifyAction action, uint32_t *prev_value) {
+    BaseType_t ret = pdPASS;
+    pthread_mutex_lock(&task->notify_lock);
+    if (prev_value) {
+        *prev_value = task->notify_value;
+    }
+    switch (action) {
+        case eSetBits:
+            task->notify_value |= value;
+            break;
+        case eIncrement:
+            task->notify_value++;
+            break;
+        case eSetValueWithOverwrite:
+            task->notify_value = value;
+            break;
+        case eSetValueWithoutOverwrite:
+            if (task->notify_pending) {
+                ret = pdFAIL;
+            } else {
+                task->notify_value = value;
+            }
+            break;
+        case eNoAction:
+        default:
+            break;
+    }
+    task->notify_pending = true;
+    pthread_cond_signal(&task->notify_cond);
+    pthread_mutex_unlock(&task->notify_lock);
+    return ret;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks) {
+    struct host_task *task = host_task_self();
+    struct timespec deadline;
+    host_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&task->notify_lock);
+    while (task->notify_value == 0 && ticks != 0) {
+        if (!host_cond_wait(&task->notify_cond, &task->notify_lock, ticks, &deadline)) {
+            break;
+        }
+    }
+    uint32_t value = task->notify_value;
+    if (value) {
+        task->notify_value = clear_on_exit ? 0 : value - 1;
+    }
+    task->notify_pending = false;
+    pthread_mutex_unlock(&task->notify_lock);
+    return value;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *value, TickType_t ticks) {
+    struct host_task *task = host_task_self();
+    struct timespec deadline;
+    host_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&task->notify_lock);
+    if (!task->notify_pending) {
+        task->notify_value &= ~clear_on_entry;
+        while (!task->notify_pending && ticks != 0) {
+            if (!host_cond_wait(&task->notify_cond, &task->notify_lock, ticks, &deadline)) {
+                break;
+            }
+        }
+    }
+    BaseType_t got = task->notify_pending ? pdTRUE : pdFALSE;
+    if (value) {
+        *value = task->notify_value;
+    }
+    if (got) {
+        task->notify_value &= ~clear_on_exit;
+    }
+    task->notify_pending = false;
+    pthread_mutex_unlock(&task->notify_lock);
+    return got;
+}
+
+/****************    队列 ↓   *************************/
+
+struct host_queue {
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t head;
+    UBaseType_t count;
+    uint8_t *storage;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    struct host_queue *q = calloc(1, sizeof(*q));
+    if (q == NULL) {
+        return NULL;
+    }
+    q->storage = calloc(length, item_size ? item_size : 1);
+    if (q->storage == NULL) {
+        free(q);
+        return NULL;
+    }
+    q->length = length;
+    q->item_size = item_size;
+    pthread_mutex_init(&q->lock, NULL);
+    host_cond_init(&q->not_empty);
+    host_cond_init(&q->not_full);
+    return q;
+}
+
+void vQueueDelete(QueueHandle_t q) {
+    if (q == NULL) {
+        return;
+    }
+    pthread_mutex_destroy(&q->lock);
+    pthread_cond_destroy(&q->not_empty);
+    pthread_cond_destroy(&q->not_full);
+    free(q->storage);
+    free(q);
+}
+
+BaseType_t xQueueGenericSend(QueueHandle_t q, const void *item, TickType_t ticks, bool to_front) {
+    struct timespec deadline;
+    host_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&q->lock);
+    while (q->count == q->length) {
+        if (ticks == 0 || !host_cond_wait(&q->not_full, &q->lock, ticks, &deadline)) {
+            pthread_mutex_unlock(&q->lock);
+            return errQUEUE_FULL;
+        }
+    }
+    UBaseType_t slot;
+    if (to_front) {
+        q->head = (q->head + q->length - 1) % q->length;
+        slot = q->head;
+    } else {
+        slot = (q->head + q->count) % q->length;
+    }
+    memcpy(q->storage + slot * q->item_size, item, q->item_size);
+    q->count++;
+    pthread_cond_signal(&q->not_empty);
+    pthread_mutex_unlock(&q->lock);
+    return pdPASS;
+}
+
+static BaseType_t host_queue_take(QueueHandle_t q, void *item, TickType_t ticks, bool remove) {
+    struct timespec deadline;
+    host_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&q->lock);
+    while (q->count == 0) {
+        if (ticks == 0 || !host_cond_wait(&q->not_empty, &q->lock, ticks, &deadline)) {
+            pthread_mutex_unlock(&q->lock);
+            return errQUEUE_EMPTY;
+        }
+    }
+    memcpy(item, q->storage + q->head * q->item_size, q->item_size);
+    if (remove) {
+        q->head = (q->head + 1) % q->length;
+        q->count--;
+        pthread_cond_signal(&q->not_full);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks) {
+    return host_queue_take(q, item, ticks, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t q, void *item, TickType_t ticks) {
+    return host_queue_take(q, item, ticks, false);
+}
+
+BaseType_t xQueueReset(QueueHandle_t q) {
+    pthread_mutex_lock(&q->lock);
+    q->head = 0;
+    q->count = 0;
+    pthread_cond_broadcast(&q->not_full);
+    pthread_mutex_unlock(&q->lock);
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) {
+    pthread_mutex_lock(&q->lock);
+    UBaseType_t count = q->count;
+    pthread_mutex_unlock(&q->lock);
+    return count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q) {
+    pthread_mutex_lock(&q->lock);
+    UBaseType_t spaces = q->length - q->count;
+    pthread_mutex_unlock(&q->lock);
+    return spaces;
+}
+
+/****************    信号量/互斥锁 ↓   *************************/
+
+struct host_sem {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    UBaseType_t count;
+    UBaseType_t max;
+    bool mutex;
+    bool recursive;
+    struct host_task *owner;
+    UBaseType_t depth;
+};
+
+SemaphoreHandle_t host_sem_create(UBaseType_t max, UBaseType_t initial, bool mutex, bool recursive) {
+    struct host_sem *sem = calloc(1, sizeof(*sem));
+    if (sem == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&sem->lock, NULL);
+    host_cond_init(&sem->cond);
+    sem->count = initial;
+    sem->max = max;
+    sem->mutex = mutex;
+    sem->recursive = recursive;
+    return sem;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    if (sem == NULL) {
+        return;
+    }
+    pthread_mutex_destroy(&sem->lock);
+    pthread_cond_destroy(&sem->cond);
+    free(sem);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    struct host_task *self = host_task_self();
+    struct timespec deadline;
+    host_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&sem->lock);
+    if (sem->mutex && sem->recursive && sem->owner == self) {
+        sem->depth++;
+        pthread_mutex_unlock(&sem->lock);
+        return pdTRUE;
+    }
+    while (sem->count == 0) {
+        if (ticks == 0 || !host_cond_wait(&sem->cond, &sem->lock, ticks, &deadline)) {
+            pthread_mutex_unlock(&sem->lock);
+            return pdFALSE;
+        }
+    }
+    sem->count--;
+    if (sem->mutex) {
+        sem->owner = self;
+        sem->depth = 1;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    pthread_mutex_lock(&sem->lock);
+    if (sem->mutex) {
+        if (sem->owner != current_task) {
+            pthread_mutex_unlock(&sem->lock);
+            return pdFALSE;
+        }
+        if (--sem->depth > 0) {
+            pthread_mutex_unlock(&sem->lock);
+            return pdTRUE;
+        }
+        sem->owner = NULL;
+    }
+    if (sem->count >= sem->max) {
+        pthread_mutex_unlock(&sem->lock);
+        return pdFALSE;
+    }
+    sem->count++;
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->lock);
+    return pdTRUE;
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem) {
+    pthread_mutex_lock(&sem->lock);
+    UBaseType_t count = sem->count;
+    pthread_mutex_unlock(&sem->lock);
+    return count;
+}
+
+/****************    事件组 ↓   *************************/
+
+struct host_event_group {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    EventBits_t bits;
+};
+
+EventGroupHandle_t xEventGroupCreate(void) {
+    struct host_event_group *group = calloc(1, sizeof(*group));
+    if (group == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&group->lock, NULL);
+    host_cond_init(&group->cond);
+    return group;
+}
+
+void vEventGroupDelete(EventGroupHandle_t group) {
+    if (group == NULL) {
+        return;
+    }
+    pthread_mutex_destroy(&group->lock);
+    pthread_cond_destroy(&group->cond);
+    free(group);
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+    pthread_mutex_lock(&group->lock);
+    group->bits |= bits;
+    EventBits_t value = group->bits;
+    pthread_cond_broadcast(&group->cond);
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits) {
+    pthread_mutex_lock(&group->lock);
+    EventBits_t value = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group) {
+    pthread_mutex_lock(&group->lock);
+    EventBits_t value = group->bits;
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t ticks) {
+    struct timespec deadline;
+    host_deadline(ticks, &deadline);
+
+    pthread_mutex_lock(&group->lock);
+    for (;;) {
+        EventBits_t match = group->bits & bits;
+        bool done = wait_for_all ? (match == bits) : (match != 0);
+        if (done) {
+            EventBits_t value = group->bits;
+            if (clear_on_exit) {
+                group->bits &= ~bits;
+            }
+            pthread_mutex_unlock(&group->lock);
+            return value;
+        }
+        if (ticks == 0 || !host_cond_wait(&group->cond, &group->lock, ticks, &deadline)) {
+            break;
+        }
+    }
+    EventBits_t value = group->bits;
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
@@ -0,0 +1,11 @@
+#ifndef HOST_ESP_BIT_DEFS_H
+#define HOST_ESP_BIT_DEFS_H
+
+#ifndef BIT
+#define BIT(nr)     (1UL << (nr))
+#endif
+#ifndef BIT64
+#define BIT64(nr)   (1ULL << (nr))
+#endif
+
+#endif // HOST_ESP_BIT_DEFS_H
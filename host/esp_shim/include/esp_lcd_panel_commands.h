@@ -0,0 +1,20 @@
+#ifndef HOST_ESP_LCD_PANEL_COMMANDS_H
+#define HOST_ESP_LCD_PANEL_COMMANDS_H
+// MIPI DCS通用命令，与ESP-IDF的esp_lcd_panel_commands.h一致(只保留用到的部分)
+
+#define LCD_CMD_NOP          0x00 // This command is empty command
+#define LCD_CMD_SWRESET      0x01 // Software reset registers (the built-in frame buffer is not affected)
+#define LCD_CMD_SLPIN        0x10 // Go into sleep mode (DC/DC, oscillator, scanning stopped, but memory keeps content)
+#define LCD_CMD_SLPOUT       0x11 // Exit sleep mode
+#define LCD_CMD_INVOFF       0x20 // Go into display inversion off mode
+#define LCD_CMD_INVON        0x21 // Go into display inversion on mode
+#define LCD_CMD_DISPOFF      0x28 // Display off (disable frame buffer output)
+#define LCD_CMD_DISPON       0x29 // Display on (enable frame buffer output)
+#define LCD_CMD_CASET        0x2A // Set column address
+#define LCD_CMD_RASET        0x2B // Set row address
+#define LCD_CMD_RAMWR        0x2C // Write frame memory
+#define LCD_CMD_MADCTL       0x36 // Memory data access control
+#define LCD_CMD_COLMOD       0x3A // Defines the format of RGB picture data
+#define LCD_CMD_RAMWRC       0x3C // Continue frame memory write
+
+#endif // HOST_ESP_LCD_PANEL_COMMANDS_H
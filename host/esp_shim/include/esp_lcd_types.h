@@ -0,0 +1,22 @@
+#ifndef HOST_ESP_LCD_TYPES_H
+#define HOST_ESP_LCD_TYPES_H
+
+typedef struct esp_lcd_panel_io_t *esp_lcd_panel_io_handle_t;
+typedef struct esp_lcd_panel_t *esp_lcd_panel_handle_t;
+
+typedef enum {
+    LCD_RGB_ELEMENT_ORDER_RGB = 0,
+    LCD_RGB_ELEMENT_ORDER_BGR,
+} lcd_rgb_element_order_t;
+
+typedef enum {
+    LCD_RGB_ENDIAN_RGB = 0,
+    LCD_RGB_ENDIAN_BGR,
+} lcd_color_rgb_endian_t;
+
+typedef enum {
+    LCD_RGB_DATA_ENDIAN_BIG = 0,
+    LCD_RGB_DATA_ENDIAN_LITTLE,
+} lcd_rgb_data_endian_t;
+
+#endif // HOST_ESP_LCD_TYPES_H
@@ -0,0 +1,38 @@
+#ifndef HOST_ESP_LOG_H
+#define HOST_ESP_LOG_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE,
+} esp_log_level_t;
+
+/**
+ * @brief 设置日志级别，tag为"*"时设置全局级别(主机上只支持全局级别)
+ */
+void esp_log_level_set(const char *tag, esp_log_level_t level);
+uint32_t esp_log_timestamp(void);
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...)
+    __attribute__((format(printf, 3, 4)));
+
+#define ESP_LOG_LEVEL(level, tag, letter, format, ...) \
+    esp_log_write(level, tag, letter " (%lu) %s: " format "\n", (unsigned long)esp_log_timestamp(), tag, ##__VA_ARGS__)
+
+#define ESP_LOGE(tag, format, ...)  ESP_LOG_LEVEL(ESP_LOG_ERROR, tag, "E", format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)  ESP_LOG_LEVEL(ESP_LOG_WARN, tag, "W", format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...)  ESP_LOG_LEVEL(ESP_LOG_INFO, tag, "I", format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...)  ESP_LOG_LEVEL(ESP_LOG_DEBUG, tag, "D", format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...)  ESP_LOG_LEVEL(ESP_LOG_VERBOSE, tag, "V", format, ##__VA_ARGS__)
+
+#define ESP_EARLY_LOGE  ESP_LOGE
+#define ESP_EARLY_LOGW  ESP_LOGW
+#define ESP_EARLY_LOGI  ESP_LOGI
+#define ESP_DRAM_LOGE   ESP_LOGE
+
+#endif // HOST_ESP_LOG_H
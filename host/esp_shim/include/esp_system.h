@@ -0,0 +1,14 @@
+#ifndef HOST_ESP_SYSTEM_H
+#define HOST_ESP_SYSTEM_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_attr.h"
+#include "esp_bit_defs.h"
+#include "esp_idf_version.h"
+
+void esp_restart(void) __attribute__((noreturn));
+uint32_t esp_get_free_heap_size(void);
+uint32_t esp_get_minimum_free_heap_size(void);
+
+#endif // HOST_ESP_SYSTEM_H
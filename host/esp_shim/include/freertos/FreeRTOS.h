@@ -0,0 +1,73 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+// 主机构建用FreeRTOS接口：任务、队列、信号量和事件组映射到pthread
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+#include "esp_attr.h"
+#include "esp_bit_defs.h"
+#include "esp_heap_caps.h"     // ESP-IDF的portmacro.h间接包含，组件代码依赖这一点
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+#define configTICK_RATE_HZ              (1000)
+#define configNUM_CORES                 (2)
+#define portNUM_PROCESSORS              configNUM_CORES
+#define configMAX_PRIORITIES            (25)
+#define configMAX_TASK_NAME_LEN         (16)
+#define configUSE_TRACE_FACILITY        (1)
+#define configGENERATE_RUN_TIME_STATS   (1)
+#define configASSERT(x)                 assert(x)
+
+#define pdFALSE             ((BaseType_t)0)
+#define pdTRUE              ((BaseType_t)1)
+#define pdFAIL              pdFALSE
+#define pdPASS              pdTRUE
+#define errQUEUE_EMPTY      ((BaseType_t)0)
+#define errQUEUE_FULL       ((BaseType_t)0)
+
+#define portMAX_DELAY       ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS  ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000U))
+#define pdTICKS_TO_MS(t)    ((uint32_t)(((uint64_t)(t) * 1000U) / configTICK_RATE_HZ))
+
+/**
+ * @brief 自旋锁占位类型
+ * @note 主机上所有临界区共用一把递归互斥锁，owner字段只为兼容直接初始化它的驱动代码
+ */
+typedef struct {
+    uint32_t owner;
+    uint32_t count;
+} portMUX_TYPE;
+
+#define portMUX_FREE_VAL                (0xB33FFFFFU)
+#define portMUX_INITIALIZER_UNLOCKED    { .owner = portMUX_FREE_VAL, .count = 0 }
+#define portMUX_INITIALIZE(mux)         do { (mux)->owner = portMUX_FREE_VAL; (mux)->count = 0; } while (0)
+
+void host_port_enter_critical(portMUX_TYPE *mux);
+void host_port_exit_critical(portMUX_TYPE *mux);
+
+#define portENTER_CRITICAL(mux)         host_port_enter_critical(mux)
+#define portEXIT_CRITICAL(mux)          host_port_exit_critical(mux)
+#define portENTER_CRITICAL_ISR(mux)     host_port_enter_critical(mux)
+#define portEXIT_CRITICAL_ISR(mux)      host_port_exit_critical(mux)
+#define portENTER_CRITICAL_SAFE(mux)    host_port_enter_critical(mux)
+#define portEXIT_CRITICAL_SAFE(mux)     host_port_exit_critical(mux)
+#define taskENTER_CRITICAL(mux)         host_port_enter_critical(mux)
+#define taskEXIT_CRITICAL(mux)          host_port_exit_critical(mux)
+#define taskENTER_CRITICAL_ISR(mux)     host_port_enter_critical(mux)
+#define taskEXIT_CRITICAL_ISR(mux)      host_port_exit_critical(mux)
+
+#define portYIELD_FROM_ISR(...)         do { } while (0)
+#define portYIELD()                     do { } while (0)
+#define portEND_SWITCHING_ISR(x)        do { (void)(x); } while (0)
+
+BaseType_t xPortGetCoreID(void);
+BaseType_t xPortInIsrContext(void);
+
+#endif // HOST_FREERTOS_H
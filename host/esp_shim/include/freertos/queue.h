@@ -0,0 +1,24 @@
+#ifndef HOST_FREERTOS_QUEUE_H
+#define HOST_FREERTOS_QUEUE_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_queue *QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueGenericSend(QueueHandle_t queue, const void *item, TickType_t ticks, bool to_front);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks);
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t ticks);
+BaseType_t xQueueReset(QueueHandle_t queue);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue);
+
+#define xQueueSend(q, item, ticks)                  xQueueGenericSend((q), (item), (ticks), false)
+#define xQueueSendToBack(q, item, ticks)            xQueueGenericSend((q), (item), (ticks), false)
+#define xQueueSendToFront(q, item, ticks)           xQueueGenericSend((q), (item), (ticks), true)
+#define xQueueSendFromISR(q, item, woken)           xQueueGenericSend((q), (item), 0, false)
+#define xQueueSendToBackFromISR(q, item, woken)     xQueueGenericSend((q), (item), 0, false)
+#define xQueueReceiveFromISR(q, item, woken)        xQueueReceive((q), (item), 0)
+
+#endif // HOST_FREERTOS_QUEUE_H
@@ -0,0 +1,24 @@
+#ifndef HOST_FREERTOS_SEMPHR_H
+#define HOST_FREERTOS_SEMPHR_H
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+typedef struct host_sem *SemaphoreHandle_t;
+
+SemaphoreHandle_t host_sem_create(UBaseType_t max, UBaseType_t initial, bool mutex, bool recursive);
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem);
+
+#define xSemaphoreCreateMutex()                 host_sem_create(1, 1, true, false)
+#define xSemaphoreCreateRecursiveMutex()        host_sem_create(1, 1, true, true)
+#define xSemaphoreCreateBinary()                host_sem_create(1, 0, false, false)
+#define xSemaphoreCreateCounting(max, initial)  host_sem_create((max), (initial), false, false)
+#define xSemaphoreTakeRecursive(sem, ticks)     xSemaphoreTake((sem), (ticks))
+#define xSemaphoreGiveRecursive(sem)            xSemaphoreGive(sem)
+#define xSemaphoreGiveFromISR(sem, woken)       xSemaphoreGive(sem)
+#define xSemaphoreTakeFromISR(sem, woken)       xSemaphoreTake((sem), 0)
+
+#endif // HOST_FREERTOS_SEMPHR_H
@@ -0,0 +1,77 @@
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define tskNO_AFFINITY      ((BaseType_t)0x7FFFFFFF)
+#define tskIDLE_PRIORITY    ((UBaseType_t)0)
+
+typedef enum {
+    eRunning = 0,
+    eReady,
+    eBlocked,
+    eSuspended,
+    eDeleted,
+    eInvalid,
+} eTaskState;
+
+typedef enum {
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite,
+} eNotifyAction;
+
+/**
+ * @note ulRunTimeCounter为线程CPU时间(微秒)，uxTaskGetSystemState的总运行时间为墙钟时间(微秒)
+ */
+typedef struct {
+    TaskHandle_t xHandle;
+    const char *pcTaskName;
+    UBaseType_t xTaskNumber;
+    eTaskState eCurrentState;
+    UBaseType_t uxCurrentPriority;
+    UBaseType_t uxBasePriority;
+    uint32_t ulRunTimeCounter;
+    StackType_t *pxStackBase;
+    uint32_t usStackHighWaterMark;
+    BaseType_t xCoreID;
+} TaskStatus_t;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *out, BaseType_t core);
+
+static inline BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                                     void *arg, UBaseType_t priority, TaskHandle_t *out) {
+    return xTaskCreatePinnedToCore(fn, name, stack_depth, arg, priority, out, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+BaseType_t xTaskDelayUntil(TickType_t *prev_wake, TickType_t increment);
+#define vTaskDelayUntil(prev, inc)  ((void)xTaskDelayUntil((prev), (inc)))
+#define taskYIELD()                 vTaskDelay(0)
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+char *pcTaskGetName(TaskHandle_t task);
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task);
+UBaseType_t uxTaskGetNumberOfTasks(void);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *status, UBaseType_t count, uint32_t *total_runtime);
+
+/* 任务通知(只实现默认索引) */
+BaseType_t xTaskGenericNotify(TaskHandle_t task, uint32_t value, eNotifyAction action, uint32_t *prev_value);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks);
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *value, TickType_t ticks);
+
+#define xTaskNotifyGive(task)                       xTaskGenericNotify((task), 0, eIncrement, NULL)
+#define xTaskNotify(task, value, action)            xTaskGenericNotify((task), (value), (action), NULL)
+#define xTaskNotifyFromISR(task, value, action, woken)  xTaskGenericNotify((task), (value), (action), NULL)
+#define vTaskNotifyGiveFromISR(task, woken)         ((void)xTaskGenericNotify((task), 0, eIncrement, NULL))
+
+#endif // HOST_FREERTOS_TASK_H
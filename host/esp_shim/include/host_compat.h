@@ -0,0 +1,17 @@
+#ifndef HOST_COMPAT_H
+#define HOST_COMPAT_H
+// 主机构建强制包含的兼容声明：补齐newlib有而旧版glibc没有的函数
+
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+size_t strlcpy(char *dst, const char *src, size_t size);
+#endif
+
+// newlib的<sys/cdefs.h>提供，esp_lcd驱动用它从接口结构体取回外层对象
+#ifndef __containerof
+#define __containerof(ptr, type, member) ((type *)((char *)(ptr) - offsetof(type, member)))
+#endif
+
+#endif // HOST_COMPAT_H
@@ -0,0 +1,134 @@
+#ifndef HOST_SIM_H
+#define HOST_SIM_H
+// 主机仿真控制接口：总线时间缩放、外设模型(PCA9557、FT5x06、ST7789)和观测点
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+#include "driver/i2c.h"
+#include "driver/ledc.h"
+#include "driver/spi_master.h"
+
+/* ========== 总线时间 ========== */
+
+/**
+ * @brief 设置总线传输时间缩放
+ * @note 各总线按时钟频率计算传输耗时，乘以scale后真实等待；0表示不等待(最快速度运行)
+ *       默认值取环境变量HOST_BUS_TIME_SCALE，未设置时为1.0(实时)
+ */
+void host_sim_set_bus_time_scale(float scale);
+float host_sim_get_bus_time_scale(void);
+
+/**
+ * @brief 按缩放后的时间等待一段模拟的总线传输
+ */
+void host_sim_bus_delay_us(uint32_t us);
+
+/* ========== GPIO ========== */
+
+/**
+ * @brief 设置输入引脚电平，满足中断条件时在调用线程中执行已注册的ISR
+ */
+void host_gpio_set_input(gpio_num_t gpio_num, int level);
+
+/* ========== LEDC ========== */
+
+/**
+ * @brief 占空比生效回调(ledc_update_duty时调用)
+ * @param channel  通道
+ * @param duty     占空比计数
+ * @param pulse_us 对应的高电平时间(微秒)
+ */
+typedef void (*host_ledc_update_cb_t)(ledc_channel_t channel, uint32_t duty, uint32_t pulse_us, void *ctx);
+
+void host_ledc_set_update_cb(host_ledc_update_cb_t cb, void *ctx);
+uint32_t host_ledc_get_pulse_us(ledc_channel_t channel);
+uint32_t host_ledc_get_update_count(ledc_channel_t channel);
+
+/* ========== I2C ========== */
+
+// I2C从设备模型
+typedef struct {
+    /**
+     * @brief 主机写入(不含地址字节)
+     */
+    esp_err_t (*write)(void *ctx, const uint8_t *data, size_t len);
+    /**
+     * @brief 主机读取
+     */
+    esp_err_t (*read)(void *ctx, uint8_t *data, size_t len);
+    void *ctx;
+} host_i2c_device_t;
+
+// 总线统计
+typedef struct {
+    uint32_t transactions;      ///< 事务数(一次write_read算一次)
+    uint32_t bytes;             ///< 传输的字节数(含地址字节)
+    uint64_t busy_us;           ///< 按时钟频率计算的总线占用时间
+    uint32_t nacks;             ///< 无设备应答的次数
+} host_i2c_stats_t;
+
+esp_err_t host_i2c_attach_device(i2c_port_t port, uint8_t addr, const host_i2c_device_t *dev);
+void host_i2c_get_stats(i2c_port_t port, host_i2c_stats_t *out);
+
+/**
+ * @brief 在I2C总线上挂一个PCA9557 IO扩展芯片模型
+ */
+esp_err_t host_pca9557_attach(i2c_port_t port, uint8_t addr);
+uint8_t host_pca9557_get_output(void);
+/**
+ * @brief 模拟PCA9557掉电复位：寄存器恢复上电默认值
+ */
+void host_pca9557_power_cycle(void);
+
+/**
+ * @brief 在I2C总线上挂一个FT5x06触摸芯片模型
+ * @param int_gpio 中断引脚，GPIO_NUM_NC表示不连接；有触摸数据时拉低
+ */
+esp_err_t host_ft5x06_attach(i2c_port_t port, uint8_t addr, gpio_num_t int_gpio);
+
+/**
+ * @brief 设置触摸点(芯片原始坐标)，points为0表示松开
+ */
+void host_ft5x06_set_points(int points, const uint16_t *x, const uint16_t *y);
+
+/**
+ * @brief 直接写触摸芯片的寄存器(不产生总线事务，不改变INT电平)，用于构造任意的寄存器内容
+ */
+void host_ft5x06_write_regs(uint8_t reg, const uint8_t *data, size_t len);
+
+/* ========== SPI LCD ========== */
+
+// LCD传输统计
+typedef struct {
+    uint32_t commands;          ///< 命令/参数事务数
+    uint32_t color_transfers;   ///< 颜色数据事务数
+    uint64_t color_bytes;       ///< 颜色数据字节数
+    uint64_t busy_us;           ///< 按像素时钟计算的总线占用时间
+    uint32_t max_inflight;      ///< 同时排队的颜色事务最大数量
+} host_lcd_stats_t;
+
+/**
+ * @brief 在SPI总线上挂一个ST7789控制器模型
+ * @note 显存按地址空间(列,行)保存，分辨率为width x height，超出部分丢弃
+ */
+esp_err_t host_st7789_attach(spi_host_device_t host, int width, int height);
+
+/**
+ * @brief 获取显存(RGB565，总线上的大端数据已还原)
+ */
+const uint16_t *host_st7789_framebuffer(int *width, int *height);
+bool host_st7789_display_on(void);
+esp_err_t host_st7789_save_ppm(const char *path);
+void host_lcd_get_stats(host_lcd_stats_t *out);
+
+/**
+ * @brief 设置每个SPI事务的固定开销(设置事务、CS/DC切换、DMA启动)，默认0表示只按字节数计时
+ * @param cmd_us 每个命令/参数事务
+ * @param color_us 每个颜色数据事务
+ */
+void host_lcd_set_trans_overhead_us(uint32_t cmd_us, uint32_t color_us);
+
+#endif // HOST_SIM_H
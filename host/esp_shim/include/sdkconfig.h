@@ -0,0 +1,10 @@
+#ifndef HOST_SDKCONFIG_H
+#define HOST_SDKCONFIG_H
+// 主机构建用的sdkconfig，只包含托管组件用到的选项
+
+#define CONFIG_ESP_LCD_TOUCH_MAX_POINTS     5
+#define CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS    1
+#define CONFIG_FREERTOS_HZ                  1000
+#define CONFIG_FREERTOS_NUMBER_OF_CORES     2
+
+#endif // HOST_SDKCONFIG_H
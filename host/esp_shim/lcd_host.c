@@ -0,0 +1,725 @@
+// 主机上的esp_lcd：SPI/I2C面板IO、ST7789面板驱动和ST7789控制器模型
+// SPI面板IO按esp_lcd的规则排队：颜色数据异步传输(最多trans_queue_depth个在途)，
+// 命令/参数是轮询传输，发送前要等待所有在途的颜色传输完成；不带命令(lcd_cmd<0)的颜色数据
+// 直接排队，接着上一次RAMWR写入(ESP-IDF v5.1起的行为)
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_io_interface.h"
+#include "esp_lcd_panel_interface.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_vendor.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/i2c.h"
+#include "driver/spi_master.h"
+#include "host_sim.h"
+
+static const char *TAG = "host_lcd";
+
+/****************    ST7789控制器模型 ↓   *************************/
+
+#define ST7789_SWRESET  (0x01)
+#define ST7789_SLPIN    (0x10)
+#define ST7789_SLPOUT   (0x11)
+#define ST7789_INVOFF   (0x20)
+#define ST7789_INVON    (0x21)
+#define ST7789_DISPOFF  (0x28)
+#define ST7789_DISPON   (0x29)
+#define ST7789_CASET    (0x2A)
+#define ST7789_RASET    (0x2B)
+#define ST7789_RAMWR    (0x2C)
+#define ST7789_MADCTL   (0x36)
+#define ST7789_COLMOD   (0x3A)
+
+#define ST7789_MADCTL_MY    (1 << 7)
+#define ST7789_MADCTL_MX    (1 << 6)
+#define ST7789_MADCTL_MV    (1 << 5)
+#define ST7789_MADCTL_BGR   (1 << 3)
+
+static struct {
+    bool attached;
+    spi_host_device_t host;
+    int width;
+    int height;
+    uint16_t *fb;               ///< 地址空间显存(RGB565)
+    uint16_t x0, x1, y0, y1;    ///< CASET/RASET设置的窗口
+    int cx, cy;                 ///< RAMWR写指针
+    uint8_t madctl;
+    uint8_t colmod;
+    bool sleeping;
+    bool display_on;
+    bool inverted;
+    pthread_mutex_t lock;
+} st7789 = {
+    .sleeping = true,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+esp_err_t host_st7789_attach(spi_host_device_t host, int width, int height) {
+    if (width <= 0 || height <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&st7789.lock);
+    free(st7789.fb);
+    st7789.fb = calloc((size_t)width * height, sizeof(uint16_t));
+    st7789.attached = st7789.fb != NULL;
+    st7789.host = host;
+    st7789.width = width;
+    st7789.height = height;
+    pthread_mutex_unlock(&st7789.lock);
+    return st7789.attached ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+static bool st7789_selected(spi_host_device_t host) {
+    return st7789.attached && st7789.host == host;
+}
+
+/**
+ * @brief 执行一条命令(不含RAMWR的像素数据)
+ */
+static void st7789_command(uint8_t cmd, const uint8_t *param, size_t len) {
+    pthread_mutex_lock(&st7789.lock);
+    switch (cmd) {
+        case ST7789_SWRESET:
+            st7789.madctl = 0;
+            st7789.sleeping = true;
+            st7789.display_on = false;
+            st7789.inverted = false;
+            st7789.x0 = st7789.y0 = 0;
+            st7789.x1 = st7789.y1 = 0xFFFF;
+            break;
+        case ST7789_SLPIN: st7789.sleeping = true; break;
+        case ST7789_SLPOUT: st7789.sleeping = false; break;
+        case ST7789_INVOFF: st7789.inverted = false; break;
+        case ST7789_INVON: st7789.inverted = true; break;
+        case ST7789_DISPOFF: st7789.display_on = false; break;
+        case ST7789_DISPON: st7789.display_on = true; break;
+        case ST7789_CASET:
+            if (len >= 4) {
+                st7789.x0 = (uint16_t)(param[0] << 8 | param[1]);
+                st7789.x1 = (uint16_t)(param[2] << 8 | param[3]);
+            }
+            break;
+        case ST7789_RASET:
+            if (len >= 4) {
+                st7789.y0 = (uint16_t)(param[0] << 8 | param[1]);
+                st7789.y1 = (uint16_t)(param[2] << 8 | param[3]);
+            }
+            break;
+        case ST7789_MADCTL:
+            if (len >= 1) {
+                st7789.madctl = param[0];
+            }
+            break;
+        case ST7789_COLMOD:
+            if (len >= 1) {
+                st7789.colmod = param[0];
+            }
+            break;
+        default:
+            break;
+    }
+    if (cmd == ST7789_RAMWR) {
+        st7789.cx = st7789.x0;
+        st7789.cy = st7789.y0;
+    }
+    pthread_mutex_unlock(&st7789.lock);
+}
+
+/**
+ * @brief 写入像素数据：按列递增、到窗口右边界换行，总线上为大端RGB565
+ * @note MADCTL只记录不参与寻址，显存即LVGL看到的逻辑画面
+ */
+static void st7789_write_pixels(const uint8_t *data, size_t len) {
+    pthread_mutex_lock(&st7789.lock);
+    for (size_t i = 0; i + 1 < len; i += 2) {
+        if (st7789.cx < st7789.width && st7789.cy < st7789.height) {
+            st7789.fb[st7789.cy * st7789.width + st7789.cx] = (uint16_t)(data[i] << 8 | data[i + 1]);
+        }
+        if (++st7789.cx > st7789.x1) {
+            st7789.cx = st7789.x0;
+            if (++st7789.cy > st7789.y1) {
+                st7789.cy = st7789.y0;
+            }
+        }
+    }
+    pthread_mutex_unlock(&st7789.lock);
+}
+
+const uint16_t *host_st7789_framebuffer(int *width, int *height) {
+    if (width) {
+        *width = st7789.width;
+    }
+    if (height) {
+        *height = st7789.height;
+    }
+    return st7789.fb;
+}
+
+bool host_st7789_display_on(void) {
+    pthread_mutex_lock(&st7789.lock);
+    bool on = st7789.display_on && !st7789.sleeping;
+    pthread_mutex_unlock(&st7789.lock);
+    return on;
+}
+
+esp_err_t host_st7789_save_ppm(const char *path) {
+    if (!st7789.attached) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return ESP_FAIL;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", st7789.width, st7789.height);
+    pthread_mutex_lock(&st7789.lock);
+    for (int i = 0; i < st7789.width * st7789.height; i++) {
+        uint16_t c = st7789.fb[i];
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31),
+        };
+        fwrite(rgb, 1, sizeof(rgb), f);
+    }
+    pthread_mutex_unlock(&st7789.lock);
+    fclose(f);
+    return ESP_OK;
+}
+
+/****************    SPI总线 ↓   *************************/
+
+static bool spi_bus_initialized[SPI_HOST_MAX];
+
+esp_err_t spi_bus_initialize(spi_host_device_t host_id, const spi_bus_config_t *bus_config, spi_dma_chan_t dma_chan) {
+    (void)dma_chan;
+    if (host_id <= SPI1_HOST || host_id >= SPI_HOST_MAX || bus_config == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (spi_bus_initialized[host_id]) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    spi_bus_initialized[host_id] = true;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host_id) {
+    if (host_id <= SPI1_HOST || host_id >= SPI_HOST_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    spi_bus_initialized[host_id] = false;
+    return ESP_OK;
+}
+
+/****************    SPI面板IO ↓   *************************/
+
+typedef struct {
+    const uint8_t *data;
+    size_t len;
+    uint32_t overhead_us;
+} host_spi_trans_t;
+
+typedef struct {
+    struct esp_lcd_panel_io_t base;
+    spi_host_device_t host;
+    uint32_t pclk_hz;
+    size_t queue_depth;
+    esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done;
+    void *user_ctx;
+    host_spi_trans_t *queue;    ///< 在途颜色事务环形队列
+    size_t head;
+    size_t count;
+    bool stop;
+    pthread_t worker;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    host_lcd_stats_t stats;
+} host_spi_io_t;
+
+static host_spi_io_t *lcd_stats_io = NULL;     // 统计取自最近创建的SPI面板IO
+static uint32_t spi_cmd_overhead_us = 0;        // 每个轮询事务的固定开销
+static uint32_t spi_color_overhead_us = 0;      // 每个颜色事务的固定开销
+
+/**
+ * @brief 按像素时钟计算传输耗时(微秒)
+ */
+static uint32_t spi_io_bus_us(host_spi_io_t *io, size_t bytes) {
+    return (uint32_t)((uint64_t)bytes * 8 * 1000000ULL / io->pclk_hz);
+}
+
+void host_lcd_set_trans_overhead_us(uint32_t cmd_us, uint32_t color_us) {
+    __atomic_store_n(&spi_cmd_overhead_us, cmd_us, __ATOMIC_RELAXED);
+    __atomic_store_n(&spi_color_overhead_us, color_us, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief DMA工作线程：依次完成排队的颜色事务，完成后调用on_color_trans_done(相当于SPI中断)
+ */
+static void *spi_io_worker(void *arg) {
+    host_spi_io_t *io = arg;
+    pthread_setname_np(pthread_self(), "spi_dma");
+
+    pthread_mutex_lock(&io->lock);
+    while (true) {
+        while (io->count == 0 && !io->stop) {
+            pthread_cond_wait(&io->cond, &io->lock);
+        }
+        if (io->count == 0 && io->stop) {
+            break;
+        }
+        host_spi_trans_t trans = io->queue[io->head];
+        pthread_mutex_unlock(&io->lock);
+
+        host_sim_bus_delay_us(spi_io_bus_us(io, trans.len) + trans.overhead_us);
+        // 传输结束时才读取缓冲区：调用者提前改写缓冲区会在画面上体现出来
+        if (st7789_selected(io->host)) {
+            st7789_write_pixels(trans.data, trans.len);
+        }
+
+        pthread_mutex_lock(&io->lock);
+        io->head = (io->head + 1) % io->queue_depth;
+        io->count--;
+        esp_lcd_panel_io_color_trans_done_cb_t cb = io->on_color_trans_done;
+        void *user_ctx = io->user_ctx;
+        pthread_cond_broadcast(&io->cond);
+        pthread_mutex_unlock(&io->lock);
+
+        if (cb) {
+            cb(&io->base, NULL, user_ctx);
+        }
+        pthread_mutex_lock(&io->lock);
+    }
+    pthread_mutex_unlock(&io->lock);
+    return NULL;
+}
+
+/**
+ * @brief 等待在途的颜色事务全部完成(轮询传输前必须这样做)
+ */
+static void spi_io_drain(host_spi_io_t *io) {
+    pthread_mutex_lock(&io->lock);
+    while (io->count) {
+        pthread_cond_wait(&io->cond, &io->lock);
+    }
+    pthread_mutex_unlock(&io->lock);
+}
+
+/**
+ * @brief 轮询发送命令和参数
+ */
+static void spi_io_polling_cmd(host_spi_io_t *io, int lcd_cmd, const void *param, size_t param_size) {
+    spi_io_drain(io);
+    size_t bytes = (lcd_cmd >= 0 ? 1 : 0) + param_size;
+    uint32_t us = spi_io_bus_us(io, bytes) + __atomic_load_n(&spi_cmd_overhead_us, __ATOMIC_RELAXED);
+    host_sim_bus_delay_us(us);
+    if (lcd_cmd >= 0 && st7789_selected(io->host)) {
+        st7789_command((uint8_t)lcd_cmd, param, param_size);
+    }
+    pthread_mutex_lock(&io->lock);
+    io->stats.commands++;
+    io->stats.busy_us += us;
+    pthread_mutex_unlock(&io->lock);
+}
+
+static esp_err_t spi_io_rx_param(esp_lcd_panel_io_t *io, int lcd_cmd, void *param, size_t param_size) {
+    (void)io;
+    (void)lcd_cmd;
+    memset(param, 0, param_size);   // 模型没有MISO
+    return ESP_OK;
+}
+
+static esp_err_t spi_io_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size) {
+    spi_io_polling_cmd(__containerof(io, host_spi_io_t, base), lcd_cmd, param, param_size);
+    return ESP_OK;
+}
+
+static esp_err_t spi_io_tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size) {
+    host_spi_io_t *spi_io = __containerof(io, host_spi_io_t, base);
+    if (lcd_cmd >= 0) {
+        spi_io_polling_cmd(spi_io, lcd_cmd, NULL, 0);
+    }
+
+    pthread_mutex_lock(&spi_io->lock);
+    while (spi_io->count >= spi_io->queue_depth) {
+        pthread_cond_wait(&spi_io->cond, &spi_io->lock);
+    }
+    size_t tail = (spi_io->head + spi_io->count) % spi_io->queue_depth;
+    spi_io->queue[tail].data = color;
+    spi_io->queue[tail].len = color_size;
+    spi_io->queue[tail].overhead_us = __atomic_load_n(&spi_color_overhead_us, __ATOMIC_RELAXED);
+    spi_io->count++;
+    spi_io->stats.color_transfers++;
+    spi_io->stats.color_bytes += color_size;
+    spi_io->stats.busy_us += spi_io_bus_us(spi_io, color_size) + spi_io->queue[tail].overhead_us;
+    if (spi_io->count > spi_io->stats.max_inflight) {
+        spi_io->stats.max_inflight = (uint32_t)spi_io->count;
+    }
+    pthread_cond_broadcast(&spi_io->cond);
+    pthread_mutex_unlock(&spi_io->lock);
+    return ESP_OK;
+}
+
+static esp_err_t spi_io_register_event_callbacks(esp_lcd_panel_io_t *io, const esp_lcd_panel_io_callbacks_t *cbs,
+                                                 void *user_ctx) {
+    host_spi_io_t *spi_io = __containerof(io, host_spi_io_t, base);
+    pthread_mutex_lock(&spi_io->lock);
+    spi_io->on_color_trans_done = cbs->on_color_trans_done;
+    spi_io->user_ctx = user_ctx;
+    pthread_mutex_unlock(&spi_io->lock);
+    return ESP_OK;
+}
+
+static esp_err_t spi_io_del(esp_lcd_panel_io_t *io) {
+    host_spi_io_t *spi_io = __containerof(io, host_spi_io_t, base);
+    pthread_mutex_lock(&spi_io->lock);
+    spi_io->stop = true;
+    pthread_cond_broadcast(&spi_io->cond);
+    pthread_mutex_unlock(&spi_io->lock);
+    pthread_join(spi_io->worker, NULL);
+    if (lcd_stats_io == spi_io) {
+        lcd_stats_io = NULL;
+    }
+    pthread_mutex_destroy(&spi_io->lock);
+    pthread_cond_destroy(&spi_io->cond);
+    free(spi_io->queue);
+    free(spi_io);
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_new_panel_io_spi(esp_lcd_spi_bus_handle_t bus, const esp_lcd_panel_io_spi_config_t *io_config,
+                                   esp_lcd_panel_io_handle_t *ret_io) {
+    ESP_RETURN_ON_FALSE(io_config && ret_io && io_config->pclk_hz, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(bus > SPI1_HOST && bus < SPI_HOST_MAX && spi_bus_initialized[bus], ESP_ERR_INVALID_STATE,
+                        TAG, "spi bus %d not initialized", bus);
+
+    host_spi_io_t *io = calloc(1, sizeof(host_spi_io_t));
+    ESP_RETURN_ON_FALSE(io, ESP_ERR_NO_MEM, TAG, "no mem for panel io");
+    io->queue_depth = io_config->trans_queue_depth ? io_config->trans_queue_depth : 1;
+    io->queue = calloc(io->queue_depth, sizeof(host_spi_trans_t));
+    if (io->queue == NULL) {
+        free(io);
+        return ESP_ERR_NO_MEM;
+    }
+    io->host = (spi_host_device_t)bus;
+    io->pclk_hz = io_config->pclk_hz;
+    io->on_color_trans_done = io_config->on_color_trans_done;
+    io->user_ctx = io_config->user_ctx;
+    io->base.rx_param = spi_io_rx_param;
+    io->base.tx_param = spi_io_tx_param;
+    io->base.tx_color = spi_io_tx_color;
+    io->base.del = spi_io_del;
+    io->base.register_event_callbacks = spi_io_register_event_callbacks;
+    pthread_mutex_init(&io->lock, NULL);
+    pthread_cond_init(&io->cond, NULL);
+    if (pthread_create(&io->worker, NULL, spi_io_worker, io) != 0) {
+        free(io->queue);
+        free(io);
+        return ESP_ERR_NO_MEM;
+    }
+    lcd_stats_io = io;
+    *ret_io = &io->base;
+    return ESP_OK;
+}
+
+void host_lcd_get_stats(host_lcd_stats_t *out) {
+    memset(out, 0, sizeof(*out));
+    host_spi_io_t *io = lcd_stats_io;
+    if (io) {
+        pthread_mutex_lock(&io->lock);
+        *out = io->stats;
+        pthread_mutex_unlock(&io->lock);
+    }
+}
+
+/****************    I2C面板IO ↓   *************************/
+
+typedef struct {
+    struct esp_lcd_panel_io_t base;
+    i2c_port_t port;
+    uint8_t dev_addr;
+    esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done;
+    void *user_ctx;
+} host_i2c_io_t;
+
+static esp_err_t i2c_io_rx_param(esp_lcd_panel_io_t *io, int lcd_cmd, void *param, size_t param_size) {
+    host_i2c_io_t *i2c_io = __containerof(io, host_i2c_io_t, base);
+    if (lcd_cmd < 0) {
+        return i2c_master_read_from_device(i2c_io->port, i2c_io->dev_addr, param, param_size, portMAX_DELAY);
+    }
+    uint8_t cmd = (uint8_t)lcd_cmd;
+    return i2c_master_write_read_device(i2c_io->port, i2c_io->dev_addr, &cmd, 1, param, param_size, portMAX_DELAY);
+}
+
+static esp_err_t i2c_io_tx(host_i2c_io_t *i2c_io, int lcd_cmd, const void *data, size_t size) {
+    uint8_t *buf = malloc(size + 1);
+    if (buf == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    size_t len = 0;
+    if (lcd_cmd >= 0) {
+        buf[len++] = (uint8_t)lcd_cmd;
+    }
+    if (size) {
+        memcpy(buf + len, data, size);
+        len += size;
+    }
+    esp_err_t ret = i2c_master_write_to_device(i2c_io->port, i2c_io->dev_addr, buf, len, portMAX_DELAY);
+    free(buf);
+    return ret;
+}
+
+static esp_err_t i2c_io_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size) {
+    return i2c_io_tx(__containerof(io, host_i2c_io_t, base), lcd_cmd, param, param_size);
+}
+
+static esp_err_t i2c_io_tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size) {
+    host_i2c_io_t *i2c_io = __containerof(io, host_i2c_io_t, base);
+    esp_err_t ret = i2c_io_tx(i2c_io, lcd_cmd, color, color_size);
+    if (ret == ESP_OK && i2c_io->on_color_trans_done) {
+        i2c_io->on_color_trans_done(io, NULL, i2c_io->user_ctx);
+    }
+    return ret;
+}
+
+static esp_err_t i2c_io_register_event_callbacks(esp_lcd_panel_io_t *io, const esp_lcd_panel_io_callbacks_t *cbs,
+                                                 void *user_ctx) {
+    host_i2c_io_t *i2c_io = __containerof(io, host_i2c_io_t, base);
+    i2c_io->on_color_trans_done = cbs->on_color_trans_done;
+    i2c_io->user_ctx = user_ctx;
+    return ESP_OK;
+}
+
+static esp_err_t i2c_io_del(esp_lcd_panel_io_t *io) {
+    free(__containerof(io, host_i2c_io_t, base));
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_new_panel_io_i2c(esp_lcd_i2c_bus_handle_t bus, const esp_lcd_panel_io_i2c_config_t *io_config,
+                                   esp_lcd_panel_io_handle_t *ret_io) {
+    ESP_RETURN_ON_FALSE(io_config && ret_io && bus >= 0 && bus < I2C_NUM_MAX, ESP_ERR_INVALID_ARG, TAG,
+                        "invalid argument");
+    host_i2c_io_t *io = calloc(1, sizeof(host_i2c_io_t));
+    ESP_RETURN_ON_FALSE(io, ESP_ERR_NO_MEM, TAG, "no mem for panel io");
+    io->port = bus;
+    io->dev_addr = (uint8_t)io_config->dev_addr;
+    io->on_color_trans_done = io_config->on_color_trans_done;
+    io->user_ctx = io_config->user_ctx;
+    io->base.rx_param = i2c_io_rx_param;
+    io->base.tx_param = i2c_io_tx_param;
+    io->base.tx_color = i2c_io_tx_color;
+    io->base.del = i2c_io_del;
+    io->base.register_event_callbacks = i2c_io_register_event_callbacks;
+    *ret_io = &io->base;
+    return ESP_OK;
+}
+
+/****************    面板IO接口 ↓   *************************/
+
+esp_err_t esp_lcd_panel_io_rx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, void *param, size_t param_size) {
+    ESP_RETURN_ON_FALSE(io, ESP_ERR_INVALID_ARG, TAG, "invalid panel io handle");
+    return io->rx_param(io, lcd_cmd, param, param_size);
+}
+
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param, size_t param_size) {
+    ESP_RETURN_ON_FALSE(io, ESP_ERR_INVALID_ARG, TAG, "invalid panel io handle");
+    return io->tx_param(io, lcd_cmd, param, param_size);
+}
+
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *color, size_t color_size) {
+    ESP_RETURN_ON_FALSE(io, ESP_ERR_INVALID_ARG, TAG, "invalid panel io handle");
+    return io->tx_color(io, lcd_cmd, color, color_size);
+}
+
+esp_err_t esp_lcd_panel_io_del(esp_lcd_panel_io_handle_t io) {
+    return io ? io->del(io) : ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_register_event_callbacks(esp_lcd_panel_io_handle_t io,
+                                                    const esp_lcd_panel_io_callbacks_t *cbs, void *user_ctx) {
+    ESP_RETURN_ON_FALSE(io && cbs, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    return io->register_event_callbacks(io, cbs, user_ctx);
+}
+
+/****************    ST7789面板驱动 ↓   *************************/
+
+// 与esp_lcd中的ST7789驱动一致：命令序列相同，复位/退出睡眠后的等待也相同
+typedef struct {
+    esp_lcd_panel_t base;
+    esp_lcd_panel_io_handle_t io;
+    int x_gap;
+    int y_gap;
+    uint8_t madctl;
+    uint8_t colmod;
+    int bytes_per_pixel;
+} host_st7789_panel_t;
+
+static esp_err_t st7789_panel_reset(esp_lcd_panel_t *panel) {
+    host_st7789_panel_t *st = __containerof(panel, host_st7789_panel_t, base);
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(st->io, ST7789_SWRESET, NULL, 0), TAG, "send command failed");
+    vTaskDelay(pdMS_TO_TICKS(20));
+    return ESP_OK;
+}
+
+static esp_err_t st7789_panel_init(esp_lcd_panel_t *panel) {
+    host_st7789_panel_t *st = __containerof(panel, host_st7789_panel_t, base);
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(st->io, ST7789_SLPOUT, NULL, 0), TAG, "send command failed");
+    vTaskDelay(pdMS_TO_TICKS(100));
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(st->io, ST7789_MADCTL, &st->madctl, 1), TAG, "send command failed");
+    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(st->io, ST7789_COLMOD, &st->colmod, 1), TAG, "send command failed");
+    return ESP_OK;
+}
+
+static esp_err_t st7789_panel_del(esp_lcd_panel_t *panel) {
+    free(__containerof(panel, host_st7789_panel_t, base));
+    return ESP_OK;
+}
+
+static esp_err_t st7789_panel_draw_bitmap(esp_lcd_panel_t *panel, int x_start, int y_start, int x_end, int y_end,
+                                          const void *color_data) {
+    host_st7789_panel_t *st = __containerof(panel, host_st7789_panel_t, base);
+    ESP_RETURN_ON_FALSE(x_start < x_end && y_start < y_end, ESP_ERR_INVALID_ARG, TAG,
+                        "start position must be smaller than end position");
+    x_start += st->x_gap;
+    x_end += st->x_gap;
+    y_start += st->y_gap;
+    y_end += st->y_gap;
+
+    const uint8_t caset[4] = {
+        (uint8_t)(x_start >> 8), (uint8_t)x_start, (uint8_t)((x_end - 1) >> 8), (uint8_t)(x_end - 1),
+    };
+    const uint8_t raset[4] = {
+        (uint8_t)(y_start >> 8), (uint8_t)y_start, (uint8_t)((y_end - 1) >> 8), (uint8_t)(y_end - 1),
+    };
+    esp_lcd_panel_io_tx_param(st->io, ST7789_CASET, caset, sizeof(caset));
+    esp_lcd_panel_io_tx_param(st->io, ST7789_RASET, raset, sizeof(raset));
+    size_t len = (size_t)(x_end - x_start) * (y_end - y_start) * st->bytes_per_pixel;
+    esp_lcd_panel_io_tx_color(st->io, ST7789_RAMWR, color_data, len);
+    return ESP_OK;
+}
+
+static esp_err_t st7789_panel_invert_color(esp_lcd_panel_t *panel, bool invert_color_data) {
+    host_st7789_panel_t *st = __containerof(panel, host_st7789_panel_t, base);
+    return esp_lcd_panel_io_tx_param(st->io, invert_color_data ? ST7789_INVON : ST7789_INVOFF, NULL, 0);
+}
+
+static esp_err_t st7789_panel_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y) {
+    host_st7789_panel_t *st = __containerof(panel, host_st7789_panel_t, base);
+    st->madctl = (uint8_t)(mirror_x ? st->madctl | ST7789_MADCTL_MX : st->madctl & ~ST7789_MADCTL_MX);
+    st->madctl = (uint8_t)(mirror_y ? st->madctl | ST7789_MADCTL_MY : st->madctl & ~ST7789_MADCTL_MY);
+    return esp_lcd_panel_io_tx_param(st->io, ST7789_MADCTL, &st->madctl, 1);
+}
+
+static esp_err_t st7789_panel_swap_xy(esp_lcd_panel_t *panel, bool swap_axes) {
+    host_st7789_panel_t *st = __containerof(panel, host_st7789_panel_t, base);
+    st->madctl = (uint8_t)(swap_axes ? st->madctl | ST7789_MADCTL_MV : st->madctl & ~ST7789_MADCTL_MV);
+    return esp_lcd_panel_io_tx_param(st->io, ST7789_MADCTL, &st->madctl, 1);
+}
+
+static esp_err_t st7789_panel_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap) {
+    host_st7789_panel_t *st = __containerof(panel, host_st7789_panel_t, base);
+    st->x_gap = x_gap;
+    st->y_gap = y_gap;
+    return ESP_OK;
+}
+
+static esp_err_t st7789_panel_disp_on_off(esp_lcd_panel_t *panel, bool on_off) {
+    host_st7789_panel_t *st = __containerof(panel, host_st7789_panel_t, base);
+    return esp_lcd_panel_io_tx_param(st->io, on_off ? ST7789_DISPON : ST7789_DISPOFF, NULL, 0);
+}
+
+static esp_err_t st7789_panel_disp_sleep(esp_lcd_panel_t *panel, bool sleep) {
+    host_st7789_panel_t *st = __containerof(panel, host_st7789_panel_t, base);
+    esp_err_t ret = esp_lcd_panel_io_tx_param(st->io, sleep ? ST7789_SLPIN : ST7789_SLPOUT, NULL, 0);
+    vTaskDelay(pdMS_TO_TICKS(100));
+    return ret;
+}
+
+esp_err_t esp_lcd_new_panel_st7789(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config,
+                                   esp_lcd_panel_handle_t *ret_panel) {
+    ESP_RETURN_ON_FALSE(io && panel_dev_config && ret_panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    uint8_t colmod;
+    switch (panel_dev_config->bits_per_pixel) {
+        case 16: colmod = 0x55; break;
+        case 18: colmod = 0x66; break;
+        default:
+            ESP_LOGE(TAG, "unsupported pixel width %u", panel_dev_config->bits_per_pixel);
+            return ESP_ERR_NOT_SUPPORTED;
+    }
+    host_st7789_panel_t *st = calloc(1, sizeof(host_st7789_panel_t));
+    ESP_RETURN_ON_FALSE(st, ESP_ERR_NO_MEM, TAG, "no mem for st7789 panel");
+    st->io = io;
+    st->colmod = colmod;
+    st->bytes_per_pixel = panel_dev_config->bits_per_pixel == 16 ? 2 : 3;
+    st->madctl = panel_dev_config->rgb_ele_order == LCD_RGB_ELEMENT_ORDER_BGR ? ST7789_MADCTL_BGR : 0;
+    st->base.reset = st7789_panel_reset;
+    st->base.init = st7789_panel_init;
+    st->base.del = st7789_panel_del;
+    st->base.draw_bitmap = st7789_panel_draw_bitmap;
+    st->base.invert_color = st7789_panel_invert_color;
+    st->base.mirror = st7789_panel_mirror;
+    st->base.swap_xy = st7789_panel_swap_xy;
+    st->base.set_gap = st7789_panel_set_gap;
+    st->base.disp_on_off = st7789_panel_disp_on_off;
+    st->base.disp_sleep = st7789_panel_disp_sleep;
+    *ret_panel = &st->base;
+    return ESP_OK;
+}
+
+/****************    面板接口 ↓   *************************/
+
+esp_err_t esp_lcd_panel_reset(esp_lcd_panel_handle_t panel) {
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid panel handle");
+    return panel->reset(panel);
+}
+
+esp_err_t esp_lcd_panel_init(esp_lcd_panel_handle_t panel) {
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid panel handle");
+    return panel->init(panel);
+}
+
+esp_err_t esp_lcd_panel_del(esp_lcd_panel_handle_t panel) {
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid panel handle");
+    return panel->del(panel);
+}
+
+esp_err_t esp_lcd_panel_draw_bitmap(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end,
+                                    const void *color_data) {
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid panel handle");
+    return panel->draw_bitmap(panel, x_start, y_start, x_end, y_end, color_data);
+}
+
+esp_err_t esp_lcd_panel_mirror(esp_lcd_panel_handle_t panel, bool mirror_x, bool mirror_y) {
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid panel handle");
+    return panel->mirror ? panel->mirror(panel, mirror_x, mirror_y) : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_lcd_panel_swap_xy(esp_lcd_panel_handle_t panel, bool swap_axes) {
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid panel handle");
+    return panel->swap_xy ? panel->swap_xy(panel, swap_axes) : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_lcd_panel_set_gap(esp_lcd_panel_handle_t panel, int x_gap, int y_gap) {
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid panel handle");
+    return panel->set_gap ? panel->set_gap(panel, x_gap, y_gap) : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_lcd_panel_invert_color(esp_lcd_panel_handle_t panel, bool invert_color_data) {
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid panel handle");
+    return panel->invert_color ? panel->invert_color(panel, invert_color_data) : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_lcd_panel_disp_on_off(esp_lcd_panel_handle_t panel, bool on_off) {
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid panel handle");
+    return panel->disp_on_off ? panel->disp_on_off(panel, on_off) : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_lcd_panel_disp_sleep(esp_lcd_panel_handle_t panel, bool sleep) {
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid panel handle");
+    return panel->disp_sleep ? panel->disp_sleep(panel, sleep) : ESP_ERR_NOT_SUPPORTED;
+}
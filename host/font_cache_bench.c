@@ -0,0 +1,308 @@
+// 字形缓存的主机基准：用Montserrat和SimSun CJK字体反复绘制一段文字，输出每帧渲染耗时、查找字形耗时和缓存命中率。
+// 另外把Montserrat的字距类表转成字距对表(lv_font_conv不加--force-fast-kern-format时的格式)，测字距缓存。
+// 校验：缓存命中与每次清空缓存后查找的结果一致，冷缓存和热缓存绘制的画面一致，字距对表与字距类表的结果一致。
+// font_cache_bench链接打开缓存的LVGL(LV_FONT_FMT_TXT_CACHE_SIZE为32)，另外校验每个字体都有命中统计且字形命中不为0；
+// font_cache_bench_off链接应用默认不带缓存的LVGL作对比，两边输出的画面哈希应相同
+//
+//   ./build_host/font_cache_bench [帧数]
+//   ./build_host/font_cache_bench_off [帧数]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "lvgl.h"
+
+#define BENCH_DEFAULT_FRAMES    (101)   // 取每帧渲染耗时的中位数
+#define BENCH_HOR_RES           (320)
+#define BENCH_VER_RES           (240)
+#define BENCH_TEXT_WIDTH        (300)
+#define BENCH_LOOKUP_ROUNDS     (200)   // 查找字形的微基准每次重复遍历文字的次数
+#define BENCH_REPEAT            (7)     // 查找字形的微基准重复次数，取最快的一次
+#define BENCH_MAX_LETTERS       (512)
+
+static const char text_en[] =
+    "The servo tool drives a hobby servo from 0 to 180 degrees. Tap a preset, drag the slider or start a "
+    "sweep; the angle label, the pulse width and the scan range are redrawn while the servo moves. Every "
+    "refresh looks up each glyph again, so the same few letters are searched over and over.";
+static const char text_cjk[] =
+    "這是一個用來試驗字體的段落。畫面上的文字每次更新都要重新查找字形，常用的字會重複出現，所以命中的比例很高。"
+    "中文字體有一千多個字形，每個字都要在表裡二分查找，比英文費時得多。我們在主機上重複畫這段文字，"
+    "比較每次的時間，並統計命中的比例。角度、速度和範圍都顯示在畫面上。";
+
+typedef struct {
+    const char *name;
+    const lv_font_t *font;
+    const char *text;
+} bench_case_t;
+
+static lv_font_t pair_font;
+static lv_font_fmt_txt_dsc_t pair_dsc;
+static lv_font_fmt_txt_kern_pair_t pair_kern;
+static lv_font_fmt_txt_glyph_cache_t pair_cache;
+
+static lv_color_t draw_buf_px[BENCH_HOR_RES * BENCH_VER_RES];
+static uint16_t framebuffer[BENCH_HOR_RES * BENCH_VER_RES];
+
+static void bench_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        for (lv_coord_t x = area->x1; x <= area->x2; x++) {
+            framebuffer[y * BENCH_HOR_RES + x] = (color_p++)->full;
+        }
+    }
+    lv_disp_flush_ready(drv);
+}
+
+static uint32_t bench_fb_hash(void) {
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < BENCH_HOR_RES * BENCH_VER_RES; i++) {
+        hash = (hash ^ framebuffer[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief 字形数(最大的glyph id)，只支持内置字体用到的TINY映射表
+ */
+static uint32_t bench_glyph_count(const lv_font_fmt_txt_dsc_t *fdsc) {
+    uint32_t n = 0;
+    for (uint16_t i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[i];
+        uint32_t len = cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY ? cmap->range_length : cmap->list_length;
+        n = LV_MAX(n, cmap->glyph_id_start + len - 1);
+    }
+    return n;
+}
+
+/**
+ * @brief 把字距类表展开为按(左, 右)排序的8位glyph id字距对表，生成一个只有字距格式不同的字体
+ */
+static bool bench_make_pair_font(const lv_font_t *src) {
+    const lv_font_fmt_txt_dsc_t *fdsc = src->dsc;
+    const lv_font_fmt_txt_kern_classes_t *kc = fdsc->kern_dsc;
+    uint32_t n = bench_glyph_count(fdsc);
+    if (fdsc->kern_classes != 1 || n > UINT8_MAX) {
+        return false;
+    }
+    uint8_t *ids = malloc(n * n * 2);
+    int8_t *values = malloc(n * n);
+    if (ids == NULL || values == NULL) {
+        free(ids);
+        free(values);
+        return false;
+    }
+    uint32_t cnt = 0;
+    for (uint32_t l = 1; l <= n; l++) {
+        for (uint32_t r = 1; r <= n; r++) {
+            uint8_t lc = kc->left_class_mapping[l];
+            uint8_t rc = kc->right_class_mapping[r];
+            int8_t v = lc > 0 && rc > 0 ? kc->class_pair_values[(lc - 1) * kc->right_class_cnt + (rc - 1)] : 0;
+            if (v != 0) {
+                ids[cnt * 2] = (uint8_t)l;
+                ids[cnt * 2 + 1] = (uint8_t)r;
+                values[cnt++] = v;
+            }
+        }
+    }
+    pair_kern.glyph_ids = ids;
+    pair_kern.values = values;
+    pair_kern.pair_cnt = cnt;
+    pair_kern.glyph_ids_size = 0;
+    pair_dsc = *fdsc;
+    pair_dsc.kern_dsc = &pair_kern;
+    pair_dsc.kern_classes = 0;
+    pair_dsc.cache = &pair_cache;
+    pair_font = *src;
+    pair_font.dsc = &pair_dsc;
+    printf("kern pairs: %" PRIu32 " glyphs, %" PRIu32 " pairs\n", n, cnt);
+    return true;
+}
+
+static int bench_decode(const char *text, uint32_t *letters) {
+    uint32_t ofs = 0;
+    int n = 0;
+    while (text[ofs] != '\0' && n < BENCH_MAX_LETTERS) {
+        letters[n++] = _lv_txt_encoded_next(text, &ofs);
+    }
+    return n;
+}
+
+static bool bench_dsc_equal(const lv_font_glyph_dsc_t *a, const lv_font_glyph_dsc_t *b) {
+    return a->adv_w == b->adv_w && a->box_w == b->box_w && a->box_h == b->box_h && a->ofs_x == b->ofs_x &&
+           a->ofs_y == b->ofs_y && a->bpp == b->bpp;
+}
+
+/**
+ * @brief 文字中的每个字符(连同下一个字符的字距)：缓存命中的结果与清空缓存后查找的结果一致
+ */
+static bool bench_verify(const bench_case_t *c, const uint32_t *letters, int n) {
+    for (int i = 0; i < n; i++) {
+        uint32_t next = i + 1 < n ? letters[i + 1] : 0;
+        lv_font_glyph_dsc_t cold, warm;
+        lv_font_fmt_txt_reset_cache(c->font);
+        if (!lv_font_get_glyph_dsc(c->font, &cold, letters[i], next)) {
+            printf("FAIL: %s U+%04" PRIX32 " missing\n", c->name, letters[i]);
+            return false;
+        }
+        lv_font_fmt_txt_reset_cache(c->font);
+        const uint8_t *bitmap = lv_font_get_glyph_bitmap(c->font, letters[i]);
+        // 先把文字查一遍让缓存里有其他字符，再查这个字符
+        for (int j = 0; j < n; j++) {
+            lv_font_get_glyph_dsc(c->font, &warm, letters[j], j + 1 < n ? letters[j + 1] : 0);
+        }
+        lv_font_get_glyph_dsc(c->font, &warm, letters[i], next);
+        lv_font_get_glyph_dsc(c->font, &warm, letters[i], next);
+        if (!bench_dsc_equal(&cold, &warm) || lv_font_get_glyph_bitmap(c->font, letters[i]) != bitmap) {
+            printf("FAIL: %s U+%04" PRIX32 " cached glyph differs\n", c->name, letters[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 所有ASCII字符对：字距对表的字体与原字体(字距类表)的字符宽度一致
+ */
+static bool bench_verify_pairs(const lv_font_t *classes, const lv_font_t *pairs) {
+    for (uint32_t a = 0x20; a < 0x7F; a++) {
+        for (uint32_t b = 0x20; b < 0x7F; b++) {
+            if (lv_font_get_glyph_width(classes, a, b) != lv_font_get_glyph_width(pairs, a, b)) {
+                printf("FAIL: kern pair '%c%c' differs\n", (char)a, (char)b);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static double bench_lookup_ns(const lv_font_t *font, const uint32_t *letters, int n) {
+    int64_t best = INT64_MAX;
+    for (int k = 0; k < BENCH_REPEAT; k++) {
+        uint32_t sum = 0;
+        int64_t start = esp_timer_get_time();
+        for (int r = 0; r < BENCH_LOOKUP_ROUNDS; r++) {
+            for (int i = 0; i < n; i++) {
+                lv_font_glyph_dsc_t g;
+                if (lv_font_get_glyph_dsc(font, &g, letters[i], i + 1 < n ? letters[i + 1] : 0)) {
+                    sum += g.adv_w;
+                }
+            }
+        }
+        best = LV_MIN(best, esp_timer_get_time() - start);
+        __asm__ volatile("" : : "r"(sum) : "memory");
+    }
+    return 1000.0 * best / ((double)BENCH_LOOKUP_ROUNDS * n);
+}
+
+static int bench_cmp_i64(const void *a, const void *b) {
+    int64_t x = *(const int64_t *)a;
+    int64_t y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static double bench_rate(uint32_t hits, uint32_t misses) {
+    return hits + misses > 0 ? 100.0 * hits / (hits + misses) : 0.0;
+}
+
+static bool bench_run(const bench_case_t *c, lv_disp_t *disp, lv_obj_t *label, int frames) {
+    static uint32_t letters[BENCH_MAX_LETTERS];
+    int n = bench_decode(c->text, letters);
+    if (!bench_verify(c, letters, n)) {
+        return false;
+    }
+
+    lv_obj_set_style_text_font(label, c->font, 0);
+    lv_label_set_text_static(label, c->text);
+
+    // 冷缓存画一帧，再画frames帧统计耗时和命中率
+    lv_font_fmt_txt_reset_cache(c->font);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(disp);
+    uint32_t cold_hash = bench_fb_hash();
+
+    lv_font_fmt_txt_reset_cache(c->font);
+    int64_t *us = malloc(frames * sizeof(int64_t));
+    if (us == NULL) {
+        return false;
+    }
+    for (int f = 0; f < frames; f++) {
+        lv_obj_invalidate(lv_scr_act());
+        int64_t start = esp_timer_get_time();
+        lv_refr_now(disp);
+        us[f] = esp_timer_get_time() - start;
+    }
+    qsort(us, frames, sizeof(int64_t), bench_cmp_i64);
+    int64_t median_us = us[frames / 2];
+    free(us);
+    uint32_t hash = bench_fb_hash();
+    if (hash != cold_hash) {
+        printf("FAIL: %s frame differs after warm-up\n", c->name);
+        return false;
+    }
+
+    lv_font_fmt_txt_cache_stats_t stats;
+    bool cached = lv_font_fmt_txt_get_cache_stats(c->font, &stats);
+#if LV_FONT_FMT_TXT_CACHE_SIZE
+    if (!cached || stats.glyph_hits == 0) {
+        printf("FAIL: %s no glyph cache hits\n", c->name);
+        return false;
+    }
+#endif
+    double lookup_ns = bench_lookup_ns(c->font, letters, n);
+    printf("%-20s %3d chars  frame %4lld us  lookup %5.1f ns/char  fb=%08" PRIx32, c->name, n,
+           (long long)median_us, lookup_ns, hash);
+    if (cached) {
+        printf("  glyph hit %.1f%% (%" PRIu32 "/%" PRIu32 ")", bench_rate(stats.glyph_hits, stats.glyph_misses),
+               stats.glyph_hits, stats.glyph_hits + stats.glyph_misses);
+        if (stats.kern_hits + stats.kern_misses > 0) {
+            printf("  kern hit %.1f%% (%" PRIu32 "/%" PRIu32 ")", bench_rate(stats.kern_hits, stats.kern_misses),
+                   stats.kern_hits, stats.kern_hits + stats.kern_misses);
+        }
+    }
+    printf("\n");
+    return true;
+}
+
+int main(int argc, char **argv) {
+    int frames = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_FRAMES;
+    if (frames <= 0) {
+        frames = BENCH_DEFAULT_FRAMES;
+    }
+    lv_init();
+
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t drv;
+    lv_disp_draw_buf_init(&draw_buf, draw_buf_px, NULL, BENCH_HOR_RES * BENCH_VER_RES);
+    lv_disp_drv_init(&drv);
+    drv.hor_res = BENCH_HOR_RES;
+    drv.ver_res = BENCH_VER_RES;
+    drv.draw_buf = &draw_buf;
+    drv.flush_cb = bench_flush_cb;
+    lv_disp_t *disp = lv_disp_drv_register(&drv);
+
+    lv_obj_t *label = lv_label_create(lv_scr_act());
+    lv_obj_set_width(label, BENCH_TEXT_WIDTH);
+    lv_obj_set_pos(label, (BENCH_HOR_RES - BENCH_TEXT_WIDTH) / 2, 4);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+
+    printf("LV_FONT_FMT_TXT_CACHE_SIZE: %d, %zu bytes RAM per font\n", LV_FONT_FMT_TXT_CACHE_SIZE,
+           sizeof(lv_font_fmt_txt_glyph_cache_t));
+    if (!bench_make_pair_font(&lv_font_montserrat_14) || !bench_verify_pairs(&lv_font_montserrat_14, &pair_font)) {
+        printf("FAIL: kern pair font\n");
+        return 1;
+    }
+
+    const bench_case_t cases[] = {
+        { "montserrat_14", &lv_font_montserrat_14, text_en },
+        { "montserrat_14 pairs", &pair_font, text_en },
+        { "montserrat_20", &lv_font_montserrat_20, text_en },
+        { "simsun_16_cjk", &lv_font_simsun_16_cjk, text_cjk },
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        if (!bench_run(&cases[i], disp, label, frames)) {
+            return 1;
+        }
+    }
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,196 @@
+// 裁剪字体的主机校验和基准：界面用到的每个字符(UI_FONT_LETTERS)在子集字体和原字体中的字形参数、
+// 位图和字距都必须一致，其他ASCII字符在子集字体中必须查不到；再比较两者的大小和查找字形的耗时
+//
+//   ./build_host/font_subset_bench [次数]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "lvgl.h"
+#include "ui_font.h"
+#include "ui_font_letters.h"
+
+#define BENCH_DEFAULT_ROUNDS    (2000)
+#define BENCH_MAX_LETTERS       (256)
+
+typedef struct {
+    const char *name;
+    const lv_font_t *full;
+    const lv_font_t *subset;
+} bench_pair_t;
+
+static const bench_pair_t pairs[] = {
+    { "montserrat_12", &lv_font_montserrat_12, &ui_font_montserrat_12 },
+    { "montserrat_14", &lv_font_montserrat_14, &ui_font_montserrat_14 },
+    { "montserrat_20", &lv_font_montserrat_20, &ui_font_montserrat_20 },
+};
+
+static uint32_t letters[BENCH_MAX_LETTERS];
+static int n_letters;
+
+static bool bench_has_letter(uint32_t cp) {
+    for (int i = 0; i < n_letters; i++) {
+        if (letters[i] == cp) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief 按lv_font_fmt_txt的数据结构估算字体常量数据的大小(32位目标)
+ */
+static size_t bench_font_bytes(const lv_font_t *font, uint32_t *glyphs) {
+    const lv_font_fmt_txt_dsc_t *fdsc = font->dsc;
+    uint32_t n = 0;
+    size_t bytes = 0;
+    for (uint16_t i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[i];
+        uint32_t last = 0;
+        bytes += sizeof(*cmap);
+        switch (cmap->type) {
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+                last = cmap->glyph_id_start + cmap->range_length - 1;
+                break;
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+                for (uint32_t j = 0; j < cmap->range_length; j++) {
+                    last = LV_MAX(last, cmap->glyph_id_start + ((const uint8_t *)cmap->glyph_id_ofs_list)[j]);
+                }
+                bytes += cmap->range_length;
+                break;
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+                last = cmap->glyph_id_start + cmap->list_length - 1;
+                bytes += cmap->list_length * 2;
+                break;
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+                for (uint32_t j = 0; j < cmap->list_length; j++) {
+                    last = LV_MAX(last, cmap->glyph_id_start + ((const uint16_t *)cmap->glyph_id_ofs_list)[j]);
+                }
+                bytes += cmap->list_length * 4;
+                break;
+        }
+        n = LV_MAX(n, last);
+    }
+
+    size_t bitmap_end = 0;
+    for (uint32_t id = 1; id <= n; id++) {
+        const lv_font_fmt_txt_glyph_dsc_t *g = &fdsc->glyph_dsc[id];
+        bitmap_end = LV_MAX(bitmap_end, g->bitmap_index + ((size_t)g->box_w * g->box_h * fdsc->bpp + 7) / 8);
+    }
+    bytes += bitmap_end + sizeof(lv_font_fmt_txt_glyph_dsc_t) * (n + 1);
+    if (fdsc->kern_classes == 1) {
+        const lv_font_fmt_txt_kern_classes_t *kern = fdsc->kern_dsc;
+        bytes += kern->left_class_cnt * kern->right_class_cnt + 2 * (n + 1);
+    }
+    *glyphs = n;
+    return bytes;
+}
+
+/**
+ * @brief 比较用到的字符的字形参数、位图和所有字符对的字距
+ */
+static bool bench_verify(const bench_pair_t *p) {
+    for (int i = 0; i < n_letters; i++) {
+        uint32_t cp = letters[i];
+        lv_font_glyph_dsc_t a, b;
+        if (!lv_font_get_glyph_dsc(p->full, &a, cp, 0) || !lv_font_get_glyph_dsc(p->subset, &b, cp, 0)) {
+            printf("FAIL: %s U+%04" PRIX32 " missing\n", p->name, cp);
+            return false;
+        }
+        if (a.adv_w != b.adv_w || a.box_w != b.box_w || a.box_h != b.box_h || a.ofs_x != b.ofs_x ||
+            a.ofs_y != b.ofs_y || a.bpp != b.bpp) {
+            printf("FAIL: %s U+%04" PRIX32 " glyph metrics differ\n", p->name, cp);
+            return false;
+        }
+        // 取位图会覆盖字体共用的解码缓冲，先复制一份
+        size_t size = ((size_t)a.box_w * a.box_h * a.bpp + 7) / 8;
+        uint8_t *ref = malloc(size + 1);
+        const uint8_t *bmp = lv_font_get_glyph_bitmap(p->full, cp);
+        if (ref == NULL || (size > 0 && bmp == NULL)) {
+            free(ref);
+            printf("FAIL: %s U+%04" PRIX32 " bitmap\n", p->name, cp);
+            return false;
+        }
+        memcpy(ref, bmp, size);
+        bmp = lv_font_get_glyph_bitmap(p->subset, cp);
+        bool same = size == 0 || (bmp != NULL && memcmp(ref, bmp, size) == 0);
+        free(ref);
+        if (!same) {
+            printf("FAIL: %s U+%04" PRIX32 " bitmap differs\n", p->name, cp);
+            return false;
+        }
+        for (int j = 0; j < n_letters; j++) {
+            if (lv_font_get_glyph_width(p->full, cp, letters[j]) != lv_font_get_glyph_width(p->subset, cp, letters[j])) {
+                printf("FAIL: %s kerning U+%04" PRIX32 " U+%04" PRIX32 " differs\n", p->name, cp, letters[j]);
+                return false;
+            }
+        }
+    }
+
+    // 其他字符查不到；0x7F和0xB1紧跟在映射表末尾，检查范围边界
+    lv_font_glyph_dsc_t g;
+    for (uint32_t cp = 0x20; cp <= 0xB1; cp++) {
+        if (!bench_has_letter(cp) && lv_font_get_glyph_dsc(p->subset, &g, cp, 0)) {
+            printf("FAIL: %s U+%04" PRIX32 " should not be in the subset\n", p->name, cp);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 按UI_FONT_LETTERS的顺序逐个取字形参数和位图，返回每个字符的平均耗时(ns)
+ */
+static double bench_lookup(const lv_font_t *font, int rounds) {
+    uint32_t sum = 0;
+    int64_t start = esp_timer_get_time();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < n_letters; i++) {
+            lv_font_glyph_dsc_t g;
+            uint32_t next = i + 1 < n_letters ? letters[i + 1] : 0;
+            if (lv_font_get_glyph_dsc(font, &g, letters[i], next)) {
+                sum += g.adv_w + (uint32_t)(uintptr_t)lv_font_get_glyph_bitmap(font, letters[i]);
+            }
+        }
+    }
+    int64_t us = esp_timer_get_time() - start;
+    __asm__ volatile("" : : "r"(sum) : "memory");
+    return 1000.0 * us / ((double)rounds * n_letters);
+}
+
+int main(int argc, char **argv) {
+    int rounds = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_ROUNDS;
+    if (rounds <= 0) {
+        rounds = BENCH_DEFAULT_ROUNDS;
+    }
+    lv_init();
+
+    uint32_t ofs = 0;
+    while (UI_FONT_LETTERS[ofs] != '\0' && n_letters < BENCH_MAX_LETTERS) {
+        letters[n_letters++] = _lv_txt_encoded_next(UI_FONT_LETTERS, &ofs);
+    }
+    printf("letters: %d\n", n_letters);
+
+    size_t total_full = 0;
+    size_t total_subset = 0;
+    for (size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++) {
+        const bench_pair_t *p = &pairs[i];
+        if (!bench_verify(p)) {
+            return 1;
+        }
+        uint32_t full_glyphs, subset_glyphs;
+        size_t full_bytes = bench_font_bytes(p->full, &full_glyphs);
+        size_t subset_bytes = bench_font_bytes(p->subset, &subset_glyphs);
+        total_full += full_bytes;
+        total_subset += subset_bytes;
+        double full_ns = bench_lookup(p->full, rounds);
+        double subset_ns = bench_lookup(p->subset, rounds);
+        printf("%s: %" PRIu32 " -> %" PRIu32 " glyphs, %zu -> %zu bytes (%.1f%%), lookup %.1f -> %.1f ns/char\n",
+               p->name, full_glyphs, subset_glyphs, full_bytes, subset_bytes, 100.0 * subset_bytes / full_bytes,
+               full_ns, subset_ns);
+    }
+    printf("total: %zu -> %zu bytes, saved %zu\n", total_full, total_subset, total_full - total_subset);
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,259 @@
+// FT5x06触摸驱动的主机校验和基准：在FT5x06模型的寄存器里构造触摸数据，
+// 检查esp_lcd_touch_ft5x06_read_data解析出的坐标、事件标志和触摸ID，
+// 再统计空闲/按住时每次读取的I2C事务数、字节数和总线占用时间(轮询和INT两种方式)；
+// 同时确认触摸驱动从不调用总线面板IO不支持的tx_color
+//
+//   ./build_host/ft5x06_bench [次数]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_sim.h"
+#include "lcd.h"
+#include "esp_lcd_panel_io_interface.h"
+#include "esp_lcd_touch_ft5x06.h"
+
+#define BENCH_DEFAULT_ROUNDS    (1000)
+#define BENCH_INT_GPIO          (GPIO_NUM_4)    // 只用于让驱动按INT方式读取，模型不驱动这个引脚
+#define BENCH_SCL_HZ            (100000)        // 按100kHz统计总线时间，便于和旧版驱动比较
+
+static int failures = 0;
+static int tx_color_calls = 0;
+
+#define CHECK(cond, ...)                                \
+    do {                                                \
+        if (!(cond)) {                                  \
+            printf("FAIL: " __VA_ARGS__);               \
+            printf("\n");                               \
+            failures++;                                 \
+        }                                               \
+    } while (0)
+
+/**
+ * @brief 替换总线面板IO的tx_color，只计数(总线实现在调试构建中会断言失败)
+ */
+static esp_err_t bench_tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size) {
+    tx_color_calls++;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static esp_lcd_touch_handle_t bench_touch_new(gpio_num_t int_gpio) {
+    const esp_lcd_touch_config_t tp_cfg = {
+        .x_max = BSP_LCD_V_RES,
+        .y_max = BSP_LCD_H_RES,
+        .rst_gpio_num = GPIO_NUM_NC,
+        .int_gpio_num = int_gpio,
+    };
+    const i2c_bus_dev_config_t dev_cfg = {
+        .name = "ft5x06",
+        .addr = ESP_LCD_TOUCH_IO_I2C_FT5x06_ADDRESS,
+        .max_scl_hz = BENCH_SCL_HZ,
+        .prio = I2C_BUS_PRIO_HIGH,
+    };
+    i2c_bus_dev_handle_t dev = NULL;
+    esp_lcd_panel_io_handle_t io = NULL;
+    esp_lcd_touch_handle_t tp = NULL;
+    if (i2c_bus_add_device(&dev_cfg, &dev) != ESP_OK || i2c_bus_new_panel_io(dev, &io) != ESP_OK) {
+        return NULL;
+    }
+    io->tx_color = bench_tx_color;
+    if (esp_lcd_touch_new_i2c_ft5x06(io, &tp_cfg, &tp) != ESP_OK) {
+        return NULL;
+    }
+    return tp;
+}
+
+/**
+ * @brief 按寄存器格式写一个触摸点记录
+ */
+static void bench_write_point(int index, uint8_t event, uint8_t id, uint16_t x, uint16_t y, uint8_t weight,
+                              uint8_t area) {
+    const uint8_t rec[6] = {
+        (uint8_t)((event << 6) | ((x >> 8) & 0x0F)), (uint8_t)(x & 0xFF),
+        (uint8_t)((id << 4) | ((y >> 8) & 0x0F)), (uint8_t)(y & 0xFF),
+        weight, (uint8_t)(area << 4),
+    };
+    host_ft5x06_write_regs(0x03 + index * 6, rec, sizeof(rec));
+}
+
+static void bench_write_status(uint8_t status) {
+    host_ft5x06_write_regs(0x02, &status, 1);
+}
+
+/**
+ * @brief 构造的寄存器内容逐字段和解析结果比较
+ */
+static void bench_check_parse(const char *mode, esp_lcd_touch_handle_t tp) {
+    static const struct {
+        uint8_t event, id;
+        uint16_t x, y;
+        uint8_t weight, area;
+    } pts[] = {
+        { ESP_LCD_TOUCH_FT5x06_EVENT_CONTACT, 3, 0x123, 0x0AB, 0x40, 0x5 },
+        { ESP_LCD_TOUCH_FT5x06_EVENT_DOWN, 1, 0x0EF, 0x13F, 0x07, 0x2 },
+        { ESP_LCD_TOUCH_FT5x06_EVENT_UP, 0xE, 0xFFF, 0x000, 0xFF, 0xF },
+    };
+    const int count = sizeof(pts) / sizeof(pts[0]);
+    const int expect = count < CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? count : CONFIG_ESP_LCD_TOUCH_MAX_POINTS;
+
+    for (int i = 0; i < count; i++) {
+        bench_write_point(i, pts[i].event, pts[i].id, pts[i].x, pts[i].y, pts[i].weight, pts[i].area);
+    }
+    bench_write_status(count);
+    // 轮询方式第一次读取走状态探测，第二次才是连续读取，两条路径都检查
+    for (int pass = 0; pass < 2; pass++) {
+        CHECK(esp_lcd_touch_read_data(tp) == ESP_OK, "%s: read_data", mode);
+        esp_lcd_touch_ft5x06_frame_t frame;
+        CHECK(esp_lcd_touch_ft5x06_get_frame(tp, &frame) == ESP_OK, "%s: get_frame", mode);
+        CHECK(frame.points == expect, "%s pass %d: %d points, expected %d", mode, pass, frame.points, expect);
+        for (int i = 0; i < expect && i < frame.points; i++) {
+            CHECK(frame.point[i].x == pts[i].x && frame.point[i].y == pts[i].y, "%s point %d: (%u,%u) != (%u,%u)",
+                  mode, i, frame.point[i].x, frame.point[i].y, pts[i].x, pts[i].y);
+            CHECK(frame.point[i].event == pts[i].event, "%s point %d: event %d != %d", mode, i, frame.point[i].event,
+                  pts[i].event);
+            CHECK(frame.point[i].id == pts[i].id, "%s point %d: id %u != %u", mode, i, frame.point[i].id, pts[i].id);
+            CHECK(frame.point[i].weight == pts[i].weight && frame.point[i].area == pts[i].area,
+                  "%s point %d: weight/area %u/%u", mode, i, frame.point[i].weight, frame.point[i].area);
+        }
+
+        uint16_t x[CONFIG_ESP_LCD_TOUCH_MAX_POINTS], y[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+        uint16_t strength[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+        uint8_t cnt = 0;
+        bool pressed = esp_lcd_touch_get_coordinates(tp, x, y, strength, &cnt, CONFIG_ESP_LCD_TOUCH_MAX_POINTS);
+        CHECK(pressed && cnt == expect, "%s: get_coordinates %d points", mode, cnt);
+        CHECK(cnt == 0 || (x[0] == pts[0].x && y[0] == pts[0].y && strength[0] == pts[0].weight),
+              "%s: get_coordinates point 0", mode);
+    }
+
+    // 松开：数据清零；状态寄存器无效(0xFF)时保持不变
+    bench_write_status(0);
+    esp_lcd_touch_read_data(tp);
+    esp_lcd_touch_ft5x06_frame_t frame;
+    esp_lcd_touch_ft5x06_get_frame(tp, &frame);
+    uint16_t x, y;
+    uint8_t cnt = 0;
+    CHECK(frame.points == 0 && !esp_lcd_touch_get_coordinates(tp, &x, &y, NULL, &cnt, 1), "%s: release", mode);
+    bench_write_status(0xFF);
+    esp_lcd_touch_read_data(tp);
+    esp_lcd_touch_ft5x06_get_frame(tp, &frame);
+    CHECK(frame.points == 0, "%s: invalid status parsed as %d points", mode, frame.points);
+    bench_write_status(0);
+}
+
+/**
+ * @brief 用模型的set_points走一遍按下-按住-松开，检查事件标志和触摸ID
+ */
+static void bench_check_sequence(const char *mode, esp_lcd_touch_handle_t tp) {
+    const uint16_t x[2] = { 100, 200 }, y[2] = { 50, 150 };
+    const esp_lcd_touch_ft5x06_event_t events[] = { ESP_LCD_TOUCH_FT5x06_EVENT_DOWN,
+                                                    ESP_LCD_TOUCH_FT5x06_EVENT_CONTACT };
+    const int points = CONFIG_ESP_LCD_TOUCH_MAX_POINTS < 2 ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : 2;
+    esp_lcd_touch_ft5x06_frame_t frame;
+    for (int step = 0; step < 2; step++) {
+        host_ft5x06_set_points(2, x, y);
+        esp_lcd_touch_read_data(tp);
+        esp_lcd_touch_ft5x06_get_frame(tp, &frame);
+        CHECK(frame.points == points, "%s step %d: %d points", mode, step, frame.points);
+        for (int i = 0; i < points && i < frame.points; i++) {
+            CHECK(frame.point[i].event == events[step] && frame.point[i].id == i && frame.point[i].x == x[i] &&
+                  frame.point[i].y == y[i], "%s step %d point %d: event %d id %u (%u,%u)", mode, step, i,
+                  frame.point[i].event, frame.point[i].id, frame.point[i].x, frame.point[i].y);
+        }
+    }
+    host_ft5x06_set_points(0, NULL, NULL);
+    esp_lcd_touch_read_data(tp);
+    esp_lcd_touch_ft5x06_get_frame(tp, &frame);
+    CHECK(frame.points == 0, "%s: %d points after release", mode, frame.points);
+}
+
+/**
+ * @brief 连续读取rounds次，输出每次读取的平均总线开销
+ */
+static void bench_cost(const char *mode, const char *state, esp_lcd_touch_handle_t tp, int rounds) {
+    host_i2c_stats_t before, after;
+    esp_lcd_touch_read_data(tp);        // 先读一次，进入按住/空闲的稳定状态
+    host_i2c_get_stats(BSP_I2C_NUM, &before);
+    for (int r = 0; r < rounds; r++) {
+        esp_lcd_touch_read_data(tp);
+    }
+    host_i2c_get_stats(BSP_I2C_NUM, &after);
+    printf("%-7s %-8s %.2f transactions  %5.1f bytes  %6.1f us bus per read\n", mode, state,
+           (double)(after.transactions - before.transactions) / rounds, (double)(after.bytes - before.bytes) / rounds,
+           (double)(after.busy_us - before.busy_us) / rounds);
+}
+
+/**
+ * @brief 空闲时按下：每轮先松开读一次，再按下一个点，只统计按下后那次读取，返回平均事务数
+ */
+static double bench_down_cost(const char *mode, esp_lcd_touch_handle_t tp, int rounds) {
+    const uint16_t x = 100, y = 100;
+    host_i2c_stats_t before, after;
+    uint32_t transactions = 0, bytes = 0;
+    uint64_t busy_us = 0;
+    for (int r = 0; r < rounds; r++) {
+        host_ft5x06_set_points(0, NULL, NULL);
+        esp_lcd_touch_read_data(tp);
+        host_ft5x06_set_points(1, &x, &y);
+        host_i2c_get_stats(BSP_I2C_NUM, &before);
+        esp_lcd_touch_read_data(tp);
+        host_i2c_get_stats(BSP_I2C_NUM, &after);
+        transactions += after.transactions - before.transactions;
+        bytes += after.bytes - before.bytes;
+        busy_us += after.busy_us - before.busy_us;
+    }
+    host_ft5x06_set_points(0, NULL, NULL);
+    esp_lcd_touch_read_data(tp);
+    printf("%-7s %-8s %.2f transactions  %5.1f bytes  %6.1f us bus per read\n", mode, "down",
+           (double)transactions / rounds, (double)bytes / rounds, (double)busy_us / rounds);
+    return (double)transactions / rounds;
+}
+
+int main(int argc, char **argv) {
+    int rounds = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_ROUNDS;
+    if (rounds <= 0) {
+        rounds = BENCH_DEFAULT_ROUNDS;
+    }
+    esp_log_level_set("*", ESP_LOG_WARN);
+
+    // 只统计按时钟计算的总线时间，不真正等待
+    host_sim_set_bus_time_scale(0);
+    host_ft5x06_attach(BSP_I2C_NUM, ESP_LCD_TOUCH_IO_I2C_FT5x06_ADDRESS, GPIO_NUM_NC);
+    bsp_i2c_init();
+
+    esp_lcd_touch_handle_t tp_poll = bench_touch_new(GPIO_NUM_NC);
+    esp_lcd_touch_handle_t tp_int = bench_touch_new(BENCH_INT_GPIO);
+    if (tp_poll == NULL || tp_int == NULL) {
+        printf("FAIL: touch init\n");
+        return 1;
+    }
+    printf("burst read %s, max %d points, I2C %d Hz\n", ESP_LCD_TOUCH_FT5x06_BURST_READ ? "on" : "off",
+           CONFIG_ESP_LCD_TOUCH_MAX_POINTS, BENCH_SCL_HZ);
+
+    bench_check_parse("polling", tp_poll);
+    bench_check_parse("INT", tp_int);
+    bench_check_sequence("polling", tp_poll);
+    bench_check_sequence("INT", tp_int);
+
+    const uint16_t x[2] = { 120, 60 }, y[2] = { 160, 200 };
+    bench_cost("polling", "idle", tp_poll, rounds);
+    double down = bench_down_cost("polling", tp_poll, rounds);
+#if ESP_LCD_TOUCH_FT5x06_BURST_READ
+    // 没接INT时空闲轮询后的第一次按下也只用一次事务
+    CHECK(down == 1.0, "polling down: %.2f transactions per read", down);
+#endif
+    host_ft5x06_set_points(1, x, y);
+    bench_cost("polling", "1 point", tp_poll, rounds);
+    bench_cost("INT", "1 point", tp_int, rounds);
+    host_ft5x06_set_points(2, x, y);
+    bench_cost("polling", "2 points", tp_poll, rounds);
+    bench_cost("INT", "2 points", tp_int, rounds);
+    host_ft5x06_set_points(0, NULL, NULL);
+    CHECK(tx_color_calls == 0, "touch driver called tx_color %d times", tx_color_calls);
+
+    if (failures) {
+        printf("FAIL: %d checks failed\n", failures);
+        return 1;
+    }
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,151 @@
+// I2C总线管理的主机基准：触摸读取和IO扩展芯片写入同时进行，
+// 比较旧配置(100kHz、不分优先级)和新配置(400kHz、触摸优先)下触摸读取的排队等待和总线占用
+//
+//   ./build_host/i2c_bus_bench [每种配置的毫秒数]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "host_sim.h"
+#include "lcd.h"
+#include "esp_lcd_touch_ft5x06.h"
+
+#define BENCH_DEFAULT_MS        (1000)
+#define BENCH_TOUCH_PERIOD_MS   (10)    // 与TOUCH_SAMPLER_ACTIVE_MS一致
+#define BENCH_EXPANDER_PERIOD_MS (4)    // IO扩展芯片每4ms写一组寄存器
+#define BENCH_EXPANDER_WRITES   (4)
+
+typedef struct {
+    const char *name;
+    uint32_t scl_hz;
+    i2c_bus_prio_t touch_prio;
+} bench_config_t;
+
+static const bench_config_t configs[] = {
+    { "100kHz FIFO", 100000, I2C_BUS_PRIO_LOW },
+    { "400kHz touch first", 400000, I2C_BUS_PRIO_HIGH },
+};
+
+static struct {
+    i2c_bus_dev_handle_t touch;
+    i2c_bus_dev_handle_t expander;
+    volatile bool running;
+    uint32_t touch_errors;
+    uint32_t expander_errors;
+    uint32_t touch_max_us;              ///< 从提交到返回的最长时间
+} bench;
+
+static void bench_touch_task(void *arg) {
+    TickType_t last = xTaskGetTickCount();
+    while (bench.running) {
+        const uint8_t reg = 0x02;
+        uint8_t data[7];
+        int64_t start = esp_timer_get_time();
+        if (i2c_bus_write_read(bench.touch, &reg, 1, data, sizeof(data)) != ESP_OK) {
+            bench.touch_errors++;
+        }
+        uint32_t us = (uint32_t)(esp_timer_get_time() - start);
+        if (us > bench.touch_max_us) {
+            bench.touch_max_us = us;
+        }
+        vTaskDelayUntil(&last, pdMS_TO_TICKS(BENCH_TOUCH_PERIOD_MS));
+    }
+    vTaskDelete(NULL);
+}
+
+static void bench_expander_task(void *arg) {
+    TickType_t last = xTaskGetTickCount();
+    uint8_t value = 0;
+    while (bench.running) {
+        uint8_t bufs[BENCH_EXPANDER_WRITES][2];
+        i2c_bus_xfer_t xfers[BENCH_EXPANDER_WRITES];
+        for (int i = 0; i < BENCH_EXPANDER_WRITES; i++) {
+            bufs[i][0] = PCA9557_OUTPUT_PORT;
+            bufs[i][1] = value++;
+            xfers[i] = (i2c_bus_xfer_t){ .wbuf = bufs[i], .wlen = 2 };
+        }
+        if (i2c_bus_transfer(bench.expander, xfers, BENCH_EXPANDER_WRITES) != ESP_OK) {
+            bench.expander_errors++;
+        }
+        vTaskDelayUntil(&last, pdMS_TO_TICKS(BENCH_EXPANDER_PERIOD_MS));
+    }
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief 按配置添加两个设备(同一地址的模型)，运行ms毫秒后输出统计
+ */
+static bool bench_run(const bench_config_t *cfg, int ms) {
+    const i2c_bus_dev_config_t touch_cfg = {
+        .name = "ft5x06", .addr = ESP_LCD_TOUCH_IO_I2C_FT5x06_ADDRESS, .max_scl_hz = cfg->scl_hz,
+        .prio = cfg->touch_prio,
+    };
+    const i2c_bus_dev_config_t expander_cfg = {
+        .name = "pca9557", .addr = PCA9557_SENSOR_ADDR, .max_scl_hz = cfg->scl_hz, .prio = I2C_BUS_PRIO_LOW,
+    };
+    if (i2c_bus_add_device(&touch_cfg, &bench.touch) != ESP_OK ||
+        i2c_bus_add_device(&expander_cfg, &bench.expander) != ESP_OK) {
+        printf("FAIL: add device\n");
+        return false;
+    }
+
+    bench.running = true;
+    bench.touch_errors = bench.expander_errors = bench.touch_max_us = 0;
+    i2c_bus_reset_stats();
+    xTaskCreate(bench_expander_task, "expander", 3072, NULL, 4, NULL);
+    xTaskCreate(bench_touch_task, "touch", 3072, NULL, 5, NULL);
+    vTaskDelay(pdMS_TO_TICKS(ms));
+    bench.running = false;
+    vTaskDelay(pdMS_TO_TICKS(BENCH_TOUCH_PERIOD_MS * 2));
+
+    i2c_bus_stats_t stats;
+    i2c_bus_get_stats(&stats);
+    printf("%s: bus busy %lu.%lu%%, %lu requests in %lu batches\n", cfg->name,
+           (unsigned long)stats.busy_permille / 10, (unsigned long)stats.busy_permille % 10,
+           (unsigned long)stats.requests, (unsigned long)stats.batches);
+    const i2c_bus_dev_stats_t *touch = NULL;
+    for (int i = 0; i < stats.device_count; i++) {
+        const i2c_bus_dev_stats_t *d = &stats.dev[i];
+        if (d->requests == 0) {
+            continue;       // 上一种配置添加的设备
+        }
+        printf("  %-8s %6lu Hz prio %d: %4lu requests, wait avg %4lu us max %5lu us, busy %llu us\n", d->name,
+               (unsigned long)d->scl_hz, d->prio, (unsigned long)d->requests, (unsigned long)d->wait_avg_us,
+               (unsigned long)d->wait_max_us, (unsigned long long)d->busy_us);
+        if (strcmp(d->name, "ft5x06") == 0) {
+            touch = d;
+        }
+    }
+    printf("  touch read max %lu us (queue + transfer)\n", (unsigned long)bench.touch_max_us);
+    if (touch == NULL || bench.touch_errors || bench.expander_errors) {
+        printf("FAIL: %lu touch errors, %lu expander errors\n", (unsigned long)bench.touch_errors,
+               (unsigned long)bench.expander_errors);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    int ms = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_MS;
+    if (ms <= 0) {
+        ms = BENCH_DEFAULT_MS;
+    }
+    esp_log_level_set("*", ESP_LOG_WARN);
+
+    host_ft5x06_attach(BSP_I2C_NUM, ESP_LCD_TOUCH_IO_I2C_FT5x06_ADDRESS, GPIO_NUM_NC);
+    host_pca9557_attach(BSP_I2C_NUM, PCA9557_SENSOR_ADDR);
+    if (i2c_bus_init(BSP_I2C_NUM, BSP_I2C_SDA, BSP_I2C_SCL, BSP_I2C_FREQ_HZ) != ESP_OK) {
+        printf("FAIL: bus init\n");
+        return 1;
+    }
+    for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+        if (!bench_run(&configs[i], ms)) {
+            return 1;
+        }
+    }
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,136 @@
+// 压缩图片资源的主机基准：校验解码结果，输出压缩率和解码速度，
+// 再通过ST7789模型走一遍lcd_draw_asset，比较解码到分条缓冲区和直接复制原始数据的耗时
+//
+//   ./build_host/img_asset_bench [次数]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "host_sim.h"
+#include "lcd.h"
+#include "assets.h"
+#include "yingwu.h"
+
+#define BENCH_DEFAULT_ROUNDS    (200)
+
+static double bench_mbps(size_t bytes, int64_t us) {
+    return us > 0 ? (double)bytes / us : 0.0;
+}
+
+/**
+ * @brief 整幅解码并和原始数据比较
+ */
+static bool bench_verify(const img_asset_t *asset, const uint8_t *raw, size_t raw_size) {
+    uint8_t *out = malloc(raw_size);
+    img_asset_decoder_t dec;
+    bool ok = out && img_asset_decoder_init(&dec, asset) == ESP_OK &&
+              img_asset_decode(&dec, out, raw_size / 2) == ESP_OK &&
+              memcmp(out, raw, raw_size) == 0;
+    free(out);
+    return ok;
+}
+
+/**
+ * @brief 每次解码chunk个像素，统计整幅图片的平均解码速度
+ */
+static int64_t bench_decode(const img_asset_t *asset, size_t pixels, size_t chunk, int rounds) {
+    uint8_t *out = malloc(chunk * 2);
+    int64_t start = esp_timer_get_time();
+    for (int r = 0; r < rounds; r++) {
+        img_asset_decoder_t dec;
+        img_asset_decoder_init(&dec, asset);
+        for (size_t done = 0; done < pixels; done += chunk) {
+            img_asset_decode(&dec, out, pixels - done < chunk ? pixels - done : chunk);
+        }
+    }
+    int64_t us = esp_timer_get_time() - start;
+    free(out);
+    return us / rounds;
+}
+
+static int64_t bench_memcpy(const uint8_t *raw, size_t raw_size, size_t chunk_bytes, int rounds) {
+    uint8_t *out = malloc(chunk_bytes);
+    int64_t start = esp_timer_get_time();
+    for (int r = 0; r < rounds; r++) {
+        for (size_t done = 0; done < raw_size; done += chunk_bytes) {
+            memcpy(out, raw + done, raw_size - done < chunk_bytes ? raw_size - done : chunk_bytes);
+            __asm__ volatile("" : : "r"(out) : "memory");
+        }
+    }
+    int64_t us = esp_timer_get_time() - start;
+    free(out);
+    return us / rounds;
+}
+
+int main(int argc, char **argv) {
+    int rounds = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_ROUNDS;
+    if (rounds <= 0) {
+        rounds = BENCH_DEFAULT_ROUNDS;
+    }
+    esp_log_level_set("*", ESP_LOG_WARN);
+
+    const img_asset_t *asset = &img_yingwu;
+    int width, height;
+    if (img_asset_info(asset, &width, &height) != ESP_OK) {
+        printf("FAIL: invalid asset\n");
+        return 1;
+    }
+    size_t pixels = (size_t)width * height;
+    size_t raw_size = sizeof(gImage_yingwu);
+    if (raw_size != pixels * 2 || !bench_verify(asset, gImage_yingwu, raw_size)) {
+        printf("FAIL: decoded image differs from yingwu.h\n");
+        return 1;
+    }
+
+    size_t strip_px = (BSP_LCD_BLIT_STRIP_BYTES / (width * 2)) * width;
+    int64_t full_us = bench_decode(asset, pixels, pixels, rounds);
+    int64_t strip_us = bench_decode(asset, pixels, strip_px, rounds);
+    int64_t copy_us = bench_memcpy(gImage_yingwu, raw_size, strip_px * 2, rounds);
+    printf("asset: %dx%d, %zu -> %zu bytes (%.1f%%, %.2f:1)\n", width, height, raw_size, asset->size,
+           100.0 * asset->size / raw_size, (double)raw_size / asset->size);
+    printf("decode whole: %lld us  %.1f MB/s out  %.1f MB/s in\n", (long long)full_us,
+           bench_mbps(raw_size, full_us), bench_mbps(asset->size, full_us));
+    printf("decode strip(%zu px): %lld us  %.1f MB/s out\n", strip_px, (long long)strip_us,
+           bench_mbps(raw_size, strip_us));
+    printf("memcpy strip: %lld us  %.1f MB/s\n", (long long)copy_us, bench_mbps(raw_size, copy_us));
+
+    // 完整路径：解码到分条缓冲区再经SPI模型写入显存(不模拟总线耗时)
+    host_sim_set_bus_time_scale(0);
+    host_st7789_attach(BSP_LCD_SPI_NUM, BSP_LCD_H_RES, BSP_LCD_V_RES);
+    host_pca9557_attach(BSP_I2C_NUM, PCA9557_SENSOR_ADDR);
+    bsp_i2c_init();
+    esp_lcd_panel_handle_t panel_handle = NULL;
+    esp_lcd_panel_io_handle_t io_handle = NULL;
+    if (bsp_display_new(&panel_handle, &io_handle) != ESP_OK) {
+        printf("FAIL: panel init\n");
+        return 1;
+    }
+
+    int64_t start = esp_timer_get_time();
+    for (int r = 0; r < rounds; r++) {
+        lcd_draw_asset(asset, 0, 0, &panel_handle, &io_handle);
+    }
+    int64_t asset_us = (esp_timer_get_time() - start) / rounds;
+    const uint16_t *fb = host_st7789_framebuffer(NULL, NULL);
+    for (size_t i = 0; i < pixels; i++) {
+        if (fb[i] != (gImage_yingwu[i * 2] << 8 | gImage_yingwu[i * 2 + 1])) {
+            printf("FAIL: framebuffer differs at pixel %zu\n", i);
+            return 1;
+        }
+    }
+
+    const lcd_image_t raw = { .data = gImage_yingwu, .width = width, .height = height };
+    start = esp_timer_get_time();
+    for (int r = 0; r < rounds; r++) {
+        lcd_blit_image(&raw, 0, 0, width, height, 0, 0, &panel_handle, &io_handle);
+    }
+    int64_t raw_us = (esp_timer_get_time() - start) / rounds;
+
+    img_asset_stats_t stats;
+    img_asset_get_stats(&stats);
+    printf("lcd_draw_asset: %lld us/frame (decode %.1f MB/s), lcd_blit_image raw: %lld us/frame\n",
+           (long long)asset_us, bench_mbps(stats.pixels * 2, stats.decode_us), (long long)raw_us);
+    printf("PASS\n");
+    return 0;
+}
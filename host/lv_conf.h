@@ -0,0 +1,45 @@
+/**
+ * @file lv_conf.h
+ * @brief 主机构建用的LVGL配置
+ * @note 设备上LVGL通过menuconfig配置；这里只列出与Kconfig默认值不同、界面依赖的选项，
+ *       其余选项沿用lv_conf_internal.h的默认值
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+/* ========== 颜色 ========== */
+#define LV_COLOR_DEPTH          16
+#define LV_COLOR_16_SWAP        1   // SPI按字节发送，和SquareLine导出的界面设置一致
+
+/* ========== 内存 ========== */
+#define LV_MEM_CUSTOM           0
+#define LV_MEM_SIZE             (32U * 1024U)   // 与Kconfig默认的LV_MEM_SIZE_KILOBYTES一致
+
+/* ========== 刷新和输入 ========== */
+#define LV_DISP_DEF_REFR_PERIOD 30
+#define LV_INDEV_DEF_READ_PERIOD 30
+#ifndef LV_TICK_CUSTOM
+#define LV_TICK_CUSTOM          1   // 直接读esp_timer_get_time()，esp_lvgl_port不再创建5ms的lv_tick_inc定时器
+#endif
+#define LV_TICK_CUSTOM_INCLUDE  "esp_timer.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (esp_timer_get_time() / 1000LL)
+
+/* ========== 字体 ========== */
+#define LV_FONT_MONTSERRAT_12   1
+#define LV_FONT_MONTSERRAT_14   1
+#define LV_FONT_MONTSERRAT_20   1
+// LV_FONT_DEFAULT由ui_font.cmake定义为裁剪后的ui_font_montserrat_14
+#define LV_FONT_SIMSUN_16_CJK   1   // 只有font_cache_bench引用，servo_tool_host不会链接进来
+#ifndef LV_FONT_FMT_TXT_CACHE_SIZE
+#define LV_FONT_FMT_TXT_CACHE_SIZE 0   // 每个字体的字形缓存项数，0为关闭(只缓存上一个字符)；界面只用ASCII字体，缓存没有收益
+#endif
+
+/* ========== 其他 ========== */
+#define LV_USE_LOG              0
+#define LV_USE_PERF_MONITOR     0
+#define LV_USE_MEM_MONITOR      0
+#define LV_USE_REFR_PROFILER    1       // 主机上用render_prof统计各对象的绘制耗时
+#define LV_BUILD_EXAMPLES       0
+
+#endif // LV_CONF_H
@@ -0,0 +1,1365 @@
+/**
+ * @file main_host.c
+ * @brief 主机仿真入口：挂上外设模型后运行app_main，注入触摸并检查舵机PWM输出
+ * @note 触摸按芯片原始坐标注入，经esp_lcd_touch的镜像/交换后得到界面坐标；
+ *       检查的是完整的 触摸 → LVGL → ui_interface → 主逻辑任务 → LEDC 链路
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_lvgl_port.h"
+#include "host_sim.h"
+#include "lcd.h"
+#include "lvgl-components.h"
+#include "servo_tool.h"
+#include "perf_monitor.h"
+#include "disp_buf.h"
+#include "render_par.h"
+#include "disp_inv.h"
+#include "render_prof.h"
+#include "snap_cache.h"
+#include "num_label.h"
+#include "telemetry.h"
+#include "ui_command.h"
+#include "boot_trace.h"
+#include "init_graph.h"
+#include "main_update.h"
+#include "ui.h"
+
+static const char *TAG = "host";
+
+#define HOST_TOUCH_I2C_ADDR     (0x38)      // ESP_LCD_TOUCH_IO_I2C_FT5x06_ADDRESS
+#define HOST_BOOT_TIMEOUT_MS    (5000)
+#define HOST_SETTLE_MS          (300)       // 等待LVGL读到触摸、主逻辑任务更新PWM
+#define HOST_TAP_MS             (100)       // 触摸读取周期30ms，按下保持几个周期
+#define HOST_DRAG_STEP_PX       (4)
+#define HOST_DRAG_STEP_MS       (10)
+#define HOST_DRAG_TOLERANCE     (3)         // 拖动终点按滑块两端换算，未扣除内边距，允许几度误差
+#define HOST_PULSE_TOLERANCE_US (5)         // 13位分辨率下的取整误差
+#define HOST_RENDER_FRAMES      (30)        // 并行渲染基准每种模式重绘的整屏帧数
+#define HOST_WAKE_IDLE_MS       (2000)      // 统计空闲唤醒次数的时长
+#define HOST_WAKE_SAMPLES       (20)        // 消息到重绘延迟的采样次数
+#define HOST_WAKE_TIMEOUT_US    (1000000)
+#define HOST_INV_FRAMES         (256)       // 脏区域记录的最大帧数
+#define HOST_INV_LABEL_FRAMES   (20)        // 记录小标签同时刷新的帧数
+#define HOST_INV_BUSY_FRAMES    (16)        // 记录多控件动画的帧数(偶数，控件最后回到原位)
+#define HOST_INV_BUSY_CALLS     (8192)      // 记录的_lv_inv_area调用数上限
+#define HOST_INV_BUSY_SHIFT     (3)         // 标签动画每帧移动的像素
+#define HOST_INV_BUSY_COLS      (8)         // 顶层指示灯阵列的列数
+#define HOST_INV_BUSY_ROWS      (6)         // 顶层指示灯阵列的行数
+#define HOST_INV_BUSY_LED_PX    (8)         // 指示灯边长
+#define HOST_PROF_FRAMES        (20)        // 渲染分析每轮重绘的整屏帧数
+#define HOST_PROF_CHURN_ROUNDS  (20)        // 渲染分析创建删除控件的轮数，每轮5个对象，超过统计表容量
+#define HOST_CACHE_FRAMES       (50)        // 位图缓存每种模式重绘的整屏帧数
+#define HOST_CACHE_TOLERANCE    (2)         // 带透明度的位图贴图与直接绘制允许的每通道误差(抗锯齿边缘两次混合)
+#define HOST_LABEL_CHECK_EVERY  (16)        // 数字标签基准每隔多少次更新与整屏重绘比较一次显存
+
+extern void app_main(void);
+
+// LVGL堆调用计数：链接时用--wrap接管lv_mem_alloc/realloc/free
+static struct {
+    uint32_t allocs;
+    uint32_t reallocs;
+    uint32_t frees;
+} host_lv_mem;
+
+void *__real_lv_mem_alloc(size_t size);
+void *__real_lv_mem_realloc(void *data, size_t size);
+void __real_lv_mem_free(void *data);
+
+void *__wrap_lv_mem_alloc(size_t size) {
+    host_lv_mem.allocs++;
+    return __real_lv_mem_alloc(size);
+}
+
+void *__wrap_lv_mem_realloc(void *data, size_t size) {
+    host_lv_mem.reallocs++;
+    return __real_lv_mem_realloc(data, size);
+}
+
+void __wrap_lv_mem_free(void *data) {
+    if (data != NULL) {
+        host_lv_mem.frees++;
+    }
+    __real_lv_mem_free(data);
+}
+
+/**
+ * @brief 把界面坐标换算为触摸芯片原始坐标
+ * @note bsp_touch_new配置了x_max=240、mirror_x和swap_xy：先x=240-x，再交换xy
+ */
+static void host_touch_at(int lx, int ly) {
+    uint16_t x = (uint16_t)(BSP_LCD_V_RES - ly);
+    uint16_t y = (uint16_t)lx;
+    host_ft5x06_set_points(1, &x, &y);
+}
+
+static void host_touch_release(void) {
+    host_ft5x06_set_points(0, NULL, NULL);
+}
+
+static void host_obj_center(lv_obj_t *obj, int *x, int *y) {
+    lv_area_t area;
+    lvgl_port_lock(0);
+    lv_obj_get_coords(obj, &area);
+    lvgl_port_unlock();
+    *x = (area.x1 + area.x2) / 2;
+    *y = (area.y1 + area.y2) / 2;
+}
+
+/**
+ * @brief 滑块上对应某个角度的横坐标(忽略旋钮宽度，拖动终点由实际滑块值校验)
+ */
+static int host_slider_x(int angle) {
+    lv_area_t area;
+    lvgl_port_lock(0);
+    lv_obj_get_coords(ui_angleSlider, &area);
+    int min = lv_slider_get_min_value(ui_angleSlider);
+    int max = lv_slider_get_max_value(ui_angleSlider);
+    lvgl_port_unlock();
+    return area.x1 + (area.x2 - area.x1) * (angle - min) / (max - min);
+}
+
+static int host_slider_value(void) {
+    lvgl_port_lock(0);
+    int value = lv_slider_get_value(ui_angleSlider);
+    lvgl_port_unlock();
+    return value;
+}
+
+/**
+ * @brief 与servo_tool相同的换算：角度 → 高电平时间
+ */
+static uint32_t host_expected_pulse_us(int angle) {
+    return SERVO_MIN_PULSEWIDTH_US + (SERVO_MAX_PULSEWIDTH_US - SERVO_MIN_PULSEWIDTH_US) * angle / SERVO_MAX_DEGREE;
+}
+
+static bool host_check_pulse(const char *step, int angle) {
+    uint32_t pulse = host_ledc_get_pulse_us(SERVO_LEDC_CHANNEL);
+    uint32_t expected = host_expected_pulse_us(angle);
+    bool ok = pulse + HOST_PULSE_TOLERANCE_US >= expected && pulse <= expected + HOST_PULSE_TOLERANCE_US;
+    ESP_LOGI(TAG, "%s: angle %d, pulse %lu us (expected %lu us) %s", step, angle, (unsigned long)pulse,
+             (unsigned long)expected, ok ? "OK" : "FAIL");
+    return ok;
+}
+
+/**
+ * @brief 等待启动完成：面板已打开、舵机已输出初始PWM、LVGL已经刷出第一帧界面
+ * @note LVGL任务启动时没有定时器，会先睡眠task_max_sleep_ms，第一帧可能在数百毫秒后才出现
+ */
+static bool host_wait_boot(void) {
+    perf_frame_t frame;
+    for (int waited = 0; waited < HOST_BOOT_TIMEOUT_MS; waited += 10) {
+        if (host_st7789_display_on() && host_ledc_get_update_count(SERVO_LEDC_CHANNEL) > 0 &&
+            perf_monitor_get_last(&frame)) {
+            vTaskDelay(pdMS_TO_TICKS(HOST_SETTLE_MS));     // 等界面初始化消息处理完
+            return true;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    return false;
+}
+
+static bool host_tap_button(void) {
+    int x, y;
+    host_obj_center(ui_Button3, &x, &y);
+    host_touch_at(x, y);
+    vTaskDelay(pdMS_TO_TICKS(HOST_TAP_MS));
+    host_touch_release();
+    vTaskDelay(pdMS_TO_TICKS(HOST_SETTLE_MS));
+    return host_check_pulse("tap 45° button", 45);
+}
+
+static bool host_drag_slider(int from, int to) {
+    int x, y;
+    host_obj_center(ui_angleSlider, &x, &y);
+    int x0 = host_slider_x(from);
+    int x1 = host_slider_x(to);
+    int step = x1 > x0 ? HOST_DRAG_STEP_PX : -HOST_DRAG_STEP_PX;
+
+    for (x = x0; (step > 0) ? x < x1 : x > x1; x += step) {
+        host_touch_at(x, y);
+        vTaskDelay(pdMS_TO_TICKS(HOST_DRAG_STEP_MS));
+    }
+    host_touch_at(x1, y);
+    vTaskDelay(pdMS_TO_TICKS(HOST_TAP_MS));
+    host_touch_release();
+    vTaskDelay(pdMS_TO_TICKS(HOST_SETTLE_MS));
+
+    int value = host_slider_value();
+    bool ok = abs(value - to) <= HOST_DRAG_TOLERANCE;
+    if (!ok) {
+        ESP_LOGE(TAG, "drag slider: value %d, expected %d", value, to);
+    }
+    return host_check_pulse("drag slider", value) && ok;
+}
+
+/**
+ * @brief 点击和拖动之后角度标签仍是定宽数字标签：SquareLine生成的文字绑定已去掉，
+ *        没有lv_label_set_text改写过标签，数值与滑块一致
+ */
+static bool host_angle_label_check(void) {
+    num_label_stats_t st;
+    int32_t value = -1;
+    lvgl_port_lock(0);
+    num_label_get_stats(&st);
+    bool attached = num_label_get_value(ui_angleValue, &value);
+    lvgl_port_unlock();
+    int slider = host_slider_value();
+    bool ok = attached && st.repairs == 0 && value == slider;
+    ESP_LOGI(TAG, "angle label: value %ld, slider %d, updates %lu, repairs %lu %s", (long)value, slider,
+             (unsigned long)st.updates, (unsigned long)st.repairs, ok ? "OK" : "FAIL");
+    return ok;
+}
+
+/**
+ * @brief 计算屏幕显存的哈希(FNV-1a)
+ */
+static uint32_t host_fb_hash(void) {
+    int w, h;
+    const uint16_t *fb = host_st7789_framebuffer(&w, &h);
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < w * h; i++) {
+        hash = (hash ^ fb[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief 每种布局整屏重绘一帧，检查写入显存的内容一致，并输出该帧的渲染/传输重叠情况
+ * @note 环形布局的条带不带命令续写显存，窗口或续写位置出错时内容会错位
+ */
+static bool host_disp_check(void) {
+    disp_buf_plan_t orig;
+    if (!disp_buf_get_plan(&orig)) {
+        return false;
+    }
+    lv_disp_t *disp = lv_disp_get_default();
+    uint32_t ref = 0;
+    bool ok = true;
+    for (int l = 0; l < DISP_BUF_LAYOUT_COUNT; l++) {
+        lvgl_port_lock(0);
+        esp_err_t ret = disp_buf_apply_layout(l, orig.rows);
+        if (ret == ESP_OK) {
+            perf_monitor_refresh(disp);
+            disp_buf_wait_idle();
+            perf_monitor_refresh(disp);    // 没有脏区域，只发布上一帧统计
+        }
+        lvgl_port_unlock();
+        perf_frame_t frame;
+        if (ret != ESP_OK || !perf_monitor_get_last(&frame)) {
+            printf("disp_buf %-14s n/a\n", disp_buf_layout_name(l));
+            continue;
+        }
+        uint32_t hash = host_fb_hash();
+        if (ref == 0) {
+            ref = hash;
+        }
+        printf("disp_buf %-14s render=%lu us flush=%lu us wait=%lu us frame=%lu us overlap=%u%% px=%lu fb=%08lx\n",
+               disp_buf_layout_name(l), (unsigned long)frame.render_us, (unsigned long)frame.flush_us,
+               (unsigned long)frame.wait_us, (unsigned long)frame.frame_us, frame.overlap_pct, (unsigned long)frame.dirty_px, (unsigned long)hash);
+        if (hash != ref) {
+            ESP_LOGE(TAG, "%s: framebuffer differs from %s", disp_buf_layout_name(l), disp_buf_layout_name(0));
+            ok = false;
+        }
+    }
+    lvgl_port_lock(0);
+    disp_buf_apply(&orig);
+    lvgl_port_unlock();
+
+    // 放不下的布局：返回错误并恢复原布局，画面不变
+    disp_buf_plan_t after;
+    lvgl_port_lock(0);
+    esp_err_t ret = disp_buf_apply_layout(DISP_BUF_INTERNAL_RING, BSP_LCD_V_RES);
+    disp_buf_get_plan(&after);
+    perf_monitor_refresh(disp);
+    disp_buf_wait_idle();
+    lvgl_port_unlock();
+    uint32_t hash = host_fb_hash();
+    bool restored = ret == ESP_ERR_NO_MEM && after.layout == orig.layout && after.rows == orig.rows && hash == ref;
+    printf("disp_buf oversized ring: %s, kept %s %u rows, fb=%08lx %s\n", esp_err_to_name(ret),
+           disp_buf_layout_name(after.layout), after.rows, (unsigned long)hash, restored ? "OK" : "FAIL");
+    return ok && restored;
+}
+
+/**
+ * @brief 依次切换各绘图缓冲区布局重绘整屏，输出每帧耗时
+ * @note 只比较相对开销；主机上PSRAM和内部RAM一样快，SPIRAM布局多出的只有中转复制
+ */
+static bool host_disp_bench(void) {
+    disp_buf_bench_result_t res[DISP_BUF_LAYOUT_COUNT];
+    lvgl_port_lock(0);
+    esp_err_t ret = disp_buf_bench_run(0, res);
+    lvgl_port_unlock();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "draw buffer benchmark failed: %s", esp_err_to_name(ret));
+        return false;
+    }
+    bool ok = false;
+    for (int l = 0; l < DISP_BUF_LAYOUT_COUNT; l++) {
+        if (!res[l].ok) {
+            printf("disp_buf %-14s n/a\n", disp_buf_layout_name(l));
+            continue;
+        }
+        ok = true;
+        printf("disp_buf %-14s rows=%u internal=%lu B frame avg=%lu us min=%lu us\n", disp_buf_layout_name(l),
+               res[l].plan.rows, (unsigned long)res[l].plan.internal_bytes, (unsigned long)res[l].frame_us,
+               (unsigned long)res[l].min_us);
+    }
+    return ok;
+}
+
+/**
+ * @brief 分别关闭和开启并行渲染重绘整屏，比较LVGL的渲染耗时(不含等待刷屏)
+ * @note 加速比取决于主机可用的CPU数量，单核主机上工作线程和LVGL线程轮流运行
+ */
+static bool host_render_bench(void) {
+    lv_disp_t *disp = lv_disp_get_default();
+    bool was_enabled = render_par_is_enabled();
+    uint32_t render_us[2] = { 0 };
+    for (int mode = 0; mode < 2; mode++) {
+        uint64_t total = 0;
+        int frames = 0;
+        render_par_stats_t stats;
+        lvgl_port_lock(0);
+        render_par_set_enabled(mode);
+        render_par_reset_stats();
+        for (int f = 0; f < HOST_RENDER_FRAMES; f++) {
+            perf_frame_t frame;
+            lv_obj_invalidate(lv_scr_act());
+            perf_monitor_refresh(disp);
+            disp_buf_wait_idle();
+            perf_monitor_refresh(disp);    // 没有脏区域，只发布上一帧统计
+            if (perf_monitor_get_last(&frame)) {
+                total += frame.render_us;
+                frames++;
+            }
+        }
+        render_par_get_stats(&stats);
+        lvgl_port_unlock();
+        if (frames == 0) {
+            return false;
+        }
+        render_us[mode] = (uint32_t)(total / frames);
+        printf("render_par %-3s render=%lu us/frame blends=%lu splits=%lu stolen=%lu worker=%.0f%% join_wait=%lu us\n",
+               mode ? "on" : "off", (unsigned long)render_us[mode], (unsigned long)stats.blends,
+               (unsigned long)stats.splits, (unsigned long)stats.stolen,
+               stats.px ? 100.0 * stats.worker_px / stats.px : 0.0, (unsigned long)stats.join_wait_us);
+    }
+    lvgl_port_lock(0);
+    render_par_set_enabled(was_enabled);
+    lvgl_port_unlock();
+    printf("render_par speedup %.2fx on %ld CPU(s)\n", render_us[1] ? (double)render_us[0] / render_us[1] : 0.0,
+           sysconf(_SC_NPROCESSORS_ONLN));
+    return true;
+}
+
+static int host_cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * @brief 统计空闲时LVGL任务的唤醒次数，以及主逻辑消息 → 界面开始刷屏的延迟
+ * @note 以LCD颜色传输计数变化作为开始刷屏的时刻；
+ *       编译时定义LVGL_PORT_TASK_WAKE_ON_UNLOCK=0即可测到只按定时器唤醒时的数据
+ */
+static bool host_wake_bench(void) {
+    lvgl_port_task_stats_t stats;
+    touch_sampler_stats_t touch;
+    lvgl_port_reset_task_stats();
+    touch_sampler_reset_stats();
+    vTaskDelay(pdMS_TO_TICKS(HOST_WAKE_IDLE_MS));
+    lvgl_port_get_task_stats(&stats);
+    touch_sampler_get_stats(&touch);
+    printf("lvgl idle: %.1f wakeups/s, %lu notified, %.1f tick irqs/s\n", stats.wakeups * 1000.0 / HOST_WAKE_IDLE_MS,
+           (unsigned long)stats.notified, stats.tick_irqs * 1000.0 / HOST_WAKE_IDLE_MS);
+    printf("touch idle: %lu reads/s, %lu us/s i2c\n", (unsigned long)touch.read_hz, (unsigned long)touch.i2c_us_per_s);
+#if !defined(LVGL_PORT_TASK_WAKE_ON_UNLOCK) || LVGL_PORT_TASK_WAKE_ON_UNLOCK
+    // 空闲时只有遥测等只读访问，不应唤醒；嵌套加锁只有最外层解锁、且标记了重绘才唤醒一次
+    uint32_t idle_notified = stats.notified;
+    lvgl_port_reset_task_stats();
+    lvgl_port_lock(0);
+    lvgl_port_lock(0);
+    lv_coord_t y = lv_obj_get_y(ui_angleValue);
+    lvgl_port_unlock();
+    lvgl_port_unlock();
+    lvgl_port_get_task_stats(&stats);
+    uint32_t read_notified = stats.notified;
+    lvgl_port_lock(0);
+    lvgl_port_lock(0);
+    lv_obj_invalidate(ui_angleValue);
+    lvgl_port_unlock();
+    lvgl_port_get_task_stats(&stats);
+    uint32_t inner_notified = stats.notified;
+    lvgl_port_unlock();
+    vTaskDelay(pdMS_TO_TICKS(HOST_SETTLE_MS));
+    lvgl_port_get_task_stats(&stats);
+    printf("lvgl unlock wakes: idle %lu, read-only %lu, inner %lu, invalidate %lu (y=%d)\n",
+           (unsigned long)idle_notified, (unsigned long)read_notified, (unsigned long)inner_notified,
+           (unsigned long)stats.notified, (int)y);
+    if (idle_notified != 0 || read_notified != 0 || inner_notified != 0 || stats.notified != 1) {
+        ESP_LOGE(TAG, "lvgl_port_unlock woke the LVGL task without pending work");
+        return false;
+    }
+#endif
+
+    uint32_t lat[HOST_WAKE_SAMPLES];
+    uint64_t total = 0;
+    for (int i = 0; i < HOST_WAKE_SAMPLES; i++) {
+        host_lcd_stats_t lcd;
+        host_lcd_get_stats(&lcd);
+        uint32_t transfers = lcd.color_transfers;
+        logic_to_ui_msg_t msg = { .type = LOGIC_MSG_SERVO_ANGLE_SET, .angle = i };
+        int64_t start = esp_timer_get_time();
+        send_logic_message(&msg);
+        while (lcd.color_transfers == transfers) {
+            if (esp_timer_get_time() - start > HOST_WAKE_TIMEOUT_US) {
+                ESP_LOGE(TAG, "angle label was not redrawn");
+                return false;
+            }
+            usleep(50);
+            host_lcd_get_stats(&lcd);
+        }
+        lat[i] = (uint32_t)(esp_timer_get_time() - start);
+        total += lat[i];
+        vTaskDelay(pdMS_TO_TICKS(50 + i % 7 * 3));     // 错开LVGL定时器的相位
+    }
+    qsort(lat, HOST_WAKE_SAMPLES, sizeof(lat[0]), host_cmp_u32);
+    printf("ui message -> flush: avg=%lu us p50=%lu us max=%lu us\n", (unsigned long)(total / HOST_WAKE_SAMPLES),
+           (unsigned long)lat[HOST_WAKE_SAMPLES / 2], (unsigned long)lat[HOST_WAKE_SAMPLES - 1]);
+
+    // 恢复角度显示
+    logic_to_ui_msg_t msg = { .type = LOGIC_MSG_SERVO_ANGLE_SET, .angle = host_slider_value() };
+    send_logic_message(&msg);
+    return true;
+}
+
+/**
+ * @brief 检查启动时间线：LVGL的刷屏传输不能与清屏(black_fill)交错在同一个面板IO上
+ * @note 启动时记录了前BOOT_TRACE_FRAMES帧的刷屏时间段
+ */
+static bool host_boot_check(void) {
+    int64_t at_us = 0;
+    if (boot_trace_find_overlap("black_fill", "black_fill", NULL) == false) {
+        ESP_LOGE(TAG, "boot trace: no black_fill span");
+        return false;
+    }
+    if (boot_trace_find_overlap("flush", "flush", NULL) == false) {
+        ESP_LOGE(TAG, "boot trace: no flush span");
+        return false;
+    }
+    if (boot_trace_find_overlap("black_fill", "flush", &at_us)) {
+        ESP_LOGE(TAG, "boot trace: LVGL flush overlaps black_fill at %lld us", (long long)at_us);
+        return false;
+    }
+    printf("boot: black_fill and LVGL flushes do not overlap\n");
+    return true;
+}
+
+/**
+ * @brief 检查启动依赖图：实际运行满足依赖顺序；按预估耗时模拟调度时，同一核心上的阶段互不重叠，
+ *        双核总耗时短于单核(即串行耗时之和)
+ */
+static bool host_init_graph_check(void) {
+    size_t count = 0;
+    const init_stage_t *stages = hardware_init_stages(&count);
+    init_stage_t sim[INIT_GRAPH_MAX_STAGES];
+    int64_t makespan[3] = {0};
+    int64_t serial_us = 0;
+    bool ok = init_graph_check_order(stages, count) == ESP_OK;
+
+    for (size_t i = 0; i < count; i++) {
+        serial_us += stages[i].est_us;
+    }
+    for (int cores = 1; cores <= 2; cores++) {
+        memcpy(sim, stages, count * sizeof(sim[0]));
+        makespan[cores] = init_graph_simulate(sim, count, cores);
+        ok &= makespan[cores] > 0 && init_graph_check_order(sim, count) == ESP_OK;
+        for (size_t i = 0; i < count; i++) {
+            for (size_t j = i + 1; j < count; j++) {
+                if (sim[i].ran_on_core == sim[j].ran_on_core && sim[i].start_us < sim[j].end_us &&
+                    sim[j].start_us < sim[i].end_us) {
+                    ESP_LOGE(TAG, "init graph: %s and %s overlap on simulated core %d", sim[i].name,
+                             sim[j].name, sim[i].ran_on_core);
+                    ok = false;
+                }
+            }
+        }
+    }
+    ok &= makespan[1] == serial_us && makespan[2] < makespan[1];
+    printf("init graph: %u stages, simulated 1 core %lld us, 2 cores %lld us%s\n", (unsigned)count,
+           (long long)makespan[1], (long long)makespan[2], ok ? "" : " (FAIL)");
+    return ok;
+}
+
+/**
+ * @brief 检查PCA9557影子寄存器：改变多个引脚只用一次写入，输出不变时不访问总线，
+ *        芯片掉电复位后回读核对能恢复输出和配置
+ */
+static bool host_pca9557_check(void) {
+    const uint8_t mask = PA_EN_GPIO | DVP_PWDN_GPIO;
+    const uint8_t orig = host_pca9557_get_output();
+    const uint8_t flipped = (orig & ~mask) | (~orig & mask);
+    pca9557_stats_t s0, s1, s2;
+    bool ok = true;
+
+    pca9557_get_stats(&s0);
+    ok &= pca9557_apply(mask, flipped) == ESP_OK;
+    ok &= pca9557_apply(mask, flipped) == ESP_OK;      // 输出不变，不访问总线
+    pca9557_get_stats(&s1);
+    if (host_pca9557_get_output() != flipped || s1.writes != s0.writes + 1 || s1.skipped != s0.skipped + 1) {
+        ESP_LOGE(TAG, "pca9557_apply: output 0x%02x, expected 0x%02x, %lu writes %lu skipped",
+                 host_pca9557_get_output(), flipped, (unsigned long)(s1.writes - s0.writes),
+                 (unsigned long)(s1.skipped - s0.skipped));
+        ok = false;
+    }
+
+    host_pca9557_power_cycle();
+    ok &= pca9557_resync() == ESP_OK;
+    pca9557_get_stats(&s2);
+    if (host_pca9557_get_output() != flipped || s2.mismatches != s1.mismatches + 1) {
+        ESP_LOGE(TAG, "pca9557_resync: output 0x%02x, expected 0x%02x", host_pca9557_get_output(), flipped);
+        ok = false;
+    }
+    ok &= pca9557_apply(mask, orig) == ESP_OK;
+    ok &= host_pca9557_get_output() == orig;
+    printf("pca9557: writes=%lu skipped=%lu resyncs=%lu mismatches=%lu\n", (unsigned long)s2.writes,
+           (unsigned long)s2.skipped, (unsigned long)s2.resyncs, (unsigned long)s2.mismatches);
+    return ok;
+}
+
+/****************    脏区域合并基准 ↓   *************************/
+
+static struct {
+    uint32_t frames;
+    uint32_t label_from;        ///< 小标签刷新从这一帧开始
+    uint8_t n[HOST_INV_FRAMES];
+    lv_area_t areas[HOST_INV_FRAMES][LV_INV_BUF_SIZE];
+} host_inv;
+
+/**
+ * @brief 刷新前记录本帧合并前的脏区域
+ */
+static void host_inv_record_cb(lv_disp_t *disp, void *ctx) {
+    if (disp->inv_p > 0 && host_inv.frames < HOST_INV_FRAMES) {
+        host_inv.n[host_inv.frames] = (uint8_t)disp->inv_p;
+        memcpy(host_inv.areas[host_inv.frames], disp->inv_areas, disp->inv_p * sizeof(lv_area_t));
+        host_inv.frames++;
+    }
+}
+
+/**
+ * @brief 回放记录的第from~to-1帧脏区域，返回总耗时(微秒)，LCD传输统计取差值
+ */
+static uint64_t host_inv_replay(lv_disp_t *disp, uint32_t from, uint32_t to, host_lcd_stats_t *lcd) {
+    host_lcd_stats_t l0;
+    host_lcd_get_stats(&l0);
+    int64_t t0 = esp_timer_get_time();
+    for (uint32_t f = from; f < to; f++) {
+        for (int i = 0; i < host_inv.n[f]; i++) {
+            _lv_inv_area(disp, &host_inv.areas[f][i]);
+        }
+        perf_monitor_refresh(disp);
+        disp_buf_wait_idle();
+    }
+    uint64_t us = (uint64_t)(esp_timer_get_time() - t0);
+    host_lcd_get_stats(lcd);
+    lcd->commands -= l0.commands;
+    lcd->color_transfers -= l0.color_transfers;
+    lcd->color_bytes -= l0.color_bytes;
+    lcd->busy_us -= l0.busy_us;
+    return us;
+}
+
+static struct {
+    void (*orig_rounder_cb)(lv_disp_drv_t *drv, lv_area_t *area);
+    uint32_t calls;
+    uint32_t frames;
+    uint32_t end[HOST_INV_BUSY_FRAMES * 2];     ///< 每帧最后一个调用的下一个位置
+    lv_area_t areas[HOST_INV_BUSY_CALLS];
+} host_busy;
+
+/**
+ * @brief 借rounder_cb记录每次_lv_inv_area加入的区域(已裁剪到屏幕)，渲染时的调用不记录
+ */
+static void host_busy_rounder_cb(lv_disp_drv_t *drv, lv_area_t *area) {
+    lv_disp_t *disp = lv_disp_get_default();
+    if (!disp->rendering_in_progress && host_busy.calls < HOST_INV_BUSY_CALLS) {
+        host_busy.areas[host_busy.calls++] = *area;
+    }
+}
+
+/**
+ * @brief 刷新结束时结束一帧：布局更新产生的区域在刷新定时器里加入
+ */
+static void host_busy_refr_cb(lv_disp_t *disp, void *ctx) {
+    uint32_t last = host_busy.frames ? host_busy.end[host_busy.frames - 1] : 0;
+    if (host_busy.calls > last && host_busy.frames < HOST_INV_BUSY_FRAMES * 2) {
+        host_busy.end[host_busy.frames++] = host_busy.calls;
+    }
+}
+
+/**
+ * @brief 记录所有标签同时上下移动、顶层一组指示灯同时闪烁时每帧的_lv_inv_area调用，
+ *        分别关闭和开启inv_merge回放，比较缓冲区满的次数和刷屏耗时
+ * @note 指示灯互不相交，加上移动标签前后的区域，一帧的区域数超过LV_INV_BUF_SIZE。
+ *       关闭inv_merge时缓冲区满即整屏重绘。记录结束后删除指示灯、标签回到原位，回放的是当前界面
+ */
+static bool host_inv_busy_bench(lv_disp_t *disp) {
+    lv_obj_t *objs[] = { ui_labe1, ui_labe3, ui_angleValue, ui_ServoPin, ui_Label15, ui_Label7, ui_Label10,
+                         ui_Label11, ui_Label12, ui_Label13, ui_Label8, ui_Label9, ui_Label14, ui_Label2 };
+    const size_t n = sizeof(objs) / sizeof(objs[0]);
+    bool was_merge = disp->driver->inv_merge;
+    lv_obj_t *leds[HOST_INV_BUSY_COLS * HOST_INV_BUSY_ROWS];
+
+    lvgl_port_lock(0);
+    for (int i = 0; i < HOST_INV_BUSY_COLS * HOST_INV_BUSY_ROWS; i++) {
+        leds[i] = lv_obj_create(lv_layer_top());
+        lv_obj_remove_style_all(leds[i]);
+        lv_obj_set_size(leds[i], HOST_INV_BUSY_LED_PX, HOST_INV_BUSY_LED_PX);
+        lv_obj_set_pos(leds[i], (i % HOST_INV_BUSY_COLS) * BSP_LCD_H_RES / HOST_INV_BUSY_COLS + 12,
+                       (i / HOST_INV_BUSY_COLS) * BSP_LCD_V_RES / HOST_INV_BUSY_ROWS + 12);
+        lv_obj_set_style_bg_opa(leds[i], LV_OPA_COVER, 0);
+    }
+    lvgl_port_unlock();
+    vTaskDelay(pdMS_TO_TICKS(HOST_SETTLE_MS));
+
+    lvgl_port_lock(0);
+    memset(&host_busy, 0, sizeof(host_busy));
+    host_busy.orig_rounder_cb = disp->driver->rounder_cb;
+    perf_monitor_add_refr_hook(disp, NULL, host_busy_refr_cb, NULL);
+    disp->driver->rounder_cb = host_busy_rounder_cb;
+    lvgl_port_unlock();
+    for (int f = 0; f < HOST_INV_BUSY_FRAMES; f++) {
+        lv_coord_t dy = (f % 2) ? -HOST_INV_BUSY_SHIFT : HOST_INV_BUSY_SHIFT;
+        lvgl_port_lock(0);
+        for (size_t i = 0; i < n; i++) {
+            lv_obj_set_y(objs[i], lv_obj_get_y_aligned(objs[i]) + dy);
+        }
+        for (int i = 0; i < HOST_INV_BUSY_COLS * HOST_INV_BUSY_ROWS; i++) {
+            lv_obj_set_style_bg_color(leds[i], (f + i) % 2 ? lv_palette_main(LV_PALETTE_RED) :
+                                      lv_palette_main(LV_PALETTE_GREEN), 0);
+        }
+        lvgl_port_unlock();
+        vTaskDelay(pdMS_TO_TICKS(HOST_DRAG_STEP_MS * 2));
+    }
+    lvgl_port_lock(0);
+    perf_monitor_remove_refr_hook(disp, NULL, host_busy_refr_cb, NULL);
+    disp->driver->rounder_cb = host_busy.orig_rounder_cb;
+    for (int i = 0; i < HOST_INV_BUSY_COLS * HOST_INV_BUSY_ROWS; i++) {
+        lv_obj_del(leds[i]);
+    }
+    lvgl_port_unlock();
+    vTaskDelay(pdMS_TO_TICKS(HOST_SETTLE_MS));
+    if (host_busy.frames == 0) {
+        ESP_LOGE(TAG, "no invalidations recorded");
+        return false;
+    }
+
+    // 控件移动后留下的边缘残影不属于回放的差异，先整屏重绘一次作为参照
+    lvgl_port_lock(0);
+    lv_obj_invalidate(lv_scr_act());
+    perf_monitor_refresh(disp);
+    disp_buf_wait_idle();
+    lvgl_port_unlock();
+    bool ok = true;
+    uint32_t ref = host_fb_hash();
+    uint64_t busy[2];
+    uint32_t overflows[2];
+    for (int mode = 0; mode < 2; mode++) {
+        host_lcd_stats_t l0, lcd;
+        disp_inv_stats_t st;
+        lvgl_port_lock(0);
+        disp_inv_set_merge(disp, mode);
+        disp_inv_reset_stats();
+        host_lcd_get_stats(&l0);
+        int64_t t0 = esp_timer_get_time();
+        for (uint32_t f = 0, c = 0; f < host_busy.frames; f++) {
+            for (; c < host_busy.end[f]; c++) {
+                _lv_inv_area(disp, &host_busy.areas[c]);
+            }
+            perf_monitor_refresh(disp);
+            disp_buf_wait_idle();
+        }
+        uint64_t us = (uint64_t)(esp_timer_get_time() - t0);
+        host_lcd_get_stats(&lcd);
+        disp_inv_get_stats(&st);
+        lvgl_port_unlock();
+        busy[mode] = lcd.busy_us - l0.busy_us;
+        overflows[mode] = st.overflows;
+        printf("disp_inv busy   merge=%-3s frames=%lu calls=%lu overflows=%lu areas %lu->%lu px %llu->%llu "
+               "spi cmds=%lu colors=%lu busy=%llu us total=%llu us\n",
+               mode ? "on" : "off", (unsigned long)st.frames, (unsigned long)host_busy.calls,
+               (unsigned long)st.overflows, (unsigned long)st.areas_in, (unsigned long)st.areas_out,
+               (unsigned long long)st.px_in, (unsigned long long)st.px_out,
+               (unsigned long)(lcd.commands - l0.commands), (unsigned long)(lcd.color_transfers - l0.color_transfers),
+               (unsigned long long)busy[mode], (unsigned long long)us);
+        if (host_fb_hash() != ref) {
+            ESP_LOGE(TAG, "disp_inv busy merge=%d: framebuffer changed by replay", mode);
+            ok = false;
+        }
+    }
+    lvgl_port_lock(0);
+    disp_inv_set_merge(disp, was_merge);
+    lvgl_port_unlock();
+    printf("disp_inv busy   spi busy %.1f%% of full-screen fallback\n", busy[0] ? 100.0 * busy[1] / busy[0] : 0.0);
+    return ok && overflows[0] > 0 && busy[1] < busy[0];
+}
+
+/**
+ * @brief 记录拖动滑块、点击按钮、小标签刷新时每帧的脏区域，按LVGL默认策略和代价模型分别回放，比较刷屏总耗时
+ * @note 回放时给SPI事务加上BSP_LCD_CMD_TRANS_US/BSP_LCD_COLOR_TRANS_US的固定开销(主机模型默认只按字节数计时)，
+ *       代价模型用应用默认的BSP_LCD_AREA_COST_NS(由同样的开销算出)，每像素按像素时钟计算。
+ *       主机上LVGL逐区域的CPU开销很小，不计入
+ */
+static bool host_inv_bench(void) {
+    lv_disp_t *disp = lv_disp_get_default();
+    disp_inv_cost_t bsp_cost;
+    bool has_cost = disp_inv_get_cost(&bsp_cost);
+    const disp_inv_cost_t cost = {
+        .area_ns = BSP_LCD_AREA_COST_NS,
+        .px_ns = (uint32_t)(1000000000ULL * BSP_LCD_BITS_PER_PIXEL / BSP_LCD_PIXEL_CLOCK_HZ),
+    };
+
+    bool ok = true;
+    lvgl_port_lock(0);
+    // 带透明度的位图贴图与直接绘制在抗锯齿边缘有少量误差，回放结果按哈希比较，关闭位图缓存
+    bool cache_enabled = snap_cache_is_enabled();
+    snap_cache_set_enabled(false);
+    host_inv.frames = 0;
+    perf_monitor_add_refr_hook(disp, host_inv_record_cb, NULL, NULL);
+    lvgl_port_unlock();
+    ok &= host_drag_slider(135, 60);
+    ok &= host_tap_button();
+    ok &= host_drag_slider(45, 90);
+    // 状态栏几个小标签同时刷新(角度、引脚和各自的标题)
+    host_inv.label_from = host_inv.frames;
+    lv_obj_t *labels[] = { ui_angleValue, ui_ServoPin, ui_labe1, ui_labe3, ui_Label15, ui_Label7 };
+    for (int f = 0; f < HOST_INV_LABEL_FRAMES; f++) {
+        lvgl_port_lock(0);
+        for (size_t i = 0; i < sizeof(labels) / sizeof(labels[0]); i++) {
+            lv_obj_invalidate(labels[i]);
+        }
+        lvgl_port_unlock();
+        vTaskDelay(pdMS_TO_TICKS(HOST_DRAG_STEP_MS * 2));
+    }
+    lvgl_port_lock(0);
+    perf_monitor_remove_refr_hook(disp, host_inv_record_cb, NULL, NULL);
+    lvgl_port_unlock();
+    if (host_inv.label_from == 0 || host_inv.frames == host_inv.label_from) {
+        ESP_LOGE(TAG, "no dirty areas recorded");
+        return false;
+    }
+
+    const struct {
+        const char *name;
+        uint32_t from, to;
+    } traces[] = {
+        { "drag", 0, host_inv.label_from },
+        { "labels", host_inv.label_from, host_inv.frames },
+    };
+    uint32_t ref = host_fb_hash();
+    host_lcd_set_trans_overhead_us(BSP_LCD_CMD_TRANS_US, BSP_LCD_COLOR_TRANS_US);
+    printf("disp_inv cost model: area=%lu ns px=%lu ns\n", (unsigned long)cost.area_ns, (unsigned long)cost.px_ns);
+    for (size_t t = 0; t < sizeof(traces) / sizeof(traces[0]); t++) {
+        uint64_t busy[2];
+        for (int mode = 0; mode < 2; mode++) {
+            host_lcd_stats_t lcd;
+            disp_inv_stats_t st;
+            lvgl_port_lock(0);
+            disp_inv_set_cost(disp, mode ? &cost : NULL);
+            uint64_t us = host_inv_replay(disp, traces[t].from, traces[t].to, &lcd);
+            disp_inv_get_stats(&st);
+            lvgl_port_unlock();
+            busy[mode] = lcd.busy_us;
+            printf("disp_inv %-6s %-7s frames=%lu areas %lu->%lu joins=%lu disjoint=%lu px %llu->%llu "
+                   "spi cmds=%lu colors=%lu busy=%llu us total=%llu us\n",
+                   traces[t].name, mode ? "cost" : "default", (unsigned long)st.frames, (unsigned long)st.areas_in,
+                   (unsigned long)st.areas_out, (unsigned long)st.joins, (unsigned long)st.disjoint_joins,
+                   (unsigned long long)st.px_in, (unsigned long long)st.px_out, (unsigned long)lcd.commands,
+                   (unsigned long)lcd.color_transfers, (unsigned long long)lcd.busy_us, (unsigned long long)us);
+            if (host_fb_hash() != ref) {
+                ESP_LOGE(TAG, "disp_inv %s: framebuffer changed by replay", mode ? "cost" : "default");
+                ok = false;
+            }
+        }
+        printf("disp_inv %-6s spi busy %.1f%% of default\n", traces[t].name,
+               busy[0] ? 100.0 * busy[1] / busy[0] : 0.0);
+        ok &= busy[1] <= busy[0];
+    }
+    lvgl_port_lock(0);
+    disp_inv_set_cost(disp, &cost);
+    lvgl_port_unlock();
+    ok &= host_inv_busy_bench(disp);
+    host_lcd_set_trans_overhead_us(0, 0);
+    lvgl_port_lock(0);
+    disp_inv_set_cost(disp, has_cost ? &bsp_cost : NULL);
+    snap_cache_set_enabled(cache_enabled);
+    lvgl_port_unlock();
+    return ok;
+}
+
+/**
+ * @brief 整屏重绘若干帧，返回每帧的平均渲染耗时
+ */
+static uint32_t host_prof_redraw(lv_disp_t *disp, int frames) {
+    uint64_t total = 0;
+    int n = 0;
+    lvgl_port_lock(0);
+    for (int f = 0; f < frames; f++) {
+        perf_frame_t frame;
+        lv_obj_invalidate(lv_scr_act());
+        perf_monitor_refresh(disp);
+        disp_buf_wait_idle();
+        perf_monitor_refresh(disp);    // 没有脏区域，只发布上一帧统计
+        if (perf_monitor_get_last(&frame)) {
+            total += frame.render_us;
+            n++;
+        }
+    }
+    lvgl_port_unlock();
+    return n ? (uint32_t)(total / n) : 0;
+}
+
+static void host_prof_print(const char *group_name, const render_prof_entry_t *e, size_t n) {
+    printf("render_prof top %u by %s (average):\n", (unsigned)n, group_name);
+    for (size_t i = 0; i < n; i++) {
+        printf("  %-14s %-6s x%-2lu self=%5lu us main=%5lu post=%4lu layer=%4lu children=%5lu us draws=%lu px=%lu\n",
+               e[i].name ? e[i].name : "-", e[i].class_name, (unsigned long)e[i].objs, (unsigned long)e[i].self_us,
+               (unsigned long)e[i].phase_us[RENDER_PROF_PHASE_MAIN], (unsigned long)e[i].phase_us[RENDER_PROF_PHASE_POST],
+               (unsigned long)e[i].phase_us[RENDER_PROF_PHASE_LAYER],
+               (unsigned long)e[i].phase_us[RENDER_PROF_PHASE_CHILDREN], (unsigned long)e[i].draws,
+               (unsigned long)e[i].px);
+    }
+}
+
+/**
+ * @brief 反复创建、绘制、删除一组带名字的控件(次数超过统计表容量)，统计项数和名字应在删除后恢复原样
+ */
+static bool host_prof_churn(lv_disp_t *disp) {
+    render_prof_stats_t before, drawn, after;
+    render_prof_entry_t e[RENDER_PROF_MAX_OBJS];
+    bool ok = true;
+    lvgl_port_lock(0);
+    render_prof_get_stats(&before);
+    for (int round = 0; round < HOST_PROF_CHURN_ROUNDS && ok; round++) {
+        lv_obj_t *box = lv_obj_create(lv_scr_act());
+        lv_obj_set_size(box, 120, 60);
+        for (int i = 0; i < 4; i++) {
+            render_prof_set_name(lv_label_create(box), "churn");
+        }
+        lv_obj_invalidate(box);
+        lv_refr_now(disp);
+        render_prof_get_stats(&drawn);
+        lv_obj_del(box);
+        lv_refr_now(disp);
+        render_prof_get_stats(&after);
+        size_t n = render_prof_get_top(RENDER_PROF_BY_NAME, RENDER_PROF_LAST_FRAME, e, RENDER_PROF_MAX_OBJS);
+        for (size_t i = 0; i < n; i++) {
+            ok &= strcmp(e[i].name, "churn") != 0;
+        }
+        ok &= drawn.objs == before.objs + 5 && after.objs == before.objs;
+    }
+    lvgl_port_unlock();
+    printf("render_prof churn %d rounds objs %lu->%lu->%lu %s\n", HOST_PROF_CHURN_ROUNDS, (unsigned long)before.objs,
+           (unsigned long)drawn.objs, (unsigned long)after.objs, ok ? "released" : "leaked");
+    return ok;
+}
+
+/**
+ * @brief 整屏重绘Screen1，按对象、类型和名字输出最耗时的控件
+ * @note 耗时受主机调度影响，绘制次数和像素数只与界面内容有关：重绘两轮，检查每个名字的次数和像素数完全一致
+ */
+static bool host_prof_bench(void) {
+    lv_disp_t *disp = lv_disp_get_default();
+    render_prof_entry_t top[2][RENDER_PROF_MAX_OBJS];
+    size_t n[2];
+    uint32_t render_us[2];
+
+    lvgl_port_lock(0);
+    render_prof_set_enabled(false);
+    lvgl_port_unlock();
+    uint32_t off_us = host_prof_redraw(disp, HOST_PROF_FRAMES);
+    for (int pass = 0; pass < 2; pass++) {
+        lvgl_port_lock(0);
+        render_prof_set_enabled(true);
+        render_prof_reset();
+        lvgl_port_unlock();
+        render_us[pass] = host_prof_redraw(disp, HOST_PROF_FRAMES);
+        lvgl_port_lock(0);
+        n[pass] = render_prof_get_top(RENDER_PROF_BY_NAME, RENDER_PROF_AVERAGE, top[pass], RENDER_PROF_MAX_OBJS);
+        lvgl_port_unlock();
+    }
+
+    render_prof_entry_t e[RENDER_PROF_TOP_N];
+    render_prof_stats_t st;
+    lvgl_port_lock(0);
+    render_prof_get_stats(&st);
+    size_t n_obj = render_prof_get_top(RENDER_PROF_BY_OBJ, RENDER_PROF_AVERAGE, e, RENDER_PROF_TOP_N);
+    lvgl_port_unlock();
+    if (n[0] == 0 || n_obj == 0 || st.frames != HOST_PROF_FRAMES) {
+        ESP_LOGE(TAG, "render_prof: no objects recorded (frames=%lu)", (unsigned long)st.frames);
+        return false;
+    }
+    printf("render_prof frames=%lu objs=%lu dropped=%lu frame self last=%lu us max=%lu us render off=%lu us on=%lu us\n",
+           (unsigned long)st.frames, (unsigned long)st.objs, (unsigned long)st.dropped,
+           (unsigned long)st.last_frame_us, (unsigned long)st.max_frame_us, (unsigned long)off_us,
+           (unsigned long)render_us[1]);
+    host_prof_print("object", e, n_obj);
+    lvgl_port_lock(0);
+    size_t n_class = render_prof_get_top(RENDER_PROF_BY_CLASS, RENDER_PROF_AVERAGE, e, RENDER_PROF_TOP_N);
+    lvgl_port_unlock();
+    host_prof_print("class", e, n_class);
+    host_prof_print("name", top[1], n[1] < RENDER_PROF_TOP_N ? n[1] : RENDER_PROF_TOP_N);
+
+    bool ok = n[0] == n[1];
+    uint64_t px = 0;
+    for (size_t i = 0; i < n[0]; i++) {
+        size_t j = 0;
+        while (j < n[1] && strcmp(top[1][j].name, top[0][i].name) != 0) {
+            j++;
+        }
+        if (j == n[1] || top[1][j].px != top[0][i].px || top[1][j].draws != top[0][i].draws) {
+            ESP_LOGE(TAG, "render_prof: %s differs between passes", top[0][i].name);
+            ok = false;
+        }
+        px += top[0][i].px;
+    }
+    // 屏幕背景覆盖整屏，命名对象每帧混合的像素不少于整屏
+    printf("render_prof named objects px/frame=%llu (screen %d) passes %s\n", (unsigned long long)px,
+           BSP_LCD_H_RES * BSP_LCD_V_RES, ok ? "identical" : "differ");
+    return ok && px >= (uint64_t)BSP_LCD_H_RES * BSP_LCD_V_RES && host_prof_churn(disp);
+}
+
+/**
+ * @brief 与参考显存比较，返回不同的像素数
+ * @param max_delta 输出RGB565各通道的最大差值
+ */
+static uint32_t host_fb_diff(const uint16_t *ref, int *max_delta) {
+    int w, h;
+    const uint16_t *fb = host_st7789_framebuffer(&w, &h);
+    uint32_t n = 0;
+    *max_delta = 0;
+    for (int i = 0; i < w * h; i++) {
+        if (fb[i] == ref[i]) {
+            continue;
+        }
+        n++;
+        int d[3] = { abs((fb[i] >> 11) - (ref[i] >> 11)), abs(((fb[i] >> 5) & 0x3f) - ((ref[i] >> 5) & 0x3f)),
+                     abs((fb[i] & 0x1f) - (ref[i] & 0x1f)) };
+        for (int c = 0; c < 3; c++) {
+            if (d[c] > *max_delta) {
+                *max_delta = d[c];
+            }
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief 关闭缓存整屏重绘一帧，保存显存作为参考
+ */
+static void host_cache_reference(lv_disp_t *disp, uint16_t *ref) {
+    int w, h;
+    lvgl_port_lock(0);
+    snap_cache_set_enabled(false);
+    lvgl_port_unlock();
+    host_prof_redraw(disp, 1);
+    const uint16_t *fb = host_st7789_framebuffer(&w, &h);
+    memcpy(ref, fb, (size_t)w * h * sizeof(uint16_t));
+    lvgl_port_lock(0);
+    snap_cache_set_enabled(true);
+    lvgl_port_unlock();
+}
+
+/**
+ * @brief 开启缓存整屏重绘一帧，与参考比较
+ */
+static bool host_cache_check(lv_disp_t *disp, const char *step, const uint16_t *ref) {
+    int max_delta;
+    host_prof_redraw(disp, 1);
+    uint32_t n = host_fb_diff(ref, &max_delta);
+    printf("snap_cache %-14s diff px=%lu max delta=%d\n", step, (unsigned long)n, max_delta);
+    return max_delta <= HOST_CACHE_TOLERANCE;
+}
+
+static void host_cache_print(const char *name, uint32_t render_us) {
+    snap_cache_stats_t st;
+    lvgl_port_lock(0);
+    snap_cache_get_stats(&st);
+    lvgl_port_unlock();
+    uint32_t draws = st.hits + st.misses + st.bypasses;
+    printf("snap_cache %-14s render=%lu us/frame hits=%lu misses=%lu bypasses=%lu hit rate=%.1f%% invalidations=%lu "
+           "evictions=%lu bitmaps=%lu/%lu used=%lu B peak=%lu B build=%lu us\n", name, (unsigned long)render_us,
+           (unsigned long)st.hits, (unsigned long)st.misses, (unsigned long)st.bypasses,
+           draws ? 100.0 * st.hits / draws : 0.0, (unsigned long)st.invalidations, (unsigned long)st.evictions,
+           (unsigned long)st.bitmaps, (unsigned long)st.objs, (unsigned long)st.used_bytes,
+           (unsigned long)st.peak_bytes, (unsigned long)st.build_us);
+}
+
+/**
+ * @brief 整屏重绘Screen1，比较关闭/开启位图缓存的渲染耗时，检查内容变化后缓存失效、预算不足时按LRU淘汰
+ * @note 带透明度的位图在抗锯齿边缘与直接绘制有少量误差，按HOST_CACHE_TOLERANCE比较
+ */
+/**
+ * @brief 占满PSRAM后重建所有位图：只有不超过SNAP_CACHE_INTERNAL_MAX的位图放到内部RAM，其余对象直接绘制，画面不变
+ */
+static bool host_cache_no_psram(lv_disp_t *disp, const uint16_t *ref) {
+    snap_cache_stats_t st;
+    lvgl_port_lock(0);
+    snap_cache_flush();
+    snap_cache_reset_stats();
+    lvgl_port_unlock();
+    void *hog = heap_caps_malloc(heap_caps_get_free_size(MALLOC_CAP_SPIRAM), MALLOC_CAP_SPIRAM);
+    uint32_t render_us = host_prof_redraw(disp, HOST_CACHE_FRAMES);
+    int max_delta;
+    uint32_t diff = host_fb_diff(ref, &max_delta);
+    host_cache_print("no psram", render_us);
+    lvgl_port_lock(0);
+    snap_cache_get_stats(&st);
+    snap_cache_flush();
+    lvgl_port_unlock();
+    heap_caps_free(hog);
+    printf("snap_cache no psram internal=%lu B peak=%lu B (max %d B) diff px=%lu max delta=%d\n",
+           (unsigned long)st.internal_bytes, (unsigned long)st.internal_peak_bytes, SNAP_CACHE_INTERNAL_MAX,
+           (unsigned long)diff, max_delta);
+    return hog != NULL && st.internal_peak_bytes > 0 && st.internal_peak_bytes <= SNAP_CACHE_INTERNAL_MAX &&
+           st.used_bytes == st.internal_bytes && st.bypasses > 0 && max_delta <= HOST_CACHE_TOLERANCE;
+}
+
+static bool host_cache_bench(void) {
+    lv_disp_t *disp = lv_disp_get_default();
+    static uint16_t ref[BSP_LCD_H_RES * BSP_LCD_V_RES];
+    snap_cache_stats_t st;
+    bool ok = true;
+
+    lvgl_port_lock(0);
+    snap_cache_set_enabled(false);
+    lvgl_port_unlock();
+    uint32_t off_us = host_prof_redraw(disp, HOST_CACHE_FRAMES);
+    printf("snap_cache %-14s render=%lu us/frame\n", "off", (unsigned long)off_us);
+    host_cache_reference(disp, ref);
+    lvgl_port_lock(0);
+    snap_cache_flush();
+    snap_cache_reset_stats();
+    lvgl_port_unlock();
+    uint32_t on_us = host_prof_redraw(disp, HOST_CACHE_FRAMES);
+    int max_delta;
+    uint32_t diff = host_fb_diff(ref, &max_delta);
+    host_cache_print("on", on_us);
+    printf("snap_cache full redraw %.1f%% of uncached, diff px=%lu max delta=%d\n",
+           off_us ? 100.0 * on_us / off_us : 0.0, (unsigned long)diff, max_delta);
+    ok &= max_delta <= HOST_CACHE_TOLERANCE;
+
+    // 文字变化后位图失效：稳定前直接绘制，稳定后重建
+    lvgl_port_lock(0);
+    snap_cache_reset_stats();
+    lv_label_set_text(ui_Label10, "5°");
+    lvgl_port_unlock();
+    host_cache_reference(disp, ref);
+    ok &= host_cache_check(disp, "text changed", ref);
+    vTaskDelay(pdMS_TO_TICKS(SNAP_CACHE_SETTLE_MS + 50));
+    ok &= host_cache_check(disp, "text rebuilt", ref);
+    // 状态变化(带样式过渡动画)，过渡结束后比较
+    lvgl_port_lock(0);
+    lv_obj_add_state(ui_Button4, LV_STATE_CHECKED);
+    lvgl_port_unlock();
+    vTaskDelay(pdMS_TO_TICKS(SNAP_CACHE_SETTLE_MS * 2));
+    host_cache_reference(disp, ref);
+    vTaskDelay(pdMS_TO_TICKS(SNAP_CACHE_SETTLE_MS + 50));
+    ok &= host_cache_check(disp, "state changed", ref);
+    lvgl_port_lock(0);
+    snap_cache_get_stats(&st);
+    lv_label_set_text(ui_Label10, "0°");
+    lv_obj_clear_state(ui_Button4, LV_STATE_CHECKED);
+    lvgl_port_unlock();
+    host_cache_print("invalidate", 0);
+    ok &= st.invalidations >= 2 && st.bypasses > 0 && st.misses >= 2;
+
+    // 预算只够一半的位图：当前刷新用过的位图不淘汰，其余对象直接绘制
+    vTaskDelay(pdMS_TO_TICKS(SNAP_CACHE_SETTLE_MS * 2));
+    lvgl_port_lock(0);
+    snap_cache_get_stats(&st);
+    uint32_t budget = st.used_bytes / 2;
+    snap_cache_set_budget(budget);
+    snap_cache_reset_stats();
+    lvgl_port_unlock();
+    host_cache_reference(disp, ref);
+    uint32_t lru_us = host_prof_redraw(disp, HOST_CACHE_FRAMES);
+    diff = host_fb_diff(ref, &max_delta);
+    lvgl_port_lock(0);
+    snap_cache_get_stats(&st);
+    snap_cache_set_budget(BSP_LCD_SNAP_CACHE_BYTES);
+    lvgl_port_unlock();
+    host_cache_print("half budget", lru_us);
+    printf("snap_cache budget %lu B %.1f%% of uncached, diff px=%lu max delta=%d\n", (unsigned long)budget,
+           off_us ? 100.0 * lru_us / off_us : 0.0, (unsigned long)diff, max_delta);
+    ok &= st.evictions > 0 && st.peak_bytes <= budget && max_delta <= HOST_CACHE_TOLERANCE;
+    return ok && host_cache_no_psram(disp, ref);
+}
+
+// 数字标签基准一种模式的结果
+typedef struct {
+    uint32_t updates;
+    uint32_t heap_calls;        ///< lv_mem_alloc + realloc + free
+    uint64_t inv_px;            ///< 更新后(含布局)标记重绘的像素数
+    uint64_t render_us;
+    uint32_t mismatches;        ///< 与整屏重绘显存不一致的次数
+} host_label_result_t;
+
+/**
+ * @brief 当前待刷新区域的像素数
+ */
+static uint32_t host_inv_px(lv_disp_t *disp) {
+    uint32_t px = 0;
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        if (!disp->inv_area_joined[i]) {
+            px += lv_area_get_size(&disp->inv_areas[i]);
+        }
+    }
+    return px;
+}
+
+/**
+ * @brief 刷新一帧，返回渲染耗时
+ */
+static uint32_t host_label_refresh(lv_disp_t *disp) {
+    perf_frame_t frame;
+    perf_monitor_refresh(disp);
+    disp_buf_wait_idle();
+    perf_monitor_refresh(disp);        // 只发布上一帧统计
+    return perf_monitor_get_last(&frame) ? frame.render_us : 0;
+}
+
+/**
+ * @brief 角度标签按滑块拖动的顺序更新一遍(0→180→0)，每次更新后统计LVGL堆调用、重绘面积和渲染耗时；
+ *        每隔HOST_LABEL_CHECK_EVERY次整屏重绘一帧，检查只重绘脏区域得到的显存与整屏重绘一致
+ * @param fixed true用num_label_set_value，false用原来的lv_label_set_text_fmt
+ */
+static void host_label_sweep(lv_disp_t *disp, bool fixed, host_label_result_t *r) {
+    memset(r, 0, sizeof(*r));
+    lvgl_port_lock(0);
+    host_label_refresh(disp);
+    for (int i = 0; i <= SERVO_MAX_DEGREE * 2; i++) {
+        int angle = i <= SERVO_MAX_DEGREE ? i : SERVO_MAX_DEGREE * 2 - i;
+        memset(&host_lv_mem, 0, sizeof(host_lv_mem));
+        if (fixed) {
+            num_label_set_value(ui_angleValue, angle);
+        } else {
+            lv_label_set_text_fmt(ui_angleValue, "%d °", angle);
+        }
+        lv_obj_update_layout(lv_scr_act());                 // 宽度变化引起的重新对齐也计入
+        r->heap_calls += host_lv_mem.allocs + host_lv_mem.reallocs + host_lv_mem.frees;
+        r->inv_px += host_inv_px(disp);
+        r->render_us += host_label_refresh(disp);
+        r->updates++;
+        if (i % HOST_LABEL_CHECK_EVERY == 0 || i == SERVO_MAX_DEGREE * 2) {
+            uint32_t partial = host_fb_hash();
+            lv_obj_invalidate(lv_scr_act());
+            host_label_refresh(disp);
+            r->mismatches += host_fb_hash() != partial;
+        }
+    }
+    lvgl_port_unlock();
+}
+
+/**
+ * @brief 比较角度标签用lv_label_set_text_fmt和定宽数字标签更新时的LVGL堆调用次数、重绘面积和渲染耗时
+ * @note 位图缓存与直接绘制有少量误差，基准期间关闭，保证局部重绘与整屏重绘的显存可以逐位比较
+ */
+static bool host_label_bench(void) {
+    lv_disp_t *disp = lv_disp_get_default();
+    host_label_result_t r[2];
+    num_label_stats_t st;
+    int32_t value = -1;
+
+    lvgl_port_lock(0);
+    bool cache_enabled = snap_cache_is_enabled();
+    snap_cache_set_enabled(false);
+    num_label_detach(ui_angleValue);
+    lvgl_port_unlock();
+    host_prof_redraw(disp, 1);                              // 显存里不再留有贴图的内容
+    host_label_sweep(disp, false, &r[0]);
+
+    lvgl_port_lock(0);
+    num_label_attach(ui_angleValue, 0, SERVO_MAX_DEGREE, " °");
+    num_label_reset_stats();
+    lvgl_port_unlock();
+    host_label_sweep(disp, true, &r[1]);
+
+    lvgl_port_lock(0);
+    num_label_get_stats(&st);
+    num_label_get_value(ui_angleValue, &value);
+    snap_cache_set_enabled(cache_enabled);
+    lvgl_port_unlock();
+
+    const char *names[] = { "set_text_fmt", "num_label" };
+    for (int m = 0; m < 2; m++) {
+        printf("num_label %-12s updates=%lu heap calls/update=%.2f inv px/update=%llu render=%llu us/update "
+               "mismatches=%lu\n", names[m], (unsigned long)r[m].updates, (double)r[m].heap_calls / r[m].updates,
+               (unsigned long long)(r[m].inv_px / r[m].updates), (unsigned long long)(r[m].render_us / r[m].updates),
+               (unsigned long)r[m].mismatches);
+    }
+    printf("num_label cells changed/update=%.2f unchanged=%lu repairs=%lu inv px %.1f%% of set_text_fmt, value=%ld\n",
+           (double)st.cells / st.updates, (unsigned long)st.unchanged, (unsigned long)st.repairs,
+           r[0].inv_px ? 100.0 * r[1].inv_px / r[0].inv_px : 0.0, (long)value);
+    return r[0].mismatches == 0 && r[1].mismatches == 0 && r[1].heap_calls == 0 && st.repairs == 0 &&
+           r[1].inv_px < r[0].inv_px && value == 0;
+}
+
+static void host_report(void) {
+    perf_latency_t lat;
+    perf_monitor_get_latency(&lat);
+    printf("latency: n=%lu p50=%lu us p90=%lu us p99=%lu us max=%lu us\n", (unsigned long)lat.count,
+           (unsigned long)lat.p50, (unsigned long)lat.p90, (unsigned long)lat.p99, (unsigned long)lat.max);
+
+    perf_frame_t avg;
+    if (perf_monitor_get_avg(&avg)) {
+        printf("frame avg: render=%lu us flush=%lu us wait=%lu us frame=%lu us overlap=%u%% px=%lu frames=%lu\n",
+               (unsigned long)avg.render_us, (unsigned long)avg.flush_us, (unsigned long)avg.wait_us,
+               (unsigned long)avg.frame_us, avg.overlap_pct, (unsigned long)avg.dirty_px, (unsigned long)avg.seq);
+    }
+
+    host_lcd_stats_t lcd;
+    host_lcd_get_stats(&lcd);
+    printf("lcd: cmds=%lu color=%lu bytes=%llu bus=%llu us max_inflight=%lu\n", (unsigned long)lcd.commands,
+           (unsigned long)lcd.color_transfers, (unsigned long long)lcd.color_bytes, (unsigned long long)lcd.busy_us,
+           (unsigned long)lcd.max_inflight);
+
+    touch_sampler_stats_t touch;
+    touch_sampler_get_stats(&touch);
+    printf("touch: reads=%lu (%lu/s) samples=%lu (%lu/s) dropped=%lu irqs=%lu i2c=%lu us/s period=%u ms\n",
+           (unsigned long)touch.reads, (unsigned long)touch.read_hz, (unsigned long)touch.samples,
+           (unsigned long)touch.sample_hz, (unsigned long)touch.dropped, (unsigned long)touch.interrupts,
+           (unsigned long)touch.i2c_us_per_s, touch.period_ms);
+
+    touch_filter_t *filter = bsp_touch_filter();
+    if (filter != NULL) {
+        touch_filter_stats_t tf;
+        touch_filter_get_stats(filter, &tf);
+        printf("touch filter: samples=%lu strokes=%lu changes raw=%lu out=%lu still jitter %lu.%02lu -> %lu.%02lu px "
+               "lead=%lu us predict=%lu.%02lu px\n", (unsigned long)tf.samples, (unsigned long)tf.strokes,
+               (unsigned long)tf.raw_changes, (unsigned long)tf.out_changes, (unsigned long)tf.raw_jitter_cpx / 100,
+               (unsigned long)tf.raw_jitter_cpx % 100, (unsigned long)tf.out_jitter_cpx / 100,
+               (unsigned long)tf.out_jitter_cpx % 100, (unsigned long)tf.lead_us,
+               (unsigned long)tf.predict_avg_cpx / 100, (unsigned long)tf.predict_avg_cpx % 100);
+    }
+
+    host_i2c_stats_t i2c;
+    host_i2c_get_stats(BSP_I2C_NUM, &i2c);
+    printf("i2c: transactions=%lu bytes=%lu bus=%llu us nacks=%lu\n", (unsigned long)i2c.transactions,
+           (unsigned long)i2c.bytes, (unsigned long long)i2c.busy_us, (unsigned long)i2c.nacks);
+    i2c_bus_stats_t bus;
+    i2c_bus_get_stats(&bus);
+    printf("i2c bus: requests=%lu batches=%lu busy=%lu.%lu%%\n", (unsigned long)bus.requests,
+           (unsigned long)bus.batches, (unsigned long)bus.busy_permille / 10, (unsigned long)bus.busy_permille % 10);
+    for (int i = 0; i < bus.device_count; i++) {
+        printf("  %-8s prio %d %lu Hz: requests=%lu errors=%lu wait avg %lu us max %lu us\n", bus.dev[i].name,
+               bus.dev[i].prio, (unsigned long)bus.dev[i].scl_hz, (unsigned long)bus.dev[i].requests,
+               (unsigned long)bus.dev[i].errors, (unsigned long)bus.dev[i].wait_avg_us,
+               (unsigned long)bus.dev[i].wait_max_us);
+    }
+
+    telemetry_log_summary();
+}
+
+int main(int argc, char **argv) {
+    const char *ppm_path = NULL;
+    bool disp_bench = false;
+    bool render_bench = false;
+    bool wake_bench = false;
+    bool inv_bench = false;
+    bool prof_bench = false;
+    bool cache_bench = false;
+    bool label_bench = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--ppm") == 0 && i + 1 < argc) {
+            ppm_path = argv[++i];
+        } else if (strcmp(argv[i], "--bus-scale") == 0 && i + 1 < argc) {
+            host_sim_set_bus_time_scale(strtof(argv[++i], NULL));
+        } else if (strcmp(argv[i], "--render-bench") == 0) {
+            render_bench = true;
+        } else if (strcmp(argv[i], "--wake-bench") == 0) {
+            wake_bench = true;
+        } else if (strcmp(argv[i], "--inv-bench") == 0) {
+            inv_bench = true;
+        } else if (strcmp(argv[i], "--prof-bench") == 0) {
+            prof_bench = true;
+        } else if (strcmp(argv[i], "--cache-bench") == 0) {
+            cache_bench = true;
+        } else if (strcmp(argv[i], "--label-bench") == 0) {
+            label_bench = true;
+        } else if (strcmp(argv[i], "--disp-bench") == 0) {
+            disp_bench = true;
+        } else if (strcmp(argv[i], "-q") == 0) {
+            esp_log_level_set("*", ESP_LOG_WARN);
+        } else {
+            fprintf(stderr, "usage: %s [--ppm out.ppm] [--bus-scale k] [--disp-bench] [--render-bench] [--wake-bench] [--inv-bench] [--prof-bench] [--cache-bench] [--label-bench] [-q]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // 板上外设：ST7789接SPI3，PCA9557和FT5x06挂在同一条I2C总线上
+    ESP_ERROR_CHECK(host_st7789_attach(BSP_LCD_SPI_NUM, BSP_LCD_H_RES, BSP_LCD_V_RES));
+    ESP_ERROR_CHECK(host_pca9557_attach(BSP_I2C_NUM, PCA9557_SENSOR_ADDR));
+    ESP_ERROR_CHECK(host_ft5x06_attach(BSP_I2C_NUM, HOST_TOUCH_I2C_ADDR, BSP_TOUCH_INT_GPIO));
+
+    int64_t t0 = esp_timer_get_time();
+    app_main();
+    if (!host_wait_boot()) {
+        ESP_LOGE(TAG, "boot did not complete in %d ms", HOST_BOOT_TIMEOUT_MS);
+        return 1;
+    }
+    ESP_LOGI(TAG, "boot done in %lld ms, PCA9557 output 0x%02x", (long long)(esp_timer_get_time() - t0) / 1000,
+             host_pca9557_get_output());
+
+    bool ok = true;
+    ok &= host_boot_check();
+    ok &= host_init_graph_check();
+    ok &= host_tap_button();
+    ok &= host_drag_slider(45, 135);
+    ok &= host_angle_label_check();
+    ok &= host_pca9557_check();
+    if (disp_bench) {
+        ok &= host_disp_check();
+        ok &= host_disp_bench();
+    }
+    if (render_bench) {
+        ok &= host_render_bench();
+    }
+    if (wake_bench) {
+        ok &= host_wake_bench();
+    }
+    if (inv_bench) {
+        ok &= host_inv_bench();
+    }
+    if (prof_bench) {
+        ok &= host_prof_bench();
+    }
+    if (cache_bench) {
+        ok &= host_cache_bench();
+    }
+    if (label_bench) {
+        ok &= host_label_bench();
+    }
+
+    host_report();
+    if (ppm_path) {
+        if (host_st7789_save_ppm(ppm_path) == ESP_OK) {
+            printf("framebuffer saved to %s\n", ppm_path);
+        } else {
+            ok = false;
+        }
+    }
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    fflush(stdout);
+    // 各任务是无限循环，直接退出进程
+    _exit(ok ? 0 : 1);
+}
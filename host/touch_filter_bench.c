@@ -0,0 +1,363 @@
+// 触摸滤波的主机回放：把触摸轨迹逐个样本送入touch_filter_update，比较原始坐标、只滤波、滤波加外推三种输出。
+// 只滤波(外推时间为0)仅供对比，设备上的滤波器总是外推：测得输入延迟前用TOUCH_FILTER_DEFAULT_LEAD_MS
+//
+// 内置轨迹由真实路径加高斯噪声并取整生成，误差按"输出(t)和真实位置(t+外推时间)的距离"计算，
+// 即界面在延迟之后显示的位置离手指有多远；另外统计静止时输出变化的次数(对应滑块的VALUE_CHANGED)
+//
+//   ./build_host/touch_filter_bench [--lead-us N] [--min-cutoff Hz] [--beta k] [--d-cutoff Hz] [--dump 目录] [轨迹.csv ...]
+//
+// 轨迹文件每行一个样本："time_us,x,y,pressed"，#开头的行为注释；pressed为0的样本表示松开。
+// 只有内置轨迹有真实位置，回放文件时只输出变化次数和抖动
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "touch_filter.h"
+
+#define BENCH_LEAD_US           (TOUCH_FILTER_DEFAULT_LEAD_MS * 1000)  // 滤波+外推即测得延迟前的默认配置
+#define BENCH_PERIOD_US         (10000)     // 与TOUCH_SAMPLER_ACTIVE_MS一致
+#define BENCH_NOISE_PX          (0.8f)      // 触摸坐标噪声的标准差
+#define BENCH_MIN_STILL         (20)        // 静止样本太少的轨迹不检查静止时的变化次数
+#define BENCH_MAX_SAMPLES       (1024)
+#define BENCH_X_MAX             (320)
+#define BENCH_Y_MAX             (240)
+
+typedef struct {
+    int64_t time_us;
+    uint16_t x, y;
+    bool pressed;
+    float tx, ty;               ///< 真实位置(只有内置轨迹有)
+} bench_sample_t;
+
+typedef struct {
+    const char *name;
+    bench_sample_t s[BENCH_MAX_SAMPLES];
+    int count;
+    bool has_truth;
+    float stop_x;               ///< 停止位置，用于统计外推造成的冲过距离；<0表示没有
+    int64_t stop_us;
+} bench_trace_t;
+
+typedef enum {
+    BENCH_RAW,
+    BENCH_FILTER,
+    BENCH_PREDICT,
+    BENCH_VARIANT_COUNT,
+} bench_variant_t;
+
+static const char *const variant_names[] = { "raw", "1euro", "1euro+lead" };
+
+static touch_filter_config_t bench_cfg = TOUCH_FILTER_DEFAULT_CONFIG();
+
+typedef struct {
+    double err_rms;             ///< 输出与t+lead时真实位置的均方根误差(像素)
+    double err_moving_rms;      ///< 只统计移动中的样本
+    uint32_t changes;           ///< 输出变化的样本数
+    uint32_t still_changes;     ///< 真实位置静止时输出变化的样本数
+    float overshoot;            ///< 停止后输出越过停止位置的最大距离
+} bench_result_t;
+
+/****************    轨迹生成 ↓   *************************/
+
+static uint32_t rng_state = 12345;
+
+static float bench_randf(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return ((rng_state >> 8) + 0.5f) / 16777216.0f;
+}
+
+static float bench_gauss(void) {
+    return sqrtf(-2.0f * logf(bench_randf())) * cosf(2.0f * (float)M_PI * bench_randf());
+}
+
+static float bench_smoothstep(float t) {
+    t = t < 0 ? 0 : (t > 1 ? 1 : t);
+    return t * t * (3 - 2 * t);
+}
+
+typedef void (*bench_path_t)(float t, float *x, float *y);
+
+static void path_hold(float t, float *x, float *y) {
+    *x = 160.3f;
+    *y = 120.6f;
+}
+
+static void path_slow_drag(float t, float *x, float *y) {
+    *x = 60.0f + 60.0f * t;
+    *y = 120.0f;
+}
+
+// 0.2s内加速到约600像素/秒，0.4s后滑过200像素
+static void path_swipe(float t, float *x, float *y) {
+    *x = 40.0f + 240.0f * bench_smoothstep(t / 0.5f);
+    *y = 100.0f + 20.0f * bench_smoothstep(t / 0.5f);
+}
+
+// 以约400像素/秒拖到200停下，再按住1秒
+static void path_drag_stop(float t, float *x, float *y) {
+    *x = 40.0f + 160.0f * bench_smoothstep(t / 0.6f);
+    *y = 120.0f;
+}
+
+// 滑块来回拖动
+static void path_slider(float t, float *x, float *y) {
+    *x = 160.0f + 100.0f * sinf(2.0f * (float)M_PI * 0.7f * t);
+    *y = 120.0f;
+}
+
+static void bench_generate(bench_trace_t *tr, const char *name, bench_path_t path, float seconds, float stop_s) {
+    memset(tr, 0, sizeof(*tr));
+    tr->name = name;
+    tr->has_truth = true;
+    tr->stop_x = -1;
+    int n = (int)(seconds * 1e6f / BENCH_PERIOD_US);
+    if (n > BENCH_MAX_SAMPLES - 1) {
+        n = BENCH_MAX_SAMPLES - 1;
+    }
+    for (int i = 0; i < n; i++) {
+        bench_sample_t *s = &tr->s[i];
+        float t = (float)i * BENCH_PERIOD_US / 1e6f;
+        s->time_us = (int64_t)i * BENCH_PERIOD_US;
+        path(t, &s->tx, &s->ty);
+        s->x = (uint16_t)lroundf(fminf(fmaxf(s->tx + BENCH_NOISE_PX * bench_gauss(), 0), BENCH_X_MAX));
+        s->y = (uint16_t)lroundf(fminf(fmaxf(s->ty + BENCH_NOISE_PX * bench_gauss(), 0), BENCH_Y_MAX));
+        s->pressed = true;
+    }
+    // 最后一个样本松开
+    tr->s[n] = tr->s[n - 1];
+    tr->s[n].time_us += BENCH_PERIOD_US;
+    tr->s[n].pressed = false;
+    tr->count = n + 1;
+    if (stop_s > 0) {
+        float y;
+        path(stop_s, &tr->stop_x, &y);
+        tr->stop_us = (int64_t)(stop_s * 1e6f);
+    }
+}
+
+/**
+ * @brief 按时间线性插值真实位置，超出轨迹时取端点
+ */
+static void bench_truth_at(const bench_trace_t *tr, int64_t t, float *x, float *y) {
+    int last = tr->count - 1;
+    if (t >= tr->s[last].time_us) {
+        *x = tr->s[last].tx;
+        *y = tr->s[last].ty;
+        return;
+    }
+    int i = (int)(t / BENCH_PERIOD_US);
+    float k = (float)(t - tr->s[i].time_us) / BENCH_PERIOD_US;
+    *x = tr->s[i].tx + (tr->s[i + 1].tx - tr->s[i].tx) * k;
+    *y = tr->s[i].ty + (tr->s[i + 1].ty - tr->s[i].ty) * k;
+}
+
+/****************    轨迹文件 ↓   *************************/
+
+static bool bench_load(bench_trace_t *tr, const char *path) {
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        printf("FAIL: cannot open %s\n", path);
+        return false;
+    }
+    memset(tr, 0, sizeof(*tr));
+    tr->name = path;
+    tr->stop_x = -1;
+    char line[128];
+    while (fgets(line, sizeof(line), fp) && tr->count < BENCH_MAX_SAMPLES) {
+        long long t;
+        unsigned x, y, pressed;
+        if (line[0] == '#' || sscanf(line, "%lld,%u,%u,%u", &t, &x, &y, &pressed) != 4) {
+            continue;
+        }
+        tr->s[tr->count++] = (bench_sample_t){ .time_us = t, .x = (uint16_t)x, .y = (uint16_t)y, .pressed = pressed };
+    }
+    fclose(fp);
+    return tr->count > 0;
+}
+
+static bool bench_dump(const bench_trace_t *tr, const char *dir) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.csv", dir, tr->name);
+    FILE *fp = fopen(path, "w");
+    if (fp == NULL) {
+        printf("FAIL: cannot write %s\n", path);
+        return false;
+    }
+    fprintf(fp, "# time_us,x,y,pressed\n");
+    for (int i = 0; i < tr->count; i++) {
+        fprintf(fp, "%lld,%u,%u,%d\n", (long long)tr->s[i].time_us, tr->s[i].x, tr->s[i].y, tr->s[i].pressed);
+    }
+    fclose(fp);
+    return true;
+}
+
+/****************    回放 ↓   *************************/
+
+static void bench_replay(const bench_trace_t *tr, bench_variant_t variant, uint32_t lead_us, bench_result_t *res,
+                         touch_filter_stats_t *stats) {
+    touch_filter_t f;
+    touch_filter_init(&f, &bench_cfg);
+    touch_filter_set_lead_us(&f, variant == BENCH_PREDICT ? lead_us : 0);
+    memset(res, 0, sizeof(*res));
+
+    double err2 = 0, moving2 = 0;
+    int n = 0, moving = 0;
+    bool have_last = false;
+    uint16_t last_x = 0, last_y = 0;
+    for (int i = 0; i < tr->count; i++) {
+        const bench_sample_t *s = &tr->s[i];
+        if (!s->pressed) {
+            touch_filter_reset(&f);
+            have_last = false;
+            continue;
+        }
+        uint16_t x = s->x, y = s->y;
+        if (variant != BENCH_RAW) {
+            touch_filter_update(&f, s->time_us, &x, &y, BENCH_X_MAX, BENCH_Y_MAX);
+        }
+        if (have_last && (x != last_x || y != last_y)) {
+            res->changes++;
+        }
+
+        if (tr->has_truth) {
+            float tx, ty, nx, ny;
+            bench_truth_at(tr, s->time_us + lead_us, &tx, &ty);
+            bench_truth_at(tr, s->time_us + lead_us + BENCH_PERIOD_US, &nx, &ny);
+            double e2 = (x - tx) * (x - tx) + (y - ty) * (y - ty);
+            err2 += e2;
+            n++;
+            bool still = fabsf(nx - tx) < 0.05f && fabsf(ny - ty) < 0.05f;
+            if (!still) {
+                moving2 += e2;
+                moving++;
+            } else if (have_last && (x != last_x || y != last_y)) {
+                res->still_changes++;
+            }
+            if (tr->stop_x >= 0 && s->time_us >= tr->stop_us && x - tr->stop_x > res->overshoot) {
+                res->overshoot = x - tr->stop_x;
+            }
+        }
+        last_x = x;
+        last_y = y;
+        have_last = true;
+    }
+    res->err_rms = n ? sqrt(err2 / n) : 0;
+    res->err_moving_rms = moving ? sqrt(moving2 / moving) : 0;
+    touch_filter_get_stats(&f, stats);
+}
+
+/**
+ * @brief 回放一条轨迹的三种输出；内置轨迹检查滤波的效果
+ */
+static bool bench_run(const bench_trace_t *tr, uint32_t lead_us) {
+    bench_result_t res[BENCH_VARIANT_COUNT];
+    touch_filter_stats_t stats;
+    printf("%s (%d samples)\n", tr->name, tr->count);
+    for (int v = 0; v < BENCH_VARIANT_COUNT; v++) {
+        bench_replay(tr, v, lead_us, &res[v], &stats);
+        printf("  %-11s changes %4lu", variant_names[v], (unsigned long)res[v].changes);
+        if (tr->has_truth) {
+            printf("  still %4lu  err %5.2f px  moving %5.2f px", (unsigned long)res[v].still_changes,
+                   res[v].err_rms, res[v].err_moving_rms);
+            if (tr->stop_x >= 0) {
+                printf("  overshoot %4.1f px", res[v].overshoot);
+            }
+        }
+        if (v != BENCH_RAW) {
+            printf("  jitter %lu.%02lu -> %lu.%02lu px  predict %lu.%02lu px",
+                   (unsigned long)stats.raw_jitter_cpx / 100, (unsigned long)stats.raw_jitter_cpx % 100,
+                   (unsigned long)stats.out_jitter_cpx / 100, (unsigned long)stats.out_jitter_cpx % 100,
+                   (unsigned long)stats.predict_avg_cpx / 100, (unsigned long)stats.predict_avg_cpx % 100);
+        }
+        printf("\n");
+    }
+    if (!tr->has_truth) {
+        return true;
+    }
+
+    bool ok = true;
+    const bench_result_t *raw = &res[BENCH_RAW], *pred = &res[BENCH_PREDICT];
+    // 静止时(含停下后输出收敛的过程)输出变化至少减少到原始坐标的1/3
+    if (raw->still_changes >= BENCH_MIN_STILL && pred->still_changes * 3 > raw->still_changes) {
+        printf("FAIL: %s: %lu changes while still, raw %lu\n", tr->name, (unsigned long)pred->still_changes,
+               (unsigned long)raw->still_changes);
+        ok = false;
+    }
+    // 移动时离延迟后的手指位置比原始坐标近
+    if (raw->err_moving_rms > 0 && pred->err_moving_rms >= raw->err_moving_rms) {
+        printf("FAIL: %s: moving error %.2f px, raw %.2f px\n", tr->name, pred->err_moving_rms,
+               raw->err_moving_rms);
+        ok = false;
+    }
+    if (tr->stop_x >= 0 && pred->overshoot > 3.0f) {
+        printf("FAIL: %s: overshoot %.1f px\n", tr->name, pred->overshoot);
+        ok = false;
+    }
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    uint32_t lead_us = BENCH_LEAD_US;
+    const char *dump_dir = NULL;
+    int first_file = argc;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--lead-us") == 0 && i + 1 < argc) {
+            lead_us = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--min-cutoff") == 0 && i + 1 < argc) {
+            bench_cfg.min_cutoff_hz = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--beta") == 0 && i + 1 < argc) {
+            bench_cfg.beta = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--d-cutoff") == 0 && i + 1 < argc) {
+            bench_cfg.d_cutoff_hz = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc) {
+            dump_dir = argv[++i];
+        } else {
+            first_file = i;
+            break;
+        }
+    }
+    printf("lead %lu us, sample period %d us, noise %.1f px, min cutoff %.2f Hz, beta %.3f, d cutoff %.1f Hz\n",
+           (unsigned long)lead_us, BENCH_PERIOD_US, BENCH_NOISE_PX, bench_cfg.min_cutoff_hz, bench_cfg.beta,
+           bench_cfg.d_cutoff_hz);
+
+    static bench_trace_t tr;
+    static const struct {
+        const char *name;
+        bench_path_t path;
+        float seconds;
+        float stop_s;
+    } builtin[] = {
+        { "hold", path_hold, 2.0f, 0 },
+        { "slow_drag", path_slow_drag, 2.0f, 0 },
+        { "swipe", path_swipe, 0.8f, 0 },
+        { "drag_stop", path_drag_stop, 1.6f, 0.6f },
+        { "slider", path_slider, 3.0f, 0 },
+    };
+    bool ok = true;
+    // 没有测得延迟时也要外推，否则移动时滤波输出比原始坐标滞后
+    touch_filter_t def;
+    touch_filter_stats_t def_stats;
+    touch_filter_init(&def, NULL);
+    touch_filter_get_stats(&def, &def_stats);
+    if (def_stats.lead_us != TOUCH_FILTER_DEFAULT_LEAD_MS * 1000) {
+        printf("FAIL: default lead %lu us\n", (unsigned long)def_stats.lead_us);
+        ok = false;
+    }
+    for (size_t i = 0; i < sizeof(builtin) / sizeof(builtin[0]); i++) {
+        bench_generate(&tr, builtin[i].name, builtin[i].path, builtin[i].seconds, builtin[i].stop_s);
+        ok &= bench_run(&tr, lead_us);
+        if (dump_dir) {
+            ok &= bench_dump(&tr, dump_dir);
+        }
+    }
+    for (int i = first_file; i < argc; i++) {
+        if (bench_load(&tr, argv[i])) {
+            ok &= bench_run(&tr, lead_us);
+        } else {
+            ok = false;
+        }
+    }
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+// 压缩图片资源，由tools/img_asset_pack.py生成，用lcd_draw_asset显示
+
+#include "img_asset.h"
+
+extern const img_asset_t img_yingwu;    // 320x240，源图片yingwu.h
+
+#endif // ASSETS_H
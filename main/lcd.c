@@ -1,42 +1,44 @@
 #include "lcd.h"
 
-#include "driver/i2c.h"      // 旧版I2C头文件
 #include "esp_err.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
 
 // 日志TAG定义
 static const char *TAG = "esp32_s3_lcd";
 
-#define I2C_MASTER_NUM      BSP_I2C_NUM
-#define I2C_MASTER_SDA_IO   BSP_I2C_SDA
-#define I2C_MASTER_SCL_IO   BSP_I2C_SCL
-#define I2C_MASTER_FREQ_HZ  BSP_I2C_FREQ_HZ
-#define I2C_MASTER_TX_BUF_DISABLE 0
-#define I2C_MASTER_RX_BUF_DISABLE 0
-#define WRITE_BIT  I2C_MASTER_WRITE
-#define READ_BIT   I2C_MASTER_READ
-#define ACK_CHECK_EN  0x1
-#define ACK_CHECK_DIS 0x0
+static i2c_bus_dev_handle_t pca9557_dev = NULL;    // PCA9557在总线管理中的设备句柄
 
 /**
- * @brief I2C硬件初始化（旧版API）
+ * @brief PCA9557影子寄存器：输出和配置寄存器的当前值，改变引脚只需一次写入
+ * @note lock保证"计算新值-写入-更新影子"不被其他任务打断；写入失败时影子保持原值
+ */
+static struct {
+    uint8_t output;
+    uint8_t config;
+    bool valid;                     ///< 已由pca9557_init写入或从芯片读回
+    SemaphoreHandle_t lock;
+    pca9557_stats_t stats;
+} pca9557 = { 0 };
+
+/**
+ * @brief I2C总线初始化：创建总线管理并添加PCA9557
+ * @note 触摸芯片在bsp_touch_new中以最高优先级添加
  * @return esp_err_t 返回ESP_OK表示成功，否则失败
  */
 esp_err_t bsp_i2c_init(void) {
-    i2c_config_t conf = {
-        .mode = I2C_MODE_MASTER,
-        .sda_io_num = I2C_MASTER_SDA_IO,
-        .scl_io_num = I2C_MASTER_SCL_IO,
-        .sda_pullup_en = GPIO_PULLUP_ENABLE,
-        .scl_pullup_en = GPIO_PULLUP_ENABLE,
-        .master.clk_speed = I2C_MASTER_FREQ_HZ,
-        // .clk_flags = 0, // v4.x可选
+    ESP_RETURN_ON_ERROR(i2c_bus_init(BSP_I2C_NUM, BSP_I2C_SDA, BSP_I2C_SCL, BSP_I2C_FREQ_HZ), TAG, "I2C bus init failed");
+    const i2c_bus_dev_config_t pca9557_cfg = {
+        .name = "pca9557",
+        .addr = PCA9557_SENSOR_ADDR,
+        .max_scl_hz = PCA9557_MAX_SCL_HZ,
+        .prio = I2C_BUS_PRIO_LOW,
     };
-    ESP_ERROR_CHECK(i2c_param_config(I2C_MASTER_NUM, &conf));
-    ESP_ERROR_CHECK(i2c_driver_install(I2C_MASTER_NUM, conf.mode,
-                                       I2C_MASTER_RX_BUF_DISABLE,
-                                       I2C_MASTER_TX_BUF_DISABLE, 0));
-    return ESP_OK;
+    pca9557.lock = xSemaphoreCreateMutex();
+    ESP_RETURN_ON_FALSE(pca9557.lock, ESP_ERR_NO_MEM, TAG, "no mem for PCA9557 lock");
+    return i2c_bus_add_device(&pca9557_cfg, &pca9557_dev);
 }
 
 /***************    IO扩展芯片 ↓   *************************/
@@ -50,13 +52,7 @@ esp_err_t bsp_i2c_init(void) {
  */
 esp_err_t pca9557_register_read(uint8_t reg_addr, uint8_t *data, size_t len) {
     // 先写寄存器地址，再读数据
-    return i2c_master_write_read_device(
-        I2C_MASTER_NUM,
-        PCA9557_SENSOR_ADDR, 
-        &reg_addr, 1, 
-        data, len, 
-        1000 / portTICK_PERIOD_MS
-    );
+    return i2c_bus_write_read(pca9557_dev, &reg_addr, 1, data, len);
 }
 
 /**
@@ -67,31 +63,117 @@ esp_err_t pca9557_register_read(uint8_t reg_addr, uint8_t *data, size_t len) {
  */
 esp_err_t pca9557_register_write_byte(uint8_t reg_addr, uint8_t data) {
     uint8_t write_buf[2] = {reg_addr, data};
-    return i2c_master_write_to_device(
-        I2C_MASTER_NUM, 
-        PCA9557_SENSOR_ADDR, 
-        write_buf, sizeof(write_buf), 
-        1000 / portTICK_PERIOD_MS
-    );
+    return i2c_bus_write(pca9557_dev, write_buf, sizeof(write_buf));
 }
 
+#if PCA9557_RESYNC_MS > 0
+static TaskHandle_t pca9557_resync_task_handle = NULL;
+
+/**
+ * @brief 回读核对任务：由定时器通知唤醒，在任务上下文中执行阻塞的总线访问
+ */
+static void pca9557_resync_task(void *arg) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        pca9557_resync();
+    }
+}
+
+/**
+ * @brief 定时器回调：只通知回读任务，不在esp_timer任务中等待I2C
+ */
+static void pca9557_resync_cb(void *arg) {
+    xTaskNotifyGive(pca9557_resync_task_handle);
+}
+#endif
+
 /**
  * @brief 初始化PCA9557 IO扩展芯片
  */
 void pca9557_init(void) {
-    esp_err_t ret;
-    // 设置控制引脚默认状态 DVP_PWDN=1, PA_EN=0, LCD_CS=1
-    ret = pca9557_register_write_byte(
-        PCA9557_OUTPUT_PORT, 0x05);  // 0000 0101 (IO0和IO2输出1，其余为0)
+    // 设置控制引脚默认状态 DVP_PWDN=1, PA_EN=0, LCD_CS=1：0000 0101 (IO0和IO2输出1，其余为0)
+    // 设置IO1, IO2, IO3为输出（低三位为0），其余为输入（高五位为1）
+    // 两次写入作为一组提交，总线任务连续执行
+    const uint8_t output[2] = {PCA9557_OUTPUT_PORT, 0x05};
+    const uint8_t config[2] = {PCA9557_CONFIGURATION_PORT, 0xf8};
+    const i2c_bus_xfer_t xfers[2] = {
+        { .wbuf = output, .wlen = sizeof(output) },
+        { .wbuf = config, .wlen = sizeof(config) },
+    };
+    xSemaphoreTake(pca9557.lock, portMAX_DELAY);
+    esp_err_t ret = i2c_bus_transfer(pca9557_dev, xfers, 2);
+    if (ret == ESP_OK) {
+        pca9557.output = output[1];
+        pca9557.config = config[1];
+        pca9557.valid = true;
+    }
+    xSemaphoreGive(pca9557.lock);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to set PCA9557 output port: %s", esp_err_to_name(ret));
+        ESP_LOGE(TAG, "Failed to init PCA9557: %s", esp_err_to_name(ret));
         return;
     }
-    // 设置IO1, IO2, IO3为输出（低三位为0），其余为输入（高五位为1）
-    ret = pca9557_register_write_byte(PCA9557_CONFIGURATION_PORT, 0xf8);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to set PCA9557 configuration port: %s", esp_err_to_name(ret));
+
+#if PCA9557_RESYNC_MS > 0
+    if (xTaskCreate(pca9557_resync_task, "pca9557_resync", PCA9557_RESYNC_TASK_STACK, NULL,
+                    PCA9557_RESYNC_TASK_PRIORITY, &pca9557_resync_task_handle) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create PCA9557 resync task");
+        return;
+    }
+    const esp_timer_create_args_t resync_args = {
+        .callback = pca9557_resync_cb,
+        .name = "pca9557_resync",
+    };
+    esp_timer_handle_t resync_timer;
+    if (esp_timer_create(&resync_args, &resync_timer) == ESP_OK) {
+        esp_timer_start_periodic(resync_timer, PCA9557_RESYNC_MS * 1000ULL);
+    }
+#endif
+}
+
+/**
+ * @brief 读取输出和配置寄存器作为影子寄存器的初值(未经pca9557_init初始化时)
+ */
+static esp_err_t pca9557_load_shadow(void) {
+    uint8_t output, config;
+    const uint8_t output_reg = PCA9557_OUTPUT_PORT, config_reg = PCA9557_CONFIGURATION_PORT;
+    const i2c_bus_xfer_t xfers[2] = {
+        { .wbuf = &output_reg, .wlen = 1, .rbuf = &output, .rlen = 1 },
+        { .wbuf = &config_reg, .wlen = 1, .rbuf = &config, .rlen = 1 },
+    };
+    esp_err_t ret = i2c_bus_transfer(pca9557_dev, xfers, 2);
+    if (ret == ESP_OK) {
+        pca9557.output = output;
+        pca9557.config = config;
+        pca9557.valid = true;
+    }
+    return ret;
+}
+
+/**
+ * @brief 一次写入改变多个输出引脚
+ * @note 按影子寄存器计算新值，不回读芯片；输出不变时不访问总线
+ * @param mask   要改变的引脚位
+ * @param values 这些引脚的新电平(只取mask中的位)
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t pca9557_apply(uint8_t mask, uint8_t values) {
+    ESP_RETURN_ON_FALSE(pca9557.lock, ESP_ERR_INVALID_STATE, TAG, "I2C not initialized");
+    xSemaphoreTake(pca9557.lock, portMAX_DELAY);
+    esp_err_t ret = pca9557.valid ? ESP_OK : pca9557_load_shadow();
+    if (ret == ESP_OK) {
+        uint8_t output = (pca9557.output & ~mask) | (values & mask);
+        if (output == pca9557.output) {
+            pca9557.stats.skipped++;
+        } else {
+            ret = pca9557_register_write_byte(PCA9557_OUTPUT_PORT, output);
+            if (ret == ESP_OK) {
+                pca9557.output = output;
+                pca9557.stats.writes++;
+            }
+        }
     }
+    xSemaphoreGive(pca9557.lock);
+    return ret;
 }
 
 /**
@@ -101,17 +183,50 @@ void pca9557_init(void) {
  * @return esp_err_t 返回ESP_OK表示成功
  */
 esp_err_t pca9557_set_output_state(uint8_t gpio_bit, uint8_t level) {
-    uint8_t data;
-    esp_err_t res = ESP_FAIL;
+    return pca9557_apply(gpio_bit, level ? gpio_bit : 0);
+}
 
-    res = pca9557_register_read(PCA9557_OUTPUT_PORT, &data, 1); // 先读取当前输出状态
-    if (res != ESP_OK) {
-        return res;
+/**
+ * @brief 回读输出和配置寄存器，与影子寄存器不一致时(如芯片掉电复位)按影子寄存器重新写入
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t pca9557_resync(void) {
+    ESP_RETURN_ON_FALSE(pca9557.lock, ESP_ERR_INVALID_STATE, TAG, "I2C not initialized");
+    xSemaphoreTake(pca9557.lock, portMAX_DELAY);
+    if (!pca9557.valid) {
+        xSemaphoreGive(pca9557.lock);
+        return ESP_ERR_INVALID_STATE;
     }
-    res = pca9557_register_write_byte(
-        PCA9557_OUTPUT_PORT, SET_BITS(data, gpio_bit, level)); // 修改后写回
+    uint8_t output, config;
+    const uint8_t output_reg = PCA9557_OUTPUT_PORT, config_reg = PCA9557_CONFIGURATION_PORT;
+    const i2c_bus_xfer_t reads[2] = {
+        { .wbuf = &output_reg, .wlen = 1, .rbuf = &output, .rlen = 1 },
+        { .wbuf = &config_reg, .wlen = 1, .rbuf = &config, .rlen = 1 },
+    };
+    esp_err_t ret = i2c_bus_transfer(pca9557_dev, reads, 2);
+    pca9557.stats.resyncs++;
+    if (ret == ESP_OK && (output != pca9557.output || config != pca9557.config)) {
+        ESP_LOGW(TAG, "PCA9557 out of sync: output 0x%02x/0x%02x config 0x%02x/0x%02x", output, pca9557.output,
+                 config, pca9557.config);
+        pca9557.stats.mismatches++;
+        // 先写输出再写配置，引脚切换为输出时直接是正确电平
+        const uint8_t wr_output[2] = {PCA9557_OUTPUT_PORT, pca9557.output};
+        const uint8_t wr_config[2] = {PCA9557_CONFIGURATION_PORT, pca9557.config};
+        const i2c_bus_xfer_t writes[2] = {
+            { .wbuf = wr_output, .wlen = sizeof(wr_output) },
+            { .wbuf = wr_config, .wlen = sizeof(wr_config) },
+        };
+        ret = i2c_bus_transfer(pca9557_dev, writes, 2);
+    }
+    xSemaphoreGive(pca9557.lock);
+    return ret;
+}
 
-    return res;
+/**
+ * @brief 获取PCA9557访问统计
+ */
+void pca9557_get_stats(pca9557_stats_t *out) {
+    *out = pca9557.stats;
 }
 
 /**
@@ -245,7 +360,7 @@ esp_err_t bsp_display_new(esp_lcd_panel_handle_t *panel_handle,esp_lcd_panel_io_
         .lcd_cmd_bits = LCD_CMD_BITS,
         .lcd_param_bits = LCD_PARAM_BITS,
         .spi_mode = 2,
-        .trans_queue_depth = 10,
+        .trans_queue_depth = BSP_LCD_TRANS_QUEUE_DEPTH,
     };
     ESP_GOTO_ON_ERROR(esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)BSP_LCD_SPI_NUM, &io_config, io_handle), err, TAG, "New panel IO failed");
     ESP_LOGD(TAG, "Install LCD driver");
@@ -276,30 +391,208 @@ err:
     return ret;
 }
 
+/**
+ * @brief 分条传输一个矩形区域
+ * @note 两块BSP_LCD_BLIT_STRIP_BYTES大小的内部DMA缓冲区轮流使用：第N条在总线上传输时，
+ *       CPU准备第N+1条。draw_bitmap发送窗口命令前会等待上一条传输完成，所以写入某块缓冲区时
+ *       它上一次的传输一定已经结束；最后发送NOP等待最后一条完成后释放缓冲区
+ * @param x,y           屏幕上的起始坐标(调用者保证区域在屏幕内)
+ * @param width,height  区域尺寸
+ * @param fill_cb       分条填充回调
+ * @param ctx           传给回调的参数
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t lcd_blit_strips(int x, int y, int width, int height,
+                          lcd_strip_fill_cb_t fill_cb, void *ctx,
+                          esp_lcd_panel_handle_t *panel_handle,
+                          esp_lcd_panel_io_handle_t *io_handle)
+{
+    if (width <= 0 || height <= 0) {
+        return ESP_OK;
+    }
+    int strip_rows = BSP_LCD_BLIT_STRIP_BYTES / (width * (int)sizeof(uint16_t));
+    ESP_RETURN_ON_FALSE(strip_rows > 0, ESP_ERR_INVALID_SIZE, TAG, "row wider than strip buffer");
+    if (strip_rows > height) {
+        strip_rows = height;
+    }
+
+    size_t strip_size = (size_t)width * strip_rows * sizeof(uint16_t);
+    uint16_t *strips[2] = {
+        heap_caps_malloc(strip_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL),
+        heap_caps_malloc(strip_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL),
+    };
+    esp_err_t ret = ESP_OK;
+    ESP_GOTO_ON_FALSE(strips[0] && strips[1], ESP_ERR_NO_MEM, out, TAG, "Memory for strip buffer is not enough");
+
+    for (int row = 0, n = 0; row < height; row += strip_rows, n ^= 1) {
+        int rows = (height - row) < strip_rows ? (height - row) : strip_rows;
+        ESP_GOTO_ON_ERROR(fill_cb(ctx, strips[n], row, rows, width), drain, TAG, "fill strip failed");
+        ESP_GOTO_ON_ERROR(esp_lcd_panel_draw_bitmap(*panel_handle, x, y + row, x + width, y + row + rows, strips[n]),
+                          drain, TAG, "draw strip failed");
+    }
+
+drain:
+    esp_lcd_panel_io_tx_param(*io_handle, LCD_CMD_NOP, NULL, 0);
+out:
+    heap_caps_free(strips[0]);
+    heap_caps_free(strips[1]);
+    return ret;
+}
+
+/**
+ * @brief lcd_blit_image的分条回调：从源图像逐行复制
+ */
+typedef struct {
+    const lcd_image_t *image;
+    int src_x;
+    int src_y;
+} lcd_image_strip_t;
+
+static esp_err_t lcd_image_fill_strip(void *ctx, uint16_t *buf, int row, int rows, int width)
+{
+    const lcd_image_strip_t *strip = ctx;
+    int stride = strip->image->stride ? strip->image->stride : strip->image->width;
+    const uint8_t *src = strip->image->data +
+                         ((size_t)(strip->src_y + row) * stride + strip->src_x) * sizeof(uint16_t);
+    for (int i = 0; i < rows; i++) {
+        memcpy(buf + (size_t)i * width, src, width * sizeof(uint16_t));
+        src += (size_t)stride * sizeof(uint16_t);
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief 把图像的一个子区域画到屏幕上
+ * @note 区域同时按图像边界和屏幕边界裁剪；额外内存只有两块分条缓冲区，与图像大小无关
+ * @param image  源图像
+ * @param src_x,src_y    子区域在图像中的起点
+ * @param width,height   子区域尺寸
+ * @param dst_x,dst_y    子区域在屏幕上的起点(可以为负或超出屏幕)
+ * @return esp_err_t 返回ESP_OK表示成功，区域完全被裁掉时也返回ESP_OK
+ */
+esp_err_t lcd_blit_image(const lcd_image_t *image, int src_x, int src_y,
+                         int width, int height, int dst_x, int dst_y,
+                         esp_lcd_panel_handle_t *panel_handle,
+                         esp_lcd_panel_io_handle_t *io_handle)
+{
+    ESP_RETURN_ON_FALSE(image && image->data, ESP_ERR_INVALID_ARG, TAG, "invalid image");
+
+    // 先按图像边界裁剪，再按屏幕边界裁剪，两边的起点同步移动
+    if (src_x < 0) { width += src_x; dst_x -= src_x; src_x = 0; }
+    if (src_y < 0) { height += src_y; dst_y -= src_y; src_y = 0; }
+    if (dst_x < 0) { width += dst_x; src_x -= dst_x; dst_x = 0; }
+    if (dst_y < 0) { height += dst_y; src_y -= dst_y; dst_y = 0; }
+    if (width > image->width - src_x) { width = image->width - src_x; }
+    if (height > image->height - src_y) { height = image->height - src_y; }
+    if (width > BSP_LCD_H_RES - dst_x) { width = BSP_LCD_H_RES - dst_x; }
+    if (height > BSP_LCD_V_RES - dst_y) { height = BSP_LCD_V_RES - dst_y; }
+    if (width <= 0 || height <= 0) {
+        return ESP_OK;
+    }
+
+    lcd_image_strip_t strip = {
+        .image = image,
+        .src_x = src_x,
+        .src_y = src_y,
+    };
+    return lcd_blit_strips(dst_x, dst_y, width, height, lcd_image_fill_strip, &strip, panel_handle, io_handle);
+}
+
+/**
+ * @brief lcd_draw_asset的分条回调：按行解码，屏幕外的部分只解码不输出
+ */
+typedef struct {
+    img_asset_decoder_t dec;
+    int skip_left;      ///< 每行左侧裁掉的像素数
+    int skip_right;     ///< 每行右侧裁掉的像素数
+} lcd_asset_strip_t;
+
+static esp_err_t lcd_asset_fill_strip(void *ctx, uint16_t *buf, int row, int rows, int width)
+{
+    lcd_asset_strip_t *strip = ctx;
+    uint8_t *dst = (uint8_t *)buf;
+    esp_err_t ret = ESP_OK;
+    for (int i = 0; i < rows && ret == ESP_OK; i++) {
+        ret = img_asset_decode(&strip->dec, NULL, strip->skip_left);
+        if (ret == ESP_OK) {
+            ret = img_asset_decode(&strip->dec, dst, width);
+        }
+        if (ret == ESP_OK) {
+            ret = img_asset_decode(&strip->dec, NULL, strip->skip_right);
+        }
+        dst += width * sizeof(uint16_t);
+    }
+    return ret;
+}
+
+/**
+ * @brief 显示压缩图片资源
+ * @note 直接解码到分条缓冲区，不需要整幅图片的内存；超出屏幕的部分被裁掉。
+ *       解码和传输耗时以DEBUG级别输出，累计统计见img_asset_get_stats
+ * @param asset 图片资源
+ * @param x,y   图片左上角在屏幕上的坐标(可以为负)
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t lcd_draw_asset(const img_asset_t *asset, int x, int y,
+                         esp_lcd_panel_handle_t *panel_handle,
+                         esp_lcd_panel_io_handle_t *io_handle)
+{
+    int width, height;
+    lcd_asset_strip_t strip;
+    ESP_RETURN_ON_ERROR(img_asset_decoder_init(&strip.dec, asset), TAG, "invalid asset");
+    img_asset_info(asset, &width, &height);
+
+    int left = x < 0 ? -x : 0;
+    int top = y < 0 ? -y : 0;
+    int right = (x + width > BSP_LCD_H_RES) ? x + width - BSP_LCD_H_RES : 0;
+    int bottom = (y + height > BSP_LCD_V_RES) ? y + height - BSP_LCD_V_RES : 0;
+    if (left + right >= width || top + bottom >= height) {
+        return ESP_OK;
+    }
+    strip.skip_left = left;
+    strip.skip_right = right;
+
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = img_asset_decode(&strip.dec, NULL, (size_t)top * width);   // 跳过屏幕上方的行
+    if (ret == ESP_OK) {
+        ret = lcd_blit_strips(x + left, y + top, width - left - right, height - top - bottom,
+                              lcd_asset_fill_strip, &strip, panel_handle, io_handle);
+    }
+    uint32_t total_us = (uint32_t)(esp_timer_get_time() - start);
+    img_asset_decoder_end(&strip.dec, asset);
+    ESP_LOGD(TAG, "Asset %dx%d: %u px decoded in %u us (%.1f MB/s), %u us total",
+             width, height, (unsigned)strip.dec.pixels, (unsigned)strip.dec.decode_us,
+             strip.dec.decode_us ? strip.dec.pixels * 2.0f / strip.dec.decode_us : 0.0f,
+             (unsigned)total_us);
+    return ret;
+}
+
 /**
  * @brief 显示图片
+ * @note 分条传输，不再把整幅图片复制到SPIRAM
  * @param x_start 起始X坐标
  * @param y_start 起始Y坐标
  * @param x_end   结束X坐标
  * @param y_end   结束Y坐标
  * @param gImage  图像数据指针
  */
-void lcd_draw_picture(int x_start, int y_start, int x_end, int y_end, const unsigned char *gImage, esp_lcd_panel_handle_t *panel_handle)
+void lcd_draw_picture(int x_start, int y_start, int x_end, int y_end, const unsigned char *gImage,
+                      esp_lcd_panel_handle_t *panel_handle, esp_lcd_panel_io_handle_t *io_handle)
 {
-    size_t pixels_byte_size = (x_end - x_start) * (y_end - y_start) * 2;
-    uint16_t *pixels = (uint16_t *)heap_caps_malloc(pixels_byte_size, MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM);
-    if (NULL == pixels)
-    {
-        ESP_LOGE(TAG, "Memory for bitmap is not enough");
-        return;
+    const lcd_image_t image = {
+        .data = gImage,
+        .width = x_end - x_start,
+        .height = y_end - y_start,
+    };
+    esp_err_t ret = lcd_blit_image(&image, 0, 0, image.width, image.height, x_start, y_start, panel_handle, io_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Draw picture failed: %s", esp_err_to_name(ret));
     }
-    memcpy(pixels, gImage, pixels_byte_size);
-    esp_lcd_panel_draw_bitmap(*panel_handle, x_start, y_start, x_end, y_end, (uint16_t *)pixels);
-    heap_caps_free(pixels);
 }
 
 /**
- * @brief 设置整屏颜色
+ * @brief 设置整屏颜色(逐行刷新)
+ * @note 每行一次draw_bitmap，共240次命令/地址设置；保留用于和lcd_fill_color对比耗时
  * @param color 颜色值
  */
 void lcd_set_color(uint16_t color, esp_lcd_panel_handle_t *panel_handle)
@@ -324,6 +617,57 @@ void lcd_set_color(uint16_t color, esp_lcd_panel_handle_t *panel_handle)
     }
 }
 
+/**
+ * @brief 整屏填充纯色(DMA流水线)
+ * @note 只设置一次整屏窗口，用同一块内部DMA缓冲区连续排队多行颜色事务：第一个事务带RAMWR，
+ *       后面的不带命令，接着写显存而不用等前一个事务完成，最多同时有trans_queue_depth个在途；
+ *       最后发送一个NOP(轮询命令会等待所有在途事务)，只等待这一次
+ * @param color 颜色值
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t lcd_fill_color(uint16_t color, esp_lcd_panel_handle_t *panel_handle,
+                         esp_lcd_panel_io_handle_t *io_handle)
+{
+    esp_lcd_panel_io_handle_t io = *io_handle;
+    int rows = BSP_LCD_FILL_ROWS;
+    uint16_t *buffer = NULL;
+
+    // 内部RAM紧张时减少每个事务的行数
+    while (rows > 0) {
+        buffer = (uint16_t *)heap_caps_malloc(BSP_LCD_H_RES * rows * sizeof(uint16_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (buffer != NULL) {
+            break;
+        }
+        rows /= 2;
+    }
+    if (NULL == buffer) {
+        ESP_LOGW(TAG, "No DMA memory for fill buffer, falling back to row fill");
+        lcd_set_color(color, panel_handle);
+        return ESP_OK;
+    }
+    for (size_t i = 0; i < BSP_LCD_H_RES * rows; i++) {
+        buffer[i] = color;
+    }
+
+    esp_err_t ret = ESP_OK;
+    const uint8_t caset[4] = { 0, 0, (BSP_LCD_H_RES - 1) >> 8, (BSP_LCD_H_RES - 1) & 0xFF };
+    const uint8_t raset[4] = { 0, 0, (BSP_LCD_V_RES - 1) >> 8, (BSP_LCD_V_RES - 1) & 0xFF };
+    ESP_GOTO_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, caset, sizeof(caset)), out, TAG, "set window failed");
+    ESP_GOTO_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, raset, sizeof(raset)), out, TAG, "set window failed");
+    for (int y = 0; y < BSP_LCD_V_RES; y += rows) {
+        int n = (BSP_LCD_V_RES - y) < rows ? (BSP_LCD_V_RES - y) : rows;
+        ESP_GOTO_ON_ERROR(esp_lcd_panel_io_tx_color(io, y == 0 ? LCD_CMD_RAMWR : -1, buffer,
+                                                    BSP_LCD_H_RES * n * sizeof(uint16_t)),
+                          out, TAG, "queue color failed");
+    }
+
+out:
+    // 等待所有在途事务完成后才能释放缓冲区
+    esp_lcd_panel_io_tx_param(io, LCD_CMD_NOP, NULL, 0);
+    heap_caps_free(buffer);
+    return ret;
+}
+
 /**
  * @brief LCD显示初始化
  * @return esp_err_t 返回ESP_OK表示成功
@@ -332,7 +676,7 @@ esp_err_t bsp_lcd_init(esp_lcd_panel_handle_t *panel_handle,esp_lcd_panel_io_han
     esp_err_t ret = ESP_OK;
 
     ret = bsp_display_new(panel_handle,io_handle);
-    lcd_set_color(0x0000, panel_handle);
+    lcd_fill_color(0x0000, panel_handle, io_handle);
     ret = esp_lcd_panel_disp_on_off(*panel_handle, true);
     ret = bsp_display_backlight_on();
 
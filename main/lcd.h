@@ -3,16 +3,18 @@
 
 #include <string.h>
 
-#include "driver/i2c.h"
 #include "driver/ledc.h"
 #include "driver/spi_master.h"
 #include "esp_check.h"
+#include "esp_lcd_panel_commands.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_vendor.h"
 #include "esp_lcd_types.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "i2c_bus.h"
+#include "img_asset.h"
 #include "math.h"
 #include "stdio.h"
 
@@ -21,9 +23,9 @@
 #define BSP_I2C_SCL (GPIO_NUM_2)  // SCL引脚
 
 #define BSP_I2C_NUM (0)         // I2C外设
-#define BSP_I2C_FREQ_HZ 100000  // 100kHz
+#define BSP_I2C_FREQ_HZ 400000  // 总线时钟上限400kHz，各设备按自身支持的最高时钟运行
 
-esp_err_t bsp_i2c_init(void);  // 初始化I2C接口
+esp_err_t bsp_i2c_init(void);  // 初始化I2C总线管理
 
 /***************    IO扩展芯片 ↓   *************************/
 #define PCA9557_INPUT_PORT 0x00
@@ -36,6 +38,7 @@ esp_err_t bsp_i2c_init(void);  // 初始化I2C接口
 #define DVP_PWDN_GPIO BIT(2)  // PCA9557_GPIO_NUM_3
 
 #define PCA9557_SENSOR_ADDR 0x19 /*!< Slave address of the PCA9557 sensor */
+#define PCA9557_MAX_SCL_HZ 400000 // PCA9557支持的最高I2C时钟
 
 /**
  * @brief 对某一组位进行按位设置或清零
@@ -46,7 +49,27 @@ esp_err_t bsp_i2c_init(void);  // 初始化I2C接口
  */
 #define SET_BITS(_m, _s, _v) ((_v) ? (_m) | ((_s)) : (_m) & ~((_s)))
 
+// 周期性回读输出/配置寄存器并与影子寄存器核对的周期(ms)，0表示不回读
+#ifndef PCA9557_RESYNC_MS
+#define PCA9557_RESYNC_MS 0
+#endif
+// 回读核对任务的栈大小和优先级(由定时器唤醒，低于LVGL和总线任务)
+#define PCA9557_RESYNC_TASK_STACK 2048
+#define PCA9557_RESYNC_TASK_PRIORITY 1
+
+// PCA9557访问统计
+typedef struct {
+    uint32_t writes;        ///< 写输出寄存器的次数
+    uint32_t skipped;       ///< 输出不变、省去写入的次数
+    uint32_t resyncs;       ///< 回读核对的次数
+    uint32_t mismatches;    ///< 回读与影子寄存器不一致、已重新写入的次数
+} pca9557_stats_t;
+
 void pca9557_init(void);
+esp_err_t pca9557_apply(uint8_t mask, uint8_t values);
+esp_err_t pca9557_set_output_state(uint8_t gpio_bit, uint8_t level);
+esp_err_t pca9557_resync(void);
+void pca9557_get_stats(pca9557_stats_t *out);
 void lcd_cs(uint8_t level);
 void pa_en(uint8_t level);
 void dvp_pwdn(uint8_t level);
@@ -61,6 +84,9 @@ void dvp_pwdn(uint8_t level);
 
 #define BSP_LCD_H_RES (320)
 #define BSP_LCD_V_RES (240)
+#define BSP_LCD_TRANS_QUEUE_DEPTH (10)  // 面板IO颜色事务队列深度
+#define BSP_LCD_FILL_ROWS (BSP_LCD_V_RES / BSP_LCD_TRANS_QUEUE_DEPTH)  // 纯色填充每个事务的行数，整屏刚好排满队列
+#define BSP_LCD_BLIT_STRIP_BYTES (4096)  // 图像分条传输时每块乒乓缓冲区的大小
 
 #define BSP_LCD_SPI_MOSI (GPIO_NUM_40)
 #define BSP_LCD_SPI_CLK (GPIO_NUM_41)
@@ -77,8 +103,39 @@ esp_err_t bsp_display_backlight_off(void);
 esp_err_t bsp_display_backlight_on(void);
 esp_err_t bsp_lcd_init(esp_lcd_panel_handle_t *panel_handle,esp_lcd_panel_io_handle_t *io_handle);
 void lcd_set_color(uint16_t color, esp_lcd_panel_handle_t *panel_handle);
+esp_err_t lcd_fill_color(uint16_t color, esp_lcd_panel_handle_t *panel_handle,
+                         esp_lcd_panel_io_handle_t *io_handle);
 void lcd_draw_picture(int x_start, int y_start, int x_end, int y_end,
                       const unsigned char *gImage,
-                      esp_lcd_panel_handle_t *panel_handle);
+                      esp_lcd_panel_handle_t *panel_handle,
+                      esp_lcd_panel_io_handle_t *io_handle);
+
+/**
+ * @brief RGB565图像描述(像素字节顺序与屏幕一致)
+ */
+typedef struct {
+    const uint8_t *data;    ///< 像素数据，可以直接指向Flash
+    int width;              ///< 图像宽度(像素)
+    int height;             ///< 图像高度(像素)
+    int stride;             ///< 每行像素数，0表示等于width
+} lcd_image_t;
+
+/**
+ * @brief 分条填充回调：把第row行起的rows行像素写入buf(每行width个像素，紧密排列)
+ * @return esp_err_t 返回ESP_OK表示成功，其他值会中止传输
+ */
+typedef esp_err_t (*lcd_strip_fill_cb_t)(void *ctx, uint16_t *buf, int row, int rows, int width);
+
+esp_err_t lcd_blit_strips(int x, int y, int width, int height,
+                          lcd_strip_fill_cb_t fill_cb, void *ctx,
+                          esp_lcd_panel_handle_t *panel_handle,
+                          esp_lcd_panel_io_handle_t *io_handle);
+esp_err_t lcd_blit_image(const lcd_image_t *image, int src_x, int src_y,
+                         int width, int height, int dst_x, int dst_y,
+                         esp_lcd_panel_handle_t *panel_handle,
+                         esp_lcd_panel_io_handle_t *io_handle);
+esp_err_t lcd_draw_asset(const img_asset_t *asset, int x, int y,
+                         esp_lcd_panel_handle_t *panel_handle,
+                         esp_lcd_panel_io_handle_t *io_handle);
 
 #endif  // !LCD_H
@@ -2,29 +2,58 @@
 
 static esp_lcd_touch_handle_t tp = NULL;            // 触摸屏句柄
 static lv_disp_t *disp = NULL;                      // LVGL显示句柄
+static bool disp_held = false;                      // 显示刷新被bsp_display_lvgl_add挂起
 static lv_indev_t *disp_indev = NULL;               // LVGL输入设备句柄
+#if BSP_TOUCH_FILTER
+static touch_filter_t touch_filter;                 // 触摸坐标滤波器
+#endif
 
 
 
 static const char *TAG = "esp32_s3_lvgl";  // 日志TAG定义
 
 /**
- * @brief LCD显示初始化(带LVGL)
- * @return lv_disp_t* 返回LVGL显示句柄
+ * @brief 初始化LVGL移植层(lv_init、tick定时器和LVGL任务)
+ * @return esp_err_t 返回ESP_OK表示成功
  */
-static lv_disp_t *bsp_display_lcd_init(esp_lcd_panel_io_handle_t *io_handle,esp_lcd_panel_handle_t *panel_handle) {
-  /* LCD Init */
-  bsp_display_new(panel_handle,io_handle);                              // 初始化LCD相关驱动
-  lcd_set_color(0x0000,panel_handle);                          // 设置整屏为黑色
+esp_err_t bsp_lvgl_port_init(void) {
+  lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+  lvgl_cfg.task_affinity = 1 - RENDER_PAR_WORKER_CORE;   // 另一个核心留给并行渲染的工作任务
+  return lvgl_port_init(&lvgl_cfg);
+}
+
+/**
+ * @brief 整屏清黑并打开LCD显示
+ * @note 直接通过esp_lcd写屏，调用时LVGL不能同时刷新该面板
+ */
+void bsp_display_clear(esp_lcd_panel_io_handle_t *io_handle,
+                       esp_lcd_panel_handle_t *panel_handle) {
+  lcd_fill_color(0x0000, panel_handle, io_handle); // 设置整屏为黑色
   esp_lcd_panel_disp_on_off(*panel_handle, true);  // 打开LCD显示
+}
+
+/**
+ * @brief 把LCD注册为LVGL显示
+ * @param hold_refresh 为true时关闭该显示的失效和刷新(不渲染也不写屏)，直到调用bsp_display_release
+ * @return lv_disp_t* 返回LVGL显示句柄
+ */
+lv_disp_t *bsp_display_lvgl_add(esp_lcd_panel_io_handle_t *io_handle,
+                                esp_lcd_panel_handle_t *panel_handle,
+                                bool hold_refresh) {
+  /* 按空闲的内部DMA内存选择绘图缓冲区布局 */
+  const disp_buf_cfg_t buf_cfg = DISP_BUF_DEFAULT_CONFIG(BSP_LCD_H_RES, BSP_LCD_V_RES);
+  disp_buf_plan_t plan;
+  if (disp_buf_plan(&buf_cfg, &plan) != ESP_OK) {
+    return NULL;
+  }
 
   /* Add LCD screen */
   ESP_LOGD(TAG, "Add LCD screen");
   const lvgl_port_display_cfg_t disp_cfg = {
       .io_handle = *io_handle,
       .panel_handle = *panel_handle,
-      .buffer_size = BSP_LCD_H_RES * BSP_LCD_DRAW_BUF_HEIGHT,  // LVGL缓存大小
-      .double_buffer = false,                                  // 不使用双缓冲
+      .buffer_size = BSP_LCD_H_RES * plan.rows,                           // LVGL缓存大小
+      .double_buffer = plan.layout == DISP_BUF_INTERNAL_DOUBLE,           // 两块内部缓冲区时双缓冲
       .hres = BSP_LCD_H_RES,
       .vres = BSP_LCD_V_RES,
       .monochrome = false,
@@ -37,11 +66,66 @@ static lv_disp_t *bsp_display_lcd_init(esp_lcd_panel_io_handle_t *io_handle,esp_
           },
       /* 此处设置二者只能存一 */
       .flags = {
-          .buff_dma = false,    // 使用DMA缓冲区
-          .buff_spiram = true,  // 使用SPIRAM缓冲区
+          .buff_dma = plan.layout != DISP_BUF_SPIRAM_BOUNCE,     // 使用DMA缓冲区
+          .buff_spiram = plan.layout == DISP_BUF_SPIRAM_BOUNCE,  // 使用SPIRAM缓冲区(经中转缓冲区传输)
       }};
 
-  return lvgl_port_add_disp(&disp_cfg);
+  lvgl_port_lock(0);
+  disp = lvgl_port_add_disp(&disp_cfg);
+  if (disp != NULL && disp_buf_attach(disp, *panel_handle, *io_handle, &buf_cfg, &plan) != ESP_OK) {
+    ESP_LOGE(TAG, "Draw buffer attach failed");
+  }
+  if (disp != NULL && BSP_LCD_AREA_COST_NS > 0) {
+    const disp_inv_cost_t cost = {
+        .area_ns = BSP_LCD_AREA_COST_NS,
+        .px_ns = BSP_LCD_RENDER_PX_NS +
+                 (uint32_t)(1000000000ULL * BSP_LCD_BITS_PER_PIXEL / BSP_LCD_PIXEL_CLOCK_HZ),
+    };
+    disp_inv_set_cost(disp, &cost);
+  }
+  if (disp != NULL) {
+    disp_inv_set_merge(disp, BSP_LCD_INV_MERGE);
+  }
+  if (disp != NULL && hold_refresh) {
+    // 清屏完成前不让LVGL写屏，避免两路SPI传输交错。只暂停刷新定时器不够：
+    // 任何_lv_inv_area都会恢复它，所以同时丢弃已有脏区域并关闭失效，release时整屏重绘
+    _lv_inv_area(disp, NULL);
+    lv_disp_enable_invalidation(disp, false);
+    lv_timer_pause(disp->refr_timer);
+    disp_held = true;
+  }
+  lvgl_port_unlock();
+  return disp;
+}
+
+/**
+ * @brief 恢复LVGL刷新并打开背光
+ * @note 与bsp_display_lvgl_add(hold_refresh=true)配对使用
+ */
+void bsp_display_release(void) {
+  if (disp != NULL) {
+    lvgl_port_lock(0);
+    if (disp_held) {
+      lv_disp_enable_invalidation(disp, true);
+      disp_held = false;
+    }
+    lv_timer_resume(disp->refr_timer);
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    lvgl_port_unlock();
+  }
+  bsp_display_backlight_on();
+}
+
+/**
+ * @brief LCD显示初始化(带LVGL)
+ * @return lv_disp_t* 返回LVGL显示句柄
+ */
+static lv_disp_t *bsp_display_lcd_init(esp_lcd_panel_io_handle_t *io_handle,esp_lcd_panel_handle_t *panel_handle) {
+  /* LCD Init */
+  bsp_display_new(panel_handle,io_handle);                              // 初始化LCD相关驱动
+  bsp_display_clear(io_handle, panel_handle);
+
+  return bsp_display_lvgl_add(io_handle, panel_handle, false);
 }
 
 /**
@@ -56,7 +140,7 @@ esp_err_t bsp_touch_new(esp_lcd_touch_handle_t *ret_touch) {
       .x_max = BSP_LCD_V_RES,
       .y_max = BSP_LCD_H_RES,
       .rst_gpio_num = GPIO_NUM_NC,  // Shared with LCD reset
-      .int_gpio_num = GPIO_NUM_NC,  // Shared with LCD interrupt
+      .int_gpio_num = BSP_TOUCH_INT_GPIO,
       .levels =
           {
               .reset = 0,
@@ -74,27 +158,58 @@ esp_err_t bsp_touch_new(esp_lcd_touch_handle_t *ret_touch) {
   /* 触摸
    * 库:https://components.espressif.com/components/espressif/esp_lcd_touch_ft5x06/versions/1.0.7
    */
+  // 触摸芯片经I2C总线管理访问，优先级最高，排在PCA9557等设备的请求之前执行
+  const i2c_bus_dev_config_t tp_dev_config = {
+      .name = "ft5x06",
+      .addr = ESP_LCD_TOUCH_IO_I2C_FT5x06_ADDRESS,
+      .max_scl_hz = BSP_TOUCH_MAX_SCL_HZ,
+      .prio = I2C_BUS_PRIO_HIGH,
+  };
+  i2c_bus_dev_handle_t tp_dev = NULL;
   esp_lcd_panel_io_handle_t tp_io_handle = NULL;
-  esp_lcd_panel_io_i2c_config_t tp_io_config =
-      ESP_LCD_TOUCH_IO_I2C_FT5x06_CONFIG();
-
-  ESP_RETURN_ON_ERROR(
-      esp_lcd_new_panel_io_i2c((esp_lcd_i2c_bus_handle_t)BSP_I2C_NUM,
-                               &tp_io_config, &tp_io_handle),
-      TAG, "");
+  ESP_RETURN_ON_ERROR(i2c_bus_add_device(&tp_dev_config, &tp_dev), TAG, "");
+  ESP_RETURN_ON_ERROR(i2c_bus_new_panel_io(tp_dev, &tp_io_handle), TAG, "");
   ESP_ERROR_CHECK(esp_lcd_touch_new_i2c_ft5x06(tp_io_handle, &tp_cfg,
                                                ret_touch));  // 创建触摸屏句柄
 
+#if BSP_TOUCH_FILTER
+  // 在采样任务读取坐标时滤波并外推，外推时间由main_update按测得的输入延迟更新
+  touch_filter_init(&touch_filter, NULL);
+  ESP_RETURN_ON_ERROR(touch_filter_attach(*ret_touch, &touch_filter), TAG, "Touch filter attach failed");
+#endif
   return ESP_OK;
 }
 
 /**
- * @brief 初始化LVGL显示
- * @return lv_disp_t* 返回LVGL显示句柄
+ * @brief 触摸坐标滤波器，BSP_TOUCH_FILTER为0时返回NULL
  */
-static lv_indev_t *bsp_display_indev_init(lv_disp_t *disp) {
-  ESP_ERROR_CHECK(bsp_touch_new(&tp));
+touch_filter_t *bsp_touch_filter(void) {
+#if BSP_TOUCH_FILTER
+  return tp ? &touch_filter : NULL;
+#else
+  return NULL;
+#endif
+}
+
+/**
+ * @brief 初始化触摸芯片(只访问I2C，不依赖LVGL)
+ * @return esp_err_t 返回ESP_OK表示成功
+ */
+esp_err_t bsp_touch_init(void) {
+  ESP_RETURN_ON_ERROR(bsp_touch_new(&tp), TAG, "Touch init failed");
   assert(tp);
+  return ESP_OK;
+}
+
+/**
+ * @brief 把触摸屏注册为LVGL输入设备
+ * @note 需要先完成bsp_touch_init和bsp_display_lvgl_add
+ * @return lv_indev_t* 返回LVGL输入设备句柄
+ */
+lv_indev_t *bsp_touch_lvgl_add(void) {
+  if (tp == NULL || disp == NULL) {
+    return NULL;
+  }
 
   /* Add touch input (for selected screen) */
   const lvgl_port_touch_cfg_t touch_cfg = {
@@ -102,7 +217,13 @@ static lv_indev_t *bsp_display_indev_init(lv_disp_t *disp) {
       .handle = tp,
   };
 
-  return lvgl_port_add_touch(&touch_cfg);
+  lvgl_port_lock(0);
+  disp_indev = lvgl_port_add_touch(&touch_cfg);
+  if (disp_indev != NULL && touch_sampler_attach(disp_indev, tp) != ESP_OK) {
+    ESP_LOGW(TAG, "Touch sampler not started, LVGL polls the touch controller");
+  }
+  lvgl_port_unlock();
+  return disp_indev;
 }
 
 /**
@@ -111,14 +232,14 @@ static lv_indev_t *bsp_display_indev_init(lv_disp_t *disp) {
  */
 void bsp_lvgl_start(esp_lcd_panel_io_handle_t *io_handle, esp_lcd_panel_handle_t *panel_handle) {
   /* 初始化LVGL */
-  lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
-  lvgl_port_init(&lvgl_cfg);
+  bsp_lvgl_port_init();
 
   /* 初始化液晶屏 并添加LVGL接口 */
-  disp = bsp_display_lcd_init(io_handle, panel_handle);
+  bsp_display_lcd_init(io_handle, panel_handle);
 
   /* 初始化触摸屏 并添加LVGL接口 */
-  disp_indev = bsp_display_indev_init(disp);
+  ESP_ERROR_CHECK(bsp_touch_init());
+  bsp_touch_lvgl_add();
 
   /* 打开液晶屏背光 */
   bsp_display_backlight_on();
@@ -4,11 +4,66 @@
 #include "lcd.h"
 #include "esp_lcd_touch_ft5x06.h"
 #include "esp_lvgl_port.h"
+#include "disp_buf.h"
+#include "render_par.h"
+#include "touch_sampler.h"
+#include "touch_filter.h"
+#include "disp_inv.h"
+#include "render_prof.h"
+#include "snap_cache.h"
 
-#define BSP_LCD_DRAW_BUF_HEIGHT    (20)  // LVGL绘图缓冲区高度
+// 触摸芯片INT引脚。板上未连接，接到空闲GPIO后改为对应引脚即可由中断触发采样
+#ifndef BSP_TOUCH_INT_GPIO
+#define BSP_TOUCH_INT_GPIO GPIO_NUM_NC
+#endif
+
+#define BSP_TOUCH_MAX_SCL_HZ 400000 // FT5x06支持的最高I2C时钟
+
+// 触摸坐标滤波和外推，0表示直接使用触摸芯片的原始坐标
+#ifndef BSP_TOUCH_FILTER
+#define BSP_TOUCH_FILTER 1
+#endif
+
+// 脏区域合并代价：每个刷新区域的固定开销和每像素渲染开销，每像素传输开销按像素时钟计算。
+// 每个区域的固定开销取CASET/RASET/RAMWR三个命令事务加一个颜色事务，事务开销与主机 --inv-bench 回放时的取值相同
+// (该数值下小标签轨迹的刷屏总耗时减少，拖动轨迹不变)，未计入LVGL逐区域遍历对象的CPU开销。
+// 设备上测得实际开销后修改这两个值；BSP_LCD_AREA_COST_NS为0表示使用LVGL默认的合并策略
+#define BSP_LCD_CMD_TRANS_US   (20)  // 每个SPI命令事务的固定开销
+#define BSP_LCD_COLOR_TRANS_US (25)  // 每个SPI颜色事务的固定开销
+#ifndef BSP_LCD_AREA_COST_NS
+#define BSP_LCD_AREA_COST_NS ((3 * BSP_LCD_CMD_TRANS_US + BSP_LCD_COLOR_TRANS_US) * 1000)
+#endif
+#define BSP_LCD_RENDER_PX_NS (50)
+
+// 加入脏区域时就合并，缓冲区满时合并最近的两个区域而不是整屏重绘，0表示使用LVGL原来的处理
+#ifndef BSP_LCD_INV_MERGE
+#define BSP_LCD_INV_MERGE 1
+#endif
+
+// 一帧各对象的绘制耗时之和超过该值时输出最耗时的几个对象(需开启LV_USE_REFR_PROFILER)，0表示不输出
+#ifndef BSP_LCD_SLOW_FRAME_US
+#define BSP_LCD_SLOW_FRAME_US (30 * 1000)
+#endif
+
+// 静态控件位图缓存的总大小上限，0表示不缓存
+#ifndef BSP_LCD_SNAP_CACHE_BYTES
+#define BSP_LCD_SNAP_CACHE_BYTES (96 * 1024)
+#endif
 
 void bsp_lvgl_start(esp_lcd_panel_io_handle_t *io_handle,
                     esp_lcd_panel_handle_t *panel_handle);
 
+/* 分步初始化接口，供启动依赖图并行调度 */
+esp_err_t bsp_lvgl_port_init(void);
+void bsp_display_clear(esp_lcd_panel_io_handle_t *io_handle,
+                       esp_lcd_panel_handle_t *panel_handle);
+lv_disp_t *bsp_display_lvgl_add(esp_lcd_panel_io_handle_t *io_handle,
+                                esp_lcd_panel_handle_t *panel_handle,
+                                bool hold_refresh);
+void bsp_display_release(void);
+esp_err_t bsp_touch_init(void);
+lv_indev_t *bsp_touch_lvgl_add(void);
+touch_filter_t *bsp_touch_filter(void);
+
 
 #endif // !LVGL_COMPONENTS_H
\ No newline at end of file
@@ -16,12 +16,14 @@
 #include "esp_err.h"
 
 #include "main_update.h"
+#include "boot_trace.h"
 
 static const char *TAG = "main";
 
 
 
 void app_main(void) {
+   boot_trace_instant("app_main");
    ESP_LOGI(TAG, "Starting main application...");
 
     // 创建硬件初始化任务
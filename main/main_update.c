@@ -9,6 +9,12 @@
 #include "lcd.h"
 #include "lvgl-components.h"
 #include "esp_err.h"
+#include "init_graph.h"
+#include "boot_trace.h"
+#include "telemetry.h"
+#include "perf_monitor.h"
+#include "perf_overlay.h"
+#include "num_label.h"
 
 
 static const char *TAG = "Main Update";
@@ -36,7 +42,7 @@ logic_to_ui_msg_t send_msg; // 发送到UI层的数据
  */
 static void update_servo_initialization_ui(int init_angle, int servo_pin) {
     // 更新默认角度到UI
-    lv_label_set_text_fmt(ui_angleValue, "%d °", init_angle);
+    num_label_set_value(ui_angleValue, init_angle);
     lv_slider_set_value(ui_angleSlider, init_angle, LV_ANIM_ON);
     // 更新舵机引脚到UI
     lv_label_set_text_fmt(ui_ServoPin, "%d", servo_pin);
@@ -49,7 +55,7 @@ static void update_servo_initialization_ui(int init_angle, int servo_pin) {
  */
 static void update_servo_angle_ui(int angle) {
     // 更新UI显示当前舵机角度
-    lv_label_set_text_fmt(ui_angleValue, "%d °", angle);
+    num_label_set_value(ui_angleValue, angle);
     ESP_LOGI(TAG, "Servo angle updated in UI: %d °", angle);
 }
 
@@ -59,9 +65,20 @@ static void update_servo_angle_ui(int angle) {
  * @return true 设置成功, false 设置失败
  */
 static bool handle_servo_angle_request(int angle) {
+    int64_t input_us = perf_monitor_input_stamp();  ///< 触发该请求的触摸采样时间(perf_monitor的输入钩子记录)
     bool ret = servo_tool_set_angle(angle);
     
     if (ret) {
+        perf_monitor_latency_record(input_us);  // 触摸采样到PWM占空比更新的延迟
+
+        // 触摸坐标按输入延迟的中位数外推
+        touch_filter_t *filter = bsp_touch_filter();
+        if (filter != NULL) {
+            perf_latency_t lat;
+            perf_monitor_get_latency(&lat);
+            touch_filter_set_lead_us(filter, lat.p50);
+        }
+
         ESP_LOGI(TAG, "Servo angle set successfully: %d °", angle);
 
         // 发送成功消息到UI
@@ -76,16 +93,242 @@ static bool handle_servo_angle_request(int angle) {
     return ret;
 }
 
-void hardware_init_task(void *pvParameters) {
-     // 硬件初始化
-    bsp_i2c_init();                                    ///< 初始化I2C接口
+/**
+ * @defgroup INIT_STAGES 启动阶段定义
+ * @brief 硬件初始化拆分为带依赖关系的阶段，由init_graph在双核上并行执行
+ * @{
+ */
+static servo_init_result_t servo_res;                 ///< 舵机初始化结果
+
+static esp_err_t stage_i2c(void *arg) {
+    return bsp_i2c_init();                             ///< 初始化I2C接口
+}
+
+static esp_err_t stage_pca9557(void *arg) {
     pca9557_init();                                    ///< 初始化PCA9557 IO扩展芯片
-    servo_init_result_t servo_res = servo_tool_init();                                  
-    bsp_lvgl_start(&io_handle, &panel_handle);         ///< 启动LVGL显示系统
+    return ESP_OK;
+}
 
-    ui_init();
+static esp_err_t stage_servo(void *arg) {
+    servo_res = servo_tool_init();
+    return servo_res.init_state ? ESP_OK : ESP_FAIL;
+}
+
+static esp_err_t stage_lvgl_port(void *arg) {
+    return bsp_lvgl_port_init();
+}
+
+static esp_err_t stage_panel(void *arg) {
+    return bsp_display_new(&panel_handle, &io_handle);
+}
 
+static esp_err_t stage_clear(void *arg) {
+#if BOOT_TRACE_FILL_COMPARE
+    // 逐行填充和DMA流水线填充各做一次，时间线上分别记为fill_rows和fill_dma
+    int64_t rows_start = boot_trace_begin();
+    lcd_set_color(0x0000, &panel_handle);
+    int64_t dma_start = boot_trace_begin();
+    lcd_fill_color(0x0000, &panel_handle, &io_handle);
+    int64_t dma_end = boot_trace_begin();
+    boot_trace_span("fill_rows", rows_start, dma_start, xPortGetCoreID(), -1);
+    boot_trace_span("fill_dma", dma_start, dma_end, xPortGetCoreID(), -1);
+    ESP_LOGI(TAG, "Black fill: rows %lld us, dma %lld us",
+             (long long)(dma_start - rows_start), (long long)(dma_end - dma_start));
+#endif
+    bsp_display_clear(&io_handle, &panel_handle);
+    return ESP_OK;
+}
+
+static esp_err_t stage_disp(void *arg) {
+    // 清屏完成前LVGL不渲染也不写屏，由stage_show恢复
+    lv_disp_t *disp = bsp_display_lvgl_add(&io_handle, &panel_handle, true);
+    if (disp == NULL) {
+        return ESP_FAIL;
+    }
+    // 持续统计每帧渲染/刷屏耗时；启动后前几帧同时记录到时间线，记录完自动导出
+    lvgl_port_lock(0);
+    perf_monitor_set_flush_ready_cb(disp_buf_trans_done);   ///< 环形缓冲区由disp_buf决定何时通知LVGL
+    render_par_attach(disp);                                ///< 大块混合拆给另一个核心
+    if (render_prof_attach(disp) == ESP_OK) {               ///< 逐对象统计绘制耗时(LV_USE_REFR_PROFILER)
+        render_prof_set_slow_frame_us(BSP_LCD_SLOW_FRAME_US);
+    }
+    if (BSP_LCD_SNAP_CACHE_BYTES > 0) {
+        snap_cache_attach(disp, BSP_LCD_SNAP_CACHE_BYTES);  ///< 静态控件绘制一次后贴图
+    }
+    if (perf_monitor_attach(disp, io_handle) == ESP_OK) {
+        boot_trace_capture_frames(BOOT_TRACE_FRAMES);
+    }
+    lvgl_port_unlock();
+    return ESP_OK;
+}
+
+static esp_err_t stage_touch(void *arg) {
+    return bsp_touch_init();
+}
+
+static esp_err_t stage_indev(void *arg) {
+    lv_indev_t *indev = bsp_touch_lvgl_add();
+    if (indev == NULL) {
+        return ESP_FAIL;
+    }
+    lvgl_port_lock(0);
+    perf_monitor_set_input_stamp_cb(touch_sampler_last_press_us);
+    perf_monitor_attach_indev(indev);                  ///< 记录触摸采样时间，用于统计输入延迟
+    lvgl_port_unlock();
+    return ESP_OK;
+}
+
+static esp_err_t stage_ipc(void *arg) {
     task_command_init(); // 初始化任务间通信模块
+    return ESP_OK;
+}
+
+/**
+ * @brief 给界面对象起名字，渲染分析按名字合计同类控件
+ */
+static void ui_prof_names(void) {
+#if LV_USE_REFR_PROFILER
+    static const struct {
+        lv_obj_t **obj;
+        const char *name;
+    } names[] = {
+        { &ui_Screen1, "screen" },
+        { &ui_Panel1, "title bar" },     { &ui_labe1, "title" },
+        { &ui_Panel3, "status bar" },    { &ui_labe3, "target label" },   { &ui_angleValue, "angle value" },
+        { &ui_Panel2, "pin badge" },     { &ui_ServoPin, "pin" },
+        { &ui_Panel4, "voltage badge" }, { &ui_Label15, "voltage" },
+        { &ui_Label7, "separator" },     { &ui_Label2, "separator" },
+        { &ui_Button1, "preset button" }, { &ui_Button3, "preset button" },
+        { &ui_Button4, "preset button" }, { &ui_Button5, "preset button" },
+        { &ui_Label10, "preset label" },  { &ui_Label11, "preset label" },
+        { &ui_Label12, "preset label" },  { &ui_Label13, "preset label" },
+        { &ui_Label8, "scale label" },   { &ui_Label9, "scale label" },   { &ui_Label14, "scale label" },
+        { &ui_angleSlider, "slider" },
+    };
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        render_prof_set_name(*names[i].obj, names[i].name);
+    }
+#endif
+}
+
+/**
+ * @brief 缓存基本不变的控件：标题栏、刻度标签和预设按钮
+ * @note 底部状态栏的角度标签拖动时每帧都变，不缓存
+ */
+static void ui_snap_cache(void) {
+    lv_obj_t *objs[] = {
+        ui_Panel1, ui_Label8, ui_Label9, ui_Label14, ui_Button1, ui_Button3, ui_Button4, ui_Button5,
+    };
+    for (size_t i = 0; i < sizeof(objs) / sizeof(objs[0]); i++) {
+        snap_cache_set_obj(objs[i], true);
+    }
+}
+
+/**
+ * @brief 去掉SquareLine给角度标签生成的文字绑定
+ * @note 生成的ui_event_*在调用用户事件前先用_ui_checked_set_text_value/_ui_slider_set_text_value改写角度标签，
+ *       每次都经过lv_label_set_text和LVGL堆，并把定宽数字标签的文字改掉。ui.c保持生成的原样，
+ *       这里把这些回调换成按事件类型直接调用用户事件，角度标签只由用户事件和逻辑层消息更新
+ */
+static void ui_unbind_angle_text(void) {
+    static const struct {
+        lv_obj_t **obj;
+        lv_event_cb_t generated;
+        lv_event_cb_t handler;
+        lv_event_code_t code;
+    } binds[] = {
+        { &ui_Button1, ui_event_Button1, zeroDegreeClick, LV_EVENT_CLICKED },
+        { &ui_Button3, ui_event_Button3, fortyFiveDegreesClick, LV_EVENT_CLICKED },
+        { &ui_Button4, ui_event_Button4, ninetyDegreesClick, LV_EVENT_CLICKED },
+        { &ui_Button5, ui_event_Button5, oneHundredAndEightyDegreesClick, LV_EVENT_CLICKED },
+        { &ui_angleSlider, ui_event_angleSlider, SliderChange, LV_EVENT_VALUE_CHANGED },
+    };
+    for (size_t i = 0; i < sizeof(binds) / sizeof(binds[0]); i++) {
+        if (lv_obj_remove_event_cb(*binds[i].obj, binds[i].generated)) {
+            lv_obj_add_event_cb(*binds[i].obj, binds[i].handler, binds[i].code, NULL);
+        } else {
+            ESP_LOGW(TAG, "generated event %u not found, UI regenerated?", (unsigned)i);
+        }
+    }
+}
+
+static esp_err_t stage_ui(void *arg) {
+    lvgl_port_lock(0);
+    ui_init();
+    ui_prof_names();
+    ui_snap_cache();
+    ui_unbind_angle_text();
+    num_label_attach(ui_angleValue, 0, SERVO_MAX_DEGREE, " °");   ///< 角度标签定宽显示，拖动滑块时只重绘变化的数字
+    perf_overlay_create();                             ///< 性能浮层，长按标题栏切换显示
+    perf_overlay_bind_toggle(ui_Panel1);
+    disp_buf_bench_bind(ui_Panel3);                    ///< 长按底部状态栏运行绘图缓冲区基准
+    lvgl_port_unlock();
+    return ESP_OK;
+}
+
+static esp_err_t stage_show(void *arg) {
+    bsp_display_release();                             ///< 恢复LVGL刷新并打开背光
+    return ESP_OK;
+}
+
+enum {
+    STAGE_I2C,
+    STAGE_PCA9557,
+    STAGE_SERVO,
+    STAGE_LVGL_PORT,
+    STAGE_PANEL,
+    STAGE_CLEAR,
+    STAGE_DISP,
+    STAGE_TOUCH,
+    STAGE_INDEV,
+    STAGE_IPC,
+    STAGE_UI,
+    STAGE_SHOW,
+    STAGE_COUNT,
+};
+
+// est_us为预估耗时，仅用于init_graph_simulate(主机仿真检查依赖图)
+static init_stage_t init_stages[STAGE_COUNT] = {
+    [STAGE_I2C]       = { "i2c",       stage_i2c,       NULL, 0,                                              INIT_GRAPH_ANY_CORE, 500 },
+    [STAGE_PCA9557]   = { "pca9557",   stage_pca9557,   NULL, INIT_DEP(STAGE_I2C),                            INIT_GRAPH_ANY_CORE, 1000 },
+    [STAGE_SERVO]     = { "servo_pwm", stage_servo,     NULL, 0,                                              INIT_GRAPH_ANY_CORE, 1000 },
+    [STAGE_LVGL_PORT] = { "lvgl_port", stage_lvgl_port, NULL, 0,                                              INIT_GRAPH_ANY_CORE, 5000 },
+    [STAGE_PANEL]     = { "panel",     stage_panel,     NULL, INIT_DEP(STAGE_PCA9557),                        INIT_GRAPH_ANY_CORE, 130000 },
+    [STAGE_CLEAR]     = { "black_fill", stage_clear,    NULL, INIT_DEP(STAGE_PANEL),                          INIT_GRAPH_ANY_CORE, 17000 },
+    [STAGE_DISP]      = { "lvgl_disp", stage_disp,      NULL, INIT_DEP(STAGE_PANEL) | INIT_DEP(STAGE_LVGL_PORT), INIT_GRAPH_ANY_CORE, 2000 },
+    [STAGE_TOUCH]     = { "touch",     stage_touch,     NULL, INIT_DEP(STAGE_I2C),                            INIT_GRAPH_ANY_CORE, 5000 },
+    [STAGE_INDEV]     = { "lvgl_indev", stage_indev,    NULL, INIT_DEP(STAGE_TOUCH) | INIT_DEP(STAGE_DISP),   INIT_GRAPH_ANY_CORE, 100 },
+    [STAGE_IPC]       = { "ipc",       stage_ipc,       NULL, 0,                                              INIT_GRAPH_ANY_CORE, 100 },
+    [STAGE_UI]        = { "ui_build",  stage_ui,        NULL, INIT_DEP(STAGE_DISP),                           INIT_GRAPH_ANY_CORE, 30000 },
+    [STAGE_SHOW]      = { "show",      stage_show,      NULL, INIT_DEP(STAGE_CLEAR) | INIT_DEP(STAGE_UI) | INIT_DEP(STAGE_INDEV), INIT_GRAPH_ANY_CORE, 1000 },
+};
+/** @} */
+
+const init_stage_t *hardware_init_stages(size_t *count) {
+    *count = STAGE_COUNT;
+    return init_stages;
+}
+
+/**
+ * @brief 把每个启动阶段记录到启动时间线(按实际执行的核心分轨道)
+ */
+static void trace_init_stage(const init_stage_t *stage, int64_t t0_us) {
+    boot_trace_span(stage->name, t0_us + stage->start_us, t0_us + stage->end_us,
+                    stage->ran_on_core, -1);
+}
+
+void hardware_init_task(void *pvParameters) {
+    int64_t trace_start = boot_trace_begin();
+    init_graph_cfg_t graph_cfg = INIT_GRAPH_DEFAULT_CONFIG();
+    graph_cfg.on_stage_done = trace_init_stage;
+
+     // 硬件初始化(按依赖图并行执行)
+    esp_err_t ret = init_graph_run(init_stages, STAGE_COUNT, &graph_cfg);
+    init_graph_log_report(init_stages, STAGE_COUNT);
+    init_graph_check_order(init_stages, STAGE_COUNT);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Hardware init incomplete: %s", esp_err_to_name(ret));
+    }
 
             // 创建GUI任务（高优先级，保证界面响应性）
     xTaskCreate(
@@ -109,6 +352,12 @@ void hardware_init_task(void *pvParameters) {
 
     ESP_LOGI(TAG,"所有任务创建完毕");
 
+    // 启动运行时遥测(任务CPU占比、栈高水位、堆和LVGL内存)
+    if (telemetry_start(NULL) != ESP_OK) {
+        ESP_LOGW(TAG, "Telemetry not started");
+    }
+    boot_trace_end("hardware_init", trace_start);
+
     // 舵机初始化成功，更新初始化数据到UI
     if (servo_res.init_state) {
         send_msg.type = SERVO_INITIALIZED;
@@ -122,7 +371,7 @@ void hardware_init_task(void *pvParameters) {
 
 /**
  * @brief GUI任务，用于处理UI事件和更新
- * @note 在logic_task中发送信号量
+ * @note 阻塞等待主逻辑任务的消息；更新界面时持有LVGL锁，释放锁时唤醒LVGL任务立即重绘
  * @param pvParameter 任务参数
  */
 void gui_task(void *pvParameter) {
@@ -130,7 +379,8 @@ void gui_task(void *pvParameter) {
     logic_to_ui_msg_t rec_msg;
     
     while (1) {
-        if (xQueueReceive(logic_to_ui_queue, &rec_msg, pdMS_TO_TICKS(10)) == pdTRUE) {
+        if (xQueueReceive(logic_to_ui_queue, &rec_msg, portMAX_DELAY) == pdTRUE) {
+            lvgl_port_lock(0);
             switch (rec_msg.type) {
                 case SERVO_INITIALIZED:
                     update_servo_initialization_ui(rec_msg.init_angle, rec_msg.servo_pin);
@@ -145,6 +395,7 @@ void gui_task(void *pvParameter) {
                     ESP_LOGW(TAG, "Unknown message type: %d", rec_msg.type);
                     break;
             }
+            lvgl_port_unlock();
         }
     }
 }
@@ -154,7 +405,7 @@ void main_logic_task(void *pvParameter) {
     ui_to_logic_msg_t rec_msg; // 接收来自UI任务的消息
 
     while (1) {
-        if (xQueueReceive(ui_to_logic_queue, &rec_msg, pdMS_TO_TICKS(10)) == pdTRUE) {
+        if (xQueueReceive(ui_to_logic_queue, &rec_msg, portMAX_DELAY) == pdTRUE) {
             switch (rec_msg.type) {
                 case UI_MSG_SERVO_SET_ANGLE:
                     // 处理来自UI的舵机角度设置消息
@@ -1,8 +1,10 @@
 #ifndef MAIN_UPDATE_H
 #define MAIN_UPDATE_H
 
+#include <stddef.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "init_graph.h"
 
 void gui_task(void *pvParameter);
 
@@ -10,4 +12,12 @@ void main_logic_task(void *pvParameter);
 
 void hardware_init_task(void *pvParameters);
 
+/**
+ * @brief 获取硬件初始化的阶段表
+ * @note hardware_init_task运行后各阶段带有实际执行的核心和时间；用于离线模拟调度和检查依赖顺序
+ * @param count 输出阶段数量
+ * @return const init_stage_t* 阶段数组
+ */
+const init_stage_t *hardware_init_stages(size_t *count);
+
 #endif // MAIN_UPDATE_H
\ No newline at end of file
@@ -0,0 +1,6022 @@
+// 由tools/img_asset_pack.py从main/yingwu.h生成，不要手动修改
+// 320x240 RGB565：153600 -> 96162 字节(62.6%)
+#include "img_asset.h"
+
+static const uint8_t yingwu_data[96162] = {
+    0x49, 0x35, 0x36, 0x35, 0x40, 0x01, 0xF0, 0x00, 0xFF, 0x83, 0xCF, 0xC0, 0x6E, 0xC1, 0x55, 0x55,
+    0x66, 0x5A, 0x65, 0xC2, 0x66, 0x02, 0x7A, 0x6D, 0x7E, 0xC2, 0x6F, 0x6B, 0x66, 0xC0, 0x1E, 0xC1,
+    0x7B, 0x34, 0x7E, 0x6E, 0x6B, 0xC1, 0x6E, 0xC0, 0x08, 0x01, 0x55, 0x66, 0xC0, 0x1E, 0x19, 0xC2,
+    0x1E, 0x2D, 0xC0, 0x08, 0xA2, 0x87, 0x6F, 0xC5, 0x55, 0x51, 0x51, 0x25, 0xC3, 0x16, 0x65, 0xC1,
+    0x02, 0xC3, 0x0E, 0xC1, 0x66, 0xA4, 0x88, 0xA6, 0x88, 0x6E, 0x2D, 0x7F, 0xA2, 0x77, 0x7B, 0x6E,
+    0x6B, 0x7E, 0x6E, 0x6B, 0x7E, 0xC0, 0x29, 0x24, 0x10, 0x66, 0x59, 0x3C, 0x51, 0x21, 0x56, 0x0D,
+    0x3E, 0x2A, 0x16, 0x11, 0xC6, 0x7A, 0x6E, 0xC0, 0x6B, 0x7E, 0xC2, 0x7F, 0xC0, 0x6E, 0xC0, 0x6E,
+    0x7A, 0x6B, 0x6E, 0x0B, 0xC0, 0x10, 0x01, 0xC0, 0x6E, 0x0D, 0xC1, 0x08, 0x01, 0x0D, 0xC0, 0x08,
+    0xC0, 0x21, 0xA3, 0x89, 0x7F, 0xC0, 0x15, 0xC0, 0x7A, 0x24, 0xC1, 0x15, 0x9D, 0x99, 0x9D, 0x88,
+    0x66, 0xC0, 0x55, 0xC1, 0x65, 0x31, 0xC1, 0x39, 0x3E, 0xC0, 0x6E, 0xC0, 0x7E, 0x12, 0x7E, 0x6E,
+    0xC0, 0x7E, 0x6E, 0x6B, 0xC4, 0x6E, 0x7A, 0xC1, 0x6F, 0xC0, 0x7F, 0x7F, 0x6E, 0x25, 0x2A, 0x6F,
+    0x6B, 0x65, 0xC0, 0x66, 0x29, 0x65, 0x24, 0x2C, 0x6F, 0x6F, 0xC1, 0x66, 0x38, 0xC0, 0x30, 0x66,
+    0x30, 0x38, 0x66, 0x30, 0xC0, 0x2B, 0x1C, 0x51, 0x3C, 0x66, 0x5A, 0x2D, 0xC1, 0x66, 0x2D, 0x01,
+    0x15, 0x1C, 0xC0, 0x7A, 0x24, 0x1F, 0x24, 0x1F, 0xC2, 0x65, 0x59, 0x51, 0x9D, 0x99, 0x0D, 0x7E,
+    0x7F, 0x6E, 0xC0, 0x24, 0xC0, 0x29, 0x5A, 0x21, 0xC5, 0x5A, 0x21, 0xC0, 0x19, 0x0D, 0x5A, 0x03,
+    0x3E, 0x03, 0x3E, 0xC1, 0x39, 0x5A, 0x65, 0xC3, 0x69, 0xC0, 0x2A, 0xC0, 0x6E, 0x2A, 0xC0, 0x0D,
+    0x29, 0xC0, 0x21, 0xC0, 0x1A, 0x7A, 0x24, 0x7F, 0x6E, 0x7E, 0x66, 0x55, 0x51, 0x66, 0x55, 0x51,
+    0x9D, 0x89, 0x50, 0x6F, 0x55, 0xC0, 0x67, 0xC1, 0x6E, 0xC1, 0x02, 0xC0, 0x3D, 0xA6, 0x98, 0xC0,
+    0x66, 0x5A, 0xC0, 0x55, 0x65, 0x5A, 0xC1, 0x0E, 0x66, 0x02, 0xC0, 0x05, 0x6E, 0xC0, 0x79, 0x6F,
+    0xC1, 0x6F, 0x25, 0xC2, 0x1E, 0x25, 0x7E, 0x6F, 0x3C, 0x6E, 0x6B, 0x0D, 0x08, 0xC0, 0x01, 0x3C,
+    0x39, 0x2D, 0xC1, 0x1E, 0x19, 0xC2, 0x1E, 0x2D, 0xC0, 0x34, 0x01, 0x0D, 0x6E, 0x6F, 0x21, 0x12,
+    0xC1, 0x0D, 0x3E, 0x2F, 0x25, 0xC3, 0x16, 0x0A, 0xC2, 0x02, 0xC0, 0x0A, 0xC0, 0x11, 0x0E, 0xC0,
+    0x11, 0x3E, 0x32, 0x66, 0xC1, 0xA2, 0x88, 0xA2, 0x88, 0x7F, 0x6E, 0x7F, 0x6E, 0x6B, 0xC1, 0x38,
+    0x56, 0x24, 0x1F, 0x10, 0x01, 0x35, 0x2D, 0x21, 0x0D, 0x3E, 0x25, 0x16, 0xC0, 0x11, 0xC1, 0x19,
+    0x14, 0x11, 0x14, 0x19, 0xC0, 0x20, 0x7E, 0xC1, 0x6E, 0x37, 0x3C, 0xC1, 0x7E, 0x6B, 0x6E, 0xC6,
+    0x6E, 0xC0, 0x0D, 0xC0, 0x65, 0xC0, 0x0D, 0xC1, 0x6F, 0xA3, 0x99, 0xA2, 0x88, 0xC1, 0x6E, 0x10,
+    0x15, 0xC0, 0x6F, 0x24, 0x15, 0x3C, 0x51, 0x51, 0x55, 0xC1, 0x39, 0x5A, 0x66, 0xC0, 0x34, 0xC0,
+    0x39, 0x05, 0x6E, 0xC0, 0x0D, 0x12, 0x1A, 0x6E, 0xC0, 0x6E, 0x7B, 0x6E, 0xC4, 0x6E, 0x7A, 0xC3,
+    0x07, 0x7B, 0x6E, 0xC0, 0x6B, 0x29, 0x7E, 0xC0, 0x29, 0x7A, 0x29, 0x1D, 0x6B, 0x29, 0x7F, 0x6F,
+    0x7E, 0x04, 0x3F, 0x38, 0xC0, 0x30, 0x2B, 0x30, 0x38, 0xC0, 0x30, 0xC0, 0x24, 0x10, 0x3C, 0x56,
+    0x69, 0xC0, 0x28, 0x2D, 0xC2, 0xA2, 0x87, 0x15, 0x6B, 0xC1, 0x24, 0xC5, 0x61, 0x55, 0x3A, 0x9C,
+    0x99, 0xC0, 0x6E, 0x2E, 0x7A, 0x69, 0xC0, 0x66, 0x5A, 0xC1, 0x21, 0x26, 0xC0, 0x21, 0xC0, 0x26,
+    0x21, 0x1E, 0x19, 0x12, 0x0D, 0x03, 0x3E, 0xC5, 0x39, 0x55, 0xC3, 0x23, 0x66, 0xC0, 0x23, 0x2A,
+    0x1E, 0xC0, 0x3E, 0xA4, 0x98, 0x35, 0x66, 0x21, 0x1C, 0x69, 0x7F, 0x30, 0x7E, 0xC1, 0x24, 0x66,
+    0xC1, 0x18, 0x51, 0x9D, 0x88, 0x56, 0x51, 0x56, 0x66, 0xC0, 0x3D, 0xC5, 0xA6, 0x99, 0x69, 0x39,
+    0xC0, 0x66, 0x55, 0xC0, 0x5A, 0xC1, 0x65, 0x09, 0xC1, 0x7D, 0xC2, 0x7A, 0x6E, 0x1E, 0xC0, 0x25,
+    0xC3, 0x7E, 0x6E, 0x39, 0xC0, 0x01, 0xC2, 0x39, 0xC1, 0x32, 0x2D, 0xC1, 0x1E, 0x19, 0xC2, 0x1E,
+    0x2D, 0xC0, 0x39, 0xC0, 0x3E, 0x01, 0x6F, 0x6E, 0x0D, 0xC1, 0x3E, 0x39, 0x2A, 0x25, 0xC3, 0x16,
+    0x0A, 0xC0, 0x6B, 0x0A, 0xC1, 0x11, 0xC0, 0x16, 0x11, 0x09, 0x11, 0xA5, 0x89, 0xA4, 0x88, 0xC1,
+    0x6F, 0x7E, 0xA2, 0x88, 0xA2, 0x88, 0x7F, 0x6E, 0x6B, 0x0C, 0xC0, 0x04, 0x3D, 0x38, 0xC0, 0x66,
+    0x55, 0x15, 0x65, 0x01, 0x35, 0x51, 0x0D, 0x9D, 0x89, 0x19, 0x25, 0x19, 0x11, 0xC0, 0x19, 0xC3,
+    0x20, 0x7E, 0xC2, 0x37, 0x3C, 0xC0, 0x7A, 0x6E, 0x0B, 0x6E, 0xC1, 0x7A, 0xC0, 0x10, 0xC1, 0x6E,
+    0xC0, 0x12, 0x0D, 0xC2, 0x65, 0x0D, 0xC0, 0x2D, 0xA3, 0x99, 0xC5, 0x6F, 0x69, 0x10, 0xC0, 0x55,
+    0x2D, 0x51, 0x14, 0xC0, 0x05, 0x36, 0x31, 0xC0, 0x34, 0xC1, 0x6E, 0x05, 0x6E, 0xC0, 0x0D, 0x12,
+    0x1A, 0x6E, 0xC0, 0x6E, 0x2E, 0x6E, 0xC4, 0x6E, 0x3B, 0xC3, 0x6B, 0xC2, 0x6F, 0x7E, 0x6F, 0x7F,
+    0xC0, 0x29, 0xC0, 0x66, 0xC0, 0x29, 0x7B, 0x6E, 0x0C, 0x56, 0xC1, 0x66, 0x38, 0xC4, 0x56, 0x15,
+    0x9D, 0x99, 0x2D, 0xC4, 0x26, 0x2D, 0x35, 0x3A, 0x0E, 0x1D, 0x24, 0x65, 0xC2, 0x1D, 0x2C, 0xC0,
+    0x1D, 0x65, 0x09, 0x66, 0x9D, 0x99, 0x5A, 0x35, 0x7E, 0x02, 0x79, 0xC0, 0x66, 0x55, 0x55, 0x6B,
+    0x6B, 0x2E, 0x26, 0xC1, 0x21, 0x5A, 0x12, 0x0D, 0xC0, 0x05, 0x69, 0xC6, 0x66, 0x55, 0xC4, 0x23,
+    0xC3, 0x66, 0x32, 0x21, 0x3A, 0x35, 0x26, 0x21, 0x66, 0xC0, 0x21, 0x29, 0x6B, 0x65, 0xC0, 0x65,
+    0xC0, 0x5A, 0xC0, 0x18, 0xC0, 0x9D, 0x89, 0x9D, 0x98, 0x41, 0x52, 0x6E, 0xC6, 0x08, 0xC0, 0x3C,
+    0x39, 0x34, 0x2A, 0xC0, 0x25, 0xC0, 0x5A, 0x66, 0x65, 0x56, 0xC0, 0x7D, 0xC2, 0x7F, 0x1E, 0xC0,
+    0x25, 0xC4, 0x2A, 0x32, 0x39, 0xC4, 0x32, 0x39, 0x32, 0x39, 0x32, 0x66, 0xC0, 0x25, 0x1E, 0xC0,
+    0x19, 0xC0, 0x1E, 0x2D, 0xC0, 0x39, 0xC2, 0x7E, 0x0D, 0xC0, 0x3E, 0xC0, 0x39, 0xC0, 0x2A, 0x25,
+    0xC3, 0x55, 0x0A, 0xC0, 0x11, 0xC0, 0x0A, 0x11, 0x16, 0xC2, 0x56, 0x11, 0x39, 0xA5, 0x89, 0xC0,
+    0x6E, 0x7B, 0xA2, 0x77, 0xA2, 0x99, 0xA2, 0x88, 0xC0, 0x6E, 0xC0, 0x6B, 0x0C, 0x04, 0x3D, 0x38,
+    0xC1, 0x33, 0x59, 0x51, 0x65, 0x56, 0x32, 0x51, 0x3E, 0x2A, 0x25, 0xC0, 0x20, 0x65, 0xC0, 0x19,
+    0xC0, 0x14, 0x19, 0x20, 0x7E, 0xC1, 0x34, 0x37, 0x7E, 0x6B, 0x0B, 0x69, 0x0B, 0x6E, 0x13, 0xC0,
+    0x18, 0x13, 0xC1, 0x5E, 0xC3, 0x12, 0x0D, 0xC0, 0x59, 0x3E, 0x12, 0x01, 0xA2, 0x88, 0x66, 0xC4,
+    0x15, 0xC0, 0x10, 0x15, 0x10, 0x3C, 0x9C, 0x88, 0x55, 0x66, 0x55, 0xC2, 0x34, 0x66, 0x34, 0x39,
+    0x05, 0xC0, 0x6E, 0x0D, 0x12, 0xC0, 0x1A, 0x1F, 0x26, 0x2E, 0xC1, 0x6E, 0xC2, 0x6E, 0x3B, 0xC3,
+    0x02, 0xC1, 0x6F, 0xC2, 0x7F, 0x29, 0xC2, 0x7E, 0x6B, 0xC0, 0x3D, 0x7B, 0x0C, 0x5A, 0x38, 0xC4,
+    0x56, 0x24, 0x15, 0x3C, 0x2D, 0xC4, 0x7A, 0x69, 0x2E, 0x3B, 0xA2, 0x87, 0xA2, 0x88, 0x6B, 0x6B,
+    0x61, 0x56, 0xC0, 0x1D, 0xC1, 0x7E, 0x1D, 0x66, 0xC0, 0x55, 0x35, 0x30, 0x35, 0x7E, 0xA2, 0x87,
+    0x7D, 0x69, 0x66, 0x55, 0x42, 0x1B, 0x6B, 0x2E, 0xC0, 0x26, 0x21, 0x12, 0xC2, 0x0D, 0x05, 0x3E,
+    0xC1, 0x03, 0xC1, 0x3E, 0xC0, 0x39, 0x59, 0x66, 0xC1, 0x2F, 0xC0, 0x2A, 0xC1, 0x69, 0xC1, 0x2A,
+    0xA3, 0x98, 0x35, 0x3A, 0x26, 0xC0, 0x21, 0xC0, 0x66, 0x69, 0x1C, 0x21, 0x61, 0x55, 0x10, 0x15,
+    0xC0, 0x7A, 0x6F, 0xC0, 0x18, 0x51, 0x9C, 0x78, 0x41, 0x66, 0xC5, 0x0D, 0x66, 0xC0, 0x39, 0x34,
+    0x2A, 0xC0, 0x66, 0xC1, 0x5A, 0x66, 0x65, 0xC0, 0x16, 0x69, 0x66, 0x11, 0x19, 0x6E, 0x25, 0xC2,
+    0x2A, 0xC1, 0x7A, 0x6E, 0x39, 0xC9, 0x32, 0x2D, 0xC0, 0x25, 0x1E, 0x19, 0xC0, 0x1E, 0x25, 0x39,
+    0xC3, 0x3E, 0x01, 0x3E, 0xC0, 0x39, 0x2A, 0xC1, 0x25, 0xC3, 0x16, 0x0A, 0xC0, 0x16, 0x11, 0xC0,
+    0x16, 0xC3, 0x1D, 0x11, 0x25, 0xA6, 0x78, 0xA2, 0x88, 0x3C, 0x6E, 0x7F, 0xA2, 0x88, 0x6F, 0x38,
+    0xC0, 0x6E, 0x6B, 0xC1, 0x3D, 0x38, 0xC0, 0x3D, 0x38, 0x55, 0x51, 0x09, 0x01, 0x35, 0x21, 0x0D,
+    0x3E, 0x2A, 0x25, 0xC0, 0x66, 0x65, 0x19, 0xC0, 0x14, 0x19, 0x7B, 0x28, 0xC1, 0x37, 0x6E, 0x7B,
+    0x6E, 0xC2, 0x13, 0xC0, 0x18, 0xC1, 0x13, 0xC0, 0x5E, 0xC3, 0x0D, 0x69, 0x66, 0xC0, 0x3E, 0xA2,
+    0x89, 0x09, 0x10, 0xC5, 0x6E, 0xC0, 0x10, 0xC1, 0x51, 0x9C, 0x88, 0x00, 0xC0, 0x55, 0xC1, 0x34,
+    0xC2, 0x00, 0x05, 0x6E, 0x05, 0x0D, 0xC0, 0x12, 0x21, 0x1A, 0x26, 0x2E, 0xC1, 0x33, 0xC6, 0x3B,
+    0x6B, 0x6E, 0xC0, 0x7B, 0xC0, 0x0E, 0xC2, 0x7F, 0xC0, 0x29, 0x7E, 0x38, 0xC4, 0x3D, 0x38, 0x30,
+    0x24, 0x29, 0xC0, 0x24, 0xC0, 0x10, 0x56, 0x3C, 0x55, 0xC0, 0x7A, 0x2D, 0xC0, 0x35, 0xC0, 0x7E,
+    0xA4, 0x85, 0xA2, 0x87, 0xA2, 0x87, 0xC1, 0x6B, 0x53, 0x51, 0x56, 0x6B, 0x7F, 0xC3, 0x52, 0x51,
+    0x35, 0x30, 0x35, 0x02, 0xA3, 0x86, 0xA2, 0x96, 0x66, 0x69, 0x52, 0x9D, 0x8A, 0x51, 0x67, 0xA1,
+    0x8A, 0x2E, 0xC0, 0x21, 0x12, 0xC1, 0x66, 0x5A, 0x05, 0x3E, 0xC0, 0x0A, 0xC1, 0x03, 0x3E, 0xC1,
+    0x2F, 0x66, 0x2F, 0xC3, 0x2A, 0x65, 0x5A, 0xC2, 0x2A, 0x0D, 0x35, 0xC1, 0x30, 0x21, 0xC1, 0x12,
+    0x01, 0x9D, 0x89, 0x20, 0xA2, 0x87, 0x06, 0x7F, 0x7B, 0x6E, 0x7F, 0xC0, 0x6E, 0x24, 0x9A, 0x88,
+    0x9D, 0x89, 0x55, 0xC4, 0x0D, 0xC0, 0x66, 0x39, 0x36, 0x2A, 0xC0, 0x25, 0x22, 0xC0, 0x25, 0x56,
+    0x65, 0xC0, 0x6E, 0xC1, 0x11, 0x20, 0x25, 0xC2, 0x2A, 0xC2, 0x7E, 0x3E, 0x39, 0xC1, 0x3E, 0x39,
+    0xC5, 0x32, 0x2D, 0xC2, 0x1E, 0x66, 0x1E, 0x2A, 0x32, 0xC1, 0x39, 0xC2, 0x2D, 0xC0, 0x2A, 0xC1,
+    0x25, 0xC4, 0x16, 0x65, 0xC0, 0x11, 0xC1, 0x16, 0xC2, 0x1D, 0xC0, 0x16, 0x1D, 0x05, 0xA5, 0x88,
+    0x7F, 0xC0, 0xA2, 0x88, 0x7F, 0x6E, 0x6B, 0x7E, 0xC0, 0x6E, 0x6B, 0xC0, 0x3D, 0x38, 0xC2, 0x29,
+    0x9D, 0x99, 0x01, 0x35, 0x66, 0x21, 0x0D, 0x08, 0x39, 0x28, 0xC1, 0x23, 0x20, 0xC0, 0x65, 0x19,
+    0x20, 0x28, 0xC1, 0x37, 0xC0, 0x7E, 0x6B, 0x0B, 0xC0, 0x6E, 0x13, 0xC0, 0x1F, 0x69, 0xC0, 0x13,
+    0xC0, 0x18, 0x5A, 0xC2, 0x0D, 0x65, 0x3E, 0x01, 0x3E, 0x21, 0x09, 0x66, 0x6F, 0xC7, 0x55, 0x3C,
+    0x55, 0x9D, 0x99, 0x00, 0x55, 0xC2, 0x34, 0xC1, 0x6B, 0x00, 0xC0, 0x05, 0xC0, 0x0D, 0x12, 0xC0,
+    0x1A, 0xC0, 0x6E, 0x26, 0x2E, 0xC0, 0x6E, 0x3A, 0xC0, 0x33, 0xC3, 0x02, 0xC0, 0x07, 0x0E, 0xC0,
+    0x07, 0x0E, 0xC3, 0x7F, 0x29, 0x2C, 0xC0, 0x29, 0x24, 0xC6, 0x66, 0xC0, 0x59, 0x10, 0x01, 0x3C,
+    0xC0, 0x30, 0xC1, 0x2D, 0x30, 0x35, 0x02, 0xA2, 0x96, 0xA3, 0x87, 0xA3, 0x95, 0xA2, 0x87, 0x5A,
+    0x66, 0x6B, 0x9F, 0x9B, 0x52, 0x52, 0x57, 0x67, 0x69, 0x20, 0x6E, 0x52, 0x04, 0x51, 0xC1, 0xA2,
+    0x87, 0xA3, 0x86, 0xA3, 0x96, 0xA3, 0x87, 0x24, 0x56, 0x9D, 0x9A, 0x9D, 0x8A, 0x9C, 0x89, 0x52,
+    0x1A, 0x26, 0x7E, 0xC0, 0x1A, 0x12, 0x65, 0x3E, 0xC3, 0x6F, 0x0D, 0x0A, 0x3E, 0xC2, 0x66, 0x2F,
+    0xC3, 0x2A, 0x69, 0x1B, 0x66, 0xC3, 0x7F, 0x12, 0x3A, 0x66, 0xC0, 0x26, 0x35, 0xC0, 0x12, 0x25,
+    0x9C, 0x88, 0x66, 0x3D, 0x11, 0x39, 0xA4, 0x98, 0xA2, 0x88, 0xC0, 0x66, 0xC0, 0x59, 0x9D, 0x99,
+    0x9C, 0x88, 0x11, 0x3D, 0xC2, 0x66, 0x12, 0x0D, 0x05, 0x39, 0xC0, 0x2A, 0xC0, 0x25, 0xC0, 0x22,
+    0x25, 0x16, 0x11, 0x5A, 0x11, 0x16, 0xC2, 0x25, 0xC1, 0x2A, 0xC3, 0x7E, 0x39, 0xC2, 0x3E, 0x39,
+    0xC5, 0x32, 0xC1, 0x66, 0xC0, 0x55, 0xC2, 0x23, 0x2D, 0x32, 0xC0, 0x2D, 0xC0, 0x2A, 0x25, 0x2D,
+    0xC0, 0x25, 0x2A, 0xC0, 0x25, 0x2A, 0x25, 0x16, 0xC1, 0x65, 0x11, 0x16, 0xC5, 0x22, 0xC1, 0x66,
+    0x25, 0x0D, 0x35, 0x09, 0x15, 0x7F, 0xC0, 0x6E, 0xC0, 0x6B, 0x7E, 0xC0, 0x6E, 0xC1, 0x38, 0xC1,
+    0x24, 0x51, 0x61, 0x35, 0x52, 0x61, 0x55, 0xC0, 0x39, 0x61, 0x2D, 0x34, 0x2D, 0xC0, 0x28, 0x66,
+    0x69, 0x28, 0xC2, 0x7A, 0x37, 0x7E, 0xC1, 0x7F, 0xC0, 0x13, 0xC0, 0x6E, 0xC5, 0x5A, 0xC0, 0x66,
+    0x06, 0xC0, 0x66, 0x3E, 0x39, 0x21, 0x09, 0xC0, 0x6B, 0xC1, 0x56, 0xC0, 0x6E, 0x65, 0xC1, 0x3C,
+    0xC0, 0x9D, 0x99, 0x50, 0x34, 0x56, 0xC0, 0x6E, 0xC0, 0x34, 0x39, 0x00, 0x7A, 0x05, 0xC1, 0x6E,
+    0x7A, 0xA2, 0x77, 0xC0, 0x12, 0xC0, 0x1A, 0xC0, 0x26, 0x6E, 0x2E, 0xC0, 0x6E, 0xC3, 0x3A, 0x02,
+    0xC0, 0x6E, 0x6B, 0xC5, 0x6F, 0x7E, 0x29, 0xC0, 0x24, 0xC6, 0x56, 0x10, 0xC0, 0x66, 0xC0, 0x01,
+    0x3C, 0xC1, 0x66, 0x3C, 0xC0, 0x37, 0x69, 0xA2, 0x87, 0x0F, 0xA3, 0x96, 0xA2, 0x85, 0xA2, 0x86,
+    0x7E, 0xC1, 0x6E, 0x67, 0x57, 0x9D, 0x9B, 0x1F, 0x9D, 0x9B, 0xC0, 0x5A, 0x66, 0x3C, 0x65, 0xC2,
+    0x02, 0xA4, 0x85, 0xA3, 0x96, 0xA3, 0x86, 0x2A, 0x22, 0x9D, 0x9A, 0x9C, 0x8A, 0x9C, 0x8A, 0x42,
+    0xA0, 0x8A, 0xC0, 0x7E, 0x6B, 0x59, 0x1A, 0x06, 0x3E, 0xC1, 0x05, 0xC0, 0x0A, 0xC1, 0x3E, 0xC2,
+    0x39, 0x59, 0x32, 0xC0, 0x2F, 0x66, 0xC0, 0x1E, 0x1B, 0x16, 0xC2, 0x69, 0x66, 0x1B, 0xA2, 0x89,
+    0x3E, 0xA2, 0x89, 0x21, 0xC0, 0x08, 0x9D, 0x88, 0x9D, 0x98, 0x56, 0xC0, 0x66, 0xC0, 0xA2, 0x88,
+    0x39, 0x29, 0xC0, 0x66, 0xC1, 0x66, 0x9C, 0x88, 0x41, 0x0C, 0x66, 0xC0, 0x3D, 0xC0, 0x19, 0x0D,
+    0x56, 0x39, 0x36, 0x2A, 0xC0, 0x25, 0xC0, 0x5A, 0x25, 0x16, 0x56, 0x65, 0x0A, 0x16, 0xC2, 0x25,
+    0xC0, 0x2A, 0xC5, 0x39, 0xC9, 0x32, 0xC2, 0x2D, 0xC0, 0x1E, 0xC3, 0x2A, 0x2D, 0xC0, 0x2A, 0x25,
+    0xC6, 0x1E, 0xC0, 0x66, 0x16, 0x66, 0xC0, 0x16, 0x19, 0xC0, 0x1E, 0x19, 0xC0, 0x25, 0x1B, 0x16,
+    0x22, 0xC2, 0x66, 0x25, 0x0D, 0x3C, 0xA3, 0x88, 0x7F, 0xC5, 0x6E, 0x7F, 0xC2, 0x66, 0x24, 0x51,
+    0x30, 0x66, 0x55, 0x61, 0x08, 0xC0, 0x39, 0x28, 0x2D, 0xC0, 0x28, 0xC2, 0x2D, 0x7A, 0xC0, 0x28,
+    0xC0, 0x37, 0xC0, 0x6E, 0x3F, 0xC0, 0x0B, 0xC0, 0x7A, 0x13, 0xC0, 0x18, 0xC0, 0x13, 0x18, 0xC0,
+    0x56, 0xC2, 0x69, 0x06, 0x66, 0x3E, 0xC0, 0x0D, 0x04, 0x6E, 0x6B, 0x56, 0x69, 0xC5, 0x66, 0xC0,
+    0x9D, 0x88, 0x00, 0x34, 0xC0, 0x5A, 0x36, 0x00, 0x05, 0x7A, 0xC1, 0x6F, 0xC1, 0x0D, 0xC0, 0x12,
+    0xC1, 0x17, 0x1A, 0x6E, 0x26, 0xC2, 0x6E, 0x3A, 0xC3, 0x6E, 0x7A, 0xC0, 0x6F, 0x6E, 0x0E, 0xC3,
+    0x7F, 0x29, 0xC1, 0x24, 0xC6, 0x15, 0x62, 0x3C, 0xC8, 0x66, 0x35, 0xA3, 0x97, 0xA3, 0x96, 0x23,
+    0xA2, 0x85, 0x6D, 0x7A, 0xC1, 0x6E, 0xC0, 0x57, 0x53, 0x9D, 0x9B, 0x9E, 0x9B, 0x53, 0x41, 0x35,
+    0x66, 0x37, 0xC0, 0x30, 0xC0, 0xA4, 0x85, 0xA5, 0x85, 0xA3, 0x86, 0xA2, 0x97, 0x6D, 0x62, 0x52,
+    0x9C, 0x8A, 0x9B, 0x8B, 0x9D, 0x9A, 0x5B, 0x7F, 0xC1, 0x56, 0xC0, 0x0D, 0x3E, 0x39, 0x3E, 0x05,
+    0xC2, 0x3E, 0xC1, 0x39, 0xC1, 0x2F, 0xC2, 0x66, 0xC0, 0x1E, 0x5A, 0x66, 0xC2, 0x69, 0x66, 0xC0,
+    0x11, 0x16, 0x2D, 0xC0, 0x25, 0x11, 0x0C, 0xC2, 0x55, 0x66, 0xC0, 0x11, 0x0D, 0xA2, 0x98, 0x1C,
+    0xC0, 0x7A, 0xC0, 0x9C, 0x88, 0x9D, 0x89, 0x0C, 0xC3, 0x1C, 0x12, 0x05, 0x39, 0x5A, 0x2A, 0xC0,
+    0x25, 0xC0, 0x5A, 0xC0, 0x51, 0x65, 0xC1, 0x0A, 0x16, 0x11, 0xC0, 0x6F, 0x25, 0xC2, 0x2A, 0xC2,
+    0x2D, 0x39, 0xC8, 0x32, 0x39, 0x32, 0xC0, 0x2D, 0x2A, 0x1E, 0xC5, 0x2A, 0x2D, 0x2A, 0x1E, 0x66,
+    0x1E, 0xC4, 0x19, 0xC0, 0x16, 0xC2, 0x19, 0xC3, 0x6B, 0x25, 0xC0, 0x22, 0xC2, 0x1D, 0x22, 0x31,
+    0xA3, 0x99, 0x01, 0x10, 0xC1, 0x01, 0xC0, 0x10, 0x15, 0x7F, 0xC0, 0x29, 0xC1, 0x24, 0x10, 0x3C,
+    0x30, 0x55, 0x62, 0x69, 0x08, 0xC0, 0x37, 0x55, 0xC4, 0x37, 0xC2, 0x69, 0x66, 0x37, 0xC0, 0x6E,
+    0x7A, 0xC0, 0x6F, 0xC2, 0x7E, 0xC2, 0x10, 0xC0, 0x69, 0xC2, 0x06, 0x66, 0xC0, 0x3E, 0xC0, 0x01,
+    0xA4, 0x78, 0xA3, 0x99, 0x04, 0x5B, 0x69, 0xC5, 0x66, 0x55, 0x14, 0x00, 0x3B, 0xC0, 0x39, 0x00,
+    0x05, 0x7A, 0x0D, 0x14, 0x17, 0x1C, 0xC0, 0x5A, 0xC0, 0x12, 0xC1, 0x6E, 0xC0, 0x1A, 0x6E, 0x26,
+    0xC2, 0x35, 0xC0, 0x3A, 0xC3, 0x09, 0xC0, 0x6E, 0xC4, 0x15, 0x29, 0x7E, 0xC0, 0x33, 0x29, 0x24,
+    0xC4, 0x66, 0x5A, 0x65, 0x3C, 0xC9, 0x7D, 0xA3, 0x97, 0xA4, 0x75, 0xA2, 0x85, 0xA2, 0x85, 0x69,
+    0x7A, 0x19, 0xC0, 0x7F, 0xC1, 0x52, 0x9E, 0x8B, 0x18, 0x9D, 0x8A, 0x9D, 0x9A, 0x56, 0x35, 0x67,
+    0xC0, 0x69, 0x35, 0xA5, 0x85, 0xA4, 0x84, 0x27, 0x34, 0x7E, 0x34, 0x27, 0x9C, 0x9A, 0x9C, 0x7A,
+    0x9B, 0x9B, 0x53, 0xA2, 0x87, 0xC1, 0x56, 0x1A, 0x52, 0x3E, 0x39, 0xC2, 0x3E, 0xC1, 0x39, 0xC0,
+    0x3E, 0x39, 0xC0, 0x36, 0x2F, 0x2A, 0xC1, 0x25, 0x1E, 0xC1, 0x5A, 0xC0, 0x1E, 0x16, 0xC0, 0xA2,
+    0x98, 0xA4, 0x88, 0x29, 0x30, 0x7E, 0x30, 0x0D, 0x9D, 0x99, 0x9D, 0x98, 0x41, 0xC2, 0x52, 0x7E,
+    0xA4, 0x88, 0x08, 0x7E, 0xC0, 0x0B, 0x56, 0x9D, 0x98, 0x51, 0x0C, 0x65, 0x07, 0x3D, 0x07, 0xAA,
+    0x77, 0x56, 0x05, 0x39, 0x56, 0x2A, 0xC0, 0x25, 0xC0, 0x5A, 0x16, 0x55, 0x02, 0xC1, 0x07, 0x0A,
+    0xC0, 0x11, 0x16, 0x25, 0xC5, 0x2A, 0xC1, 0x39, 0xC9, 0x32, 0xC0, 0x2D, 0x2A, 0x1E, 0xC9, 0x25,
+    0x2D, 0xC3, 0x1E, 0x66, 0xC5, 0x1E, 0x25, 0xC4, 0x22, 0xC2, 0x1D, 0x22, 0xC0, 0x31, 0xA4, 0x88,
+    0x7F, 0xC0, 0x6E, 0x28, 0x2D, 0x7F, 0xA2, 0x88, 0x6F, 0x24, 0xC2, 0x55, 0x01, 0x61, 0x28, 0x65,
+    0x66, 0x69, 0x0B, 0xC0, 0x55, 0x23, 0xC0, 0x6E, 0xC0, 0x7F, 0x2B, 0x37, 0xC2, 0x69, 0xC0, 0x37,
+    0xC0, 0x3F, 0xC0, 0x6E, 0x3F, 0x0B, 0xC4, 0x10, 0xC0, 0x04, 0xC2, 0x06, 0x66, 0xC1, 0x3E, 0xC0,
+    0x39, 0x0D, 0x35, 0x09, 0x6B, 0x5A, 0x69, 0x66, 0xC3, 0x55, 0x19, 0x05, 0x66, 0xC1, 0x05, 0xC1,
+    0x08, 0x6F, 0xC0, 0x1C, 0xC0, 0x19, 0x21, 0xC0, 0x5A, 0x65, 0xC1, 0x6E, 0x21, 0x26, 0xC1, 0x6E,
+    0x35, 0xC0, 0x3A, 0xC3, 0x06, 0x09, 0x6E, 0xC4, 0x15, 0x6E, 0x7F, 0x7E, 0x6B, 0xC0, 0x29, 0x24,
+    0xC2, 0x1F, 0xC2, 0x15, 0x62, 0x55, 0xC3, 0x01, 0x0B, 0x01, 0x3C, 0xC0, 0x7D, 0xA3, 0x86, 0xA3,
+    0x96, 0xA2, 0x85, 0xA2, 0x75, 0x7E, 0x6B, 0x19, 0xC0, 0x7F, 0xC1, 0x20, 0x53, 0x16, 0x9C, 0x8A,
+    0x9D, 0x9A, 0x57, 0x2D, 0x7B, 0xC0, 0x69, 0x35, 0xA6, 0x84, 0xA4, 0x84, 0x20, 0xA2, 0x87, 0x7E,
+    0x2D, 0x28, 0x43, 0x9B, 0xAB, 0x9B, 0x8B, 0x9D, 0x9A, 0x6B, 0x6E, 0xC1, 0x5B, 0x12, 0x3E, 0x36,
+    0x66, 0xC1, 0x36, 0xC0, 0x39, 0xC4, 0x36, 0x65, 0xC0, 0x25, 0x69, 0xC0, 0x25, 0xC0, 0x2A, 0x25,
+    0x59, 0x1E, 0x2A, 0xA3, 0x98, 0x3D, 0xA2, 0x89, 0x65, 0xC1, 0x6B, 0x18, 0x30, 0x34, 0x9D, 0x99,
+    0x40, 0xC1, 0x66, 0x56, 0xC0, 0xA5, 0x98, 0x39, 0x7B, 0x69, 0x1B, 0x51, 0x6E, 0xC0, 0x3D, 0xC0,
+    0x07, 0x0C, 0xA9, 0x88, 0x56, 0x55, 0x36, 0x31, 0x2A, 0xC1, 0x22, 0x1D, 0x55, 0x02, 0xC3, 0x6E,
+    0xC1, 0x7B, 0x6E, 0x25, 0xC5, 0x2A, 0xC2, 0x39, 0xC0, 0x2A, 0xC0, 0x39, 0xC3, 0x69, 0xC0, 0x66,
+    0xC0, 0x2A, 0x1E, 0xC4, 0x66, 0xC0, 0x1E, 0x2D, 0x7E, 0x6F, 0x3C, 0x35, 0xC0, 0x32, 0x2D, 0x1E,
+    0x19, 0xC0, 0x1E, 0x7B, 0x2D, 0xC4, 0x25, 0xC1, 0x20, 0x22, 0x25, 0xC2, 0x1D, 0x16, 0x05, 0xA2,
+    0x88, 0xC3, 0x7F, 0xA2, 0x88, 0x10, 0x6E, 0x10, 0x6F, 0x24, 0x15, 0x51, 0x61, 0x51, 0xC0, 0x66,
+    0x69, 0xC0, 0x66, 0x55, 0x51, 0x23, 0x55, 0x23, 0x28, 0xC0, 0x7F, 0xC0, 0x69, 0xC2, 0x37, 0x3C,
+    0x3F, 0xC2, 0x04, 0xC0, 0x0B, 0xC0, 0x04, 0xC2, 0x6E, 0x04, 0xC1, 0x09, 0x06, 0x66, 0xC0, 0x3E,
+    0xC0, 0x39, 0x3E, 0x12, 0xA4, 0x89, 0x15, 0xC0, 0x0D, 0x01, 0xC0, 0x6B, 0x01, 0x66, 0x51, 0x51,
+    0x00, 0xC0, 0x7E, 0x05, 0xC0, 0x7E, 0xC1, 0x14, 0x19, 0xC2, 0x21, 0x26, 0xC0, 0x56, 0x12, 0xC0,
+    0x1E, 0x21, 0x26, 0xC0, 0x6F, 0x7A, 0x3A, 0x6F, 0x7A, 0xC0, 0x6E, 0x09, 0xC1, 0x0E, 0xC4, 0x15,
+    0xC0, 0x7E, 0xA2, 0x78, 0x7F, 0xC0, 0x66, 0x2E, 0x24, 0x66, 0xC1, 0x5A, 0xC0, 0x15, 0x1C, 0xC0,
+    0x65, 0x65, 0x01, 0xC1, 0x35, 0xC0, 0x09, 0xA5, 0x88, 0xA4, 0x88, 0xA2, 0x88, 0x65, 0x9C, 0x87,
+    0x9E, 0x85, 0xA2, 0x85, 0x7D, 0x1A, 0x7A, 0x5D, 0x7A, 0xC0, 0x6E, 0x7A, 0x20, 0x1D, 0x9E, 0x8B,
+    0x9C, 0x8A, 0x9D, 0x8B, 0x29, 0x28, 0xC0, 0x7E, 0xC0, 0xA2, 0x87, 0xA5, 0x84, 0x1A, 0x20, 0x7D,
+    0x6E, 0xC0, 0x6B, 0x27, 0x9C, 0x9B, 0x9B, 0x8B, 0x9C, 0x89, 0x0F, 0x6F, 0x6E, 0x6B, 0x66, 0x12,
+    0x39, 0x2A, 0xC1, 0x25, 0x2A, 0xC2, 0x31, 0xC1, 0x2A, 0xC0, 0x25, 0xC4, 0x2A, 0xC0, 0x25, 0x59,
+    0xC0, 0xA4, 0x88, 0x09, 0x7F, 0xC0, 0x13, 0x69, 0xC0, 0x66, 0xC0, 0x13, 0x30, 0x34, 0x9C, 0x88,
+    0x55, 0xC0, 0x56, 0xC2, 0x3D, 0x6F, 0x0C, 0x9D, 0x99, 0x51, 0xA3, 0x88, 0x3D, 0xC0, 0x0C, 0x11,
+    0x7F, 0x12, 0xC0, 0x0A, 0x51, 0x2A, 0x5A, 0xC0, 0x66, 0x55, 0x66, 0x02, 0x5A, 0x02, 0xC4, 0x0E,
+    0x11, 0xC0, 0x16, 0xC0, 0x25, 0xC0, 0x2A, 0x25, 0x69, 0xC0, 0x16, 0xC0, 0x25, 0xC0, 0x2A, 0xC1,
+    0x39, 0xC2, 0x69, 0xC2, 0x66, 0x2A, 0x1E, 0xC2, 0x6E, 0x1E, 0xC1, 0x2D, 0x7E, 0xC6, 0x2D, 0x65,
+    0xC0, 0x2D, 0xC0, 0x32, 0x39, 0x7E, 0xC0, 0x39, 0x32, 0x2D, 0xC0, 0x25, 0xC6, 0x16, 0x31, 0x19,
+    0xC4, 0x28, 0xA3, 0x88, 0x10, 0xC2, 0x01, 0x65, 0x28, 0x65, 0x56, 0x69, 0xC0, 0x08, 0xC0, 0x65,
+    0x51, 0xC0, 0x20, 0xC0, 0x28, 0xC4, 0x7E, 0x6B, 0x3C, 0xC0, 0x7A, 0xC4, 0x6E, 0xC7, 0x6E, 0xC0,
+    0x04, 0x5A, 0xC0, 0x3E, 0x69, 0x3E, 0xC1, 0x0A, 0xA3, 0x99, 0x35, 0x6F, 0xC1, 0x66, 0x56, 0x19,
+    0x05, 0x00, 0xC0, 0x08, 0xC1, 0x0D, 0x19, 0x14, 0xC2, 0x19, 0xC1, 0x7E, 0x6E, 0x2D, 0x26, 0x56,
+    0x19, 0x21, 0x2D, 0x26, 0x2D, 0x35, 0x01, 0x7E, 0x6E, 0x15, 0x7E, 0xC1, 0x5A, 0x15, 0x1A, 0x15,
+    0x0E, 0x15, 0xC3, 0x1D, 0x2E, 0x7F, 0xC1, 0x66, 0x55, 0x24, 0x66, 0xC0, 0x15, 0xC3, 0x10, 0x65,
+    0x01, 0x3A, 0x0E, 0xA4, 0x88, 0xA6, 0x88, 0xA5, 0x99, 0xA6, 0x88, 0x6F, 0xC1, 0x25, 0x9C, 0x86,
+    0x9F, 0x86, 0x66, 0xC1, 0x69, 0x69, 0x55, 0x65, 0x50, 0x9D, 0x88, 0x9D, 0x99, 0x9E, 0x8B, 0x9D,
+    0x9B, 0x9D, 0x89, 0x67, 0x6B, 0xC0, 0x35, 0x7D, 0xA2, 0x97, 0xA4, 0x74, 0xA4, 0x74, 0xA2, 0x86,
+    0x7A, 0x6E, 0xC1, 0x9E, 0x9B, 0x53, 0x9C, 0x8A, 0x9B, 0x8A, 0x9D, 0x9A, 0x6F, 0x27, 0x7A, 0x56,
+    0x52, 0x51, 0x9D, 0x89, 0xC1, 0x5A, 0x25, 0xC1, 0x22, 0x25, 0x22, 0xC1, 0x66, 0x16, 0xC0, 0x25,
+    0xC0, 0x6E, 0x25, 0xC0, 0x69, 0xC1, 0x2A, 0x3A, 0xA4, 0x98, 0x52, 0xC0, 0x66, 0xC0, 0x69, 0xC0,
+    0x07, 0xC0, 0x18, 0x9B, 0x99, 0x16, 0x02, 0x52, 0xC3, 0x66, 0x35, 0x7F, 0x65, 0x51, 0x66, 0x5A,
+    0x30, 0xA2, 0x87, 0x1D, 0xA2, 0x98, 0x05, 0x3E, 0x56, 0x55, 0x22, 0xC1, 0x55, 0x66, 0x55, 0x66,
+    0xC0, 0x3F, 0xC0, 0x3A, 0x3D, 0x02, 0xC1, 0x6E, 0xC1, 0x0E, 0x11, 0x16, 0xC3, 0x11, 0xC0, 0x16,
+    0xC1, 0x7F, 0x2A, 0xC1, 0x7E, 0x66, 0xC0, 0x32, 0xC1, 0x2D, 0xC1, 0x2A, 0x23, 0xC1, 0x1E, 0xC0,
+    0x7E, 0x32, 0x7A, 0xC3, 0x32, 0x2D, 0xC0, 0x65, 0x1E, 0x21, 0x26, 0x2D, 0x32, 0xC1, 0x01, 0xC1,
+    0x39, 0x32, 0x2D, 0xC0, 0x25, 0xC4, 0x1D, 0xC0, 0x05, 0xA3, 0x98, 0x19, 0x14, 0xC1, 0x19, 0xA2,
+    0x88, 0x10, 0x6E, 0xC0, 0x51, 0x61, 0x56, 0x21, 0x66, 0x19, 0x65, 0x08, 0xC0, 0x69, 0x34, 0x69,
+    0x34, 0x65, 0xC2, 0x34, 0x28, 0xC1, 0x7F, 0x6E, 0xC0, 0x7A, 0x6E, 0xC0, 0x3F, 0xC3, 0x04, 0xC7,
+    0x6E, 0x04, 0x01, 0xC1, 0x32, 0x6E, 0xC0, 0x3E, 0xC0, 0x6F, 0x7E, 0x21, 0x6E, 0x21, 0x6B, 0x19,
+    0x14, 0x08, 0xC0, 0x6B, 0xC0, 0x00, 0x05, 0x14, 0x19, 0x14, 0xC1, 0x0D, 0x14, 0x19, 0x21, 0xC0,
+    0x6F, 0x6E, 0xC0, 0x26, 0x21, 0x2D, 0x7E, 0xC1, 0xA2, 0x78, 0x15, 0xC0, 0x7E, 0xC0, 0x6E, 0x6B,
+    0x22, 0x1D, 0xC1, 0x15, 0xC6, 0x29, 0x7F, 0x6E, 0x38, 0xC0, 0x29, 0x66, 0xC0, 0x66, 0x5A, 0xC0,
+    0x15, 0xC1, 0x62, 0x59, 0x22, 0xA7, 0x98, 0xA9, 0x88, 0xA4, 0x88, 0x6B, 0x31, 0xCC, 0x2A, 0x23,
+    0x50, 0x2F, 0x9D, 0x99, 0x9C, 0x78, 0x9A, 0x88, 0x9A, 0x99, 0x41, 0x35, 0xA4, 0x85, 0xA2, 0x86,
+    0x7D, 0xA2, 0x86, 0xA2, 0x86, 0xA2, 0x76, 0xC0, 0x7D, 0x6B, 0x66, 0xA0, 0x8A, 0x53, 0x0F, 0x9B,
+    0x9B, 0x9D, 0x8A, 0xC1, 0x6B, 0xC0, 0x56, 0x51, 0x9D, 0x99, 0x25, 0x5A, 0x66, 0xC0, 0x22, 0x1D,
+    0xC4, 0x69, 0xC1, 0x6E, 0x25, 0x6E, 0xC0, 0x25, 0xC1, 0x2A, 0x12, 0xA7, 0x98, 0x7B, 0x18, 0x66,
+    0xC2, 0x0C, 0xC0, 0x66, 0xC0, 0x5A, 0x98, 0x78, 0x9D, 0x88, 0x3A, 0x66, 0xC5, 0x7A, 0x56, 0x65,
+    0x51, 0xA2, 0x78, 0x38, 0x25, 0x39, 0x31, 0x2A, 0x51, 0x5A, 0xC0, 0x0E, 0xC0, 0x02, 0x5A, 0x3A,
+    0xC1, 0x3F, 0xC0, 0x3A, 0x3F, 0x02, 0xC7, 0x0E, 0x11, 0x16, 0xC5, 0x25, 0xC2, 0x2A, 0xC0, 0x2D,
+    0xC1, 0x6E, 0xC1, 0x2D, 0xC1, 0x2A, 0x65, 0xC0, 0x6E, 0x7E, 0x7F, 0x69, 0x66, 0x66, 0xC0, 0x6F,
+    0xA2, 0x77, 0x7F, 0x1A, 0xA2, 0x87, 0x7F, 0xA2, 0x88, 0xC0, 0x36, 0xC1, 0x51, 0x06, 0x3A, 0x32,
+    0xC0, 0x2D, 0x32, 0xC0, 0x2D, 0x2A, 0x25, 0xC2, 0x5A, 0x11, 0x25, 0x05, 0x19, 0x7E, 0x19, 0x14,
+    0x19, 0xC0, 0xA3, 0x99, 0x01, 0xC0, 0x51, 0x21, 0x19, 0xC2, 0x7A, 0x0D, 0xC0, 0x61, 0x55, 0xC0,
+    0x66, 0x2D, 0xC1, 0x34, 0x3C, 0x2D, 0xC0, 0x7A, 0x6B, 0x3C, 0xC0, 0x7E, 0xC0, 0x6B, 0x04, 0x66,
+    0xC4, 0x3C, 0xC0, 0x3F, 0xC0, 0x04, 0x3F, 0x04, 0x5A, 0xC3, 0x32, 0x6E, 0xC0, 0x3E, 0x06, 0x12,
+    0xC0, 0x19, 0xC0, 0x6E, 0x7B, 0x6E, 0xC0, 0x28, 0xC1, 0x19, 0x61, 0x05, 0x14, 0x19, 0xC0, 0x14,
+    0xC1, 0x19, 0x21, 0x28, 0x2D, 0xC0, 0x7E, 0x6E, 0x35, 0x5A, 0xC0, 0x35, 0x6F, 0x7E, 0x6F, 0x7F,
+    0x6E, 0xC4, 0x24, 0xC1, 0x59, 0x15, 0xC5, 0x24, 0x29, 0x7F, 0xC1, 0x56, 0x24, 0xC1, 0x66, 0x18,
+    0xC0, 0x15, 0x09, 0xA3, 0x88, 0xAA, 0x88, 0xA8, 0x88, 0xA2, 0x89, 0xC5, 0x69, 0x31, 0xC5, 0x5A,
+    0x31, 0xC7, 0x9B, 0x98, 0x96, 0x88, 0x9B, 0x87, 0x64, 0xA3, 0x96, 0xA2, 0x86, 0x7D, 0xA2, 0x76,
+    0x6D, 0xC0, 0x7A, 0x59, 0x21, 0x6B, 0x53, 0x9D, 0x9A, 0x9C, 0x8A, 0x9D, 0x8B, 0x52, 0xC1, 0x6B,
+    0x66, 0x41, 0x9D, 0x99, 0x55, 0x57, 0xC6, 0x69, 0xC4, 0x6F, 0x25, 0x6E, 0x25, 0xC1, 0x2A, 0xA6,
+    0x88, 0xA6, 0x88, 0x72, 0x18, 0xC0, 0x66, 0xC1, 0x0C, 0xC1, 0x07, 0x5A, 0x9A, 0x88, 0x9A, 0x78,
+    0x65, 0x56, 0xC1, 0x66, 0x35, 0xC0, 0x30, 0x7E, 0xC0, 0x30, 0x51, 0xC0, 0x35, 0x25, 0x39, 0x41,
+    0x16, 0x02, 0x5A, 0x02, 0x3F, 0xC0, 0x66, 0xC1, 0x3F, 0xC2, 0x3A, 0x3F, 0x02, 0xC7, 0x6F, 0x11,
+    0xC0, 0x16, 0xC1, 0x25, 0xC6, 0x2A, 0x2D, 0xC0, 0x6E, 0xC5, 0x2D, 0x2A, 0xC0, 0x2D, 0xA2, 0x87,
+    0xC0, 0x65, 0x33, 0xA5, 0x99, 0xA6, 0x89, 0xA8, 0x88, 0xA5, 0x88, 0xA3, 0x88, 0x6F, 0x7E, 0x6B,
+    0x6E, 0xC0, 0x1E, 0xC1, 0x0F, 0x9D, 0x98, 0x9C, 0x89, 0x9A, 0x88, 0x9B, 0x88, 0x9D, 0x99, 0x9C,
+    0x88, 0x32, 0x65, 0x6B, 0x5A, 0x25, 0xC0, 0x22, 0xC0, 0x1D, 0x11, 0x1D, 0xA2, 0x88, 0x05, 0x0D,
+    0x05, 0x00, 0x05, 0xC1, 0x0D, 0x6F, 0xC0, 0x14, 0x19, 0xC1, 0x0D, 0x08, 0x39, 0x25, 0xC0, 0x2D,
+    0x66, 0x2D, 0x39, 0xC1, 0x7E, 0xC0, 0x3C, 0xC1, 0x01, 0xC0, 0x7A, 0x0B, 0xC0, 0x04, 0x3C, 0x7A,
+    0xC1, 0x3C, 0xC7, 0x01, 0xC3, 0x39, 0x3E, 0x6E, 0x06, 0x6F, 0xC1, 0x7F, 0x6E, 0x6F, 0x7A, 0x6B,
+    0xC2, 0x66, 0x55, 0x19, 0x14, 0x19, 0xC3, 0x21, 0x28, 0xC0, 0x6E, 0xC0, 0x3C, 0x6E, 0x6E, 0x01,
+    0xC0, 0x35, 0x01, 0x7E, 0xA2, 0x88, 0x29, 0xC2, 0x7E, 0xC0, 0x29, 0xC3, 0x24, 0x15, 0xC5, 0x6E,
+    0x29, 0xC0, 0x7F, 0xC0, 0x56, 0x29, 0x24, 0xC2, 0x1D, 0x55, 0xA8, 0x88, 0xAB, 0x99, 0xA3, 0x89,
+    0xC0, 0x69, 0x31, 0xC3, 0x2A, 0x31, 0x2A, 0x66, 0x66, 0x9D, 0x89, 0x9C, 0x88, 0x9D, 0x89, 0xA5,
+    0x88, 0xA3, 0x99, 0xA3, 0x88, 0xC0, 0x66, 0x50, 0x7F, 0x6E, 0x24, 0x7E, 0xC0, 0x31, 0xC0, 0x1D,
+    0x9B, 0x96, 0x98, 0x86, 0x9D, 0x95, 0xA2, 0x86, 0xA3, 0x87, 0x69, 0x6E, 0xC0, 0x65, 0x19, 0x7B,
+    0x5B, 0x9D, 0xAA, 0x9D, 0x8A, 0x9D, 0x8B, 0x9C, 0x8A, 0x65, 0x6B, 0xC0, 0x5B, 0x51, 0x9D, 0x99,
+    0x51, 0x5A, 0x6B, 0xC2, 0x65, 0xC1, 0x5A, 0x11, 0xC1, 0x16, 0xC0, 0x22, 0x7A, 0xC3, 0x6E, 0xA7,
+    0x88, 0xA5, 0xA9, 0x62, 0x5A, 0xC0, 0x13, 0xC3, 0x0C, 0xC0, 0x13, 0x0D, 0x98, 0x88, 0x6E, 0x3D,
+    0x52, 0x6E, 0x30, 0xC1, 0x35, 0x7F, 0x6E, 0x61, 0x55, 0x51, 0x29, 0xA6, 0x88, 0x39, 0x0E, 0x09,
+    0x59, 0xC2, 0x66, 0xC2, 0x3F, 0xC3, 0x02, 0xC3, 0x3D, 0xC1, 0x02, 0x0E, 0x11, 0xC0, 0x16, 0x11,
+    0xC0, 0x16, 0xC4, 0x22, 0x25, 0xC0, 0x2A, 0xC0, 0x2D, 0x6E, 0xC6, 0x2D, 0x59, 0x7E, 0x66, 0xA4,
+    0x88, 0xAC, 0x88, 0xA8, 0x88, 0xA6, 0x88, 0xA2, 0x79, 0xCA, 0x31, 0xC1, 0x2A, 0xC0, 0x65, 0x3B,
+    0x99, 0x99, 0x96, 0x88, 0x97, 0x98, 0x19, 0x23, 0x66, 0xC0, 0x25, 0xC0, 0x22, 0x1D, 0x69, 0xC0,
+    0x22, 0xC0, 0x1D, 0x25, 0xC0, 0x1D, 0x25, 0x6F, 0x39, 0x3E, 0x6F, 0x0D, 0x05, 0x39, 0x31, 0x25,
+    0xC1, 0x34, 0xC0, 0x39, 0x7A, 0x39, 0x7E, 0x0D, 0x66, 0x01, 0xC0, 0x0B, 0xC5, 0x3C, 0x66, 0xC0,
+    0x3C, 0xC4, 0x7A, 0xC0, 0x3C, 0xC1, 0x01, 0xC0, 0x3E, 0xC1, 0x7E, 0x6F, 0xC1, 0x6E, 0x7F, 0x7F,
+    0x6E, 0xC0, 0x6B, 0xC0, 0x66, 0x01, 0xC0, 0x3C, 0xC0, 0x55, 0x28, 0xC1, 0x5A, 0x69, 0x28, 0x2D,
+    0xC1, 0x6E, 0x3C, 0x01, 0x7F, 0x6E, 0x10, 0x01, 0xC0, 0x7E, 0x18, 0xA2, 0x78, 0xC1, 0x6B, 0x7E,
+    0xC3, 0x30, 0xC0, 0x29, 0x66, 0x15, 0x10, 0x15, 0x6F, 0x15, 0x10, 0xC0, 0x15, 0xC0, 0x24, 0x29,
+    0x38, 0x30, 0x29, 0xC1, 0x24, 0x69, 0x69, 0xAA, 0x89, 0xAB, 0x89, 0xC5, 0x2A, 0xC0, 0x69, 0xC1,
+    0x65, 0x3B, 0x9D, 0x99, 0x9D, 0x9A, 0x9B, 0x89, 0xC0, 0xA6, 0x78, 0xA2, 0x88, 0x6E, 0xA3, 0x89,
+    0x7E, 0x19, 0x9C, 0x88, 0x00, 0xC0, 0xA2, 0x88, 0xA7, 0x89, 0xA2, 0x87, 0x7E, 0xC1, 0x23, 0x9A,
+    0x85, 0x9A, 0x96, 0x9D, 0x86, 0x68, 0xA2, 0x77, 0x7A, 0x69, 0xC0, 0x19, 0x27, 0x62, 0x52, 0x36,
+    0x9B, 0x8B, 0x0F, 0x6B, 0xC0, 0x5A, 0x51, 0x9C, 0x89, 0x11, 0x6B, 0x6E, 0xC0, 0x69, 0x11, 0xC4,
+    0x56, 0xC0, 0x11, 0x16, 0x1D, 0x7E, 0xC4, 0x35, 0xA5, 0x98, 0x1B, 0xC0, 0x5A, 0xC1, 0x66, 0xC2,
+    0x69, 0x18, 0x0D, 0x3D, 0xC1, 0x56, 0xC0, 0x66, 0x5A, 0x35, 0xC0, 0x09, 0xC1, 0x04, 0x9D, 0x88,
+    0x66, 0x1D, 0x0D, 0x99, 0x78, 0xC5, 0x66, 0x3F, 0xC0, 0x7E, 0x02, 0xC1, 0x07, 0xC1, 0x02, 0xC2,
+    0x3D, 0x02, 0x7A, 0x11, 0xC4, 0x16, 0xC2, 0x7F, 0xC0, 0x5A, 0x25, 0xC0, 0x6E, 0xC1, 0x7A, 0x6E,
+    0xC6, 0x55, 0x2B, 0xAB, 0x99, 0xAF, 0x89, 0xA5, 0x89, 0xC5, 0x69, 0xC0, 0x69, 0x23, 0x2A, 0xC2,
+    0x23, 0xC0, 0x2A, 0xC0, 0x31, 0xC2, 0x2A, 0x9A, 0x87, 0x94, 0x98, 0x96, 0x78, 0x9B, 0x99, 0x5A,
+    0x25, 0xC0, 0x1E, 0x1B, 0x1D, 0x16, 0x11, 0xC0, 0x16, 0x1D, 0xC2, 0x16, 0xC0, 0x22, 0x7E, 0xC1,
+    0x25, 0xC2, 0x2A, 0x39, 0x08, 0xC1, 0x69, 0x08, 0x7E, 0x08, 0xC0, 0x0D, 0x10, 0xC1, 0x66, 0xC3,
+    0x65, 0x5A, 0xC3, 0x3F, 0xC1, 0x3C, 0xC1, 0x39, 0x3E, 0xC3, 0xA2, 0x88, 0xC2, 0x7F, 0xA2, 0x78,
+    0x7E, 0x6B, 0xC3, 0x66, 0x01, 0xC1, 0x3C, 0x55, 0x28, 0xC0, 0x2D, 0x28, 0xC0, 0x2D, 0xC0, 0x32,
+    0x01, 0x6E, 0x7B, 0x15, 0x24, 0x10, 0x01, 0x10, 0x15, 0xA2, 0x88, 0x6B, 0xC2, 0x38, 0xC1, 0x6E,
+    0x38, 0xC1, 0x29, 0x24, 0x15, 0x10, 0xC0, 0x15, 0x10, 0x01, 0xC3, 0x15, 0x29, 0xC1, 0x24, 0xC0,
+    0x69, 0x15, 0xAD, 0x98, 0x31, 0x69, 0xC2, 0x23, 0x1C, 0x69, 0x68, 0x55, 0x7B, 0x07, 0x64, 0x9C,
+    0x88, 0xA0, 0x9A, 0xA1, 0x8A, 0x27, 0x9D, 0x89, 0x9D, 0x89, 0x5A, 0x9D, 0x88, 0x9D, 0x89, 0xA3,
+    0x89, 0xA5, 0x99, 0xC0, 0x66, 0x51, 0x9D, 0x98, 0xA3, 0x99, 0xA6, 0x88, 0xA4, 0x98, 0xA2, 0x88,
+    0x66, 0x7E, 0x31, 0xC0, 0x69, 0x9C, 0x96, 0x9A, 0x85, 0x9C, 0x85, 0x9F, 0x86, 0x6D, 0x7E, 0xC0,
+    0xA0, 0x8A, 0x67, 0x52, 0x03, 0x9B, 0x8C, 0x0F, 0xC0, 0x6B, 0x0E, 0x55, 0x9D, 0x99, 0x11, 0x66,
+    0x11, 0xCB, 0x6F, 0x7A, 0x25, 0xC3, 0x21, 0xA7, 0x99, 0x61, 0x18, 0xC3, 0x13, 0xC2, 0x59, 0x97,
+    0x99, 0x9B, 0x88, 0x6E, 0x3D, 0x35, 0xC0, 0x66, 0x35, 0x7F, 0xA2, 0x77, 0x1D, 0x6E, 0x1D, 0x66,
+    0x04, 0x9C, 0x88, 0x3D, 0x39, 0x9B, 0x78, 0xC7, 0x0E, 0xC0, 0x66, 0x6D, 0xC3, 0x02, 0x07, 0x11,
+    0x02, 0x3D, 0xC0, 0x02, 0xC1, 0x09, 0x11, 0xC1, 0x6E, 0xC1, 0x22, 0x25, 0xC4, 0x6E, 0xC1, 0x7A,
+    0xC2, 0x6E, 0xC1, 0x1E, 0xA5, 0x87, 0xB1, 0x9A, 0xAB, 0x89, 0xC0, 0x23, 0xC0, 0x69, 0xC0, 0x69,
+    0x69, 0xC0, 0x69, 0x66, 0x07, 0x0E, 0x1C, 0x23, 0x1C, 0x15, 0x9F, 0x96, 0xC0, 0x02, 0x1C, 0x23,
+    0xC2, 0x2A, 0x31, 0xC0, 0x9D, 0x97, 0x96, 0x87, 0x91, 0x89, 0x9A, 0x88, 0x6F, 0x1E, 0x1B, 0xC0,
+    0x16, 0x11, 0xC0, 0x1D, 0x22, 0xC0, 0x1D, 0xC3, 0x22, 0x25, 0x6F, 0xC0, 0x39, 0xC2, 0xA2, 0x88,
+    0xC1, 0x08, 0xC0, 0x0D, 0x7A, 0xC4, 0x7F, 0x65, 0x56, 0xC2, 0x65, 0x5A, 0x65, 0xC1, 0x3C, 0xC0,
+    0x3F, 0x3C, 0x66, 0xC0, 0x39, 0xC2, 0x3E, 0xC0, 0x0D, 0x6E, 0x6B, 0xC0, 0x21, 0x6F, 0xA2, 0x87,
+    0x06, 0xC0, 0x7A, 0xC0, 0x6B, 0x01, 0xC3, 0x66, 0x2D, 0xC4, 0x6E, 0x01, 0xC0, 0x09, 0x6F, 0x6E,
+    0x7B, 0x5A, 0x15, 0x10, 0x15, 0x24, 0x6E, 0x7F, 0xC4, 0x6E, 0xC1, 0x38, 0xC0, 0x29, 0x24, 0x15,
+    0x10, 0xC0, 0x01, 0xC4, 0x10, 0xC1, 0x15, 0x6B, 0xC0, 0x15, 0x61, 0xAC, 0x77, 0xAC, 0x89, 0x2A,
+    0x23, 0x69, 0x69, 0x02, 0x3B, 0x69, 0x69, 0x65, 0x65, 0xC0, 0x69, 0x56, 0xC0, 0x9D, 0x9A, 0x9A,
+    0x7A, 0x9B, 0x6A, 0x9D, 0x8A, 0x9C, 0x79, 0x6E, 0x6F, 0xC0, 0x56, 0xA2, 0x89, 0xA3, 0x98, 0x56,
+    0x7F, 0xA8, 0x98, 0x7F, 0xC0, 0xA3, 0x99, 0x7F, 0x7E, 0xA2, 0x98, 0x7F, 0x9D, 0x99, 0xA2, 0x87,
+    0x31, 0xC0, 0x9C, 0x95, 0x9A, 0x85, 0x9D, 0x85, 0x9E, 0x86, 0x6D, 0x7F, 0xA0, 0x9A, 0x53, 0x9D,
+    0x9A, 0x9C, 0x7A, 0x9C, 0x9A, 0x55, 0x6B, 0xC0, 0x0F, 0x52, 0x9D, 0x89, 0x11, 0x66, 0xC2, 0x11,
+    0xC3, 0x6B, 0x11, 0xC1, 0x18, 0x1D, 0xC0, 0x25, 0xC2, 0xA3, 0x88, 0xA8, 0x99, 0x7F, 0x18, 0xC4,
+    0x66, 0xC1, 0x50, 0x1D, 0x9D, 0x98, 0x6F, 0x51, 0xC2, 0x09, 0x7F, 0x1D, 0xC0, 0x6E, 0x7B, 0x1D,
+    0x18, 0x9B, 0x98, 0xC0, 0xA5, 0x99, 0x9F, 0x67, 0xC6, 0x6E, 0x7B, 0xC3, 0x69, 0x0E, 0xC0, 0x07,
+    0x0E, 0x11, 0x55, 0x3D, 0xC0, 0x02, 0xC0, 0x3D, 0x02, 0x0C, 0x11, 0x6E, 0x7B, 0x25, 0xC1, 0x6E,
+    0xC0, 0x25, 0xC4, 0x2A, 0xC3, 0x7A, 0xC0, 0x55, 0xAA, 0x86, 0xB2, 0x89, 0xA5, 0x8A, 0xA0, 0x85,
+    0xC0, 0x65, 0x69, 0x3B, 0x59, 0x69, 0x7A, 0x6E, 0x65, 0x69, 0x66, 0x21, 0x2D, 0x67, 0x6B, 0x6D,
+    0x1F, 0x9D, 0x87, 0x7A, 0x21, 0x36, 0xA1, 0x8B, 0x1C, 0x15, 0xC0, 0x1C, 0x23, 0x6B, 0xC0, 0x9C,
+    0x86, 0x93, 0x88, 0x92, 0x98, 0x9D, 0x8A, 0x1E, 0x5A, 0x16, 0xC1, 0x1D, 0x25, 0xC0, 0x1D, 0x16,
+    0xC0, 0x22, 0x25, 0xC0, 0x6F, 0x6E, 0x39, 0xC1, 0x3E, 0x0D, 0xC2, 0x6E, 0x7B, 0xC1, 0x69, 0x66,
+    0x15, 0x10, 0x15, 0x7A, 0xC0, 0x10, 0x65, 0xC1, 0x56, 0x30, 0xC5, 0x6B, 0xC0, 0x59, 0xC0, 0x39,
+    0xC2, 0x0D, 0x12, 0x6B, 0xC0, 0x7E, 0x6E, 0x7F, 0xA2, 0x78, 0x7E, 0xC1, 0x6B, 0xC0, 0x66, 0x69,
+    0xC0, 0x01, 0xC1, 0x66, 0xC1, 0x5A, 0x3C, 0x01, 0xC0, 0x09, 0x15, 0x6E, 0x7B, 0x29, 0xC0, 0x24,
+    0xC2, 0x29, 0x7F, 0x6E, 0x38, 0x3D, 0x38, 0xC1, 0x3D, 0xC1, 0x38, 0x56, 0x29, 0x24, 0x10, 0xC0,
+    0x01, 0xC4, 0x10, 0x15, 0x10, 0xC2, 0x15, 0x61, 0xA6, 0x88, 0x23, 0xC1, 0x69, 0x3B, 0x9F, 0x96,
+    0x64, 0x60, 0x54, 0x65, 0x66, 0xC0, 0x65, 0x55, 0x03, 0xA3, 0x89, 0x9D, 0x7B, 0x98, 0x6B, 0x95,
+    0x7A, 0x9F, 0x69, 0xA4, 0x78, 0x7F, 0x6B, 0x66, 0xA2, 0x78, 0x66, 0x56, 0x6E, 0xA3, 0x99, 0xA4,
+    0x89, 0x7F, 0x62, 0x7E, 0xA4, 0x89, 0xA2, 0x87, 0xA1, 0xA9, 0xA5, 0x99, 0xC0, 0x9D, 0x99, 0xA3,
+    0x99, 0xA4, 0x97, 0x6E, 0xC0, 0x9E, 0x95, 0x9A, 0x85, 0x99, 0x85, 0x64, 0xA3, 0x89, 0x67, 0x9D,
+    0x99, 0x9D, 0x8B, 0x9D, 0x9A, 0x51, 0x6E, 0x7E, 0x6E, 0xC0, 0x1C, 0x9B, 0x89, 0x9B, 0x8B, 0x56,
+    0x66, 0x6F, 0xC4, 0x7F, 0xC0, 0x69, 0x0C, 0x11, 0xC0, 0x18, 0x7E, 0x6E, 0xC0, 0x56, 0x20, 0xA6,
+    0x88, 0xA7, 0x98, 0x66, 0x5A, 0xC3, 0x13, 0xC0, 0x18, 0x0D, 0x09, 0x3D, 0x09, 0x51, 0x66, 0x35,
+    0x09, 0x1D, 0xC3, 0x6F, 0x1D, 0x66, 0x61, 0x55, 0x0C, 0x3F, 0xC0, 0x6E, 0xC1, 0x3F, 0xC1, 0x7F,
+    0x6E, 0x0E, 0xC7, 0x11, 0x0E, 0x3D, 0xC0, 0x02, 0x09, 0xC1, 0x11, 0x6E, 0x7B, 0x25, 0xC0, 0x6F,
+    0xC0, 0x6E, 0xC0, 0x65, 0x25, 0x5A, 0x1D, 0x1E, 0xC0, 0x25, 0x1E, 0x25, 0xC0, 0x2A, 0x69, 0x65,
+    0xAA, 0x88, 0xB5, 0x88, 0xA2, 0x88, 0xA0, 0x85, 0x9E, 0x96, 0xC0, 0x65, 0x69, 0x6E, 0x69, 0x65,
+    0x59, 0x65, 0x74, 0x54, 0x65, 0x65, 0x3F, 0xA1, 0x9A, 0xA2, 0x7A, 0xA1, 0x8B, 0x1F, 0x3D, 0x9C,
+    0x85, 0xC0, 0xA2, 0x8A, 0xA1, 0x9C, 0x28, 0x6F, 0x2F, 0x6F, 0xA1, 0x8A, 0x6B, 0x6B, 0x6B, 0x1C,
+    0x9B, 0x88, 0x8F, 0x99, 0x95, 0x89, 0x6B, 0x16, 0xC1, 0x1D, 0x7E, 0xC0, 0x5A, 0x1D, 0x22, 0x25,
+    0x2A, 0x6B, 0x7E, 0xC2, 0x6E, 0x6B, 0x0D, 0x7F, 0x6E, 0xC0, 0xA2, 0x88, 0x7F, 0x6E, 0x7E, 0x09,
+    0x35, 0x21, 0x65, 0xC0, 0x7A, 0x6E, 0x18, 0x55, 0xC1, 0x65, 0xC0, 0x6B, 0xC1, 0x66, 0x5A, 0x65,
+    0xC0, 0x37, 0x2D, 0xC0, 0x39, 0xC2, 0x7F, 0x19, 0xC0, 0x6E, 0x21, 0x6F, 0xA2, 0x87, 0x7F, 0x6F,
+    0xC4, 0x66, 0xC0, 0x09, 0x01, 0xC1, 0x66, 0x01, 0xC2, 0x6E, 0x15, 0x6E, 0x7F, 0x6E, 0x29, 0xC4,
+    0x7F, 0x6F, 0x7E, 0x04, 0xC1, 0x69, 0x38, 0x3D, 0x38, 0x3D, 0x38, 0x56, 0xC0, 0x24, 0x10, 0x01,
+    0xC4, 0x10, 0xC5, 0x06, 0xA1, 0xA9, 0xB2, 0x86, 0xA4, 0x76, 0x3B, 0xC0, 0x34, 0x9E, 0x86, 0x9E,
+    0x96, 0x9E, 0x95, 0x60, 0x64, 0x65, 0x56, 0x7A, 0xC0, 0x55, 0x6B, 0x6B, 0xA2, 0x7B, 0x9C, 0x5B,
+    0x93, 0x6A, 0x4B, 0x56, 0x6F, 0x62, 0x6B, 0xA4, 0x78, 0x5A, 0x66, 0xC0, 0xA2, 0x88, 0x53, 0xA2,
+    0x89, 0xC0, 0xA2, 0x88, 0xA3, 0x99, 0x7E, 0xA2, 0x98, 0xA4, 0x88, 0xA4, 0x99, 0x9B, 0x98, 0x66,
+    0xA6, 0x88, 0xA2, 0x99, 0xA3, 0x98, 0xA4, 0x87, 0xC0, 0x9E, 0x95, 0x97, 0x84, 0x9C, 0x85, 0x7F,
+    0x52, 0x51, 0x53, 0x51, 0x7E, 0x6E, 0x01, 0x7F, 0x56, 0x9B, 0x89, 0x98, 0x9C, 0x9B, 0x8B, 0x56,
+    0x6B, 0xC3, 0x6E, 0xC0, 0x7A, 0xC3, 0x6E, 0x6B, 0x6E, 0xC0, 0x7A, 0x18, 0x25, 0xA6, 0x99, 0xA5,
+    0x98, 0xC0, 0x5A, 0xC4, 0x2B, 0x11, 0x3D, 0x6E, 0x3D, 0x52, 0x69, 0x04, 0x1D, 0xC3, 0x6E, 0x1D,
+    0x25, 0x7A, 0xA2, 0x87, 0x6D, 0x59, 0x9B, 0x7B, 0xC0, 0x6B, 0xC1, 0x04, 0x66, 0x7F, 0xC0, 0x6E,
+    0x0E, 0xC7, 0x11, 0xC0, 0x02, 0xC0, 0x11, 0xC2, 0x1D, 0x20, 0x25, 0xC0, 0x6F, 0x7E, 0xC3, 0x2A,
+    0x25, 0xC1, 0x20, 0x69, 0xC0, 0x20, 0x25, 0x69, 0x17, 0xA7, 0x98, 0xB7, 0x88, 0xA3, 0x89, 0x9E,
+    0x94, 0x9D, 0x96, 0x64, 0x7D, 0x51, 0x69, 0xA2, 0x88, 0xC0, 0x64, 0x50, 0x9D, 0x97, 0x68, 0x65,
+    0x50, 0x69, 0x7E, 0x9F, 0x9B, 0xA3, 0x7A, 0xA3, 0x8A, 0x15, 0x6E, 0x9C, 0x86, 0x64, 0xA3, 0x79,
+    0xA1, 0x8A, 0xA1, 0x9B, 0xA3, 0x8B, 0x63, 0x41, 0xA1, 0x9A, 0xA3, 0x8A, 0x6F, 0x9F, 0x9B, 0x5B,
+    0xA2, 0x8A, 0x69, 0x8C, 0x87, 0x93, 0x89, 0x7B, 0x5A, 0x66, 0xC0, 0x25, 0xC2, 0x6E, 0xC0, 0x31,
+    0x7E, 0xC2, 0x6E, 0xC0, 0x7F, 0x6F, 0x7E, 0xC0, 0x7F, 0x18, 0xA4, 0x77, 0x7F, 0x7F, 0x65, 0x51,
+    0x9D, 0x87, 0x9C, 0x89, 0x65, 0xC0, 0x6E, 0xC0, 0x65, 0x65, 0xC2, 0x7F, 0x6E, 0x16, 0x66, 0x52,
+    0x56, 0x65, 0x5A, 0x39, 0x69, 0x39, 0x3E, 0x39, 0xC0, 0x7F, 0x0D, 0x6F, 0x6E, 0x21, 0x6F, 0xA2,
+    0x88, 0x7E, 0x6F, 0xC5, 0x66, 0xC0, 0x09, 0x01, 0xC0, 0x66, 0xC1, 0x01, 0xC0, 0x10, 0x15, 0x6E,
+    0x7F, 0xC1, 0x66, 0x29, 0x6E, 0x6B, 0x66, 0xA2, 0x87, 0x7F, 0x6E, 0x0C, 0xC2, 0x3D, 0xC0, 0x38,
+    0xC0, 0x30, 0xC0, 0x38, 0x24, 0x10, 0xC0, 0x01, 0xC3, 0x10, 0xC2, 0x01, 0x6B, 0xC0, 0x68, 0xAA,
+    0x87, 0xAE, 0x86, 0x9E, 0x94, 0x68, 0x07, 0x9D, 0x98, 0x54, 0x9E, 0x96, 0x75, 0x64, 0x64, 0x65,
+    0x55, 0xC0, 0x6B, 0xC0, 0x5B, 0xA0, 0x8B, 0x9A, 0x8B, 0x94, 0x6C, 0x9F, 0x5A, 0xA2, 0x69, 0x51,
+    0xA2, 0x77, 0xA2, 0x88, 0x52, 0x67, 0x5A, 0xA3, 0x89, 0x7E, 0x26, 0x56, 0xA2, 0x8A, 0x56, 0xA2,
+    0x88, 0x66, 0x65, 0xA4, 0x88, 0xA5, 0x98, 0xA4, 0x99, 0x9D, 0x99, 0x50, 0xA3, 0x99, 0xA3, 0xA9,
+    0xA7, 0xA9, 0xA5, 0x99, 0xA3, 0x87, 0xC0, 0x9E, 0x96, 0x97, 0x94, 0x9A, 0x74, 0x7F, 0x63, 0x55,
+    0x56, 0x69, 0xA2, 0x87, 0xA3, 0x87, 0x7F, 0x56, 0x3A, 0x9A, 0x8B, 0x97, 0x9D, 0x9C, 0x7A, 0x6B,
+    0xC6, 0x6E, 0xC5, 0x7A, 0x6F, 0xC1, 0x25, 0xA5, 0x99, 0xA4, 0x88, 0x7E, 0x6E, 0xC0, 0x67, 0x04,
+    0x1C, 0x20, 0x3D, 0xC0, 0x56, 0x69, 0x66, 0x2E, 0x02, 0xA2, 0x88, 0xC0, 0x66, 0xC0, 0x6F, 0xC1,
+    0x39, 0xA2, 0x97, 0x7D, 0xA2, 0x76, 0x6D, 0x96, 0x7E, 0xC6, 0x16, 0x1D, 0x16, 0x11, 0xC1, 0x16,
+    0xC0, 0x11, 0xC1, 0x16, 0x11, 0xC4, 0x1D, 0x25, 0xC1, 0x6F, 0x39, 0xC1, 0x3E, 0xC0, 0x39, 0x2A,
+    0x25, 0xC1, 0x20, 0x69, 0x20, 0xC1, 0x6D, 0x6D, 0xB7, 0x97, 0xA9, 0x88, 0x9E, 0x94, 0x9D, 0x94,
+    0x9C, 0xA6, 0x61, 0x6E, 0x50, 0x69, 0x7F, 0x69, 0x03, 0x50, 0x50, 0x66, 0x55, 0x79, 0x5F, 0x9F,
+    0x9C, 0x6B, 0x64, 0x6D, 0xA3, 0x98, 0x6B, 0x64, 0xC0, 0x6E, 0xA2, 0x79, 0xA2, 0x7B, 0xA3, 0x8B,
+    0xA3, 0x8B, 0x6F, 0x9D, 0x97, 0x51, 0xA5, 0x8B, 0xA2, 0x7B, 0xA1, 0x8B, 0xA1, 0x8A, 0x6B, 0x61,
+    0x88, 0x88, 0x1E, 0x5A, 0x66, 0xC1, 0x1E, 0x6B, 0x2A, 0x31, 0xC0, 0x7E, 0x6F, 0x69, 0xC0, 0x39,
+    0x3E, 0x05, 0x7E, 0xA2, 0x88, 0x6E, 0x7B, 0xA4, 0x77, 0xA5, 0x99, 0xA3, 0x99, 0xC1, 0x69, 0x55,
+    0x9D, 0x98, 0x9C, 0x88, 0x9C, 0x87, 0xC0, 0x7F, 0x6D, 0xC0, 0x65, 0x66, 0x69, 0x17, 0x1C, 0x7E,
+    0xC0, 0x67, 0x52, 0x09, 0x52, 0x69, 0x5A, 0x39, 0xC3, 0x6F, 0x0D, 0x6F, 0x7E, 0xC0, 0xA2, 0x78,
+    0x7F, 0x7E, 0x6F, 0xC1, 0x7E, 0xC0, 0x15, 0xC1, 0x66, 0x09, 0x01, 0x66, 0xC0, 0x55, 0x32, 0x3C,
+    0x01, 0x6E, 0x10, 0x15, 0x6E, 0x1D, 0x6B, 0xC0, 0x6E, 0x6F, 0x7A, 0x6E, 0x7F, 0x6E, 0x6B, 0x11,
+    0xC1, 0x0C, 0xC0, 0x3D, 0x38, 0xC0, 0x56, 0xC0, 0x29, 0x15, 0x10, 0xC0, 0x01, 0xC0, 0x10, 0xC1,
+    0x15, 0xC0, 0x10, 0xC0, 0x04, 0x5B, 0x01, 0x7D, 0xB1, 0x95, 0xA4, 0x84, 0x9C, 0xA5, 0xA0, 0x85,
+    0x9D, 0xA8, 0x9D, 0x98, 0x55, 0x7A, 0x65, 0x64, 0x69, 0x69, 0x56, 0x6B, 0x5A, 0x5A, 0x9E, 0x8C,
+    0x9F, 0x8C, 0x9A, 0x8D, 0xA2, 0x7D, 0xA5, 0x68, 0x45, 0x9C, 0x77, 0x99, 0x88, 0x9C, 0x77, 0xA2,
+    0x87, 0x6F, 0x7F, 0x57, 0x6E, 0x6F, 0xA2, 0x88, 0x57, 0x56, 0xA2, 0x89, 0xC0, 0x7E, 0xA2, 0x88,
+    0xA3, 0x99, 0xA3, 0x99, 0x9D, 0x98, 0x51, 0x7F, 0xA4, 0x98, 0xA4, 0x98, 0xA6, 0xA9, 0x7E, 0xA4,
+    0x88, 0xA3, 0x88, 0x9F, 0x96, 0x94, 0x84, 0x9A, 0x85, 0x7A, 0x56, 0xC0, 0x32, 0xA4, 0x85, 0xA2,
+    0x87, 0xA2, 0x88, 0x66, 0x42, 0x32, 0x98, 0x8C, 0x97, 0x9C, 0x9D, 0x8B, 0x6F, 0xC5, 0x7E, 0xC5,
+    0x6E, 0x7A, 0xC0, 0x6E, 0x67, 0x0C, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0xC0, 0x34, 0x20, 0x9D, 0x98,
+    0x55, 0x00, 0xA3, 0x77, 0xA2, 0x87, 0x7F, 0x7E, 0xA2, 0x87, 0x6F, 0x7A, 0x00, 0x42, 0x2B, 0x52,
+    0x56, 0x1E, 0xA4, 0x88, 0xA4, 0x96, 0xA2, 0x85, 0xA2, 0x86, 0xC0, 0xFF, 0x6B, 0x8D, 0xC0, 0x6E,
+    0xC1, 0x16, 0x6B, 0xC0, 0x6E, 0xC0, 0x1D, 0x16, 0xC1, 0x1D, 0x16, 0xC4, 0x11, 0xC3, 0x20, 0x25,
+    0xC0, 0x34, 0x39, 0x6E, 0x6B, 0xC2, 0x3E, 0x51, 0x25, 0xC1, 0x20, 0x69, 0x20, 0x25, 0xC0, 0x19,
+    0xAC, 0x85, 0xB6, 0x75, 0x9D, 0xA6, 0x9C, 0x83, 0x9E, 0x95, 0x9D, 0xA8, 0x61, 0x69, 0x65, 0x69,
+    0x69, 0xC0, 0x55, 0x66, 0x51, 0x66, 0x7F, 0xA1, 0x7C, 0xA4, 0x7D, 0xA1, 0x9E, 0xA3, 0x99, 0x9E,
+    0x75, 0x9A, 0x94, 0x9C, 0x93, 0x37, 0x69, 0x7B, 0x30, 0x6E, 0xA0, 0x9A, 0xA2, 0x79, 0xA3, 0x7B,
+    0xA4, 0x79, 0xA2, 0x86, 0x56, 0xA1, 0x8A, 0x27, 0xA3, 0x8B, 0xA2, 0x7B, 0xA1, 0x8B, 0x66, 0x8D,
+    0x99, 0x92, 0x89, 0x5F, 0x16, 0xC1, 0x7E, 0x2A, 0xC0, 0x6B, 0x6E, 0x3E, 0x05, 0xC0, 0x3E, 0xC0,
+    0x05, 0x3E, 0x0D, 0xA2, 0x88, 0x7F, 0xA2, 0x88, 0xA6, 0x88, 0xA5, 0x88, 0x7F, 0xC1, 0x65, 0x59,
+    0x50, 0x9C, 0x87, 0x9C, 0x88, 0x64, 0x6F, 0x69, 0xC0, 0x69, 0x61, 0xC0, 0x6B, 0x7E, 0x6E, 0xC0,
+    0x67, 0x66, 0x57, 0x42, 0x9D, 0x9A, 0x59, 0xC0, 0x39, 0xC3, 0x7F, 0xA2, 0x78, 0xC0, 0x7E, 0x6F,
+    0xA2, 0x88, 0xA2, 0x87, 0x6B, 0xC0, 0x6E, 0x7A, 0xC2, 0x15, 0x66, 0x01, 0xC0, 0x66, 0xC0, 0x2D,
+    0xC0, 0x6E, 0x3C, 0x01, 0xC0, 0x10, 0x15, 0x1A, 0x7B, 0x6E, 0xC0, 0x7F, 0x3D, 0x6B, 0x7E, 0x6E,
+    0x6B, 0xC2, 0x0C, 0xC0, 0x04, 0x38, 0x56, 0xC0, 0x29, 0x52, 0x10, 0x01, 0xC2, 0x10, 0x15, 0xC3,
+    0x10, 0xC0, 0x5A, 0x01, 0xA6, 0x95, 0xAF, 0x93, 0x9B, 0xA3, 0x9C, 0xA6, 0x70, 0x61, 0x51, 0x6E,
+    0xC1, 0x64, 0x59, 0x3A, 0x5B, 0xA1, 0x8A, 0x9F, 0x8B, 0xA1, 0x7A, 0xA0, 0x8D, 0xA1, 0x8E, 0xA5,
+    0x7C, 0xA3, 0x8A, 0x55, 0xA2, 0x77, 0x6E, 0x9C, 0x87, 0x96, 0x78, 0x94, 0x76, 0x40, 0xA4, 0x88,
+    0x5A, 0x6F, 0xA2, 0x88, 0x56, 0x6F, 0x6B, 0x7E, 0x52, 0x56, 0x14, 0x7F, 0x6F, 0x9B, 0x99, 0x23,
+    0xA4, 0x88, 0xA5, 0xA9, 0xA7, 0x99, 0xA2, 0x98, 0x9C, 0x98, 0x7A, 0xA8, 0x98, 0xA3, 0x88, 0x64,
+    0x97, 0x95, 0x96, 0x84, 0x55, 0x7E, 0xA2, 0x87, 0xA3, 0x87, 0xA3, 0x86, 0x7F, 0x6F, 0x66, 0x9C,
+    0x8A, 0x9A, 0x8B, 0x96, 0x8D, 0x99, 0x9B, 0x57, 0x6F, 0xC7, 0x7E, 0xC2, 0x69, 0x04, 0x6E, 0x77,
+    0x6D, 0x6F, 0x20, 0xA2, 0x76, 0xA3, 0x87, 0x7A, 0x65, 0x62, 0x6E, 0xA3, 0x88, 0xA3, 0x98, 0xA3,
+    0x88, 0xA2, 0x97, 0xA2, 0x87, 0xA2, 0x77, 0x7A, 0x6E, 0x6B, 0x52, 0x66, 0x56, 0x9C, 0x89, 0x9C,
+    0x79, 0x9C, 0x89, 0xA3, 0x98, 0xA3, 0x97, 0xA3, 0x85, 0xA4, 0x86, 0x7E, 0x16, 0x6B, 0xC1, 0x6E,
+    0xC0, 0x7A, 0xC3, 0x1D, 0xC0, 0x22, 0xC1, 0x1D, 0xC1, 0x22, 0x16, 0x66, 0xC1, 0x16, 0x1D, 0x25,
+    0x6F, 0x7E, 0x6F, 0x7A, 0x6E, 0xC3, 0x05, 0x39, 0x25, 0xC1, 0x66, 0x69, 0x20, 0x25, 0xC0, 0x7C,
+    0xB8, 0x84, 0xA7, 0x85, 0x98, 0xA3, 0x9D, 0xA5, 0x60, 0x50, 0x66, 0x7A, 0x65, 0x59, 0x66, 0xC1,
+    0x6B, 0x55, 0x66, 0xA2, 0x7D, 0xFF, 0xDE, 0x30, 0xA4, 0x7D, 0x9D, 0x9C, 0x51, 0xA4, 0x87, 0xA2,
+    0x85, 0x96, 0xB1, 0x9B, 0x93, 0xA3, 0x95, 0x7D, 0x66, 0x2B, 0xC0, 0x7E, 0x6B, 0xA2, 0x79, 0xA4,
+    0x68, 0xA4, 0x89, 0xA1, 0x7A, 0xA2, 0x79, 0xA0, 0x8B, 0xA3, 0x8E, 0xA2, 0x7B, 0xA1, 0x8A, 0x9C,
+    0x98, 0x88, 0x88, 0x9A, 0x78, 0xA1, 0x9A, 0x16, 0xC0, 0x1E, 0x6F, 0x31, 0x6E, 0x39, 0x6E, 0xC5,
+    0x7B, 0xA2, 0x88, 0xA3, 0x88, 0xA3, 0x99, 0xA7, 0x98, 0xA4, 0x78, 0xC1, 0x7A, 0xC0, 0x51, 0x54,
+    0x9D, 0x87, 0x9D, 0x87, 0x9E, 0x86, 0x66, 0x69, 0xC1, 0x65, 0xC0, 0x7E, 0x6B, 0x6E, 0x7A, 0x5B,
+    0x63, 0x56, 0x56, 0x9D, 0x8B, 0x39, 0x69, 0x39, 0x2A, 0x7B, 0x39, 0xC0, 0x05, 0x7F, 0x6E, 0x7E,
+    0x6F, 0xA2, 0x88, 0x7E, 0x15, 0xC1, 0x7E, 0x6B, 0xC0, 0x1D, 0x15, 0x09, 0x01, 0x66, 0xC1, 0x2D,
+    0xC0, 0x6E, 0x6B, 0x01, 0xC0, 0x7F, 0x15, 0x6E, 0xC0, 0x7F, 0xA2, 0x88, 0x6B, 0xC0, 0x7E, 0xC0,
+    0x6F, 0xC2, 0x69, 0x0C, 0xC0, 0x3D, 0x66, 0x29, 0x24, 0x56, 0x10, 0x01, 0x3C, 0x01, 0xC0, 0x10,
+    0x15, 0x24, 0xC1, 0x15, 0xC0, 0x10, 0xC0, 0x5A, 0x35, 0xAB, 0x94, 0xA9, 0xA1, 0x96, 0xC3, 0x9D,
+    0xB8, 0x9D, 0xA9, 0x9D, 0xA9, 0x9D, 0x99, 0xA3, 0x68, 0xA3, 0x77, 0xC0, 0x6E, 0x56, 0x52, 0xA0,
+    0x7A, 0xA1, 0x7C, 0xA2, 0x7C, 0xA4, 0x7A, 0xA3, 0x8C, 0xA3, 0x8C, 0x9D, 0x89, 0x8E, 0x87, 0x99,
+    0x78, 0x7B, 0xAD, 0x88, 0xAF, 0x89, 0x7A, 0x9D, 0x77, 0x94, 0x76, 0x97, 0x78, 0x55, 0xA3, 0x89,
+    0xA2, 0x88, 0x5A, 0xA3, 0x88, 0x51, 0x21, 0x56, 0x6F, 0x7F, 0x5A, 0xA2, 0x89, 0xC0, 0x6B, 0xA2,
+    0x97, 0x7F, 0xA7, 0x98, 0xA3, 0xA9, 0xA6, 0x88, 0xA3, 0xB9, 0x9B, 0x98, 0xA5, 0x99, 0xA5, 0x88,
+    0x69, 0x96, 0x95, 0x95, 0x97, 0x9F, 0x85, 0xA3, 0x86, 0xA3, 0x97, 0xA3, 0x87, 0x6F, 0xA2, 0x88,
+    0xC0, 0x52, 0x9B, 0x9B, 0x98, 0x8C, 0x96, 0x9D, 0x9C, 0x7A, 0x6F, 0xC7, 0x7E, 0xC6, 0xA6, 0x86,
+    0xA5, 0x98, 0xA4, 0x86, 0x6D, 0xA3, 0x87, 0x7E, 0x65, 0xC0, 0xA2, 0x88, 0x7E, 0x7F, 0x7E, 0x6E,
+    0x6D, 0x7F, 0x6E, 0xC1, 0x3E, 0xC0, 0x57, 0x9C, 0x8A, 0x9C, 0x8A, 0x9B, 0x8A, 0x9D, 0x98, 0xA2,
+    0x97, 0xA5, 0x86, 0x3F, 0xA2, 0x87, 0xFF, 0x7B, 0xCE, 0xC4, 0x6E, 0x25, 0xC8, 0x5A, 0x25, 0xC0,
+    0x66, 0x55, 0xC0, 0x6F, 0x20, 0x25, 0x2A, 0x7F, 0x7F, 0x6E, 0xC1, 0x6E, 0x0D, 0xC2, 0x39, 0x2A,
+    0x25, 0xC1, 0x20, 0x25, 0xC0, 0x65, 0xA9, 0x95, 0xB7, 0x84, 0x9B, 0xA2, 0x9A, 0xA3, 0x9D, 0x97,
+    0x66, 0x66, 0x51, 0xC0, 0x7A, 0x56, 0x66, 0x7E, 0xC1, 0x57, 0xA1, 0x8C, 0xFF, 0xDD, 0xCF, 0xA5,
+    0x7F, 0x9D, 0x69, 0x04, 0x93, 0x99, 0x04, 0xBB, 0x97, 0xA1, 0xA6, 0x97, 0xB4, 0x99, 0xA2, 0xA2,
+    0x83, 0x7A, 0xC1, 0x26, 0xC0, 0xA2, 0x78, 0xA3, 0x89, 0xA4, 0x79, 0x6B, 0x5F, 0xA3, 0x8B, 0xA4,
+    0x7C, 0xA3, 0x7D, 0xA1, 0x8B, 0x6B, 0x98, 0x97, 0x89, 0x8A, 0x9D, 0x99, 0x5F, 0x66, 0x7F, 0x2A,
+    0x6B, 0x6E, 0x39, 0x6E, 0xC2, 0x39, 0xC0, 0x3E, 0x6B, 0xA2, 0x98, 0xA3, 0x88, 0xA5, 0x99, 0xA8,
+    0x88, 0x6E, 0x7A, 0x01, 0xC1, 0x65, 0x54, 0x9D, 0x97, 0x9C, 0x76, 0x50, 0x65, 0x69, 0x55, 0x7A,
+    0x6E, 0x05, 0x7E, 0x6E, 0x7F, 0x6F, 0xC0, 0x2F, 0x66, 0x42, 0x9D, 0x9C, 0x9D, 0x8A, 0x32, 0x56,
+    0xC0, 0x7B, 0x39, 0xC0, 0x6F, 0x7E, 0x6F, 0xC0, 0xA2, 0x88, 0x7F, 0x6E, 0x7F, 0xC0, 0x6E, 0x7F,
+    0x29, 0x24, 0x15, 0xC0, 0x10, 0x01, 0xC0, 0x3C, 0xC1, 0x5A, 0x69, 0x39, 0x3C, 0x01, 0x10, 0x15,
+    0x24, 0xC0, 0x6F, 0xA3, 0x98, 0xC2, 0x6E, 0x6B, 0x6E, 0x18, 0x11, 0x0C, 0xC0, 0x55, 0x66, 0xC0,
+    0x24, 0x15, 0x10, 0xC0, 0x01, 0xC1, 0x10, 0x15, 0xC1, 0x24, 0xC1, 0x15, 0xC0, 0x10, 0x5A, 0x64,
+    0xAB, 0xA3, 0xA2, 0xC0, 0x93, 0xE6, 0x65, 0x61, 0x9C, 0xAA, 0x52, 0xA4, 0x66, 0xA4, 0x67, 0xA2,
+    0x77, 0x42, 0x9F, 0x8B, 0xA0, 0x7B, 0xA3, 0x7B, 0xA4, 0x7D, 0xA3, 0x8C, 0xA4, 0x69, 0xA2, 0x78,
+    0x9D, 0x99, 0x89, 0x99, 0x8E, 0x78, 0xA6, 0x77, 0x9D, 0x99, 0x07, 0x15, 0xAC, 0x99, 0x65, 0x5A,
+    0x99, 0x87, 0x93, 0x78, 0x40, 0x6E, 0x59, 0x5A, 0x51, 0x06, 0xA2, 0x89, 0x5B, 0x6B, 0x6E, 0xA1,
+    0x9A, 0x6E, 0x7F, 0x5A, 0x51, 0xA1, 0xA8, 0xA2, 0x98, 0xA7, 0x99, 0xAC, 0x98, 0xA3, 0xA8, 0x76,
+    0xA2, 0x98, 0xA2, 0x78, 0xC0, 0x9D, 0x97, 0x98, 0x85, 0x98, 0x83, 0xA2, 0x85, 0xA4, 0x76, 0x7F,
+    0xA2, 0x88, 0xC0, 0x65, 0x52, 0x99, 0x9D, 0x96, 0x8D, 0x98, 0x8C, 0x5A, 0x6B, 0xC5, 0x7E, 0xC5,
+    0x38, 0xA4, 0x77, 0xAB, 0x96, 0xA7, 0x97, 0xA3, 0x98, 0x6C, 0x69, 0x6D, 0x7A, 0x3B, 0x7E, 0x6E,
+    0x03, 0x7E, 0xC0, 0x6E, 0xC1, 0x0B, 0xC0, 0x65, 0x55, 0x5B, 0x9C, 0x8B, 0x9A, 0x8B, 0x9C, 0x8A,
+    0x51, 0x7D, 0x2F, 0xA4, 0x75, 0xA3, 0x97, 0xFF, 0x84, 0x0F, 0xC0, 0x56, 0x65, 0xC0, 0x2A, 0x31,
+    0x7A, 0xC2, 0x31, 0x2A, 0x25, 0xC6, 0x51, 0x7F, 0x25, 0xC0, 0x2A, 0x39, 0xA2, 0x78, 0x7A, 0xC1,
+    0x6E, 0xC3, 0x0D, 0x05, 0x39, 0x31, 0x25, 0xC2, 0x69, 0x65, 0xB2, 0xA4, 0xAD, 0x72, 0x97, 0xB2,
+    0x9C, 0xA6, 0x9D, 0x98, 0x46, 0x62, 0x52, 0x7E, 0xC0, 0x66, 0x7B, 0x7E, 0x65, 0x5A, 0x27, 0xA5,
+    0x6E, 0xFF, 0xE6, 0x35, 0xA2, 0x6B, 0x22, 0x8C, 0x88, 0xA6, 0x99, 0x9A, 0x88, 0xB9, 0x97, 0xB2,
+    0x98, 0xA0, 0xA7, 0x96, 0xA1, 0x98, 0x91, 0xA1, 0xA7, 0x7A, 0x6E, 0xC0, 0x6E, 0xA3, 0x88, 0x6F,
+    0xA5, 0x87, 0xA3, 0x79, 0x5A, 0xA2, 0x79, 0xA3, 0x8C, 0xA5, 0x6D, 0xA3, 0x8E, 0x66, 0xC0, 0x8D,
+    0x99, 0x92, 0x79, 0xA1, 0x9B, 0x59, 0x66, 0x2A, 0xC0, 0x39, 0xC0, 0x6E, 0xC1, 0x39, 0xC0, 0x66,
+    0x39, 0x6F, 0xA3, 0x98, 0xA2, 0x88, 0xA5, 0x99, 0xA7, 0x98, 0xA2, 0x88, 0xC1, 0x5A, 0xC0, 0x69,
+    0x54, 0x9C, 0x86, 0x9C, 0x86, 0x50, 0x69, 0x65, 0x55, 0x69, 0x7B, 0xC0, 0x6E, 0xA2, 0x87, 0x7F,
+    0x7F, 0x6F, 0x66, 0x2D, 0x63, 0x53, 0x9D, 0x8B, 0x9D, 0x8A, 0x41, 0xC1, 0x39, 0xC1, 0x05, 0x0D,
+    0x6F, 0x7F, 0x6E, 0x7E, 0x6F, 0xA2, 0x88, 0xC0, 0x29, 0xC0, 0x66, 0x59, 0x15, 0xC0, 0x55, 0x01,
+    0x66, 0x5A, 0xC1, 0x2D, 0x39, 0x01, 0x06, 0x15, 0xC0, 0x24, 0x29, 0x7F, 0xA2, 0x88, 0x6E, 0xC1,
+    0x6B, 0x7E, 0xC1, 0x18, 0x0C, 0x55, 0x38, 0x29, 0xC0, 0x15, 0x52, 0x01, 0xC3, 0x7F, 0x15, 0xC1,
+    0x24, 0x29, 0x24, 0xC1, 0x15, 0x10, 0x64, 0xAB, 0xA3, 0x9D, 0xE0, 0x94, 0xD6, 0x63, 0x9D, 0x99,
+    0x66, 0x52, 0x6E, 0xA4, 0x66, 0xA3, 0x68, 0x9E, 0x69, 0xA3, 0x7D, 0xA6, 0x7C, 0xA2, 0x7B, 0xA4,
+    0x7B, 0xA0, 0x8A, 0x5E, 0xA2, 0x78, 0x99, 0x98, 0x82, 0x89, 0x94, 0x87, 0xA2, 0x88, 0x6F, 0xA5,
+    0x88, 0xB5, 0x89, 0x03, 0x7A, 0x55, 0x7A, 0x9C, 0x77, 0x98, 0x77, 0x99, 0x77, 0x58, 0x55, 0x5B,
+    0xA3, 0x89, 0x52, 0xA2, 0x78, 0x46, 0x62, 0xA3, 0x89, 0xA2, 0x89, 0xC0, 0x6E, 0x7F, 0x6E, 0x07,
+    0xA1, 0xA9, 0xA9, 0xA8, 0xAC, 0x87, 0x71, 0x76, 0xA6, 0x89, 0xA3, 0x88, 0xC1, 0x99, 0x94, 0x96,
+    0x82, 0xA2, 0x84, 0xA3, 0x88, 0xA1, 0x9A, 0x6E, 0x69, 0x62, 0x9C, 0x8A, 0x97, 0x9F, 0x96, 0x8C,
+    0x9D, 0x7A, 0x6B, 0xC5, 0x7E, 0xC5, 0x66, 0xA5, 0x97, 0xAD, 0x84, 0xA8, 0x96, 0xA5, 0x88, 0x6D,
+    0x9D, 0x97, 0x55, 0x6D, 0xC2, 0x7E, 0x65, 0xC0, 0x67, 0xC0, 0x56, 0xC0, 0x56, 0x65, 0x56, 0x57,
+    0x9D, 0x8A, 0x9A, 0x9B, 0x9B, 0x8A, 0x66, 0xA2, 0x87, 0xA5, 0x95, 0xA5, 0x85, 0xA3, 0x97, 0xFF,
+    0x84, 0x30, 0xC0, 0x65, 0x66, 0xC5, 0x39, 0xC0, 0x34, 0xC1, 0x5A, 0x2A, 0xC1, 0x66, 0xC0, 0x66,
+    0x25, 0xC1, 0x31, 0x05, 0x7E, 0xC0, 0x6E, 0x0D, 0xC0, 0x12, 0x6B, 0xC0, 0x12, 0x0D, 0x5A, 0x65,
+    0x34, 0x2A, 0x25, 0xC1, 0x1E, 0x7E, 0xB5, 0xA3, 0xA2, 0x90, 0x98, 0xA4, 0x9C, 0xA8, 0x9D, 0x8A,
+    0x9D, 0x8A, 0x9D, 0x99, 0x66, 0x6F, 0x7E, 0xA2, 0x87, 0x6E, 0x79, 0x7A, 0x14, 0xA2, 0x7B, 0xFF,
+    0xE5, 0xCE, 0xA3, 0x7F, 0x9D, 0x7A, 0xFF, 0x42, 0x07, 0x93, 0x89, 0xA2, 0x88, 0x7E, 0xB3, 0x98,
+    0xBB, 0x99, 0xA0, 0xA7, 0x97, 0xC2, 0x98, 0xA2, 0x70, 0x65, 0x6E, 0x31, 0xA2, 0x87, 0x6F, 0xA3,
+    0x77, 0xA3, 0x77, 0xA3, 0x78, 0xA3, 0x88, 0xA2, 0x68, 0xA3, 0x7B, 0xA5, 0x7E, 0xA6, 0x7E, 0x6B,
+    0x6B, 0x95, 0x98, 0x8A, 0x89, 0x6B, 0xA0, 0x8A, 0x55, 0x1E, 0x6F, 0xC0, 0x7F, 0xC6, 0x0D, 0xA2,
+    0x88, 0x6E, 0xA5, 0x99, 0xA7, 0x99, 0x04, 0x6F, 0x55, 0xC0, 0x69, 0x69, 0x51, 0x9C, 0x75, 0x9C,
+    0x97, 0x54, 0x65, 0x59, 0x64, 0x55, 0x7B, 0xC0, 0xA2, 0x87, 0xA2, 0x88, 0x7F, 0x7E, 0x6F, 0x6B,
+    0x66, 0x67, 0x52, 0x52, 0x9D, 0x8B, 0x9D, 0x8A, 0x52, 0x5A, 0xC0, 0x6B, 0x39, 0xC0, 0x7F, 0x0D,
+    0x6F, 0x21, 0x7F, 0xA2, 0x78, 0x7E, 0x6F, 0x6E, 0x6B, 0x15, 0xC1, 0x56, 0x01, 0x56, 0x69, 0x66,
+    0xC0, 0x32, 0x2D, 0x39, 0x01, 0x7F, 0x15, 0xC0, 0x29, 0x7F, 0x6F, 0x7E, 0x6E, 0xC0, 0x6B, 0x7E,
+    0xC0, 0x6E, 0x20, 0xC0, 0x18, 0x0C, 0x9D, 0x89, 0x65, 0xC0, 0x15, 0x01, 0xC0, 0x6B, 0x01, 0xC1,
+    0x10, 0x15, 0xC1, 0x24, 0x29, 0xC1, 0x24, 0xC0, 0x10, 0x65, 0xAC, 0xB2, 0xFF, 0xFD, 0xA7, 0x94,
+    0xD7, 0x9C, 0x9A, 0x52, 0x57, 0x66, 0xC0, 0x69, 0xA2, 0x5A, 0xA8, 0x3B, 0xA7, 0x6B, 0xA3, 0x8B,
+    0xA2, 0x79, 0xA1, 0x8A, 0x6F, 0x66, 0x55, 0x51, 0x84, 0x88, 0x8F, 0x89, 0xA3, 0x88, 0xC0, 0xA6,
+    0x88, 0xBB, 0x88, 0xB1, 0x99, 0x9C, 0x98, 0x7F, 0x66, 0x22, 0x96, 0x94, 0x98, 0x76, 0x44, 0x6F,
+    0x6F, 0x56, 0x56, 0xA3, 0x69, 0x5B, 0x47, 0x5B, 0xA3, 0x8A, 0x66, 0x66, 0xA6, 0x77, 0x9D, 0x99,
+    0x2E, 0xA6, 0x88, 0xA4, 0x97, 0xA1, 0xA9, 0x9C, 0x97, 0xA5, 0x98, 0xAA, 0x99, 0xA6, 0x99, 0xA3,
+    0x88, 0xC0, 0x68, 0x99, 0x83, 0x96, 0x83, 0xA3, 0x96, 0xA2, 0x89, 0x7F, 0x6E, 0x65, 0x9D, 0x9A,
+    0x99, 0x9D, 0x96, 0x8D, 0x9A, 0x7A, 0x57, 0x6B, 0xC4, 0x7A, 0x6E, 0xC4, 0x3F, 0xA6, 0x86, 0xAA,
+    0x94, 0xA8, 0x85, 0xA5, 0x87, 0x6D, 0x9D, 0x98, 0x59, 0x7E, 0xC3, 0x65, 0x67, 0x56, 0x66, 0x56,
+    0x52, 0x52, 0x9D, 0x8A, 0x52, 0x52, 0x9C, 0x79, 0x52, 0x53, 0x7A, 0x3A, 0x1A, 0xA5, 0x85, 0xA4,
+    0x86, 0xFF, 0x8C, 0x71, 0x65, 0xC0, 0x65, 0x56, 0xC6, 0x66, 0xC5, 0x55, 0xC4, 0x39, 0x0D, 0xC1,
+    0x19, 0x69, 0xC1, 0x19, 0xC0, 0x0D, 0x5A, 0xC0, 0x65, 0x34, 0x25, 0xC2, 0x69, 0xA3, 0xA8, 0xB5,
+    0xA1, 0xFF, 0xEE, 0x05, 0x9A, 0xA6, 0x9B, 0x9B, 0x9C, 0x7C, 0xA1, 0x8D, 0xA4, 0x89, 0x9A, 0x89,
+    0x99, 0x88, 0x9C, 0x97, 0xA2, 0x87, 0xA9, 0x95, 0xA2, 0x96, 0x69, 0x6E, 0xA4, 0x7A, 0xFF, 0xDD,
+    0x8E, 0xA1, 0x7F, 0x9E, 0x68, 0x86, 0x78, 0x91, 0x89, 0x7F, 0x7A, 0xBA, 0x77, 0xB7, 0x98, 0x97,
+    0xD6, 0x96, 0xC2, 0xA2, 0x94, 0x9C, 0xA8, 0xA4, 0x87, 0x51, 0x61, 0x03, 0x59, 0xA3, 0x78, 0xA4,
+    0x76, 0xA3, 0x78, 0xA4, 0x68, 0xA3, 0x79, 0xA3, 0x8C, 0xA6, 0x6C, 0xA3, 0x7F, 0xA1, 0x8A, 0xC1,
+    0x92, 0x86, 0x8C, 0x9B, 0x25, 0x69, 0xC0, 0x25, 0x6E, 0xC0, 0x7F, 0xC0, 0x3E, 0x39, 0xC2, 0xA2,
+    0x88, 0xA2, 0x88, 0xC0, 0xA5, 0x99, 0xA7, 0x98, 0xA3, 0x89, 0xA2, 0x88, 0xC0, 0x69, 0x55, 0x69,
+    0x9D, 0x87, 0x9A, 0x87, 0x9D, 0x96, 0x69, 0xC0, 0x54, 0x51, 0x55, 0x69, 0x7A, 0xA2, 0x87, 0xA3,
+    0x88, 0xA2, 0x98, 0x6F, 0xA2, 0x88, 0x7B, 0x5B, 0x66, 0x63, 0x56, 0x52, 0x9D, 0x8A, 0x9D, 0x9B,
+    0x42, 0x2A, 0xC0, 0x6E, 0x39, 0xC0, 0x7F, 0x6E, 0x6F, 0x7E, 0x6B, 0x7E, 0x6F, 0xA2, 0x87, 0x6B,
+    0x5A, 0x69, 0x66, 0xC0, 0x3C, 0x5A, 0x65, 0xC3, 0x6E, 0x01, 0x10, 0x6E, 0x6F, 0x7E, 0xA2, 0x88,
+    0x7F, 0x6E, 0x6B, 0x7E, 0x6E, 0xC0, 0x20, 0xC1, 0x66, 0x18, 0x0C, 0x3D, 0x29, 0x66, 0x10, 0x01,
+    0x6B, 0xC0, 0x01, 0xC1, 0x10, 0x15, 0xC1, 0x24, 0xC0, 0x29, 0xC1, 0x24, 0x15, 0x61, 0xAC, 0xA2,
+    0x9C, 0xC0, 0x90, 0xE7, 0x9A, 0xAB, 0x9D, 0x8A, 0xA0, 0x7B, 0x5A, 0x9D, 0x98, 0x6E, 0xA7, 0x6A,
+    0xA8, 0x3B, 0xA6, 0x6A, 0xA3, 0x8A, 0xA2, 0x78, 0x6B, 0xA2, 0x88, 0xC0, 0x0F, 0xC0, 0x90, 0x88,
+    0x89, 0x89, 0x65, 0xA3, 0x89, 0xAB, 0x88, 0x1B, 0xA5, 0x87, 0x23, 0xA1, 0xA9, 0x9E, 0x95, 0x98,
+    0x94, 0x9E, 0xA4, 0x68, 0x9D, 0x88, 0xC0, 0x42, 0x6F, 0xA2, 0x79, 0xA2, 0x68, 0xA1, 0x7B, 0x9F,
+    0x7B, 0x4B, 0x9F, 0x7B, 0x5B, 0x67, 0xA3, 0x88, 0x55, 0x9D, 0x88, 0xA6, 0x99, 0xA4, 0x88, 0xA1,
+    0xA8, 0x99, 0x98, 0x9C, 0x98, 0xA9, 0x98, 0xA9, 0x98, 0xA7, 0xBA, 0xA3, 0x88, 0x9B, 0x86, 0x98,
+    0x82, 0x9E, 0x73, 0x7E, 0xA2, 0x88, 0xA2, 0x98, 0x6B, 0x6D, 0x62, 0x3A, 0x97, 0x9D, 0x97, 0x8D,
+    0x42, 0x6B, 0xC4, 0x7A, 0x6E, 0xC5, 0xA5, 0x96, 0xAA, 0x84, 0xA6, 0x95, 0xA2, 0x86, 0xC0, 0x5D,
+    0x7E, 0x6B, 0xC1, 0x66, 0x52, 0x52, 0x66, 0x52, 0x22, 0x9D, 0x89, 0x9D, 0x8A, 0x9D, 0x9A, 0x9D,
+    0x9A, 0x05, 0xC0, 0x55, 0xA1, 0x8A, 0x7F, 0xC0, 0xA3, 0x97, 0xA6, 0x85, 0xA6, 0x83, 0xA3, 0x87,
+    0xFF, 0x94, 0x91, 0xC0, 0x66, 0x55, 0x66, 0xC5, 0x65, 0x5A, 0x66, 0x39, 0xC2, 0x34, 0x55, 0xC3,
+    0x7E, 0x39, 0x0D, 0xC0, 0x6E, 0x6B, 0xC2, 0x12, 0x0D, 0xC0, 0x0A, 0x66, 0x39, 0x56, 0x25, 0xC2,
+    0x65, 0xA4, 0x86, 0xB4, 0xB0, 0x99, 0xA0, 0x9A, 0xA8, 0x9C, 0x7D, 0xA1, 0x7F, 0xA3, 0x7D, 0xA4,
+    0x99, 0x90, 0x78, 0x9C, 0x98, 0xA6, 0x99, 0x8D, 0x97, 0xA7, 0x94, 0xAA, 0x94, 0xA3, 0x96, 0xA3,
+    0x87, 0xA4, 0x79, 0xA5, 0x7F, 0xFF, 0xD5, 0x95, 0x5F, 0x90, 0x67, 0x89, 0x99, 0x7F, 0xA7, 0x99,
+    0xBB, 0x88, 0xA9, 0x96, 0x91, 0xE4, 0x9B, 0xC4, 0xA2, 0x94, 0x03, 0x66, 0xC0, 0x6D, 0x7F, 0xA2,
+    0x78, 0x5E, 0xA4, 0x66, 0xA4, 0x77, 0xA3, 0x79, 0xA4, 0x69, 0xA4, 0x7B, 0xA2, 0x7D, 0xA3, 0x7E,
+    0xA2, 0x7A, 0xC0, 0x9F, 0x86, 0x7E, 0x8E, 0x99, 0x90, 0x8A, 0x6F, 0xC0, 0x6F, 0xC1, 0x7F, 0xC5,
+    0xA3, 0x88, 0x7B, 0x21, 0xA4, 0x88, 0xA6, 0x88, 0xA3, 0x99, 0xA2, 0x88, 0x6E, 0x3C, 0x68, 0x55,
+    0x9C, 0x87, 0x9B, 0x86, 0x9E, 0x86, 0xC0, 0x69, 0x50, 0x51, 0x54, 0x7E, 0x69, 0x6F, 0xA3, 0x98,
+    0xA3, 0x98, 0xA3, 0x88, 0x7F, 0xA2, 0x88, 0x6B, 0x67, 0x66, 0x3A, 0xC0, 0x37, 0x22, 0x9C, 0x8B,
+    0x9D, 0x8A, 0x52, 0x5A, 0x6E, 0x39, 0x6E, 0x08, 0xC0, 0x0D, 0x6F, 0x21, 0x6F, 0x7F, 0xC3, 0x5A,
+    0xC1, 0x69, 0x2D, 0xC1, 0x66, 0x2D, 0xA2, 0x88, 0x6F, 0x15, 0x6F, 0x7E, 0xA2, 0x88, 0x7F, 0x6F,
+    0x7E, 0x6E, 0x6B, 0x25, 0x20, 0xC1, 0x18, 0x0C, 0xC1, 0x51, 0x51, 0x51, 0x56, 0xC0, 0x10, 0x01,
+    0xC0, 0x10, 0x15, 0xC0, 0x24, 0xC3, 0x29, 0x24, 0x15, 0x10, 0x01, 0xA6, 0xA4, 0xA5, 0xD2, 0x90,
+    0xF6, 0x97, 0x8B, 0x9A, 0x6B, 0x9C, 0x6A, 0xA3, 0x78, 0x65, 0x56, 0xA4, 0x69, 0xB1, 0x7A, 0xA3,
+    0x7A, 0xA4, 0x89, 0x6F, 0x6E, 0x7F, 0xC0, 0x03, 0x52, 0x51, 0x98, 0x87, 0x99, 0x89, 0xA4, 0x88,
+    0xAE, 0x88, 0xA7, 0x89, 0x9C, 0x87, 0xA1, 0xA8, 0x9F, 0xB6, 0x9B, 0xA4, 0x9B, 0xA5, 0x9E, 0xA5,
+    0x69, 0xC0, 0x6F, 0xC0, 0x5F, 0x6B, 0xA3, 0x79, 0xA2, 0x6A, 0xA2, 0x6A, 0xA0, 0x7A, 0x9F, 0x7B,
+    0x9C, 0x7A, 0x47, 0x5E, 0x5E, 0x9D, 0x89, 0x6B, 0xA4, 0x98, 0xA3, 0x98, 0x9D, 0x99, 0x60, 0xA3,
+    0x98, 0xA7, 0x99, 0xA5, 0xB9, 0xA6, 0x88, 0x9E, 0x75, 0x91, 0x93, 0xA2, 0x73, 0xA2, 0x98, 0xA3,
+    0x88, 0x7F, 0x7F, 0x6D, 0x66, 0x05, 0x98, 0x9D, 0x96, 0x8D, 0x35, 0x6B, 0xC4, 0x7A, 0x6E, 0xC4,
+    0x3F, 0xA5, 0x96, 0xAA, 0x84, 0xA5, 0x95, 0xA2, 0x76, 0xC0, 0x6E, 0xC0, 0x07, 0x52, 0x66, 0x55,
+    0x9D, 0x9A, 0x9D, 0x8A, 0x52, 0x9D, 0x99, 0x9D, 0x9A, 0x43, 0x57, 0xC0, 0x66, 0x3D, 0x6F, 0x69,
+    0x7F, 0x6F, 0x7A, 0xA2, 0x88, 0xA4, 0x84, 0xA6, 0x84, 0xA4, 0x76, 0xFF, 0x9C, 0xB2, 0x65, 0xC0,
+    0x1C, 0xC0, 0x65, 0x56, 0xC0, 0x6E, 0x10, 0x66, 0x08, 0x65, 0xC0, 0x5A, 0xC2, 0x34, 0xC1, 0x55,
+    0xC1, 0x39, 0x6E, 0x6B, 0x0D, 0x12, 0x6B, 0xC1, 0x12, 0xC0, 0x0D, 0xC0, 0x05, 0x3E, 0x39, 0x56,
+    0x25, 0xC2, 0x65, 0xA2, 0x97, 0xFF, 0xE6, 0x6E, 0x9B, 0xA0, 0x99, 0xAA, 0xFF, 0xC4, 0xEA, 0x9F,
+    0x7F, 0x9A, 0x7A, 0xA2, 0x88, 0x95, 0x98, 0x51, 0xAF, 0x99, 0x9D, 0xA7, 0x9B, 0x96, 0x9F, 0xA5,
+    0x9F, 0x96, 0xA2, 0x75, 0xA7, 0x88, 0xA5, 0x8F, 0xA4, 0x7E, 0x4A, 0x9D, 0x89, 0x3F, 0x41, 0xA8,
+    0x89, 0xA9, 0xA8, 0x9F, 0xA5, 0x94, 0xC1, 0x9D, 0xC5, 0x7D, 0x7B, 0x51, 0x6E, 0xA2, 0x88, 0x6E,
+    0x6B, 0x5A, 0xA5, 0x66, 0xA5, 0x87, 0xA2, 0x68, 0xA4, 0x79, 0xA3, 0x7B, 0xA4, 0x7C, 0xA5, 0x6F,
+    0xA1, 0x8B, 0xC0, 0x09, 0x9C, 0x76, 0x98, 0x98, 0x8E, 0x8B, 0x1E, 0xC0, 0x6B, 0xC0, 0x6E, 0xC0,
+    0x39, 0xC2, 0x66, 0xA2, 0x77, 0x12, 0x7F, 0x2D, 0xA3, 0x98, 0xA4, 0x88, 0xA3, 0x99, 0xC0, 0x6E,
+    0xC0, 0x69, 0x58, 0x9C, 0x98, 0x2B, 0x9F, 0x86, 0x65, 0x55, 0x51, 0x50, 0x64, 0x6E, 0xC0, 0x7E,
+    0xA3, 0x88, 0xA3, 0x98, 0xA4, 0x87, 0xA2, 0x89, 0x7F, 0x6B, 0x7E, 0xC1, 0x66, 0x6B, 0x53, 0x9C,
+    0x8A, 0x9C, 0x8B, 0x9D, 0x8A, 0x9D, 0x8A, 0xC1, 0x39, 0x6F, 0x7A, 0xC0, 0x6E, 0x21, 0x2D, 0xC1,
+    0x6E, 0xC0, 0x2D, 0xC6, 0x66, 0x2D, 0x7F, 0x6E, 0x7F, 0xA2, 0x77, 0x7F, 0xA2, 0x88, 0x7F, 0x6F,
+    0x7E, 0x6E, 0xC0, 0x20, 0xC3, 0x18, 0x0C, 0x56, 0xC0, 0x29, 0x10, 0x56, 0x10, 0xC3, 0x6E, 0xC0,
+    0x7F, 0xC5, 0x15, 0x10, 0x5A, 0x78, 0xA5, 0xB4, 0x9C, 0xD6, 0x9D, 0x9A, 0x9C, 0x5A, 0x87, 0x7A,
+    0xA8, 0x78, 0xB4, 0x88, 0x8B, 0x99, 0xA8, 0x89, 0xAD, 0x99, 0x5A, 0x9C, 0x88, 0xA8, 0x79, 0x3B,
+    0x7E, 0xC0, 0xA3, 0x98, 0x41, 0x1B, 0x3B, 0xA3, 0x98, 0xA3, 0x89, 0x65, 0x9B, 0x8A, 0xA3, 0xA8,
+    0xA0, 0x94, 0x9A, 0xB4, 0x9D, 0xB5, 0x9D, 0xA6, 0x60, 0xA2, 0x98, 0x6E, 0x5B, 0xC0, 0x5E, 0x6E,
+    0xA3, 0x69, 0xA2, 0x7A, 0xA3, 0x79, 0xA1, 0x7A, 0x9F, 0x8B, 0x4B, 0x9D, 0x8C, 0x9F, 0x69, 0x46,
+    0x9D, 0x79, 0x9C, 0x89, 0xA4, 0x88, 0xA3, 0x99, 0xC0, 0x64, 0x9C, 0x98, 0xA6, 0x98, 0xAB, 0xB9,
+    0xA5, 0x98, 0xA5, 0x88, 0x9A, 0x84, 0x95, 0x83, 0x68, 0xA3, 0x97, 0x7F, 0xA2, 0x88, 0x7F, 0x69,
+    0x9D, 0x8A, 0x9A, 0x8B, 0x96, 0x9E, 0x98, 0x7B, 0x57, 0x6B, 0xC3, 0x7A, 0x6E, 0x6B, 0xC2, 0x04,
+    0x38, 0xA4, 0x87, 0xAA, 0x84, 0xA4, 0x96, 0xA2, 0x86, 0x09, 0x51, 0x9D, 0x99, 0x42, 0x51, 0x62,
+    0x6B, 0x6E, 0x35, 0x56, 0xC0, 0x34, 0x6F, 0x6B, 0x6E, 0x55, 0x66, 0x56, 0x52, 0x66, 0x5A, 0xA0,
+    0x9A, 0x7E, 0x7D, 0xA6, 0x73, 0xA4, 0x86, 0xFF, 0x9C, 0xB2, 0xC1, 0x65, 0x66, 0x56, 0x69, 0xC0,
+    0x17, 0x6E, 0x17, 0x65, 0x5A, 0x66, 0x69, 0x08, 0x3C, 0x5A, 0x34, 0xC2, 0x55, 0xC0, 0x39, 0x05,
+    0xC1, 0x7E, 0x6E, 0x0D, 0xC4, 0x05, 0x39, 0xC0, 0x34, 0x25, 0xC1, 0x19, 0xC0, 0x69, 0xAF, 0xA1,
+    0xA1, 0xA1, 0x9D, 0x9C, 0xFF, 0x9B, 0xEB, 0x94, 0x6C, 0x41, 0xA4, 0x99, 0xA4, 0x87, 0xA5, 0x88,
+    0x9B, 0xA8, 0xA2, 0x88, 0xA8, 0x97, 0x9E, 0x96, 0x9E, 0xA6, 0x9E, 0x84, 0xA7, 0x77, 0xA4, 0x9D,
+    0xA2, 0x6C, 0x4A, 0x6F, 0xA3, 0xAA, 0xA2, 0x67, 0x6B, 0x9F, 0xA6, 0x98, 0xB2, 0x9B, 0xD4, 0xA0,
+    0xA7, 0x9D, 0x99, 0x65, 0x7F, 0xC1, 0x36, 0x6F, 0x6E, 0xA5, 0x66, 0xA4, 0x77, 0xA2, 0x77, 0xA2,
+    0x68, 0xA4, 0x7A, 0xA5, 0x8C, 0xA6, 0x5E, 0xA2, 0x7C, 0x6B, 0xC0, 0x9F, 0x86, 0x8D, 0x98, 0x93,
+    0x9A, 0xA1, 0x8B, 0x1E, 0xC0, 0x25, 0xC0, 0x2A, 0xC0, 0x6B, 0xC2, 0x7E, 0xA2, 0x78, 0xA2, 0x88,
+    0x7F, 0xA3, 0x88, 0xA4, 0x98, 0x7F, 0x31, 0x7A, 0x00, 0x6E, 0x68, 0x9D, 0x98, 0x9D, 0x86, 0x9F,
+    0x86, 0x55, 0x65, 0x50, 0x54, 0x55, 0x7A, 0x6E, 0x6E, 0xA2, 0x97, 0xA4, 0x87, 0xA4, 0x88, 0xA2,
+    0x89, 0x7F, 0x7F, 0x7A, 0x6E, 0x6F, 0x66, 0x15, 0x10, 0x53, 0x9D, 0x8B, 0x9C, 0x8B, 0x9B, 0x8B,
+    0x42, 0x66, 0x39, 0x6B, 0x7E, 0xC0, 0x6E, 0x1E, 0xC0, 0x6E, 0x2D, 0xC2, 0x66, 0xC0, 0x2D, 0xC0,
+    0x28, 0x2D, 0xC0, 0x28, 0x2D, 0x6E, 0x7B, 0xA2, 0x78, 0x7E, 0xA2, 0x88, 0x7F, 0x6F, 0x18, 0x7E,
+    0xC0, 0x6E, 0x20, 0xC1, 0x18, 0x69, 0x66, 0xC0, 0x04, 0xC0, 0x29, 0x9C, 0x89, 0x7E, 0xC5, 0x15,
+    0x7F, 0xC2, 0x15, 0xC2, 0x10, 0x01, 0x3C, 0x68, 0xA5, 0xB6, 0x76, 0x42, 0x97, 0x89, 0xA2, 0x79,
+    0x7F, 0x90, 0x87, 0xAE, 0x89, 0xA4, 0x88, 0xC0, 0x9A, 0x88, 0xAA, 0x88, 0x34, 0x61, 0xA2, 0x88,
+    0x6F, 0x34, 0x7B, 0xA3, 0x88, 0x03, 0x34, 0x03, 0x17, 0x79, 0x9B, 0xC4, 0x9A, 0xB3, 0x9E, 0xA6,
+    0x64, 0x76, 0xC0, 0x6E, 0xC0, 0x6E, 0xA2, 0x68, 0xA3, 0x78, 0xA3, 0x7A, 0xA4, 0x69, 0xA2, 0x79,
+    0xA2, 0x79, 0x5B, 0xA1, 0x8A, 0x9E, 0x8B, 0x9D, 0x6A, 0x9E, 0x69, 0x9E, 0x69, 0x99, 0x89, 0x9D,
+    0x89, 0xAA, 0x88, 0x65, 0x61, 0x7E, 0x9A, 0x98, 0xA5, 0xB9, 0xAC, 0x87, 0xA9, 0x99, 0xA3, 0x88,
+    0x98, 0x82, 0x96, 0x83, 0x6D, 0xA3, 0x99, 0xA2, 0x98, 0xA2, 0x77, 0x7A, 0x42, 0x9B, 0x9B, 0x98,
+    0x9D, 0x96, 0x8C, 0x9D, 0x7B, 0x6B, 0xC4, 0x7F, 0xC3, 0x6D, 0xA1, 0xA8, 0xA5, 0x88, 0xA6, 0x85,
+    0xA2, 0x96, 0x6E, 0x65, 0x50, 0x51, 0x5B, 0x0E, 0xA2, 0x88, 0xA2, 0x87, 0x6F, 0x7E, 0xC0, 0x6E,
+    0x6E, 0x7B, 0xC1, 0x08, 0xC0, 0x3B, 0x67, 0x52, 0x52, 0x52, 0x52, 0x54, 0xA3, 0x86, 0xA3, 0x96,
+    0xFF, 0x9C, 0xB2, 0xC1, 0x66, 0x69, 0x56, 0x66, 0xC0, 0x1C, 0x1F, 0x1C, 0x17, 0x65, 0x5A, 0xC1,
+    0x66, 0x39, 0xC0, 0x66, 0xC1, 0x55, 0xC0, 0x39, 0x6F, 0xC1, 0x7E, 0xC1, 0x5A, 0xC0, 0x0D, 0xC0,
+    0x05, 0x69, 0x39, 0xC0, 0x65, 0x25, 0xC1, 0x19, 0xC0, 0x55, 0xA7, 0xA4, 0xAD, 0xA2, 0x9F, 0x8C,
+    0xFF, 0x73, 0x6D, 0x9C, 0x7B, 0x9D, 0x87, 0xA8, 0x97, 0x9B, 0x98, 0x52, 0xA3, 0x98, 0x9D, 0x98,
+    0xA2, 0x87, 0xA1, 0xA7, 0xA6, 0xA7, 0xA5, 0xA5, 0x9F, 0x86, 0xA7, 0x8B, 0xA2, 0x6A, 0x9F, 0x7B,
+    0x7F, 0xA1, 0x9A, 0x37, 0x7C, 0x9E, 0xB3, 0x98, 0xC5, 0x9F, 0xA5, 0x61, 0x65, 0x56, 0x7A, 0x7F,
+    0xC0, 0x6F, 0x6E, 0xA2, 0x77, 0xA2, 0x66, 0xA3, 0x88, 0xA3, 0x78, 0xA2, 0x77, 0xA4, 0x7A, 0xA4,
+    0x7B, 0xA3, 0x6B, 0xA4, 0x6C, 0xA3, 0x8D, 0xA0, 0x8A, 0xC0, 0x9A, 0x97, 0x8A, 0x88, 0x9B, 0x89,
+    0xC1, 0x25, 0xC2, 0x6E, 0xC1, 0x25, 0x2A, 0x3E, 0xA2, 0x88, 0x6B, 0xA3, 0x98, 0xA5, 0x88, 0x7F,
+    0xC0, 0x66, 0xC0, 0x31, 0x6D, 0x9D, 0x98, 0x9D, 0x86, 0x9E, 0x85, 0x65, 0x59, 0x54, 0x51, 0x65,
+    0x7E, 0x6E, 0x6E, 0xA2, 0x97, 0xA4, 0x88, 0xA3, 0x98, 0xA3, 0x89, 0xA1, 0xA9, 0xA2, 0x88, 0x7F,
+    0x6E, 0x6E, 0xC0, 0x29, 0x65, 0x15, 0x53, 0x9D, 0x8B, 0x9B, 0x9B, 0x9B, 0x8C, 0x9D, 0x8B, 0xC0,
+    0x6B, 0x08, 0xC0, 0x6E, 0xA2, 0x78, 0xC1, 0x6F, 0x7A, 0xC0, 0x66, 0xC1, 0x2D, 0xC1, 0x32, 0xC0,
+    0x2D, 0xC1, 0x6F, 0x7E, 0x10, 0xA2, 0x78, 0x7E, 0xA2, 0x88, 0x11, 0x7F, 0xC1, 0x6E, 0x20, 0x56,
+    0x65, 0xC0, 0x66, 0x5A, 0x3D, 0xC0, 0x9D, 0x99, 0x9D, 0x89, 0x10, 0xC4, 0x6E, 0xC0, 0x24, 0xC2,
+    0x15, 0xC1, 0x10, 0x01, 0x66, 0xC0, 0x54, 0xA6, 0x98, 0x9F, 0xB9, 0x99, 0x88, 0x6E, 0x9B, 0x8A,
+    0x9C, 0x87, 0x9B, 0x99, 0xA6, 0x88, 0xAB, 0x88, 0x9B, 0x99, 0xA3, 0x99, 0xA4, 0x77, 0x9D, 0x99,
+    0xA5, 0x88, 0xA2, 0x88, 0x66, 0x6F, 0x7F, 0x59, 0x62, 0x08, 0x7F, 0x3C, 0x9E, 0xA6, 0x9A, 0xC3,
+    0x9D, 0xB4, 0x7D, 0x75, 0x65, 0x0A, 0xC0, 0x55, 0x0F, 0xA2, 0x68, 0xA3, 0x78, 0xA3, 0x79, 0xA4,
+    0x7A, 0xA2, 0x69, 0x5F, 0x6B, 0xA0, 0x8A, 0x57, 0xA0, 0x7A, 0xA0, 0x59, 0x9E, 0x59, 0x9C, 0x79,
+    0x98, 0x89, 0x7E, 0xA6, 0x88, 0x66, 0xA1, 0xA9, 0xA7, 0x97, 0x9A, 0x98, 0xA6, 0x98, 0xA8, 0x88,
+    0xA7, 0x99, 0xA0, 0x85, 0x92, 0x82, 0x9C, 0x84, 0xA4, 0x88, 0xA2, 0x87, 0x7F, 0x6E, 0x67, 0x9C,
+    0x89, 0x99, 0x9D, 0x95, 0x9E, 0x9B, 0x7A, 0xA1, 0x9A, 0x56, 0xC2, 0x04, 0x6B, 0xC0, 0x04, 0xA2,
+    0x89, 0xA3, 0x98, 0xA2, 0x87, 0xA2, 0x87, 0xA3, 0x98, 0x7C, 0x69, 0xC0, 0x55, 0x61, 0xA2, 0x77,
+    0x22, 0xA3, 0x97, 0xA3, 0x88, 0xA2, 0x76, 0xC1, 0x7E, 0x6E, 0xC0, 0x7A, 0xC0, 0x66, 0xC0, 0x1B,
+    0x67, 0x6B, 0x66, 0x52, 0x67, 0x9D, 0x8A, 0x9C, 0x88, 0x0E, 0xA2, 0x76, 0xFF, 0xA4, 0xD2, 0xC0,
+    0x66, 0x30, 0x66, 0x65, 0xC4, 0x5A, 0x65, 0x66, 0x08, 0xC0, 0x65, 0xC0, 0x34, 0xC2, 0x65, 0x5A,
+    0x34, 0xA2, 0x77, 0x6B, 0xC0, 0x08, 0x6E, 0x5A, 0x05, 0xC2, 0x3E, 0x66, 0xC1, 0x25, 0xC2, 0x65,
+    0xC0, 0x69, 0x59, 0xAF, 0xA7, 0xA5, 0x89, 0x88, 0x7E, 0x9D, 0x8A, 0x69, 0xA4, 0x97, 0x99, 0x89,
+    0x69, 0x7A, 0x9C, 0x88, 0x9B, 0x98, 0xA9, 0x98, 0xA9, 0x97, 0xA8, 0xB6, 0xA0, 0x85, 0x7E, 0xA4,
+    0x6A, 0xA3, 0x7B, 0xC0, 0x61, 0x55, 0x9E, 0xA3, 0x9C, 0xB4, 0x9F, 0xA6, 0x70, 0xC0, 0x67, 0x69,
+    0x7F, 0x7A, 0x7F, 0x5E, 0x6F, 0xA2, 0x77, 0x6C, 0xA3, 0x78, 0xA3, 0x88, 0x5E, 0xA3, 0x8A, 0xA5,
+    0x7A, 0xA1, 0x8A, 0xA3, 0x6A, 0xA4, 0x7F, 0xA2, 0x7C, 0xC0, 0x2A, 0x99, 0x97, 0x89, 0x89, 0x9C,
+    0x9A, 0xC3, 0x6E, 0xC3, 0x5A, 0x7E, 0x05, 0xC0, 0xA3, 0x98, 0xA5, 0x88, 0xA2, 0x99, 0x6E, 0x2C,
+    0xC0, 0x69, 0x69, 0x40, 0x9C, 0x86, 0x9F, 0x85, 0x69, 0xC0, 0x54, 0x51, 0x65, 0x7E, 0x6E, 0x6E,
+    0xA2, 0x98, 0xA3, 0x98, 0xA4, 0x77, 0xA2, 0x98, 0xA2, 0x99, 0xA2, 0x88, 0xA2, 0x87, 0x6F, 0x7E,
+    0xC0, 0x65, 0x5A, 0x63, 0x51, 0x9D, 0x8A, 0x9D, 0x9C, 0x9B, 0x8C, 0x9B, 0x8C, 0x39, 0x6B, 0xC0,
+    0x39, 0x05, 0xA3, 0x88, 0xC2, 0x21, 0xC0, 0x6B, 0xC1, 0x2D, 0xC1, 0x6E, 0x2D, 0x28, 0x2D, 0xC0,
+    0x6F, 0x7E, 0x6E, 0x7F, 0x7F, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0x6B, 0xC0, 0x7E, 0xC0, 0x18, 0x0C,
+    0x56, 0xC0, 0x38, 0x3D, 0x38, 0x24, 0x51, 0xC6, 0x15, 0x24, 0xC1, 0x15, 0xC2, 0x06, 0x62, 0x66,
+    0x2B, 0x5D, 0xAC, 0x98, 0x9D, 0xA9, 0x99, 0x99, 0x9A, 0x87, 0x99, 0x89, 0x9B, 0x88, 0x9B, 0x89,
+    0x51, 0x19, 0xA2, 0x98, 0x9D, 0x99, 0xAD, 0x88, 0xA2, 0x89, 0x7E, 0x5A, 0x7F, 0xA3, 0x88, 0x66,
+    0x03, 0xC2, 0xA0, 0xA6, 0x9E, 0xA4, 0x9B, 0xB4, 0xA0, 0xA5, 0x9D, 0xA8, 0x9D, 0x98, 0xC0, 0x7F,
+    0xC0, 0x3B, 0x0A, 0xA2, 0x67, 0xA3, 0x79, 0xA4, 0x68, 0xA5, 0x7A, 0xA2, 0x79, 0x5B, 0xA1, 0x7A,
+    0x6B, 0x9F, 0x8B, 0x57, 0x9F, 0x69, 0x9D, 0x6A, 0x9C, 0x69, 0x9B, 0x99, 0x6F, 0xA7, 0x98, 0x66,
+    0x7A, 0xA7, 0x98, 0xAA, 0x98, 0x76, 0x6E, 0xA4, 0x97, 0xC0, 0x99, 0x84, 0x94, 0x83, 0xA2, 0x86,
+    0xA4, 0x97, 0x6E, 0x7F, 0x6B, 0x9D, 0x99, 0x9A, 0x8C, 0x96, 0x8D, 0x98, 0x8C, 0x5B, 0x7F, 0x69,
+    0xC1, 0x0B, 0xC1, 0xA4, 0x97, 0xA4, 0x88, 0xA2, 0x98, 0x6D, 0x6F, 0x7E, 0x68, 0xC0, 0x6E, 0x69,
+    0x55, 0x7E, 0xA3, 0x87, 0xA3, 0x87, 0x7D, 0xA2, 0x76, 0x7E, 0xC0, 0x6F, 0x79, 0x7A, 0xC4, 0x66,
+    0x6B, 0x56, 0x66, 0x9D, 0x8A, 0x9C, 0x8B, 0x51, 0x6D, 0x6D, 0xFF, 0xA4, 0xF3, 0x66, 0x38, 0x66,
+    0x2B, 0x69, 0x66, 0xC3, 0x5A, 0x17, 0x65, 0x5A, 0x66, 0x69, 0x66, 0x5A, 0xC2, 0x65, 0xC0, 0x34,
+    0xA2, 0x77, 0x05, 0xC4, 0x3E, 0xC3, 0x66, 0x56, 0x61, 0x69, 0x6F, 0xC0, 0x19, 0x69, 0x19, 0x52,
+    0xA5, 0x86, 0x3E, 0x92, 0x8C, 0x55, 0xA2, 0x87, 0x61, 0x6F, 0x55, 0x07, 0x9D, 0x98, 0x9B, 0x98,
+    0x9C, 0x88, 0xA3, 0x98, 0xB9, 0xA7, 0xA8, 0x95, 0x50, 0xA1, 0x8A, 0x5B, 0xA2, 0x88, 0x7C, 0x9D,
+    0xA6, 0x9D, 0xB4, 0xA0, 0x94, 0x9F, 0xB8, 0x9D, 0x99, 0x66, 0x6B, 0x05, 0x66, 0x76, 0x5A, 0x00,
+    0x05, 0xA2, 0x77, 0xA3, 0x87, 0xA2, 0x78, 0xA3, 0x78, 0xA2, 0x78, 0xA2, 0x79, 0xA2, 0x79, 0xA3,
+    0x99, 0x5F, 0xA4, 0x7E, 0xA4, 0x6D, 0xA1, 0x8B, 0xC0, 0x69, 0x88, 0x98, 0x20, 0xC8, 0x5A, 0xC0,
+    0xA3, 0x88, 0x7E, 0x7F, 0xA3, 0x89, 0xA3, 0x98, 0xA2, 0x88, 0xC1, 0x66, 0x54, 0x9E, 0x86, 0x9D,
+    0x87, 0xA0, 0x85, 0x6E, 0x69, 0x65, 0x50, 0x55, 0x7E, 0x6E, 0x6E, 0xA2, 0x98, 0xA3, 0x98, 0xA3,
+    0x89, 0xA2, 0x97, 0xA2, 0x88, 0xA3, 0x98, 0xA2, 0x87, 0x6F, 0x7E, 0xC0, 0x2A, 0x27, 0xC0, 0x9D,
+    0x9B, 0x9D, 0x9A, 0x9D, 0x9A, 0x9C, 0x7C, 0x9A, 0x7B, 0x39, 0x52, 0x34, 0xA6, 0x88, 0x1D, 0x99,
+    0x99, 0x5E, 0x7A, 0x6B, 0x21, 0x1E, 0x28, 0x1E, 0x62, 0x1E, 0x2D, 0xC2, 0x28, 0x2D, 0x6E, 0x7B,
+    0x6E, 0xC0, 0x7F, 0x6E, 0x7F, 0x3D, 0x7F, 0x6E, 0xC1, 0x6B, 0x0C, 0x66, 0x55, 0xC3, 0x24, 0x10,
+    0xC2, 0x15, 0x10, 0xC2, 0x15, 0x24, 0xC0, 0x15, 0xC1, 0x10, 0x01, 0x62, 0x65, 0x1C, 0x09, 0xAC,
+    0xA8, 0x99, 0x98, 0xC0, 0x66, 0x9C, 0x78, 0x97, 0x98, 0x96, 0x78, 0x99, 0x89, 0x55, 0xAA, 0x88,
+    0xAC, 0x99, 0xA7, 0x98, 0x0F, 0x23, 0x6E, 0xA2, 0x89, 0xA2, 0x88, 0xC0, 0x03, 0x17, 0xC0, 0xA2,
+    0xA6, 0x9F, 0x94, 0x99, 0xB5, 0x9E, 0xA5, 0x9D, 0xA7, 0x9D, 0x98, 0x00, 0xC0, 0x7A, 0x00, 0xC0,
+    0x7F, 0xA2, 0x77, 0xA3, 0x69, 0xA4, 0x79, 0xA4, 0x69, 0xA1, 0x7A, 0xA2, 0x79, 0xA2, 0x79, 0x5B,
+    0x9F, 0x8B, 0x57, 0x9B, 0x69, 0x98, 0x6A, 0x46, 0x51, 0xA3, 0x99, 0xA5, 0x88, 0xA5, 0x9A, 0x9D,
+    0x98, 0x99, 0xA9, 0xAD, 0x98, 0xAB, 0xA9, 0xA2, 0x86, 0x9B, 0x98, 0xA4, 0x99, 0x6D, 0x96, 0x83,
+    0x96, 0x84, 0xA6, 0x85, 0x7F, 0x7F, 0x6F, 0x52, 0x9B, 0x9B, 0x96, 0x8E, 0x97, 0x8C, 0x57, 0x7F,
+    0x69, 0xC1, 0x0B, 0xC0, 0xA3, 0x98, 0xA6, 0x97, 0xA2, 0x98, 0x55, 0xC0, 0x7E, 0x6E, 0xA3, 0x88,
+    0xA7, 0x88, 0xA3, 0x99, 0x6D, 0xC1, 0x6E, 0xA2, 0x86, 0x65, 0x40, 0x9D, 0x97, 0x9F, 0x86, 0x6D,
+    0x7B, 0x7F, 0x69, 0x19, 0x1C, 0xC1, 0x23, 0xC0, 0x66, 0x55, 0x9D, 0x9A, 0x9A, 0x8A, 0x57, 0xA2,
+    0x86, 0x6E, 0xFF, 0xA4, 0xD3, 0x69, 0xC0, 0x66, 0x2B, 0x69, 0x1F, 0xC3, 0x56, 0x69, 0xC0, 0x66,
+    0x55, 0xC0, 0x66, 0x5A, 0xC5, 0x6E, 0x3E, 0xC8, 0x39, 0x5A, 0x25, 0x65, 0xC2, 0x66, 0x19, 0xC0,
+    0x52, 0xA4, 0x87, 0x9C, 0x7A, 0x9D, 0x8A, 0x69, 0xC0, 0x99, 0x99, 0xA2, 0x78, 0xA2, 0x88, 0x7E,
+    0x9D, 0xA9, 0x98, 0x87, 0xA2, 0x88, 0xA3, 0x98, 0xAD, 0x97, 0xA2, 0x87, 0xAD, 0xA8, 0x6B, 0x55,
+    0xA1, 0x95, 0xA1, 0xA6, 0x9D, 0xA5, 0xA1, 0x94, 0x74, 0x9D, 0xA9, 0xC0, 0x9D, 0x99, 0xC0, 0x7F,
+    0x6B, 0x9D, 0x99, 0x05, 0x6E, 0xA3, 0x88, 0xA2, 0x78, 0x6D, 0x3E, 0xA2, 0x78, 0xA3, 0x79, 0xA2,
+    0x78, 0x6B, 0xC0, 0xA4, 0x78, 0xA4, 0x7B, 0xA3, 0x7D, 0xA3, 0x7C, 0xA0, 0x8A, 0x9D, 0x98, 0x8A,
+    0x89, 0x97, 0x9B, 0x6E, 0xC0, 0x20, 0xC3, 0x5A, 0xC1, 0x66, 0xA2, 0x77, 0x7F, 0x7F, 0xA2, 0x87,
+    0xA3, 0x89, 0xA2, 0x98, 0xA2, 0x77, 0x09, 0x55, 0x50, 0x50, 0xA0, 0x85, 0x69, 0x6D, 0x69, 0x69,
+    0x50, 0x51, 0x7E, 0xC0, 0x6E, 0xA2, 0x98, 0xA4, 0x78, 0xA3, 0x98, 0x7E, 0xA2, 0x98, 0xA3, 0x88,
+    0xA2, 0x87, 0x7E, 0x6F, 0x7E, 0x67, 0x27, 0x66, 0x9E, 0x8B, 0x9C, 0x99, 0x42, 0x9D, 0x8C, 0x99,
+    0x9C, 0x9D, 0x8A, 0xA8, 0x89, 0xAD, 0x89, 0xA9, 0x88, 0x9A, 0x98, 0x8C, 0x88, 0x5A, 0x21, 0xC1,
+    0x19, 0x65, 0xA4, 0x88, 0xA7, 0x89, 0x9A, 0x88, 0x9D, 0x88, 0x7F, 0xC1, 0x66, 0x2D, 0x6E, 0x6B,
+    0x7A, 0x01, 0x6E, 0x7B, 0x6F, 0xA3, 0x98, 0xA2, 0x88, 0x6E, 0x6B, 0xC0, 0x11, 0x0C, 0x56, 0x38,
+    0xC2, 0x66, 0x40, 0x52, 0x10, 0xC0, 0x15, 0xC2, 0x06, 0xC0, 0x10, 0x15, 0xC3, 0x09, 0x3C, 0x65,
+    0x51, 0x0D, 0xAC, 0x97, 0xA6, 0x98, 0x99, 0x99, 0x6E, 0x3F, 0x66, 0x40, 0x9A, 0x89, 0x96, 0x78,
+    0x9C, 0x78, 0x97, 0x98, 0xA8, 0x88, 0xB2, 0x99, 0xA5, 0x98, 0x6F, 0xC0, 0xA2, 0x88, 0xC1, 0x7A,
+    0x6E, 0x78, 0x9E, 0x94, 0x9D, 0xB4, 0x9F, 0x95, 0x64, 0x9D, 0xA8, 0x7A, 0x66, 0x9D, 0x99, 0x66,
+    0x7F, 0xC0, 0xA2, 0x87, 0xA2, 0x79, 0xA4, 0x67, 0xA2, 0x7A, 0xA2, 0x59, 0xA2, 0x79, 0xA3, 0x8A,
+    0xA2, 0x69, 0xA0, 0x7A, 0x67, 0x47, 0x9B, 0x7A, 0x9A, 0x59, 0x9B, 0x79, 0x7F, 0xC0, 0xA2, 0x88,
+    0xA2, 0x98, 0x51, 0x7F, 0xA1, 0xA8, 0xAB, 0x98, 0xA6, 0x98, 0x98, 0x87, 0xA2, 0x98, 0xAA, 0x88,
+    0xA2, 0x87, 0x91, 0x82, 0x9D, 0x94, 0xA4, 0x87, 0x7F, 0xA1, 0x9A, 0x55, 0x9C, 0x8B, 0x97, 0x9E,
+    0x97, 0x8C, 0x9D, 0x8A, 0x7B, 0x6E, 0xC1, 0x56, 0xA2, 0x98, 0xA4, 0x88, 0xA3, 0xA7, 0xA3, 0x98,
+    0x66, 0x55, 0xA4, 0x88, 0xA6, 0x77, 0xA6, 0x88, 0xA4, 0x88, 0x6F, 0x7E, 0xC1, 0xA2, 0x78, 0xA2,
+    0x88, 0xC0, 0x65, 0x50, 0x9C, 0x85, 0x9B, 0x86, 0x9B, 0x99, 0x65, 0x6E, 0x6F, 0x6E, 0x01, 0xC0,
+    0x6F, 0x7B, 0x65, 0x3C, 0x51, 0x9C, 0x99, 0x56, 0xA3, 0x87, 0xA3, 0x88, 0xFF, 0xA4, 0xD2, 0xC0,
+    0x66, 0xC0, 0x55, 0xC0, 0x66, 0xC3, 0x5A, 0x69, 0x66, 0xC0, 0x56, 0x65, 0xC0, 0x5A, 0x66, 0xC4,
+    0x39, 0xC0, 0x6E, 0xC0, 0x6E, 0xC0, 0x3E, 0xC2, 0x55, 0x66, 0x55, 0x66, 0x66, 0xC0, 0x7A, 0xC2,
+    0x6E, 0x11, 0xA3, 0x89, 0x9D, 0x9A, 0x9B, 0x89, 0xA2, 0x88, 0x2F, 0x9A, 0x88, 0xC0, 0x6E, 0x2F,
+    0x9C, 0x97, 0x9B, 0x88, 0x03, 0x3F, 0x9A, 0x86, 0x8E, 0x89, 0xBA, 0xA8, 0xB4, 0x97, 0x9E, 0x73,
+    0xA1, 0x95, 0xA0, 0xA6, 0x9F, 0xA6, 0x64, 0x69, 0x9C, 0x98, 0x60, 0x7F, 0xC0, 0x20, 0xC0, 0x6B,
+    0x6E, 0xC0, 0xA2, 0x88, 0x6E, 0x6E, 0xA2, 0x78, 0x6F, 0xA2, 0x77, 0xA2, 0x79, 0x6B, 0x55, 0xA3,
+    0x88, 0xA4, 0x8A, 0xA2, 0x7B, 0xA3, 0x7D, 0xA2, 0x7C, 0x66, 0x8B, 0x98, 0x94, 0x8A, 0x6F, 0xC0,
+    0x66, 0xC3, 0x5A, 0xC0, 0x66, 0xC1, 0x1D, 0xA2, 0x88, 0x6E, 0x7F, 0xA2, 0x88, 0x6E, 0x19, 0x05,
+    0x64, 0x7D, 0x6C, 0x7D, 0x6D, 0x6D, 0x69, 0x69, 0x9D, 0x99, 0x59, 0x66, 0x7E, 0x19, 0xA3, 0x98,
+    0x0E, 0x7E, 0xA2, 0x98, 0xA3, 0x88, 0xA2, 0x87, 0x6F, 0x7D, 0xC0, 0x22, 0x67, 0xA3, 0x7C, 0xA4,
+    0x9C, 0x55, 0x99, 0x99, 0x93, 0x8A, 0xA0, 0x8B, 0xAE, 0x88, 0xAC, 0x79, 0xC0, 0x61, 0x93, 0x88,
+    0x05, 0xA2, 0x88, 0x7E, 0xC0, 0x51, 0x21, 0xAA, 0x88, 0xAD, 0x89, 0x31, 0x8D, 0x99, 0x19, 0xA2,
+    0x88, 0xC1, 0x66, 0x2D, 0x6E, 0x6B, 0xC0, 0x7E, 0x7F, 0x6E, 0x7F, 0x38, 0xA2, 0x88, 0x6E, 0x6B,
+    0xC0, 0x11, 0x56, 0x65, 0x38, 0xC1, 0x5A, 0x24, 0x10, 0x01, 0x7E, 0xC1, 0x6E, 0x15, 0x0E, 0x56,
+    0x01, 0x06, 0x01, 0x06, 0xC0, 0x09, 0xC0, 0x51, 0x28, 0xC0, 0x60, 0x59, 0xB0, 0x98, 0x7A, 0x9A,
+    0x98, 0xC1, 0x51, 0x56, 0x5A, 0x9A, 0x79, 0x9D, 0x88, 0x98, 0x88, 0x97, 0x98, 0xAF, 0x99, 0xB0,
+    0x98, 0xC0, 0xA2, 0x77, 0xC0, 0xA3, 0x99, 0x2C, 0x65, 0x9F, 0x96, 0xA0, 0x94, 0x9D, 0xA7, 0x9E,
+    0x95, 0x64, 0x64, 0x70, 0xC0, 0x6F, 0x66, 0x62, 0x61, 0x6E, 0x25, 0x6F, 0xA3, 0x78, 0xA3, 0x7A,
+    0xA2, 0x69, 0xA3, 0x8A, 0xA1, 0x7A, 0xA0, 0x7A, 0xA1, 0x8A, 0xA0, 0x7A, 0x9E, 0x69, 0x9C, 0x69,
+    0x9A, 0x69, 0x9B, 0x89, 0xA3, 0x88, 0xA3, 0x99, 0x51, 0x65, 0x9A, 0x88, 0xA4, 0x88, 0xA8, 0x98,
+    0x7A, 0x9D, 0xA8, 0xA2, 0x98, 0xAA, 0x98, 0xAA, 0x77, 0xA1, 0x9A, 0x9A, 0x83, 0x92, 0x81, 0xA3,
+    0x97, 0xA2, 0x89, 0x6E, 0x67, 0x9C, 0x8B, 0x99, 0x9D, 0x99, 0x8B, 0x9C, 0x8A, 0x57, 0x04, 0xC1,
+    0x6F, 0xA2, 0x98, 0xA2, 0x87, 0xA1, 0xA8, 0xA3, 0x98, 0x7E, 0xA4, 0x78, 0xA7, 0x98, 0xA4, 0x88,
+    0xA2, 0x78, 0xA2, 0x87, 0x6B, 0x7E, 0x6F, 0x6E, 0x6F, 0xA2, 0x88, 0x6F, 0xC1, 0x69, 0x60, 0x9A,
+    0x87, 0x96, 0x88, 0x98, 0x88, 0x51, 0x08, 0x6B, 0xC0, 0x6F, 0xC0, 0x69, 0x7A, 0x7E, 0x69, 0x55,
+    0xA4, 0x86, 0xA3, 0x88, 0xFF, 0xA4, 0xB2, 0xC1, 0x5A, 0x65, 0xC0, 0x66, 0xC3, 0x1C, 0x69, 0x66,
+    0x66, 0x59, 0x66, 0xC0, 0x39, 0xC0, 0x66, 0xC3, 0x5A, 0x6E, 0xC0, 0x7E, 0xC2, 0x39, 0x59, 0xC0,
+    0x66, 0x55, 0x66, 0x66, 0x69, 0xC0, 0x11, 0x7A, 0xC0, 0x0A, 0x11, 0xC0, 0x7F, 0x04, 0x98, 0x79,
+    0x7A, 0x41, 0x51, 0xA3, 0x98, 0xC0, 0xA4, 0x88, 0x3B, 0xC0, 0x6E, 0xA5, 0x98, 0x8F, 0x98, 0xA4,
+    0x88, 0xAC, 0x88, 0xAB, 0xB6, 0xAC, 0x73, 0xA1, 0xA3, 0xA1, 0xA8, 0x65, 0x50, 0x9D, 0xA8, 0x79,
+    0x69, 0x61, 0x56, 0x6F, 0x7F, 0x05, 0x00, 0x05, 0x7F, 0x6E, 0x5E, 0xC0, 0x6B, 0xA2, 0x77, 0xA2,
+    0x78, 0x6F, 0x5A, 0x6E, 0xA2, 0x89, 0xA3, 0x8B, 0xA4, 0x7C, 0xA3, 0x7E, 0xA0, 0x8B, 0x92, 0x96,
+    0x8C, 0x8A, 0x6F, 0xC0, 0x20, 0xC3, 0x5A, 0xC0, 0x66, 0xC3, 0xA2, 0x77, 0xC0, 0x6B, 0x7E, 0xC0,
+    0x1D, 0x6D, 0xA3, 0x96, 0xA2, 0x86, 0x79, 0x6D, 0xA2, 0x86, 0xA2, 0x87, 0x69, 0x51, 0x56, 0x61,
+    0xC0, 0x21, 0x35, 0xA2, 0x88, 0xA2, 0x87, 0xA2, 0x97, 0xA2, 0x88, 0x6F, 0xC0, 0x6F, 0xA3, 0x9A,
+    0xA1, 0x9B, 0xA2, 0x7B, 0xA6, 0x8C, 0xA1, 0x8B, 0xC0, 0x94, 0x97, 0x97, 0x98, 0xB0, 0x79, 0x31,
+    0xC1, 0x98, 0x88, 0x8D, 0x98, 0x51, 0x6F, 0xC0, 0x61, 0xA8, 0x88, 0xAF, 0x88, 0x31, 0xC0, 0x9D,
+    0x99, 0x8D, 0x88, 0x19, 0xA2, 0x88, 0xC1, 0x56, 0x7A, 0x2D, 0x7F, 0xC0, 0xA2, 0x77, 0xA2, 0x99,
+    0x6E, 0xC0, 0x7F, 0x6F, 0xA2, 0x87, 0x6B, 0x11, 0x56, 0x04, 0xC0, 0x69, 0x38, 0xC0, 0x24, 0x51,
+    0x55, 0xC0, 0x10, 0x69, 0x06, 0x09, 0xC0, 0x06, 0x01, 0xC1, 0x69, 0xC2, 0x66, 0x28, 0x1C, 0xC0,
+    0x08, 0xA3, 0x87, 0xB0, 0xA8, 0x9D, 0x98, 0x9B, 0x99, 0x65, 0x5A, 0x66, 0x56, 0x56, 0x9D, 0x89,
+    0x1C, 0x34, 0x98, 0x88, 0x65, 0xB2, 0x88, 0xA8, 0x87, 0xA3, 0x97, 0xC0, 0x65, 0x7F, 0x68, 0x9F,
+    0x95, 0xA0, 0x95, 0x60, 0x60, 0x60, 0x54, 0x7A, 0x61, 0x65, 0xC0, 0x66, 0x66, 0x6F, 0xA2, 0x88,
+    0x56, 0xA2, 0x68, 0xA4, 0x7A, 0xA4, 0x79, 0xA2, 0x6A, 0x57, 0xA0, 0x8A, 0x5F, 0x47, 0x9C, 0x79,
+    0x9A, 0x69, 0x9C, 0x69, 0x6B, 0xA2, 0x87, 0xA2, 0x89, 0x37, 0x9A, 0x88, 0x50, 0xA4, 0x89, 0xA3,
+    0xA8, 0xA5, 0x99, 0x74, 0xA3, 0xA9, 0xAD, 0x98, 0xA3, 0x98, 0x67, 0xA2, 0x76, 0x91, 0x93, 0x9A,
+    0x83, 0xA3, 0x88, 0xA2, 0x89, 0x67, 0x9C, 0x8B, 0x9A, 0x8C, 0x9A, 0x8B, 0x9C, 0x89, 0x6B, 0xC1,
+    0x6B, 0xA3, 0x97, 0x7F, 0x7A, 0x69, 0x7E, 0xA4, 0x88, 0xA7, 0x88, 0xA6, 0x87, 0xA4, 0x87, 0x69,
+    0x5A, 0x69, 0x51, 0xC1, 0xA2, 0x79, 0xA2, 0x88, 0xA2, 0x89, 0xA3, 0x99, 0xA2, 0x89, 0x6F, 0xC0,
+    0x17, 0x37, 0x98, 0x88, 0x93, 0x89, 0x98, 0x88, 0x66, 0x66, 0xA2, 0x78, 0xA2, 0x78, 0x7A, 0x7E,
+    0xA6, 0x87, 0xA2, 0x96, 0x69, 0xA2, 0x86, 0x6E, 0xFF, 0x9C, 0xB2, 0xC0, 0x65, 0xC1, 0x66, 0xC3,
+    0x5A, 0x65, 0xC0, 0x66, 0x59, 0x66, 0x5A, 0xC1, 0x66, 0xC4, 0x5A, 0xC0, 0x6E, 0xC1, 0x69, 0xC0,
+    0x66, 0xC1, 0x55, 0x66, 0x66, 0x69, 0x66, 0x0A, 0xC1, 0x05, 0x7F, 0x11, 0x3D, 0xA4, 0x88, 0x04,
+    0x94, 0x89, 0x5A, 0x69, 0x66, 0x55, 0x09, 0xA4, 0x98, 0xC0, 0xA3, 0x89, 0x61, 0x98, 0x78, 0x99,
+    0x98, 0xB5, 0x99, 0x9B, 0x88, 0x9B, 0xA6, 0xBA, 0x93, 0xA5, 0x92, 0xA1, 0xA6, 0x7B, 0xC0, 0x60,
+    0x50, 0x65, 0x7F, 0x51, 0x6F, 0x0A, 0xC0, 0x6F, 0xC1, 0xA2, 0x88, 0x22, 0xC0, 0x5A, 0x7E, 0xA2,
+    0x78, 0xA2, 0x78, 0x6F, 0x6E, 0xC0, 0xA4, 0x7A, 0xA3, 0x8C, 0xA2, 0x7C, 0xA2, 0x7C, 0x9B, 0x99,
+    0x01, 0x20, 0x25, 0x20, 0xC3, 0x5A, 0xC0, 0x66, 0xC3, 0x5A, 0x65, 0x66, 0x09, 0x6E, 0xC0, 0x7D,
+    0xA3, 0x97, 0xA2, 0x85, 0x7D, 0xA2, 0x87, 0xA3, 0x87, 0xA2, 0x87, 0x69, 0xC0, 0x65, 0x9D, 0x99,
+    0x56, 0x6E, 0x7F, 0x10, 0xA2, 0x87, 0xA2, 0x86, 0xA0, 0x8A, 0xA5, 0x9A, 0xA2, 0x89, 0xA2, 0x8A,
+    0xA6, 0x7C, 0xA1, 0x9A, 0xA1, 0x8A, 0x6B, 0x62, 0x9C, 0x87, 0x66, 0x27, 0x31, 0x65, 0x56, 0x9B,
+    0x98, 0x94, 0x87, 0x9D, 0x89, 0x9C, 0x99, 0x9C, 0x78, 0xA3, 0x98, 0xAD, 0x89, 0xAD, 0x99, 0x31,
+    0xC0, 0x98, 0x98, 0x8F, 0x88, 0x9C, 0x89, 0xA2, 0x88, 0xC1, 0x5A, 0x65, 0x28, 0x6E, 0x6F, 0x7E,
+    0xA2, 0x88, 0xA2, 0x88, 0xC1, 0x6F, 0x7A, 0xC0, 0x6E, 0x6B, 0xC2, 0x3D, 0x38, 0x51, 0x51, 0x01,
+    0xC1, 0x7E, 0xC2, 0x5A, 0x01, 0x69, 0xC1, 0x66, 0x5A, 0xC0, 0x2D, 0x21, 0x14, 0x69, 0x66, 0x3C,
+    0xA6, 0x87, 0xAF, 0xA8, 0x99, 0xA8, 0x55, 0x66, 0x41, 0x6B, 0x6E, 0x9D, 0x89, 0x9D, 0x9A, 0x0B,
+    0x9D, 0x89, 0x9C, 0x88, 0x9D, 0x87, 0x98, 0x98, 0xBB, 0x87, 0xAB, 0x86, 0xC0, 0x75, 0x69, 0x78,
+    0x68, 0x9E, 0x96, 0x61, 0x64, 0x65, 0x66, 0x65, 0x55, 0x7A, 0x65, 0x00, 0x65, 0x6B, 0xA2, 0x79,
+    0x15, 0xA3, 0x8A, 0xA4, 0x79, 0xA2, 0x7A, 0x5B, 0x9F, 0x8B, 0xA1, 0x8A, 0x5B, 0x9A, 0x79, 0x98,
+    0x59, 0x9E, 0x69, 0x5F, 0xC0, 0x61, 0xA2, 0x89, 0x14, 0x99, 0x99, 0xA4, 0x87, 0xA5, 0x99, 0x7F,
+    0x2E, 0x61, 0xA5, 0xA8, 0xA6, 0x98, 0x61, 0xA8, 0x88, 0xA9, 0x89, 0x9A, 0x85, 0x8F, 0x93, 0x68,
+    0xA3, 0x88, 0xA0, 0x8A, 0x9D, 0x9C, 0x9B, 0x9C, 0x9C, 0x79, 0x9C, 0x8A, 0x66, 0xC0, 0x6B, 0xA2,
+    0x87, 0x2F, 0x79, 0xC0, 0x7E, 0xA2, 0x88, 0xA5, 0x88, 0xA5, 0x97, 0xA3, 0x88, 0xA3, 0x87, 0x6D,
+    0x58, 0x54, 0x9D, 0x99, 0x65, 0x56, 0x65, 0x56, 0xC0, 0xA3, 0x8A, 0xA4, 0x9A, 0xA5, 0x8A, 0xA5,
+    0x99, 0xA2, 0x89, 0x56, 0x65, 0x9B, 0x88, 0x91, 0x9A, 0x9A, 0x89, 0x51, 0x42, 0xA2, 0x88, 0x69,
+    0x01, 0x36, 0xA3, 0x96, 0x79, 0x58, 0x69, 0xFF, 0x9C, 0x91, 0xC3, 0x66, 0xC3, 0x5A, 0x69, 0x66,
+    0xC0, 0x56, 0x65, 0x5A, 0x66, 0xC1, 0x2D, 0xC0, 0x34, 0xC1, 0x2A, 0xC0, 0x31, 0x2A, 0xC1, 0x66,
+    0x1B, 0xC1, 0x66, 0xC0, 0x65, 0xC0, 0x66, 0xC1, 0x0A, 0x05, 0x6F, 0xC1, 0x2A, 0x96, 0x89, 0x99,
+    0x89, 0xC1, 0x66, 0xC0, 0x7E, 0xA2, 0x88, 0x52, 0xAA, 0x88, 0x20, 0x93, 0x99, 0xB3, 0x88, 0x9C,
+    0x89, 0x0C, 0x9E, 0x86, 0xAD, 0xA4, 0xB5, 0xA1, 0x9E, 0x95, 0xA2, 0x9A, 0xA2, 0x87, 0x50, 0x65,
+    0x65, 0x66, 0x6F, 0x7E, 0x13, 0xC2, 0x6B, 0x7A, 0xC0, 0x22, 0xA2, 0x78, 0x6E, 0xC0, 0x6F, 0xA2,
+    0x79, 0xA2, 0x77, 0x66, 0xA3, 0x8A, 0xA4, 0x7A, 0x9F, 0x8C, 0xA3, 0x8B, 0xA2, 0x7A, 0x8A, 0x9A,
+    0x93, 0x9A, 0x25, 0x66, 0xC1, 0x55, 0xC2, 0x6B, 0xC2, 0x66, 0x18, 0x55, 0x66, 0x09, 0xC1, 0x69,
+    0xA3, 0x96, 0xA3, 0x96, 0xA2, 0x87, 0xA4, 0x85, 0xA4, 0x87, 0x7E, 0x59, 0x69, 0x66, 0x56, 0x51,
+    0x65, 0x6B, 0x09, 0x6F, 0xA1, 0x9A, 0xAB, 0x9E, 0xA7, 0x8A, 0xC0, 0xA1, 0x8A, 0xA0, 0x8A, 0xC1,
+    0x61, 0x9D, 0x99, 0x5A, 0x31, 0xC0, 0x2C, 0x55, 0x50, 0x92, 0x88, 0x98, 0x88, 0xA6, 0x88, 0xA3,
+    0x99, 0xC0, 0xAC, 0x88, 0x31, 0xC1, 0x94, 0x88, 0x92, 0x88, 0x9D, 0x99, 0xA2, 0x88, 0xC2, 0x55,
+    0xC0, 0x6F, 0x28, 0xA2, 0x77, 0x7F, 0xA2, 0x88, 0x7F, 0xC0, 0x6E, 0xC1, 0x24, 0xC0, 0x6F, 0x7E,
+    0xC2, 0x24, 0x51, 0x01, 0xC2, 0x7E, 0xC0, 0x6E, 0x09, 0x5A, 0x01, 0x69, 0xC0, 0x66, 0x2D, 0x26,
+    0x66, 0xC0, 0x51, 0x66, 0x0D, 0x08, 0x3C, 0xA8, 0x77, 0xAC, 0xA7, 0x9B, 0xA8, 0x51, 0x56, 0x9D,
+    0x98, 0x6B, 0xA2, 0x78, 0x9C, 0x89, 0x9D, 0x8A, 0x9C, 0x88, 0x9A, 0x78, 0xA3, 0x88, 0x95, 0x98,
+    0x92, 0x88, 0xFF, 0x9C, 0xAF, 0xB1, 0x96, 0x65, 0x7E, 0x9E, 0x86, 0x60, 0x79, 0x7E, 0x69, 0x65,
+    0x50, 0x66, 0x7D, 0x56, 0x65, 0x51, 0x79, 0x7A, 0x51, 0x5F, 0x01, 0xA2, 0x79, 0xA3, 0x8A, 0xA1,
+    0x7A, 0x12, 0xA0, 0x7A, 0x56, 0x9C, 0x7A, 0x9A, 0x69, 0x9C, 0x69, 0xA2, 0x69, 0x5F, 0x9B, 0x98,
+    0x66, 0xA4, 0x88, 0x9B, 0x88, 0x3B, 0xA4, 0x87, 0xA3, 0x99, 0xC0, 0x7A, 0x7E, 0x61, 0xA3, 0xA8,
+    0xAA, 0x98, 0xA2, 0x99, 0xA2, 0x77, 0xA6, 0x89, 0x91, 0x94, 0x95, 0x86, 0xA2, 0x87, 0x7F, 0x9D,
+    0x8C, 0x53, 0x9D, 0x9A, 0x9D, 0x89, 0x52, 0x67, 0xA2, 0x87, 0xA3, 0xA8, 0x7E, 0x65, 0x66, 0xA4,
+    0x78, 0xA8, 0x97, 0xA5, 0x88, 0x59, 0x50, 0x54, 0x68, 0xA3, 0x86, 0xA2, 0x76, 0x6B, 0x11, 0xC0,
+    0x66, 0x55, 0x66, 0x51, 0x52, 0x66, 0xA2, 0x89, 0xA2, 0x8A, 0x36, 0xA1, 0x9A, 0x51, 0x98, 0x89,
+    0x9B, 0x9A, 0xC0, 0x5B, 0x7A, 0x55, 0x3F, 0xA2, 0x87, 0xA4, 0x87, 0xA3, 0x87, 0x64, 0x54, 0x9C,
+    0x7E, 0xC0, 0x7A, 0xC6, 0x5B, 0x15, 0x10, 0xC0, 0x56, 0x3C, 0x56, 0xC0, 0x69, 0xC1, 0x5A, 0xC0,
+    0x66, 0xC4, 0x2A, 0x69, 0x66, 0x5A, 0x66, 0xC1, 0x69, 0x66, 0x5A, 0x76, 0xC1, 0x0A, 0xC1, 0x05,
+    0xA2, 0x88, 0x2A, 0x8F, 0x9A, 0x55, 0x56, 0x51, 0x7E, 0xA9, 0x99, 0x9B, 0x88, 0xA3, 0x99, 0xA3,
+    0x88, 0x08, 0x97, 0x89, 0xA5, 0x98, 0xA3, 0x89, 0x95, 0x98, 0xA9, 0x88, 0x9B, 0x87, 0xA1, 0xA7,
+    0xFF, 0xC5, 0x49, 0xA3, 0x93, 0x7F, 0x7F, 0x54, 0x7A, 0x66, 0x6F, 0x7B, 0xC0, 0x51, 0x6E, 0x24,
+    0xC1, 0x1A, 0x1F, 0xC0, 0x30, 0x7F, 0xC0, 0x5B, 0x6E, 0x6E, 0xA3, 0x89, 0xA2, 0x88, 0xA2, 0x7B,
+    0xA3, 0x8D, 0x57, 0xA3, 0x8B, 0x95, 0x99, 0x1E, 0xA0, 0x8A, 0x69, 0x66, 0xC0, 0x7E, 0x6F, 0xC0,
+    0x20, 0x51, 0xC0, 0x5A, 0x7B, 0xC0, 0x6E, 0x09, 0xC1, 0x66, 0xC0, 0x69, 0xA3, 0x97, 0xA3, 0x95,
+    0xA4, 0x86, 0xA5, 0x96, 0xA3, 0x87, 0x7E, 0x69, 0xC0, 0x56, 0x55, 0x66, 0x55, 0x56, 0x6B, 0xA3,
+    0x9A, 0xAE, 0x7C, 0xA6, 0x8E, 0xC1, 0x65, 0x6B, 0x31, 0xC0, 0x9D, 0x99, 0x7E, 0x31, 0xC2, 0x69,
+    0x25, 0x9D, 0x89, 0x69, 0x25, 0x20, 0x31, 0xC1, 0x2C, 0x95, 0x98, 0x9C, 0x88, 0x51, 0x97, 0x89,
+    0x51, 0xC1, 0x6E, 0xC1, 0x28, 0xC0, 0xA2, 0x78, 0xA2, 0x88, 0x7E, 0xC0, 0x6F, 0x6E, 0x7A, 0x66,
+    0x21, 0x24, 0xC0, 0x29, 0xC0, 0x24, 0xC0, 0x15, 0x51, 0xC1, 0x7E, 0xC1, 0x6E, 0xC0, 0x56, 0x69,
+    0x3A, 0xC0, 0x66, 0xC0, 0x55, 0x66, 0xC0, 0x1C, 0x55, 0x66, 0xC0, 0x65, 0x55, 0xAA, 0x87, 0xAB,
+    0xA7, 0x9B, 0xA9, 0x51, 0x9D, 0x99, 0x41, 0x7F, 0xC0, 0x9C, 0x79, 0x9C, 0x89, 0x9D, 0x89, 0x45,
+    0x96, 0x88, 0x9B, 0x98, 0x9B, 0x88, 0xB7, 0x96, 0xB5, 0x96, 0x6E, 0x79, 0x64, 0x50, 0x65, 0x7A,
+    0x69, 0x7E, 0x51, 0x9D, 0x98, 0xA2, 0x87, 0xA2, 0x88, 0x9D, 0x98, 0x9D, 0x98, 0x7E, 0x7E, 0x6B,
+    0x01, 0x20, 0xA2, 0x79, 0x3C, 0xA0, 0x8A, 0x6F, 0xA1, 0x8A, 0x52, 0x9C, 0x79, 0x9C, 0x69, 0x9D,
+    0x69, 0x9F, 0x6A, 0x56, 0x9D, 0x98, 0x28, 0x9B, 0x98, 0x9A, 0x88, 0xA9, 0x89, 0x7E, 0x9C, 0x98,
+    0x1C, 0xC0, 0xA2, 0x88, 0x71, 0xAA, 0x88, 0xA7, 0xA8, 0x95, 0xA9, 0xA8, 0x98, 0xAB, 0x89, 0x50,
+    0x8B, 0x95, 0x9C, 0x86, 0xA1, 0x8A, 0x63, 0x9F, 0x8B, 0xC0, 0x52, 0x9C, 0x89, 0xC0, 0xA2, 0x98,
+    0xA2, 0x97, 0xC0, 0x65, 0xA2, 0x88, 0xA5, 0x98, 0xA8, 0x78, 0xA4, 0x88, 0xA2, 0x87, 0x50, 0x9D,
+    0x88, 0x54, 0x6C, 0x58, 0xC0, 0x7D, 0x6E, 0xC0, 0x0C, 0x6F, 0x11, 0x0C, 0x51, 0x9B, 0x89, 0x99,
+    0x9B, 0x53, 0xA1, 0x9A, 0xA0, 0x9A, 0x52, 0x12, 0x7B, 0xA4, 0x88, 0xA3, 0x99, 0xC0, 0x04, 0x51,
+    0x36, 0xA3, 0x98, 0x6E, 0x65, 0x9E, 0x7C, 0xC6, 0x7A, 0xC0, 0x10, 0xC1, 0x66, 0x59, 0x66, 0x2D,
+    0x66, 0x5A, 0xC1, 0x6E, 0xC0, 0x6B, 0xA2, 0x87, 0x7F, 0xA2, 0x88, 0xC0, 0x19, 0x3E, 0x50, 0x66,
+    0x56, 0xC1, 0x69, 0x66, 0xC2, 0x05, 0xC0, 0x0A, 0xC2, 0x7F, 0xA3, 0x89, 0x8F, 0x89, 0x9B, 0x89,
+    0x7E, 0x51, 0x29, 0x11, 0x51, 0x11, 0xA5, 0x99, 0xA2, 0x88, 0x96, 0x88, 0xAB, 0x89, 0x90, 0x87,
+    0x15, 0xA7, 0x98, 0x9B, 0x88, 0x9E, 0x86, 0xB8, 0xB2, 0xAC, 0x91, 0x69, 0xC0, 0xA2, 0x87, 0x7F,
+    0x51, 0x66, 0xA2, 0x89, 0x7A, 0x52, 0x6E, 0xC2, 0x5A, 0x65, 0x7E, 0x30, 0x6F, 0xC0, 0x66, 0x6F,
+    0xA2, 0x77, 0x7F, 0xA3, 0x89, 0xA3, 0x8C, 0xA3, 0x7F, 0xA3, 0x79, 0xC0, 0x91, 0xA9, 0x1E, 0xA1,
+    0x9A, 0x56, 0x39, 0xA4, 0x88, 0xA4, 0xA9, 0xA3, 0x88, 0xC0, 0x52, 0x9B, 0x98, 0x9A, 0x77, 0x9D,
+    0x89, 0x56, 0x6E, 0xC4, 0x04, 0x79, 0xA3, 0x87, 0xA5, 0x95, 0xA5, 0x96, 0xA4, 0x85, 0xA3, 0x87,
+    0xC0, 0x69, 0x6E, 0x2D, 0x52, 0x55, 0x9D, 0x9A, 0xA1, 0x8B, 0xA3, 0x8A, 0xAE, 0x8A, 0xA5, 0x8D,
+    0xC1, 0x66, 0x51, 0x7F, 0x6F, 0x6E, 0xC3, 0x25, 0x56, 0x11, 0x1D, 0x31, 0xC5, 0x25, 0x11, 0x6B,
+    0x9A, 0x88, 0x94, 0x87, 0x56, 0xA4, 0x88, 0x7F, 0x9A, 0x78, 0x9A, 0x98, 0x6E, 0x7F, 0xC0, 0xA2,
+    0x78, 0xA2, 0x98, 0x15, 0xC0, 0x6E, 0x6B, 0x1A, 0xC0, 0x7B, 0xC2, 0x21, 0xC1, 0x15, 0x65, 0x56,
+    0xC1, 0x09, 0xC1, 0x5A, 0x69, 0x66, 0xC1, 0x35, 0x55, 0xC0, 0x66, 0xC0, 0x66, 0x55, 0xC1, 0x66,
+    0x55, 0xA9, 0x96, 0xAB, 0xA7, 0x9B, 0xAA, 0x50, 0x9D, 0x99, 0x52, 0xA2, 0x78, 0x9D, 0x99, 0x9A,
+    0x89, 0x9B, 0x89, 0xA4, 0x78, 0x98, 0x68, 0x95, 0x99, 0xA4, 0x87, 0x97, 0x98, 0xB9, 0x86, 0xB1,
+    0xA6, 0xA2, 0x87, 0x69, 0x7A, 0x69, 0x65, 0xC1, 0x79, 0x65, 0x54, 0x65, 0x65, 0xC0, 0x65, 0xC1,
+    0x01, 0xA2, 0x7A, 0xA3, 0x7A, 0xA2, 0x8A, 0x57, 0x56, 0x6B, 0x5A, 0x5B, 0x9B, 0x8A, 0x9D, 0x79,
+    0x9F, 0x59, 0x99, 0x79, 0x9D, 0x99, 0xA5, 0x98, 0xC0, 0x94, 0x88, 0xA6, 0x98, 0x55, 0x9A, 0x88,
+    0xC0, 0xA3, 0x89, 0xA6, 0x88, 0x1C, 0xA3, 0x98, 0x9C, 0x98, 0x9B, 0xA9, 0xA2, 0x98, 0xAF, 0xA9,
+    0xAB, 0x88, 0x31, 0x97, 0x95, 0x8E, 0x85, 0x67, 0xA0, 0x7A, 0x67, 0x6F, 0x66, 0x9C, 0x99, 0x55,
+    0xA1, 0xA8, 0xA4, 0x87, 0x7E, 0xA3, 0x88, 0xA4, 0x87, 0xA5, 0x99, 0xA4, 0x78, 0xA2, 0x88, 0x7F,
+    0x69, 0x55, 0x6D, 0x6E, 0x56, 0x54, 0x9D, 0x97, 0x51, 0x54, 0xC0, 0x7E, 0x6E, 0x7A, 0x55, 0x9B,
+    0x9A, 0x9B, 0x8B, 0x9B, 0x9B, 0x9C, 0x8A, 0x67, 0x66, 0x6B, 0x6E, 0x0D, 0xA2, 0x98, 0xA5, 0x99,
+    0xA2, 0x78, 0x9B, 0x99, 0x54, 0xC0, 0x36, 0xA2, 0x88, 0x57, 0x66, 0x09, 0x6B, 0xC8, 0x56, 0x69,
+    0x66, 0x55, 0x66, 0x5A, 0xC2, 0xA3, 0x88, 0xA5, 0x99, 0xA3, 0x88, 0x7B, 0xC0, 0x15, 0x7E, 0x0E,
+    0x9C, 0x87, 0x9B, 0x89, 0x51, 0xC0, 0x66, 0xC0, 0x69, 0x66, 0xC5, 0x0D, 0x6F, 0x6E, 0x01, 0x92,
+    0x79, 0x96, 0x88, 0x6F, 0x15, 0xA2, 0x88, 0xA3, 0x99, 0x6E, 0xA7, 0x99, 0x50, 0x96, 0x88, 0xA7,
+    0x89, 0x7A, 0x95, 0x89, 0x7E, 0xA7, 0x88, 0x55, 0x9A, 0x87, 0xAD, 0xC4, 0xB8, 0x91, 0x9F, 0x95,
+    0x69, 0xA2, 0x78, 0x7F, 0xA2, 0x88, 0x62, 0x30, 0xC0, 0x62, 0x6E, 0x30, 0x2B, 0xC0, 0x55, 0xC0,
+    0x2B, 0x30, 0x6B, 0xC0, 0x6F, 0x6E, 0xA2, 0x87, 0x6B, 0xA3, 0x79, 0xA5, 0x8D, 0xA3, 0x7F, 0xA0,
+    0x8A, 0x6D, 0x00, 0x88, 0x9A, 0xA2, 0x79, 0x7F, 0xA5, 0x98, 0xA6, 0x88, 0x7F, 0x65, 0xC0, 0x6B,
+    0x55, 0x9D, 0x99, 0x9A, 0x77, 0x9D, 0x89, 0x51, 0x51, 0x56, 0xC0, 0x6E, 0x04, 0x69, 0x7E, 0xA4,
+    0x86, 0xA5, 0x96, 0xA5, 0x85, 0xA3, 0x96, 0xA3, 0x97, 0xC0, 0x6D, 0xC0, 0x56, 0x55, 0x9D, 0x9A,
+    0xA7, 0x8D, 0xA8, 0x9D, 0xA3, 0x8A, 0xA2, 0x79, 0xC1, 0x61, 0x66, 0x5A, 0xA2, 0x88, 0x31, 0x2A,
+    0x31, 0x25, 0x9C, 0x88, 0x9D, 0x89, 0xA2, 0x87, 0x11, 0x6F, 0x25, 0x2A, 0x31, 0xC8, 0x25, 0x6B,
+    0x31, 0xC0, 0x2C, 0x91, 0x88, 0x93, 0x88, 0x7F, 0x7F, 0xA2, 0x78, 0xA2, 0x98, 0x6E, 0xC0, 0x6E,
+    0x6B, 0xC0, 0x1A, 0xC2, 0x67, 0xC1, 0x1A, 0x15, 0x55, 0x66, 0xC1, 0x06, 0xC0, 0x7A, 0x06, 0x69,
+    0x66, 0xC0, 0x66, 0xC0, 0x65, 0xC1, 0x66, 0xC0, 0x56, 0x69, 0x66, 0x08, 0x69, 0xA7, 0x97, 0xAB,
+    0xA6, 0x9C, 0x99, 0x51, 0x51, 0x66, 0x6B, 0x9D, 0x88, 0x9B, 0x89, 0x6B, 0x9D, 0x89, 0x8C, 0x69,
+    0xAB, 0x88, 0x96, 0x88, 0x9C, 0x87, 0xB4, 0x96, 0xB3, 0x96, 0xA3, 0x97, 0x7D, 0x7E, 0xC2, 0x7A,
+    0x65, 0x58, 0x69, 0x9D, 0xA8, 0x50, 0x7F, 0x69, 0x32, 0xA1, 0x9A, 0xA2, 0x7A, 0xA4, 0x7A, 0xA1,
+    0x8A, 0x57, 0x6F, 0x66, 0x41, 0x46, 0x9D, 0x89, 0x9C, 0x79, 0x9F, 0x6A, 0x9E, 0x69, 0x9D, 0x88,
+    0x65, 0xA2, 0x88, 0x8F, 0x98, 0xA2, 0x88, 0xA6, 0x88, 0x04, 0xA4, 0x78, 0xA6, 0x88, 0xA2, 0x98,
+    0xA5, 0x89, 0x1C, 0x9B, 0x98, 0x9C, 0x98, 0xA6, 0x98, 0xA5, 0x99, 0xA3, 0xA8, 0xAD, 0xA9, 0xA5,
+    0x89, 0xA2, 0x87, 0x8F, 0x96, 0x93, 0x9A, 0x6F, 0x7F, 0x6B, 0x10, 0x51, 0x51, 0xA5, 0x97, 0xA8,
+    0x86, 0xA5, 0x98, 0xA2, 0x87, 0xA3, 0x88, 0xA2, 0x99, 0xA1, 0x8A, 0xC0, 0x55, 0x65, 0x55, 0xA2,
+    0x88, 0xA2, 0x88, 0xA2, 0x78, 0xA2, 0x87, 0x55, 0x9A, 0x88, 0x99, 0x97, 0x9B, 0x98, 0x5A, 0xA2,
+    0x88, 0x6D, 0xC0, 0x9D, 0x9B, 0x9B, 0x9B, 0x9A, 0x8A, 0x9D, 0x9A, 0x6B, 0xA2, 0x88, 0x3C, 0x7E,
+    0x9D, 0x98, 0x9D, 0x88, 0xA2, 0x89, 0xA7, 0x99, 0x6F, 0x9B, 0x98, 0x55, 0xC0, 0x7E, 0x04, 0xC0,
+    0x6E, 0x6B, 0xC2, 0x66, 0xC0, 0x10, 0xC1, 0x0B, 0x5A, 0x3C, 0xC0, 0x34, 0x69, 0xC0, 0x56, 0x6E,
+    0xA3, 0x99, 0xA5, 0x88, 0xA2, 0x88, 0x7B, 0xC0, 0x6E, 0xC2, 0x0E, 0x9D, 0x88, 0x9A, 0x98, 0x41,
+    0xC0, 0x66, 0x69, 0x66, 0xC5, 0x7F, 0x6E, 0x2D, 0xA2, 0x88, 0x98, 0x78, 0x92, 0x89, 0xA5, 0x89,
+    0x9D, 0x98, 0xA2, 0x88, 0xA3, 0x98, 0x25, 0x95, 0x89, 0x90, 0x88, 0xA3, 0x98, 0xAF, 0x89, 0x97,
+    0x98, 0x9B, 0x99, 0xA2, 0x88, 0x39, 0x3D, 0x9C, 0x88, 0xA4, 0x94, 0xFF, 0xBD, 0x09, 0xA2, 0xA3,
+    0x6C, 0x6F, 0xC0, 0xA3, 0x98, 0x67, 0x51, 0x6B, 0xA2, 0x88, 0x6E, 0xC0, 0x6E, 0x9D, 0x99, 0x17,
+    0x24, 0x2B, 0x30, 0x5A, 0x6B, 0x7B, 0xA2, 0x77, 0x6E, 0x7F, 0xA2, 0x79, 0xA4, 0x7A, 0xA5, 0x7F,
+    0x23, 0x69, 0x9D, 0x98, 0x8A, 0x99, 0x9C, 0x79, 0x7F, 0xA5, 0xA9, 0xA5, 0x88, 0xC0, 0x66, 0xC2,
+    0x5A, 0x9D, 0x98, 0x9D, 0x89, 0x65, 0x42, 0x9D, 0x98, 0x20, 0x9D, 0x99, 0x59, 0x66, 0x05, 0xA6,
+    0x86, 0xA4, 0x84, 0xA4, 0x85, 0xA4, 0x86, 0xA2, 0x97, 0x6D, 0x6E, 0xC0, 0x65, 0x9F, 0x8B, 0xA7,
+    0x8F, 0x23, 0xA0, 0x8A, 0xC1, 0x69, 0x65, 0x9D, 0x9A, 0xA2, 0x87, 0x2A, 0x31, 0xC0, 0x2A, 0x55,
+    0x9C, 0x98, 0x9B, 0x89, 0x7F, 0xA4, 0x88, 0xA4, 0x88, 0x31, 0xC0, 0x2A, 0x25, 0xC0, 0x1E, 0x25,
+    0x31, 0xC9, 0x9D, 0x99, 0x8F, 0x88, 0x98, 0x88, 0xC0, 0xA3, 0x89, 0xA2, 0x98, 0x6E, 0xC0, 0x6E,
+    0x21, 0xC1, 0x1A, 0x15, 0xC4, 0x65, 0x56, 0xC5, 0x69, 0xC2, 0x66, 0x65, 0xC0, 0x35, 0x66, 0x65,
+    0xC0, 0x1C, 0x69, 0x66, 0x55, 0x5E, 0xA4, 0xA7, 0xAB, 0xB6, 0x61, 0x5A, 0x65, 0x52, 0x5B, 0x9D,
+    0x99, 0x52, 0x5B, 0x85, 0x79, 0xA4, 0x78, 0xA5, 0x88, 0x94, 0x99, 0x69, 0xAC, 0x86, 0xB9, 0xA5,
+    0xA3, 0x86, 0xA2, 0x97, 0xC1, 0x6F, 0x7A, 0xC0, 0x65, 0x69, 0x64, 0x50, 0x75, 0x6F, 0xC0, 0x6F,
+    0xA1, 0x8B, 0xA3, 0x8B, 0xA2, 0x69, 0x67, 0x5A, 0x61, 0x52, 0x5A, 0x42, 0x9D, 0x79, 0x42, 0x4F,
+    0x9A, 0x79, 0x9B, 0x88, 0xA4, 0x98, 0x93, 0x88, 0x96, 0x88, 0x10, 0xA4, 0x98, 0xA5, 0x88, 0xA2,
+    0x68, 0xA2, 0x98, 0xA3, 0x99, 0x65, 0x5A, 0x66, 0x61, 0xA3, 0x98, 0xA5, 0xA9, 0xA9, 0xA9, 0xA4,
+    0x98, 0x65, 0xA2, 0x87, 0xA2, 0x78, 0x8A, 0x98, 0x9C, 0x88, 0x7B, 0x7B, 0xC1, 0xA2, 0x77, 0xA7,
+    0x95, 0xA6, 0x87, 0xA4, 0x86, 0x6E, 0x7B, 0xA1, 0x8A, 0x7E, 0x5A, 0x9D, 0x99, 0x55, 0x55, 0x69,
+    0x7B, 0x1A, 0xA2, 0x88, 0xA1, 0x9A, 0x9B, 0x88, 0x95, 0x87, 0x99, 0x99, 0xA0, 0x7A, 0xA2, 0x87,
+    0xA2, 0x88, 0xC0, 0x52, 0x63, 0x9D, 0x8A, 0x7A, 0xA4, 0x88, 0xA4, 0x88, 0xA2, 0x87, 0x7A, 0x9D,
+    0x88, 0x1C, 0x51, 0xA5, 0x99, 0xA6, 0x88, 0xC0, 0x9B, 0x89, 0x50, 0x56, 0x04, 0xC0, 0x09, 0x6B,
+    0xC2, 0x09, 0xC0, 0x10, 0x0B, 0x5A, 0xC0, 0x65, 0xC0, 0x56, 0x69, 0xC2, 0xA3, 0x89, 0xA5, 0x88,
+    0xA3, 0x99, 0xC4, 0x6E, 0x1D, 0xC0, 0x55, 0x9C, 0x88, 0x9A, 0x88, 0x16, 0xC0, 0x69, 0xC0, 0x66,
+    0xC3, 0x7F, 0x7E, 0x2D, 0xC0, 0x6F, 0x16, 0x8B, 0x99, 0xA5, 0x89, 0xA3, 0x89, 0x3D, 0xA4, 0x88,
+    0xA5, 0x98, 0x8B, 0x89, 0x66, 0x25, 0xA6, 0x98, 0x95, 0x88, 0x9B, 0x99, 0x6F, 0x31, 0xA2, 0x88,
+    0x9D, 0x89, 0x9B, 0x96, 0xB5, 0xB4, 0xB0, 0x90, 0xA0, 0x95, 0xC0, 0x6F, 0xA2, 0x88, 0x62, 0x56,
+    0x10, 0x6F, 0x7E, 0x6F, 0xC0, 0x1C, 0xC0, 0x30, 0xC0, 0x66, 0x5E, 0x67, 0x6E, 0xA2, 0x88, 0xA2,
+    0x77, 0x6B, 0xA3, 0x89, 0xA1, 0x9A, 0xA5, 0x7C, 0xA2, 0x7D, 0xA1, 0x8A, 0xC0, 0x90, 0x97, 0x94,
+    0x8A, 0xA1, 0x9A, 0xA5, 0x98, 0xA3, 0x89, 0x69, 0x66, 0x34, 0xC0, 0x37, 0xC0, 0x41, 0x9D, 0x98,
+    0x3B, 0x00, 0xC0, 0x56, 0x9D, 0x99, 0x3C, 0x51, 0x7D, 0xA4, 0x76, 0xA3, 0x95, 0xA3, 0x86, 0xA4,
+    0x85, 0xA2, 0x87, 0x7E, 0x6E, 0xC0, 0x9E, 0x8B, 0x02, 0xA7, 0x7E, 0x6B, 0xC2, 0x1E, 0x9D, 0x99,
+    0xA2, 0x78, 0x7F, 0x31, 0x2A, 0x16, 0x9D, 0x98, 0x55, 0xA3, 0x99, 0xA3, 0x88, 0x9D, 0x9A, 0x9D,
+    0x88, 0x11, 0x25, 0x9D, 0x88, 0x0A, 0x9C, 0x88, 0x2E, 0xC0, 0x02, 0xA2, 0x89, 0x7A, 0x1D, 0x25,
+    0x2A, 0x25, 0x20, 0x6F, 0x31, 0xC1, 0x25, 0x9A, 0x89, 0x94, 0x88, 0x55, 0x9B, 0x99, 0xA2, 0x77,
+    0x7F, 0xC1, 0x6E, 0x6B, 0x1A, 0x15, 0xC0, 0x66, 0x15, 0xC1, 0x10, 0x06, 0x66, 0x69, 0x01, 0xC1,
+    0x3A, 0xC4, 0x65, 0x66, 0xC0, 0x7F, 0xC0, 0x24, 0xC0, 0x55, 0x66, 0xC0, 0x55, 0x0D, 0x0E, 0xAC,
+    0xA5, 0xA1, 0xA7, 0x56, 0x66, 0x52, 0x66, 0x56, 0xA2, 0x6A, 0x8A, 0x69, 0x8D, 0x99, 0xB4, 0x88,
+    0x97, 0x88, 0x9C, 0x88, 0x65, 0xA4, 0x87, 0xB7, 0xA4, 0xAC, 0x85, 0xA3, 0x98, 0x55, 0xC0, 0xA2,
+    0x89, 0x7E, 0x62, 0x54, 0x7E, 0x50, 0x61, 0x7E, 0x6F, 0x6B, 0xA3, 0x88, 0xA1, 0x8C, 0xA1, 0x7B,
+    0x35, 0x52, 0x7E, 0x9D, 0x98, 0x41, 0x6F, 0x5B, 0x9D, 0x7A, 0xA1, 0x6A, 0x9D, 0x79, 0x97, 0x98,
+    0x5A, 0x94, 0x98, 0x98, 0x87, 0xAD, 0x89, 0xA6, 0x88, 0xA4, 0x88, 0x9D, 0x88, 0x6F, 0xA3, 0x98,
+    0xA2, 0x98, 0xA2, 0x88, 0x1C, 0x55, 0xA3, 0x98, 0xA2, 0x99, 0xA2, 0x98, 0xA1, 0xA9, 0xA1, 0xA9,
+    0xAD, 0x97, 0xA3, 0x98, 0xC0, 0x95, 0x89, 0x8E, 0x88, 0xA1, 0xA9, 0x6B, 0x7E, 0x7E, 0x6D, 0xA6,
+    0x85, 0xA6, 0x86, 0xA4, 0x75, 0xC2, 0x56, 0x61, 0x42, 0x50, 0x69, 0x66, 0x52, 0x12, 0x52, 0x9E,
+    0x9B, 0x9D, 0x89, 0x9B, 0x89, 0x9D, 0xAB, 0x5B, 0xC0, 0x6E, 0x6F, 0x7A, 0x66, 0xA3, 0x88, 0x20,
+    0xA3, 0x88, 0xA2, 0x87, 0x7E, 0x69, 0x53, 0x9D, 0x8A, 0x18, 0x51, 0xA2, 0x89, 0xA4, 0x88, 0x55,
+    0x9A, 0x88, 0x9C, 0x98, 0xA5, 0x77, 0xC0, 0x6F, 0x7A, 0xC5, 0x04, 0x5A, 0xC0, 0x3C, 0x5A, 0xC0,
+    0x65, 0xC1, 0x01, 0xA5, 0x89, 0xA3, 0x88, 0x7F, 0xC7, 0x69, 0x51, 0x9B, 0x88, 0x9B, 0x99, 0x56,
+    0x69, 0xC1, 0x0A, 0xC1, 0x16, 0x1E, 0x2D, 0xC1, 0x6E, 0x01, 0x8C, 0x78, 0x9A, 0x89, 0xA5, 0x98,
+    0x9D, 0x89, 0xA8, 0x98, 0x7E, 0x98, 0x88, 0xC0, 0xAC, 0x88, 0x9C, 0x89, 0x9A, 0x78, 0x65, 0xC0,
+    0x99, 0x88, 0xA4, 0x88, 0x31, 0x98, 0x87, 0xAA, 0xA5, 0xFF, 0xBD, 0x06, 0xA1, 0x94, 0x7E, 0x7F,
+    0xA2, 0x88, 0x67, 0x5A, 0x7E, 0x51, 0x10, 0x6F, 0x56, 0xA2, 0x88, 0x6E, 0x7A, 0xC0, 0x28, 0xC0,
+    0x6F, 0xC0, 0xA2, 0x88, 0x6E, 0xC0, 0xA3, 0x89, 0xA2, 0x88, 0xA4, 0x7B, 0xA1, 0x8E, 0xA1, 0x7A,
+    0xA2, 0x88, 0x8F, 0x99, 0x94, 0x9A, 0xA2, 0x89, 0xA5, 0x99, 0xA3, 0x88, 0xC0, 0x66, 0xC0, 0x7E,
+    0xC1, 0x14, 0x51, 0x66, 0x00, 0x6E, 0x7A, 0x00, 0xC0, 0x05, 0x69, 0x68, 0x6C, 0xA1, 0x85, 0xA3,
+    0x96, 0xA2, 0x87, 0x7E, 0x6E, 0x57, 0xA7, 0x9F, 0xA8, 0x7D, 0xA0, 0x8A, 0xC2, 0x69, 0x9D, 0x98,
+    0x50, 0xA3, 0x9A, 0x2A, 0xC0, 0x50, 0x9C, 0x87, 0x7B, 0xA3, 0x88, 0x7F, 0xA2, 0x79, 0x65, 0x22,
+    0x6F, 0xA3, 0x87, 0x9B, 0x99, 0xA2, 0x88, 0x9C, 0x88, 0x13, 0xC1, 0xA3, 0x99, 0xA2, 0x78, 0x66,
+    0x0F, 0xC0, 0x6B, 0x0A, 0xA2, 0x89, 0x2A, 0x31, 0xC2, 0x51, 0x96, 0x88, 0x95, 0x98, 0x56, 0x66,
+    0x01, 0x09, 0x6F, 0x66, 0x09, 0x10, 0xA2, 0x88, 0xA4, 0x88, 0x55, 0x15, 0x55, 0x01, 0xC2, 0x69,
+    0xC1, 0x35, 0x3A, 0xC2, 0x35, 0x69, 0x66, 0xC0, 0x7A, 0xC1, 0x56, 0x55, 0xC0, 0x56, 0xC0, 0x6E,
+    0x65, 0xA8, 0xA5, 0xA6, 0xA5, 0x55, 0x66, 0x65, 0x57, 0x9F, 0x6A, 0x94, 0x7B, 0x83, 0x8A, 0xA9,
+    0x88, 0xA8, 0x98, 0x9A, 0x88, 0xA2, 0x88, 0x9D, 0x89, 0x99, 0x98, 0xB3, 0x94, 0xB7, 0x95, 0xA3,
+    0x98, 0x69, 0xA2, 0x88, 0x6B, 0xC0, 0x75, 0x55, 0x65, 0x59, 0x75, 0x7F, 0x6F, 0xA0, 0x7A, 0xA3,
+    0x89, 0xA1, 0x8B, 0x57, 0xC1, 0x51, 0x9B, 0x98, 0x6F, 0xA2, 0x79, 0xA2, 0x69, 0x9C, 0x79, 0x9B,
+    0x69, 0x98, 0x79, 0x65, 0x9C, 0x88, 0x95, 0x88, 0xA9, 0x98, 0xA9, 0x89, 0xA4, 0x98, 0x08, 0x9B,
+    0x88, 0xA6, 0x88, 0xA3, 0x99, 0xA5, 0x88, 0x9A, 0x98, 0x11, 0xA3, 0x98, 0xA3, 0x98, 0x66, 0x61,
+    0x66, 0xAB, 0xA9, 0xAD, 0x98, 0xA2, 0x88, 0x9D, 0x98, 0x66, 0x91, 0x99, 0x99, 0x99, 0x7F, 0x7A,
+    0xA2, 0x87, 0xA2, 0x76, 0xA4, 0x85, 0xA5, 0x86, 0xA2, 0x85, 0x69, 0x6F, 0x55, 0x66, 0x51, 0x56,
+    0x51, 0x69, 0x52, 0x9D, 0x9A, 0x53, 0x67, 0x52, 0x9D, 0x9B, 0x56, 0x53, 0x6B, 0xC2, 0x05, 0xA3,
+    0x98, 0xA9, 0x98, 0xA3, 0xA8, 0x69, 0xC1, 0x56, 0x5B, 0xA3, 0x89, 0xA2, 0x89, 0x9D, 0x99, 0x9A,
+    0x78, 0x65, 0x30, 0x50, 0x51, 0x69, 0x6E, 0xC1, 0x06, 0x7A, 0xC3, 0x01, 0xC0, 0x66, 0x55, 0x6F,
+    0xC0, 0x2D, 0xC0, 0x39, 0x15, 0xA5, 0x89, 0xA2, 0x88, 0xC2, 0x6E, 0x1D, 0x22, 0xC0, 0x1D, 0xC1,
+    0x55, 0x9C, 0x87, 0x9A, 0x89, 0x51, 0x69, 0xC0, 0x66, 0xC1, 0x0F, 0x16, 0xA2, 0x87, 0x7F, 0xC0,
+    0x2D, 0x32, 0x12, 0x94, 0x88, 0x90, 0x89, 0xA3, 0x99, 0x54, 0xAB, 0xA7, 0x51, 0xA7, 0x88, 0xA4,
+    0x99, 0x9C, 0x78, 0x96, 0x89, 0x52, 0xA5, 0x89, 0x96, 0x87, 0x9D, 0x99, 0xA5, 0x88, 0xA3, 0x89,
+    0x97, 0x88, 0xA4, 0xB5, 0xFF, 0xB4, 0xA4, 0xA5, 0x83, 0x6B, 0xA1, 0xA9, 0xA2, 0x88, 0x57, 0x61,
+    0xC0, 0x56, 0x3C, 0xA1, 0x8A, 0x6E, 0xA2, 0x88, 0x66, 0x65, 0x23, 0xC0, 0x28, 0xA2, 0x79, 0xC0,
+    0x7E, 0x6E, 0xC0, 0xA2, 0x88, 0xA1, 0x9A, 0xA5, 0x7B, 0xA3, 0x7D, 0x57, 0xA3, 0x89, 0x99, 0x99,
+    0x8C, 0x8A, 0x66, 0xA2, 0x99, 0xA5, 0x98, 0xA2, 0x88, 0x66, 0x59, 0x6B, 0xC0, 0x1C, 0x51, 0x51,
+    0xC0, 0x08, 0x6F, 0xC0, 0x08, 0x56, 0x6D, 0x7E, 0xA2, 0x76, 0x7D, 0xA2, 0x74, 0x7D, 0x7D, 0x69,
+    0x01, 0xFF, 0xE6, 0xF5, 0xA8, 0x7C, 0x6B, 0x23, 0xC2, 0x66, 0x03, 0x51, 0xA3, 0x88, 0xA2, 0x88,
+    0x69, 0x9C, 0x98, 0x9D, 0x89, 0xA3, 0x99, 0x7F, 0x37, 0xC0, 0x5A, 0x9A, 0x87, 0x66, 0x31, 0x51,
+    0x31, 0xA3, 0x89, 0xA5, 0x88, 0x9C, 0x88, 0x9A, 0x88, 0xA7, 0x99, 0x34, 0xC0, 0x25, 0x66, 0xA3,
+    0x89, 0x08, 0x67, 0xA2, 0x78, 0x2A, 0x6B, 0xC2, 0x9D, 0x98, 0x9C, 0x88, 0x98, 0x88, 0x51, 0xA3,
+    0x89, 0xA2, 0x88, 0x7F, 0x39, 0xA2, 0x88, 0xA5, 0x88, 0x11, 0x6F, 0x9B, 0x88, 0x92, 0x99, 0x9D,
+    0x88, 0x66, 0x01, 0xC2, 0x69, 0xC5, 0x66, 0x65, 0xC2, 0x76, 0x5A, 0x65, 0x5A, 0xC0, 0x56, 0xC2,
+    0xA2, 0x95, 0xAD, 0xA4, 0x74, 0x51, 0x65, 0x42, 0x9D, 0x7B, 0x91, 0x6C, 0x96, 0x8A, 0xA5, 0x98,
+    0x6F, 0x61, 0xA3, 0x89, 0x98, 0x88, 0x98, 0x88, 0xA8, 0x96, 0xBA, 0x93, 0xA8, 0x86, 0xA2, 0x87,
+    0x7F, 0x56, 0x65, 0x7E, 0xC0, 0x50, 0x69, 0x7F, 0xA1, 0x9A, 0xA1, 0x8A, 0x5F, 0xA2, 0x79, 0x67,
+    0x66, 0xA2, 0x78, 0x50, 0x9B, 0x89, 0xC0, 0xA3, 0x8B, 0xA3, 0x79, 0x51, 0x94, 0x69, 0x99, 0x79,
+    0x6F, 0x9A, 0x78, 0x98, 0x87, 0xAA, 0x98, 0xA7, 0x89, 0xA2, 0x88, 0x9D, 0x99, 0x9D, 0x78, 0xA3,
+    0x98, 0xA4, 0x88, 0xA3, 0x99, 0x51, 0x90, 0x88, 0xA2, 0x87, 0xA7, 0x98, 0x56, 0x7A, 0xA5, 0x99,
+    0xA3, 0x99, 0xA2, 0xA8, 0xA8, 0x88, 0x99, 0xA8, 0xA2, 0x78, 0xA9, 0x98, 0xA3, 0x99, 0x8A, 0x88,
+    0x66, 0x7A, 0x7E, 0xA4, 0x86, 0xA5, 0x86, 0xA3, 0x85, 0x6C, 0x6E, 0x7E, 0x5A, 0x0A, 0x56, 0x51,
+    0x65, 0x5A, 0x51, 0x9C, 0x9B, 0x9D, 0x9A, 0x9C, 0x8B, 0x9E, 0x9B, 0x67, 0x56, 0x5A, 0x0C, 0x6F,
+    0x0C, 0xC0, 0xA4, 0x98, 0xAA, 0x97, 0xA4, 0x87, 0x60, 0x69, 0x56, 0x51, 0x5F, 0xA2, 0x7A, 0xA4,
+    0x89, 0x6F, 0x66, 0x55, 0x9D, 0x99, 0xC0, 0x65, 0x55, 0x99, 0x86, 0xC0, 0x66, 0xC0, 0x6F, 0xC0,
+    0x09, 0xC0, 0x06, 0x66, 0xC0, 0x66, 0x32, 0x66, 0x32, 0x2D, 0xC1, 0x6F, 0xA5, 0x88, 0xA4, 0x88,
+    0x7F, 0xC1, 0x6F, 0xC1, 0x69, 0x1D, 0x22, 0x29, 0x1D, 0x0E, 0x50, 0x9A, 0x88, 0x9D, 0x89, 0x66,
+    0x65, 0xC3, 0x16, 0x7E, 0x32, 0x6F, 0x32, 0xC0, 0x3E, 0x2D, 0x8C, 0x88, 0x5B, 0x60, 0xAD, 0x86,
+    0xAB, 0x98, 0x91, 0x99, 0xAA, 0x88, 0x51, 0x95, 0x9B, 0x9D, 0x89, 0xA2, 0x78, 0x9C, 0x98, 0x6F,
+    0xA2, 0x88, 0x9C, 0x77, 0x9B, 0x99, 0xA2, 0xA6, 0xB9, 0xA0, 0xA9, 0x82, 0x7F, 0xA3, 0x98, 0x7E,
+    0x52, 0x9D, 0x89, 0x65, 0x7F, 0xA2, 0x88, 0xA2, 0x89, 0x56, 0x6E, 0x0F, 0x69, 0x17, 0x14, 0xA2,
+    0x88, 0xA2, 0x78, 0x7F, 0x6E, 0xC1, 0xA2, 0x88, 0xA2, 0x89, 0xA3, 0x8B, 0xA3, 0x7C, 0xA1, 0x8A,
+    0xA1, 0x8B, 0xA1, 0x8A, 0x8C, 0x98, 0x96, 0x99, 0xA1, 0x9A, 0xA2, 0x88, 0xA4, 0x87, 0xA3, 0x89,
+    0x7E, 0x28, 0x51, 0x08, 0x56, 0x65, 0x00, 0x08, 0x14, 0xC0, 0x69, 0x08, 0x65, 0xA2, 0x77, 0xA2,
+    0x87, 0xA2, 0x85, 0xA2, 0x75, 0x79, 0x6D, 0x56, 0xA8, 0x8D, 0xA8, 0x7D, 0x6B, 0x23, 0x1C, 0x65,
+    0x6B, 0xC3, 0x64, 0x9E, 0x86, 0xC0, 0xA2, 0x88, 0x04, 0x66, 0x6D, 0x9D, 0x88, 0x9B, 0x98, 0x9C,
+    0x78, 0x41, 0x65, 0x9C, 0x78, 0x18, 0xA4, 0x89, 0xA5, 0x89, 0xA6, 0x88, 0x99, 0x98, 0x9B, 0x89,
+    0xA5, 0x99, 0xA3, 0x99, 0xA2, 0x87, 0x9C, 0x89, 0x9D, 0x88, 0x36, 0xA1, 0x9A, 0xA2, 0x88, 0xA3,
+    0x89, 0x23, 0x31, 0xC4, 0x51, 0x7E, 0xC0, 0x2A, 0x31, 0xC3, 0x25, 0x98, 0x78, 0x92, 0x99, 0x51,
+    0xC0, 0x6E, 0xC2, 0x69, 0xC5, 0x66, 0x65, 0xC2, 0x61, 0xC0, 0x5A, 0x66, 0xC0, 0x5A, 0xC2, 0x64,
+    0xA9, 0xA5, 0xA8, 0x95, 0x9D, 0xA6, 0x50, 0x56, 0x9A, 0x6C, 0x98, 0x6C, 0xA1, 0x8A, 0xC0, 0x97,
+    0x99, 0x6B, 0xC0, 0x9B, 0x88, 0x98, 0x99, 0x54, 0xAD, 0xA5, 0xB7, 0x94, 0xA5, 0x97, 0x6E, 0x21,
+    0xC0, 0x7A, 0x6E, 0x51, 0xC0, 0x24, 0x3E, 0xA2, 0x79, 0xA1, 0x9A, 0x5B, 0x59, 0x7A, 0x26, 0x99,
+    0x99, 0x69, 0xA5, 0x8A, 0xA2, 0x7A, 0x46, 0x93, 0x79, 0x99, 0x89, 0xA2, 0x78, 0x99, 0x79, 0x97,
+    0x98, 0xAC, 0x88, 0xA7, 0x98, 0xA3, 0x89, 0x99, 0x88, 0x51, 0xA4, 0x88, 0xA3, 0x89, 0xA2, 0x88,
+    0x9D, 0x98, 0x92, 0x88, 0x7F, 0xA8, 0x88, 0xA3, 0x98, 0xA2, 0x88, 0xA3, 0x99, 0x66, 0xA2, 0x97,
+    0xA7, 0x99, 0xA3, 0x98, 0xA4, 0x98, 0x9D, 0x99, 0x50, 0xAB, 0x98, 0x96, 0x99, 0x8F, 0x89, 0x76,
+    0x7D, 0xA5, 0x86, 0xA6, 0x76, 0xA3, 0x96, 0xA2, 0x76, 0x69, 0xC0, 0x52, 0x51, 0x5A, 0x55, 0x52,
+    0xC0, 0x65, 0x9D, 0x9A, 0x9D, 0x9B, 0x9D, 0x9B, 0x9C, 0x9C, 0x53, 0x6E, 0x5A, 0xC1, 0x69, 0xA0,
+    0xA9, 0xA7, 0x88, 0xA8, 0x97, 0xA2, 0x98, 0x68, 0x41, 0x9C, 0x88, 0x41, 0xA2, 0x89, 0xA5, 0x7A,
+    0xA3, 0x9A, 0xC0, 0x66, 0x5A, 0x7F, 0x66, 0x13, 0x66, 0x3A, 0xC1, 0x6E, 0xC0, 0x06, 0xC1, 0x66,
+    0xC1, 0x66, 0x55, 0xC4, 0xA2, 0x78, 0xA5, 0x98, 0xA3, 0x89, 0x7B, 0x6E, 0x6E, 0x6B, 0xC2, 0x22,
+    0x29, 0xC0, 0x22, 0x0E, 0x65, 0x9A, 0x78, 0x9C, 0x88, 0xC0, 0x66, 0x69, 0xC2, 0x16, 0x23, 0x3E,
+    0x06, 0xC0, 0x3E, 0x32, 0xA3, 0x89, 0x95, 0x98, 0x90, 0x88, 0x6E, 0xAA, 0x98, 0xB8, 0x87, 0x91,
+    0x88, 0x96, 0x98, 0xA2, 0x78, 0x9A, 0x99, 0x56, 0x9D, 0x89, 0x66, 0x16, 0x56, 0x9D, 0x98, 0x66,
+    0x79, 0xB7, 0xA2, 0xAD, 0x91, 0xA2, 0x87, 0x7A, 0x55, 0x9B, 0x99, 0x6B, 0xA2, 0x87, 0xA3, 0x99,
+    0xA2, 0x78, 0xC0, 0x3C, 0x5A, 0x66, 0x3C, 0x6F, 0x6F, 0x7F, 0x6E, 0xA2, 0x89, 0xA2, 0x77, 0x66,
+    0x0D, 0xA2, 0x88, 0xA2, 0x89, 0xA2, 0x89, 0xA2, 0x7A, 0xA2, 0x7B, 0xA2, 0x7B, 0xA1, 0x8B, 0x94,
+    0x98, 0x8D, 0xA9, 0x7B, 0x56, 0x6E, 0xA2, 0x88, 0x6F, 0xC1, 0xA2, 0x88, 0xA2, 0x88, 0x7E, 0xC0,
+    0x6E, 0x6B, 0xC0, 0x08, 0x66, 0x08, 0x7E, 0x6D, 0xA2, 0x85, 0xA2, 0x75, 0x7D, 0x59, 0xA6, 0x8D,
+    0xAA, 0x7D, 0xC1, 0x64, 0x9F, 0x86, 0x66, 0xC0, 0x7E, 0x3D, 0x6F, 0x6F, 0x9D, 0xA6, 0x9C, 0x86,
+    0xA3, 0x89, 0xC1, 0x51, 0xC0, 0x9D, 0x88, 0x9B, 0x87, 0x9D, 0x89, 0x41, 0x9C, 0x88, 0xA2, 0x89,
+    0xA3, 0x89, 0x6B, 0xA8, 0x98, 0xA9, 0x88, 0x96, 0x89, 0x98, 0x88, 0xA7, 0x99, 0xA2, 0x88, 0xA2,
+    0x88, 0xA2, 0x88, 0x20, 0x9B, 0x99, 0x7F, 0xA2, 0x78, 0xA2, 0x9A, 0xA7, 0x99, 0xA2, 0x89, 0xA1,
+    0x8A, 0x65, 0x31, 0xC1, 0x9D, 0x98, 0x9B, 0x88, 0xC0, 0xA5, 0x98, 0xA3, 0x89, 0xC1, 0x51, 0x9B,
+    0x98, 0x95, 0x89, 0x99, 0x99, 0x6B, 0xC0, 0x6E, 0x3C, 0xC0, 0x6D, 0x01, 0x3A, 0xC4, 0x35, 0x69,
+    0x66, 0x2E, 0x29, 0x66, 0x18, 0x5A, 0xC0, 0x66, 0xC0, 0x59, 0xC0, 0x6B, 0xC0, 0x66, 0x78, 0xAB,
+    0xA4, 0xA5, 0x95, 0x9B, 0x97, 0x55, 0x9A, 0x7C, 0x96, 0x6C, 0x9D, 0x89, 0x6F, 0x9B, 0x9A, 0x9C,
+    0x89, 0xA2, 0x88, 0xC0, 0x9A, 0x88, 0x9C, 0x88, 0x74, 0xBE, 0x83, 0xAB, 0x94, 0x6E, 0x7F, 0x65,
+    0x65, 0x1A, 0x66, 0x7F, 0xA1, 0x8A, 0xA2, 0x7A, 0xA2, 0x88, 0x57, 0x56, 0x55, 0xC0, 0x9D, 0x89,
+    0x66, 0xA4, 0x88, 0x7F, 0x47, 0x92, 0x68, 0x9B, 0x79, 0xA3, 0x89, 0x41, 0x94, 0x89, 0x28, 0xA5,
+    0x89, 0x9C, 0x88, 0x9C, 0x78, 0x69, 0xA5, 0x99, 0xA2, 0x88, 0x6E, 0x52, 0x97, 0x98, 0x09, 0x05,
+    0x1C, 0x7F, 0xA3, 0x98, 0x7F, 0xC0, 0x7E, 0xA4, 0x98, 0x7A, 0xA4, 0x88, 0xA4, 0x88, 0x9C, 0x97,
+    0x38, 0x23, 0x89, 0xA9, 0x3D, 0xA3, 0x87, 0xA3, 0x86, 0xA5, 0x87, 0xA3, 0x97, 0xA2, 0x76, 0x65,
+    0x52, 0x9D, 0x8A, 0x9C, 0x99, 0x41, 0x44, 0x66, 0x7F, 0xC0, 0x5A, 0x77, 0x9F, 0x9B, 0x9D, 0x9C,
+    0x52, 0x56, 0xC0, 0x69, 0xC1, 0x20, 0xA3, 0xA8, 0xA8, 0x87, 0xA4, 0x98, 0x55, 0x9B, 0x89, 0x9D,
+    0x89, 0x56, 0xA3, 0x9A, 0xA7, 0x78, 0xA3, 0x89, 0x7E, 0xC0, 0x52, 0xC0, 0x65, 0x5A, 0x7B, 0x93,
+    0x95, 0xC0, 0x6E, 0x6E, 0x06, 0xC0, 0x66, 0xC3, 0x66, 0x2D, 0xC2, 0x6B, 0xC0, 0x01, 0xA5, 0x89,
+    0xA3, 0x88, 0x7F, 0xC0, 0x6F, 0xC7, 0x51, 0x64, 0x9B, 0x88, 0x9B, 0x99, 0x5A, 0xC0, 0x65, 0x6B,
+    0xC2, 0xA2, 0x88, 0xA2, 0x88, 0x06, 0xC0, 0x3E, 0x06, 0x3E, 0xA3, 0x98, 0x8D, 0x99, 0x95, 0x88,
+    0xA9, 0x98, 0xB5, 0x88, 0xC0, 0x96, 0x98, 0x9C, 0x77, 0x64, 0x9B, 0x99, 0x9D, 0x99, 0x42, 0x52,
+    0x55, 0x6B, 0x9C, 0x98, 0xAA, 0x97, 0xAE, 0x94, 0xA7, 0x91, 0xA5, 0x96, 0x51, 0x9D, 0x98, 0x56,
+    0xA3, 0x98, 0xA4, 0x88, 0xA2, 0x88, 0x66, 0x59, 0x61, 0x5A, 0xA2, 0x89, 0x01, 0xC0, 0x6B, 0xA2,
+    0x78, 0x7F, 0xA3, 0x88, 0x6B, 0x66, 0xA2, 0x77, 0xA2, 0x88, 0x7E, 0x5F, 0xA3, 0x8A, 0xA2, 0x8B,
+    0xA1, 0x8C, 0xA3, 0x7C, 0x91, 0xA9, 0x8D, 0x9A, 0x7B, 0xC0, 0x6E, 0xC3, 0xA2, 0x88, 0x6F, 0xA2,
+    0x88, 0xA2, 0x88, 0xA3, 0x98, 0xA2, 0x88, 0xC0, 0x55, 0x08, 0x7E, 0x6D, 0x7E, 0xA2, 0x75, 0xA1,
+    0x95, 0x5D, 0xA3, 0x9C, 0xAC, 0x7E, 0x6F, 0x69, 0x9F, 0x96, 0x9D, 0x97, 0x54, 0xC0, 0x65, 0xC0,
+    0x66, 0x7F, 0xC0, 0x54, 0x65, 0xA2, 0x88, 0x55, 0x9E, 0x86, 0x55, 0x65, 0x41, 0x9D, 0x89, 0x6E,
+    0x9D, 0x8A, 0x9B, 0x8A, 0xA2, 0x88, 0xA4, 0x89, 0x9C, 0x89, 0xA5, 0x89, 0xA7, 0x98, 0x95, 0x89,
+    0x51, 0xA4, 0x98, 0x6B, 0xA3, 0x99, 0xA4, 0x88, 0x6E, 0xA2, 0x88, 0x9B, 0x99, 0x9C, 0x89, 0xA4,
+    0x89, 0xA7, 0x99, 0xA4, 0x89, 0xA0, 0x8A, 0xC0, 0xA2, 0x88, 0xC0, 0x6B, 0x65, 0x9B, 0x88, 0x9A,
+    0x88, 0xC0, 0x51, 0x9D, 0x88, 0x52, 0x9D, 0x98, 0x51, 0x66, 0x3A, 0x67, 0xC0, 0x6E, 0x3C, 0x35,
+    0xC3, 0x3A, 0x35, 0xC0, 0x69, 0x66, 0xC0, 0x2E, 0xC0, 0x29, 0x65, 0x56, 0x66, 0x15, 0x10, 0x5A,
+    0x69, 0xC0, 0x0D, 0xC1, 0x65, 0xA2, 0x95, 0xAD, 0xA4, 0x9F, 0x96, 0x9D, 0x98, 0x9A, 0x7A, 0x97,
+    0x7C, 0x91, 0x7A, 0x53, 0xAC, 0x89, 0x99, 0x99, 0x9B, 0x89, 0x7E, 0x6F, 0x31, 0x9B, 0x98, 0xAF,
+    0x95, 0xB7, 0xA4, 0xA2, 0x86, 0x69, 0xC1, 0x7A, 0xA1, 0x8A, 0xA2, 0x88, 0xA1, 0x8A, 0xA3, 0x89,
+    0x53, 0x9C, 0x78, 0x5B, 0x7F, 0x51, 0x56, 0xA4, 0x88, 0xA2, 0x88, 0x52, 0x97, 0x79, 0x98, 0x69,
+    0xA2, 0x78, 0x6F, 0x97, 0x88, 0xA6, 0x88, 0xA4, 0x88, 0x9D, 0x89, 0x51, 0x40, 0xA5, 0x89, 0xA3,
+    0x98, 0xC0, 0x9C, 0x89, 0x9C, 0x88, 0xA3, 0x98, 0x12, 0xA3, 0x99, 0xA2, 0x88, 0x6B, 0x61, 0x7A,
+    0x9A, 0x88, 0x7F, 0x9A, 0x97, 0x9C, 0x88, 0x65, 0xA8, 0x88, 0xAF, 0xA8, 0xA5, 0x99, 0xA9, 0x98,
+    0x96, 0x99, 0x8F, 0x88, 0xA4, 0x85, 0xA2, 0x86, 0xA2, 0x87, 0x6D, 0x6E, 0x32, 0x9C, 0x8A, 0x9C,
+    0x89, 0x9D, 0x99, 0x46, 0x55, 0x55, 0xC0, 0x69, 0x7F, 0xA2, 0x88, 0xA1, 0x9B, 0x63, 0x52, 0x56,
+    0x66, 0x56, 0x11, 0x66, 0xC0, 0x11, 0xA4, 0x98, 0xA3, 0x98, 0x56, 0x3C, 0x7F, 0xA3, 0x79, 0xA3,
+    0x9A, 0xA6, 0x77, 0xA3, 0x98, 0x6E, 0x20, 0x25, 0x20, 0x51, 0x52, 0x69, 0x93, 0x96, 0x2B, 0x7F,
+    0xC0, 0x6F, 0xC0, 0x01, 0xC2, 0x3C, 0x55, 0xC3, 0x6E, 0x6B, 0x01, 0xA3, 0x89, 0xA5, 0x88, 0x7F,
+    0xC0, 0x6F, 0xC6, 0x69, 0x52, 0x50, 0x3E, 0x9D, 0x88, 0xC1, 0x0F, 0xC0, 0x16, 0xC0, 0x1B, 0x7E,
+    0x32, 0xA2, 0x78, 0x06, 0xC2, 0x7F, 0x06, 0x8B, 0x89, 0x9C, 0x98, 0xB8, 0x87, 0xC0, 0x50, 0xA7,
+    0x98, 0xA7, 0x94, 0x98, 0xA5, 0x95, 0x99, 0x9A, 0x7A, 0x9B, 0x8B, 0x9D, 0x79, 0x9C, 0x9A, 0x56,
+    0xA7, 0x97, 0x30, 0xAF, 0xA2, 0xA3, 0x96, 0x55, 0xA2, 0x87, 0xA3, 0x98, 0xA3, 0x89, 0xA3, 0x98,
+    0x56, 0x50, 0x66, 0x69, 0x7F, 0xA2, 0x78, 0x7A, 0x32, 0x39, 0xA2, 0x88, 0xA2, 0x89, 0xA2, 0x88,
+    0x6B, 0xC0, 0xA3, 0x88, 0x69, 0x69, 0x6E, 0xA4, 0x78, 0xA3, 0x8C, 0xA1, 0x8D, 0x9F, 0x8C, 0x8C,
+    0x89, 0x96, 0x9B, 0x7B, 0xC0, 0x6F, 0xC0, 0x24, 0x2B, 0x7E, 0x6F, 0xC1, 0x6E, 0x7E, 0xA2, 0x88,
+    0xA2, 0x88, 0xA2, 0x88, 0x7E, 0x6D, 0x6E, 0x79, 0x6D, 0xA1, 0x85, 0xA2, 0x78, 0xAD, 0x8D, 0xA3,
+    0x8C, 0x9F, 0x96, 0x9E, 0x86, 0x60, 0x64, 0x55, 0x69, 0x66, 0x65, 0x65, 0xC0, 0x69, 0x6E, 0xC0,
+    0x61, 0x59, 0x9F, 0x96, 0x59, 0xC0, 0x51, 0x47, 0x6B, 0x9D, 0x8A, 0x42, 0xA3, 0x8A, 0x52, 0x98,
+    0x89, 0xA3, 0x88, 0xC0, 0x56, 0x3C, 0x6F, 0x7A, 0x56, 0xA4, 0x88, 0xA5, 0x99, 0xA2, 0x88, 0x9D,
+    0x99, 0x52, 0xA6, 0x88, 0xA6, 0x99, 0x53, 0x7F, 0xA2, 0x78, 0xA4, 0x99, 0x6F, 0xC0, 0x6B, 0x9D,
+    0x98, 0x94, 0x77, 0x97, 0x99, 0x51, 0x7F, 0x6F, 0xC3, 0x35, 0xC0, 0x01, 0x66, 0x35, 0xC1, 0x5A,
+    0x35, 0xC0, 0x32, 0x75, 0xC0, 0x6E, 0xC2, 0x29, 0x51, 0x66, 0x69, 0x10, 0x5A, 0xC5, 0x15, 0x64,
+    0xA3, 0xA4, 0xAA, 0x84, 0x74, 0x9A, 0x8A, 0x9F, 0x8C, 0x9B, 0x6B, 0x91, 0x8A, 0x99, 0x8A, 0xA3,
+    0x99, 0x9D, 0x89, 0x7E, 0x0D, 0x2A, 0x51, 0xC0, 0xAA, 0xA4, 0xB0, 0x85, 0xA6, 0x87, 0x7E, 0xA4,
+    0x87, 0x7A, 0x6F, 0xA2, 0x8A, 0x6F, 0x5A, 0x9A, 0x89, 0x5B, 0xA3, 0x8A, 0xA2, 0x88, 0x3D, 0x6B,
+    0x6E, 0x6B, 0x9A, 0x78, 0x9A, 0x78, 0xA4, 0x69, 0x56, 0x93, 0x89, 0x7E, 0xA4, 0x78, 0x6E, 0xA3,
+    0x89, 0x55, 0x65, 0xA2, 0x88, 0xA4, 0x88, 0x51, 0x9D, 0x99, 0xA2, 0x78, 0xA4, 0x88, 0xA2, 0x98,
+    0x5A, 0x9A, 0x98, 0x9A, 0x78, 0x9A, 0x98, 0x9D, 0xA9, 0x7B, 0xA6, 0x88, 0xA2, 0x77, 0xA3, 0x98,
+    0xA4, 0x98, 0xAB, 0x98, 0xA4, 0x98, 0xA5, 0xA9, 0x66, 0x17, 0x8D, 0x97, 0x9C, 0x86, 0x6D, 0x66,
+    0xC1, 0x51, 0x42, 0x56, 0x6B, 0x55, 0x55, 0x51, 0x65, 0x59, 0x7A, 0xA2, 0x88, 0xA2, 0x99, 0xA1,
+    0x9B, 0x52, 0x9D, 0x9A, 0x56, 0x66, 0xC1, 0x56, 0xC0, 0x0C, 0xC0, 0xA3, 0x88, 0xA3, 0x99, 0xA2,
+    0x89, 0xA3, 0x88, 0xA4, 0x89, 0xA5, 0x88, 0x7E, 0x6F, 0x20, 0xC0, 0x6E, 0x18, 0x51, 0x65, 0x93,
+    0x96, 0x6E, 0xC0, 0x7F, 0xC1, 0x6B, 0xC0, 0x3A, 0x66, 0x6B, 0x55, 0xC1, 0x6B, 0x2D, 0x6F, 0x34,
+    0x39, 0xA3, 0x99, 0xA5, 0x88, 0xA2, 0x88, 0xC0, 0x6F, 0x7E, 0x29, 0xC4, 0x1D, 0x55, 0x9C, 0x87,
+    0x9A, 0x88, 0x56, 0xC0, 0x69, 0x67, 0x1B, 0xC1, 0x7A, 0x23, 0x6F, 0x7F, 0x6E, 0x7A, 0xC2, 0xA2,
+    0x88, 0x9C, 0x88, 0x8B, 0x99, 0xA9, 0x88, 0xAD, 0x96, 0x5A, 0xAB, 0xA8, 0xA5, 0xB2, 0x9B, 0x92,
+    0x9A, 0xA8, 0x43, 0x9D, 0x8A, 0x9B, 0x7B, 0x9B, 0x8B, 0xA1, 0xA7, 0x55, 0xA3, 0x97, 0xA8, 0x85,
+    0x7D, 0xC0, 0xA3, 0x88, 0xA2, 0x89, 0x7E, 0x6E, 0x9D, 0x99, 0x0A, 0x7E, 0x6E, 0x2D, 0x32, 0x2D,
+    0xC0, 0x6F, 0xA3, 0x89, 0x28, 0x6F, 0x6B, 0x7F, 0xA2, 0x87, 0x6D, 0x64, 0x7E, 0xA3, 0x79, 0xA2,
+    0x7B, 0xA4, 0x7C, 0x98, 0x8B, 0x8B, 0x9B, 0x9F, 0x9B, 0x6B, 0xC0, 0x6B, 0x6E, 0x24, 0x30, 0x7E,
+    0x6F, 0xC1, 0x7A, 0xC0, 0x56, 0x07, 0xA3, 0x87, 0xA2, 0x88, 0xA2, 0x87, 0x7E, 0x6D, 0x6D, 0x69,
+    0xAC, 0x7A, 0xA8, 0x7C, 0xA0, 0x85, 0x9C, 0xA5, 0x50, 0x64, 0x55, 0x69, 0x66, 0xC0, 0x69, 0x65,
+    0x65, 0x59, 0xC0, 0x65, 0x65, 0x59, 0x6D, 0x69, 0x65, 0x56, 0x57, 0x5B, 0x9C, 0x7A, 0x57, 0xA1,
+    0x7A, 0x9A, 0x9A, 0x9C, 0x78, 0x6F, 0x66, 0xA2, 0x88, 0x6E, 0x20, 0xC0, 0x7A, 0xA4, 0x78, 0xA2,
+    0x98, 0x9D, 0x89, 0xC0, 0xA4, 0x99, 0xA9, 0x89, 0xA5, 0x99, 0x9A, 0x88, 0x66, 0xA7, 0x9A, 0xA6,
+    0x8A, 0x6B, 0xC3, 0x9D, 0x98, 0x97, 0x89, 0x96, 0x88, 0x52, 0x09, 0x01, 0xC0, 0x65, 0xC0, 0x5A,
+    0x35, 0xC0, 0x32, 0x66, 0xC2, 0x32, 0xC0, 0x35, 0xC1, 0x7E, 0xC0, 0x66, 0x55, 0x51, 0x65, 0xC0,
+    0x5A, 0x6B, 0xC5, 0x15, 0xA4, 0x86, 0x9F, 0xA5, 0x9F, 0x93, 0xA7, 0xA8, 0x9B, 0x9B, 0x57, 0xA6,
+    0x6A, 0x18, 0x06, 0x95, 0x9A, 0x9B, 0x88, 0x50, 0xC0, 0x51, 0x66, 0xA2, 0x78, 0x12, 0xAD, 0xA6,
+    0x7D, 0xA3, 0x86, 0xAD, 0xA6, 0xA3, 0x98, 0x57, 0xA2, 0x89, 0x56, 0x9C, 0x78, 0x9D, 0x8A, 0xA4,
+    0x79, 0xA4, 0x89, 0x56, 0x7B, 0x41, 0x56, 0x41, 0x9C, 0x78, 0x6E, 0xA2, 0x79, 0x91, 0x89, 0x96,
+    0x88, 0x3B, 0xA8, 0x78, 0xA4, 0x78, 0x9C, 0x87, 0x51, 0xA5, 0x89, 0xA4, 0x88, 0x65, 0x2D, 0x6E,
+    0xA2, 0x98, 0x56, 0x99, 0x98, 0x99, 0x89, 0x9D, 0x98, 0xA2, 0x78, 0xA4, 0x98, 0x39, 0xA4, 0x88,
+    0x6E, 0xC0, 0xA5, 0x89, 0xA4, 0xA8, 0xA6, 0x98, 0xA2, 0xA8, 0x61, 0x7A, 0x7A, 0x68, 0x8D, 0x97,
+    0x54, 0x53, 0x66, 0x25, 0x6E, 0x5A, 0xC0, 0x56, 0xC0, 0x51, 0x55, 0x65, 0x5A, 0x79, 0x7E, 0xA3,
+    0x89, 0xA1, 0xAB, 0x67, 0x9D, 0x8A, 0x52, 0xC0, 0x66, 0xC3, 0x7F, 0xA5, 0x78, 0xA2, 0x88, 0xA2,
+    0x89, 0xA2, 0x88, 0xA4, 0x88, 0xA3, 0x99, 0xA2, 0x77, 0x7A, 0xC3, 0x51, 0x56, 0x92, 0x95, 0xC1,
+    0x6E, 0x7B, 0x6E, 0xC1, 0x35, 0xC0, 0x56, 0xC4, 0x6B, 0xC1, 0xA3, 0x88, 0xA4, 0x88, 0xA4, 0x88,
+    0x6E, 0xC0, 0x7B, 0x5A, 0xC4, 0x1D, 0x50, 0x9A, 0x78, 0x9D, 0x88, 0x66, 0xC1, 0x20, 0x1B, 0xC0,
+    0x20, 0x7A, 0xC0, 0x6B, 0x7E, 0x6F, 0x7E, 0xC2, 0x6E, 0x7F, 0x50, 0x95, 0x88, 0xA8, 0x97, 0xAC,
+    0x97, 0xA4, 0x85, 0xA1, 0xA2, 0x9D, 0x92, 0x9C, 0x99, 0x9C, 0x9A, 0x9D, 0x8A, 0x56, 0x56, 0x7B,
+    0x6E, 0xA2, 0x87, 0xA3, 0x87, 0xC1, 0x6B, 0x7E, 0xC0, 0x0A, 0x66, 0x19, 0xC0, 0x6E, 0x7F, 0x5A,
+    0x2D, 0x7F, 0x6F, 0xA2, 0x89, 0xA2, 0x78, 0x6B, 0x6B, 0x7F, 0xA2, 0x76, 0x7C, 0x6D, 0x7A, 0xA1,
+    0x9A, 0xA2, 0x7C, 0xA3, 0x7D, 0xA1, 0x7C, 0x88, 0x8A, 0x9B, 0x9A, 0x7A, 0x6B, 0x6E, 0xC0, 0x2B,
+    0x30, 0x7F, 0x6E, 0xC0, 0x7E, 0x6B, 0x0C, 0xC0, 0x7F, 0x69, 0x6E, 0x7E, 0x79, 0xA2, 0x77, 0xA2,
+    0x77, 0xA7, 0x78, 0xAF, 0x8B, 0x69, 0x9C, 0xA4, 0x9D, 0x96, 0x54, 0x65, 0xC0, 0x65, 0x5A, 0xC0,
+    0x79, 0x69, 0x56, 0x65, 0xC0, 0x69, 0x59, 0x2E, 0x64, 0x66, 0xC0, 0x56, 0x9D, 0x8A, 0x9B, 0x7D,
+    0x9D, 0x7A, 0x5F, 0x6B, 0x9C, 0x89, 0x56, 0x66, 0x56, 0xA3, 0x98, 0x6F, 0x6E, 0xC0, 0x7F, 0x7E,
+    0xC0, 0x51, 0xA3, 0x89, 0xA2, 0x99, 0xA6, 0x89, 0xA2, 0x88, 0x65, 0xC0, 0xA7, 0x9A, 0xA6, 0x8A,
+    0xA2, 0x9A, 0x6F, 0xC2, 0x6B, 0xC0, 0x9D, 0x98, 0x91, 0x89, 0x9A, 0x88, 0xC0, 0x35, 0xC0, 0x56,
+    0xC0, 0x35, 0xC0, 0x2D, 0xC0, 0x69, 0xC0, 0x2D, 0x6E, 0x35, 0x6E, 0x7A, 0xC3, 0x51, 0x51, 0x65,
+    0x06, 0xC0, 0x0D, 0xC5, 0x7D, 0xA6, 0x86, 0xA5, 0xA5, 0x9C, 0x94, 0x96, 0x88, 0x6F, 0xA4, 0x89,
+    0xA7, 0x8B, 0x9F, 0x8C, 0xA1, 0x8A, 0x57, 0x55, 0x3D, 0x15, 0x55, 0xA2, 0x88, 0x29, 0xA3, 0x88,
+    0x3D, 0x97, 0x97, 0x9B, 0x95, 0xB5, 0x86, 0xA4, 0x97, 0x9D, 0x99, 0x6F, 0x1F, 0x9C, 0x79, 0xA1,
+    0x8A, 0xA4, 0x89, 0x6F, 0x9D, 0x9A, 0x56, 0x55, 0x56, 0x6E, 0x5A, 0x41, 0x90, 0x79, 0x9A, 0x78,
+    0xAD, 0x98, 0xA9, 0x89, 0xA2, 0x88, 0x99, 0x78, 0x61, 0xA6, 0x78, 0x7E, 0x9D, 0x99, 0xC0, 0x51,
+    0x39, 0x56, 0x9A, 0x87, 0x66, 0xA5, 0x89, 0xA4, 0x88, 0x21, 0x3A, 0xA2, 0x89, 0x32, 0x65, 0x15,
+    0x7E, 0xA3, 0x98, 0x9C, 0x98, 0x96, 0xA9, 0x61, 0xB5, 0xA9, 0x65, 0xA3, 0xA7, 0x98, 0x77, 0x8E,
+    0x98, 0x6F, 0x6B, 0xA2, 0x87, 0x6D, 0x56, 0x5A, 0x59, 0xC0, 0x56, 0x65, 0x55, 0x7A, 0x69, 0x6E,
+    0xA2, 0x99, 0xA2, 0x9A, 0xA0, 0x8A, 0x9D, 0x9A, 0x51, 0x56, 0x66, 0xC1, 0x11, 0x6B, 0xA3, 0x98,
+    0xA4, 0x78, 0x7F, 0xA2, 0x88, 0xA2, 0x78, 0xA3, 0x99, 0xA3, 0x88, 0x7F, 0xC0, 0x6E, 0xC0, 0x7A,
+    0xC0, 0x18, 0x65, 0x91, 0x96, 0xC1, 0x6E, 0xC0, 0x6B, 0xC3, 0x2D, 0xC4, 0x34, 0xC0, 0x2D, 0x6F,
+    0xA2, 0x88, 0xA5, 0x88, 0xA4, 0x88, 0x6B, 0xC5, 0x65, 0x55, 0x9A, 0x87, 0x9C, 0x88, 0xC1, 0x5A,
+    0x23, 0x6E, 0x23, 0xC3, 0x6B, 0x6E, 0x7E, 0x6F, 0x7A, 0xC1, 0x0B, 0x69, 0x3F, 0xAA, 0x77, 0xA2,
+    0xA7, 0xA2, 0x96, 0xA2, 0x85, 0x9E, 0x82, 0x9C, 0xA3, 0x9C, 0x89, 0x9C, 0x9A, 0x52, 0x6E, 0x6E,
+    0x7F, 0x6B, 0x6E, 0x69, 0x05, 0xC2, 0x0A, 0x7F, 0x6E, 0x19, 0x6F, 0x7E, 0x6B, 0xC0, 0x6E, 0x7F,
+    0xA2, 0x89, 0x5A, 0x6F, 0x7B, 0x6F, 0xA2, 0x87, 0x6D, 0xA2, 0x85, 0xC0, 0x7F, 0xA2, 0x8A, 0xA3,
+    0x7C, 0xA3, 0x7E, 0xA2, 0x7C, 0x8A, 0x99, 0x93, 0x99, 0xA2, 0x88, 0xC0, 0x7B, 0xC1, 0x6E, 0x7A,
+    0x6E, 0x6B, 0x6E, 0x7E, 0x66, 0x0C, 0x7F, 0x6D, 0x7E, 0xC0, 0x79, 0x69, 0xA3, 0x78, 0xB1, 0x78,
+    0xA6, 0x78, 0x9B, 0xA5, 0x9D, 0x95, 0x9F, 0x96, 0x66, 0x65, 0x5A, 0x69, 0xC0, 0x6E, 0x17, 0x65,
+    0xC0, 0x6B, 0xC0, 0x68, 0x9F, 0x86, 0x64, 0x55, 0x53, 0x9C, 0x9C, 0x57, 0x9F, 0x8D, 0x9D, 0x8C,
+    0x46, 0x41, 0x9B, 0x77, 0x9D, 0x88, 0xA2, 0x88, 0xA3, 0x98, 0x5A, 0x2C, 0x6F, 0xA2, 0x87, 0xC0,
+    0xA2, 0x78, 0x66, 0xC0, 0x66, 0x7E, 0xA1, 0x8A, 0xA5, 0x98, 0x6B, 0x7A, 0xA2, 0x88, 0xA6, 0x88,
+    0xA5, 0x9A, 0xA4, 0x8A, 0xA5, 0x9A, 0x6B, 0x23, 0x55, 0x7B, 0x23, 0xC0, 0x9D, 0x9A, 0x90, 0x88,
+    0x9A, 0x88, 0xC1, 0x5A, 0x66, 0xC0, 0x35, 0x2D, 0x69, 0x66, 0x26, 0x2D, 0x35, 0x3A, 0x7A, 0xC1,
+    0x66, 0x3D, 0xC0, 0x51, 0x51, 0x51, 0xC2, 0x6B, 0x6E, 0xC3, 0xA3, 0x97, 0xA6, 0x85, 0xA3, 0x96,
+    0xA2, 0x95, 0x50, 0x94, 0x88, 0x9A, 0x89, 0xAA, 0x8B, 0xA9, 0x8C, 0x52, 0x42, 0x7F, 0x6F, 0x9D,
+    0x88, 0x61, 0x6F, 0x55, 0xC0, 0x38, 0x9D, 0x87, 0x96, 0x86, 0xB0, 0x86, 0xA6, 0x86, 0x17, 0x7E,
+    0x17, 0x9B, 0x7A, 0xA3, 0x89, 0xA2, 0x89, 0x9D, 0x9A, 0x9D, 0x89, 0x6B, 0xA5, 0x88, 0x5A, 0xC0,
+    0x9D, 0x78, 0x93, 0x79, 0x95, 0x99, 0xAE, 0x78, 0xAB, 0x88, 0x7F, 0x99, 0x88, 0xA2, 0x78, 0xA3,
+    0x99, 0x9C, 0x88, 0x9B, 0x88, 0x99, 0x99, 0x69, 0x21, 0xA2, 0x88, 0xA3, 0x98, 0xA4, 0x78, 0x1E,
+    0x7F, 0xA2, 0x87, 0xA3, 0x89, 0x01, 0x9C, 0x87, 0xC0, 0xA6, 0x88, 0xA3, 0x89, 0x0D, 0x9D, 0x99,
+    0x00, 0xA1, 0xA9, 0xA5, 0xA9, 0xA8, 0x97, 0xB1, 0x99, 0x61, 0xA2, 0x98, 0x02, 0x95, 0x98, 0xA2,
+    0x88, 0x69, 0x69, 0x59, 0x5E, 0x66, 0xC0, 0x55, 0x66, 0x59, 0x7A, 0xC0, 0x6E, 0xA3, 0x98, 0xA2,
+    0x9A, 0xA0, 0x8A, 0x62, 0x9D, 0x99, 0x42, 0xC1, 0x66, 0xC0, 0xA2, 0x88, 0x08, 0xA3, 0x89, 0x6E,
+    0x7F, 0xA2, 0x78, 0xA3, 0x99, 0xA2, 0x88, 0x7E, 0x6F, 0x7E, 0xC0, 0x18, 0x6E, 0x18, 0xC0, 0x91,
+    0x95, 0xC1, 0x26, 0xC1, 0x6F, 0xC2, 0x66, 0xC7, 0x5A, 0x7F, 0xA3, 0x88, 0xA4, 0x88, 0xA4, 0x88,
+    0x6B, 0xC0, 0x31, 0xC1, 0x51, 0x3A, 0x9D, 0x88, 0x2A, 0x69, 0x6F, 0xC5, 0x23, 0xC0, 0x2A, 0xC0,
+    0x2F, 0x32, 0x6F, 0x6E, 0xC0, 0x7A, 0x69, 0x2B, 0xA6, 0x78, 0xB6, 0x99, 0x9F, 0xA6, 0x98, 0x83,
+    0x9F, 0x95, 0x9E, 0x94, 0x9C, 0x95, 0x9C, 0x89, 0x51, 0x67, 0x6E, 0xA2, 0x88, 0x66, 0x56, 0xC0,
+    0x19, 0x1E, 0x19, 0xC0, 0x1E, 0xC0, 0x6B, 0x19, 0xC0, 0xA2, 0x89, 0xA2, 0x78, 0x66, 0xC0, 0xA2,
+    0x88, 0xC0, 0x6B, 0x6B, 0xA2, 0x78, 0x7E, 0x6E, 0xA2, 0x86, 0x6D, 0x69, 0xA2, 0x88, 0xA2, 0x8A,
+    0xA2, 0x89, 0xA1, 0x8D, 0xA4, 0x6D, 0xA1, 0x8C, 0x8F, 0xA9, 0x8D, 0x9A, 0xA2, 0x88, 0x66, 0xC1,
+    0x5A, 0x17, 0x1C, 0x21, 0x7B, 0x6E, 0x7E, 0x6F, 0x7E, 0x6F, 0xA2, 0x87, 0x7E, 0x69, 0x75, 0xC0,
+    0xA7, 0x77, 0xB1, 0x78, 0x9E, 0x83, 0x9C, 0x94, 0x64, 0x65, 0x55, 0x65, 0xC6, 0x66, 0x69, 0x54,
+    0x64, 0x69, 0x9F, 0x8B, 0x9E, 0x8D, 0xA0, 0x8D, 0xA1, 0x8D, 0xA5, 0x8C, 0xA1, 0x9A, 0x6E, 0x9C,
+    0x87, 0x96, 0x65, 0x96, 0x77, 0x9D, 0x87, 0xA4, 0x77, 0x7E, 0xC0, 0x24, 0xA2, 0x77, 0x7F, 0x6E,
+    0x7A, 0xC1, 0xA2, 0x89, 0x7E, 0x6B, 0x6F, 0xC0, 0xA3, 0x98, 0xA7, 0x98, 0xA5, 0x9A, 0xA5, 0x9A,
+    0xA5, 0x9B, 0xC0, 0x9D, 0x97, 0x9B, 0x88, 0xA3, 0x99, 0xA3, 0x99, 0x94, 0x79, 0x98, 0x89, 0x67,
+    0x56, 0x69, 0x66, 0x5A, 0x66, 0xC2, 0x65, 0xC1, 0x2D, 0x35, 0x3A, 0x7B, 0x35, 0xC1, 0x7A, 0xC0,
+    0x55, 0x9D, 0x98, 0x56, 0xC2, 0x5A, 0xC0, 0x6B, 0x7A, 0xC0, 0x6D, 0xA5, 0x97, 0xA4, 0x86, 0xA2,
+    0x86, 0xA2, 0x86, 0x7C, 0xC0, 0x96, 0x99, 0x99, 0x8B, 0xAC, 0x8C, 0xA4, 0x79, 0x9D, 0x99, 0x5B,
+    0x65, 0x9D, 0x89, 0x38, 0x6E, 0xC1, 0x38, 0x9D, 0x88, 0x9A, 0x87, 0xA2, 0x87, 0xAB, 0x86, 0xA5,
+    0x98, 0x9C, 0x88, 0x9B, 0x88, 0x9C, 0x8A, 0xA6, 0x78, 0x9C, 0x89, 0xA3, 0x9A, 0xA5, 0x89, 0xA5,
+    0x89, 0x55, 0x9D, 0x99, 0x9C, 0x77, 0x90, 0x68, 0x99, 0x89, 0xAF, 0x88, 0xAA, 0x78, 0x66, 0x95,
+    0x88, 0x51, 0x56, 0x9A, 0x88, 0x9D, 0x98, 0xA2, 0x88, 0xA4, 0x88, 0x3D, 0xA3, 0x89, 0xA5, 0x98,
+    0xA3, 0x89, 0xA2, 0x87, 0xC0, 0x09, 0x3A, 0x9B, 0x89, 0x9D, 0x98, 0xA2, 0x89, 0xA5, 0x98, 0x9B,
+    0x99, 0x97, 0x88, 0xA3, 0x99, 0xA4, 0x87, 0xA7, 0x99, 0xA3, 0x98, 0xA5, 0xAA, 0x9C, 0x97, 0x8B,
+    0xA9, 0x23, 0xB6, 0x99, 0xA9, 0x88, 0x88, 0x88, 0x98, 0x88, 0x7D, 0x59, 0xC0, 0x59, 0xC1, 0x55,
+    0x37, 0xC0, 0x30, 0xC0, 0x3C, 0xA3, 0x98, 0xA2, 0x99, 0xA0, 0x8A, 0x62, 0x52, 0x51, 0x6B, 0xC0,
+    0x56, 0xC0, 0xA3, 0x88, 0xA3, 0x99, 0xA2, 0x88, 0x6F, 0xA2, 0x87, 0x7F, 0xA3, 0x89, 0xA2, 0x88,
+    0x7E, 0x6F, 0x7E, 0xC0, 0x5A, 0xC0, 0x18, 0xC0, 0x93, 0x95, 0x65, 0x56, 0x66, 0xC1, 0x6F, 0xC1,
+    0x2D, 0xC7, 0x5A, 0xC2, 0x3E, 0x21, 0xA2, 0x88, 0x01, 0x7E, 0x5A, 0x01, 0x50, 0x9D, 0x88, 0x51,
+    0x2A, 0xC0, 0x2F, 0xC3, 0x6E, 0xC1, 0x2F, 0xC1, 0x32, 0x6E, 0xC1, 0x6E, 0x3F, 0x37, 0xA2, 0x88,
+    0xB6, 0x88, 0xA6, 0x89, 0x9B, 0xA4, 0x99, 0xA3, 0x9D, 0x94, 0x64, 0x51, 0x9D, 0x99, 0x59, 0x6B,
+    0xC0, 0x52, 0x65, 0x6B, 0x1D, 0xC2, 0x7F, 0x6E, 0x1D, 0x66, 0x1D, 0x31, 0xA1, 0x8A, 0x7B, 0x6F,
+    0x7F, 0x6E, 0xC0, 0x7F, 0x6F, 0x59, 0x79, 0x7C, 0x6C, 0x6E, 0x7F, 0xA2, 0x79, 0xA3, 0x99, 0xA1,
+    0x8A, 0xA1, 0x8B, 0xA2, 0x7E, 0x1C, 0x90, 0x98, 0x8D, 0x9A, 0x7F, 0xC0, 0x56, 0xC5, 0x19, 0x1C,
+    0xA2, 0x88, 0x6E, 0xA2, 0x88, 0x7F, 0x7E, 0x69, 0x69, 0x69, 0xAE, 0x76, 0xAB, 0x85, 0x99, 0xA3,
+    0x9E, 0x85, 0x69, 0x65, 0x31, 0x69, 0xC0, 0x66, 0x22, 0xC1, 0x2A, 0x25, 0x22, 0x68, 0x61, 0xC0,
+    0xA0, 0x8A, 0x9F, 0x8C, 0xA1, 0x8F, 0xA2, 0x7E, 0xA2, 0x8B, 0x95, 0x89, 0x99, 0x9A, 0xA8, 0x78,
+    0xA8, 0x88, 0xA4, 0x86, 0x98, 0x75, 0x91, 0x87, 0x9B, 0x77, 0xA3, 0x87, 0xA2, 0x88, 0x10, 0xC0,
+    0x24, 0xA2, 0x87, 0x66, 0x6F, 0x6E, 0xA1, 0xA9, 0xA2, 0x88, 0x5A, 0x6B, 0x20, 0xA3, 0x89, 0xA5,
+    0xA9, 0xA5, 0x99, 0xA6, 0x98, 0xA7, 0x9B, 0x6E, 0x98, 0x97, 0x9B, 0x87, 0xA6, 0x88, 0x09, 0x57,
+    0x92, 0x89, 0x96, 0x8A, 0xA2, 0x87, 0xC0, 0x66, 0x2D, 0xC1, 0x65, 0x5A, 0x66, 0x1E, 0x21, 0x2D,
+    0x7A, 0x35, 0x7A, 0x35, 0x65, 0xC0, 0x6E, 0x29, 0x9D, 0x98, 0x55, 0x6B, 0xC0, 0x5A, 0xC0, 0x66,
+    0xC0, 0x6F, 0xC1, 0x7D, 0xA4, 0x86, 0xA3, 0x97, 0xA2, 0x86, 0xA2, 0x86, 0x6D, 0x69, 0x7B, 0x9D,
+    0x9B, 0xA0, 0x7A, 0xA2, 0x8A, 0x67, 0x52, 0x51, 0x55, 0x66, 0x6F, 0xC2, 0x9D, 0x99, 0x51, 0x55,
+    0xA6, 0x86, 0x58, 0x9B, 0x98, 0x6B, 0xA2, 0x88, 0xA4, 0x79, 0xA2, 0x88, 0xA4, 0x89, 0xA3, 0x99,
+    0x46, 0x9B, 0x88, 0x9C, 0x89, 0x90, 0x78, 0x9B, 0x78, 0xB1, 0x88, 0xA9, 0x89, 0x97, 0x88, 0x8F,
+    0x99, 0x9A, 0x88, 0xA5, 0x88, 0x14, 0xA4, 0x88, 0xA7, 0x88, 0xA5, 0x89, 0xA3, 0x98, 0xA2, 0x88,
+    0xA2, 0x88, 0x66, 0x21, 0xC0, 0x0D, 0x9D, 0x88, 0x39, 0xC0, 0xA3, 0x89, 0xA4, 0x87, 0x35, 0x9B,
+    0x99, 0x3C, 0xA8, 0x88, 0xAB, 0x98, 0x66, 0xA3, 0x98, 0xA5, 0x89, 0x7A, 0x91, 0xA8, 0x98, 0x99,
+    0xAC, 0xA7, 0xB5, 0x99, 0xA2, 0x77, 0x87, 0x99, 0x9A, 0x76, 0x7E, 0x51, 0x5A, 0x7E, 0xA2, 0x78,
+    0xC0, 0x55, 0x66, 0xC1, 0x7E, 0xA2, 0x87, 0xA2, 0x8A, 0xA0, 0x9A, 0x62, 0x42, 0xC1, 0x6B, 0xC1,
+    0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x88, 0x6F, 0xA2, 0x87, 0x7F, 0xA2, 0x88, 0x6F, 0x7E, 0xA2, 0x88,
+    0x6F, 0xC0, 0x6E, 0x18, 0xC0, 0x0C, 0x3F, 0x65, 0x66, 0xC0, 0x5A, 0x66, 0xC0, 0x6F, 0x66, 0xC8,
+    0x25, 0xC3, 0x6E, 0x7F, 0x6F, 0xC1, 0x39, 0x5A, 0x55, 0x7E, 0xC4, 0x6E, 0xC0, 0x3E, 0x6E, 0x3E,
+    0x69, 0x32, 0xC1, 0x37, 0xC1, 0x6E, 0x37, 0xA2, 0x87, 0xB4, 0x88, 0xA8, 0x8A, 0x64, 0x9A, 0xA5,
+    0x9B, 0x94, 0x9C, 0x84, 0x64, 0x52, 0xC1, 0x6B, 0x57, 0x66, 0x66, 0xC1, 0x19, 0x14, 0x59, 0x7A,
+    0x6E, 0xC0, 0x6E, 0x7F, 0xC1, 0x6B, 0x7F, 0xA2, 0x88, 0xC2, 0x54, 0x6C, 0x78, 0x78, 0x6C, 0xA2,
+    0x88, 0xA1, 0x8A, 0xA2, 0x89, 0xA2, 0x7A, 0xA2, 0x88, 0xA1, 0x8B, 0xA2, 0x7D, 0xA3, 0x7D, 0x8A,
+    0x9A, 0x94, 0x89, 0xA1, 0x9A, 0x66, 0xC0, 0x28, 0x23, 0xC0, 0x28, 0x5A, 0x66, 0x69, 0xC1, 0x28,
+    0x6E, 0x7F, 0xA2, 0x87, 0xC0, 0x7E, 0x68, 0xB2, 0x83, 0xA5, 0x82, 0x99, 0xA4, 0x64, 0x6D, 0x66,
+    0xC0, 0x55, 0xC0, 0x66, 0xC1, 0x6B, 0xC2, 0x08, 0x65, 0x67, 0xA1, 0x8D, 0xA0, 0x7F, 0xA1, 0x8E,
+    0x9E, 0x8C, 0x8E, 0x89, 0x92, 0x78, 0x55, 0xA4, 0x89, 0xB7, 0x89, 0xAB, 0x98, 0x9D, 0x97, 0x9C,
+    0x76, 0x94, 0x65, 0x9B, 0x87, 0xA2, 0x87, 0x69, 0x56, 0x7A, 0xC0, 0x7A, 0xA3, 0x78, 0x6E, 0xC0,
+    0xA2, 0x89, 0x6E, 0x56, 0x7F, 0xA3, 0x98, 0xA2, 0x99, 0xA5, 0xA8, 0xA8, 0x8A, 0xA9, 0x8A, 0x7F,
+    0x9D, 0x97, 0x9D, 0x96, 0xA3, 0x89, 0x0E, 0xA0, 0x8B, 0xC0, 0x90, 0x8A, 0x97, 0x88, 0x7E, 0x66,
+    0x56, 0xC0, 0x69, 0x66, 0x5A, 0x66, 0xC0, 0x1E, 0x21, 0xC0, 0x7F, 0xC0, 0x29, 0xC1, 0x66, 0x55,
+    0x9D, 0x98, 0x56, 0x6E, 0x6B, 0x6E, 0xC0, 0x39, 0xC0, 0x6B, 0xC0, 0x6E, 0x7D, 0xA3, 0x87, 0xA3,
+    0x96, 0xA2, 0x86, 0x6E, 0x69, 0x69, 0x66, 0x9F, 0x9B, 0x6B, 0xA0, 0x8A, 0x6F, 0x62, 0x56, 0x66,
+    0xC0, 0x36, 0x6B, 0xC1, 0x61, 0x42, 0x15, 0xA6, 0x76, 0x9C, 0x87, 0x9D, 0x88, 0xA6, 0x99, 0xA4,
+    0x78, 0xA2, 0x89, 0xA3, 0x99, 0xC0, 0x56, 0x99, 0x78, 0x95, 0x89, 0x95, 0x78, 0xA4, 0x88, 0xAE,
+    0x78, 0x9C, 0x78, 0x92, 0x88, 0x9A, 0x88, 0xA4, 0x88, 0xA6, 0x98, 0xA6, 0x78, 0xA3, 0x99, 0xA3,
+    0x98, 0xA4, 0x78, 0xA4, 0x88, 0x6F, 0x9D, 0x98, 0x21, 0x9D, 0x99, 0x9A, 0x88, 0x9C, 0x77, 0x9A,
+    0x99, 0x19, 0xA9, 0x88, 0xA3, 0x99, 0x25, 0xC1, 0x7A, 0xA3, 0x99, 0xA3, 0x88, 0x10, 0x97, 0x99,
+    0x66, 0xA7, 0x88, 0xAF, 0x98, 0xA3, 0xA9, 0x76, 0xA2, 0x97, 0x76, 0xA7, 0x88, 0x9D, 0x88, 0x9B,
+    0x88, 0x69, 0x51, 0x9D, 0x98, 0x98, 0x88, 0x9A, 0x78, 0x51, 0xC0, 0x55, 0xC0, 0x65, 0x37, 0xA2,
+    0x88, 0xA2, 0x98, 0xA1, 0x9A, 0x39, 0x55, 0x66, 0x6B, 0xC1, 0x6E, 0xA2, 0x88, 0xA2, 0x88, 0x7F,
+    0x6E, 0x7F, 0xA2, 0x78, 0xA2, 0x88, 0x7F, 0xC0, 0x7E, 0x6F, 0x7E, 0xC0, 0x04, 0x38, 0xC0, 0x96,
+    0x95, 0x56, 0xC1, 0x65, 0x56, 0xC1, 0x6B, 0xC0, 0x25, 0x2D, 0xC6, 0x25, 0xC3, 0x2A, 0x5A, 0xC0,
+    0x66, 0xC0, 0x27, 0x2A, 0x6E, 0xC2, 0x6E, 0x7B, 0x6E, 0xC2, 0x7A, 0x66, 0xC0, 0x2D, 0x32, 0xC1,
+    0x6E, 0xC0, 0xA3, 0x88, 0xB1, 0xA9, 0xAA, 0x79, 0xC0, 0x9D, 0x98, 0xA1, 0x95, 0x9A, 0xA5, 0x99,
+    0x96, 0x51, 0x55, 0x66, 0xA1, 0x8A, 0x7F, 0xC0, 0x6B, 0x6B, 0x5A, 0x24, 0x6E, 0xC0, 0x1D, 0x55,
+    0x6E, 0x7E, 0xC0, 0x55, 0x65, 0x55, 0x9D, 0x98, 0x62, 0x6E, 0x7A, 0x11, 0x79, 0x6D, 0xA2, 0x75,
+    0xA2, 0x96, 0x7D, 0xA2, 0x86, 0xA2, 0x88, 0xA0, 0x8A, 0xA2, 0x8A, 0xA2, 0x7A, 0xA1, 0x8A, 0xA1,
+    0x8A, 0xA3, 0x8D, 0x9D, 0x8D, 0x87, 0x9B, 0x52, 0xC0, 0x2D, 0xC4, 0x5A, 0xC1, 0x25, 0xC2, 0x7F,
+    0xC0, 0x7E, 0x7E, 0xA2, 0x86, 0xB3, 0x81, 0xA0, 0xA0, 0x9B, 0xA6, 0x58, 0x69, 0x66, 0x6B, 0x04,
+    0xC0, 0x56, 0xC1, 0x6B, 0xC0, 0x3C, 0xC1, 0x66, 0x9F, 0x8C, 0x08, 0xA1, 0x8F, 0xA1, 0x7C, 0x94,
+    0x89, 0x84, 0x89, 0x55, 0x65, 0x9C, 0x78, 0xB7, 0x99, 0xBA, 0x87, 0x9D, 0x99, 0xA2, 0x78, 0x64,
+    0x92, 0x84, 0x98, 0x95, 0x68, 0x55, 0x75, 0xC1, 0x6E, 0x6B, 0xA2, 0x78, 0xA2, 0x78, 0x5F, 0xA1,
+    0x8A, 0xA2, 0x88, 0xA2, 0x89, 0xA3, 0x98, 0xA6, 0x99, 0xA7, 0x99, 0xA5, 0x9B, 0x65, 0xA3, 0x87,
+    0x9C, 0x87, 0x9B, 0x97, 0xA5, 0x89, 0xA6, 0x8B, 0xA2, 0x7B, 0x67, 0x8D, 0x88, 0x9A, 0x88, 0xA2,
+    0x88, 0x66, 0x51, 0x5A, 0xC1, 0x19, 0xC0, 0x69, 0x19, 0xC0, 0x21, 0xC1, 0x7E, 0x66, 0x50, 0x41,
+    0x2D, 0xC0, 0x32, 0x6B, 0x05, 0x69, 0x39, 0xC0, 0x6B, 0xC0, 0x05, 0x12, 0xA2, 0x85, 0x7E, 0xA2,
+    0x86, 0x69, 0x6E, 0x65, 0x55, 0xA0, 0x9A, 0x6B, 0x6B, 0xA1, 0x8A, 0xC1, 0x66, 0x66, 0xC1, 0x6F,
+    0xC1, 0x66, 0x24, 0xA5, 0x77, 0x7D, 0x56, 0xA6, 0x89, 0x66, 0xA2, 0x88, 0x5A, 0x51, 0x99, 0x78,
+    0x8A, 0x78, 0x9B, 0x88, 0xAF, 0x89, 0xA4, 0x88, 0x96, 0x78, 0x9B, 0x89, 0xA4, 0x88, 0xA8, 0x88,
+    0xA7, 0x98, 0xA4, 0x78, 0x7F, 0xA2, 0x88, 0x55, 0x9D, 0x99, 0x9B, 0x88, 0x9B, 0x89, 0x60, 0xC0,
+    0xA2, 0x78, 0x66, 0xC0, 0xA2, 0x88, 0x25, 0xA2, 0x88, 0xA2, 0x88, 0xC1, 0x21, 0x30, 0x7E, 0x52,
+    0xC0, 0xA2, 0x97, 0x56, 0x9D, 0x99, 0x33, 0xA7, 0xA9, 0xAB, 0x98, 0xA5, 0xB9, 0x9B, 0x98, 0x99,
+    0x98, 0xC0, 0xAA, 0x88, 0x55, 0x99, 0x98, 0x40, 0xA2, 0x87, 0x55, 0x99, 0x99, 0x94, 0x88, 0x9A,
+    0x78, 0x7E, 0xA5, 0x9A, 0x61, 0x56, 0xA2, 0x89, 0x6F, 0x67, 0x52, 0x69, 0x2C, 0xC1, 0x6F, 0xA2,
+    0x88, 0xA2, 0x87, 0x7F, 0x6E, 0x7F, 0x6F, 0xA2, 0x88, 0x7E, 0x6F, 0xC4, 0x24, 0x1C, 0x99, 0xA5,
+    0xC0, 0x56, 0xC1, 0x51, 0xC2, 0x56, 0x25, 0xC0, 0x7E, 0xC6, 0x5A, 0xC0, 0x25, 0xC0, 0x5A, 0xC2,
+    0x27, 0x7E, 0x2A, 0x27, 0x2A, 0x2F, 0x6E, 0x7B, 0x6E, 0xC1, 0x6E, 0x69, 0x3A, 0xA2, 0x77, 0xA3,
+    0x99, 0xA2, 0x88, 0x65, 0x3A, 0x32, 0xA2, 0x87, 0xC0, 0xB4, 0x88, 0xA9, 0x8A, 0xC1, 0x64, 0x9F,
+    0x96, 0x99, 0xA6, 0x9C, 0x88, 0x61, 0x5A, 0x6B, 0xC1, 0x67, 0x6E, 0xC0, 0x67, 0x37, 0xC0, 0x56,
+    0x69, 0x6E, 0xC0, 0x65, 0x50, 0x51, 0x51, 0x55, 0x79, 0xC0, 0xA2, 0x88, 0x7E, 0x6E, 0x7E, 0xA2,
+    0x76, 0x7D, 0x7D, 0x7C, 0xA2, 0x76, 0xA2, 0x88, 0x20, 0xA2, 0x89, 0xA2, 0x7C, 0xA2, 0x7C, 0x9A,
+    0x99, 0x93, 0x8C, 0x9C, 0x8A, 0x99, 0x8B, 0xC0, 0x6E, 0xC0, 0x6E, 0xC0, 0x2D, 0xC0, 0x5A, 0x6B,
+    0xC4, 0x7A, 0xC0, 0x6E, 0x34, 0xC0, 0xA2, 0x96, 0xFF, 0xDE, 0x6E, 0xA1, 0xA0, 0x9C, 0xA6, 0x58,
+    0x62, 0x56, 0x67, 0x6E, 0xC1, 0x34, 0x39, 0x6D, 0xC0, 0x32, 0xC1, 0x57, 0xA0, 0x8E, 0xFF, 0xD5,
+    0xB0, 0xA3, 0x7D, 0xA0, 0x7A, 0x89, 0x88, 0x8A, 0x89, 0x14, 0x66, 0x55, 0xB6, 0x98, 0xBC, 0x88,
+    0x6E, 0x76, 0x9D, 0x96, 0x96, 0xA2, 0x9A, 0xB5, 0x7C, 0x6E, 0x77, 0x64, 0x56, 0x6F, 0x5E, 0x5B,
+    0x5E, 0x5B, 0xA2, 0x6A, 0xA1, 0x7B, 0xA3, 0x79, 0xA3, 0x98, 0xA3, 0x88, 0xA5, 0x99, 0xA7, 0xAA,
+    0x9C, 0x88, 0x50, 0xA7, 0x88, 0x9C, 0x96, 0x9B, 0x98, 0xA3, 0x8A, 0xA8, 0x7B, 0xA3, 0x8B, 0x99,
+    0x8A, 0x90, 0x99, 0x9D, 0x89, 0x7E, 0x51, 0x5A, 0xC1, 0x66, 0x69, 0x66, 0xC0, 0x19, 0xC0, 0x0D,
+    0xC0, 0x7A, 0x55, 0x51, 0xC0, 0x6E, 0x6B, 0xC0, 0x6E, 0x6B, 0xC0, 0x39, 0xC2, 0x3E, 0xA2, 0x97,
+    0xA2, 0x76, 0x69, 0x7E, 0x6E, 0x69, 0x55, 0xC0, 0x7B, 0x17, 0x6B, 0x7B, 0xC4, 0x66, 0x6F, 0x6B,
+    0x6E, 0x7B, 0x56, 0xA4, 0x87, 0xA5, 0x88, 0xC0, 0x56, 0xA2, 0x89, 0x9C, 0x88, 0x97, 0x88, 0x97,
+    0x88, 0x8D, 0x89, 0x9C, 0x88, 0xAF, 0x78, 0xA7, 0x99, 0x9C, 0x78, 0xA5, 0x78, 0xA9, 0x88, 0xA3,
+    0x89, 0xA2, 0x88, 0xC0, 0x21, 0x9C, 0x98, 0x9C, 0x78, 0x9C, 0x88, 0x9D, 0x99, 0xC0, 0xA6, 0x87,
+    0xA3, 0x89, 0xC0, 0x7E, 0xA4, 0x78, 0xA2, 0x88, 0x6B, 0x26, 0x7B, 0x2D, 0xC0, 0x21, 0x30, 0x35,
+    0x7F, 0x7A, 0xA3, 0x88, 0xA2, 0x99, 0x6E, 0xA2, 0x88, 0x65, 0x8E, 0x99, 0xA3, 0x98, 0xAB, 0xA8,
+    0xA9, 0x99, 0x7A, 0x9D, 0x98, 0xC0, 0xA8, 0x88, 0x51, 0x9C, 0x76, 0x65, 0xA2, 0x88, 0x6E, 0xC0,
+    0x94, 0x88, 0xC0, 0x7F, 0x93, 0xAA, 0x6B, 0x6F, 0xC0, 0x57, 0x56, 0xC2, 0x6E, 0x7F, 0xA2, 0x88,
+    0x19, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0x6F, 0x24, 0x6B, 0xC0, 0x24, 0x5A, 0x1C, 0xC0, 0x10, 0x9A,
+    0x95, 0x66, 0x5A, 0xC1, 0x55, 0x66, 0xC0, 0x6B, 0x65, 0x5B, 0xC0, 0x2D, 0xC5, 0x25, 0x6E, 0xC0,
+    0x25, 0xC0, 0x5E, 0x66, 0xC1, 0x27, 0xC1, 0x2A, 0x6E, 0xC0, 0x6E, 0x7B, 0xC0, 0x6E, 0x08, 0x64,
+    0xA6, 0x88, 0xA9, 0xA8, 0xA7, 0x88, 0xA5, 0x89, 0xA2, 0x89, 0xC0, 0x97, 0x98, 0x90, 0x89, 0x2B,
+    0xB0, 0x87, 0xAF, 0x8B, 0xC1, 0x65, 0x9E, 0x85, 0x9A, 0x96, 0x9B, 0xA8, 0x51, 0x6B, 0x6F, 0xC1,
+    0x56, 0x6B, 0xC2, 0x51, 0x61, 0xC1, 0x6E, 0x6E, 0xC1, 0x7E, 0xC0, 0x3C, 0xA2, 0x88, 0x69, 0xC1,
+    0x66, 0x3D, 0x7D, 0x6D, 0x68, 0x68, 0x6C, 0x7E, 0x7F, 0xA2, 0x79, 0xA2, 0x8C, 0xA3, 0x7E, 0xA0,
+    0x8A, 0x87, 0x99, 0x98, 0x8A, 0x2D, 0xC1, 0x6B, 0x6E, 0x34, 0x2D, 0xC0, 0x5A, 0xC0, 0x6B, 0xC0,
+    0x6E, 0xC2, 0x39, 0xC1, 0x5B, 0x2D, 0xFF, 0xC5, 0xCC, 0xFF, 0xE6, 0x85, 0x9B, 0xB6, 0x9D, 0x9A,
+    0x9D, 0x8A, 0xC0, 0x52, 0x6B, 0xC0, 0x7F, 0x7D, 0xA2, 0x87, 0x6E, 0x65, 0x2D, 0xC0, 0x6E, 0x9E,
+    0x8B, 0xA0, 0x7F, 0xFF, 0xCD, 0xD2, 0xA2, 0x7C, 0x5A, 0x8A, 0x89, 0x86, 0x88, 0xC1, 0xA2, 0x98,
+    0xBD, 0x88, 0xB1, 0x99, 0x7E, 0x75, 0x96, 0xA3, 0x9D, 0xB3, 0xA0, 0xB6, 0x68, 0x61, 0x62, 0xC0,
+    0x7E, 0x5A, 0x5A, 0xA2, 0x78, 0x4B, 0xA2, 0x68, 0xA3, 0x6A, 0xA0, 0x6C, 0xA2, 0x69, 0xA4, 0x88,
+    0xA3, 0x88, 0xA2, 0x98, 0xA4, 0x88, 0xA2, 0x98, 0x9D, 0x89, 0xA3, 0x87, 0xA4, 0x87, 0x9D, 0x98,
+    0x66, 0x9F, 0x8B, 0xA4, 0x8A, 0xA3, 0x8B, 0x99, 0x8A, 0x8E, 0x89, 0xC0, 0x65, 0x5A, 0xC0, 0x66,
+    0x69, 0x66, 0xC3, 0x66, 0x69, 0x55, 0x66, 0xC1, 0xA2, 0x78, 0xC1, 0x6F, 0xC1, 0x3E, 0x66, 0xC1,
+    0x3E, 0xA2, 0x97, 0xA2, 0x76, 0x69, 0x6D, 0xC0, 0x65, 0x5A, 0x7B, 0xC0, 0x7F, 0x6F, 0xC0, 0x7A,
+    0x6E, 0x6F, 0x26, 0x21, 0x6B, 0xC1, 0x67, 0x6F, 0x51, 0xA4, 0x88, 0xAC, 0x78, 0x51, 0x51, 0x9B,
+    0x88, 0x91, 0x89, 0x98, 0x78, 0x99, 0x88, 0xC0, 0xA8, 0x88, 0xC0, 0x94, 0x88, 0x6B, 0xAB, 0x78,
+    0xC0, 0x56, 0xA5, 0x88, 0xA5, 0x89, 0x51, 0x7F, 0xA3, 0x88, 0xA4, 0x88, 0xA3, 0x88, 0x7F, 0xA2,
+    0x88, 0x56, 0x9D, 0x98, 0x56, 0xA4, 0x87, 0xA2, 0x88, 0xC0, 0x6F, 0x7A, 0x7E, 0xC2, 0x66, 0xC0,
+    0xA2, 0x88, 0xA2, 0x88, 0x2F, 0x9C, 0x98, 0x96, 0x88, 0x93, 0x99, 0x93, 0x98, 0x7F, 0xA8, 0x88,
+    0x39, 0xB1, 0xB9, 0xAD, 0x98, 0xA8, 0x99, 0xC0, 0x6E, 0x40, 0x9D, 0x97, 0x5A, 0xA3, 0x88, 0xA3,
+    0x98, 0xA2, 0x8A, 0x97, 0x98, 0x96, 0x98, 0x96, 0x88, 0x6F, 0x0E, 0x7A, 0x56, 0x9D, 0x8A, 0x2C,
+    0xC1, 0x6E, 0x7F, 0xA2, 0x88, 0x19, 0xC0, 0xA2, 0x88, 0xC0, 0x7F, 0x6E, 0x7F, 0x6F, 0xC4, 0x56,
+    0x61, 0x9B, 0xA4, 0x5A, 0x66, 0x6F, 0x66, 0xC1, 0x5A, 0x66, 0xC4, 0x32, 0x2D, 0xC3, 0x5A, 0x66,
+    0xC1, 0x5E, 0xC0, 0x66, 0xC0, 0x27, 0xC0, 0x2A, 0x6F, 0xC0, 0x6E, 0xC0, 0x7A, 0xC0, 0xA2, 0x77,
+    0x68, 0xAC, 0x97, 0xAE, 0x88, 0x7A, 0x65, 0x3D, 0x6B, 0x5A, 0xA2, 0x89, 0x9A, 0x88, 0x93, 0x98,
+    0xB2, 0x78, 0xA1, 0x9A, 0x6B, 0xC0, 0x64, 0x9B, 0x95, 0x98, 0x96, 0x76, 0x55, 0x6F, 0xC0, 0x56,
+    0x52, 0x66, 0x19, 0x6B, 0xC0, 0x6B, 0x6F, 0x7A, 0xA2, 0x78, 0x7F, 0x07, 0xC0, 0x7E, 0xC0, 0x66,
+    0x16, 0x7E, 0x6F, 0x6D, 0xC0, 0x66, 0x69, 0x69, 0x79, 0x6C, 0x65, 0x69, 0xA2, 0x86, 0x69, 0x6D,
+    0x7B, 0xA3, 0x8B, 0xA3, 0x7D, 0xA3, 0x7D, 0x92, 0x98, 0x8C, 0x8A, 0x2D, 0x6B, 0xC0, 0x6E, 0xC1,
+    0x34, 0x2D, 0x5A, 0xC0, 0x6F, 0xC1, 0x6E, 0x3E, 0xC0, 0x36, 0xC0, 0x39, 0xC0, 0x34, 0xA7, 0x92,
+    0xFF, 0xD6, 0x07, 0x9C, 0xA6, 0x9B, 0x9C, 0x9D, 0x8B, 0xC0, 0x9D, 0x89, 0x9B, 0x9A, 0x9C, 0x79,
+    0xA1, 0xA8, 0x37, 0xA3, 0x95, 0xA5, 0x87, 0xA2, 0x76, 0x6D, 0x7A, 0x6E, 0x9F, 0x7B, 0xFF, 0xC5,
+    0x49, 0xFF, 0xCD, 0xD3, 0xA1, 0x7B, 0x9D, 0x89, 0x98, 0x98, 0x84, 0x89, 0x9A, 0x87, 0xA3, 0x89,
+    0xB3, 0x98, 0xB4, 0x89, 0xA3, 0x98, 0x7D, 0x9C, 0xA4, 0x98, 0xC3, 0x9F, 0xB6, 0x64, 0x55, 0x7A,
+    0xC0, 0x7A, 0xC0, 0x55, 0x6B, 0x0C, 0x5E, 0xA1, 0x6A, 0xA4, 0x69, 0xA0, 0x5C, 0x5F, 0xA2, 0x79,
+    0x6E, 0xA2, 0x98, 0xA5, 0x99, 0xA6, 0x88, 0x99, 0x87, 0x9D, 0x88, 0xA7, 0x98, 0xA5, 0x89, 0xA2,
+    0x99, 0x57, 0x9D, 0x9A, 0x97, 0x8A, 0x99, 0x9A, 0x9D, 0x89, 0x57, 0x65, 0x5A, 0xC0, 0x66, 0x65,
+    0xC3, 0x66, 0x69, 0x39, 0x69, 0xC2, 0x6F, 0xC0, 0x6F, 0x0D, 0xC0, 0x0A, 0x66, 0x39, 0x5A, 0x39,
+    0x0D, 0x6D, 0x7D, 0x6D, 0x6D, 0x55, 0x66, 0x39, 0x7B, 0xC0, 0x7F, 0xC0, 0x6E, 0x7E, 0x6F, 0x69,
+    0x1F, 0x66, 0x6F, 0xC0, 0x67, 0xC0, 0x6B, 0x51, 0xA5, 0x89, 0xAD, 0x8A, 0x99, 0x88, 0x9B, 0x88,
+    0x97, 0x87, 0x9B, 0x88, 0xA5, 0x78, 0x6E, 0x25, 0xA7, 0x99, 0xC0, 0x98, 0x88, 0x96, 0x99, 0x97,
+    0x89, 0x9D, 0x99, 0xA4, 0x87, 0xA3, 0x69, 0xA4, 0x89, 0xAA, 0x88, 0xA6, 0x89, 0xA3, 0x88, 0x5E,
+    0xC0, 0x66, 0xC0, 0x66, 0xA2, 0x88, 0x6E, 0x3C, 0x51, 0x65, 0x41, 0x9B, 0xA9, 0x9C, 0x88, 0xA6,
+    0x99, 0xA6, 0x97, 0xA6, 0x78, 0x94, 0x88, 0x91, 0x99, 0x9B, 0x98, 0xA4, 0x88, 0x9B, 0x99, 0x9B,
+    0x88, 0x9C, 0xA8, 0xA3, 0x78, 0xA9, 0x88, 0xA8, 0x99, 0xA8, 0x78, 0xA6, 0x88, 0xAB, 0xB8, 0xA9,
+    0xA9, 0xA3, 0x99, 0x6F, 0x6E, 0x69, 0x98, 0x87, 0x94, 0x87, 0xA4, 0x88, 0xAB, 0x88, 0xA6, 0x89,
+    0x6B, 0x9B, 0x97, 0x8F, 0x99, 0x9C, 0x87, 0xA3, 0x88, 0x7A, 0x66, 0x53, 0x9B, 0x8A, 0x52, 0xC0,
+    0x5E, 0x7F, 0xA2, 0x88, 0x6E, 0xC0, 0x7F, 0x6E, 0xC0, 0x7F, 0x6E, 0x7F, 0x6F, 0xC0, 0x6E, 0xC1,
+    0x9C, 0x99, 0x9D, 0x88, 0x9D, 0xA5, 0xC2, 0x6B, 0xC0, 0x6E, 0x35, 0xC0, 0x56, 0xC2, 0x6E, 0x6B,
+    0xC1, 0x2D, 0xC1, 0x5A, 0xC0, 0x66, 0xC0, 0x5A, 0xC2, 0x6E, 0x2A, 0x6E, 0x6B, 0x6E, 0xC1, 0x3E,
+    0x6E, 0x6C, 0xAD, 0x97, 0xAD, 0x98, 0xA2, 0x87, 0x9C, 0x99, 0x9C, 0x98, 0xC0, 0x55, 0x3D, 0xA7,
+    0x7A, 0x23, 0x64, 0x55, 0x10, 0xA1, 0x8B, 0xC0, 0x09, 0x97, 0xA5, 0x9D, 0x97, 0x51, 0x67, 0x6E,
+    0x6B, 0x5A, 0x67, 0xC0, 0x6B, 0x7F, 0x6F, 0xA2, 0x88, 0xA1, 0x8A, 0xC0, 0x55, 0x7A, 0x36, 0x66,
+    0x55, 0x6B, 0x36, 0x6B, 0x36, 0x31, 0x2A, 0x59, 0x66, 0x79, 0x69, 0x68, 0x69, 0x79, 0x6E, 0x7D,
+    0x6E, 0x69, 0x6E, 0xA2, 0x8A, 0xA3, 0x8B, 0xA4, 0x6D, 0x9A, 0x99, 0x32, 0x66, 0x6B, 0xC0, 0x39,
+    0xC2, 0x34, 0x5A, 0x6E, 0xC1, 0x3E, 0xC2, 0x39, 0x36, 0xC0, 0x39, 0x3E, 0x35, 0xA7, 0x92, 0xA2,
+    0x94, 0xA4, 0xAD, 0x9F, 0x8C, 0x9A, 0x88, 0x9C, 0x88, 0x42, 0x95, 0x88, 0x60, 0xAC, 0x97, 0x9B,
+    0x94, 0xA7, 0x95, 0xA7, 0x84, 0x7C, 0x6E, 0x1B, 0xA0, 0x7B, 0xA0, 0x7F, 0xA4, 0x7E, 0xA1, 0x7B,
+    0x51, 0x51, 0x99, 0x89, 0x9A, 0x89, 0xA5, 0x98, 0xA8, 0x88, 0xA4, 0x89, 0x79, 0x9F, 0xA5, 0x99,
+    0xC2, 0x9C, 0xC5, 0x69, 0x65, 0xC0, 0x7F, 0x66, 0x55, 0x66, 0x7E, 0xC0, 0x55, 0xA3, 0x78, 0xA2,
+    0x69, 0xA0, 0x5A, 0xA1, 0x6C, 0xA2, 0x69, 0xA5, 0x79, 0x6F, 0x38, 0xA5, 0x98, 0xA6, 0x88, 0x99,
+    0x88, 0x50, 0xA6, 0x87, 0xA7, 0x9A, 0xA4, 0x8A, 0xA0, 0x8B, 0x9D, 0xA9, 0x5A, 0x91, 0x89, 0x98,
+    0x89, 0x6F, 0x66, 0xC0, 0x5A, 0x66, 0x65, 0xC0, 0x6E, 0x0D, 0xC1, 0x66, 0x69, 0x5A, 0xC0, 0x01,
+    0xC0, 0x0D, 0xC2, 0x12, 0x0D, 0x56, 0x39, 0xC1, 0x0D, 0xA2, 0x76, 0x79, 0x6C, 0x59, 0x66, 0xC0,
+    0x39, 0x7A, 0x03, 0x7E, 0x6B, 0x6E, 0x7E, 0x69, 0x6E, 0x18, 0xC1, 0x1F, 0x67, 0x6B, 0xC0, 0x42,
+    0xA9, 0x99, 0xA5, 0x79, 0x96, 0x87, 0x55, 0x58, 0x41, 0x6E, 0x9C, 0x88, 0x99, 0x89, 0x9A, 0x98,
+    0xA7, 0x99, 0xA2, 0x88, 0x66, 0x6F, 0x31, 0xA3, 0x9A, 0x96, 0x78, 0x9B, 0x89, 0xA7, 0x8A, 0xA8,
+    0x89, 0xA4, 0x78, 0xA4, 0x87, 0xA2, 0x88, 0xC0, 0x6F, 0x7F, 0xC0, 0x51, 0x04, 0x56, 0x9D, 0x98,
+    0x97, 0x89, 0x99, 0xA9, 0x99, 0x88, 0x9A, 0x99, 0xA2, 0x98, 0xA4, 0x88, 0xA4, 0x98, 0xA9, 0x98,
+    0x91, 0x99, 0x93, 0xA9, 0xA2, 0x77, 0xA4, 0x68, 0xA5, 0x88, 0xA7, 0x99, 0xAA, 0x88, 0xA6, 0x88,
+    0xA3, 0x88, 0xA6, 0x88, 0xAA, 0x98, 0xAA, 0xA9, 0x69, 0x62, 0x6F, 0x2A, 0xC0, 0x9D, 0x97, 0x94,
+    0x87, 0x9B, 0x89, 0xA7, 0x99, 0xAB, 0x99, 0xA2, 0x77, 0x8D, 0xA8, 0x98, 0x87, 0xA4, 0x76, 0x7E,
+    0xA2, 0x88, 0xA0, 0x9A, 0x9D, 0x9A, 0x9A, 0x7A, 0x9D, 0x8A, 0xC0, 0x6F, 0x0D, 0x6F, 0x7E, 0x6B,
+    0xC0, 0x6E, 0xC0, 0x7F, 0x6F, 0x7E, 0x6F, 0x66, 0x5A, 0x69, 0x9B, 0x99, 0x51, 0x9E, 0xA4, 0x66,
+    0x6F, 0xC0, 0x35, 0x6E, 0xC0, 0x01, 0xC0, 0x66, 0x55, 0xC0, 0x6F, 0xC4, 0x32, 0x39, 0x2D, 0x5A,
+    0x25, 0xC0, 0x5A, 0x69, 0x22, 0xC0, 0x6E, 0x7F, 0xC0, 0x3E, 0xC1, 0x6D, 0x6F, 0x69, 0xAE, 0x94,
+    0xA8, 0x96, 0x9C, 0x88, 0xA4, 0x87, 0x7E, 0x51, 0x7F, 0x9D, 0x88, 0xA2, 0x99, 0xA4, 0x7B, 0xA2,
+    0x7A, 0x6D, 0x35, 0xA3, 0x8A, 0xA2, 0x7D, 0x6F, 0x9B, 0xA5, 0x99, 0x96, 0x64, 0x62, 0x5B, 0x6F,
+    0x7B, 0x6F, 0x6B, 0x6F, 0xC0, 0x6B, 0x6B, 0xC3, 0x6F, 0x51, 0x66, 0x51, 0x66, 0xA2, 0x78, 0xA3,
+    0x98, 0xC1, 0x2A, 0x66, 0x69, 0x10, 0x3D, 0x65, 0x69, 0x6D, 0x7E, 0x7E, 0x6E, 0x02, 0x6E, 0xA2,
+    0x89, 0xA3, 0x8C, 0xA4, 0x6C, 0x9B, 0x99, 0x87, 0x9B, 0x52, 0xC1, 0x6E, 0x7F, 0x3E, 0x39, 0xC4,
+    0x3E, 0xC1, 0x39, 0xC3, 0x3E, 0x39, 0xA2, 0x86, 0xA7, 0xA6, 0xA7, 0x8B, 0x97, 0x9A, 0x6E, 0x7F,
+    0x9D, 0x99, 0x8F, 0x97, 0xA4, 0x87, 0xC0, 0x9D, 0x97, 0xA8, 0x94, 0xA3, 0x93, 0xA4, 0x94, 0x7E,
+    0x6F, 0x9F, 0x8C, 0xA3, 0x7E, 0xA2, 0x7D, 0xA1, 0x8A, 0xA3, 0x89, 0x9B, 0x89, 0x6B, 0xA2, 0x87,
+    0x6B, 0xA3, 0x99, 0x69, 0x9D, 0xA5, 0x97, 0xC4, 0x9F, 0xB4, 0xA0, 0xA7, 0xC0, 0x79, 0x66, 0x52,
+    0x62, 0xC2, 0xA2, 0x87, 0x6E, 0x08, 0x4F, 0xA1, 0x6A, 0xA2, 0x5C, 0xA1, 0x7A, 0xA4, 0x69, 0x56,
+    0xC0, 0xA5, 0x88, 0xA3, 0x98, 0x9B, 0x88, 0x6D, 0xA5, 0x98, 0xA5, 0x99, 0xA2, 0x8A, 0xA0, 0x8A,
+    0xA4, 0x89, 0xA1, 0x8A, 0x52, 0x8D, 0x9A, 0x9A, 0x78, 0x7E, 0x21, 0x1E, 0x65, 0x66, 0xC5, 0x66,
+    0xC1, 0x0D, 0xC0, 0x12, 0xC2, 0x6B, 0xC0, 0x51, 0xC0, 0x65, 0x6E, 0x12, 0x69, 0x6C, 0x7D, 0x59,
+    0x66, 0xC0, 0x39, 0x7A, 0x7F, 0x6E, 0x0B, 0x10, 0x7E, 0xC0, 0x69, 0xC1, 0x18, 0x1F, 0xC0, 0x67,
+    0x56, 0x5F, 0xAA, 0x89, 0x40, 0x40, 0x98, 0x88, 0x9D, 0x87, 0xA2, 0x88, 0x56, 0xA3, 0x89, 0xA2,
+    0x88, 0x97, 0x99, 0x9B, 0x98, 0x66, 0xA4, 0x78, 0x02, 0x61, 0x9C, 0x89, 0xA2, 0x78, 0x9D, 0x98,
+    0x97, 0x9A, 0x9C, 0x89, 0x6B, 0xA6, 0x78, 0xAB, 0x89, 0xAA, 0x88, 0x5B, 0x9D, 0x98, 0x55, 0xA3,
+    0x99, 0x3B, 0xA6, 0x88, 0xA6, 0x88, 0x9C, 0x88, 0x37, 0x9D, 0x98, 0x98, 0x88, 0x9B, 0x89, 0x9C,
+    0x98, 0x97, 0xA9, 0xA1, 0xA8, 0xB2, 0x99, 0x96, 0x88, 0x96, 0x67, 0xA6, 0x88, 0xA3, 0x89, 0xA7,
+    0x88, 0xA5, 0x99, 0xA6, 0x88, 0xA2, 0x87, 0x9D, 0x89, 0x7A, 0xAE, 0x98, 0xA2, 0x98, 0xA7, 0x98,
+    0xA3, 0x99, 0x6E, 0xC1, 0x6B, 0x50, 0x94, 0x87, 0x60, 0xAD, 0x89, 0x9B, 0x96, 0x8D, 0x87, 0xA2,
+    0x87, 0xA4, 0x88, 0xA2, 0x87, 0xA1, 0x9A, 0x67, 0x9B, 0x9A, 0x9A, 0x7B, 0x56, 0x6B, 0x6E, 0xA2,
+    0x88, 0x7F, 0xC0, 0x6E, 0xC2, 0x7F, 0x6B, 0x3C, 0x66, 0x5A, 0x55, 0x9D, 0x99, 0x05, 0x9D, 0xA6,
+    0xC1, 0x7F, 0x6F, 0x6E, 0x7B, 0x6E, 0xC0, 0x01, 0x66, 0x39, 0xC5, 0x65, 0x6E, 0xC0, 0x56, 0xC0,
+    0x56, 0x69, 0x66, 0x1B, 0x22, 0x2A, 0xA2, 0x88, 0x6F, 0x6E, 0xC0, 0x69, 0x7A, 0x55, 0xAA, 0x96,
+    0xAC, 0x94, 0x9D, 0x97, 0xA3, 0x88, 0x9D, 0x98, 0x50, 0x69, 0x66, 0x2B, 0x7E, 0x7A, 0xA4, 0x7A,
+    0xA4, 0x77, 0x9B, 0x95, 0xA2, 0x8B, 0xA6, 0x6C, 0x9D, 0xAA, 0x9A, 0x87, 0x9C, 0x96, 0x69, 0x34,
+    0x6B, 0x6F, 0x66, 0x6F, 0x7B, 0xC0, 0x5A, 0x6B, 0xC0, 0x6B, 0x66, 0xC0, 0x23, 0x1E, 0x55, 0x66,
+    0xC0, 0x51, 0xC0, 0xA3, 0x89, 0x7A, 0x1E, 0x69, 0xC0, 0x65, 0x50, 0x64, 0x69, 0x7E, 0xA2, 0x76,
+    0x7E, 0x6F, 0x3D, 0x6E, 0x6E, 0xA2, 0x8A, 0xA4, 0x7B, 0xA3, 0x7D, 0x97, 0x98, 0x32, 0x67, 0x6E,
+    0xC1, 0x7F, 0xC0, 0x39, 0xC3, 0x6E, 0xC1, 0x39, 0xC4, 0x3E, 0x32, 0xA3, 0x89, 0xA6, 0x98, 0x52,
+    0x90, 0x89, 0xA5, 0x88, 0x66, 0xA5, 0x98, 0xA7, 0x98, 0x64, 0x98, 0x88, 0x9C, 0x98, 0xA4, 0x85,
+    0xA1, 0xA5, 0xA4, 0x93, 0xA2, 0x85, 0x6B, 0xA1, 0x8B, 0xA1, 0x8D, 0xA1, 0x7D, 0xA3, 0x89, 0x6F,
+    0x6F, 0x6B, 0x6F, 0xA2, 0x98, 0x65, 0x1D, 0x9B, 0xA2, 0xA0, 0xA4, 0x9F, 0xB7, 0x9D, 0xB8, 0x66,
+    0x66, 0x65, 0x66, 0x62, 0x6E, 0x6B, 0xC0, 0xA2, 0x87, 0x6E, 0x00, 0xA3, 0x69, 0xA1, 0x7A, 0x9F,
+    0x6C, 0xA4, 0x5A, 0xA4, 0x69, 0x9D, 0x89, 0x6E, 0xA2, 0x88, 0xA2, 0x87, 0x54, 0x65, 0xA2, 0x88,
+    0xA6, 0x87, 0xA4, 0x98, 0x9D, 0x9A, 0xA4, 0x8A, 0xA4, 0x8B, 0xA2, 0x7B, 0x9C, 0x88, 0x8D, 0x89,
+    0x9C, 0x98, 0xC0, 0x5A, 0x66, 0x65, 0xC0, 0x6E, 0x0D, 0xC0, 0x6B, 0x0D, 0xC0, 0x66, 0x0D, 0x19,
+    0xC6, 0x51, 0xC0, 0x65, 0x6E, 0x12, 0x69, 0x6C, 0x69, 0x6D, 0xC1, 0x7F, 0xC0, 0x7E, 0xC2, 0x7E,
+    0x6D, 0x66, 0xC0, 0x5A, 0xC0, 0x18, 0x6B, 0x67, 0x56, 0xA4, 0x79, 0xA7, 0x89, 0x97, 0x77, 0x9D,
+    0x88, 0xA2, 0x88, 0xA3, 0x78, 0x51, 0x99, 0x88, 0x66, 0xA3, 0x99, 0xA2, 0x88, 0x2A, 0x6E, 0xA4,
+    0x99, 0x3E, 0x2F, 0x52, 0x99, 0x99, 0xC0, 0x9D, 0x99, 0x52, 0x9B, 0x98, 0x95, 0x99, 0xA7, 0x89,
+    0xA4, 0x89, 0xA4, 0x79, 0xB1, 0x89, 0x9A, 0x88, 0x95, 0x88, 0x9B, 0x99, 0x69, 0xB7, 0x89, 0xAC,
+    0x88, 0x9D, 0x88, 0x9C, 0x88, 0x65, 0x51, 0xC0, 0x9C, 0x99, 0x93, 0x98, 0x93, 0xA9, 0xB3, 0xA9,
+    0x40, 0x4A, 0xA4, 0x88, 0xA2, 0x88, 0xA2, 0x88, 0xA3, 0x99, 0x51, 0x94, 0x88, 0x97, 0x98, 0xA3,
+    0x98, 0xAA, 0x98, 0xAD, 0x99, 0xAF, 0x99, 0xA6, 0x88, 0x9D, 0x98, 0xC0, 0x31, 0xC1, 0x97, 0x97,
+    0x98, 0x86, 0xAD, 0x97, 0x95, 0x87, 0x94, 0x88, 0x18, 0xA3, 0x98, 0x7F, 0x6B, 0x9B, 0x9B, 0x9B,
+    0x8A, 0x43, 0x6B, 0x6E, 0xA2, 0x98, 0xA2, 0x78, 0xC3, 0x6B, 0xC3, 0x28, 0x55, 0x52, 0x59, 0x9D,
+    0xB6, 0x6B, 0x6E, 0xC0, 0x7B, 0xA2, 0x78, 0x7A, 0x6F, 0xC1, 0x5A, 0x01, 0xC1, 0x66, 0xC0, 0x5E,
+    0x39, 0x65, 0xC0, 0x6B, 0x5A, 0x65, 0xC0, 0x5A, 0xC0, 0x25, 0x6E, 0x6F, 0xA2, 0x88, 0x0D, 0x12,
+    0xC1, 0x58, 0xA3, 0x98, 0xAF, 0xA5, 0xA3, 0x95, 0x74, 0x9C, 0x88, 0x9C, 0x88, 0x6E, 0x6E, 0x9D,
+    0x99, 0x0B, 0x69, 0xA2, 0x97, 0xA4, 0x88, 0xA2, 0x87, 0x9B, 0x87, 0xA5, 0x8C, 0xA6, 0x6C, 0x9A,
+    0x99, 0x9B, 0x97, 0x65, 0xC1, 0x6B, 0xC0, 0x6B, 0xC0, 0x6B, 0xC1, 0x6B, 0x6E, 0xC0, 0x09, 0x6B,
+    0xC1, 0x66, 0x56, 0x55, 0x51, 0x66, 0x7E, 0x69, 0x5A, 0x65, 0xC0, 0x51, 0x79, 0x6E, 0xA2, 0x87,
+    0xA2, 0x87, 0x7E, 0x6E, 0x2E, 0x6F, 0x7A, 0xA2, 0x78, 0xA2, 0x8A, 0xA4, 0x7B, 0xA3, 0x7C, 0x8F,
+    0x99, 0x91, 0x9A, 0x6B, 0x6E, 0xC1, 0x7F, 0xC0, 0x3E, 0x39, 0x34, 0x39, 0xC1, 0x3E, 0xC1, 0x36,
+    0xC0, 0x39, 0xC1, 0x3E, 0x65, 0x12, 0xA3, 0x9A, 0x95, 0x9A, 0xA2, 0x88, 0x1A, 0x9B, 0x88, 0xC0,
+    0x61, 0x6D, 0xA4, 0x88, 0xA6, 0x97, 0x9B, 0x97, 0xA7, 0xA6, 0xA4, 0x95, 0x9F, 0x94, 0x66, 0xA2,
+    0x79, 0xA3, 0x8C, 0xA0, 0x8C, 0x5B, 0x9D, 0x89, 0xA3, 0x89, 0x6F, 0x9D, 0x98, 0x7F, 0x9C, 0x96,
+    0x9E, 0x95, 0xA7, 0x92, 0xA1, 0xA6, 0x70, 0x76, 0x65, 0x66, 0x7A, 0x51, 0x66, 0x6F, 0xC0, 0x66,
+    0x55, 0x6E, 0xA2, 0x77, 0xA3, 0x69, 0xA0, 0x7A, 0xA2, 0x5B, 0xA2, 0x7B, 0x9F, 0x6A, 0x6F, 0xA4,
+    0x77, 0x6E, 0x51, 0x9C, 0x86, 0x59, 0xA4, 0x98, 0xA2, 0x98, 0xA8, 0x87, 0xA4, 0x99, 0x9C, 0x8A,
+    0xA4, 0x8A, 0xA1, 0x8B, 0xA3, 0x8B, 0x8F, 0x99, 0x95, 0x89, 0x7F, 0x5A, 0x19, 0xC0, 0x66, 0x69,
+    0xC0, 0x14, 0x19, 0x14, 0xC0, 0x19, 0x7A, 0x6E, 0x28, 0xC1, 0x21, 0xC0, 0x28, 0x19, 0x55, 0x66,
+    0x3E, 0x6E, 0x7E, 0x6D, 0x6D, 0x69, 0x69, 0xC0, 0x00, 0x7E, 0xC1, 0x6E, 0x65, 0x7E, 0x6E, 0x7F,
+    0x69, 0x0E, 0x09, 0xC0, 0x6B, 0x6B, 0x7F, 0x42, 0xA9, 0x89, 0x41, 0x95, 0x77, 0x6F, 0xA7, 0x88,
+    0x66, 0x9B, 0x88, 0x9A, 0x88, 0xA2, 0x89, 0xA8, 0x88, 0x2F, 0x7F, 0xA2, 0x88, 0xC0, 0x6B, 0x55,
+    0x66, 0x65, 0x05, 0x9C, 0x89, 0x9D, 0x88, 0x66, 0x9C, 0x88, 0x95, 0x99, 0x61, 0x52, 0xAA, 0x7A,
+    0xB6, 0x78, 0xA9, 0x99, 0x98, 0x87, 0x92, 0x88, 0x9A, 0x78, 0xAF, 0x89, 0xAC, 0x87, 0x65, 0x51,
+    0x9C, 0x88, 0x66, 0xA2, 0x88, 0x56, 0x98, 0x87, 0x91, 0xA9, 0xAB, 0xB9, 0x98, 0x78, 0xA7, 0x78,
+    0xAB, 0x99, 0xA3, 0x88, 0x66, 0x9B, 0x89, 0xA4, 0x88, 0x60, 0x97, 0x98, 0x96, 0x88, 0xA9, 0xA9,
+    0xB1, 0x88, 0xAF, 0x99, 0x65, 0x97, 0x99, 0x40, 0xA6, 0x88, 0xA7, 0x99, 0xC0, 0x9A, 0x87, 0x97,
+    0xA7, 0xAA, 0x76, 0x8F, 0x98, 0x9C, 0x88, 0xA2, 0x88, 0x2E, 0x66, 0x9D, 0x9A, 0x9D, 0x8A, 0x43,
+    0xC0, 0x6F, 0x7F, 0x28, 0x6F, 0xC0, 0x69, 0x7F, 0xC0, 0x5A, 0x34, 0xC1, 0x51, 0x51, 0xC0, 0x55,
+    0x9E, 0xA5, 0x6B, 0x6E, 0xC0, 0x7B, 0x6F, 0x7E, 0x6F, 0xC4, 0x55, 0xC0, 0x3C, 0x01, 0xC0, 0x56,
+    0x65, 0xC1, 0x56, 0x66, 0x25, 0x6E, 0x31, 0x39, 0x05, 0x7E, 0x6E, 0x6B, 0x12, 0x0B, 0x55, 0xB1,
+    0x94, 0xA5, 0xA5, 0xA3, 0x97, 0x96, 0x88, 0x61, 0xA2, 0x88, 0x6F, 0x6E, 0x1A, 0xC0, 0xA2, 0x87,
+    0x79, 0xA4, 0x87, 0x9E, 0x76, 0x9B, 0x89, 0xA5, 0x8A, 0xA3, 0x9B, 0x9D, 0x8A, 0x9D, 0x99, 0x26,
+    0xC1, 0x66, 0xC0, 0x6B, 0xC1, 0x2D, 0xC0, 0x6B, 0xC1, 0x6B, 0x6B, 0x6B, 0xC0, 0x67, 0xC0, 0x51,
+    0x9D, 0x89, 0x9D, 0x98, 0x51, 0x69, 0xC1, 0xA3, 0x89, 0x7E, 0x6E, 0xA2, 0x87, 0xA2, 0x87, 0x7A,
+    0x69, 0x28, 0xA2, 0x88, 0x7E, 0xC0, 0xA2, 0x78, 0xA2, 0x89, 0xA4, 0x7C, 0xA3, 0x7C, 0x93, 0x98,
+    0x8C, 0x9A, 0x6F, 0x39, 0xC1, 0x01, 0x6B, 0x01, 0x39, 0x34, 0xC0, 0x39, 0xC1, 0x6E, 0xC0, 0x36,
+    0xC3, 0x79, 0xC0, 0xA6, 0x89, 0x52, 0x90, 0x89, 0xA5, 0x99, 0xA2, 0x88, 0xA4, 0x88, 0x55, 0x98,
+    0x88, 0x50, 0x9D, 0x89, 0xA2, 0x97, 0x9D, 0x97, 0xA4, 0x97, 0xA5, 0xA5, 0xA9, 0x96, 0xA3, 0xA7,
+    0x6F, 0xA4, 0x7A, 0xA1, 0x7A, 0x3B, 0x57, 0x55, 0xC0, 0x65, 0x65, 0xA1, 0xA7, 0xA4, 0x83, 0xA1,
+    0xA5, 0x79, 0x61, 0x75, 0x61, 0x66, 0x65, 0x66, 0x66, 0x56, 0xC1, 0x66, 0xA2, 0x77, 0xA3, 0x78,
+    0x5F, 0xA0, 0x6A, 0xA4, 0x6B, 0xA2, 0x6A, 0x9D, 0x6B, 0x51, 0xA7, 0x88, 0xA3, 0x88, 0x9B, 0x98,
+    0x9C, 0x77, 0xA2, 0x87, 0xA2, 0x97, 0xA2, 0x98, 0xA4, 0x88, 0xA6, 0x89, 0xA4, 0x8A, 0xA2, 0x8A,
+    0x6B, 0x95, 0x8B, 0x92, 0x99, 0x5B, 0x66, 0xC0, 0x19, 0xC2, 0x14, 0x19, 0xC0, 0x7A, 0x6E, 0x28,
+    0xC1, 0x2D, 0xC3, 0x28, 0x19, 0x55, 0x3E, 0xC0, 0x6E, 0x7E, 0x6D, 0x69, 0x6D, 0xC2, 0x7E, 0xC1,
+    0x69, 0xC0, 0x7E, 0x6E, 0x6B, 0xC0, 0x09, 0x5A, 0x76, 0x6F, 0x17, 0x56, 0xA3, 0x89, 0xAA, 0x89,
+    0x97, 0x78, 0x59, 0x55, 0x9B, 0x89, 0x66, 0x5A, 0x65, 0xA3, 0x89, 0xA5, 0x99, 0x97, 0x88, 0x61,
+    0xA9, 0x89, 0x66, 0x7E, 0x19, 0xC1, 0x1E, 0x6F, 0x56, 0x61, 0x9D, 0x99, 0x9D, 0x99, 0x94, 0x98,
+    0x95, 0x99, 0x9A, 0x99, 0xA1, 0x8A, 0xB2, 0x78, 0xB8, 0x78, 0xA9, 0x88, 0x99, 0x78, 0x98, 0x88,
+    0xA2, 0x78, 0xA8, 0x98, 0x7F, 0x9C, 0x88, 0x9D, 0x99, 0x69, 0x6E, 0x6F, 0x9D, 0x98, 0x96, 0x99,
+    0xA3, 0xA8, 0x89, 0x99, 0xA8, 0x78, 0xB2, 0x88, 0xA3, 0x89, 0x66, 0xC0, 0xA4, 0x88, 0x7E, 0x96,
+    0x87, 0x92, 0x98, 0xA5, 0x98, 0xB8, 0x99, 0x16, 0x9D, 0x88, 0x9C, 0x88, 0x99, 0x98, 0x6B, 0xAD,
+    0x88, 0xA3, 0x9A, 0x9B, 0x97, 0x9C, 0x86, 0x9D, 0x99, 0x90, 0x88, 0x7E, 0xC1, 0x62, 0x53, 0x4A,
+    0x66, 0x39, 0x6B, 0x14, 0x2D, 0x6F, 0xC2, 0x7B, 0xC0, 0x55, 0x9D, 0x99, 0x40, 0xC2, 0x9D, 0xA6,
+    0x7F, 0x6E, 0xC0, 0x7B, 0x6F, 0x7E, 0x6B, 0x6E, 0xC0, 0x6E, 0x7F, 0x5A, 0x10, 0x55, 0xC2, 0x56,
+    0xC0, 0x65, 0x5A, 0x25, 0xC1, 0x6F, 0x39, 0x3E, 0x6F, 0x7A, 0x6F, 0xC0, 0x69, 0x50, 0xAD, 0x85,
+    0xAD, 0xA4, 0x9D, 0x96, 0x99, 0x98, 0x9C, 0x89, 0xA4, 0x88, 0x7E, 0x66, 0xC0, 0x41, 0x7A, 0xA3,
+    0x98, 0xA3, 0x87, 0x7E, 0x98, 0x97, 0x9C, 0x77, 0xA6, 0x89, 0xA3, 0x79, 0x67, 0x1F, 0xC1, 0x1A,
+    0xC0, 0x65, 0xC2, 0x6E, 0x1A, 0xC0, 0x6B, 0xC0, 0x6B, 0x6B, 0x6B, 0x6B, 0x5A, 0x7B, 0x56, 0xC0,
+    0x66, 0x55, 0x6B, 0xC1, 0x37, 0x7F, 0x69, 0x04, 0x3D, 0x7E, 0x69, 0xC0, 0x6E, 0x7E, 0x6D, 0x6E,
+    0xA2, 0x8A, 0xA3, 0x8C, 0xA4, 0x6B, 0x67, 0x8F, 0x99, 0x96, 0x89, 0x2D, 0x6F, 0x7A, 0x01, 0xC1,
+    0x39, 0xC5, 0x5A, 0xC4, 0x39, 0x69, 0x35, 0x92, 0x8A, 0x99, 0x89, 0x7A, 0xA3, 0x88, 0x66, 0xA3,
+    0x88, 0xA5, 0x89, 0xA4, 0x87, 0x00, 0x38, 0x95, 0xA8, 0x98, 0x97, 0x74, 0xAB, 0x85, 0xA9, 0xA5,
+    0xA8, 0x87, 0xA6, 0x78, 0xA2, 0x89, 0x6B, 0x57, 0x65, 0xA3, 0x87, 0x58, 0x61, 0x7C, 0x78, 0x9E,
+    0x86, 0x76, 0x61, 0x76, 0x51, 0x65, 0x7B, 0x65, 0xC0, 0x66, 0x66, 0x56, 0x7A, 0x2A, 0xA2, 0x78,
+    0x5F, 0xA2, 0x6A, 0xA1, 0x6A, 0x9F, 0x7C, 0xA0, 0x6A, 0x9D, 0x89, 0xA2, 0x87, 0xA3, 0x88, 0xC0,
+    0x54, 0x50, 0xA1, 0xA8, 0xA3, 0x88, 0x7E, 0xA4, 0x8A, 0xAA, 0x99, 0xA1, 0x8A, 0x6B, 0x9A, 0x89,
+    0x8E, 0x8B, 0x52, 0x6F, 0xC0, 0x21, 0xC0, 0x56, 0xC2, 0x1C, 0x21, 0x2D, 0xC3, 0x35, 0xC0, 0x2D,
+    0xC0, 0x66, 0x19, 0x55, 0x66, 0xC0, 0x6D, 0x7E, 0x6D, 0x6D, 0x69, 0xC2, 0x7F, 0xC0, 0x69, 0xC2,
+    0x7E, 0xC1, 0x55, 0xC0, 0x66, 0x08, 0x7A, 0x56, 0xA9, 0x8A, 0x5E, 0x9E, 0x67, 0x52, 0x9C, 0x88,
+    0x9C, 0x88, 0x5A, 0x65, 0xA6, 0x78, 0x66, 0x9B, 0x99, 0x66, 0x51, 0xA5, 0x88, 0xC0, 0xA2, 0x88,
+    0xA3, 0x99, 0xC0, 0x51, 0x11, 0xA2, 0x77, 0x51, 0x11, 0xC0, 0x7B, 0x66, 0x99, 0x88, 0x97, 0x99,
+    0x9B, 0x9A, 0x98, 0x88, 0xA2, 0x88, 0xB4, 0x89, 0xB7, 0x68, 0x41, 0x99, 0x98, 0x6B, 0xA7, 0x98,
+    0xA2, 0x98, 0x9D, 0x89, 0x9D, 0x88, 0x69, 0xA2, 0x88, 0x6F, 0x61, 0x9A, 0x88, 0x98, 0xA9, 0x83,
+    0xA8, 0xA8, 0x68, 0xBC, 0x88, 0xA3, 0x99, 0x51, 0xA4, 0x88, 0x6F, 0x69, 0x9B, 0x88, 0x8A, 0x98,
+    0xA0, 0xA8, 0xBE, 0x88, 0xA5, 0x98, 0xA2, 0x78, 0xA5, 0x98, 0x99, 0x98, 0x9D, 0x89, 0xA9, 0x99,
+    0xA2, 0x89, 0x9C, 0x87, 0x9D, 0x98, 0x91, 0x88, 0x9B, 0x99, 0xC0, 0x61, 0x61, 0x5B, 0x6E, 0x39,
+    0xC0, 0x6B, 0x5A, 0x05, 0xA2, 0x88, 0xA2, 0x88, 0xC1, 0x56, 0x66, 0x51, 0x51, 0xC0, 0x3D, 0x0C,
+    0xC0, 0x9C, 0x95, 0x7F, 0xC1, 0x6F, 0x7E, 0x01, 0x7A, 0x6F, 0xC0, 0xA2, 0x78, 0x7E, 0xC0, 0x1C,
+    0x55, 0x01, 0xC2, 0x39, 0x66, 0x59, 0x66, 0xC0, 0x6F, 0x39, 0x6E, 0x05, 0x6E, 0x19, 0xC0, 0x69,
+    0x55, 0xA3, 0x97, 0xB5, 0x93, 0x9F, 0x95, 0x98, 0x87, 0x9A, 0x88, 0xA4, 0x98, 0xA3, 0x99, 0x9D,
+    0x99, 0x5A, 0x7E, 0x52, 0x65, 0x6E, 0xA2, 0x97, 0x79, 0x96, 0x88, 0xA3, 0x87, 0xAA, 0x77, 0x57,
+    0xC0, 0xA0, 0x8A, 0x56, 0xC1, 0x07, 0xC1, 0x59, 0xC0, 0x66, 0x6B, 0x6E, 0x6B, 0x67, 0x6F, 0x6B,
+    0x6B, 0xC0, 0x6B, 0x6B, 0x66, 0x35, 0x6F, 0x66, 0x7F, 0xC3, 0x69, 0x65, 0x6E, 0x7E, 0x6D, 0x69,
+    0x6E, 0x7E, 0xC0, 0x6E, 0xA2, 0x88, 0xA3, 0x8C, 0xA3, 0x7E, 0xA1, 0x8B, 0xC0, 0x9C, 0x97, 0x93,
+    0x88, 0x92, 0x88, 0x2D, 0xA2, 0x78, 0x39, 0xC4, 0x34, 0x5E, 0xC0, 0x66, 0xC0, 0x36, 0xC2, 0x39,
+    0x3E, 0x1C, 0x8F, 0x8A, 0xA5, 0x99, 0xC0, 0x3B, 0x9C, 0x88, 0xA2, 0x88, 0xA8, 0x88, 0xA8, 0x88,
+    0x55, 0x97, 0x89, 0x99, 0xA9, 0x64, 0xA4, 0x97, 0xA0, 0x95, 0xAA, 0x84, 0xB0, 0x94, 0xA5, 0x98,
+    0x5F, 0x65, 0x66, 0x1D, 0x69, 0x55, 0x79, 0x79, 0x69, 0xC0, 0x60, 0x62, 0xC0, 0x61, 0x66, 0x7A,
+    0x62, 0x55, 0xC0, 0x61, 0x56, 0xC0, 0xA2, 0x78, 0x00, 0xA0, 0x6A, 0xA3, 0x7A, 0xA1, 0x7B, 0x9F,
+    0x7B, 0x9F, 0x6A, 0x46, 0x7A, 0xA2, 0x77, 0x51, 0x64, 0x6D, 0x7E, 0x75, 0xA2, 0x88, 0xA2, 0x89,
+    0xA7, 0x9B, 0xA3, 0x99, 0x9C, 0x87, 0xA9, 0x8A, 0x95, 0x8D, 0x1C, 0xA2, 0x88, 0x5A, 0xC0, 0x65,
+    0xC4, 0x6B, 0xA2, 0x87, 0x6B, 0x6E, 0xC3, 0x3C, 0x35, 0x28, 0x55, 0xC0, 0x65, 0xC0, 0x12, 0x6D,
+    0x69, 0x6E, 0x69, 0xC2, 0x7A, 0xC1, 0x69, 0xC0, 0x6E, 0xC2, 0x03, 0x69, 0x66, 0x03, 0xC0, 0xA2,
+    0x88, 0xAE, 0x79, 0x99, 0x78, 0x98, 0x68, 0x52, 0x6B, 0x50, 0x9C, 0x88, 0x22, 0xA5, 0x88, 0xC0,
+    0x9C, 0x89, 0xA2, 0x88, 0x9C, 0x98, 0x9B, 0x88, 0x36, 0xA3, 0x99, 0xC0, 0x5A, 0x65, 0x6B, 0xA2,
+    0x88, 0x69, 0x25, 0xC0, 0x66, 0x66, 0x9B, 0x99, 0x95, 0x89, 0xAB, 0x89, 0xA3, 0x99, 0x97, 0x99,
+    0x95, 0x98, 0xA9, 0x79, 0xB7, 0x78, 0xA3, 0x89, 0x9A, 0x88, 0x51, 0xA4, 0xA9, 0xA4, 0x87, 0xC0,
+    0x55, 0x6F, 0x1E, 0x52, 0xA4, 0x87, 0x9A, 0x98, 0x94, 0x99, 0x81, 0xA8, 0xAB, 0x78, 0x39, 0x67,
+    0xA2, 0x88, 0xA2, 0x88, 0x55, 0x55, 0x98, 0x87, 0x88, 0xA8, 0x7B, 0xFF, 0xB5, 0xD7, 0x9C, 0x87,
+    0xAA, 0x88, 0xAA, 0x87, 0x65, 0x9B, 0x99, 0xA7, 0x89, 0x6B, 0x9B, 0xA7, 0x99, 0x87, 0x92, 0x89,
+    0x66, 0x55, 0x9D, 0x99, 0x6B, 0x6E, 0xC0, 0x56, 0xC0, 0x6B, 0x59, 0x6B, 0x7E, 0xC0, 0x3D, 0x66,
+    0x55, 0xC0, 0x38, 0xA2, 0x88, 0xC2, 0x9C, 0x95, 0x7A, 0x6F, 0xC0, 0x6B, 0x6E, 0x3C, 0x01, 0x7F,
+    0xC0, 0xA2, 0x88, 0x6E, 0x30, 0x29, 0x51, 0x0D, 0x01, 0x0D, 0x01, 0x3C, 0x39, 0x66, 0x55, 0xC0,
+    0x34, 0x39, 0x6E, 0x05, 0x6E, 0x0D, 0x6E, 0xC0, 0x3E, 0xB0, 0x94, 0xAA, 0x83, 0x97, 0x96, 0x9B,
+    0x88, 0x6F, 0x7A, 0xA2, 0x99, 0xC0, 0x55, 0x7E, 0x66, 0xC0, 0x50, 0x69, 0xA2, 0x98, 0x96, 0x88,
+    0xA8, 0x87, 0xA5, 0x88, 0x5A, 0xC0, 0x57, 0xC2, 0x66, 0x7A, 0xC0, 0x55, 0xC2, 0x6B, 0xC0, 0x06,
+    0x6B, 0xC0, 0x57, 0x6B, 0xC0, 0x6B, 0x7F, 0xC0, 0x6F, 0x6B, 0xC0, 0x7A, 0xC0, 0x6E, 0x3F, 0x69,
+    0x69, 0x6E, 0x69, 0x6D, 0x7D, 0x6E, 0x7A, 0x6E, 0x6F, 0x7F, 0xA4, 0x7B, 0xA4, 0x6E, 0xA0, 0x8B,
+    0x2A, 0xC1, 0x94, 0x97, 0x8D, 0x89, 0x66, 0x6B, 0x2D, 0x39, 0xC1, 0x56, 0xC1, 0x69, 0xC2, 0x6F,
+    0x69, 0xC1, 0xA3, 0x99, 0x39, 0x90, 0x8A, 0xC0, 0xA4, 0x88, 0x7F, 0x27, 0x51, 0xA5, 0x98, 0xA6,
+    0x89, 0x9D, 0x88, 0x27, 0xC1, 0x64, 0x9D, 0xA6, 0xAB, 0x94, 0xB8, 0xA4, 0xA3, 0x87, 0x59, 0xC0,
+    0x68, 0x66, 0x0D, 0xC0, 0x7A, 0x66, 0x79, 0xC0, 0x65, 0x55, 0x61, 0x66, 0x66, 0x61, 0x51, 0x65,
+    0xC0, 0x6B, 0x7A, 0x65, 0x5A, 0xA4, 0x68, 0xA1, 0x7A, 0xA2, 0x7B, 0xA2, 0x7A, 0xA0, 0x5A, 0x9F,
+    0x7B, 0x9E, 0x68, 0x9D, 0x98, 0xA2, 0x87, 0x7E, 0x9B, 0x98, 0xA2, 0x76, 0xA5, 0xA8, 0x66, 0x37,
+    0xA2, 0x99, 0xA3, 0x8A, 0xA8, 0x88, 0x7B, 0x51, 0xA5, 0x8B, 0x8C, 0x8B, 0x9C, 0x79, 0xC2, 0x66,
+    0xC0, 0x69, 0xC1, 0x2D, 0xA2, 0x88, 0xC0, 0x7E, 0xC0, 0x6B, 0xC0, 0x09, 0x01, 0xC0, 0x56, 0x2D,
+    0xC0, 0x21, 0xC0, 0x5A, 0x69, 0x69, 0x69, 0x69, 0xC1, 0x6F, 0xC0, 0x7A, 0x65, 0xC1, 0x6E, 0xC1,
+    0x05, 0x69, 0x5A, 0xC0, 0x3E, 0x55, 0xAB, 0x89, 0xA6, 0x79, 0x90, 0x78, 0x5E, 0xA2, 0x88, 0x9D,
+    0x8A, 0x65, 0x6E, 0xA2, 0x89, 0x31, 0x55, 0xC0, 0x66, 0x9D, 0x89, 0x1D, 0x36, 0x3D, 0x6E, 0xC1,
+    0x11, 0xA3, 0x99, 0x59, 0x7F, 0x34, 0x39, 0x34, 0x99, 0x9A, 0x98, 0x88, 0xA4, 0x78, 0xA8, 0x88,
+    0xA4, 0x77, 0x52, 0x94, 0x88, 0x9B, 0xAA, 0xB4, 0x77, 0xA9, 0x89, 0x99, 0x99, 0x9D, 0x98, 0x7F,
+    0xA5, 0x88, 0x6B, 0x0A, 0xA2, 0x89, 0x90, 0x87, 0x94, 0x99, 0xB0, 0x88, 0xAE, 0x88, 0x8D, 0xA8,
+    0x84, 0x88, 0xB5, 0x78, 0xB5, 0x99, 0x51, 0xA3, 0x89, 0xC0, 0x41, 0x64, 0x98, 0x88, 0x89, 0xA9,
+    0xA0, 0xA9, 0xB5, 0x98, 0x59, 0xA7, 0x99, 0xA2, 0x87, 0xC0, 0xAD, 0x99, 0xA6, 0x89, 0x68, 0x96,
+    0x97, 0x95, 0x99, 0x98, 0x8A, 0x6E, 0x51, 0x65, 0x6B, 0x5A, 0xC1, 0x6F, 0xC0, 0x66, 0x5A, 0x66,
+    0x69, 0x56, 0x7B, 0x38, 0xA2, 0x88, 0xC3, 0x9C, 0x95, 0xC0, 0x7F, 0xC0, 0x6F, 0x35, 0x3C, 0xC0,
+    0x01, 0x10, 0x6F, 0x7E, 0x6F, 0x6E, 0x24, 0x15, 0x56, 0x01, 0xC1, 0x3C, 0x56, 0x59, 0xC0, 0x39,
+    0x6E, 0x05, 0x3E, 0x05, 0x0D, 0xC0, 0x3E, 0xA7, 0x96, 0xB1, 0x94, 0x9A, 0x94, 0x97, 0x87, 0xA6,
+    0x88, 0x57, 0x7B, 0xA3, 0x89, 0x9D, 0x99, 0x65, 0xA2, 0x87, 0x7A, 0xC0, 0x65, 0x50, 0xA2, 0x77,
+    0x9A, 0x99, 0xA6, 0x88, 0xA2, 0x77, 0xC0, 0x65, 0x5A, 0xC0, 0x6E, 0xC0, 0x67, 0x76, 0x5A, 0x38,
+    0xC0, 0x66, 0xC0, 0x5B, 0xC0, 0x6B, 0xC0, 0x05, 0x67, 0xC0, 0x66, 0x5A, 0x7F, 0xC1, 0x6B, 0x6E,
+    0x7B, 0x6E, 0x7F, 0x69, 0xC0, 0x69, 0x6D, 0x69, 0x69, 0x7D, 0x6D, 0x7E, 0x6E, 0x6F, 0xA1, 0x9B,
+    0xA4, 0x7B, 0xA4, 0x6F, 0xA0, 0x8B, 0xC0, 0x1C, 0x9E, 0x96, 0x1C, 0x95, 0x99, 0x2D, 0xC0, 0x5A,
+    0x66, 0x2A, 0xC1, 0x25, 0xC0, 0x5A, 0xC1, 0x6E, 0x2A, 0x27, 0x2A, 0x6E, 0xA5, 0x98, 0x96, 0x9A,
+    0x95, 0x8A, 0x9D, 0x99, 0xA4, 0x77, 0xA7, 0x99, 0x51, 0x9B, 0x99, 0x2C, 0x36, 0x27, 0x36, 0x41,
+    0x7D, 0x9D, 0x98, 0x9E, 0x95, 0xB0, 0x94, 0xB6, 0x94, 0x6D, 0x1B, 0x68, 0x7E, 0xC0, 0x0D, 0x15,
+    0x6B, 0x79, 0x56, 0x61, 0x59, 0x7A, 0xC0, 0x65, 0x66, 0x66, 0x61, 0x65, 0x66, 0xC1, 0x79, 0x4A,
+    0xA2, 0x78, 0xA0, 0x7B, 0xA2, 0x7B, 0xA0, 0x6A, 0xA2, 0x7A, 0xA0, 0x5A, 0x9D, 0x89, 0x50, 0x40,
+    0xA2, 0x98, 0x7D, 0x6D, 0x7E, 0xA2, 0x98, 0x7F, 0xA3, 0x89, 0xA3, 0x99, 0xA3, 0x9A, 0xA6, 0x79,
+    0x9B, 0xA9, 0xA2, 0x67, 0x9A, 0x8B, 0x8F, 0x9B, 0x7F, 0xC0, 0x67, 0x5A, 0x69, 0x66, 0x2D, 0x35,
+    0x7F, 0x6E, 0x6B, 0x6E, 0xC3, 0x09, 0xC0, 0x56, 0xC2, 0x35, 0x5A, 0x69, 0x65, 0x59, 0x65, 0x6E,
+    0x09, 0xC3, 0x66, 0x6D, 0x7A, 0xC0, 0x56, 0xC3, 0x69, 0xC0, 0xAF, 0x89, 0x9B, 0x78, 0x98, 0x68,
+    0x56, 0x51, 0x6B, 0xA4, 0x88, 0xA2, 0x88, 0xC0, 0x9B, 0x89, 0x7E, 0xA3, 0x89, 0x9D, 0x99, 0x9D,
+    0x98, 0xA2, 0x88, 0x29, 0x3D, 0x11, 0x04, 0x6E, 0x9B, 0x99, 0x09, 0xA6, 0x98, 0xA2, 0x88, 0x6F,
+    0x9B, 0x98, 0x91, 0x99, 0xA5, 0x99, 0x6F, 0x56, 0xA4, 0x77, 0xA7, 0x88, 0x5A, 0x66, 0x9A, 0x99,
+    0x98, 0x88, 0xA9, 0x89, 0xAC, 0x88, 0x66, 0x9D, 0x98, 0x6B, 0xA2, 0x87, 0x02, 0x66, 0xC0, 0x8A,
+    0x98, 0x8D, 0xA9, 0xB7, 0x88, 0xB9, 0x88, 0x86, 0x98, 0x87, 0xA8, 0xFF, 0x6C, 0x50, 0xB0, 0x79,
+    0x3D, 0x7F, 0x65, 0x3D, 0x60, 0x9A, 0x88, 0x84, 0x98, 0xA3, 0xA9, 0xB8, 0x88, 0x9C, 0x88, 0x98,
+    0x87, 0xA2, 0x87, 0xAA, 0x88, 0xAE, 0x98, 0x31, 0x9E, 0x84, 0x95, 0x99, 0x91, 0x9B, 0xC0, 0x65,
+    0x52, 0x39, 0xC0, 0x6B, 0xC0, 0x6E, 0x00, 0x5A, 0xC0, 0x66, 0x55, 0xC0, 0x38, 0x3D, 0x7F, 0xC3,
+    0x9B, 0xA6, 0x6E, 0x7F, 0x6E, 0x7F, 0x3C, 0xC2, 0x6F, 0x7E, 0xA2, 0x88, 0x6E, 0x6F, 0x30, 0x24,
+    0x10, 0x55, 0xC1, 0x39, 0x66, 0x59, 0x34, 0x39, 0x05, 0xC0, 0x69, 0x05, 0x7E, 0x5A, 0x79, 0xB3,
+    0x94, 0xA3, 0x94, 0x90, 0x86, 0xA4, 0x87, 0xA4, 0x78, 0x67, 0xA3, 0x9B, 0x67, 0x51, 0x7A, 0xA2,
+    0x86, 0x50, 0x7E, 0x65, 0x55, 0xC1, 0x15, 0x6E, 0x69, 0x55, 0x65, 0xC0, 0x69, 0x6F, 0xC0, 0x67,
+    0xC0, 0x38, 0x66, 0x5A, 0xC0, 0x6B, 0xC0, 0x6B, 0xC0, 0x7B, 0x6F, 0x6B, 0xC1, 0x66, 0x55, 0x52,
+    0x65, 0xA2, 0x87, 0x07, 0x6E, 0x16, 0x1B, 0x14, 0x0D, 0x15, 0x69, 0x69, 0x7D, 0x6E, 0x7E, 0x6E,
+    0xA2, 0x89, 0xA2, 0x7A, 0xA3, 0x8B, 0xA4, 0x6E, 0xA0, 0x8D, 0xC0, 0xA0, 0x85, 0x9B, 0x94, 0xC0,
+    0xA5, 0x8C, 0x8F, 0x9A, 0x90, 0x8A, 0x7E, 0x25, 0xC1, 0x5A, 0xC5, 0x6E, 0xC0, 0x7F, 0x7E, 0xA5,
+    0x98, 0x93, 0x8A, 0x9A, 0x99, 0x9A, 0x89, 0x6E, 0xA4, 0x88, 0x13, 0xA2, 0x88, 0xC0, 0x13, 0x7E,
+    0xA3, 0x88, 0x1B, 0x41, 0x79, 0x9D, 0x96, 0xFF, 0xB4, 0xEB, 0xAA, 0x95, 0xA2, 0x76, 0x0D, 0x7A,
+    0x6E, 0x10, 0xC0, 0x15, 0xC0, 0x10, 0xC0, 0x66, 0xC0, 0x69, 0x66, 0xC0, 0x65, 0x66, 0x69, 0x65,
+    0x66, 0x69, 0x66, 0xC0, 0x5A, 0xA2, 0x79, 0xA1, 0x7B, 0xA0, 0x8B, 0x47, 0x9F, 0x7B, 0xA1, 0x6B,
+    0x56, 0x9D, 0x87, 0x54, 0xA2, 0x98, 0x69, 0xA3, 0x97, 0x6E, 0x7F, 0xA2, 0x98, 0xA2, 0x88, 0xA3,
+    0x99, 0x7B, 0xA7, 0x8A, 0xA2, 0x7A, 0x9D, 0x98, 0xA1, 0x8A, 0x8D, 0x9B, 0x9B, 0x89, 0x7F, 0xC0,
+    0x66, 0x5A, 0x2D, 0x7A, 0xA2, 0x78, 0x7F, 0xC0, 0x6E, 0xC2, 0x1D, 0x15, 0xC0, 0x10, 0x59, 0x01,
+    0xC3, 0x69, 0x55, 0x64, 0x5A, 0x65, 0x6B, 0xC1, 0x66, 0xC0, 0x69, 0xC0, 0x7A, 0x04, 0x66, 0xC1,
+    0x04, 0xC0, 0x69, 0xA3, 0x98, 0xAC, 0x78, 0x99, 0x68, 0x5B, 0x99, 0x88, 0x9D, 0x99, 0xA3, 0x89,
+    0x11, 0x9D, 0x99, 0x3D, 0x51, 0xA3, 0x99, 0xA3, 0x89, 0x51, 0x66, 0xA2, 0x77, 0x51, 0x2C, 0xA3,
+    0x88, 0x9B, 0x89, 0x66, 0x9B, 0x98, 0x9A, 0x88, 0xA8, 0x88, 0xA2, 0x88, 0x30, 0x95, 0x99, 0x92,
+    0x99, 0xA8, 0x98, 0xA7, 0x79, 0x6E, 0x6E, 0x10, 0xA7, 0x88, 0x52, 0x5A, 0x65, 0x99, 0x99, 0x7F,
+    0xA8, 0x89, 0x7F, 0x1A, 0xC0, 0xA4, 0x88, 0xC1, 0xA4, 0x98, 0x8E, 0x99, 0x83, 0xA8, 0xAC, 0x88,
+    0xB9, 0x78, 0x8F, 0x98, 0x8F, 0x89, 0xFF, 0x7C, 0xF3, 0xAB, 0x89, 0x02, 0x7A, 0x56, 0x66, 0x6D,
+    0x94, 0x88, 0x8A, 0xA8, 0xAD, 0x99, 0xB4, 0x98, 0x99, 0x88, 0x97, 0x98, 0x50, 0x2A, 0xB2, 0x87,
+    0xA9, 0x97, 0x55, 0x8E, 0x9B, 0x99, 0x99, 0x6E, 0x3C, 0x39, 0x6B, 0xC2, 0x5A, 0x66, 0xC0, 0x69,
+    0x56, 0xC0, 0x7B, 0x3D, 0x7F, 0xC3, 0x9C, 0x95, 0xC0, 0x21, 0x6E, 0x7F, 0x01, 0x7A, 0x01, 0xC0,
+    0x6B, 0x7E, 0x6F, 0x7E, 0x6F, 0xC0, 0x24, 0x10, 0x01, 0x3C, 0xC0, 0x56, 0xC0, 0x55, 0x2A, 0x39,
+    0x6E, 0x6B, 0x3E, 0x05, 0x7E, 0x39, 0xAB, 0x95, 0xB0, 0x82, 0x95, 0xA7, 0x9D, 0x88, 0xA4, 0x77,
+    0x9C, 0x88, 0xA2, 0x89, 0xA0, 0x9B, 0x9F, 0x8B, 0xA2, 0x98, 0x79, 0x68, 0x54, 0x69, 0x65, 0x7F,
+    0x41, 0x0D, 0xA2, 0x88, 0x7E, 0x55, 0x65, 0x58, 0x55, 0x66, 0x2E, 0x7B, 0x6B, 0xC2, 0x3A, 0x5A,
+    0xC1, 0x6B, 0x66, 0xC0, 0x6F, 0x6B, 0x7F, 0xC1, 0x66, 0x55, 0x65, 0x6E, 0xC2, 0x39, 0x7A, 0x6E,
+    0x3F, 0x38, 0x7E, 0x79, 0x6E, 0x6E, 0xA2, 0x88, 0xA2, 0x89, 0xA3, 0x7A, 0xA1, 0x9B, 0xA3, 0x7E,
+    0xA2, 0x7D, 0x6B, 0x68, 0x9D, 0x92, 0x9F, 0xA6, 0xA2, 0x7B, 0x9F, 0x9D, 0x87, 0x8B, 0x9B, 0x89,
+    0xC1, 0x5A, 0xC4, 0x66, 0x22, 0xC0, 0x7E, 0x6E, 0x0B, 0xA4, 0x87, 0x8F, 0x9B, 0x95, 0x9A, 0xA3,
+    0x89, 0x51, 0x7E, 0xC0, 0xA2, 0x78, 0xC0, 0x65, 0xC0, 0x7F, 0x9D, 0x88, 0x1B, 0x99, 0x87, 0xA8,
+    0x86, 0xFF, 0xC5, 0xAE, 0xA2, 0xA4, 0xA3, 0x86, 0x79, 0x5A, 0x10, 0xC1, 0x6E, 0xC0, 0x0D, 0x15,
+    0x6B, 0x15, 0x0D, 0x76, 0x66, 0x69, 0x66, 0x59, 0x7A, 0x55, 0xC0, 0x62, 0x69, 0xA1, 0x8A, 0xA2,
+    0x78, 0x0E, 0xA0, 0x8A, 0x9E, 0x7B, 0x9D, 0x7A, 0x9E, 0x6A, 0x56, 0x9E, 0x86, 0xA3, 0x87, 0x7B,
+    0x9A, 0x87, 0xA5, 0x87, 0xA4, 0x87, 0x7F, 0x0F, 0xA2, 0x97, 0x6E, 0x7B, 0xA6, 0x9A, 0xA6, 0x7B,
+    0xA1, 0x8A, 0x23, 0x95, 0x99, 0x91, 0x8A, 0x7F, 0xC1, 0x66, 0x69, 0x3C, 0xA2, 0x87, 0x6B, 0x6E,
+    0x7E, 0x6B, 0xC0, 0x6E, 0xC0, 0x24, 0x15, 0x10, 0x09, 0x5A, 0xC3, 0x69, 0x65, 0x51, 0x69, 0x56,
+    0xC1, 0x66, 0xC0, 0x66, 0xC1, 0x0B, 0x06, 0xC3, 0x0B, 0x65, 0xA8, 0x87, 0xA8, 0x68, 0x96, 0x67,
+    0x9B, 0x89, 0xA2, 0x88, 0x6F, 0xC0, 0x51, 0xC0, 0x6F, 0x51, 0xA4, 0x88, 0x7F, 0x6B, 0xC0, 0x55,
+    0x65, 0x56, 0xA5, 0x99, 0x10, 0xC0, 0x9B, 0x88, 0xA2, 0x99, 0x9C, 0x88, 0xC0, 0x9B, 0x99, 0x9D,
+    0x88, 0x7A, 0xC0, 0xA2, 0x78, 0xC0, 0xA2, 0x87, 0x9C, 0x88, 0xAA, 0x88, 0xAB, 0x89, 0x56, 0x55,
+    0x52, 0xA2, 0x88, 0x61, 0x6F, 0xC0, 0x66, 0xA2, 0x88, 0xA5, 0x88, 0x66, 0x7A, 0xA6, 0x89, 0x90,
+    0x98, 0xFF, 0x00, 0x61, 0xA3, 0x89, 0xFF, 0x84, 0xF3, 0x92, 0x88, 0x91, 0x89, 0xBA, 0x78, 0xAC,
+    0x88, 0xC0, 0x66, 0x31, 0xA2, 0x88, 0x9D, 0x88, 0x8E, 0x97, 0x8D, 0xAA, 0xBA, 0x88, 0xB1, 0x98,
+    0x98, 0x88, 0x9A, 0x88, 0x7E, 0x0B, 0xA3, 0x87, 0xB0, 0x97, 0x9D, 0x9B, 0x8C, 0x89, 0xA2, 0x88,
+    0x56, 0x66, 0x5A, 0xC1, 0x6E, 0x31, 0x6B, 0x31, 0xC0, 0x56, 0x66, 0x29, 0x38, 0xA2, 0x88, 0x66,
+    0xC0, 0x0C, 0xC0, 0x9C, 0x95, 0x7B, 0x6E, 0x2D, 0x7F, 0xA2, 0x87, 0x6B, 0x66, 0xC0, 0x10, 0xC0,
+    0x6F, 0x7E, 0x6E, 0xC0, 0x24, 0x10, 0x01, 0x3C, 0x34, 0xC1, 0x55, 0xC0, 0x39, 0x6E, 0xC1, 0x6B,
+    0x6E, 0x74, 0xB5, 0x93, 0x9F, 0x95, 0x9B, 0x87, 0xA4, 0x89, 0x9B, 0x88, 0x69, 0x67, 0xA0, 0x8A,
+    0xA2, 0x89, 0x66, 0x64, 0xA0, 0x85, 0x64, 0x6E, 0x7B, 0x56, 0x67, 0xA4, 0x89, 0x6F, 0xC0, 0x1C,
+    0x69, 0xA0, 0x75, 0x66, 0x69, 0x29, 0x6B, 0x7B, 0xC3, 0x37, 0xC1, 0x6B, 0x66, 0xC1, 0x6B, 0xC0,
+    0x6B, 0x7E, 0xC2, 0x59, 0x39, 0xC3, 0x3A, 0x6E, 0x38, 0x7D, 0x7A, 0x6E, 0xA2, 0x87, 0x6F, 0xA2,
+    0x88, 0xA2, 0x7A, 0xA1, 0x8A, 0xA3, 0x8D, 0xA3, 0x7E, 0xA0, 0x8B, 0xC0, 0x9C, 0x90, 0x9C, 0x92,
+    0xA1, 0x8A, 0xA7, 0x7D, 0x94, 0x9B, 0x12, 0x25, 0xC0, 0x56, 0x69, 0xC4, 0x1D, 0x6E, 0x7E, 0xA3,
+    0x87, 0xA2, 0x88, 0xA3, 0x98, 0x8F, 0x9A, 0x94, 0x8A, 0xA4, 0x88, 0x56, 0x65, 0x7F, 0xA2, 0x88,
+    0x59, 0x7F, 0x07, 0x38, 0xA6, 0x88, 0x9A, 0x87, 0x9A, 0x88, 0xB2, 0x86, 0xB0, 0x93, 0xA5, 0xA4,
+    0xA1, 0xA7, 0xA2, 0x87, 0x6E, 0x7E, 0xC1, 0x6F, 0xC1, 0x5A, 0xC0, 0x1C, 0xC0, 0x66, 0xC1, 0x65,
+    0x17, 0x6B, 0x65, 0xC0, 0x65, 0x56, 0xA2, 0x78, 0x6B, 0x5B, 0x28, 0x9F, 0x8B, 0x9C, 0x6A, 0x4B,
+    0x9D, 0x89, 0x9A, 0x87, 0xA4, 0x87, 0xC0, 0x60, 0x6E, 0xA2, 0x87, 0xA2, 0x88, 0xA4, 0x87, 0x65,
+    0x7E, 0xA2, 0x98, 0xA5, 0x9A, 0xA3, 0x9A, 0x7F, 0x5F, 0x67, 0x8F, 0x9C, 0x9D, 0x8B, 0x6E, 0xC0,
+    0x65, 0x3C, 0x7E, 0x6F, 0x6E, 0x7E, 0x6B, 0x6E, 0xC2, 0x24, 0x15, 0x10, 0x15, 0xC1, 0x10, 0x69,
+    0xC1, 0x59, 0x61, 0x55, 0x55, 0xC0, 0x67, 0xC1, 0x65, 0xC4, 0x6B, 0x7E, 0xC1, 0x69, 0xAE, 0x77,
+    0x4F, 0x91, 0x78, 0x69, 0x6F, 0xA3, 0x88, 0xA5, 0x89, 0x9D, 0x99, 0x66, 0x55, 0x65, 0xA4, 0x88,
+    0xA1, 0x8A, 0x9C, 0x99, 0x6F, 0xA2, 0x87, 0x94, 0x87, 0x9A, 0x89, 0xB0, 0x88, 0x9C, 0x88, 0xA3,
+    0x88, 0x51, 0x3A, 0x7E, 0xC0, 0x9B, 0x99, 0x9B, 0x88, 0x6E, 0xC0, 0x08, 0x55, 0xA2, 0x98, 0xC0,
+    0x93, 0x89, 0xA8, 0x88, 0x0C, 0x5A, 0x9C, 0x89, 0x9D, 0x99, 0xA5, 0x88, 0xA2, 0x88, 0x66, 0xC1,
+    0xA3, 0x88, 0x10, 0x0B, 0xA3, 0xA9, 0xA4, 0x88, 0x8A, 0x88, 0x85, 0xD9, 0xA9, 0x68, 0xFF, 0x8D,
+    0x34, 0x92, 0x88, 0x91, 0x89, 0xAB, 0x89, 0xA8, 0x87, 0xAB, 0x99, 0x7E, 0xC0, 0x6E, 0x94, 0x87,
+    0x8B, 0xAA, 0x55, 0xBD, 0x99, 0xAD, 0x99, 0x98, 0x87, 0x51, 0xA3, 0x97, 0x95, 0x98, 0xA9, 0xA7,
+    0xAF, 0x99, 0x8F, 0x8A, 0x96, 0x89, 0x6F, 0x56, 0xC6, 0x56, 0x66, 0xC0, 0x29, 0x7F, 0x7F, 0x59,
+    0xC0, 0x07, 0x6E, 0x21, 0xC0, 0x6E, 0x2D, 0x7F, 0xA2, 0x87, 0x6B, 0xC3, 0x6F, 0x7E, 0x6E, 0x24,
+    0x5A, 0x10, 0x56, 0x51, 0x65, 0xC0, 0x5A, 0xC1, 0x34, 0x39, 0xC1, 0x6F, 0x39, 0xA9, 0x95, 0xB1,
+    0x93, 0x98, 0x85, 0x66, 0xA2, 0x88, 0x9B, 0x89, 0x6E, 0x9D, 0x99, 0xA4, 0x89, 0x56, 0x61, 0x68,
+    0xA2, 0x86, 0x64, 0x7F, 0x6B, 0x9C, 0x8A, 0x66, 0xA4, 0x8A, 0x6F, 0x69, 0xC0, 0x69, 0xA1, 0x85,
+    0xC1, 0x51, 0xC0, 0x67, 0x7E, 0x66, 0x32, 0xC4, 0x6E, 0x6B, 0x66, 0x66, 0x5A, 0x34, 0xC0, 0x6B,
+    0xC1, 0x6E, 0x34, 0xC1, 0x39, 0xC0, 0x79, 0x6E, 0x38, 0x7D, 0xC0, 0x7E, 0xA2, 0x87, 0x6F, 0x7E,
+    0xA1, 0x7B, 0xA2, 0x89, 0xA3, 0x7C, 0xA4, 0x7E, 0xA0, 0x8C, 0xC0, 0x9D, 0xA2, 0x96, 0x80, 0x68,
+    0xA8, 0x8B, 0xA4, 0x7D, 0x87, 0x9D, 0x98, 0x7B, 0x7F, 0x16, 0x6B, 0x5A, 0x16, 0xC3, 0x6E, 0xA2,
+    0x97, 0xA3, 0x88, 0xA2, 0x87, 0xA3, 0x89, 0x8E, 0x9A, 0x96, 0x89, 0xA2, 0x88, 0x52, 0x9D, 0x99,
+    0xA2, 0x78, 0x7A, 0xA2, 0x77, 0xC0, 0x9D, 0x99, 0x38, 0xA3, 0x98, 0x99, 0x87, 0xA9, 0x9A, 0xA4,
+    0x86, 0xA9, 0xA4, 0x32, 0xA3, 0x96, 0xC0, 0x7E, 0x6F, 0xC1, 0x7E, 0xC0, 0x6F, 0x55, 0x6B, 0x6E,
+    0x20, 0x66, 0x65, 0xC0, 0x7F, 0xA2, 0x78, 0x67, 0xC0, 0x69, 0x66, 0x31, 0x55, 0xC0, 0x5B, 0x9E,
+    0x8B, 0x57, 0x9E, 0x6A, 0x5F, 0x9B, 0x88, 0x9B, 0x98, 0x6E, 0x51, 0xA3, 0x97, 0xA3, 0x88, 0xC1,
+    0xA3, 0x98, 0xA3, 0x97, 0x50, 0xA3, 0xA9, 0xA9, 0x89, 0x9D, 0x99, 0x9C, 0x88, 0xA3, 0x99, 0x52,
+    0x9F, 0x8C, 0x93, 0x9C, 0xA1, 0x8A, 0x66, 0xC0, 0x3C, 0xA2, 0x88, 0xC0, 0x6E, 0x7E, 0x6F, 0xC3,
+    0x1D, 0x15, 0xC3, 0x10, 0x69, 0x10, 0x6D, 0x56, 0x65, 0x51, 0x65, 0x5A, 0x12, 0xC0, 0x66, 0xC2,
+    0x7A, 0xC0, 0x6E, 0xC0, 0x21, 0x7A, 0x6E, 0x7E, 0xAE, 0x67, 0x9A, 0x67, 0x99, 0x78, 0x5B, 0x6E,
+    0x7E, 0xA2, 0x89, 0xC0, 0x22, 0x62, 0x1D, 0xA6, 0x88, 0x97, 0x99, 0x9A, 0x89, 0xA5, 0x98, 0x0F,
+    0x97, 0x88, 0x0F, 0xAC, 0x89, 0x50, 0x0E, 0xC0, 0xA3, 0x99, 0x69, 0x52, 0x99, 0x98, 0x51, 0xA3,
+    0x88, 0x51, 0x3F, 0x51, 0x6E, 0x3F, 0x9C, 0x88, 0x8C, 0x88, 0xAC, 0x78, 0xB3, 0x89, 0xA2, 0x89,
+    0x9D, 0x89, 0x9C, 0x87, 0xA2, 0x88, 0x7E, 0x6F, 0xA2, 0x88, 0xC0, 0x9D, 0x99, 0x59, 0x37, 0x31,
+    0x7F, 0xFF, 0x21, 0xA6, 0x93, 0xB9, 0xAF, 0x68, 0xBE, 0x78, 0x8F, 0x98, 0x91, 0x89, 0x6E, 0xA6,
+    0x89, 0xAA, 0x87, 0x66, 0xAB, 0x88, 0xA2, 0x88, 0x8F, 0xA9, 0x0B, 0x9D, 0x99, 0xB4, 0x88, 0xB2,
+    0x88, 0x9D, 0x88, 0x79, 0x50, 0x92, 0xA8, 0xB5, 0x97, 0x6F, 0x8B, 0x8B, 0xC0, 0x56, 0xC4, 0x66,
+    0x5A, 0xC0, 0x66, 0xC1, 0xA2, 0x88, 0x6E, 0xC1, 0x6B, 0x7A, 0xA0, 0x94, 0xC1, 0x6B, 0x6E, 0x7F,
+    0x6F, 0x7A, 0x56, 0xC1, 0x15, 0x7B, 0x6E, 0xC0, 0x56, 0x10, 0x51, 0x55, 0x66, 0x56, 0x6E, 0xC1,
+    0x7F, 0x39, 0xC2, 0x69, 0xB3, 0x92, 0xA3, 0x95, 0x9B, 0x98, 0x56, 0x69, 0x66, 0x41, 0x7A, 0xA2,
+    0x8A, 0x56, 0x65, 0x7D, 0xA2, 0x86, 0x54, 0x9F, 0xAB, 0xA0, 0x8A, 0x9A, 0x88, 0x9A, 0x88, 0xAB,
+    0x89, 0xA2, 0x88, 0xC0, 0x69, 0xC0, 0x04, 0x69, 0x66, 0x69, 0x66, 0x6B, 0xC0, 0x66, 0x5A, 0x6B,
+    0x65, 0xC0, 0x6B, 0x26, 0xC0, 0x2B, 0x26, 0x52, 0x6E, 0x6B, 0x7A, 0x6F, 0x66, 0x34, 0xC0, 0x59,
+    0x2D, 0xC2, 0x2B, 0x33, 0xC0, 0x7D, 0x6E, 0x7E, 0x6E, 0xA2, 0x88, 0x6E, 0xA1, 0x8A, 0xA2, 0x89,
+    0xA2, 0x7C, 0xA5, 0x7D, 0xA0, 0x8D, 0x6B, 0x9F, 0x94, 0xFF, 0xE6, 0xAC, 0x9F, 0x84, 0xA4, 0x8B,
+    0xA6, 0x7D, 0x91, 0x9E, 0x8D, 0x8C, 0xA2, 0x89, 0x59, 0x67, 0xC2, 0x66, 0x69, 0x6E, 0xA3, 0x87,
+    0xA2, 0x97, 0xA2, 0x87, 0xA2, 0x87, 0xA3, 0x89, 0x8D, 0x9B, 0x96, 0x8A, 0x6F, 0x9D, 0x99, 0x66,
+    0x24, 0x6E, 0x24, 0x50, 0xA9, 0x89, 0x65, 0x09, 0xAC, 0x88, 0x9A, 0x89, 0x64, 0xAC, 0x82, 0xB6,
+    0x92, 0x7C, 0x7A, 0xC0, 0xA2, 0x88, 0x6B, 0xC0, 0x7E, 0x6B, 0x5A, 0x6E, 0x7B, 0x5A, 0x66, 0xC2,
+    0x66, 0x6F, 0xC0, 0x66, 0x2E, 0x6E, 0x29, 0x51, 0x6F, 0x52, 0x43, 0x47, 0x56, 0x9C, 0x79, 0x9D,
+    0x88, 0x6E, 0x50, 0x6E, 0xA3, 0x99, 0xA2, 0x87, 0xA2, 0x78, 0x7A, 0x7E, 0xA4, 0x97, 0x69, 0x66,
+    0xA2, 0x88, 0xA4, 0x88, 0xA2, 0x99, 0xA7, 0x8B, 0x9A, 0x87, 0x9B, 0x9A, 0x97, 0x8C, 0x9B, 0x9B,
+    0x6F, 0x69, 0xC0, 0xA2, 0x88, 0xC1, 0xA2, 0x88, 0xC0, 0x6F, 0xC0, 0x6E, 0x29, 0x55, 0xC2, 0x66,
+    0xC2, 0x69, 0xC0, 0x09, 0x55, 0x51, 0xC1, 0x66, 0x55, 0x66, 0xC1, 0x7A, 0x6E, 0x6B, 0x7E, 0x6E,
+    0xC1, 0x7A, 0xA5, 0x88, 0xA9, 0x67, 0x95, 0x68, 0x5E, 0x9D, 0x89, 0xC0, 0x9B, 0x99, 0x6E, 0xA8,
+    0x88, 0x9D, 0x89, 0x7F, 0xA2, 0x88, 0x1A, 0x98, 0x98, 0xA3, 0x98, 0xA5, 0x89, 0x52, 0x65, 0xA3,
+    0x89, 0xA4, 0x89, 0x66, 0x66, 0x7F, 0xA3, 0x88, 0x65, 0x9B, 0x88, 0x98, 0x89, 0xA4, 0x87, 0xA3,
+    0x88, 0x9D, 0x98, 0xA2, 0x88, 0x3F, 0x69, 0xC0, 0xA3, 0x89, 0x98, 0x89, 0x8F, 0x98, 0xA4, 0x89,
+    0xAE, 0x88, 0xAC, 0x78, 0xA3, 0x89, 0x99, 0x98, 0x55, 0x56, 0xA2, 0x88, 0x7E, 0x6F, 0xC1, 0xA3,
+    0x99, 0xA6, 0x99, 0x8B, 0xA9, 0x83, 0xC8, 0xC0, 0xB6, 0x58, 0xB9, 0x88, 0x8C, 0x88, 0x9C, 0x78,
+    0xA2, 0x88, 0xA3, 0x88, 0xA5, 0x98, 0xA7, 0x89, 0xA5, 0x98, 0x96, 0xA9, 0x95, 0x89, 0x65, 0x96,
+    0x87, 0xAD, 0x99, 0xBB, 0x89, 0x65, 0xC0, 0x94, 0x97, 0x9D, 0xA7, 0xB4, 0x87, 0x90, 0x7A, 0x95,
+    0x8A, 0xA2, 0x88, 0x66, 0xC1, 0x56, 0xC1, 0x66, 0xC0, 0x55, 0xC0, 0x6F, 0x29, 0x7F, 0x6E, 0xC0,
+    0x38, 0x3D, 0xA0, 0xA5, 0x6B, 0xC0, 0x6E, 0x6B, 0x7E, 0x6F, 0x7A, 0x15, 0x66, 0xC0, 0x15, 0x6B,
+    0x7A, 0x6E, 0x15, 0x52, 0x55, 0x65, 0x66, 0x56, 0x6E, 0x20, 0xC0, 0x25, 0x7F, 0xC0, 0x39, 0x55,
+    0xA8, 0x95, 0xB0, 0x82, 0x9B, 0x97, 0x50, 0x6B, 0x9D, 0x98, 0xC0, 0x55, 0x2F, 0xA2, 0x89, 0x67,
+    0x55, 0x3E, 0x6D, 0x66, 0x3E, 0xA1, 0x9B, 0x95, 0x98, 0x95, 0x89, 0xB3, 0x88, 0xA3, 0x98, 0xC0,
+    0x6E, 0x65, 0x68, 0xC0, 0x69, 0xC0, 0x66, 0xC0, 0x66, 0xC0, 0x5A, 0x6B, 0xC0, 0x65, 0x56, 0xC0,
+    0x69, 0x66, 0xC2, 0x6B, 0xC0, 0x6F, 0x19, 0x25, 0x1E, 0xC0, 0x26, 0xC0, 0x2B, 0x2E, 0x33, 0x69,
+    0xC0, 0xA2, 0x87, 0x7E, 0xC0, 0x6E, 0xA2, 0x88, 0x6E, 0xA1, 0x8A, 0x7F, 0xA3, 0x7C, 0xA4, 0x7D,
+    0xA0, 0x8D, 0x6B, 0x9F, 0x93, 0xFF, 0xE6, 0xAB, 0x9C, 0x85, 0xA5, 0x8A, 0xA6, 0x8C, 0x9D, 0x8E,
+    0x87, 0x8E, 0x22, 0xC0, 0x66, 0xC2, 0x66, 0x11, 0xA2, 0x87, 0xA2, 0x87, 0xA2, 0x86, 0xA2, 0x87,
+    0x7E, 0xA4, 0x78, 0x90, 0x8B, 0x95, 0x9A, 0x52, 0x56, 0x66, 0xC0, 0x29, 0xA5, 0x99, 0xA7, 0x88,
+    0x65, 0x92, 0x88, 0xAA, 0x88, 0x9B, 0x89, 0x9C, 0x99, 0x64, 0xA7, 0x94, 0xBB, 0x91, 0xA6, 0x85,
+    0x69, 0x36, 0x7F, 0x7E, 0x6B, 0x7F, 0x6E, 0x56, 0x6B, 0x7A, 0x5F, 0x7A, 0x33, 0xC1, 0x66, 0xC0,
+    0x65, 0x56, 0x6E, 0xC0, 0x1A, 0x51, 0x67, 0x47, 0xA0, 0x7A, 0x56, 0x9C, 0x79, 0x9C, 0x79, 0x50,
+    0x55, 0xA2, 0x87, 0xA2, 0x88, 0xA4, 0x77, 0x7F, 0x65, 0xC0, 0xA3, 0x98, 0xA2, 0x87, 0xA3, 0x98,
+    0x66, 0x9D, 0x98, 0xA4, 0x89, 0xAB, 0x9A, 0xA3, 0x8C, 0x64, 0x66, 0x98, 0x89, 0x8F, 0x8B, 0x6B,
+    0x7E, 0xC0, 0x6E, 0x7F, 0xC0, 0xA2, 0x79, 0x7E, 0x6B, 0x6E, 0xC0, 0x55, 0xC1, 0x29, 0x1D, 0x1A,
+    0x15, 0xC1, 0x69, 0xC0, 0x56, 0x65, 0x56, 0x65, 0xC1, 0x21, 0x55, 0x66, 0x7E, 0x6B, 0x7E, 0xC1,
+    0x7E, 0x6B, 0x6E, 0x69, 0xA6, 0x88, 0xA5, 0x67, 0x94, 0x57, 0x5A, 0x56, 0x56, 0x9D, 0x98, 0x56,
+    0xA6, 0x98, 0xA3, 0x89, 0x51, 0x55, 0x66, 0x15, 0xA4, 0x97, 0x52, 0xA2, 0x88, 0x2C, 0x6B, 0xA2,
+    0x88, 0x67, 0xC0, 0x7F, 0xA3, 0x87, 0x51, 0x9A, 0x88, 0x98, 0x88, 0xA7, 0x88, 0xA2, 0x88, 0x9D,
+    0x98, 0xA2, 0x77, 0x66, 0x65, 0xC0, 0x04, 0xA2, 0x99, 0x9C, 0x89, 0x96, 0x88, 0x98, 0x78, 0xA4,
+    0x88, 0xB0, 0x78, 0xA9, 0x88, 0x9D, 0x99, 0x55, 0x65, 0x56, 0xA3, 0x88, 0xA2, 0x88, 0x6F, 0x61,
+    0xA5, 0xAA, 0x8D, 0x98, 0x84, 0xC8, 0x6E, 0x05, 0xFF, 0x6C, 0x30, 0xAD, 0x88, 0x8C, 0x89, 0xA2,
+    0x78, 0xA5, 0x88, 0xA3, 0x98, 0xA4, 0x88, 0xA5, 0x99, 0x9D, 0x98, 0x96, 0x98, 0x9D, 0x89, 0x65,
+    0x95, 0x98, 0xAD, 0x98, 0xBB, 0x89, 0x9C, 0x89, 0x7D, 0x88, 0xA7, 0xA8, 0x87, 0xAF, 0x89, 0x8A,
+    0x8A, 0x6F, 0x66, 0xC0, 0x56, 0xC0, 0x66, 0xC0, 0x59, 0x66, 0x66, 0xC1, 0x15, 0x24, 0xA2, 0x78,
+    0x7A, 0xC1, 0xA2, 0x95, 0xC2, 0x7B, 0x6E, 0x6F, 0x7A, 0x15, 0xC0, 0x66, 0xC0, 0x15, 0xC1, 0x10,
+    0x56, 0x55, 0x61, 0xC0, 0x5A, 0x66, 0xC2, 0x28, 0x6B, 0x6E, 0xA0, 0x75, 0xB0, 0x94, 0xA5, 0x94,
+    0x50, 0x9D, 0x88, 0x7E, 0x9D, 0x9A, 0x55, 0x2F, 0xC0, 0x6F, 0x6B, 0x66, 0x7D, 0x67, 0x56, 0xA2,
+    0x78, 0x7B, 0x90, 0x98, 0x9D, 0x88, 0xAF, 0x88, 0xA4, 0x88, 0xA2, 0x88, 0x79, 0x55, 0x69, 0x69,
+    0xC0, 0x69, 0x66, 0x56, 0x7A, 0x2B, 0xC1, 0x67, 0x69, 0x5A, 0x66, 0xC0, 0x69, 0x1E, 0x17, 0x66,
+    0x56, 0xC0, 0x6B, 0xC0, 0x19, 0x12, 0xC0, 0x17, 0x7E, 0xC0, 0x6E, 0x7E, 0x6E, 0x79, 0x6E, 0x7E,
+    0xC0, 0x6F, 0x7E, 0xA1, 0x8A, 0x7F, 0xA2, 0x78, 0xA3, 0x7B, 0xA3, 0x8F, 0xA2, 0x7B, 0x66, 0x9C,
+    0xA3, 0x9A, 0x80, 0x9D, 0x96, 0x57, 0xA9, 0x8B, 0xA5, 0x7D, 0x8A, 0x8D, 0x94, 0x8B, 0xA1, 0x8A,
+    0xC0, 0x1A, 0x1D, 0x66, 0xC1, 0xA2, 0x86, 0xA3, 0x87, 0xA2, 0x86, 0x7D, 0xA2, 0x87, 0xA3, 0x89,
+    0x97, 0x9B, 0x90, 0x8B, 0x9C, 0x89, 0x56, 0x65, 0xC0, 0x31, 0xA4, 0x88, 0x97, 0x99, 0x9B, 0x88,
+    0xB2, 0x88, 0x9B, 0x89, 0x99, 0x98, 0x7F, 0x56, 0xA6, 0x94, 0xFF, 0xC5, 0x69, 0x2F, 0x66, 0xC0,
+    0xA1, 0x9A, 0x7E, 0x6F, 0x6E, 0x6B, 0x61, 0xA1, 0x8A, 0x6F, 0x6E, 0x2E, 0x6B, 0x6E, 0x2E, 0xC1,
+    0x66, 0x55, 0x66, 0x1A, 0xC0, 0x3E, 0x67, 0xA2, 0x69, 0x43, 0x57, 0x9C, 0x88, 0x9D, 0x89, 0x9B,
+    0x88, 0xC0, 0xA3, 0x88, 0xA3, 0x98, 0xA2, 0x78, 0x69, 0x55, 0x61, 0xA2, 0x98, 0xA7, 0x87, 0x7A,
+    0x6E, 0x03, 0xA4, 0x88, 0xA8, 0x9A, 0xA5, 0x8C, 0x9D, 0x98, 0x65, 0xA3, 0x89, 0x98, 0x88, 0x66,
+    0xA2, 0x77, 0x51, 0xA1, 0xAA, 0xC0, 0x51, 0x9C, 0x89, 0x9D, 0x89, 0x66, 0x55, 0x9D, 0x8A, 0x6E,
+    0x6F, 0xC0, 0x7F, 0x65, 0x1A, 0x66, 0xC1, 0x0E, 0xC0, 0x56, 0x65, 0x66, 0x5A, 0xC0, 0x65, 0x66,
+    0x66, 0xC0, 0x21, 0x7A, 0xC1, 0x7F, 0x6E, 0xC1, 0x6E, 0xA9, 0x87, 0x9A, 0x67, 0x98, 0x68, 0xA3,
+    0x78, 0x6F, 0x9D, 0x88, 0x66, 0x66, 0xC0, 0x6F, 0x9D, 0x98, 0xA6, 0x88, 0xA3, 0x89, 0xA2, 0x88,
+    0x0E, 0x9D, 0x99, 0xA4, 0x88, 0xA3, 0x99, 0x56, 0x56, 0x7A, 0x6F, 0x7A, 0xA2, 0x78, 0x9A, 0x87,
+    0x62, 0x9D, 0x88, 0xA4, 0x88, 0xA3, 0x98, 0x9C, 0x78, 0x7E, 0xC0, 0x35, 0x7A, 0x04, 0xA2, 0x88,
+    0x6F, 0xC0, 0x9A, 0x99, 0x96, 0x78, 0x9B, 0x99, 0xAC, 0x78, 0xAB, 0x89, 0x69, 0x66, 0xC0, 0x55,
+    0x3C, 0x28, 0x41, 0xA3, 0x99, 0x61, 0x89, 0xB9, 0x97, 0xA8, 0x6B, 0xA3, 0x89, 0xFF, 0x85, 0x34,
+    0x9D, 0x89, 0x98, 0x88, 0xA3, 0x88, 0xA2, 0x88, 0x3F, 0xA3, 0xA9, 0xA3, 0x99, 0x98, 0x87, 0x98,
+    0x88, 0xA2, 0x88, 0xC0, 0x99, 0x99, 0xAB, 0x87, 0xB4, 0x99, 0x66, 0x97, 0x98, 0xFF, 0x39, 0xC4,
+    0x84, 0x87, 0x94, 0x8A, 0x97, 0x8A, 0xA2, 0x88, 0x56, 0x69, 0x29, 0x1D, 0x56, 0x66, 0xC0, 0x5A,
+    0x65, 0xC0, 0x0D, 0x10, 0xA2, 0x88, 0xA2, 0x88, 0xC1, 0xA2, 0x95, 0xC0, 0x7E, 0x6B, 0xC0, 0x6E,
+    0x7B, 0x6E, 0xC0, 0x56, 0xC0, 0x66, 0xC2, 0x56, 0x69, 0x52, 0x65, 0xC0, 0x5A, 0x66, 0xC2, 0x25,
+    0xC1, 0xA2, 0x85, 0xB4, 0x83, 0x9E, 0x93, 0x7F, 0x9C, 0x78, 0xC0, 0x61, 0x56, 0xA2, 0x88, 0xC0,
+    0x3B, 0x6B, 0xC0, 0x65, 0x67, 0xA2, 0x89, 0x5F, 0x99, 0xA8, 0x8E, 0x98, 0xA9, 0x88, 0xAB, 0x88,
+    0xA4, 0x88, 0xA2, 0x87, 0xC0, 0x69, 0x65, 0x69, 0xC1, 0x65, 0xC0, 0x66, 0x6F, 0x56, 0xC2, 0x66,
+    0xC0, 0x59, 0x66, 0xC1, 0x7E, 0x1E, 0x66, 0x1E, 0x6B, 0x1E, 0xC0, 0x7A, 0x69, 0xC1, 0x6D, 0x7E,
+    0x69, 0x6E, 0xA2, 0x88, 0xC1, 0x7E, 0xA2, 0x78, 0xA1, 0x9A, 0x7F, 0x6F, 0xA3, 0x7B, 0xA4, 0x7D,
+    0xA1, 0x8C, 0xC0, 0x9D, 0xA3, 0x21, 0x9F, 0x86, 0x9C, 0x78, 0xA4, 0x8A, 0xAC, 0x6B, 0x91, 0x9F,
+    0x8B, 0x8D, 0xA2, 0x8A, 0xC0, 0x59, 0x6B, 0x76, 0xC0, 0x1D, 0xA2, 0x96, 0xA2, 0x76, 0xA2, 0x86,
+    0xA2, 0x87, 0x7E, 0x6E, 0x9F, 0x9B, 0x8C, 0x8B, 0x9A, 0x79, 0x66, 0x7F, 0xA5, 0x89, 0x65, 0x90,
+    0x89, 0xC0, 0xAB, 0x88, 0x19, 0x99, 0x89, 0x7E, 0x66, 0x51, 0xAA, 0x94, 0xB9, 0x91, 0xA5, 0x94,
+    0xC1, 0x6F, 0x7B, 0xC1, 0x6F, 0x66, 0xA1, 0x9A, 0x6F, 0x6E, 0x29, 0xC0, 0x2E, 0x6B, 0xC0, 0x29,
+    0x5A, 0x66, 0x55, 0xC0, 0x06, 0x57, 0xA1, 0x8A, 0x47, 0x9C, 0x69, 0x9C, 0x8A, 0x69, 0x9A, 0x88,
+    0x51, 0xA5, 0x89, 0xA2, 0x87, 0x6E, 0xA2, 0x88, 0x65, 0x50, 0xC0, 0x6E, 0xA2, 0x98, 0x79, 0x6E,
+    0xA3, 0x98, 0xA5, 0x88, 0xA8, 0x99, 0xA5, 0x9D, 0xA1, 0x8A, 0x60, 0x6D, 0x9C, 0x87, 0x7F, 0xA4,
+    0x79, 0x6B, 0x98, 0x95, 0x9D, 0x98, 0xA7, 0x88, 0xA4, 0x79, 0x1B, 0x9D, 0x99, 0x67, 0x9B, 0x79,
+    0x98, 0x8A, 0x53, 0xA2, 0x78, 0xC2, 0x66, 0xC1, 0x69, 0x56, 0x66, 0x69, 0xC0, 0x66, 0x59, 0x66,
+    0x66, 0xC0, 0x7A, 0xC0, 0x6E, 0x7B, 0x6E, 0xC1, 0x7A, 0x6E, 0x5A, 0xA9, 0x77, 0x98, 0x67, 0x9C,
+    0x78, 0x5A, 0x5A, 0xC0, 0x7F, 0x3A, 0x9D, 0x99, 0x55, 0x21, 0xA4, 0x78, 0x66, 0x55, 0xC0, 0x7A,
+    0x09, 0xA5, 0x99, 0x51, 0x66, 0x5A, 0x9D, 0x89, 0x7E, 0xA3, 0x88, 0x9B, 0x99, 0xC0, 0x51, 0xA3,
+    0x99, 0x2C, 0x9C, 0x88, 0x35, 0x04, 0xC0, 0x09, 0xC0, 0x24, 0xA2, 0x88, 0x6F, 0x76, 0x9B, 0x89,
+    0x99, 0x89, 0x51, 0xA2, 0x78, 0xA8, 0x87, 0x6F, 0x61, 0x14, 0xC0, 0x0F, 0xA4, 0x78, 0xC0, 0x9C,
+    0x88, 0x61, 0x8B, 0xC9, 0x9D, 0x89, 0x6E, 0xAB, 0x79, 0xB2, 0x78, 0x3B, 0xC0, 0x12, 0xA5, 0x88,
+    0xA3, 0x99, 0xA2, 0x98, 0x9A, 0x87, 0x9D, 0x99, 0x51, 0x1D, 0x6F, 0x9A, 0x87, 0xAA, 0x88, 0xB0,
+    0x99, 0x65, 0x82, 0xA8, 0xA2, 0x85, 0xB6, 0x8A, 0x89, 0x9B, 0xA3, 0x88, 0x55, 0x66, 0xC0, 0x56,
+    0xC0, 0x66, 0x55, 0x56, 0xC1, 0x7A, 0x6F, 0x15, 0xA2, 0x88, 0x7F, 0xC0, 0xA2, 0x95, 0x7E, 0x6B,
+    0x6E, 0xC0, 0x6B, 0x7E, 0xC2, 0x15, 0xC0, 0x66, 0x55, 0xC0, 0x66, 0x5A, 0x66, 0x65, 0x56, 0x6E,
+    0x20, 0xC0, 0x65, 0x20, 0xC1, 0x55, 0xA8, 0x85, 0xB2, 0x81, 0x99, 0xA6, 0xA4, 0x88, 0x9B, 0x89,
+    0xC0, 0x9A, 0x87, 0x7F, 0xA5, 0x99, 0x5B, 0x5A, 0x42, 0x7A, 0x9C, 0x88, 0x6B, 0xA6, 0x9A, 0x55,
+    0x94, 0x97, 0x94, 0xA8, 0xAC, 0x78, 0xAA, 0x88, 0xA2, 0x87, 0xA2, 0x88, 0x6E, 0x69, 0x65, 0xC0,
+    0x65, 0xC4, 0x56, 0xC1, 0x7B, 0x5A, 0xC0, 0x65, 0xC0, 0x55, 0x66, 0x1E, 0x6B, 0x7A, 0x32, 0x2D,
+    0xC0, 0x6B, 0x2D, 0x65, 0x6E, 0x69, 0x69, 0x7E, 0x6E, 0x69, 0x7E, 0xA2, 0x78, 0x7A, 0x6F, 0x6F,
+    0x7F, 0x6B, 0xA2, 0x78, 0xA3, 0x8B, 0xA3, 0x8D, 0xA2, 0x7A, 0x9D, 0xA7, 0x9D, 0x94, 0x06, 0x9D,
+    0x87, 0x6E, 0x56, 0xAA, 0x7B, 0x9D, 0x8E, 0x87, 0x8F, 0xA0, 0x8A, 0x6B, 0x59, 0x66, 0x7B, 0xC0,
+    0x7E, 0xA3, 0x86, 0x6D, 0xA2, 0x86, 0x7E, 0xA2, 0x77, 0x7E, 0xA1, 0x9A, 0x92, 0x7B, 0x93, 0x9B,
+    0x9D, 0x99, 0xA2, 0x88, 0xA3, 0x88, 0xAC, 0x88, 0x93, 0x99, 0x96, 0x88, 0x36, 0x52, 0x50, 0x1D,
+    0x66, 0x51, 0xA3, 0x96, 0xBA, 0x91, 0xAA, 0x82, 0xA2, 0x87, 0x2A, 0x6B, 0x6E, 0x7B, 0x69, 0x57,
+    0xA2, 0x99, 0x6F, 0xC1, 0x5A, 0xC0, 0x6B, 0xC1, 0x66, 0x69, 0x66, 0x21, 0x55, 0x56, 0xA0, 0x8A,
+    0x17, 0x9D, 0x7A, 0x9D, 0x89, 0x9A, 0x78, 0x56, 0x9D, 0x98, 0xA2, 0x88, 0xA4, 0x78, 0xA3, 0x98,
+    0x59, 0x51, 0x61, 0xA2, 0x88, 0xA3, 0x88, 0x9D, 0x98, 0x65, 0xA4, 0x88, 0xA2, 0x87, 0xA2, 0x87,
+    0xA4, 0x97, 0xA7, 0x99, 0xA2, 0x8A, 0xA4, 0x9A, 0x9F, 0x9B, 0x98, 0x76, 0x9D, 0x98, 0xA4, 0x89,
+    0xA6, 0x8A, 0xA3, 0x89, 0x9C, 0x95, 0x98, 0x86, 0x9A, 0x77, 0xA7, 0x98, 0xA7, 0x88, 0x9C, 0x99,
+    0x97, 0x89, 0xA7, 0x9A, 0xA6, 0x8A, 0x97, 0x8A, 0x97, 0x8B, 0x6F, 0x6B, 0xC1, 0x0E, 0x15, 0x0E,
+    0x56, 0x66, 0x69, 0xC0, 0x66, 0x65, 0xC0, 0x56, 0xC0, 0x7A, 0xC0, 0x7E, 0x6B, 0xC1, 0x6E, 0x7A,
+    0x6E, 0x6E, 0xA7, 0x78, 0x96, 0x56, 0x5A, 0x5A, 0x9A, 0x88, 0xA7, 0x89, 0xA2, 0x88, 0x9B, 0x89,
+    0xC0, 0xA2, 0x88, 0xA2, 0x88, 0x9D, 0x99, 0x32, 0x01, 0xC0, 0x9B, 0x98, 0xA8, 0x88, 0x7F, 0x1D,
+    0x52, 0x6E, 0xC1, 0x1D, 0x01, 0x51, 0x7A, 0xA2, 0x88, 0xA3, 0x89, 0x10, 0x50, 0x04, 0xA2, 0x87,
+    0x56, 0x11, 0x6B, 0xA2, 0x89, 0x24, 0xA5, 0x99, 0x51, 0x9B, 0x8A, 0x9C, 0x78, 0x66, 0xA4, 0x88,
+    0x6E, 0x16, 0x1B, 0x3E, 0xA4, 0x77, 0xA4, 0x88, 0x55, 0x97, 0x99, 0x1B, 0x8E, 0xA8, 0x98, 0x89,
+    0xAA, 0x88, 0xA2, 0x77, 0xA5, 0x89, 0xA8, 0x77, 0xA2, 0x98, 0x76, 0xA3, 0x88, 0xA4, 0x88, 0x51,
+    0x9B, 0x98, 0x7E, 0x51, 0x6E, 0xA2, 0x99, 0xA4, 0x78, 0x1A, 0xA8, 0x98, 0xAC, 0x98, 0x9A, 0xA8,
+    0x85, 0x97, 0x03, 0x94, 0x8A, 0x9A, 0x88, 0x6E, 0x1D, 0x56, 0xC0, 0x66, 0x59, 0x52, 0x66, 0xC1,
+    0x39, 0xC0, 0x7E, 0x6F, 0x7F, 0x6E, 0xA5, 0xB5, 0xC0, 0x6F, 0x7A, 0x6F, 0xC1, 0x29, 0xC0, 0x1D,
+    0xC1, 0x56, 0x66, 0x56, 0x66, 0x55, 0x6E, 0x34, 0x55, 0x66, 0x5A, 0xC2, 0x20, 0xC0, 0x50, 0x3F,
+    0xAA, 0x93, 0x9A, 0x86, 0xA3, 0x99, 0x9C, 0x88, 0x65, 0x9A, 0x77, 0xA4, 0x98, 0xA1, 0x8A, 0x47,
+    0xA1, 0x7A, 0x9B, 0x89, 0x98, 0x88, 0xA2, 0x99, 0xA2, 0x89, 0xA5, 0x9A, 0xA3, 0x97, 0x92, 0x96,
+    0x9C, 0xA8, 0xAA, 0x88, 0xA7, 0x88, 0xA3, 0x98, 0xA2, 0x88, 0x6E, 0x65, 0x65, 0x6E, 0x01, 0x65,
+    0xC2, 0x6E, 0xC0, 0x56, 0xC0, 0x6B, 0xC0, 0x01, 0x6B, 0x39, 0x66, 0x65, 0x5A, 0xC0, 0x28, 0x6E,
+    0xC0, 0x39, 0x7B, 0x65, 0x2D, 0x65, 0x6E, 0x69, 0x7D, 0x6E, 0x7E, 0x6E, 0x6B, 0x7F, 0x6F, 0x6F,
+    0x6E, 0xC0, 0xA2, 0x88, 0xA3, 0x8A, 0xA3, 0x8C, 0xA1, 0x8A, 0x9B, 0xA4, 0x14, 0x68, 0x9D, 0x87,
+    0x7E, 0x41, 0xA4, 0x78, 0xA6, 0x8E, 0xFF, 0x84, 0x2C, 0x9B, 0x9C, 0x1D, 0x5A, 0xC0, 0x66, 0x7A,
+    0xA2, 0x87, 0x2B, 0x7C, 0x6E, 0xA2, 0x86, 0x6E, 0x7E, 0xA2, 0x89, 0x9C, 0x8B, 0x8C, 0x7B, 0x9A,
+    0x98, 0x6B, 0x6E, 0xB1, 0x98, 0xA8, 0x88, 0x8F, 0x88, 0x96, 0x89, 0xA3, 0x98, 0x22, 0x1D, 0x66,
+    0x55, 0x61, 0xB1, 0x92, 0xB5, 0x92, 0xA3, 0x96, 0x56, 0x2A, 0xA2, 0x89, 0xC0, 0x66, 0xC0, 0x14,
+    0x67, 0x6E, 0x56, 0xC0, 0x6F, 0xC0, 0x67, 0x55, 0x7A, 0x6E, 0x12, 0x19, 0x52, 0x6B, 0x42, 0x43,
+    0x42, 0x41, 0x9C, 0x87, 0x9D, 0x89, 0x6E, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0x7E, 0x9D, 0x88, 0xA2,
+    0x88, 0xC0, 0x60, 0xA2, 0x88, 0xA2, 0x88, 0xA5, 0x98, 0x69, 0x65, 0xA7, 0x97, 0xA5, 0x99, 0x66,
+    0xA5, 0x8B, 0xA1, 0xAC, 0x9D, 0x88, 0xA5, 0x88, 0x9D, 0x9A, 0x7F, 0x6F, 0x38, 0xA0, 0x75, 0x65,
+    0x9A, 0x87, 0x97, 0x88, 0xA6, 0x98, 0xA8, 0x79, 0x8E, 0x98, 0x57, 0xB5, 0x89, 0x9A, 0x8A, 0x93,
+    0x8B, 0x6B, 0x6B, 0xC0, 0x0E, 0xC0, 0x66, 0xC0, 0x56, 0xC0, 0x69, 0x66, 0x69, 0x66, 0x66, 0x29,
+    0xC0, 0x7F, 0xC0, 0x3B, 0x6E, 0x7F, 0xC2, 0x6E, 0xA8, 0x67, 0x8F, 0x68, 0xA5, 0x77, 0x41, 0x9C,
+    0x88, 0xA5, 0x89, 0x66, 0x59, 0xA2, 0x89, 0x7E, 0x6B, 0x65, 0xC0, 0x06, 0x9B, 0x98, 0x56, 0x7F,
+    0x09, 0xC1, 0x15, 0x7E, 0x15, 0x66, 0xC0, 0x9D, 0x98, 0x5A, 0x10, 0xA3, 0x88, 0x66, 0x9D, 0x98,
+    0x5A, 0x0E, 0x15, 0x10, 0x7E, 0x15, 0x6B, 0xA5, 0xA9, 0xC0, 0x9B, 0x7A, 0x55, 0x9D, 0x99, 0xA2,
+    0x88, 0x2A, 0x56, 0x66, 0xA2, 0x88, 0xA5, 0x88, 0xA2, 0x87, 0x56, 0x2B, 0x66, 0x91, 0x98, 0x8C,
+    0xA9, 0xAA, 0x79, 0xAB, 0x88, 0x4E, 0xA2, 0x88, 0x1B, 0xA3, 0xA8, 0x5A, 0x3A, 0x69, 0x66, 0x69,
+    0x9D, 0x89, 0xA2, 0x88, 0x33, 0xA3, 0x99, 0xA3, 0x88, 0x91, 0x99, 0xAD, 0xA9, 0xAC, 0xA8, 0x98,
+    0x97, 0x98, 0x77, 0xA4, 0x89, 0x90, 0x8A, 0x7E, 0xC0, 0x15, 0x66, 0x56, 0x69, 0x56, 0x66, 0xC6,
+    0x39, 0xA9, 0xB5, 0x6B, 0x6E, 0x7F, 0xC0, 0x6E, 0x6B, 0x7A, 0x29, 0xC0, 0x66, 0xC0, 0x1D, 0x56,
+    0x66, 0xC0, 0x56, 0xC0, 0x55, 0x66, 0x5A, 0x65, 0x66, 0x5A, 0x65, 0x20, 0x69, 0x54, 0xB4, 0x83,
+    0xA2, 0x83, 0x9C, 0x97, 0xA4, 0x88, 0x56, 0x9C, 0x88, 0x9C, 0x87, 0xA5, 0x98, 0x9B, 0x79, 0x93,
+    0x7B, 0xA5, 0x7B, 0x5B, 0x95, 0x99, 0x53, 0xA7, 0x9B, 0xAB, 0x99, 0x68, 0x96, 0xA4, 0xA2, 0xC7,
+    0xA9, 0x89, 0xA3, 0x88, 0x0C, 0x7E, 0xC0, 0x69, 0x55, 0x7A, 0x0D, 0x01, 0x55, 0x65, 0x6E, 0x7F,
+    0xC0, 0x32, 0xC0, 0x66, 0x6B, 0x6E, 0x7B, 0xC2, 0x69, 0x39, 0x34, 0x39, 0x32, 0x3C, 0x03, 0xC0,
+    0x34, 0x2D, 0x26, 0xC0, 0x7D, 0x6E, 0xC0, 0x7E, 0xA1, 0x8A, 0x7E, 0x6F, 0x6E, 0x6F, 0xC0, 0xA2,
+    0x88, 0xA2, 0x89, 0xA4, 0x79, 0x9C, 0x87, 0x98, 0xA5, 0x7E, 0xA4, 0x89, 0x55, 0x9B, 0x86, 0x6E,
+    0xA2, 0x76, 0xA7, 0x8E, 0xFF, 0xA4, 0xCE, 0x95, 0x7D, 0x1D, 0xC0, 0x5A, 0xC0, 0x1D, 0x7E, 0xA2,
+    0x86, 0x7C, 0x6E, 0xA2, 0x86, 0x6E, 0x7E, 0x6B, 0xA3, 0x89, 0x93, 0x9D, 0x8D, 0x8A, 0xA3, 0x98,
+    0x41, 0xAA, 0x98, 0xAF, 0x89, 0xA5, 0x97, 0x8E, 0x89, 0x94, 0x89, 0x6E, 0xC0, 0x62, 0x5A, 0x9D,
+    0xA8, 0xA7, 0x95, 0xBC, 0x80, 0xA4, 0x94, 0x66, 0xA2, 0x88, 0x39, 0x6B, 0x34, 0x5A, 0x00, 0x6B,
+    0xC1, 0x6F, 0xC0, 0x5A, 0x7B, 0x56, 0xC0, 0x7A, 0x0D, 0x56, 0x57, 0x57, 0x24, 0x43, 0xC0, 0x5A,
+    0x9B, 0x88, 0x9B, 0x89, 0xA5, 0x88, 0xA2, 0x88, 0x65, 0x6E, 0x51, 0x7E, 0x6E, 0x9D, 0x99, 0xA3,
+    0x98, 0xA4, 0x88, 0xA2, 0x87, 0x7A, 0x55, 0xA2, 0x97, 0xA7, 0x98, 0xA8, 0x98, 0x9D, 0x99, 0xA3,
+    0x8B, 0xA5, 0x8C, 0x9A, 0x98, 0x9D, 0x88, 0x66, 0xA3, 0x88, 0x1C, 0x97, 0x87, 0x9B, 0x98, 0xA8,
+    0x87, 0xAB, 0x89, 0x50, 0x91, 0x97, 0xA5, 0x89, 0xAB, 0x9A, 0x89, 0x98, 0x97, 0x99, 0xBC, 0x78,
+    0x9D, 0x9B, 0x92, 0x7A, 0xA1, 0x8A, 0x6B, 0x0E, 0xC0, 0x66, 0xC0, 0x66, 0x5A, 0x65, 0x69, 0xC0,
+    0x35, 0x7A, 0xC2, 0xA2, 0x88, 0x7E, 0x7F, 0xC2, 0x66, 0xA2, 0x77, 0xA6, 0x77, 0x8F, 0x68, 0xA6,
+    0x57, 0x9C, 0x88, 0x6E, 0x6F, 0x9C, 0x88, 0x51, 0xA8, 0x88, 0x66, 0x6F, 0x51, 0x51, 0x9C, 0x88,
+    0xC0, 0xA2, 0x88, 0x0A, 0x19, 0x6E, 0x19, 0x01, 0x7F, 0xA2, 0x77, 0x19, 0xA3, 0x99, 0x2D, 0x61,
+    0x19, 0x01, 0xC0, 0x09, 0xC1, 0xA2, 0x88, 0x66, 0xC0, 0x3C, 0x7F, 0xA5, 0x89, 0xA3, 0x99, 0x9B,
+    0x89, 0x6F, 0x9C, 0x87, 0x66, 0x0F, 0x3E, 0x51, 0xA2, 0x89, 0xA2, 0x88, 0xA3, 0x88, 0x50, 0xA3,
+    0x99, 0xA3, 0x99, 0x9C, 0x87, 0x85, 0xAA, 0x9B, 0x99, 0xB1, 0x68, 0xA3, 0x89, 0xA2, 0x77, 0x55,
+    0xA1, 0xA8, 0xA4, 0x98, 0x55, 0x7E, 0x3F, 0xC0, 0x2B, 0x7E, 0x3F, 0x7F, 0xA5, 0x98, 0x97, 0x99,
+    0x99, 0x98, 0xB1, 0xB8, 0xAC, 0x98, 0x98, 0x88, 0x55, 0x8D, 0x8A, 0x9C, 0x88, 0x6B, 0x66, 0x55,
+    0xC0, 0x5A, 0x66, 0x66, 0xC6, 0x39, 0xA9, 0xB6, 0x6E, 0x7A, 0x6F, 0xC0, 0x6E, 0x7F, 0xC1, 0x56,
+    0xC2, 0x66, 0xC0, 0x6B, 0x5A, 0x69, 0xC0, 0x66, 0x5A, 0x69, 0x52, 0x61, 0x55, 0x56, 0x65, 0xA3,
+    0x86, 0xB5, 0x92, 0x9B, 0x95, 0x65, 0x9D, 0x98, 0xA5, 0x88, 0x9B, 0x89, 0x7F, 0x46, 0x95, 0x78,
+    0x98, 0x6B, 0xA2, 0x89, 0x5B, 0x9D, 0x9A, 0x9D, 0x7B, 0xAC, 0x9C, 0xA8, 0x97, 0x9C, 0x96, 0x97,
+    0xB5, 0xA7, 0xC6, 0xA6, 0x78, 0xA2, 0x88, 0xA3, 0x98, 0x6E, 0x7E, 0x6B, 0x0D, 0x65, 0xC1, 0x55,
+    0xC0, 0x69, 0x67, 0xC0, 0x32, 0x6B, 0xC1, 0x66, 0xC0, 0x00, 0xC0, 0x34, 0x7E, 0xC0, 0x32, 0xC1,
+    0x39, 0xC1, 0x3C, 0x01, 0x69, 0xC2, 0x6D, 0x7B, 0xC0, 0x6F, 0xA2, 0x87, 0x6E, 0x7E, 0xC0, 0x6B,
+    0xA3, 0x79, 0xA3, 0x97, 0x97, 0x97, 0x9D, 0x96, 0xA6, 0x99, 0xA2, 0x7B, 0x55, 0x9C, 0x76, 0x7D,
+    0xA3, 0x86, 0xA4, 0x7C, 0xFF, 0xAD, 0x2F, 0x92, 0x7C, 0x1D, 0x6B, 0xC0, 0x59, 0x1D, 0xA2, 0x87,
+    0x7C, 0x7D, 0x6D, 0x6E, 0xA2, 0x86, 0x3D, 0x6B, 0x6F, 0xA1, 0x9C, 0x8D, 0x8A, 0x92, 0x89, 0x7E,
+    0xA6, 0x88, 0xB4, 0x88, 0xA7, 0x98, 0x52, 0x29, 0x91, 0x89, 0x96, 0x87, 0x9C, 0x98, 0xC0, 0x55,
+    0xA5, 0x96, 0xB6, 0x81, 0xA7, 0xB5, 0xA2, 0x89, 0xA3, 0x88, 0x7E, 0x5A, 0xC1, 0x6B, 0xC0, 0x7F,
+    0xC0, 0x6E, 0x56, 0x6B, 0x0D, 0x6E, 0x0D, 0x56, 0xC0, 0x57, 0x5B, 0x9D, 0x8A, 0x42, 0x9F, 0x69,
+    0x9D, 0x99, 0x9D, 0x88, 0x51, 0x6E, 0xA4, 0x88, 0x26, 0x56, 0x6E, 0x79, 0xA3, 0x89, 0x9C, 0x87,
+    0x7B, 0xA4, 0x87, 0xA2, 0x88, 0x7E, 0x6E, 0x7A, 0x6D, 0xA6, 0x98, 0xA6, 0x98, 0xA2, 0x88, 0xA3,
+    0x9B, 0xA2, 0x8B, 0x96, 0x87, 0x9D, 0x98, 0x55, 0xA2, 0x88, 0x97, 0x98, 0x52, 0x03, 0xA8, 0x88,
+    0x03, 0xA6, 0x88, 0xA7, 0x88, 0x94, 0x88, 0x13, 0x00, 0x8E, 0x98, 0x90, 0x87, 0xBE, 0x88, 0x96,
+    0x8B, 0x97, 0x8C, 0xA1, 0x8A, 0x69, 0xC0, 0x62, 0xC0, 0x6E, 0xC2, 0x7A, 0x6E, 0x0C, 0x3D, 0x62,
+    0x69, 0xA2, 0x88, 0x7F, 0x6E, 0xC0, 0x0F, 0xC1, 0x7E, 0xA5, 0x68, 0x92, 0x57, 0xA3, 0x77, 0x9D,
+    0x88, 0xA4, 0x79, 0xC0, 0x9B, 0x99, 0x6E, 0x0D, 0x5A, 0xA3, 0x98, 0x0A, 0x61, 0x0D, 0x6F, 0x0A,
+    0xA2, 0x88, 0xC0, 0x6B, 0x7E, 0x7F, 0x2D, 0x9D, 0x99, 0x96, 0x88, 0x14, 0xA5, 0x88, 0x9D, 0x99,
+    0x1E, 0xC0, 0x14, 0xA4, 0x87, 0xA4, 0x88, 0x56, 0x7A, 0xC1, 0x3C, 0xC0, 0xA4, 0x89, 0xA3, 0x89,
+    0x6F, 0x9D, 0x99, 0x68, 0x56, 0x9D, 0x99, 0x52, 0xA4, 0x88, 0xA2, 0x78, 0x5A, 0xA4, 0xA8, 0xA3,
+    0x99, 0x55, 0x09, 0xA2, 0x88, 0x93, 0x98, 0x8D, 0xAA, 0xAA, 0x78, 0xA8, 0x58, 0xC0, 0x6B, 0x9D,
+    0x87, 0xA2, 0x97, 0xA5, 0x88, 0x7A, 0x7E, 0x7E, 0x2B, 0xC0, 0xA3, 0x89, 0xA3, 0x98, 0xA3, 0x99,
+    0x3F, 0x99, 0x99, 0xAB, 0xB8, 0xAB, 0xA9, 0xA4, 0x98, 0x9B, 0x87, 0x98, 0x89, 0x8B, 0x8A, 0x7E,
+    0x5A, 0x01, 0xC0, 0x56, 0xC0, 0x66, 0xC1, 0x5A, 0x65, 0xC0, 0x6B, 0xC1, 0xAC, 0xA4, 0xC0, 0x7A,
+    0x6E, 0x6B, 0x6E, 0x7F, 0xC3, 0x6B, 0x3D, 0x38, 0xC0, 0x6B, 0x04, 0xC0, 0x6E, 0x7F, 0x6E, 0x18,
+    0x09, 0x9D, 0x99, 0x41, 0x9D, 0x98, 0x9D, 0x89, 0xA6, 0x84, 0xB2, 0x92, 0x9A, 0x84, 0x65, 0x9A,
+    0x88, 0x6E, 0x7B, 0x5F, 0x93, 0x6A, 0x41, 0x6B, 0x42, 0x6B, 0xA1, 0x8A, 0x9B, 0x8E, 0xAF, 0x9C,
+    0xA5, 0x96, 0x99, 0xB5, 0x98, 0xB5, 0xAA, 0xA6, 0xA4, 0x89, 0xA2, 0x77, 0xA2, 0x88, 0xA2, 0x87,
+    0x7E, 0xC2, 0x66, 0x69, 0xC0, 0x65, 0xC0, 0x56, 0xC1, 0x6F, 0xC0, 0x7B, 0x39, 0x66, 0xC0, 0x39,
+    0x34, 0x39, 0x69, 0xC1, 0x2D, 0x32, 0x6E, 0x7A, 0xC5, 0x01, 0x3A, 0x6E, 0x07, 0x6E, 0x7D, 0x6F,
+    0x7E, 0xC0, 0x7E, 0x9A, 0x87, 0x9A, 0x97, 0xA4, 0x85, 0xA4, 0x8A, 0x21, 0x19, 0x50, 0xA2, 0x75,
+    0x6D, 0xA3, 0x9B, 0xFF, 0xBD, 0x8F, 0x8F, 0x7E, 0x1D, 0x6B, 0xC0, 0x59, 0x7E, 0x7D, 0x7D, 0x6D,
+    0x7D, 0x6E, 0x7D, 0xA2, 0x78, 0x7B, 0x6B, 0xA1, 0x8A, 0x67, 0x89, 0x8B, 0x97, 0x98, 0xA2, 0x88,
+    0xB6, 0x88, 0xA9, 0x99, 0x9C, 0x98, 0xAA, 0x77, 0xA9, 0x98, 0x96, 0x77, 0x94, 0x95, 0x9A, 0x88,
+    0x9A, 0x88, 0x79, 0xAD, 0x93, 0xA5, 0x97, 0xA3, 0x98, 0xA3, 0x89, 0xA2, 0x88, 0x66, 0xC0, 0x2C,
+    0x6F, 0xC0, 0x3F, 0xC2, 0x37, 0x6B, 0x6F, 0xC0, 0x52, 0x6B, 0x57, 0x5B, 0x41, 0x47, 0x9A, 0x78,
+    0x9B, 0x88, 0x6E, 0xA2, 0x88, 0xA4, 0x88, 0x7F, 0x50, 0x66, 0x37, 0x2B, 0x55, 0x9D, 0x99, 0x2B,
+    0xA3, 0x98, 0xC0, 0x79, 0x6F, 0x69, 0x7E, 0xA3, 0x98, 0x7A, 0xA9, 0x98, 0xA8, 0x8B, 0xA2, 0x8B,
+    0x9D, 0x97, 0x98, 0x87, 0x9D, 0x88, 0xA2, 0x88, 0x98, 0x88, 0x6F, 0x9D, 0x88, 0xA2, 0x88, 0xA7,
+    0xA9, 0x9D, 0x88, 0x08, 0xA8, 0x88, 0x94, 0x87, 0xA8, 0x87, 0xA3, 0x99, 0x92, 0x88, 0x96, 0x98,
+    0xB9, 0x89, 0x90, 0x8C, 0x09, 0x6F, 0x69, 0xC0, 0x7B, 0x6E, 0xC0, 0x7E, 0x66, 0x69, 0x56, 0xC0,
+    0x00, 0x56, 0x65, 0x38, 0x00, 0xC0, 0x66, 0x7F, 0x6E, 0x7A, 0x6F, 0xA6, 0x56, 0x96, 0x57, 0x40,
+    0x9B, 0x89, 0xA3, 0x88, 0x56, 0xA2, 0x88, 0x7F, 0x9C, 0x78, 0x9D, 0x99, 0x12, 0xC0, 0x0A, 0x7F,
+    0x65, 0x0A, 0x6B, 0x19, 0x6F, 0xA4, 0x88, 0x7A, 0x97, 0x89, 0x98, 0x98, 0xA2, 0x78, 0xA4, 0x88,
+    0xA9, 0x98, 0x10, 0x3C, 0x6E, 0x3C, 0x9C, 0x88, 0xA3, 0x88, 0xA5, 0x98, 0x56, 0xA2, 0x88, 0x62,
+    0x9B, 0x88, 0xA2, 0x89, 0x1F, 0xA2, 0x79, 0x7F, 0x37, 0x7E, 0x59, 0x3F, 0x37, 0x9D, 0x89, 0xA2,
+    0x88, 0xA2, 0x78, 0x9D, 0x99, 0xA6, 0xA9, 0xA6, 0x87, 0x9D, 0x88, 0x6B, 0x7E, 0x8B, 0x99, 0x9C,
+    0x89, 0xAB, 0x69, 0xA2, 0x78, 0x6B, 0x79, 0x9C, 0x87, 0x6E, 0xA6, 0x98, 0x7E, 0x65, 0xC0, 0x06,
+    0xA3, 0x88, 0x7F, 0x51, 0x98, 0x88, 0xA3, 0x88, 0xA5, 0xB9, 0xA6, 0xA8, 0xAB, 0x98, 0x9C, 0x97,
+    0xA2, 0x77, 0x8A, 0x8A, 0x95, 0x99, 0xA2, 0x78, 0x66, 0x56, 0xC0, 0x66, 0xC2, 0x55, 0x66, 0xC3,
+    0xAE, 0xA4, 0xC0, 0x6B, 0x16, 0x1D, 0x6E, 0x7E, 0x6F, 0xC2, 0x6B, 0xC0, 0x6F, 0x66, 0x09, 0x18,
+    0xA2, 0x88, 0xA2, 0x88, 0x6F, 0xC0, 0x69, 0x52, 0x51, 0x51, 0x9D, 0x88, 0x9B, 0x98, 0xAA, 0x72,
+    0xAD, 0xA3, 0x99, 0x97, 0x9C, 0x77, 0x55, 0xC0, 0xA2, 0x88, 0x95, 0x7A, 0x99, 0x7A, 0x6E, 0x6B,
+    0xC0, 0xA0, 0x6A, 0x9E, 0x7B, 0x9D, 0x9F, 0xAE, 0x89, 0xA4, 0xA5, 0x94, 0xB5, 0x9E, 0xB5, 0xAB,
+    0xA7, 0xA3, 0x89, 0x7F, 0x6E, 0xA2, 0x87, 0x7E, 0xC0, 0x6B, 0x6E, 0x08, 0x69, 0xC1, 0x66, 0x5A,
+    0x66, 0x39, 0xC0, 0x34, 0x00, 0xC0, 0x39, 0x34, 0xC3, 0x39, 0x69, 0x69, 0x6E, 0x7A, 0xC1, 0x66,
+    0xC0, 0x2B, 0xC0, 0x7B, 0x6E, 0xC0, 0x6E, 0x7D, 0x6E, 0x6D, 0x7B, 0xA2, 0x78, 0x7D, 0x9C, 0x97,
+    0x97, 0xA8, 0x6E, 0xA2, 0x86, 0xA4, 0x89, 0xA3, 0x7B, 0x6B, 0x66, 0x58, 0xA4, 0x76, 0xA1, 0x9A,
+    0xFF, 0xC5, 0xCE, 0x8E, 0x7F, 0xA1, 0x8B, 0xC1, 0x69, 0x6E, 0x7D, 0x7D, 0x6D, 0x7D, 0x6D, 0x7F,
+    0xA2, 0x77, 0x7B, 0x5B, 0xA0, 0x9A, 0xA1, 0x8A, 0x9D, 0x9A, 0x8C, 0x78, 0x94, 0x98, 0xAB, 0x89,
+    0x3D, 0x9C, 0x98, 0x6E, 0xB0, 0x86, 0xA4, 0x86, 0x99, 0x94, 0x9F, 0x96, 0x9D, 0x97, 0x9B, 0x99,
+    0x9E, 0x86, 0xC0, 0xA2, 0x89, 0xC0, 0x7F, 0x6E, 0xA2, 0x88, 0x7F, 0x6F, 0xC0, 0x2B, 0xC0, 0x6E,
+    0x52, 0xC0, 0x6B, 0x6B, 0x5B, 0x56, 0x6F, 0x53, 0x57, 0x59, 0x98, 0x79, 0x9A, 0x78, 0xC0, 0xA6,
+    0x77, 0xA3, 0x89, 0x66, 0xA2, 0x87, 0x66, 0xC1, 0x50, 0x9C, 0x88, 0xA3, 0x88, 0xA4, 0x99, 0x7E,
+    0xC0, 0x6E, 0x79, 0x65, 0xA2, 0x88, 0x65, 0xA2, 0x87, 0xA8, 0x98, 0xA9, 0x9C, 0xA5, 0x8C, 0x9D,
+    0x97, 0x98, 0x86, 0x9B, 0x88, 0x9C, 0x77, 0x99, 0x89, 0xA5, 0x88, 0x03, 0x99, 0x99, 0xAD, 0x99,
+    0xA6, 0x88, 0x98, 0x88, 0xA6, 0x97, 0x6E, 0x99, 0x97, 0xA6, 0x99, 0xA9, 0x88, 0x8F, 0x99, 0xA2,
+    0x88, 0xAC, 0x8B, 0x91, 0x9D, 0xA2, 0x79, 0x6E, 0x7A, 0xC1, 0x1D, 0x7A, 0x55, 0x05, 0x66, 0x3D,
+    0x66, 0x65, 0xC0, 0x38, 0x00, 0xC0, 0x7F, 0xC0, 0x6E, 0x7A, 0x6F, 0xA7, 0x67, 0x96, 0x47, 0x50,
+    0x9C, 0x78, 0x12, 0x7F, 0xA4, 0x88, 0x40, 0x52, 0x61, 0x6F, 0xA2, 0x88, 0x0D, 0xC0, 0x5A, 0xC2,
+    0xA2, 0x78, 0xA2, 0x89, 0x7A, 0x96, 0x99, 0x51, 0xA5, 0x88, 0xA2, 0x88, 0x7F, 0xA5, 0x88, 0x39,
+    0xA2, 0x88, 0x61, 0x9B, 0x88, 0x9D, 0x99, 0xA6, 0x88, 0x3C, 0xA3, 0x88, 0x51, 0x9D, 0x89, 0x08,
+    0x6F, 0x7A, 0xA2, 0x88, 0x6E, 0xC0, 0xA2, 0x88, 0xC1, 0x6B, 0x9C, 0x79, 0xA4, 0x88, 0x27, 0x7A,
+    0xAA, 0x99, 0x59, 0x61, 0xA4, 0x88, 0x98, 0x88, 0x8F, 0xAA, 0xA7, 0x79, 0xA3, 0x68, 0xA1, 0x8A,
+    0xA2, 0x87, 0x65, 0x9C, 0x98, 0xA2, 0x88, 0xA4, 0x87, 0xA2, 0x87, 0xC0, 0x0B, 0xA3, 0x89, 0x9A,
+    0x98, 0x9D, 0x88, 0x52, 0xA4, 0x98, 0xA8, 0x98, 0xA1, 0xA8, 0xA7, 0xA9, 0xA7, 0x98, 0x9C, 0x97,
+    0x99, 0x89, 0x89, 0x79, 0x66, 0x66, 0x5A, 0xC0, 0x65, 0x6B, 0xC1, 0x55, 0x66, 0xC3, 0xAE, 0x94,
+    0x7B, 0x6E, 0xC2, 0x6E, 0x7A, 0x6F, 0xC1, 0x6F, 0xC0, 0x6B, 0xC0, 0x7F, 0xA2, 0x88, 0xA3, 0x88,
+    0xA2, 0x88, 0x6F, 0xC0, 0x66, 0x66, 0x55, 0x61, 0x18, 0x9C, 0x77, 0xA9, 0x92, 0xAA, 0x83, 0x98,
+    0x86, 0x9C, 0x88, 0x6E, 0xC0, 0x9B, 0x89, 0x95, 0x79, 0x5F, 0xC0, 0x56, 0x6F, 0xA0, 0x6B, 0x99,
+    0x7E, 0xA4, 0x9D, 0xAC, 0x87, 0x9D, 0xC6, 0x94, 0xB5, 0xA6, 0xB5, 0xA9, 0x98, 0xA3, 0x99, 0x6E,
+    0x6E, 0x7E, 0x6E, 0x7A, 0x6B, 0xC0, 0x08, 0x69, 0x66, 0xC0, 0x5A, 0xC2, 0x66, 0x6B, 0xC1, 0x00,
+    0xC0, 0x34, 0x5A, 0x34, 0x3B, 0x34, 0x39, 0x54, 0x7A, 0x6D, 0x65, 0x7F, 0x6E, 0x6B, 0xC4, 0x7E,
+    0x6D, 0x6E, 0xC0, 0x7B, 0xA2, 0x78, 0x6D, 0x9C, 0x96, 0x97, 0xA8, 0x7E, 0xA3, 0x87, 0xA4, 0x79,
+    0xA2, 0x79, 0xA1, 0x9A, 0x6B, 0x9D, 0x87, 0xA4, 0x76, 0xA6, 0x8A, 0xFF, 0xCD, 0xEE, 0xFF, 0x73,
+    0x8D, 0xA0, 0x8A, 0x6E, 0xC0, 0x69, 0x6E, 0x7D, 0x79, 0xA2, 0x76, 0x7D, 0x6D, 0x7F, 0x6F, 0x6B,
+    0x6F, 0xA0, 0x8A, 0x67, 0xA2, 0x88, 0x56, 0x90, 0x88, 0x90, 0x88, 0xB5, 0xA8, 0xAC, 0x99, 0x9B,
+    0x88, 0xB0, 0x76, 0xA5, 0x95, 0x98, 0x93, 0x9F, 0x96, 0x60, 0x9C, 0x98, 0x54, 0x6B, 0x6F, 0x6B,
+    0x6B, 0x7E, 0xA2, 0x88, 0x6F, 0xC1, 0x5A, 0x7E, 0x1C, 0x6B, 0x6B, 0x56, 0x57, 0x6F, 0x6B, 0x57,
+    0x53, 0x9D, 0x89, 0x99, 0x88, 0x9C, 0x67, 0xC0, 0xA4, 0x88, 0xA4, 0x88, 0x5A, 0x56, 0x1E, 0x6E,
+    0x1E, 0x51, 0x6E, 0x7E, 0xA2, 0x88, 0xC0, 0xA2, 0x88, 0x65, 0xC0, 0x7E, 0xA2, 0x88, 0x9D, 0x98,
+    0xA4, 0x87, 0xA2, 0x98, 0x7E, 0xAA, 0x99, 0xA7, 0x8C, 0x65, 0x94, 0x77, 0x95, 0x87, 0x9E, 0x68,
+    0xC0, 0xA2, 0x88, 0xA3, 0x98, 0x18, 0x98, 0x98, 0xAB, 0x99, 0xA9, 0x98, 0x9B, 0x98, 0xA4, 0x89,
+    0x97, 0x98, 0xA6, 0x87, 0xA4, 0x88, 0xAB, 0x98, 0x8B, 0x98, 0xAF, 0x9B, 0x9D, 0x8C, 0x99, 0x9C,
+    0x6E, 0x65, 0xC0, 0x5A, 0x66, 0x51, 0x61, 0x66, 0x5A, 0xC2, 0x2C, 0x6F, 0xA2, 0x87, 0x7B, 0x6E,
+    0xC1, 0x76, 0xC0, 0xAC, 0x47, 0x91, 0x67, 0x5E, 0x9D, 0x88, 0x9D, 0x89, 0xA4, 0x88, 0xA2, 0x88,
+    0x9C, 0x88, 0x56, 0x61, 0x52, 0xA5, 0x88, 0x51, 0xC0, 0x55, 0x19, 0x0A, 0x19, 0xA3, 0x78, 0x7F,
+    0x7F, 0x96, 0x99, 0xC0, 0xA4, 0x88, 0xA2, 0x78, 0x69, 0x6F, 0xC0, 0x50, 0x66, 0xC0, 0x00, 0x5A,
+    0x6E, 0xC0, 0x7B, 0x25, 0xA2, 0x89, 0xA2, 0x88, 0xC0, 0x7E, 0xC1, 0xA3, 0x89, 0x65, 0x6E, 0xA3,
+    0x99, 0x98, 0x89, 0xA6, 0x89, 0x6F, 0x9B, 0x88, 0x12, 0xA6, 0x88, 0x51, 0x7A, 0xA2, 0x98, 0x8C,
+    0x89, 0xA1, 0x8A, 0xA6, 0x67, 0x6F, 0xA2, 0x88, 0xC0, 0x55, 0x55, 0x15, 0xA4, 0x77, 0xA4, 0x87,
+    0x65, 0x98, 0x88, 0x66, 0x7F, 0xA2, 0x88, 0x7A, 0xA8, 0x98, 0xA6, 0x98, 0x61, 0xA9, 0xB8, 0x65,
+    0xA2, 0x76, 0x85, 0x8A, 0x99, 0x8A, 0x6F, 0xC2, 0x66, 0xC0, 0x56, 0x69, 0x66, 0xC3, 0xAE, 0x95,
+    0x7A, 0x6F, 0x7E, 0xC0, 0x59, 0xC0, 0x7A, 0x31, 0x6E, 0x6F, 0xC0, 0x6F, 0x7A, 0x6F, 0x7F, 0xA4,
+    0x88, 0xA3, 0x88, 0xC0, 0x6F, 0xC1, 0x66, 0xC0, 0x51, 0x9D, 0x98, 0x0E, 0xA9, 0x92, 0xA4, 0x93,
+    0x99, 0x87, 0x40, 0x6F, 0x14, 0x94, 0x79, 0x40, 0x6F, 0x45, 0x67, 0x5F, 0x9B, 0x7F, 0x9C, 0x7D,
+    0xAB, 0x8B, 0xA7, 0xA6, 0x98, 0xB6, 0x99, 0xC6, 0xA9, 0xB6, 0xA6, 0x98, 0xA2, 0x89, 0x6E, 0x7E,
+    0x6D, 0x6E, 0x7A, 0x6B, 0x6E, 0x0F, 0x08, 0x66, 0x59, 0xC3, 0x66, 0xC0, 0x6B, 0xC3, 0x5A, 0xC0,
+    0x66, 0x69, 0xC0, 0x6D, 0x79, 0x1F, 0x69, 0xC0, 0x6E, 0x7F, 0x66, 0x2C, 0xC1, 0x69, 0x6E, 0x7A,
+    0x6E, 0x6F, 0x7F, 0x6F, 0x68, 0x9C, 0x97, 0x96, 0x98, 0xA2, 0x97, 0xA4, 0x77, 0xA5, 0x78, 0xA2,
+    0x8A, 0xA0, 0x8A, 0xC0, 0x9A, 0x77, 0xA2, 0x75, 0xA7, 0x9A, 0xFF, 0xC6, 0x0E, 0xFF, 0x73, 0x8D,
+    0xA1, 0x8A, 0xC1, 0x69, 0x6E, 0x7D, 0x69, 0x7D, 0xA2, 0x87, 0x69, 0xA2, 0x88, 0x6F, 0x6B, 0x6B,
+    0x6B, 0x6B, 0x6F, 0x6F, 0x7E, 0x97, 0x89, 0x91, 0xA8, 0xAE, 0x98, 0x31, 0xB0, 0x77, 0xA0, 0x83,
+    0x9B, 0xA4, 0x9F, 0x96, 0x9D, 0x97, 0x51, 0x54, 0x62, 0x57, 0x6F, 0xA2, 0x98, 0x6B, 0x6E, 0xC1,
+    0x6B, 0x6E, 0x6B, 0xC0, 0x6F, 0x57, 0x9D, 0x9A, 0xA2, 0x79, 0x56, 0x6F, 0x53, 0x9C, 0x78, 0x98,
+    0x88, 0x9A, 0x78, 0xA6, 0x77, 0xA3, 0x89, 0x7F, 0xA2, 0x88, 0x5A, 0x69, 0xC0, 0x19, 0x59, 0xC0,
+    0x7E, 0xC0, 0xA3, 0x89, 0x65, 0xC1, 0x79, 0xA2, 0x88, 0x6B, 0x27, 0xA5, 0x87, 0xA2, 0x98, 0x9D,
+    0x99, 0xA8, 0x97, 0xAB, 0xAA, 0x9A, 0x79, 0x91, 0x88, 0x9C, 0x78, 0x9D, 0x78, 0x6F, 0xA5, 0x98,
+    0xA2, 0x88, 0x3B, 0x9B, 0x98, 0x6F, 0xA3, 0x98, 0xA6, 0x98, 0xA4, 0x88, 0x9D, 0x99, 0x96, 0x97,
+    0xA9, 0x98, 0xA6, 0x88, 0xA8, 0x88, 0x34, 0xAB, 0x8B, 0x93, 0x9D, 0x6E, 0x11, 0x55, 0x66, 0x55,
+    0x66, 0x65, 0xC2, 0x6B, 0xC0, 0x7E, 0x6F, 0xA2, 0x88, 0xC3, 0x76, 0x59, 0xAD, 0x68, 0x8B, 0x57,
+    0xA7, 0x88, 0x9D, 0x89, 0x9D, 0x88, 0xA6, 0x88, 0x66, 0x9C, 0x88, 0x5A, 0x66, 0x51, 0x19, 0x28,
+    0x19, 0x55, 0x19, 0xC0, 0x1E, 0xA2, 0x88, 0xA2, 0x78, 0x66, 0x97, 0xA9, 0xA2, 0x89, 0xA3, 0x88,
+    0x6F, 0xC0, 0xA2, 0x87, 0x6B, 0x50, 0x20, 0x19, 0x05, 0x19, 0x5A, 0x66, 0x20, 0x2C, 0x7E, 0xA2,
+    0x88, 0x6F, 0x69, 0x7F, 0x6E, 0x7F, 0x56, 0xA2, 0x87, 0xA3, 0x99, 0x9B, 0x99, 0x53, 0xA8, 0x78,
+    0x9A, 0x87, 0x66, 0xA8, 0x89, 0x65, 0x65, 0xA4, 0x98, 0x91, 0x89, 0x98, 0x89, 0xAA, 0x79, 0xA2,
+    0x68, 0xA2, 0x87, 0xC0, 0x65, 0x56, 0xC1, 0x65, 0x69, 0x65, 0xA2, 0x78, 0x7B, 0x25, 0xA2, 0x88,
+    0x29, 0x14, 0xA1, 0xA9, 0x9F, 0xB8, 0xA8, 0x98, 0xA3, 0x87, 0x8F, 0x78, 0x8D, 0x9B, 0xA2, 0x78,
+    0x66, 0xC0, 0x39, 0xC0, 0x34, 0x55, 0xC1, 0x66, 0xC2, 0x1D, 0xC0, 0x6F, 0xC0, 0x31, 0xC4, 0x02,
+    0x6E, 0x7B, 0x6E, 0x6B, 0xA2, 0x99, 0xA4, 0x77, 0xA3, 0x99, 0x6E, 0xC0, 0x6B, 0x6E, 0x08, 0x66,
+    0x59, 0x19, 0x9E, 0x86, 0xA7, 0x81, 0xA0, 0x94, 0x9B, 0x88, 0x9D, 0x99, 0x6E, 0x99, 0x88, 0x98,
+    0x79, 0xA3, 0x88, 0x56, 0x45, 0x56, 0xA0, 0x6B, 0x9A, 0x6F, 0x9E, 0x7C, 0xAF, 0xA9, 0x74, 0x99,
+    0xC6, 0x9C, 0xB5, 0xA9, 0xB7, 0xA5, 0x99, 0xA2, 0x89, 0xA2, 0x88, 0x69, 0x6D, 0xC0, 0x69, 0x7F,
+    0x6E, 0x0F, 0xC0, 0x65, 0x59, 0xC0, 0x66, 0x69, 0x34, 0xC3, 0x6B, 0x56, 0xC3, 0x3B, 0xC0, 0x59,
+    0x69, 0x79, 0x69, 0xC1, 0x6D, 0x76, 0x6E, 0x6E, 0xC0, 0x69, 0x7B, 0x6E, 0x6E, 0x7F, 0x6E, 0xC0,
+    0x59, 0x9C, 0x97, 0x95, 0xAA, 0xA5, 0x97, 0xA5, 0x88, 0xA4, 0x78, 0xA2, 0x79, 0xA2, 0x8A, 0x9C,
+    0x89, 0x98, 0x75, 0xA5, 0x75, 0xA4, 0x9A, 0xFF, 0xC6, 0x0D, 0xFF, 0x73, 0x8C, 0xA1, 0x8A, 0x6B,
+    0xC0, 0x1D, 0x6E, 0x79, 0x6E, 0x7D, 0x6D, 0x7E, 0x6E, 0x7F, 0x6F, 0x6B, 0x6B, 0x6B, 0x6B, 0x6F,
+    0xC0, 0xA2, 0x88, 0x32, 0x99, 0x98, 0xA4, 0x87, 0xB2, 0x87, 0xA4, 0x85, 0x9A, 0x94, 0x9E, 0x94,
+    0x9E, 0x86, 0x61, 0x9D, 0x88, 0x52, 0x67, 0x6B, 0xA2, 0x88, 0x7F, 0x6E, 0xC0, 0x6F, 0x6B, 0xC2,
+    0x57, 0x9D, 0x8A, 0xA2, 0x8A, 0x5B, 0x9D, 0x89, 0x5A, 0x98, 0x88, 0x9C, 0x78, 0x41, 0xA5, 0x88,
+    0xA3, 0x89, 0xA2, 0x87, 0x6B, 0x65, 0x2A, 0x1E, 0x16, 0x69, 0xC0, 0x1E, 0x23, 0x0F, 0xA2, 0x98,
+    0xA2, 0x88, 0x26, 0x69, 0xA2, 0x88, 0x7F, 0x1F, 0x7F, 0xA4, 0x77, 0x9D, 0x98, 0x61, 0xA8, 0xA7,
+    0xB2, 0x88, 0x90, 0x88, 0x97, 0x89, 0xA1, 0x9B, 0x99, 0x68, 0x9C, 0x78, 0xA3, 0x98, 0xA5, 0x98,
+    0xA2, 0x88, 0xA2, 0x88, 0x6E, 0x50, 0x66, 0xAA, 0x98, 0xA6, 0x98, 0x90, 0x98, 0x9D, 0x88, 0xAA,
+    0x98, 0xAF, 0x8A, 0x61, 0x9C, 0x89, 0x98, 0x8C, 0x9A, 0x79, 0xC0, 0x66, 0xC2, 0x66, 0xC0, 0x29,
+    0x7A, 0x29, 0xC0, 0x6B, 0xC0, 0x7E, 0x6B, 0x38, 0xC1, 0x7A, 0x38, 0xAA, 0x66, 0x8D, 0x58, 0xA7,
+    0x79, 0x65, 0x51, 0xA4, 0x77, 0x9D, 0x99, 0x9D, 0x89, 0x7A, 0x21, 0x56, 0x0D, 0x19, 0x7F, 0x59,
+    0xC1, 0x7F, 0xA2, 0x78, 0xA2, 0x88, 0x9A, 0x99, 0x9D, 0x98, 0x6B, 0xA2, 0x77, 0xA2, 0x89, 0xC0,
+    0xA2, 0x87, 0x6F, 0x9B, 0x99, 0xA3, 0x98, 0x55, 0x19, 0xC1, 0x25, 0x20, 0x34, 0x6F, 0xC0, 0x05,
+    0x7E, 0x6F, 0x1C, 0xC1, 0xA4, 0x88, 0xA2, 0x88, 0x66, 0x95, 0x9A, 0xAD, 0x88, 0x9C, 0x88, 0x9C,
+    0x88, 0xA6, 0x89, 0xA4, 0x88, 0x51, 0x09, 0x9D, 0xA9, 0x8D, 0x89, 0xAC, 0x78, 0x5E, 0x5A, 0xA2,
+    0x99, 0x55, 0x66, 0xC1, 0x50, 0x6E, 0xA2, 0x98, 0x6B, 0xC0, 0x7E, 0x6E, 0xA5, 0xA9, 0x33, 0xA7,
+    0xA8, 0x99, 0xA9, 0xA3, 0xA7, 0xA6, 0x87, 0x94, 0x79, 0x8F, 0x89, 0x6F, 0x66, 0x2D, 0x34, 0xC1,
+    0x55, 0xC1, 0x66, 0xC2, 0xAD, 0xA6, 0xC0, 0x24, 0x29, 0x6E, 0xC0, 0x7A, 0xC0, 0x29, 0x6D, 0xA1,
+    0x9A, 0x6E, 0x7F, 0x6E, 0x7F, 0xA3, 0x89, 0xA3, 0x99, 0xA2, 0x78, 0x7E, 0x6B, 0x6E, 0x7F, 0xC0,
+    0x65, 0x08, 0x9E, 0x86, 0x54, 0xA4, 0x81, 0x9C, 0x94, 0x69, 0x41, 0x9B, 0x89, 0x95, 0x98, 0xA2,
+    0x78, 0xA2, 0x79, 0x6F, 0x9C, 0x7A, 0x43, 0x9E, 0x7B, 0x9B, 0x6E, 0xA2, 0x7A, 0xB0, 0xA7, 0x97,
+    0xA6, 0x9D, 0xB7, 0x9E, 0xC5, 0xA9, 0xB7, 0xA5, 0x8A, 0xA2, 0x88, 0x7F, 0xC0, 0x69, 0x6D, 0x69,
+    0x6F, 0x7A, 0xC2, 0x69, 0x00, 0x65, 0xC2, 0x69, 0x5A, 0x66, 0x6B, 0x7B, 0xC0, 0x5A, 0xC2, 0x2C,
+    0xC0, 0x25, 0x69, 0xC0, 0x69, 0x7E, 0x69, 0xC0, 0x69, 0x7A, 0x6E, 0x6E, 0x7A, 0x6E, 0x6F, 0x7E,
+    0x6B, 0x5A, 0x69, 0x9C, 0x98, 0x95, 0xA9, 0xA6, 0x86, 0xA6, 0x77, 0xA2, 0x79, 0x01, 0xA2, 0x89,
+    0x9D, 0x89, 0x96, 0x65, 0xA9, 0x75, 0xA6, 0x99, 0xFF, 0xC6, 0x0D, 0xFF, 0x73, 0x8C, 0x1D, 0x6B,
+    0xC0, 0x1D, 0x6E, 0x79, 0x6E, 0x69, 0x7D, 0xA2, 0x78, 0x7A, 0x6F, 0x7F, 0x6F, 0x6B, 0x6B, 0xC0,
+    0x6F, 0xC1, 0x7E, 0xC0, 0x9D, 0x88, 0xAB, 0x98, 0xAB, 0x97, 0x9B, 0x95, 0x9C, 0x84, 0x9D, 0xA6,
+    0x50, 0x51, 0xC0, 0x57, 0x62, 0x6B, 0xA2, 0x88, 0xC0, 0xA2, 0x78, 0x7B, 0x5A, 0x51, 0x6B, 0x51,
+    0x9D, 0x8A, 0x56, 0xA3, 0x8A, 0x31, 0x0B, 0x9B, 0x89, 0x9D, 0x88, 0xA6, 0x88, 0xA6, 0x79, 0x6E,
+    0x51, 0x55, 0x25, 0x6E, 0x69, 0x51, 0x66, 0xC0, 0xA2, 0x88, 0xA3, 0x88, 0x65, 0x9C, 0x88, 0x6E,
+    0xA2, 0x88, 0x23, 0x2B, 0xC0, 0x7E, 0x51, 0x56, 0xC0, 0x69, 0xA1, 0xA8, 0xAC, 0x98, 0xAE, 0x98,
+    0x8F, 0x87, 0x9D, 0x9A, 0xA0, 0x8A, 0x9B, 0x78, 0x17, 0x65, 0x9D, 0x88, 0xA3, 0x98, 0xA8, 0x78,
+    0x65, 0x9D, 0x99, 0x50, 0xA3, 0xA9, 0xA8, 0x88, 0x66, 0x93, 0x98, 0xA9, 0xA8, 0xB3, 0x89, 0xA3,
+    0x8B, 0x9A, 0xA8, 0x91, 0x8B, 0x9A, 0x8B, 0x6E, 0x6E, 0xC1, 0x29, 0xC1, 0x6B, 0xC0, 0x6E, 0x30,
+    0x66, 0x30, 0xC3, 0x7A, 0xC0, 0x69, 0xA8, 0x67, 0x91, 0x58, 0xA6, 0x68, 0x0E, 0x51, 0x0E, 0x98,
+    0x88, 0x9A, 0x88, 0x3E, 0x6F, 0x7F, 0x65, 0x56, 0x19, 0xA2, 0x88, 0xC0, 0x6E, 0xA2, 0x88, 0x56,
+    0x66, 0x9B, 0x99, 0x7A, 0xC0, 0xA2, 0x78, 0x6F, 0x39, 0x6F, 0x7E, 0x96, 0x88, 0x0C, 0x39, 0x61,
+    0x5A, 0x19, 0x25, 0xC0, 0x39, 0x6B, 0x39, 0xC0, 0x0D, 0x6E, 0x0D, 0x7F, 0xC0, 0xA2, 0x88, 0xA4,
+    0x88, 0xA2, 0x88, 0x95, 0x9A, 0xA8, 0x88, 0x7E, 0x9C, 0x78, 0x6B, 0xA6, 0x89, 0x7E, 0x9D, 0x98,
+    0xA5, 0x99, 0x8A, 0x98, 0x99, 0x89, 0xB4, 0x58, 0x56, 0x6B, 0xA2, 0x87, 0x9D, 0x99, 0x3A, 0x7F,
+    0x3A, 0x69, 0x7B, 0x09, 0xA2, 0x87, 0x7A, 0x6E, 0xA2, 0x99, 0xA2, 0xA8, 0x7A, 0xA4, 0x97, 0x92,
+    0x97, 0xAF, 0x99, 0x8F, 0x88, 0x95, 0x89, 0x7F, 0x56, 0xC2, 0x56, 0x65, 0xC5, 0xAD, 0xA6, 0xC1,
+    0x24, 0x6E, 0xC1, 0x69, 0xC0, 0x29, 0xA2, 0x77, 0xA2, 0x88, 0x6B, 0x7E, 0xA2, 0x89, 0xA3, 0x99,
+    0xA2, 0x88, 0xA2, 0x78, 0xA2, 0x87, 0x6B, 0x7E, 0x6B, 0x15, 0x0D, 0x08, 0x54, 0xA0, 0x84, 0xA3,
+    0x91, 0x9B, 0x86, 0x7B, 0x9D, 0x88, 0x94, 0x78, 0x9D, 0x98, 0xA4, 0x77, 0xA2, 0x79, 0x9E, 0x6C,
+    0x96, 0x7C, 0xA1, 0x8A, 0x9E, 0x7B, 0x9B, 0x8D, 0xA6, 0x78, 0xAD, 0xA7, 0x97, 0xA6, 0x9F, 0xB6,
+    0xA3, 0xD5, 0xA7, 0x98, 0xA3, 0x9A, 0xA2, 0x88, 0xA2, 0x88, 0xC0, 0x69, 0x69, 0xC1, 0x7A, 0x6E,
+    0x6B, 0xC0, 0x0F, 0x07, 0x65, 0x65, 0x5A, 0xC0, 0x69, 0xC2, 0x66, 0xC2, 0x6B, 0x20, 0x56, 0x20,
+    0x25, 0x7E, 0x69, 0x66, 0x69, 0x69, 0x6D, 0xC0, 0x7A, 0x6D, 0xC0, 0x6E, 0x7F, 0xC0, 0x6F, 0x7F,
+    0x56, 0x6D, 0x9B, 0xA9, 0x95, 0xA9, 0xA6, 0x85, 0xA6, 0x77, 0xA2, 0x7A, 0xA3, 0x8B, 0x57, 0x55,
+    0x97, 0x66, 0xA7, 0x95, 0xA9, 0x88, 0xFF, 0xBD, 0xEC, 0xFF, 0x73, 0xAC, 0xA0, 0x8B, 0xC2, 0x7D,
+    0xC0, 0x69, 0x6E, 0x79, 0xA2, 0x87, 0x6F, 0x6E, 0xA1, 0x9A, 0x6F, 0xC0, 0x6B, 0x6F, 0xC4, 0x66,
+    0xA3, 0x97, 0xAD, 0x87, 0x9F, 0x96, 0x9A, 0x84, 0x9E, 0x96, 0x65, 0x55, 0x7A, 0x52, 0x52, 0x56,
+    0xA2, 0x88, 0x6B, 0xA2, 0x88, 0x56, 0x51, 0x46, 0x6B, 0x56, 0x56, 0x56, 0x66, 0x9A, 0x79, 0xC0,
+    0xA3, 0x78, 0xA3, 0x99, 0xA3, 0x98, 0x6F, 0x55, 0x9D, 0x98, 0x56, 0xA2, 0x88, 0x50, 0x5A, 0x7E,
+    0x6B, 0xC0, 0xA2, 0x87, 0xC1, 0x0F, 0x50, 0x0A, 0xA3, 0x98, 0x6E, 0x51, 0xC1, 0x65, 0x56, 0x10,
+    0x7E, 0xA9, 0xA9, 0xA2, 0x97, 0x95, 0x88, 0xA8, 0x79, 0x67, 0x9D, 0x99, 0x44, 0x9D, 0x79, 0x9A,
+    0x88, 0x55, 0x79, 0xA3, 0x89, 0xA3, 0x98, 0xA4, 0x98, 0x9D, 0x98, 0x66, 0xA7, 0x99, 0xA2, 0x87,
+    0x99, 0x98, 0xB4, 0x99, 0xA7, 0x8C, 0x9D, 0xA9, 0x8B, 0x9A, 0x9C, 0x7A, 0x29, 0xC2, 0x6B, 0xC5,
+    0x66, 0xC1, 0x69, 0x29, 0xC1, 0x7B, 0x6E, 0xA7, 0x77, 0x90, 0x58, 0xA5, 0x68, 0xA6, 0x87, 0x9C,
+    0x88, 0xA3, 0x99, 0x92, 0x78, 0x7E, 0xA3, 0x89, 0x9B, 0x99, 0xA8, 0x88, 0xC0, 0x51, 0xC0, 0x19,
+    0xC0, 0x2D, 0x5A, 0x66, 0x62, 0x5A, 0x1B, 0x6E, 0xC0, 0xA2, 0x88, 0x6F, 0xA3, 0x88, 0x9D, 0x98,
+    0x99, 0x88, 0x66, 0x2D, 0x39, 0x2D, 0x2A, 0x25, 0xC0, 0x6F, 0x00, 0x6E, 0x39, 0xC0, 0x6E, 0xA2,
+    0x88, 0x7E, 0x12, 0x7A, 0xA2, 0x88, 0xA3, 0x89, 0x62, 0x6B, 0xA4, 0x88, 0x9D, 0x89, 0x52, 0xA3,
+    0x98, 0xA4, 0x88, 0x9D, 0x98, 0xA4, 0x78, 0x99, 0xA8, 0xFF, 0x00, 0xA3, 0xB2, 0x69, 0xB0, 0x68,
+    0xA2, 0x78, 0xA2, 0x88, 0x9D, 0x99, 0x55, 0x7E, 0x09, 0x02, 0xC0, 0x7F, 0xA3, 0x88, 0x76, 0xA3,
+    0x88, 0x61, 0xA6, 0x98, 0x76, 0xA6, 0x97, 0x90, 0x97, 0x66, 0xA2, 0x88, 0x90, 0x78, 0x6F, 0x2D,
+    0xC1, 0x6B, 0x56, 0x69, 0x66, 0xC4, 0xAD, 0xA6, 0xC2, 0x6E, 0x7A, 0x6E, 0xC0, 0x1A, 0xC0, 0xA2,
+    0x88, 0xA2, 0x88, 0xC0, 0x6F, 0xA3, 0x99, 0xA2, 0x88, 0xA2, 0x88, 0xA3, 0x88, 0x7F, 0x6F, 0x7E,
+    0x6F, 0x15, 0x0D, 0x62, 0x54, 0xA1, 0x83, 0xA2, 0x80, 0x9C, 0x86, 0xA1, 0x9A, 0x93, 0x99, 0x9A,
+    0x77, 0xA4, 0x77, 0x5E, 0xA2, 0x8A, 0x98, 0x6F, 0x95, 0x7E, 0xA4, 0x69, 0xA0, 0x8A, 0x9B, 0x8A,
+    0xA8, 0x97, 0xA7, 0xA8, 0x9B, 0xB6, 0x9E, 0xB4, 0xA8, 0xB5, 0xA5, 0x99, 0xA3, 0x89, 0x7F, 0xA2,
+    0x89, 0x69, 0xC0, 0x69, 0x69, 0x66, 0x07, 0xC0, 0x7B, 0xC0, 0x6E, 0x0E, 0x02, 0xC0, 0x55, 0x69,
+    0x69, 0xC0, 0x6E, 0x25, 0x66, 0x69, 0xC1, 0x20, 0x55, 0xC0, 0x19, 0xC0, 0x6E, 0x7A, 0x59, 0x69,
+    0x7A, 0x69, 0x69, 0x6E, 0x7E, 0x6E, 0xC0, 0x6F, 0x7B, 0xC0, 0x7F, 0x5E, 0x65, 0x9C, 0x98, 0x96,
+    0x98, 0xA4, 0x86, 0xA6, 0x76, 0xA4, 0x7A, 0xA3, 0x9C, 0x56, 0x9B, 0x78, 0x98, 0x66, 0xAA, 0x85,
+    0xA8, 0x98, 0xFF, 0xBD, 0xCC, 0xFF, 0x73, 0x8C, 0xA1, 0x8B, 0xC0, 0x6E, 0x7A, 0x69, 0xC0, 0x69,
+    0xC0, 0x7E, 0xA2, 0x87, 0x6F, 0x6F, 0x7E, 0x6F, 0x6B, 0xC0, 0x6F, 0xC0, 0x7A, 0xC1, 0x32, 0x66,
+    0x35, 0xAF, 0x87, 0x9F, 0x95, 0x98, 0x86, 0x64, 0x7E, 0xC0, 0x55, 0x9D, 0x99, 0x56, 0x6B, 0xC0,
+    0x52, 0xC0, 0x5A, 0x52, 0x5E, 0x6B, 0x6F, 0x51, 0x9D, 0x89, 0x41, 0x7A, 0x14, 0xA4, 0x78, 0x7A,
+    0x56, 0x51, 0x69, 0x51, 0x6F, 0x19, 0x3D, 0xA2, 0x77, 0x7E, 0xC0, 0x6F, 0x7A, 0x0F, 0xC0, 0x51,
+    0x69, 0xA3, 0x89, 0xA2, 0x88, 0x65, 0x9D, 0x99, 0x6E, 0xC1, 0x65, 0x08, 0x1C, 0x9C, 0x98, 0x75,
+    0xA3, 0x87, 0xA3, 0x89, 0xA1, 0x9A, 0x7F, 0xA2, 0x78, 0x40, 0x9B, 0x88, 0x56, 0x01, 0x65, 0xA3,
+    0x99, 0xA5, 0x98, 0x9B, 0x99, 0x00, 0xA5, 0x99, 0xA4, 0x87, 0x97, 0x98, 0xAA, 0x99, 0xB2, 0x89,
+    0xA2, 0x8C, 0x92, 0x99, 0x91, 0x9A, 0xA2, 0x79, 0x6B, 0xC1, 0x7E, 0xC0, 0x28, 0x21, 0xC0, 0x28,
+    0x21, 0xC3, 0x7E, 0xC2, 0xA2, 0x88, 0xA8, 0x77, 0x8E, 0x58, 0xA2, 0x67, 0xAD, 0x88, 0x94, 0x88,
+    0x99, 0x89, 0x65, 0x12, 0x9A, 0x89, 0x9C, 0x88, 0xA7, 0x98, 0xA6, 0x78, 0x9D, 0x99, 0xC0, 0x55,
+    0x6B, 0x19, 0x11, 0x6F, 0x7B, 0xC0, 0x69, 0x27, 0x6E, 0x7E, 0xA2, 0x78, 0x66, 0x20, 0x9D, 0x88,
+    0xC0, 0x19, 0x6F, 0x6E, 0xA2, 0x88, 0x66, 0x5A, 0x00, 0xA2, 0x87, 0xC0, 0x25, 0x11, 0xA2, 0x87,
+    0x3E, 0xC3, 0x0D, 0xA4, 0x99, 0x6F, 0xA3, 0x99, 0x51, 0x52, 0xA2, 0x88, 0xA3, 0x98, 0x65, 0xA2,
+    0x78, 0x9A, 0x88, 0xFF, 0x11, 0x05, 0x99, 0xA9, 0xB6, 0x48, 0xA9, 0x69, 0xA5, 0x88, 0xA5, 0x99,
+    0x55, 0x66, 0xC0, 0x69, 0x7F, 0x6E, 0xA2, 0x88, 0x7F, 0xC0, 0x21, 0xA5, 0xB9, 0xA5, 0x99, 0xA3,
+    0x97, 0x98, 0x98, 0x8A, 0x87, 0x7B, 0x5A, 0x56, 0x66, 0x69, 0xC0, 0x34, 0x5A, 0x65, 0xC0, 0x66,
+    0xC3, 0xAC, 0x96, 0x7E, 0xC2, 0x6E, 0xC0, 0x1F, 0xC1, 0x7E, 0xA1, 0x8A, 0x7E, 0x6F, 0xA2, 0x88,
+    0xA2, 0x88, 0xA2, 0x88, 0xA3, 0x99, 0x7F, 0x6E, 0x6F, 0x7E, 0xC0, 0x0D, 0x3C, 0x2D, 0xA2, 0x82,
+    0x9F, 0x91, 0x9E, 0x76, 0x9A, 0x89, 0x93, 0x89, 0xA4, 0x87, 0xA4, 0x78, 0x56, 0xA1, 0x7B, 0x94,
+    0x6F, 0x99, 0x6F, 0xA2, 0x7A, 0x7E, 0x9C, 0x88, 0xAC, 0x96, 0xA1, 0xB8, 0x9D, 0xA6, 0x9D, 0xD5,
+    0xAB, 0xA6, 0xA4, 0x89, 0xA2, 0x89, 0xA2, 0x87, 0x7B, 0xC0, 0x6E, 0xC0, 0x69, 0x65, 0xC2, 0x6B,
+    0x0E, 0x15, 0x0E, 0xC0, 0x09, 0x55, 0x68, 0x66, 0x69, 0xC1, 0x69, 0x56, 0x69, 0x11, 0x7A, 0xC0,
+    0x0A, 0x66, 0x7E, 0x6E, 0x69, 0xC0, 0x6D, 0x7A, 0x6E, 0x69, 0x7E, 0xC1, 0x6F, 0x6B, 0x7F, 0x6E,
+    0x6E, 0x65, 0x9D, 0xA8, 0x96, 0x99, 0xA2, 0x86, 0xA5, 0x76, 0xA7, 0x8A, 0xA4, 0x7B, 0x9D, 0x9A,
+    0x97, 0x78, 0x99, 0x67, 0xAD, 0x95, 0xAA, 0x98, 0xFF, 0xB5, 0xAC, 0xFF, 0x6B, 0x8C, 0xA1, 0x9A,
+    0x24, 0x6E, 0x7A, 0x69, 0xC1, 0x69, 0x7E, 0xA2, 0x88, 0x6F, 0x6E, 0x7F, 0x6F, 0xC1, 0x6B, 0x6E,
+    0xC0, 0x7A, 0xC1, 0x32, 0x35, 0xAA, 0x87, 0xA2, 0x86, 0x99, 0x96, 0x54, 0xC1, 0x55, 0x9B, 0x99,
+    0x7F, 0xA2, 0x79, 0xC0, 0x55, 0xC0, 0x6B, 0x55, 0x5B, 0x9D, 0x99, 0x9D, 0x89, 0x55, 0x5A, 0xA2,
+    0x88, 0x7E, 0x66, 0xC0, 0x19, 0x11, 0x66, 0x11, 0xA2, 0x88, 0x7E, 0x25, 0x50, 0x41, 0xC0, 0xA3,
+    0x98, 0x56, 0x69, 0x66, 0x51, 0xC0, 0xA4, 0x87, 0x1C, 0x0F, 0x7E, 0x51, 0xC0, 0x08, 0x55, 0x03,
+    0xC0, 0x08, 0x9B, 0x99, 0x7D, 0xA4, 0x89, 0x9D, 0x88, 0xA6, 0x99, 0xA6, 0x98, 0x41, 0x9C, 0x77,
+    0x6E, 0x9D, 0x89, 0x65, 0x7E, 0xA3, 0x99, 0xA3, 0x98, 0x66, 0x97, 0x98, 0xA5, 0x99, 0xAB, 0x87,
+    0x93, 0x99, 0x7D, 0xB3, 0x9A, 0xAA, 0x8A, 0x9D, 0x9B, 0x8B, 0x9B, 0x9C, 0x8A, 0x6E, 0xC4, 0x1C,
+    0x21, 0xC5, 0x7E, 0xC0, 0x69, 0x7E, 0xA3, 0x88, 0xA8, 0x68, 0x8D, 0x6A, 0xA2, 0x78, 0xAD, 0x78,
+    0x8E, 0x87, 0x99, 0x99, 0xA9, 0x88, 0x7F, 0x9C, 0x88, 0x66, 0xA3, 0x88, 0xA3, 0x99, 0xA2, 0x87,
+    0x6F, 0x55, 0x56, 0x05, 0x6F, 0xA4, 0x88, 0x66, 0x56, 0xC0, 0x7A, 0x2C, 0xA2, 0x88, 0xA2, 0x88,
+    0x34, 0x11, 0x66, 0xC0, 0x11, 0x2D, 0x11, 0xC0, 0x6F, 0x6E, 0x1D, 0x22, 0xC0, 0x16, 0x51, 0x6E,
+    0x1E, 0x6F, 0xC0, 0x7E, 0x6F, 0xA2, 0x88, 0xA2, 0x99, 0xA2, 0x89, 0xA2, 0x79, 0x7A, 0x9B, 0x99,
+    0xA3, 0x88, 0xA5, 0x99, 0x69, 0x51, 0x9D, 0x99, 0x84, 0xA9, 0x94, 0xA8, 0xB0, 0x68, 0xAB, 0x68,
+    0x5F, 0xA6, 0x88, 0xA5, 0x89, 0xC1, 0x7E, 0x9D, 0x89, 0x7E, 0x16, 0x66, 0x9D, 0x88, 0xA3, 0xA8,
+    0xA5, 0xA9, 0xAB, 0xA8, 0x9D, 0xA8, 0xC0, 0x85, 0x98, 0x9D, 0x99, 0x6F, 0x5A, 0x66, 0xC0, 0x39,
+    0x34, 0x5A, 0x65, 0xC1, 0x66, 0xC2, 0x06, 0xC0, 0x6B, 0x7E, 0x6E, 0xC1, 0x1F, 0x7A, 0x6E, 0x6B,
+    0xA2, 0x78, 0x7A, 0x6F, 0x7F, 0xA2, 0x87, 0xA2, 0x78, 0xA2, 0x99, 0x6F, 0xA2, 0x87, 0x7F, 0x6E,
+    0xC0, 0x01, 0x51, 0x64, 0xA3, 0x82, 0x9D, 0xA3, 0x59, 0x98, 0x78, 0x96, 0x78, 0xA4, 0x88, 0xA3,
+    0x88, 0x5F, 0x9D, 0x7E, 0x93, 0x6F, 0x9E, 0x6D, 0x6F, 0x75, 0x50, 0xB1, 0xA8, 0x9A, 0x97, 0x9C,
+    0xC7, 0xA1, 0xC3, 0xAA, 0x97, 0xA3, 0x8A, 0xA2, 0x88, 0xA2, 0x87, 0x6B, 0x10, 0x6F, 0x69, 0xC0,
+    0x69, 0x65, 0xC0, 0x66, 0x6B, 0x6E, 0x10, 0x15, 0xC1, 0x09, 0x3D, 0x55, 0x55, 0xC0, 0x69, 0x69,
+    0x66, 0xC1, 0x11, 0x7A, 0x59, 0x66, 0x7A, 0x69, 0x5A, 0x6D, 0x7A, 0x6E, 0xC0, 0x6D, 0x7F, 0xC0,
+    0x6E, 0x7F, 0x6B, 0x7E, 0x7E, 0x5A, 0x55, 0x9D, 0xA8, 0x96, 0x98, 0xA2, 0x97, 0xA7, 0x76, 0xA6,
+    0x78, 0xA3, 0x8C, 0x9D, 0x8A, 0x97, 0x77, 0x9A, 0x78, 0xAA, 0x85, 0xAC, 0x98, 0xFF, 0xBD, 0xCD,
+    0xFF, 0x73, 0x8C, 0xA1, 0x8A, 0x6B, 0x6E, 0x7A, 0xC0, 0x69, 0xC1, 0x7E, 0xA2, 0x88, 0x6E, 0x7F,
+    0x6E, 0x6F, 0xC0, 0x6B, 0xC0, 0x6E, 0xC3, 0x7A, 0x32, 0xA3, 0x98, 0xA7, 0x97, 0x68, 0x9C, 0x76,
+    0x9C, 0x88, 0x51, 0x51, 0x66, 0xA2, 0x78, 0x6B, 0x65, 0x56, 0x66, 0x33, 0x55, 0x9D, 0x89, 0x56,
+    0x6F, 0x6E, 0x51, 0x00, 0x6E, 0xA2, 0x89, 0x0C, 0xC0, 0xA3, 0x98, 0x6F, 0x69, 0xC0, 0x56, 0x05,
+    0x51, 0xA2, 0x77, 0x56, 0xC0, 0x3B, 0x5A, 0x65, 0x66, 0x2C, 0xA3, 0x98, 0x6F, 0xC0, 0x51, 0x65,
+    0x00, 0x34, 0x00, 0x7A, 0x00, 0xC0, 0x1B, 0x61, 0xAA, 0x88, 0xA2, 0x79, 0x50, 0x2E, 0x9B, 0x99,
+    0x9C, 0x77, 0xA5, 0x88, 0xA4, 0x78, 0xC0, 0x79, 0xA2, 0x88, 0x7F, 0x7E, 0x99, 0x99, 0x69, 0xAB,
+    0x98, 0x9B, 0x99, 0x92, 0x87, 0xB2, 0x88, 0xB3, 0xA8, 0xA1, 0x8B, 0x91, 0x9D, 0x92, 0x9B, 0xA2,
+    0x78, 0xC3, 0x66, 0xC0, 0x21, 0xC0, 0x1C, 0xC2, 0x21, 0x7E, 0x22, 0x6E, 0xA3, 0x97, 0xA2, 0x86,
+    0xA6, 0x7A, 0x90, 0x5B, 0xA2, 0x59, 0xA7, 0x97, 0x90, 0x88, 0x7E, 0xA3, 0x88, 0x51, 0x2C, 0x31,
+    0x2C, 0x51, 0x51, 0xA2, 0x77, 0x05, 0xC0, 0x9D, 0x89, 0xA3, 0x88, 0xA5, 0x99, 0xC0, 0x66, 0xC0,
+    0x39, 0x34, 0xA2, 0x88, 0x99, 0x89, 0x24, 0x34, 0xC0, 0x50, 0x05, 0xA3, 0x89, 0xA4, 0x88, 0x56,
+    0x9C, 0x88, 0x66, 0x59, 0xC0, 0x7E, 0x0E, 0x69, 0xC0, 0xA2, 0x98, 0x6F, 0xC0, 0x7E, 0x6F, 0xA2,
+    0x88, 0xA2, 0x99, 0xA3, 0x8A, 0x9B, 0x89, 0xA4, 0x98, 0xC0, 0x66, 0xA4, 0x88, 0xA2, 0x87, 0x51,
+    0xA3, 0x89, 0x8B, 0xBA, 0x89, 0xA8, 0xA2, 0x87, 0xB0, 0x68, 0xAD, 0x68, 0xA2, 0x89, 0x5E, 0x7F,
+    0xC0, 0xA2, 0x88, 0xC0, 0x9C, 0x89, 0xC0, 0x7A, 0x59, 0xA3, 0xA9, 0xA4, 0x98, 0xAC, 0xB8, 0x64,
+    0xA2, 0x98, 0x89, 0x99, 0x9A, 0x88, 0x5A, 0x52, 0x55, 0x65, 0x6B, 0xC0, 0x56, 0x69, 0xC0, 0x2C,
+    0x25, 0x66, 0xC1, 0xAC, 0x95, 0xC2, 0x7E, 0x1A, 0x7E, 0x6E, 0xC1, 0x6F, 0x7F, 0x66, 0x02, 0x7F,
+    0xA2, 0x78, 0x7E, 0x7F, 0xA2, 0x78, 0x7F, 0x7E, 0x6F, 0xC1, 0x21, 0xA0, 0x85, 0xA3, 0x81, 0x9E,
+    0x94, 0x41, 0x9A, 0x79, 0x98, 0x87, 0xA3, 0x78, 0x7F, 0x42, 0x9B, 0x6F, 0xFF, 0x1A, 0x89, 0xA2,
+    0x5B, 0x7A, 0x9C, 0x88, 0xA5, 0x97, 0xAE, 0xA7, 0x96, 0xA8, 0x9E, 0xB5, 0xA5, 0xC4, 0xA8, 0x88,
+    0xA3, 0x99, 0x6F, 0x7E, 0xC0, 0x6F, 0x7A, 0x6F, 0xC0, 0x69, 0x65, 0x55, 0xC0, 0x01, 0xC1, 0x6B,
+    0x7A, 0x10, 0xC1, 0x01, 0x3A, 0x66, 0x69, 0x65, 0x59, 0x7A, 0x18, 0x69, 0xC0, 0x69, 0xC0, 0x7A,
+    0x66, 0x55, 0x69, 0x6E, 0x6E, 0x6E, 0x7A, 0x6E, 0x7F, 0x6E, 0x7F, 0x6F, 0x7A, 0x7E, 0x54, 0x5A,
+    0x9B, 0xA8, 0x96, 0x99, 0xA4, 0x87, 0xA8, 0x74, 0xA4, 0x78, 0xA3, 0x8D, 0x9D, 0x9A, 0x98, 0x66,
+    0x9D, 0x67, 0xA6, 0x96, 0xAB, 0x99, 0xFF, 0xC6, 0x0E, 0xFF, 0x73, 0xAC, 0xA0, 0x8A, 0x6B, 0xC0,
+    0x7E, 0x65, 0xC0, 0x6E, 0xC0, 0x7E, 0x7F, 0xA2, 0x78, 0x7A, 0x6F, 0x6E, 0x6F, 0xC3, 0x6E, 0xC1,
+    0x7A, 0x6B, 0x2D, 0xA9, 0x96, 0xAD, 0x87, 0x8E, 0x87, 0x9C, 0x77, 0x52, 0xC1, 0x55, 0xC0, 0x9D,
+    0x89, 0x7F, 0xC0, 0x08, 0xC0, 0x5A, 0xA2, 0x88, 0xC0, 0x56, 0xC1, 0xA2, 0x88, 0xA2, 0x98, 0x56,
+    0x7F, 0x6E, 0x03, 0x08, 0x25, 0x11, 0x66, 0x55, 0x5D, 0x65, 0x38, 0x7E, 0x38, 0x00, 0x66, 0xA2,
+    0x88, 0x6E, 0x0F, 0xC0, 0x3B, 0xC0, 0x00, 0xC1, 0x7E, 0x00, 0x9D, 0x99, 0x51, 0x9A, 0x97, 0xB2,
+    0x88, 0xA3, 0x8A, 0x2B, 0x9B, 0x99, 0x69, 0x5A, 0x55, 0x34, 0xA2, 0x87, 0x7F, 0xA2, 0x87, 0x51,
+    0x7F, 0x61, 0xA4, 0x87, 0xA4, 0x98, 0x7E, 0x97, 0x88, 0x69, 0xB2, 0x97, 0xAA, 0x89, 0x9C, 0x9D,
+    0x8B, 0x8D, 0x1C, 0x21, 0xC3, 0x1C, 0xC5, 0x21, 0x7A, 0xA2, 0x76, 0xA2, 0x87, 0xA3, 0x87, 0x7D,
+    0xA5, 0x8B, 0x95, 0x5C, 0x9F, 0x69, 0xA4, 0x87, 0x93, 0x98, 0xA2, 0x87, 0x6B, 0x55, 0x65, 0x7F,
+    0xC0, 0x9C, 0x88, 0x51, 0x6E, 0xA3, 0x88, 0x31, 0x05, 0x3D, 0x6E, 0x0C, 0x56, 0x38, 0xA3, 0x99,
+    0x51, 0x9B, 0x99, 0x98, 0x78, 0x7F, 0xA9, 0x88, 0xA8, 0x88, 0x69, 0x9D, 0x98, 0x05, 0xA3, 0x89,
+    0xA4, 0x88, 0x41, 0x62, 0x25, 0xC0, 0x5A, 0x69, 0xC0, 0x66, 0xA2, 0x88, 0x7E, 0xC0, 0x6F, 0x0D,
+    0xA2, 0x88, 0x3C, 0x56, 0x99, 0x8A, 0xA3, 0x99, 0xA7, 0xA8, 0xA2, 0x88, 0x55, 0xA4, 0x98, 0x6F,
+    0x35, 0x97, 0xA9, 0x92, 0x98, 0x8D, 0xA8, 0xC0, 0xAC, 0x57, 0xB6, 0x69, 0xA3, 0x79, 0x51, 0xC0,
+    0x3F, 0xA3, 0x98, 0x9D, 0x99, 0x9D, 0x89, 0x7E, 0xC0, 0xA2, 0x98, 0xA2, 0x98, 0xAC, 0xA8, 0xA4,
+    0xA7, 0x64, 0x91, 0x9A, 0x99, 0x88, 0xC0, 0x9D, 0x89, 0x9C, 0x88, 0x9D, 0x88, 0x66, 0x6B, 0x66,
+    0x5A, 0xC0, 0x6E, 0x65, 0x66, 0xC1, 0xAA, 0x95, 0x7E, 0x6E, 0x6F, 0x7A, 0x6E, 0x7F, 0xC1, 0x27,
+    0x7F, 0xC0, 0x6F, 0xC0, 0x7B, 0xA2, 0x77, 0x7F, 0x69, 0xC0, 0x6F, 0xC0, 0x7F, 0x6E, 0x6F, 0x79,
+    0xA2, 0x73, 0xA4, 0x92, 0x99, 0x96, 0x46, 0x51, 0x99, 0x79, 0xA2, 0x87, 0x5A, 0x9D, 0x8B, 0x98,
+    0x6F, 0x98, 0x5F, 0xA4, 0x7A, 0x65, 0x9B, 0x98, 0xAA, 0x98, 0xA7, 0xA7, 0x97, 0xA6, 0x9F, 0xD6,
+    0xA9, 0xB6, 0xA6, 0x88, 0xA2, 0x89, 0x6E, 0x7E, 0xC0, 0x6E, 0x7B, 0xC0, 0x6F, 0xC0, 0x69, 0x06,
+    0x01, 0xC2, 0x66, 0xC1, 0x01, 0xC2, 0x7A, 0x59, 0x65, 0xC0, 0x69, 0xC1, 0x55, 0xC0, 0x7E, 0x69,
+    0xC0, 0x56, 0x65, 0x69, 0x6E, 0x6E, 0x7E, 0x6F, 0x7E, 0xC0, 0x7F, 0x6F, 0x6E, 0x79, 0x55, 0x65,
+    0x9A, 0x99, 0x94, 0x99, 0xA7, 0x96, 0xA8, 0x74, 0xA4, 0x78, 0xA3, 0x8C, 0x43, 0x98, 0x76, 0x9F,
+    0x66, 0xA5, 0x97, 0xAA, 0x99, 0xFF, 0xC6, 0x4E, 0xFF, 0x73, 0xAC, 0xA0, 0x8A, 0xC0, 0x6B, 0x7E,
+    0x65, 0xC1, 0x7E, 0x6F, 0xA2, 0x88, 0x6E, 0x7F, 0xC0, 0x6F, 0x6E, 0xC1, 0x6E, 0xC1, 0x7A, 0xC0,
+    0x6F, 0xC0, 0x2D, 0xAD, 0x95, 0xAA, 0x87, 0x8F, 0x77, 0x9C, 0x78, 0x9D, 0x89, 0x66, 0x35, 0x51,
+    0x66, 0x55, 0x67, 0x1C, 0x21, 0x5A, 0x7B, 0x6F, 0x55, 0xC0, 0xA2, 0x88, 0x34, 0xA2, 0x88, 0x66,
+    0xA2, 0x88, 0xA2, 0x88, 0x50, 0x39, 0x65, 0x41, 0x66, 0x55, 0x7E, 0x5A, 0x69, 0x6F, 0xC0, 0x00,
+    0x6E, 0x00, 0xC0, 0xA2, 0x88, 0x9D, 0x89, 0x00, 0x65, 0x5A, 0xC0, 0x00, 0xC1, 0x34, 0x9D, 0x89,
+    0x9C, 0x98, 0x99, 0x99, 0xB6, 0x88, 0xA2, 0x88, 0x9A, 0x88, 0x55, 0xC0, 0x55, 0x55, 0x6E, 0x7F,
+    0x9B, 0x98, 0xA2, 0x78, 0x0D, 0x7E, 0xA2, 0x87, 0xA1, 0xA9, 0xA4, 0x97, 0x7A, 0x6E, 0x9D, 0x97,
+    0x7E, 0xA9, 0x98, 0xAC, 0x8B, 0xFF, 0xAD, 0x32, 0x99, 0x8B, 0x7E, 0xC1, 0x6E, 0xC0, 0x56, 0x14,
+    0xC1, 0x7A, 0xC0, 0x1C, 0x6B, 0x7D, 0xA2, 0x76, 0xA3, 0x96, 0xA2, 0x77, 0x7D, 0xA4, 0x8A, 0x99,
+    0x4E, 0x9B, 0x59, 0xA2, 0x87, 0x99, 0x97, 0x7E, 0x66, 0x65, 0xC0, 0x11, 0x61, 0x9C, 0x78, 0x7E,
+    0x7F, 0x5A, 0xC1, 0x7F, 0x9D, 0x89, 0x95, 0x99, 0x7F, 0x66, 0x7E, 0xA5, 0x89, 0xA2, 0x88, 0x39,
+    0x56, 0x55, 0x0D, 0xA8, 0x77, 0xA3, 0x97, 0x9D, 0x89, 0x55, 0xA5, 0x88, 0xA3, 0x89, 0x65, 0x62,
+    0x5A, 0xC0, 0x59, 0xC0, 0x65, 0x2A, 0x3E, 0x6B, 0x7F, 0x7F, 0xA2, 0x78, 0x6B, 0x9B, 0x99, 0x42,
+    0xA3, 0x99, 0xA2, 0x87, 0xA6, 0x97, 0xA2, 0x89, 0xA3, 0x98, 0xC0, 0x99, 0x88, 0x9C, 0x99, 0x7F,
+    0x8B, 0x88, 0x98, 0x98, 0x55, 0xA4, 0x78, 0xB3, 0x89, 0xA9, 0x78, 0x51, 0xC0, 0xA2, 0x89, 0xA2,
+    0x88, 0x9D, 0x98, 0xC0, 0x7A, 0x7F, 0xA3, 0x88, 0xA6, 0xA8, 0xAB, 0xB7, 0x9D, 0x98, 0x94, 0x98,
+    0x96, 0x97, 0x5F, 0x66, 0x9D, 0x89, 0x9B, 0x88, 0x9D, 0x99, 0x56, 0x66, 0xC0, 0x6F, 0x5A, 0x65,
+    0x66, 0xC1, 0xA8, 0x94, 0x7F, 0xA2, 0x78, 0x7E, 0xA2, 0x88, 0x7A, 0x6E, 0x6B, 0x6E, 0x7A, 0x6F,
+    0xC1, 0x6F, 0x7A, 0x6E, 0x6F, 0x69, 0x0A, 0x02, 0x36, 0x02, 0x6E, 0x0A, 0x6D, 0xA7, 0x84, 0xA2,
+    0x92, 0x96, 0x86, 0xA4, 0x79, 0x41, 0x99, 0x88, 0xA2, 0x78, 0xC0, 0x9E, 0x6B, 0xFF, 0x33, 0x07,
+    0x9B, 0x6F, 0xA4, 0x78, 0x51, 0x9D, 0x98, 0xAD, 0xA8, 0xA1, 0xA7, 0x95, 0xC7, 0xA4, 0xB4, 0xAC,
+    0x96, 0xA3, 0xAA, 0x6F, 0x6E, 0x7E, 0xC0, 0x6E, 0x6B, 0xC0, 0x6B, 0x7A, 0x6E, 0x0D, 0x66, 0x01,
+    0xC0, 0x39, 0xC2, 0x7A, 0xC3, 0x69, 0x66, 0x35, 0xC0, 0x69, 0xC0, 0x69, 0x6E, 0x6B, 0x27, 0xC1,
+    0x69, 0xC0, 0x69, 0x6E, 0xC0, 0x7F, 0x6E, 0xC0, 0x6E, 0x7F, 0xC0, 0x69, 0x69, 0x61, 0x99, 0x99,
+    0x94, 0x99, 0xA8, 0x84, 0xA9, 0x85, 0xA5, 0x88, 0xA2, 0x7C, 0x9C, 0x79, 0x9C, 0x66, 0x9C, 0x77,
+    0xA5, 0x96, 0xAB, 0x9A, 0xFF, 0xCE, 0x6F, 0xFF, 0x73, 0xAC, 0xA0, 0x8A, 0xC1, 0x7A, 0x66, 0xC0,
+    0x20, 0x7E, 0x6F, 0x7F, 0xA2, 0x77, 0x6F, 0xC0, 0x21, 0x6F, 0xC1, 0x6F, 0x69, 0x7A, 0x6F, 0xC2,
+    0x35, 0xB1, 0x84, 0xA6, 0x87, 0x90, 0x78, 0x9B, 0x78, 0x51, 0x6F, 0x66, 0x41, 0x66, 0x65, 0x52,
+    0x21, 0x5A, 0xC0, 0x2D, 0x6F, 0x2D, 0xC0, 0xA2, 0x88, 0x6B, 0xA2, 0x88, 0x66, 0x69, 0x5A, 0x39,
+    0x51, 0x9D, 0x98, 0x41, 0xA2, 0x88, 0x7E, 0x55, 0xA2, 0x88, 0x6E, 0x55, 0x66, 0x3B, 0x00, 0x6F,
+    0x00, 0xC0, 0x51, 0xC0, 0x00, 0x65, 0xC0, 0x5A, 0x00, 0x31, 0x2C, 0x9D, 0x88, 0x9A, 0x98, 0x9B,
+    0x99, 0xB2, 0x88, 0xA4, 0x88, 0x9A, 0x98, 0x9D, 0x88, 0xA3, 0x88, 0xA2, 0x78, 0x55, 0xC0, 0x65,
+    0x9B, 0x99, 0x51, 0xA6, 0x78, 0xA3, 0x98, 0x65, 0xA2, 0x98, 0xA6, 0x98, 0xA1, 0xA8, 0xA2, 0x77,
+    0xA7, 0x98, 0x61, 0x9C, 0x97, 0xB0, 0x8A, 0x96, 0x8D, 0x8F, 0x8D, 0x7F, 0xC1, 0x5A, 0xC1, 0x66,
+    0xC1, 0x7A, 0xC0, 0x1C, 0x17, 0x6D, 0xA3, 0x87, 0xA3, 0x96, 0x6D, 0x68, 0xA6, 0x7A, 0x9D, 0x5F,
+    0x97, 0x48, 0x9D, 0x98, 0xA2, 0x88, 0x75, 0x50, 0x66, 0xC0, 0x7E, 0x9C, 0x88, 0x51, 0x6F, 0x31,
+    0xC1, 0x52, 0xA4, 0x88, 0x99, 0x9A, 0x98, 0x88, 0x7F, 0x7A, 0xC0, 0xA8, 0x78, 0xA2, 0x89, 0x9D,
+    0x88, 0xC0, 0x55, 0x9D, 0x99, 0xA2, 0x88, 0xAC, 0x86, 0x54, 0x41, 0x7F, 0xA2, 0x88, 0xA3, 0x99,
+    0x6F, 0x55, 0x56, 0x55, 0xC0, 0x69, 0x7F, 0x05, 0x6B, 0xA2, 0x88, 0xA2, 0x99, 0xC0, 0x9B, 0x89,
+    0x52, 0xA2, 0x79, 0xA4, 0x88, 0x6E, 0x65, 0xA5, 0x99, 0xA6, 0x98, 0x9A, 0x87, 0x9A, 0x88, 0xA2,
+    0x88, 0xA2, 0x98, 0x9D, 0x88, 0x8D, 0x89, 0x9D, 0x98, 0x9D, 0x98, 0x51, 0xB1, 0x79, 0xAD, 0x89,
+    0x41, 0x7A, 0xA3, 0x89, 0x16, 0xC0, 0x7F, 0x7A, 0x7F, 0x65, 0xB2, 0xA6, 0xA1, 0xA7, 0x92, 0x98,
+    0x94, 0x98, 0xA2, 0x88, 0x5A, 0x15, 0x9D, 0x78, 0x9C, 0x99, 0x51, 0x56, 0x56, 0x6B, 0x56, 0x65,
+    0xC2, 0xA7, 0xA4, 0x6E, 0xA2, 0x88, 0xA2, 0x88, 0x13, 0x7E, 0xC0, 0x6F, 0xC0, 0x7E, 0x6B, 0xC2,
+    0x6F, 0x7E, 0xC0, 0x55, 0xC1, 0x2F, 0x27, 0x55, 0x13, 0xA2, 0x86, 0xAA, 0x92, 0xA2, 0x84, 0x97,
+    0x87, 0xA4, 0x88, 0x9C, 0x79, 0x9B, 0x78, 0xA2, 0x78, 0xC0, 0x9D, 0x6D, 0xFF, 0x22, 0xC8, 0x9F,
+    0x6D, 0xA2, 0x88, 0x9D, 0x98, 0xC0, 0xAF, 0xA7, 0x99, 0xB8, 0x97, 0xB6, 0xA7, 0xD6, 0xAC, 0x87,
+    0xA3, 0x99, 0x6E, 0x7A, 0x39, 0xC0, 0x7F, 0xC3, 0x6F, 0x69, 0x08, 0x69, 0xC1, 0x39, 0xC0, 0x34,
+    0xC1, 0x69, 0xC0, 0x7A, 0x6B, 0x2D, 0x30, 0xC1, 0x6D, 0xC0, 0x6E, 0x2E, 0xC2, 0x69, 0x6E, 0xC2,
+    0x7E, 0x69, 0x6F, 0xC0, 0x7E, 0x6E, 0xC0, 0x65, 0x65, 0x95, 0x9A, 0x96, 0x88, 0xAA, 0x93, 0xA8,
+    0x85, 0xA6, 0x77, 0xA0, 0x7B, 0x42, 0x9C, 0x66, 0x9D, 0x78, 0xA2, 0xA7, 0xAB, 0x99, 0xFF, 0xC6,
+    0x2E, 0xFF, 0x73, 0xAC, 0xA0, 0x8A, 0xC2, 0x66, 0xC0, 0x7E, 0xA2, 0x88, 0xC0, 0xA2, 0x78, 0x7E,
+    0x6F, 0xC0, 0x7E, 0x6F, 0xC1, 0x6E, 0x7B, 0xC0, 0x6E, 0xC2, 0xA3, 0x97, 0xB3, 0x83, 0x9A, 0x88,
+    0x95, 0x89, 0x9D, 0x79, 0x51, 0x59, 0x52, 0x52, 0x69, 0x66, 0x66, 0x2D, 0xC0, 0x5A, 0x2D, 0x2A,
+    0x2D, 0xC0, 0x6F, 0x7E, 0x6F, 0x39, 0x51, 0x51, 0x65, 0x55, 0x6E, 0xC2, 0x6E, 0xC1, 0x51, 0x3B,
+    0x00, 0xC0, 0x6E, 0x6B, 0x2C, 0xC0, 0x6E, 0xC0, 0x7E, 0x00, 0x31, 0x65, 0x56, 0x61, 0x9D, 0x89,
+    0x65, 0x97, 0x99, 0xAB, 0x99, 0xB1, 0xA9, 0x40, 0x9B, 0x88, 0x9B, 0x89, 0xA3, 0x87, 0x5A, 0x9C,
+    0x88, 0x25, 0xC1, 0x6E, 0x39, 0xA2, 0x87, 0xA2, 0x98, 0xA2, 0x98, 0xA1, 0xA8, 0xA2, 0x87, 0xAA,
+    0x87, 0x61, 0x97, 0x98, 0xB2, 0x89, 0xA1, 0x9C, 0x8A, 0x8D, 0x9D, 0x8B, 0x7E, 0xC0, 0x19, 0xC1,
+    0x14, 0xC2, 0x7A, 0x1C, 0x15, 0x7E, 0xA3, 0x86, 0x6C, 0x6D, 0x61, 0xA9, 0x7B, 0x9F, 0x5F, 0x93,
+    0x59, 0x9D, 0x87, 0xA7, 0x98, 0x9C, 0x87, 0x61, 0x69, 0x7B, 0x69, 0x9B, 0x89, 0x7A, 0x6F, 0x6E,
+    0xC0, 0x38, 0xC0, 0x7F, 0x98, 0x88, 0x9D, 0x99, 0x7F, 0x6F, 0x61, 0xA9, 0x79, 0xC0, 0x9C, 0x88,
+    0x6E, 0x19, 0xC0, 0x9D, 0x99, 0xA7, 0x87, 0xA7, 0x86, 0x9D, 0x89, 0x6B, 0xA2, 0x88, 0x6F, 0x9C,
+    0x88, 0xA6, 0x89, 0x6E, 0x55, 0x69, 0x55, 0x02, 0x7F, 0x18, 0x7F, 0x7F, 0x9D, 0x99, 0x9C, 0x88,
+    0xA2, 0x79, 0xA4, 0x88, 0xA3, 0x89, 0x7B, 0x15, 0xA5, 0x98, 0xA3, 0x98, 0x96, 0x88, 0x65, 0xA2,
+    0x88, 0xC0, 0xA4, 0x87, 0x9B, 0x99, 0x90, 0x78, 0x51, 0x9C, 0x98, 0x9C, 0x98, 0xAE, 0x68, 0xAE,
+    0x78, 0x6F, 0xC0, 0x7F, 0x7A, 0xA2, 0x87, 0x6B, 0x9D, 0x98, 0x9B, 0xA9, 0xB4, 0xA6, 0xA6, 0xA8,
+    0x94, 0x97, 0x92, 0x87, 0xA2, 0x88, 0xC0, 0x9D, 0x89, 0x9C, 0x88, 0x9D, 0x89, 0x66, 0x56, 0x52,
+    0x56, 0x56, 0x69, 0xC2, 0xA7, 0xA4, 0xC0, 0x6F, 0xA2, 0x98, 0xA3, 0x88, 0x6E, 0x7A, 0x6B, 0x6E,
+    0x6B, 0x7E, 0xC0, 0x36, 0xC1, 0x6E, 0xC1, 0x55, 0x69, 0xC0, 0x20, 0x14, 0x0C, 0xA3, 0x97, 0xA9,
+    0x93, 0xA3, 0x93, 0x97, 0x87, 0xA2, 0x89, 0x9D, 0x79, 0x9C, 0x69, 0x7E, 0x5B, 0x9B, 0x6D, 0xFF,
+    0x12, 0xA8, 0xA0, 0x7C, 0xA2, 0x87, 0x9D, 0x89, 0xA2, 0x97, 0xAC, 0xA7, 0x95, 0xB7, 0x9C, 0xC5,
+    0xAC, 0xB7, 0xA7, 0x99, 0xA3, 0x88, 0x7E, 0x08, 0x3C, 0x34, 0x7F, 0x08, 0xC1, 0x03, 0x08, 0xC1,
+    0x55, 0x3C, 0x39, 0xC0, 0x34, 0xC1, 0x69, 0xC0, 0x66, 0x2D, 0xC0, 0x28, 0x2D, 0xC1, 0x79, 0x5A,
+    0x7E, 0x26, 0xC1, 0x2E, 0xC1, 0x69, 0xC0, 0x6E, 0xC0, 0x6E, 0x79, 0x6F, 0x6E, 0x7A, 0xC0, 0x2D,
+    0x7D, 0x92, 0x8A, 0x97, 0x99, 0xAC, 0x92, 0xA6, 0x85, 0xA7, 0x87, 0xA1, 0x7B, 0x5F, 0x99, 0x87,
+    0x41, 0xA2, 0x97, 0xAA, 0x89, 0xFF, 0xC5, 0xCD, 0xFF, 0x73, 0x8C, 0xA1, 0x8A, 0xC1, 0x66, 0xC0,
+    0x69, 0x7F, 0xA2, 0x88, 0x6E, 0x6F, 0x7E, 0x6F, 0x7A, 0x6F, 0x6E, 0xC0, 0x6E, 0x7B, 0xC1, 0x6E,
+    0xC1, 0x65, 0xAA, 0x85, 0xAD, 0x82, 0x93, 0x89, 0x9B, 0x8B, 0x9D, 0x88, 0x42, 0xC0, 0x51, 0x56,
+    0x6F, 0x7F, 0xC1, 0x51, 0xC1, 0x5A, 0xC0, 0x66, 0x55, 0xC0, 0x65, 0xC0, 0x55, 0x66, 0x3B, 0xC0,
+    0x7E, 0x0A, 0x3B, 0x51, 0x3B, 0x6E, 0x55, 0x6B, 0x3B, 0x00, 0x6F, 0x00, 0x51, 0xC1, 0x31, 0xC1,
+    0x2C, 0x31, 0x2C, 0x51, 0x51, 0x55, 0x61, 0x9A, 0x88, 0xA6, 0x99, 0xB4, 0xA9, 0xA3, 0x88, 0x9B,
+    0x77, 0x99, 0x88, 0x6E, 0x5A, 0x61, 0x6F, 0x55, 0x7E, 0x3E, 0x12, 0x7E, 0x7A, 0xA3, 0x98, 0x7A,
+    0xA2, 0x97, 0xA7, 0x97, 0xA2, 0x88, 0x8F, 0x98, 0xB3, 0x99, 0xAB, 0x8C, 0x8C, 0x9D, 0x97, 0x8C,
+    0x7E, 0xC0, 0x19, 0xC1, 0x14, 0xC2, 0x7A, 0x1C, 0x6D, 0xA2, 0x86, 0x21, 0x58, 0x7D, 0x76, 0xA8,
+    0x6B, 0x9F, 0x4F, 0x94, 0x58, 0x9D, 0x87, 0xA8, 0x87, 0x9C, 0x98, 0x7A, 0x55, 0x69, 0x9D, 0x99,
+    0x9D, 0x99, 0x6E, 0x7E, 0x66, 0x3D, 0xC0, 0x7F, 0x38, 0x9A, 0x88, 0x62, 0x6F, 0x66, 0xC0, 0xA8,
+    0x89, 0xC0, 0x9D, 0x88, 0xC0, 0x1E, 0x66, 0xC0, 0x51, 0xA9, 0x97, 0xA3, 0x77, 0x6B, 0x6F, 0x9C,
+    0x89, 0x9A, 0x89, 0xA3, 0x88, 0xA7, 0x88, 0xA4, 0x87, 0xC0, 0x65, 0x1D, 0x7F, 0xC0, 0x9C, 0x89,
+    0x9D, 0xA9, 0x6F, 0x7F, 0xA2, 0x78, 0xA3, 0x89, 0x7F, 0xA2, 0x88, 0x6E, 0x7E, 0x50, 0x9C, 0x98,
+    0xA2, 0x88, 0x6E, 0x7A, 0x05, 0xA7, 0x98, 0x98, 0x78, 0x91, 0x88, 0xC0, 0x9B, 0xA9, 0x9D, 0x98,
+    0xA5, 0x78, 0x3C, 0xA9, 0x9A, 0xC0, 0x16, 0xA2, 0x98, 0x7F, 0x9A, 0x88, 0x61, 0xAF, 0xA7, 0xAB,
+    0xB8, 0x99, 0x97, 0x8F, 0x98, 0x7E, 0x55, 0x9B, 0x89, 0x9C, 0x88, 0x56, 0x7B, 0x52, 0x56, 0x42,
+    0x56, 0x69, 0xC2, 0xA7, 0xA3, 0x6B, 0x6E, 0x7F, 0xA2, 0x87, 0x7F, 0x6F, 0x7E, 0xC0, 0x67, 0x6F,
+    0x7E, 0xC0, 0x36, 0xC1, 0x6D, 0xC1, 0x55, 0x20, 0xC0, 0x69, 0x14, 0xA4, 0x86, 0xA8, 0x92, 0xA3,
+    0x83, 0x98, 0x87, 0x66, 0x9D, 0x7B, 0x9D, 0x78, 0xA2, 0x79, 0x56, 0x99, 0x5F, 0xFF, 0x0A, 0x89,
+    0xA2, 0x7A, 0x6E, 0x9C, 0x98, 0xA5, 0xA8, 0xA8, 0xA7, 0x93, 0xC7, 0xA2, 0xB4, 0xAC, 0xA8, 0xA6,
+    0x88, 0xA2, 0x88, 0x6E, 0x08, 0xC0, 0x56, 0xC0, 0x7A, 0x08, 0xC0, 0x00, 0xC0, 0x03, 0x39, 0x34,
+    0xC1, 0x69, 0xC3, 0x66, 0xC0, 0x66, 0x28, 0xC2, 0x69, 0xC1, 0x6E, 0x21, 0xC0, 0x26, 0x7A, 0x6E,
+    0xC1, 0x69, 0xC0, 0x6E, 0x7E, 0xC0, 0x6E, 0x7E, 0xC0, 0x39, 0x50, 0x7E, 0x91, 0xAC, 0x99, 0x87,
+    0xAC, 0x93, 0xA5, 0x85, 0xA7, 0x87, 0xA4, 0x79, 0x57, 0x9A, 0x76, 0x41, 0xA3, 0x87, 0xA9, 0x9B,
+    0xFF, 0xC5, 0xCD, 0xFF, 0x73, 0x8C, 0xA0, 0x8A, 0x6E, 0x18, 0xC0, 0x69, 0xC0, 0x7F, 0xA2, 0x88,
+    0x6E, 0x6F, 0xA2, 0x88, 0xC0, 0x7E, 0x6B, 0x6E, 0x7F, 0xC0, 0x6E, 0xC4, 0x65, 0xB1, 0x84, 0x9D,
+    0x72, 0x97, 0x99, 0xA0, 0x7B, 0x9D, 0x99, 0x41, 0x56, 0xC1, 0x6B, 0xC1, 0x66, 0x56, 0x56, 0x65,
+    0x56, 0xA2, 0x87, 0xC0, 0x51, 0xC0, 0x51, 0xC0, 0xA2, 0x77, 0xC2, 0x66, 0x36, 0x3B, 0x36, 0xA2,
+    0x87, 0x5F, 0x00, 0xC3, 0x51, 0x55, 0x7B, 0x2C, 0x65, 0xA2, 0x88, 0x6E, 0x2C, 0x51, 0xC0, 0x69,
+    0x52, 0x69, 0x9D, 0x99, 0x51, 0x9B, 0xA9, 0xB7, 0xAA, 0xA6, 0x87, 0x97, 0x78, 0x9D, 0x78, 0xA3,
+    0x88, 0xC0, 0x9B, 0x88, 0xC0, 0xA2, 0x89, 0xC0, 0x69, 0xA2, 0x88, 0x9B, 0x88, 0x61, 0xA7, 0xA8,
+    0x7F, 0xA4, 0x97, 0xAB, 0x97, 0x64, 0x8B, 0x9A, 0xAF, 0x99, 0xB3, 0x8A, 0x94, 0x9C, 0x90, 0x8C,
+    0x1C, 0x6E, 0xC1, 0x1C, 0x56, 0xC1, 0x79, 0x15, 0xC0, 0x69, 0xA2, 0x86, 0x6D, 0x6C, 0x7F, 0x7E,
+    0xA5, 0x8C, 0x9F, 0x4F, 0x94, 0x48, 0x9D, 0x87, 0xA5, 0x98, 0x9C, 0x97, 0xA7, 0x98, 0x9D, 0x99,
+    0x55, 0x9D, 0x98, 0x55, 0x7A, 0x11, 0x05, 0x67, 0x6E, 0x7F, 0x9C, 0x88, 0x9C, 0x88, 0x66, 0xC0,
+    0x5A, 0xC0, 0xA8, 0x89, 0x66, 0x9D, 0x89, 0xC0, 0x65, 0x56, 0xC0, 0x50, 0x66, 0xA6, 0x77, 0xA4,
+    0x88, 0x56, 0x99, 0x89, 0xA5, 0x89, 0x56, 0x55, 0xA3, 0x98, 0xA3, 0x98, 0xA2, 0x88, 0xA2, 0x88,
+    0x9B, 0x99, 0x9B, 0x99, 0x7F, 0x51, 0xA6, 0x89, 0xA5, 0x88, 0xA2, 0x88, 0xC0, 0xA2, 0x88, 0xA2,
+    0x88, 0xA3, 0x99, 0x50, 0x9C, 0x88, 0x7F, 0x6E, 0x7E, 0xC0, 0x65, 0xA3, 0x89, 0xA5, 0x98, 0x8F,
+    0x89, 0x99, 0x88, 0xC0, 0x0A, 0x61, 0x46, 0xAA, 0x88, 0xA9, 0x89, 0xA5, 0x98, 0xA3, 0x99, 0xC0,
+    0x99, 0x99, 0xA4, 0x97, 0xA5, 0xB8, 0xA9, 0xA7, 0x7E, 0x8D, 0x98, 0x50, 0x51, 0x9D, 0x89, 0x9D,
+    0x99, 0xC0, 0x57, 0x66, 0x56, 0x42, 0x56, 0xC0, 0x69, 0xC1, 0xA6, 0x93, 0x7E, 0x7F, 0x6E, 0x7F,
+    0x6E, 0x7F, 0x6F, 0xC0, 0x07, 0x7A, 0x1B, 0x7F, 0xC0, 0x2F, 0x7F, 0x59, 0xC0, 0x65, 0x2F, 0x55,
+    0xC0, 0x69, 0x14, 0xA4, 0x85, 0xA8, 0x92, 0xA3, 0x84, 0x9A, 0x87, 0x51, 0x9C, 0x7B, 0x9C, 0x69,
+    0xA3, 0x88, 0x9F, 0x8B, 0x95, 0x5F, 0x98, 0x5E, 0xA5, 0x79, 0x67, 0x9C, 0x97, 0xA8, 0xA7, 0xA0,
+    0xC8, 0x95, 0xB5, 0xAB, 0xA5, 0xA8, 0x98, 0xA4, 0x99, 0x7F, 0xA2, 0x78, 0x7E, 0xC0, 0x66, 0xC0,
+    0x00, 0x03, 0xC0, 0x55, 0xC3, 0x69, 0xC0, 0x66, 0xC3, 0x65, 0xC1, 0x28, 0x69, 0xC3, 0x65, 0xC1,
+    0x6E, 0xC0, 0x7E, 0xC0, 0x6E, 0xC2, 0x6E, 0x7E, 0x6E, 0xC0, 0x7B, 0x6E, 0x39, 0x9D, 0x98, 0x7A,
+    0x8E, 0x8B, 0xA0, 0x85, 0xAB, 0x94, 0xA4, 0x86, 0xA7, 0x76, 0xA5, 0x99, 0x56, 0x9A, 0x78, 0x9D,
+    0x78, 0xA6, 0x87, 0xA7, 0x8B, 0xFF, 0xB5, 0x8D, 0xFF, 0x73, 0x6C, 0xA1, 0x8A, 0x69, 0x18, 0x66,
+    0x11, 0x6F, 0x7F, 0xA2, 0x87, 0x6F, 0x7E, 0x6F, 0x7E, 0x6B, 0x6E, 0x7F, 0xC0, 0x6E, 0xC4, 0x69,
+    0xA2, 0x87, 0xB3, 0x83, 0x8B, 0x74, 0xA1, 0x9A, 0xA1, 0x8B, 0x51, 0x56, 0x56, 0xC0, 0x55, 0x6B,
+    0x7F, 0x56, 0x7A, 0x32, 0x66, 0xC0, 0x51, 0x59, 0x66, 0xC0, 0x55, 0x66, 0xA2, 0x77, 0x56, 0x61,
+    0xC0, 0x56, 0x27, 0x36, 0x0A, 0x3B, 0xC0, 0x38, 0x00, 0x38, 0xC0, 0x00, 0x51, 0xC0, 0x51, 0x2C,
+    0xC0, 0x69, 0x2C, 0x25, 0x18, 0x55, 0x7A, 0xA2, 0x78, 0x0C, 0x55, 0x5A, 0x9D, 0x99, 0x97, 0xB9,
+    0xB3, 0xAA, 0xAC, 0x98, 0x9C, 0x77, 0x98, 0x57, 0x9C, 0x77, 0x66, 0x9C, 0x88, 0x6B, 0x1D, 0x2C,
+    0xC0, 0x59, 0x16, 0xC0, 0xA2, 0x98, 0xA3, 0x97, 0x7A, 0xA9, 0x97, 0xA2, 0x96, 0x95, 0xAA, 0x6B,
+    0xBA, 0x88, 0x9D, 0x9C, 0x8C, 0x7D, 0x67, 0xC0, 0x6E, 0x6B, 0x66, 0x65, 0xC0, 0x56, 0x79, 0x6E,
+    0xC0, 0x6D, 0x68, 0x7D, 0x6D, 0xA3, 0x98, 0xA1, 0x9A, 0xA6, 0x7B, 0x9C, 0x3E, 0x94, 0x49, 0x9D,
+    0x97, 0xA4, 0x87, 0x64, 0xA7, 0x98, 0x9D, 0x98, 0x55, 0x9D, 0x99, 0x69, 0x66, 0xC0, 0x66, 0xC0,
+    0x6F, 0x7E, 0x9A, 0x89, 0x65, 0x5A, 0x66, 0x5A, 0xC0, 0xA7, 0x99, 0x6B, 0x9C, 0x88, 0xC0, 0x55,
+    0x66, 0xC0, 0x55, 0x9D, 0x99, 0x6E, 0xA3, 0x98, 0xA4, 0x78, 0x9C, 0x89, 0xA3, 0x89, 0xA2, 0x78,
+    0x41, 0x7A, 0x3F, 0xC0, 0x13, 0x07, 0x9D, 0x99, 0x7F, 0xA3, 0x89, 0x6E, 0x6F, 0xA5, 0x98, 0xA4,
+    0x88, 0x7F, 0xA2, 0x88, 0xA3, 0x98, 0x9D, 0x88, 0x9D, 0x99, 0xC0, 0x7E, 0xA2, 0x88, 0x7A, 0x65,
+    0xA2, 0x78, 0xA4, 0x88, 0x99, 0x88, 0x93, 0x88, 0x7F, 0x03, 0x61, 0x2A, 0x02, 0x3E, 0xAF, 0x88,
+    0xA5, 0x99, 0x9B, 0x98, 0x66, 0xA3, 0x98, 0x99, 0xA8, 0xA7, 0xA8, 0xB0, 0xA7, 0x8C, 0x86, 0x99,
+    0x98, 0xC0, 0x52, 0x67, 0x56, 0x56, 0x56, 0x56, 0x52, 0x56, 0xC3, 0xA7, 0xA2, 0xC0, 0x7F, 0xA2,
+    0x77, 0x7B, 0xC1, 0x6B, 0x7E, 0x6B, 0xC0, 0x7F, 0x6E, 0xA2, 0x88, 0x6E, 0x6E, 0xC0, 0x69, 0x66,
+    0x56, 0xC1, 0x69, 0x66, 0xA6, 0x85, 0xA5, 0x92, 0xA2, 0x84, 0x9D, 0x87, 0x9D, 0x99, 0x9C, 0x7B,
+    0x96, 0x5B, 0xA9, 0x89, 0x5B, 0x92, 0x5E, 0x9B, 0x6E, 0xA3, 0x89, 0xC0, 0x9C, 0x98, 0xAB, 0xB8,
+    0x98, 0xC6, 0x9D, 0xC5, 0xAB, 0xA7, 0xA6, 0x87, 0xA3, 0x9A, 0x7F, 0xA2, 0x77, 0x7F, 0xC0, 0x6B,
+    0x66, 0x59, 0xC0, 0x65, 0xC0, 0x69, 0x34, 0xC1, 0x65, 0xC4, 0x66, 0x69, 0xC1, 0x6E, 0xC0, 0x1C,
+    0xC1, 0x21, 0x65, 0xC2, 0x21, 0x69, 0xC0, 0x7A, 0x6E, 0xC0, 0x6E, 0x6B, 0x7E, 0x6E, 0xC0, 0x6E,
+    0x7A, 0x55, 0x55, 0x9C, 0x99, 0x8B, 0x9B, 0xA9, 0x94, 0xA9, 0x94, 0xA3, 0x86, 0xA7, 0x77, 0xA5,
+    0x98, 0x31, 0x9B, 0x89, 0x9D, 0x78, 0xA4, 0x77, 0xA8, 0x8B, 0xFF, 0xAD, 0x2D, 0x92, 0x8F, 0x6F,
+    0x69, 0x0C, 0x6B, 0x11, 0xA2, 0x88, 0xA2, 0x88, 0xC0, 0x6F, 0xA2, 0x88, 0x7E, 0x6B, 0x6E, 0xC0,
+    0x3C, 0xC0, 0x6E, 0xC4, 0x65, 0xA9, 0x86, 0xAA, 0x71, 0x8A, 0x76, 0xA2, 0x8A, 0xA3, 0x9A, 0x9D,
+    0x89, 0x6F, 0x55, 0x51, 0x6F, 0xC0, 0x6B, 0x6E, 0x7B, 0xC0, 0x56, 0xC0, 0x55, 0x51, 0x66, 0xC0,
+    0x55, 0x9D, 0x99, 0x55, 0x55, 0xC0, 0xA2, 0x88, 0xA2, 0x88, 0x3B, 0xC0, 0x6F, 0x3B, 0xC1, 0x6E,
+    0xC0, 0x2C, 0xC1, 0x18, 0x6F, 0xA2, 0x87, 0x2C, 0x65, 0x55, 0x66, 0x18, 0x6E, 0x18, 0x1D, 0x11,
+    0x04, 0x6E, 0x9D, 0x99, 0x98, 0x98, 0xA8, 0xB9, 0xB4, 0x98, 0xA7, 0x78, 0x95, 0x67, 0x92, 0x78,
+    0x51, 0x3D, 0x56, 0x6F, 0x1D, 0xC0, 0x31, 0x69, 0x7E, 0xA2, 0x98, 0x9B, 0x99, 0xA1, 0xA7, 0xA6,
+    0x86, 0xA6, 0x97, 0xA2, 0x89, 0x8F, 0x99, 0xB6, 0x99, 0xAE, 0x7A, 0x8B, 0x9E, 0x99, 0x9B, 0x28,
+    0x2D, 0xC0, 0x28, 0x1C, 0xC0, 0x56, 0x69, 0x7E, 0xC0, 0x69, 0x64, 0xA2, 0x75, 0xA3, 0x98, 0xA2,
+    0x99, 0xA2, 0x88, 0xA7, 0x7C, 0x99, 0x4E, 0x96, 0x48, 0x9D, 0x88, 0xA5, 0x97, 0x40, 0xA4, 0x98,
+    0x7A, 0x69, 0x9D, 0x98, 0x55, 0xC0, 0x66, 0x65, 0x6B, 0xA2, 0x87, 0x18, 0x9C, 0x88, 0x65, 0x5B,
+    0x65, 0x5A, 0x66, 0xA8, 0x88, 0x6B, 0x9C, 0x88, 0xC0, 0x51, 0xC0, 0x66, 0x55, 0x61, 0x6E, 0x5A,
+    0xA4, 0x88, 0x67, 0xA3, 0x88, 0xA2, 0x69, 0x51, 0xC0, 0x1F, 0xC1, 0x7A, 0x56, 0x69, 0x22, 0xA2,
+    0x89, 0xC0, 0x02, 0xA6, 0x97, 0xA3, 0x99, 0xA3, 0x88, 0xC0, 0x1D, 0x65, 0x56, 0x11, 0xA2, 0x88,
+    0x7E, 0x66, 0x2D, 0xA4, 0x88, 0x93, 0x98, 0x9A, 0x78, 0x17, 0xC0, 0x0F, 0x12, 0x0F, 0x3E, 0xA7,
+    0x88, 0xA6, 0x88, 0x11, 0xA3, 0x98, 0x6E, 0x9B, 0x98, 0xA8, 0xA8, 0xB3, 0xA8, 0x8F, 0xA6, 0x93,
+    0x98, 0x6F, 0x62, 0x56, 0x67, 0x5A, 0x56, 0x56, 0x52, 0xC0, 0x56, 0xC2, 0xA7, 0xA2, 0xC0, 0x18,
+    0xA2, 0x78, 0x7E, 0xC0, 0x66, 0x66, 0xC0, 0x33, 0xC0, 0xA2, 0x88, 0x16, 0x6E, 0xA2, 0x88, 0xC0,
+    0x6D, 0x66, 0x69, 0x57, 0xC1, 0x69, 0x55, 0xA7, 0xA6, 0xA5, 0x92, 0xA0, 0x84, 0x54, 0x9D, 0x89,
+    0x9D, 0x7C, 0x91, 0x6E, 0xA7, 0x7A, 0xA3, 0x8A, 0x92, 0x5C, 0x9E, 0x6B, 0xA3, 0x8A, 0x9D, 0xA8,
+    0x79, 0xA9, 0xB8, 0x93, 0xC6, 0xA7, 0xD5, 0xA8, 0x88, 0xA4, 0x88, 0xA4, 0x88, 0x6B, 0x7F, 0x7E,
+    0x6E, 0x6B, 0x66, 0x03, 0x55, 0xC6, 0x65, 0xC2, 0x66, 0xC0, 0x59, 0x66, 0xC0, 0x7E, 0xC1, 0x55,
+    0xC0, 0x1C, 0x69, 0x6E, 0x6B, 0x1A, 0xC4, 0x7A, 0x6F, 0x2E, 0xC0, 0x7E, 0x6E, 0x69, 0x6E, 0x62,
+    0x69, 0x9A, 0x89, 0x8B, 0xAB, 0xAD, 0x73, 0xA8, 0x94, 0xA2, 0x86, 0xA6, 0x76, 0xA5, 0x87, 0x53,
+    0x5A, 0x9B, 0x89, 0x5E, 0xAA, 0x9D, 0xFF, 0xA4, 0xED, 0x94, 0x8E, 0x6F, 0x0C, 0xC0, 0x6B, 0xA2,
+    0x77, 0x7E, 0xA2, 0x88, 0x6F, 0x7F, 0x6E, 0x7F, 0x6E, 0xC1, 0x7E, 0x6B, 0x6E, 0xC4, 0x35, 0xAE,
+    0x84, 0x9F, 0x71, 0x8E, 0x78, 0x52, 0xA8, 0x9A, 0x9C, 0x79, 0xA2, 0x88, 0x55, 0x41, 0x6F, 0x66,
+    0xC0, 0x7F, 0x5A, 0x66, 0x65, 0x6B, 0x55, 0x56, 0xC1, 0x56, 0x51, 0x69, 0x7B, 0x1F, 0x7E, 0x6E,
+    0x3B, 0x33, 0x00, 0x3B, 0x2C, 0xC3, 0x18, 0x56, 0x7A, 0x2C, 0xC0, 0x18, 0xC0, 0x69, 0x18, 0x2C,
+    0xC0, 0x18, 0x6E, 0x11, 0x04, 0xC0, 0x65, 0x9C, 0x88, 0xA0, 0xA9, 0xB3, 0xA9, 0xA9, 0x99, 0x9A,
+    0x67, 0x18, 0x9D, 0x99, 0xC0, 0xA2, 0x77, 0x04, 0xC0, 0xA3, 0x88, 0xA2, 0x98, 0x6E, 0x7A, 0x7E,
+    0x9A, 0x88, 0xA5, 0xA8, 0xA8, 0x85, 0xA2, 0x87, 0xA7, 0xA9, 0x93, 0x8A, 0x79, 0xFF, 0xFF, 0xF6,
+    0x91, 0x9D, 0x93, 0x8C, 0x7F, 0x28, 0xC0, 0x21, 0x19, 0x66, 0x69, 0xC0, 0x69, 0x7E, 0x65, 0x79,
+    0xA5, 0x87, 0xA3, 0x87, 0x7F, 0xA2, 0x89, 0xA6, 0x7B, 0x98, 0x2C, 0x95, 0x5A, 0x9D, 0x98, 0xA7,
+    0x88, 0x9C, 0x78, 0xA2, 0x97, 0xA4, 0x87, 0x9A, 0x97, 0xA2, 0x88, 0x7E, 0x65, 0x55, 0x7A, 0x6B,
+    0x55, 0x51, 0x7B, 0x9D, 0x88, 0xC0, 0x56, 0xC1, 0xA6, 0x88, 0x6F, 0x9C, 0x88, 0x66, 0x56, 0x65,
+    0x2A, 0x55, 0x66, 0x1B, 0xC0, 0x6F, 0x3B, 0xC0, 0xA4, 0x79, 0x5E, 0x56, 0xC1, 0x29, 0x66, 0x7B,
+    0xC0, 0x65, 0xA3, 0x79, 0xA2, 0x98, 0x65, 0xA2, 0x88, 0xA7, 0x99, 0xA3, 0xA8, 0x9D, 0x89, 0x9D,
+    0x98, 0xC2, 0xA2, 0x98, 0xA3, 0x88, 0xC0, 0x6E, 0xA2, 0x98, 0x95, 0x89, 0x9A, 0x67, 0x6E, 0x23,
+    0x28, 0x65, 0x23, 0x7E, 0x30, 0xA2, 0x98, 0xA2, 0x88, 0xA2, 0x98, 0xA2, 0x88, 0x61, 0xA4, 0x98,
+    0xB0, 0xA8, 0x96, 0xA6, 0x8E, 0x87, 0x5A, 0x66, 0x52, 0x6B, 0x56, 0xC0, 0x56, 0x56, 0x66, 0xC0,
+    0x66, 0x5A, 0xC0, 0xA7, 0xA2, 0x6F, 0x7A, 0xA2, 0x78, 0x7E, 0x7F, 0x56, 0x65, 0x66, 0xC0, 0x6B,
+    0x02, 0xA2, 0x87, 0x6F, 0xC0, 0x7E, 0x6E, 0x69, 0x56, 0x6B, 0x1B, 0xC0, 0x69, 0x55, 0xA8, 0x95,
+    0xA5, 0x92, 0xA1, 0x84, 0x50, 0x9D, 0x88, 0x9E, 0x6C, 0x91, 0x5F, 0x9F, 0x7D, 0xA1, 0x7B, 0x99,
+    0x7B, 0x5F, 0xA2, 0x98, 0x9C, 0x98, 0xA5, 0xA8, 0xA3, 0xB7, 0x94, 0xC5, 0xAD, 0xB6, 0xA5, 0x9A,
+    0xA4, 0x87, 0xA1, 0x9A, 0x6E, 0x7F, 0x6E, 0x7B, 0xC2, 0x3B, 0x69, 0xC0, 0x6E, 0x34, 0xC2, 0x69,
+    0x66, 0xC1, 0x66, 0x59, 0x66, 0xC1, 0x69, 0xC0, 0x7B, 0x55, 0xC0, 0x17, 0x6E, 0xC1, 0x69, 0xC1,
+    0x6E, 0xC2, 0x7E, 0xC0, 0x6F, 0x6E, 0x79, 0xC0, 0x6E, 0x55, 0x7A, 0x99, 0x9A, 0x37, 0xAE, 0x72,
+    0xA7, 0x94, 0xA3, 0x87, 0xA5, 0x86, 0xA3, 0x88, 0xC0, 0xA2, 0x79, 0x9B, 0x89, 0x5F, 0xA9, 0x9F,
+    0xFF, 0x94, 0x6C, 0x99, 0x8D, 0x6B, 0x64, 0x6B, 0x18, 0xA2, 0x87, 0x6F, 0x7E, 0x7F, 0xA2, 0x78,
+    0x7E, 0x6B, 0x6E, 0xC1, 0x7E, 0x6B, 0xC0, 0x6E, 0xC4, 0xAE, 0x83, 0x9C, 0x71, 0x8F, 0x88, 0x9F,
+    0x9B, 0xA6, 0x88, 0x56, 0x6F, 0x55, 0x56, 0x5A, 0x66, 0xC0, 0x56, 0x66, 0x55, 0x66, 0x3C, 0x56,
+    0x9D, 0x99, 0xA2, 0x78, 0x51, 0xC0, 0x6B, 0xA2, 0x98, 0xC0, 0x51, 0x55, 0xA2, 0x88, 0xA2, 0x77,
+    0x6B, 0x7A, 0x31, 0x52, 0x2C, 0xC0, 0x24, 0x2C, 0x18, 0x56, 0x27, 0xC0, 0x31, 0x2C, 0xC0, 0x31,
+    0x51, 0x7A, 0x6E, 0x1D, 0xC0, 0x65, 0x56, 0xC0, 0x62, 0x51, 0x9C, 0x98, 0xAE, 0x98, 0xAA, 0xA9,
+    0x5E, 0x36, 0x9C, 0x78, 0xC0, 0x2C, 0x18, 0x09, 0x18, 0x2C, 0x28, 0x7F, 0xC0, 0x7E, 0x68, 0xAA,
+    0x96, 0xA2, 0x87, 0xA4, 0x99, 0x66, 0x8E, 0x88, 0xBB, 0x98, 0xA0, 0x8D, 0x8B, 0x9D, 0x21, 0xC1,
+    0x56, 0x66, 0x69, 0xC0, 0x69, 0xC0, 0x7A, 0x69, 0xA3, 0x98, 0xA7, 0x86, 0x7F, 0x7A, 0xA2, 0x79,
+    0xA5, 0x7B, 0x98, 0x2B, 0x94, 0x59, 0x62, 0xA6, 0x77, 0x41, 0x69, 0x9B, 0x98, 0x97, 0xA8, 0xA9,
+    0x98, 0xA8, 0x88, 0x50, 0x51, 0x7E, 0x66, 0x9D, 0x88, 0x7F, 0x6E, 0x62, 0x55, 0x55, 0xC0, 0x56,
+    0xA6, 0x89, 0x6F, 0x9C, 0x88, 0x51, 0xC0, 0x75, 0x56, 0x61, 0x5A, 0x7F, 0x59, 0x1B, 0xA3, 0x89,
+    0x56, 0xA2, 0x78, 0xA5, 0x89, 0x56, 0x55, 0x6E, 0x6F, 0x30, 0x38, 0x7B, 0x55, 0x6F, 0xA3, 0x99,
+    0x69, 0x7E, 0xA4, 0x99, 0xA2, 0x98, 0x7A, 0x9C, 0x88, 0x6E, 0x7E, 0x66, 0xA2, 0x78, 0xA2, 0x88,
+    0x7A, 0x55, 0x7E, 0x28, 0x96, 0x77, 0x59, 0xC1, 0x5A, 0x30, 0x2D, 0xA2, 0x98, 0xA2, 0x88, 0x7A,
+    0xA3, 0x99, 0xA3, 0x98, 0x61, 0x65, 0xB3, 0xB9, 0x9B, 0xA7, 0x8B, 0x87, 0x56, 0x62, 0x52, 0x5A,
+    0x66, 0x56, 0xC0, 0x56, 0x66, 0xC1, 0x66, 0xC0, 0xA7, 0x93, 0x6E, 0x7A, 0x7F, 0xA2, 0x78, 0x7A,
+    0xC0, 0x56, 0xC1, 0x38, 0x7B, 0x6E, 0x7F, 0x6E, 0xC1, 0x6E, 0x69, 0x20, 0x1B, 0xC1, 0x54, 0xA9,
+    0x95, 0xA4, 0x82, 0xA1, 0x94, 0x54, 0x9C, 0x88, 0x9F, 0x7B, 0xFF, 0x53, 0xE5, 0x9C, 0x7E, 0x9F,
+    0x7C, 0x9B, 0x7A, 0x6E, 0x12, 0x9C, 0x98, 0xA8, 0xB7, 0x9B, 0xB6, 0x98, 0xC6, 0xAF, 0xA6, 0xA6,
+    0x89, 0xA3, 0x99, 0xC0, 0x6F, 0x7F, 0xC1, 0x6B, 0xC1, 0x3B, 0x66, 0x6D, 0xC2, 0x66, 0x69, 0xC3,
+    0x65, 0x5A, 0x66, 0xC1, 0x66, 0x69, 0x14, 0x69, 0xC0, 0x1C, 0x66, 0x14, 0x0D, 0x7E, 0xC3, 0x6E,
+    0xC1, 0x7E, 0x6E, 0xC0, 0x6E, 0x7A, 0x6E, 0x2F, 0x69, 0x97, 0x9A, 0x8E, 0x8A, 0xAF, 0x92, 0xA7,
+    0x84, 0xA3, 0x97, 0xA3, 0x87, 0xA4, 0x76, 0x6E, 0xA1, 0x8A, 0x9D, 0x89, 0xA1, 0x7A, 0xFF, 0xDE,
+    0xAD, 0xFF, 0x84, 0x0B, 0x9B, 0x9D, 0xC1, 0x6B, 0xA2, 0x87, 0x6F, 0x6E, 0x7F, 0xA2, 0x88, 0x6E,
+    0x7F, 0xC0, 0x6E, 0xC1, 0x7E, 0x6B, 0xC0, 0x6E, 0xC3, 0x3C, 0xAC, 0x83, 0xA0, 0x60, 0x8E, 0x89,
+    0xA2, 0x8A, 0xA5, 0x99, 0x6F, 0x9C, 0x88, 0x5E, 0x56, 0xC0, 0x51, 0xC0, 0x56, 0x51, 0x62, 0x59,
+    0x7F, 0xC0, 0x56, 0x6F, 0x51, 0x1F, 0x2C, 0x66, 0x18, 0x65, 0xC0, 0x27, 0x2C, 0xC2, 0x6E, 0x2C,
+    0xC2, 0x18, 0x2C, 0x27, 0x2C, 0x27, 0x31, 0xC1, 0x20, 0x5A, 0x18, 0xC1, 0x0C, 0x1D, 0x18, 0x51,
+    0xC0, 0x9A, 0x99, 0xA7, 0x99, 0xA5, 0xA9, 0xAA, 0x88, 0x98, 0x77, 0x99, 0x79, 0x59, 0x69, 0x31,
+    0x2C, 0x69, 0x20, 0x23, 0x66, 0xA2, 0x88, 0xA7, 0x88, 0x9A, 0x97, 0xA8, 0x95, 0xAA, 0x85, 0x9D,
+    0x9A, 0xA6, 0x8A, 0x87, 0x99, 0xB4, 0x86, 0xB0, 0x8B, 0x88, 0x9E, 0x9B, 0x8B, 0x6E, 0x7B, 0x5A,
+    0x0D, 0xC1, 0x65, 0xC0, 0x7E, 0x7A, 0xA6, 0x87, 0xA6, 0x87, 0x6E, 0x7A, 0x6F, 0xA5, 0x7A, 0x98,
+    0x2B, 0x92, 0x4A, 0x7A, 0xA6, 0x77, 0x9D, 0x89, 0xC0, 0x99, 0x88, 0x9D, 0xA8, 0xA3, 0x99, 0xA2,
+    0x87, 0xA4, 0x87, 0x29, 0xC0, 0x9D, 0x99, 0x65, 0x10, 0xA2, 0x87, 0xC0, 0x10, 0x55, 0xC0, 0x51,
+    0xA6, 0x89, 0xA2, 0x78, 0x9C, 0x88, 0x51, 0x66, 0x66, 0x65, 0x55, 0xC0, 0x2F, 0x51, 0x6B, 0x6E,
+    0x3B, 0x56, 0xA4, 0x79, 0xA3, 0x78, 0x56, 0xC0, 0x6E, 0x35, 0x7F, 0xC1, 0x6F, 0x7A, 0xA4, 0x87,
+    0xA2, 0x98, 0x92, 0x98, 0x9C, 0x98, 0xB2, 0x98, 0x7F, 0x51, 0x56, 0xA2, 0x77, 0x7F, 0x7E, 0x9D,
+    0x88, 0x9D, 0x99, 0x14, 0xA7, 0x88, 0x9A, 0x78, 0x97, 0x88, 0x6E, 0xC0, 0x01, 0x3C, 0x01, 0x7A,
+    0xA3, 0x98, 0x66, 0xA3, 0x89, 0xA5, 0x98, 0x9D, 0xA8, 0x9C, 0x98, 0xB3, 0xB9, 0xA1, 0xA8, 0x8B,
+    0x86, 0x9B, 0x89, 0x66, 0x56, 0x67, 0x55, 0x66, 0x56, 0xC0, 0x56, 0x65, 0xC2, 0xA6, 0x94, 0x7A,
+    0x6F, 0xA2, 0x87, 0x7F, 0x6B, 0xC0, 0x66, 0xC1, 0x02, 0x6F, 0x6E, 0x7A, 0xC1, 0x6E, 0xC3, 0x16,
+    0x0E, 0x3B, 0xAB, 0x84, 0xA3, 0x92, 0xA2, 0x84, 0x58, 0x9A, 0x98, 0xA0, 0x7B, 0x95, 0x5F, 0x9A,
+    0x5F, 0x9F, 0x6C, 0x9C, 0x79, 0x6F, 0xC0, 0x9D, 0xA8, 0xAA, 0xB6, 0x93, 0xD6, 0xA3, 0xB6, 0xAC,
+    0x97, 0xA5, 0x9A, 0xA2, 0x88, 0xC0, 0x6F, 0x7F, 0xC0, 0x66, 0x6B, 0xC0, 0x36, 0x3B, 0xC0, 0x65,
+    0xC3, 0x69, 0xC3, 0x55, 0x7B, 0x20, 0x65, 0x7A, 0x56, 0xC0, 0x14, 0x7E, 0xC1, 0x17, 0xC0, 0x59,
+    0xC0, 0x7A, 0x6E, 0xC0, 0x6E, 0xC2, 0x7E, 0x6E, 0xC0, 0x6E, 0x7B, 0x6D, 0x66, 0x55, 0x97, 0x9A,
+    0x90, 0x9A, 0xAF, 0x92, 0xA6, 0x84, 0xA3, 0x86, 0x2A, 0xA4, 0x76, 0xC0, 0x6F, 0x5B, 0xA2, 0x79,
+    0xFF, 0xD6, 0x6D, 0xFF, 0x7B, 0x8C, 0x53, 0x7E, 0x6B, 0x5E, 0xA2, 0x87, 0x6B, 0x6E, 0x7F, 0xA2,
+    0x78, 0x7E, 0x6F, 0x7A, 0x6E, 0xC1, 0x6F, 0x7A, 0x6E, 0xC5, 0xA3, 0x95, 0xAC, 0x60, 0x95, 0x98,
+    0x98, 0x8B, 0xB0, 0x89, 0x98, 0x98, 0x99, 0x78, 0x55, 0x5A, 0x5A, 0x66, 0x66, 0x5A, 0x65, 0x67,
+    0x5A, 0xC0, 0x66, 0x55, 0xC0, 0x52, 0x7E, 0x6F, 0x55, 0x20, 0x1B, 0x7E, 0x6B, 0x1B, 0xC1, 0xA2,
+    0x78, 0xC0, 0x18, 0x27, 0x59, 0x18, 0xC0, 0x2C, 0xC2, 0x27, 0x2C, 0x24, 0x18, 0x1D, 0x27, 0x18,
+    0xC3, 0x13, 0x5A, 0x51, 0x66, 0x9B, 0xA9, 0xAE, 0x88, 0xA4, 0x88, 0x27, 0x13, 0x9D, 0x88, 0x18,
+    0x2C, 0x6E, 0x34, 0x7E, 0x9B, 0xA9, 0xAC, 0x89, 0x9B, 0x88, 0x9B, 0x98, 0xA9, 0x95, 0xA9, 0x95,
+    0x67, 0xA7, 0x9B, 0x86, 0x89, 0xA9, 0x96, 0xBB, 0x8A, 0x92, 0x9D, 0x90, 0x7C, 0x7E, 0x6F, 0xC0,
+    0x66, 0x65, 0xC0, 0x7E, 0xC1, 0xA3, 0x98, 0xA6, 0x87, 0xA4, 0x98, 0x55, 0x05, 0x66, 0xA7, 0x69,
+    0x9A, 0x2B, 0x91, 0x5A, 0x6F, 0xA5, 0x88, 0x9C, 0x89, 0x55, 0x9B, 0x98, 0x56, 0x08, 0x9C, 0x98,
+    0x65, 0xA9, 0x97, 0xA2, 0x97, 0x9D, 0x98, 0x56, 0x18, 0x6E, 0x38, 0x69, 0x10, 0x55, 0x6F, 0xA2,
+    0x88, 0xA3, 0x99, 0x21, 0x42, 0x61, 0xC0, 0x65, 0x56, 0x65, 0x7F, 0x56, 0x5A, 0xC0, 0xA2, 0x88,
+    0x6B, 0x38, 0x33, 0x6F, 0x56, 0x3C, 0x6E, 0x7A, 0xC0, 0x0B, 0xA2, 0x87, 0x7A, 0xA4, 0x98, 0x9C,
+    0x88, 0x92, 0x98, 0x9D, 0xA8, 0xAC, 0x87, 0xAE, 0x89, 0x9C, 0x88, 0x5A, 0x51, 0x11, 0x3D, 0x99,
+    0x98, 0xA4, 0x89, 0xA5, 0x87, 0xA5, 0x99, 0x7F, 0x96, 0x67, 0x40, 0x6B, 0xC0, 0x7A, 0x6E, 0xC0,
+    0xA2, 0x88, 0x7E, 0x66, 0x7E, 0xA4, 0x88, 0x9B, 0xA8, 0xAF, 0xB9, 0xA9, 0xB8, 0x8F, 0x97, 0x92,
+    0x78, 0x6F, 0x23, 0x56, 0x66, 0x56, 0x66, 0x5A, 0x66, 0x55, 0x66, 0xC1, 0xA6, 0x94, 0x7B, 0xA2,
+    0x77, 0x7F, 0x7F, 0xC0, 0x6B, 0xC2, 0x6E, 0xC0, 0x7E, 0xC0, 0x6E, 0x6B, 0xC0, 0x1B, 0xC1, 0x16,
+    0x0E, 0xC0, 0x64, 0xAB, 0x84, 0xA3, 0x92, 0xA2, 0x84, 0x6C, 0x98, 0x99, 0xA0, 0x7A, 0x99, 0x5F,
+    0xFF, 0x3B, 0x69, 0x9F, 0x6C, 0x9B, 0x8A, 0xA2, 0x77, 0xC0, 0xA1, 0xB7, 0xA4, 0xC6, 0x92, 0xC6,
+    0xAB, 0xA5, 0xA9, 0x9A, 0xA3, 0x99, 0xA2, 0x89, 0x6F, 0x7F, 0xC1, 0x66, 0x66, 0x5A, 0x36, 0xC0,
+    0x3B, 0x65, 0x2C, 0xC1, 0x20, 0x7E, 0xC3, 0x20, 0x7A, 0x20, 0x65, 0x7A, 0x14, 0xC0, 0x1C, 0xC2,
+    0x69, 0xC1, 0x66, 0x15, 0x6F, 0xC0, 0x7A, 0x6E, 0x65, 0xC0, 0x6E, 0x6F, 0xC0, 0x7E, 0xC0, 0x6D,
+    0x55, 0x62, 0x98, 0x79, 0x92, 0x99, 0xAF, 0xA3, 0xA4, 0x85, 0xA3, 0x86, 0xA3, 0x87, 0xA3, 0x87,
+    0x6D, 0x6B, 0x5F, 0xA4, 0x7A, 0xFF, 0xD6, 0x2E, 0xFF, 0x73, 0x6B, 0xA0, 0x9A, 0x6B, 0x5E, 0x6E,
+    0x7E, 0x6B, 0x6E, 0x7F, 0xA2, 0x78, 0x7F, 0xC0, 0x7E, 0xC0, 0x6E, 0xC0, 0x6F, 0x7A, 0xC0, 0x6E,
+    0xC3, 0x3C, 0xA1, 0x95, 0xB0, 0x60, 0x94, 0x86, 0x9C, 0x8C, 0xB1, 0x9A, 0x96, 0x87, 0x96, 0x78,
+    0xC0, 0x55, 0x46, 0x55, 0xC0, 0x66, 0x56, 0xC1, 0x52, 0x65, 0x52, 0x6E, 0x56, 0x07, 0xA2, 0x88,
+    0x7E, 0x7F, 0xA2, 0x98, 0xC0, 0x51, 0x56, 0x56, 0x5A, 0x1B, 0x66, 0x1B, 0x13, 0x6E, 0xC1, 0x6E,
+    0x7F, 0xC2, 0x20, 0x18, 0x55, 0x18, 0x1D, 0x18, 0xC0, 0x1D, 0x18, 0x09, 0x18, 0x13, 0x5A, 0x51,
+    0x9A, 0x99, 0x7F, 0xAB, 0x89, 0x54, 0x10, 0x04, 0xC0, 0x0C, 0xC0, 0x55, 0xA6, 0x98, 0xA9, 0xA9,
+    0xA3, 0x99, 0x8B, 0x89, 0x69, 0xAA, 0x85, 0x0B, 0xA4, 0x98, 0xA3, 0x9C, 0x86, 0x89, 0xA5, 0x85,
+    0xBC, 0x98, 0xA0, 0x8C, 0x8C, 0x8D, 0x9C, 0x8A, 0x6E, 0xC0, 0x7A, 0xA2, 0x78, 0xA2, 0x98, 0xA3,
+    0x98, 0x56, 0x65, 0x7F, 0xA4, 0x87, 0xA2, 0x88, 0x69, 0x66, 0xC0, 0xA7, 0x79, 0x9C, 0x2B, 0x90,
+    0x4B, 0xA2, 0x77, 0xA4, 0x78, 0x9D, 0x99, 0x55, 0x9C, 0x88, 0x61, 0x7F, 0x9C, 0x87, 0x66, 0xA5,
+    0x97, 0xA7, 0x97, 0x61, 0x51, 0x7E, 0xA2, 0x88, 0x9B, 0x89, 0x9D, 0x88, 0x24, 0x56, 0x56, 0x65,
+    0xA8, 0x78, 0x9C, 0x88, 0x51, 0x51, 0xC0, 0x62, 0x55, 0x66, 0x2C, 0x27, 0x5A, 0xC0, 0xA2, 0x88,
+    0x6F, 0x9D, 0x99, 0x7E, 0x3A, 0xA2, 0x78, 0xC0, 0x6E, 0x7A, 0xC0, 0x6E, 0xA2, 0x98, 0x75, 0x99,
+    0x89, 0x65, 0x61, 0x9D, 0x98, 0xC0, 0xAB, 0x99, 0xC0, 0x5A, 0x51, 0x7E, 0xC0, 0x6B, 0xA2, 0x88,
+    0xA4, 0x77, 0xA3, 0x99, 0xA4, 0x98, 0x9C, 0x77, 0x9A, 0x78, 0xC1, 0x55, 0xC0, 0x7A, 0xA2, 0x78,
+    0x7A, 0x9C, 0x88, 0x7E, 0xA7, 0x99, 0x60, 0xAA, 0xB9, 0xAC, 0xA7, 0x97, 0x97, 0x8C, 0x77, 0x56,
+    0x66, 0xC0, 0x56, 0xC0, 0x66, 0x5A, 0x66, 0x52, 0x55, 0x66, 0xC0, 0xA6, 0x95, 0x7E, 0x7F, 0xA2,
+    0x88, 0xC0, 0x7B, 0xC0, 0x6E, 0xC2, 0x6E, 0xC0, 0x6E, 0x6B, 0xC2, 0x1B, 0x16, 0x5A, 0x66, 0x66,
+    0x9F, 0x86, 0xAC, 0x84, 0xA2, 0x92, 0xA2, 0x73, 0xA2, 0x87, 0x9A, 0x88, 0x9D, 0x8B, 0x9C, 0x5E,
+    0x97, 0x3F, 0x9C, 0x7C, 0x9D, 0xB7, 0xAA, 0x86, 0x99, 0x99, 0xA6, 0xA8, 0x99, 0xC8, 0x99, 0xA5,
+    0xAD, 0xA7, 0xA6, 0x8A, 0xA2, 0x88, 0xA2, 0x89, 0x6B, 0x7F, 0xC1, 0x66, 0x52, 0xC0, 0x6E, 0x36,
+    0x2C, 0x66, 0xC2, 0x69, 0xC1, 0x69, 0x7B, 0x20, 0x65, 0xC2, 0x7E, 0x14, 0x69, 0x7E, 0xC6, 0x7F,
+    0x6E, 0xC4, 0x6E, 0xC1, 0x6D, 0x7A, 0xC0, 0x55, 0x66, 0x96, 0x8A, 0x94, 0x79, 0xB1, 0xA3, 0xA3,
+    0x95, 0xA2, 0x86, 0xA3, 0x86, 0x03, 0x6D, 0x6F, 0x6B, 0xA6, 0x69, 0xFF, 0xC5, 0xED, 0xFF, 0x73,
+    0x4C, 0xA1, 0x9A, 0x6E, 0x6E, 0xC0, 0x6F, 0x6E, 0x6B, 0xA2, 0x87, 0x6F, 0x7E, 0x6B, 0x7E, 0xC0,
+    0x6E, 0xC0, 0x6E, 0x6B, 0x7A, 0x6E, 0xC3, 0x3C, 0xA2, 0x84, 0xB0, 0x70, 0x8D, 0x88, 0xA3, 0x8B,
+    0xAB, 0x9B, 0x9A, 0x86, 0x98, 0x87, 0x6B, 0x9D, 0x79, 0x59, 0x52, 0x56, 0x65, 0x52, 0x6E, 0x14,
+    0x51, 0x51, 0x66, 0xA2, 0x78, 0x7F, 0x6F, 0xA3, 0x98, 0xA2, 0x98, 0xA2, 0x98, 0xA4, 0x88, 0x76,
+    0x41, 0x52, 0x5A, 0x55, 0x51, 0x51, 0x59, 0xC0, 0x6B, 0x6E, 0x6E, 0x27, 0x59, 0xC0, 0x7A, 0xC0,
+    0x56, 0x69, 0x18, 0xC0, 0x65, 0x18, 0xC1, 0x1D, 0x18, 0xC1, 0x56, 0x51, 0x9C, 0x99, 0x53, 0xA7,
+    0x99, 0xA4, 0x87, 0x9E, 0x75, 0x10, 0x69, 0xC1, 0x1B, 0xA6, 0x97, 0xAF, 0xA9, 0x93, 0x89, 0x92,
+    0x88, 0x55, 0xA6, 0x87, 0xAC, 0x94, 0xA9, 0x98, 0xA2, 0x9B, 0x86, 0x79, 0x64, 0xBD, 0x95, 0xA6,
+    0x8B, 0x91, 0x9E, 0x95, 0x9C, 0x6E, 0x7E, 0xA3, 0x89, 0xA3, 0x99, 0xA2, 0x88, 0x79, 0xA2, 0x88,
+    0x6F, 0x66, 0x79, 0x6E, 0x3D, 0x66, 0x31, 0xA5, 0x79, 0x9F, 0x3C, 0x90, 0x3A, 0xC0, 0xA5, 0x88,
+    0x9D, 0x89, 0x5A, 0x9B, 0x98, 0x66, 0x19, 0x9B, 0x99, 0x6E, 0xA2, 0x97, 0xA5, 0x98, 0xA2, 0x97,
+    0x76, 0xA3, 0x88, 0x9A, 0x88, 0x94, 0x89, 0x6E, 0xA8, 0x89, 0x6E, 0x9C, 0x88, 0xC0, 0xAC, 0x87,
+    0x9C, 0x89, 0x55, 0x62, 0x0C, 0x65, 0x66, 0x55, 0x6F, 0x33, 0x2C, 0x5B, 0x38, 0x6B, 0x6E, 0x07,
+    0x42, 0xA2, 0x89, 0xA3, 0x88, 0xA4, 0x88, 0x6F, 0x50, 0x62, 0xA0, 0xA8, 0xA3, 0x98, 0x99, 0x78,
+    0xC0, 0x7F, 0x9D, 0x98, 0x65, 0xA2, 0x88, 0x6E, 0xA2, 0x88, 0x6F, 0xA3, 0x98, 0x6F, 0x7E, 0x6F,
+    0xA2, 0x88, 0xA3, 0x98, 0xA4, 0x88, 0xA2, 0x98, 0x94, 0x88, 0x6E, 0x6F, 0xC0, 0x55, 0xC0, 0xA3,
+    0x98, 0x9B, 0x88, 0x9B, 0x89, 0xA6, 0x97, 0xA6, 0x98, 0x61, 0xA7, 0xB9, 0xAD, 0xA8, 0x74, 0x8B,
+    0x77, 0x9B, 0x88, 0x7B, 0xC1, 0x56, 0x66, 0x56, 0xC0, 0x52, 0x65, 0x56, 0xC0, 0x17, 0x7F, 0xA2,
+    0x88, 0x7F, 0x7E, 0xC1, 0x6B, 0x6E, 0xC0, 0x18, 0x1D, 0xC0, 0x6E, 0xC0, 0x7A, 0x22, 0xC0, 0x65,
+    0x56, 0x69, 0x0E, 0x09, 0x9F, 0x86, 0xAD, 0x94, 0xA1, 0x93, 0x9F, 0x84, 0xA5, 0x97, 0x9B, 0x78,
+    0x9B, 0x8C, 0x9D, 0x6E, 0x98, 0x4F, 0x9B, 0x8B, 0xA4, 0xB3, 0xA8, 0xA4, 0x9B, 0xA9, 0xA6, 0x99,
+    0x8E, 0x9A, 0xA2, 0x87, 0xAC, 0x97, 0xA4, 0x89, 0xA1, 0x9A, 0xA1, 0x8A, 0xC0, 0x7F, 0xC1, 0x52,
+    0x66, 0xC0, 0x2E, 0x69, 0xC0, 0x66, 0xC1, 0x27, 0x65, 0xC1, 0x69, 0xC1, 0x66, 0x14, 0x0F, 0xC1,
+    0x6D, 0xC0, 0x69, 0xC0, 0x7A, 0x06, 0xC0, 0x7F, 0xC1, 0x7F, 0xC0, 0x59, 0xC0, 0x6B, 0x7E, 0xC0,
+    0x6E, 0xC0, 0x69, 0xC1, 0x69, 0xC1, 0x94, 0x8A, 0x94, 0x89, 0xB3, 0xA5, 0xA4, 0x84, 0x68, 0xA3,
+    0x87, 0xA2, 0x85, 0xA2, 0x77, 0xA2, 0x88, 0x5A, 0xA6, 0x6B, 0xFF, 0xB5, 0x6D, 0xFF, 0x73, 0x4C,
+    0xA2, 0x79, 0xC0, 0x7E, 0x6E, 0x6B, 0x6E, 0x6B, 0x7E, 0xA2, 0x78, 0x7E, 0x6B, 0x6E, 0x7A, 0xC0,
+    0x6E, 0xC0, 0x32, 0x7B, 0xC2, 0x6E, 0xC0, 0x3C, 0xA5, 0x83, 0xAC, 0x72, 0x87, 0x89, 0xA8, 0x6B,
+    0xA5, 0xB9, 0x64, 0x9B, 0x87, 0xA0, 0x8A, 0x9C, 0x77, 0x4A, 0x51, 0x62, 0x55, 0x52, 0x66, 0x00,
+    0x9D, 0x89, 0x65, 0x00, 0xA2, 0x88, 0xA2, 0x89, 0xC0, 0x6F, 0xA2, 0xA7, 0xA3, 0xA9, 0xA4, 0x88,
+    0x6B, 0x9D, 0x99, 0x5A, 0x6E, 0x41, 0x9D, 0x89, 0x51, 0x50, 0x56, 0x69, 0x6F, 0x69, 0x56, 0x20,
+    0xC0, 0x5A, 0x65, 0x56, 0x1D, 0x18, 0x11, 0x18, 0x1D, 0xC0, 0x18, 0x1D, 0x18, 0xC0, 0x6F, 0x51,
+    0x51, 0x9B, 0x99, 0xA3, 0x9B, 0xA5, 0x99, 0xA3, 0x87, 0x27, 0x51, 0xA3, 0x88, 0xC0, 0x6E, 0xA2,
+    0x98, 0xA1, 0xB9, 0xB0, 0x98, 0x8F, 0x89, 0x95, 0x89, 0xA4, 0x87, 0xA2, 0x76, 0xA4, 0x96, 0xAD,
+    0xA8, 0xA4, 0x88, 0x8F, 0x8A, 0x92, 0x89, 0xFF, 0xC5, 0xEB, 0xA5, 0x89, 0x9C, 0x8D, 0x91, 0x9D,
+    0x7A, 0xA2, 0x77, 0xA5, 0x99, 0xA3, 0x99, 0xC1, 0xA4, 0x88, 0x7F, 0xC0, 0x65, 0x55, 0x0C, 0x69,
+    0x51, 0xA2, 0x78, 0xA3, 0x3C, 0x92, 0x3A, 0x9D, 0x89, 0xA6, 0x78, 0x51, 0x9D, 0x88, 0x9C, 0x88,
+    0xC1, 0x9C, 0x88, 0x6E, 0x7F, 0xA4, 0x97, 0x7E, 0x7F, 0x99, 0x98, 0x99, 0x88, 0x7B, 0xA3, 0x99,
+    0xA7, 0x88, 0x5A, 0x9C, 0x88, 0x65, 0xAA, 0x98, 0x5A, 0x9D, 0x89, 0x1B, 0xC0, 0x55, 0x65, 0x52,
+    0x7E, 0xC0, 0x38, 0xC0, 0x6B, 0xC0, 0xA4, 0x88, 0xA3, 0x98, 0x97, 0x89, 0x9D, 0x89, 0x6F, 0xC0,
+    0xA3, 0x99, 0x9C, 0xA8, 0x9C, 0x88, 0xA3, 0x88, 0xAD, 0x99, 0x6E, 0x9D, 0x88, 0x51, 0x66, 0x9D,
+    0x98, 0xA2, 0x88, 0x22, 0x7E, 0xA2, 0x88, 0xA2, 0x78, 0x7E, 0x6F, 0x7E, 0xA2, 0x99, 0x6E, 0xA4,
+    0x88, 0xA4, 0x98, 0x91, 0x98, 0x99, 0x88, 0xAC, 0x88, 0xC1, 0x5A, 0x7E, 0x97, 0x88, 0x51, 0x04,
+    0xA7, 0xA9, 0x79, 0xA3, 0xA9, 0xAD, 0xB8, 0xA5, 0x98, 0x8D, 0x96, 0x95, 0x77, 0xA1, 0x9A, 0xC1,
+    0x69, 0x57, 0x66, 0x56, 0x6D, 0x66, 0x52, 0xC0, 0x9F, 0xB9, 0xA2, 0x88, 0xA2, 0x88, 0x7E, 0x6F,
+    0x7A, 0x6F, 0x7E, 0x66, 0x18, 0x6E, 0xC2, 0x6E, 0xC2, 0x55, 0x66, 0x07, 0xC0, 0x57, 0x9F, 0x96,
+    0xAE, 0x83, 0xA1, 0x93, 0x9E, 0x84, 0xA5, 0x87, 0x9B, 0x98, 0x9A, 0x7B, 0x9F, 0x6E, 0x98, 0x4F,
+    0x9C, 0x89, 0xAA, 0xC1, 0x9E, 0xB5, 0xA4, 0x87, 0x9C, 0x9C, 0x8C, 0x8C, 0xAD, 0x96, 0xA9, 0x89,
+    0xA2, 0x99, 0xA1, 0x8A, 0x7F, 0x56, 0x7F, 0xC0, 0x66, 0x56, 0x66, 0x2E, 0xC0, 0x65, 0x55, 0xC4,
+    0x69, 0x7A, 0xC6, 0x6D, 0x66, 0x6D, 0xC0, 0x66, 0x06, 0xC0, 0x01, 0x06, 0x7F, 0xC2, 0x66, 0x15,
+    0xC0, 0x7F, 0xC0, 0x6E, 0xC0, 0x6D, 0x66, 0x27, 0x6E, 0x65, 0x66, 0x94, 0x79, 0x96, 0x89, 0xB2,
+    0xA6, 0xA4, 0x85, 0x58, 0xA3, 0x95, 0xA2, 0x86, 0xA3, 0x76, 0xA2, 0x89, 0x56, 0xA5, 0x7C, 0xFF,
+    0xA4, 0xEC, 0x94, 0x8E, 0xA1, 0x8A, 0x7E, 0xC0, 0x6E, 0x6B, 0x6F, 0xC0, 0x7E, 0xA2, 0x78, 0x7A,
+    0x6E, 0x6F, 0x7A, 0xC1, 0x6F, 0xC0, 0x6E, 0x7A, 0xC3, 0x34, 0xA9, 0x92, 0xA5, 0x74, 0x88, 0x7A,
+    0xA6, 0x6B, 0xA7, 0xB9, 0x9F, 0x95, 0x9D, 0x97, 0x6F, 0x9D, 0x79, 0x55, 0x56, 0x66, 0x56, 0xC1,
+    0x66, 0x51, 0xC0, 0x23, 0x28, 0x6F, 0x7A, 0x34, 0xA1, 0xA9, 0xA2, 0xA8, 0xA3, 0x99, 0x6F, 0x66,
+    0x5A, 0x5A, 0x55, 0x51, 0x41, 0x51, 0x55, 0x55, 0x7E, 0xC1, 0x5A, 0xC0, 0x18, 0x69, 0x18, 0x1D,
+    0xC0, 0x18, 0xC1, 0x1D, 0x6E, 0x1D, 0x18, 0xC1, 0x51, 0x56, 0x99, 0x9A, 0xA9, 0x9A, 0xC0, 0xA2,
+    0x77, 0xA4, 0x87, 0x99, 0x88, 0xA4, 0x98, 0x6F, 0x9D, 0x99, 0x0A, 0x75, 0xAF, 0xB9, 0x96, 0x77,
+    0x94, 0x78, 0xA5, 0x99, 0x5D, 0x64, 0xA6, 0x97, 0xAB, 0x97, 0x9C, 0x88, 0x8E, 0x8A, 0xAE, 0x96,
+    0xA9, 0x98, 0xA3, 0x9D, 0x93, 0x9D, 0x9C, 0x89, 0xA3, 0x88, 0xA6, 0x88, 0xA2, 0x99, 0x69, 0x6F,
+    0xA3, 0x99, 0xA2, 0x88, 0x7A, 0x51, 0x55, 0x7E, 0x0C, 0x9D, 0x98, 0x5E, 0xA5, 0x5B, 0x94, 0x2B,
+    0x9C, 0x69, 0xA6, 0x87, 0x41, 0x9C, 0x88, 0x9D, 0x89, 0xA2, 0x88, 0x9C, 0x88, 0x51, 0xC0, 0x11,
+    0xA4, 0x98, 0xA2, 0x87, 0x9D, 0x98, 0x96, 0x99, 0x55, 0x0F, 0xA2, 0x88, 0xA7, 0x98, 0x6E, 0x9D,
+    0x99, 0x9B, 0x98, 0xA5, 0x88, 0xA9, 0x88, 0x31, 0x55, 0x66, 0x65, 0x0C, 0x51, 0x7A, 0x6F, 0x38,
+    0xC0, 0x6B, 0xC0, 0xA7, 0x98, 0x66, 0x99, 0x79, 0x66, 0x56, 0xC0, 0x75, 0x62, 0x69, 0x66, 0xA6,
+    0x88, 0xAE, 0x78, 0x9D, 0x88, 0x9B, 0x89, 0x65, 0x9D, 0x99, 0x51, 0xA5, 0x78, 0xC0, 0xA2, 0x87,
+    0x7F, 0xA2, 0x78, 0xA2, 0x87, 0x7F, 0xA2, 0x98, 0xC0, 0xA4, 0x88, 0x96, 0x98, 0x99, 0x87, 0x51,
+    0xA4, 0x88, 0xA5, 0x98, 0x52, 0x50, 0x41, 0x03, 0xA3, 0x88, 0xA3, 0x99, 0xA8, 0x98, 0x7A, 0xA2,
+    0x99, 0xAC, 0xB7, 0xA7, 0x97, 0x95, 0x95, 0x8E, 0x76, 0xA1, 0x8A, 0xC2, 0x56, 0xC2, 0x66, 0x56,
+    0x66, 0x9D, 0xB9, 0x6F, 0xA3, 0x98, 0x7F, 0xC0, 0x6B, 0x7F, 0x7E, 0xC0, 0x5A, 0xC0, 0x6F, 0x6E,
+    0xC1, 0x69, 0xC0, 0x56, 0xC0, 0x65, 0x59, 0xC0, 0x67, 0x9F, 0x96, 0xAE, 0x83, 0xA3, 0x93, 0x9B,
+    0x95, 0xA5, 0x87, 0x9C, 0x88, 0x9A, 0x7A, 0xA0, 0x5D, 0x96, 0x6F, 0xA2, 0x95, 0xA7, 0xC4, 0x9B,
+    0xA7, 0xA7, 0x98, 0x91, 0x8D, 0x99, 0x9B, 0xAE, 0x87, 0xA5, 0x99, 0xA2, 0x89, 0xA1, 0x9A, 0x6B,
+    0xC2, 0x56, 0x62, 0x6E, 0xC1, 0x65, 0x56, 0x69, 0xC2, 0x66, 0x69, 0xC1, 0x6E, 0x76, 0x59, 0x7A,
+    0x00, 0x7E, 0xC0, 0x69, 0xC1, 0x65, 0x6E, 0xC0, 0x01, 0x6E, 0x7A, 0xC0, 0x6B, 0xC0, 0x01, 0x10,
+    0x6F, 0x6E, 0xC1, 0x7A, 0x6E, 0x65, 0x6E, 0x6E, 0xC0, 0x55, 0x93, 0x8A, 0x97, 0xAA, 0xB3, 0xA6,
+    0xA3, 0x76, 0xA0, 0x85, 0xA3, 0x96, 0xA2, 0x85, 0xA3, 0x86, 0xA3, 0x79, 0x57, 0xA4, 0x7C, 0xFF,
+    0x94, 0x6B, 0x99, 0x8D, 0xA0, 0x9A, 0x6E, 0xC0, 0x6F, 0x6E, 0x6B, 0xC0, 0x7E, 0x6F, 0x6E, 0x7E,
+    0x6B, 0xC0, 0x6E, 0x7A, 0x6E, 0xC0, 0x6B, 0x6E, 0x34, 0xC2, 0x28, 0xAC, 0x82, 0x9F, 0x74, 0x90,
+    0x6C, 0x9F, 0x7D, 0x9F, 0xB6, 0xA7, 0xA6, 0xA2, 0x85, 0x42, 0x45, 0x56, 0x55, 0x66, 0xC0, 0x6B,
+    0x66, 0x55, 0x66, 0x6F, 0x37, 0x2F, 0x3C, 0x3E, 0x2F, 0x3E, 0xA1, 0xA9, 0xA2, 0x88, 0xA2, 0x88,
+    0x6E, 0x51, 0x5A, 0x5A, 0x66, 0x51, 0x55, 0x55, 0xC1, 0x65, 0x56, 0x69, 0x18, 0x11, 0xC1, 0x6F,
+    0x6E, 0xC0, 0x51, 0xC0, 0x7E, 0x1D, 0x16, 0x1D, 0x18, 0x55, 0x9D, 0x99, 0x56, 0x98, 0x9A, 0xAC,
+    0x8A, 0xA3, 0x79, 0x99, 0x88, 0xA6, 0x87, 0x9C, 0x88, 0x7F, 0xA3, 0x89, 0x95, 0x99, 0xA6, 0x87,
+    0xA9, 0xB8, 0xAC, 0xA7, 0x9C, 0x86, 0x92, 0x88, 0xA4, 0x78, 0x37, 0x68, 0xA5, 0xA7, 0xA8, 0xA8,
+    0x6E, 0x94, 0x89, 0x69, 0xAD, 0xA7, 0xA2, 0x8B, 0x9D, 0x8E, 0x95, 0x9B, 0xA4, 0x87, 0xA3, 0x99,
+    0xA2, 0x88, 0x7F, 0xA3, 0x98, 0xA2, 0x88, 0x6F, 0xC0, 0x61, 0x0C, 0x55, 0x61, 0x66, 0x5E, 0xA6,
+    0x48, 0x97, 0x3D, 0x9A, 0x69, 0xA5, 0x88, 0x41, 0x9D, 0x99, 0x9C, 0x78, 0xA2, 0x88, 0x9D, 0x89,
+    0x9D, 0x98, 0x6F, 0x1D, 0xA4, 0x97, 0x7A, 0x9B, 0x99, 0x9B, 0x88, 0x65, 0xC0, 0x7F, 0xA6, 0x88,
+    0xA3, 0x88, 0x50, 0x99, 0x99, 0x9C, 0x98, 0xB2, 0x77, 0x9D, 0x89, 0x51, 0x55, 0x1D, 0x65, 0x51,
+    0x7F, 0xC0, 0x56, 0xC1, 0x66, 0xA2, 0xA8, 0xA4, 0x79, 0x9C, 0x79, 0x9D, 0x88, 0x51, 0x7E, 0xC0,
+    0x7A, 0x66, 0x66, 0x0B, 0xAA, 0x88, 0xAB, 0x88, 0x9D, 0x79, 0x9B, 0x89, 0x51, 0x9B, 0x98, 0x7F,
+    0xA4, 0x77, 0x6E, 0xA2, 0x88, 0xA3, 0x98, 0xA2, 0x88, 0x7E, 0xA2, 0x88, 0xA2, 0x98, 0x9A, 0x98,
+    0x94, 0x88, 0x6D, 0xA2, 0x88, 0xC0, 0xA3, 0x89, 0x0B, 0x9B, 0x89, 0xA4, 0x78, 0xA3, 0x98, 0xC0,
+    0xA4, 0x89, 0xA6, 0x98, 0xA2, 0x98, 0x9B, 0xAA, 0xB1, 0xB7, 0xA8, 0x96, 0x95, 0x84, 0x8F, 0x85,
+    0x6F, 0x6B, 0x67, 0xC3, 0x69, 0x2C, 0x56, 0x6B, 0x9A, 0xBB, 0x6E, 0xA2, 0x88, 0x7F, 0x66, 0x35,
+    0x7A, 0x6F, 0xA2, 0x88, 0x7F, 0xA2, 0x78, 0xA2, 0x87, 0x6F, 0x7E, 0x5A, 0x51, 0x51, 0x51, 0x65,
+    0xC0, 0x59, 0x66, 0x6B, 0x9F, 0x96, 0xAE, 0x83, 0xA4, 0x82, 0x99, 0x96, 0xA5, 0x86, 0x51, 0x99,
+    0x8B, 0xA0, 0x5D, 0x97, 0x7E, 0xA6, 0xA5, 0xA0, 0xB4, 0x9C, 0x98, 0xA6, 0x88, 0x8C, 0x8D, 0xA6,
+    0x89, 0xAA, 0x88, 0xA4, 0x88, 0xA1, 0x9A, 0x7F, 0x6B, 0xC2, 0x52, 0xC1, 0x66, 0xC0, 0x55, 0xC0,
+    0x7E, 0xC0, 0x1A, 0x65, 0x65, 0xC0, 0x6E, 0x02, 0x07, 0x69, 0x66, 0x00, 0x3B, 0x7E, 0x6D, 0xC1,
+    0x65, 0xC0, 0x6E, 0xC0, 0x01, 0x7E, 0x66, 0x01, 0x6E, 0x01, 0xC0, 0x7F, 0xA2, 0x78, 0xC0, 0x66,
+    0xC0, 0x21, 0x7E, 0xC0, 0x69, 0x6E, 0xC0, 0x55, 0x91, 0x8B, 0x99, 0x99, 0xB2, 0xA5, 0xA4, 0x76,
+    0x68, 0xA3, 0x85, 0xA2, 0x95, 0xA2, 0x86, 0xA3, 0x89, 0x5F, 0xA1, 0x7F, 0xFF, 0x83, 0xEB, 0x9D,
+    0x9C, 0x6B, 0x6E, 0x6E, 0x6B, 0x6E, 0xC0, 0x6B, 0x7E, 0x6F, 0x6E, 0xC0, 0x7E, 0x6B, 0x6E, 0xC0,
+    0x7A, 0x2D, 0x6B, 0xC4, 0x28, 0xA9, 0x83, 0x9F, 0x75, 0x9A, 0x5E, 0x92, 0x7C, 0x9C, 0xA4, 0xAE,
+    0xA4, 0x9E, 0x96, 0xA3, 0x78, 0xC0, 0x5A, 0x42, 0x65, 0xC0, 0x3C, 0x66, 0x51, 0x59, 0x7F, 0x3C,
+    0x52, 0x6E, 0x37, 0x34, 0x7F, 0xC0, 0x7A, 0x6F, 0x7A, 0x12, 0x03, 0x5F, 0x65, 0x51, 0x6E, 0x65,
+    0x2C, 0x55, 0xC0, 0x61, 0x6E, 0x1D, 0xC0, 0x11, 0x6E, 0x6F, 0xC0, 0x1D, 0xC1, 0x55, 0xC1, 0x6B,
+    0x65, 0x66, 0x9D, 0x89, 0x61, 0x9B, 0x9A, 0xA6, 0x8A, 0xAC, 0x6A, 0x96, 0x69, 0x64, 0x6E, 0x52,
+    0xA3, 0x99, 0x9A, 0x88, 0x6E, 0xA9, 0xB8, 0xB0, 0xB6, 0x9E, 0x95, 0x94, 0x88, 0x55, 0x6D, 0x6D,
+    0xA8, 0x97, 0xA5, 0xA8, 0xA3, 0x89, 0x96, 0x88, 0x99, 0x98, 0xB0, 0x97, 0x9B, 0x9A, 0xAD, 0x9E,
+    0x9B, 0x9C, 0x97, 0x88, 0x66, 0xA4, 0x87, 0xA4, 0x89, 0xA2, 0x98, 0xC0, 0x59, 0x66, 0x9D, 0x99,
+    0x9D, 0x88, 0xC0, 0x7A, 0xC0, 0x29, 0xA5, 0x69, 0x9B, 0x3C, 0x97, 0x6A, 0xA5, 0x78, 0x51, 0x41,
+    0x9C, 0x89, 0xA2, 0x78, 0x9D, 0x98, 0x9D, 0x89, 0x7E, 0x7F, 0xA4, 0x87, 0x7A, 0x98, 0x88, 0x65,
+    0x56, 0xC0, 0x28, 0x1F, 0xA3, 0x88, 0x65, 0x28, 0x99, 0x98, 0x2C, 0xA6, 0x87, 0x9B, 0x89, 0x2C,
+    0x59, 0x61, 0x66, 0x6F, 0xC0, 0x56, 0x69, 0x7B, 0xA0, 0xA8, 0x96, 0x98, 0xAE, 0x79, 0x46, 0x9C,
+    0x78, 0x9D, 0x89, 0xC0, 0x7A, 0x7A, 0xC0, 0x75, 0x66, 0x55, 0xA8, 0x88, 0xAA, 0x78, 0x41, 0x9B,
+    0x89, 0x9C, 0x88, 0x9D, 0x98, 0xA4, 0x88, 0xC0, 0xA4, 0x77, 0xA3, 0x99, 0xA2, 0x87, 0xA2, 0x88,
+    0xA3, 0x98, 0xA1, 0xA9, 0x92, 0x88, 0x9B, 0x98, 0xA2, 0x77, 0xA2, 0x87, 0x6B, 0xA4, 0x98, 0x5A,
+    0x03, 0x6F, 0xA2, 0x88, 0x7E, 0xA3, 0x89, 0xA6, 0x99, 0xA5, 0xA8, 0x8D, 0x99, 0xB3, 0xA8, 0xAF,
+    0xB5, 0x91, 0x93, 0x98, 0x75, 0x56, 0x57, 0x6B, 0xC6, 0x6B, 0x99, 0xBD, 0x7E, 0x6B, 0xC0, 0x7E,
+    0x6F, 0x6E, 0x7F, 0xA3, 0x99, 0xA4, 0x78, 0xA3, 0x98, 0xA2, 0x78, 0x7F, 0xC0, 0x65, 0x41, 0x9D,
+    0x98, 0x9D, 0x89, 0x9D, 0x99, 0x55, 0x7D, 0x5B, 0x06, 0x9F, 0x96, 0xAE, 0x83, 0xA5, 0x93, 0x98,
+    0x85, 0xA4, 0x86, 0xC0, 0x99, 0x8A, 0x9E, 0x6E, 0x9A, 0x5B, 0xA8, 0xA5, 0x9A, 0xC6, 0x7A, 0x9F,
+    0x9B, 0x91, 0x8C, 0xAC, 0x87, 0xA7, 0x89, 0xA2, 0x89, 0xA1, 0x8A, 0x7B, 0xC0, 0x6E, 0x6B, 0x3B,
+    0x52, 0xC1, 0x66, 0x69, 0x56, 0xC0, 0x22, 0x6E, 0x22, 0x51, 0x65, 0xC2, 0x69, 0xC2, 0x69, 0x6F,
+    0x7E, 0x65, 0xC0, 0x6E, 0x65, 0x6E, 0xC0, 0x01, 0xC4, 0x08, 0x7E, 0x1C, 0xC1, 0x6B, 0x7E, 0x6E,
+    0x6E, 0x69, 0x7A, 0x55, 0x55, 0x91, 0x8A, 0x9B, 0x9A, 0x3A, 0xA4, 0x96, 0x6C, 0xA2, 0x74, 0xA2,
+    0x95, 0xA2, 0x76, 0xA2, 0x88, 0xA2, 0x7A, 0xFF, 0xCE, 0x2B, 0xFF, 0x7B, 0x6B, 0xA0, 0x7B, 0x6E,
+    0x6E, 0x7F, 0xC0, 0x6E, 0xC0, 0x6B, 0x6E, 0xC0, 0xA2, 0x88, 0xC1, 0x7E, 0x6B, 0x6E, 0xC0, 0x7A,
+    0xC0, 0x6E, 0xC3, 0x28, 0xA5, 0x86, 0xA5, 0x56, 0x92, 0x6C, 0x94, 0x7A, 0x9C, 0xB6, 0xA6, 0xA4,
+    0xA4, 0x85, 0xAA, 0x77, 0x55, 0x56, 0x55, 0x66, 0xC1, 0x56, 0x61, 0x5A, 0x7E, 0x6B, 0x6B, 0xC0,
+    0x65, 0x5B, 0xA2, 0x88, 0x7E, 0x3B, 0x76, 0x5A, 0x6D, 0xC0, 0x56, 0x69, 0xC0, 0x56, 0x65, 0xC3,
+    0x1D, 0xC2, 0x6E, 0x1D, 0x69, 0x5A, 0xC0, 0x1D, 0xC0, 0x55, 0xC1, 0x66, 0x56, 0x9D, 0x98, 0x52,
+    0x9D, 0x9A, 0x63, 0xB0, 0x6A, 0x9A, 0x59, 0x65, 0x6E, 0x99, 0x99, 0xA3, 0x9A, 0x55, 0x66, 0xA3,
+    0xA7, 0xB8, 0xB5, 0xA2, 0xA7, 0x95, 0x96, 0x9A, 0x78, 0x5D, 0xA2, 0x87, 0xA7, 0xA7, 0xA2, 0x98,
+    0xA5, 0x98, 0x9A, 0x88, 0x93, 0x88, 0x18, 0x96, 0x98, 0xAB, 0xAE, 0xA4, 0x8C, 0x95, 0x98, 0x6E,
+    0xA3, 0x99, 0xA3, 0x88, 0x7F, 0x66, 0x41, 0x61, 0x55, 0x66, 0x69, 0x38, 0xC0, 0x2C, 0xA5, 0x79,
+    0x9D, 0x4C, 0x96, 0x39, 0xA5, 0x78, 0x41, 0x56, 0x9B, 0x89, 0xA2, 0x88, 0x9C, 0x88, 0x51, 0xC0,
+    0x25, 0xA3, 0x98, 0x7A, 0x98, 0x88, 0xC0, 0x66, 0x55, 0x7E, 0xA5, 0x88, 0xA4, 0x99, 0x55, 0x28,
+    0x9A, 0x88, 0xA2, 0x98, 0xAE, 0x87, 0xA2, 0x77, 0x9D, 0x99, 0x56, 0x51, 0x65, 0x1D, 0x6B, 0x56,
+    0x15, 0xA1, 0xA9, 0x9A, 0xB8, 0x92, 0x98, 0xB1, 0x89, 0xA7, 0x69, 0x9B, 0x79, 0x9D, 0x89, 0x56,
+    0x79, 0x66, 0xC0, 0x7E, 0x7A, 0x66, 0x61, 0xA4, 0x88, 0xAB, 0x79, 0x6E, 0x9C, 0x78, 0x99, 0x99,
+    0x6E, 0xA2, 0x87, 0xC0, 0xA5, 0x88, 0xA3, 0x99, 0xA3, 0x97, 0xA2, 0x88, 0x97, 0xA8, 0x9A, 0x89,
+    0x69, 0xC0, 0x6E, 0x7F, 0xA2, 0x89, 0x7E, 0x9D, 0x78, 0x7F, 0xC1, 0xA2, 0x78, 0xA6, 0xA8, 0xA7,
+    0x98, 0x8D, 0x8A, 0xAB, 0x98, 0xAF, 0xD3, 0x94, 0x92, 0x9E, 0x86, 0x47, 0x9D, 0x89, 0x6F, 0xC3,
+    0x6B, 0xC0, 0x66, 0xC0, 0x99, 0xBE, 0x66, 0x69, 0xA2, 0x89, 0xA2, 0x88, 0xA3, 0x88, 0xA2, 0x89,
+    0xA3, 0x88, 0xA3, 0x99, 0xA3, 0x98, 0xA2, 0x88, 0x6F, 0x6F, 0x21, 0x55, 0x56, 0x9D, 0x98, 0x9D,
+    0x98, 0x9D, 0x89, 0x50, 0xC1, 0x56, 0x64, 0xAD, 0x93, 0xA6, 0x82, 0x96, 0x95, 0xA3, 0x87, 0xA3,
+    0x88, 0x9A, 0x89, 0x9C, 0x5E, 0x9B, 0x7C, 0xA7, 0xB5, 0x99, 0xC7, 0xA4, 0x88, 0x94, 0x9C, 0x9D,
+    0x8B, 0xAD, 0x98, 0xA4, 0x78, 0xA1, 0x9A, 0x6B, 0x6B, 0xC0, 0x6E, 0x6B, 0x61, 0x56, 0xC2, 0x65,
+    0x1A, 0xC0, 0x22, 0x2E, 0x1A, 0x51, 0x65, 0x7E, 0xC2, 0x6E, 0x65, 0xC1, 0x6E, 0x7E, 0x65, 0xC1,
+    0x69, 0x3C, 0x6E, 0xC1, 0x3C, 0xC2, 0x08, 0xC0, 0x7F, 0xC1, 0x6E, 0x6F, 0x7A, 0x6D, 0x6E, 0x29,
+    0x54, 0xC0, 0x91, 0x7A, 0x9C, 0x99, 0xB0, 0xA6, 0xA4, 0x76, 0x7C, 0xA2, 0x75, 0xA2, 0x95, 0xA2,
+    0x75, 0x7F, 0xA5, 0x7B, 0xFF, 0xBD, 0x8A, 0xFF, 0x73, 0x4B, 0xA2, 0x8A, 0x6E, 0x6E, 0x6B, 0x6E,
+    0xC1, 0x6B, 0x6E, 0xC0, 0x7F, 0x6E, 0xC1, 0x7E, 0x6B, 0x6E, 0xC1, 0x7A, 0xC3, 0x65, 0xA8, 0x77,
+    0xA2, 0x57, 0x8F, 0x5B, 0x99, 0x99, 0x98, 0xA7, 0x9D, 0xA6, 0xB0, 0x94, 0xAC, 0x75, 0x9D, 0x79,
+    0x51, 0xC0, 0x66, 0x56, 0xC2, 0x69, 0x66, 0xC0, 0xA0, 0x8A, 0x65, 0x5A, 0xC0, 0xA2, 0x88, 0x5B,
+    0x65, 0x7F, 0x34, 0x2C, 0x69, 0x56, 0x69, 0x52, 0x16, 0xC0, 0x66, 0x16, 0x11, 0xC0, 0x16, 0x1D,
+    0x11, 0xC0, 0x1D, 0x59, 0xC0, 0x66, 0x16, 0x13, 0xC0, 0x0E, 0x09, 0x0E, 0x09, 0x56, 0x61, 0x55,
+    0x9D, 0x9A, 0x9A, 0x9A, 0xAC, 0x7B, 0xA2, 0x5A, 0x69, 0x6F, 0x96, 0x88, 0xA2, 0x89, 0x66, 0x7E,
+    0x78, 0xB2, 0xB6, 0xAC, 0xA7, 0x9A, 0x85, 0x96, 0x77, 0x55, 0xA4, 0x86, 0xA5, 0x97, 0xA1, 0xA8,
+    0xA4, 0x88, 0xC0, 0x8E, 0x88, 0xB4, 0x88, 0x96, 0x99, 0xA6, 0xAC, 0xA3, 0x9D, 0x9D, 0x99, 0x6E,
+    0x18, 0xC2, 0x0C, 0x56, 0x65, 0x65, 0x38, 0xC0, 0x2C, 0xC0, 0xA2, 0x78, 0xA3, 0x4B, 0x95, 0x4B,
+    0xA3, 0x68, 0x46, 0x66, 0x9A, 0x88, 0xA2, 0x78, 0x9D, 0x99, 0x9D, 0x88, 0x7F, 0x6E, 0xA3, 0x98,
+    0x61, 0x99, 0x88, 0xA2, 0x89, 0x65, 0x66, 0x34, 0xA3, 0x99, 0xA5, 0x98, 0x5A, 0x97, 0x98, 0x9B,
+    0x99, 0x6E, 0xA2, 0x98, 0xAE, 0x77, 0x6E, 0x9D, 0x99, 0x51, 0x51, 0x7F, 0x30, 0x65, 0xC0, 0xA2,
+    0x98, 0x93, 0xC9, 0x99, 0x98, 0xA6, 0x89, 0xB0, 0x68, 0x9C, 0x69, 0x9D, 0x79, 0x51, 0xC0, 0x7A,
+    0xC0, 0x7A, 0x7A, 0xC0, 0x7A, 0x9D, 0x98, 0x6B, 0xAA, 0x78, 0xA7, 0x77, 0x9C, 0x88, 0x99, 0x89,
+    0xC0, 0xA2, 0x88, 0xA4, 0x87, 0xA6, 0x88, 0x64, 0x9C, 0x98, 0x9B, 0x88, 0x7A, 0x23, 0x66, 0x69,
+    0x26, 0xA3, 0x89, 0x7F, 0x9C, 0x78, 0x7E, 0x06, 0xC1, 0xA8, 0x98, 0x7F, 0x95, 0x79, 0xA9, 0x87,
+    0xAE, 0xE4, 0x97, 0xB2, 0x9D, 0x76, 0x52, 0x9D, 0x79, 0x52, 0xC3, 0x6B, 0xC1, 0x6B, 0x98, 0xAE,
+    0x65, 0x0A, 0xA3, 0x98, 0xA4, 0x89, 0xA4, 0x88, 0xA3, 0x89, 0xA3, 0x98, 0xA2, 0x89, 0xA2, 0x88,
+    0xA2, 0x87, 0x6F, 0xC0, 0x35, 0x56, 0x51, 0x50, 0x9C, 0x88, 0x50, 0x51, 0x59, 0x67, 0xC0, 0x9F,
+    0x86, 0xAB, 0xA4, 0xA7, 0x93, 0x96, 0x84, 0x7E, 0xA3, 0x97, 0x9C, 0x79, 0x9A, 0x6E, 0x9D, 0x6C,
+    0xA5, 0xC6, 0x99, 0xB7, 0xA3, 0x99, 0x90, 0x8D, 0xA9, 0x89, 0xAA, 0x88, 0xA2, 0x89, 0x6F, 0x6B,
+    0x66, 0xC1, 0x6F, 0x3B, 0x66, 0xC0, 0x56, 0x66, 0x65, 0x5A, 0x66, 0x1A, 0xC0, 0x65, 0x52, 0x6E,
+    0x7A, 0x65, 0x6E, 0x69, 0x02, 0x3B, 0xC0, 0x69, 0x3B, 0x7D, 0x6E, 0x3C, 0xC0, 0x01, 0xC0, 0x3C,
+    0x01, 0xC0, 0x3C, 0x6F, 0x3C, 0x08, 0x6B, 0xC2, 0x6E, 0x7F, 0x6E, 0x69, 0xC0, 0x7E, 0x6D, 0x65,
+    0x55, 0x8F, 0x8B, 0x67, 0xAF, 0xA7, 0xA3, 0x86, 0xA3, 0x86, 0xA2, 0x84, 0xA2, 0x85, 0x6D, 0xA2,
+    0x87, 0xA5, 0x8C, 0xFF, 0xA5, 0x0B, 0xFF, 0x6B, 0x4C, 0xA3, 0x99, 0xC0, 0x6E, 0x6B, 0x6E, 0xC1,
+    0x6B, 0x6E, 0xC0, 0x7E, 0x6B, 0x6E, 0xC2, 0x7E, 0x6B, 0x6E, 0xC0, 0x20, 0x25, 0xC1, 0x61, 0xAB,
+    0x88, 0x9D, 0x58, 0x92, 0x59, 0x99, 0x99, 0x95, 0xB8, 0xA0, 0x85, 0xB0, 0x94, 0xAF, 0x86, 0x9A,
+    0x78, 0x9D, 0x98, 0x6B, 0x55, 0x67, 0x6E, 0x35, 0x2D, 0xC0, 0x65, 0x56, 0xC1, 0x6F, 0x28, 0x25,
+    0x6F, 0xC0, 0x25, 0xC1, 0x56, 0x69, 0x66, 0x55, 0x7B, 0x16, 0x11, 0xC0, 0x16, 0x11, 0x16, 0xC1,
+    0x11, 0xC0, 0x16, 0x1D, 0x6E, 0x16, 0xC0, 0x52, 0x11, 0x5A, 0x61, 0x6B, 0xC0, 0x55, 0x66, 0x9D,
+    0x89, 0x99, 0xAA, 0xA9, 0x7B, 0xA6, 0x6B, 0x55, 0xA4, 0x88, 0x94, 0x78, 0xA0, 0x9A, 0xC0, 0xA2,
+    0x87, 0x75, 0xA7, 0xA6, 0xB1, 0xC8, 0x9E, 0x95, 0x9B, 0x87, 0x44, 0xA3, 0x87, 0xA3, 0x97, 0xA1,
+    0xA7, 0xA4, 0x88, 0xA1, 0x9A, 0x8E, 0x87, 0xB2, 0x88, 0x9A, 0x9A, 0xA1, 0x9B, 0xA7, 0xAE, 0x6F,
+    0x9D, 0x98, 0x9C, 0x88, 0x6E, 0x6B, 0x7E, 0xC0, 0x04, 0x50, 0x61, 0xC0, 0x6F, 0xC2, 0xA6, 0x59,
+    0x98, 0x3B, 0x9F, 0x69, 0x4A, 0xC0, 0x9A, 0x88, 0x6F, 0x55, 0x9C, 0x89, 0x6E, 0xC0, 0xA3, 0x99,
+    0x9D, 0x98, 0x9A, 0x88, 0xA3, 0x88, 0x66, 0x55, 0x7A, 0xA3, 0x89, 0x04, 0xC0, 0x97, 0x88, 0x9D,
+    0x99, 0xC0, 0x66, 0xA6, 0x87, 0xA8, 0x88, 0x50, 0x6F, 0xC0, 0x04, 0x51, 0x51, 0x7E, 0xA2, 0xA8,
+    0x92, 0xB8, 0x61, 0x9D, 0x89, 0xAD, 0x79, 0xA8, 0x58, 0x9A, 0x79, 0x41, 0x66, 0xC0, 0x7E, 0x66,
+    0x7F, 0x7A, 0x66, 0x79, 0x51, 0x51, 0xA7, 0x98, 0xA9, 0x78, 0x9C, 0x88, 0x98, 0x88, 0xA4, 0x88,
+    0xA2, 0x78, 0x9B, 0x99, 0xA5, 0x86, 0xA5, 0x98, 0x50, 0x56, 0x2F, 0xC0, 0x65, 0xC0, 0xA3, 0x99,
+    0xA3, 0x89, 0x3E, 0x66, 0xA3, 0x88, 0x7F, 0x54, 0xA7, 0x99, 0x9B, 0x99, 0x9A, 0x7A, 0xAC, 0x86,
+    0xAD, 0xE3, 0x98, 0xB2, 0x9E, 0x64, 0x1A, 0x9C, 0x7A, 0x9D, 0x99, 0x5A, 0x66, 0x69, 0x1C, 0xC0,
+    0x56, 0x6E, 0x7B, 0xFF, 0x73, 0x6C, 0xC0, 0xA3, 0x88, 0xA4, 0x88, 0xA5, 0x89, 0xA4, 0x98, 0xA3,
+    0x89, 0xA3, 0x88, 0x7F, 0xA2, 0x88, 0x6F, 0x7A, 0x0D, 0xC0, 0x01, 0x55, 0x9D, 0x98, 0x9D, 0x88,
+    0x9C, 0x87, 0x52, 0x69, 0xC0, 0x33, 0x9F, 0x86, 0xAA, 0x94, 0xA6, 0x92, 0x96, 0x95, 0x64, 0xA4,
+    0x76, 0x9D, 0x9A, 0x9A, 0x5D, 0x9E, 0x7B, 0xA2, 0xB7, 0x9C, 0xA7, 0x9D, 0x8A, 0x96, 0x8C, 0xAF,
+    0x97, 0xA4, 0x8A, 0xA2, 0x89, 0x5B, 0x6B, 0x7A, 0x07, 0x65, 0xC0, 0x66, 0xC1, 0x56, 0x66, 0x55,
+    0xC0, 0x66, 0xC2, 0x51, 0x6E, 0x65, 0x66, 0x6D, 0xC2, 0x79, 0xC0, 0x6E, 0x6E, 0x7A, 0xC1, 0x6E,
+    0x6B, 0xC2, 0x66, 0x08, 0xC0, 0x6B, 0xC0, 0x66, 0xC0, 0x6F, 0x0F, 0xA2, 0x88, 0x7E, 0x69, 0xC0,
+    0xA2, 0x76, 0xC0, 0x1B, 0x51, 0x90, 0x6A, 0xA0, 0x9A, 0xAE, 0xA6, 0xA3, 0x76, 0xA3, 0x96, 0xA2,
+    0x84, 0x6C, 0xA2, 0x85, 0xA3, 0x89, 0xA4, 0x7C, 0xFF, 0x94, 0x6B, 0x98, 0x7E, 0xA2, 0x88, 0x7E,
+    0x6B, 0xC0, 0x6E, 0xC1, 0x6B, 0x6E, 0xC0, 0x7E, 0x6B, 0xC0, 0x6E, 0xC1, 0x7E, 0xC6, 0x66, 0xAE,
+    0x78, 0x98, 0x57, 0x93, 0x5A, 0x99, 0xA9, 0x93, 0xB7, 0xA6, 0x85, 0xAE, 0x74, 0xAD, 0xA6, 0x9C,
+    0x79, 0x50, 0x51, 0x57, 0x7A, 0x55, 0xA2, 0x78, 0x65, 0x2D, 0x21, 0x56, 0xC2, 0x6F, 0xC1, 0x66,
+    0x55, 0x6E, 0x11, 0xC0, 0x20, 0x0C, 0x56, 0x69, 0x11, 0x0C, 0xC0, 0xA2, 0x78, 0x11, 0xC0, 0x6B,
+    0x1D, 0xC1, 0x25, 0xC1, 0x16, 0x11, 0xC1, 0x1D, 0x51, 0x04, 0x0C, 0x51, 0x56, 0x51, 0x99, 0x9A,
+    0xA5, 0x8C, 0xA9, 0x6A, 0xA2, 0x79, 0xA2, 0x88, 0x93, 0x88, 0xA0, 0x9A, 0xC0, 0xA2, 0x87, 0x7E,
+    0xA4, 0xA7, 0xB1, 0xC7, 0x74, 0x9E, 0x84, 0x54, 0xA2, 0x86, 0x7E, 0xA2, 0x86, 0xA5, 0x99, 0x52,
+    0x91, 0x88, 0xB1, 0x89, 0x9C, 0x99, 0x9C, 0x9B, 0xAC, 0xAD, 0xA5, 0x79, 0x9A, 0x98, 0x96, 0x88,
+    0x6F, 0x7E, 0x6E, 0x62, 0x24, 0x55, 0x62, 0x69, 0x6F, 0x7E, 0x24, 0xC0, 0xA5, 0x79, 0x9E, 0x3A,
+    0x9B, 0x6A, 0x5A, 0x46, 0x9C, 0x78, 0x5A, 0x66, 0x9C, 0x88, 0x6F, 0x28, 0xA2, 0x88, 0x9D, 0x88,
+    0x9C, 0x88, 0xA3, 0x89, 0x65, 0x31, 0x7F, 0xA2, 0x88, 0xA5, 0x98, 0x6E, 0x96, 0x89, 0x9D, 0x98,
+    0xC0, 0x6E, 0xA3, 0x99, 0xA3, 0x98, 0x50, 0x6B, 0xA5, 0x89, 0x51, 0x9C, 0x89, 0x00, 0xA4, 0xA7,
+    0xA2, 0xA8, 0x93, 0xB9, 0x76, 0x9C, 0x88, 0xA7, 0x68, 0xAE, 0x68, 0x9B, 0x69, 0x9D, 0x8A, 0x55,
+    0x66, 0x07, 0x7A, 0x7B, 0x17, 0xC0, 0x7A, 0xC0, 0x65, 0x61, 0xA6, 0x87, 0xA3, 0x89, 0x9D, 0x99,
+    0x45, 0x0E, 0x9C, 0x87, 0xA3, 0x87, 0xAB, 0x88, 0xA2, 0x77, 0x51, 0x52, 0x69, 0x52, 0xC0, 0xA3,
+    0x99, 0xA2, 0x88, 0x03, 0xC0, 0x21, 0x26, 0x69, 0xA2, 0x88, 0x99, 0x9A, 0x9E, 0x8B, 0xAB, 0x96,
+    0xAF, 0xD3, 0x9A, 0xA1, 0x9D, 0x84, 0x42, 0x9D, 0x9A, 0x9C, 0x79, 0x56, 0xC0, 0x66, 0xC0, 0x5A,
+    0x66, 0x69, 0x19, 0xFF, 0x73, 0x6C, 0x7E, 0xA3, 0x88, 0xA5, 0x89, 0xA6, 0x88, 0xA3, 0x99, 0xA2,
+    0x89, 0x6E, 0xA3, 0x89, 0xA2, 0x88, 0x7E, 0xC1, 0x66, 0x55, 0x39, 0x64, 0x9D, 0x88, 0x9B, 0x98,
+    0x41, 0x69, 0x38, 0x66, 0x68, 0xA9, 0x94, 0xA6, 0x92, 0x96, 0x95, 0x54, 0xA2, 0x86, 0x6B, 0x99,
+    0x7E, 0x9E, 0x6B, 0xA1, 0xB7, 0x75, 0x95, 0xAC, 0xA3, 0x8A, 0xAB, 0x89, 0xA3, 0x89, 0xA0, 0x9A,
+    0x6B, 0xC1, 0x5A, 0x65, 0x56, 0xC0, 0x66, 0xC1, 0x66, 0x55, 0x66, 0xC1, 0x06, 0xC1, 0x66, 0x65,
+    0xC0, 0x6E, 0x65, 0x69, 0xC0, 0x6E, 0x7A, 0x6E, 0x69, 0x6E, 0xC0, 0x6B, 0x7E, 0xC1, 0x6B, 0xC0,
+    0x66, 0x08, 0x6B, 0xC2, 0x6B, 0xC1, 0x7E, 0xA2, 0x87, 0x69, 0x6E, 0x6D, 0x69, 0x51, 0xC0, 0x8F,
+    0x8B, 0x67, 0xAF, 0xA7, 0x0C, 0xA2, 0x85, 0xA3, 0x95, 0xA2, 0x85, 0x6C, 0xA2, 0x89, 0xA1, 0x7E,
+    0xFF, 0x83, 0xCA, 0x9D, 0x8E, 0xA2, 0x78, 0x7E, 0xC0, 0x6E, 0xC1, 0x6B, 0xC0, 0x6E, 0xC1, 0x7F,
+    0xC0, 0x6E, 0xC2, 0x7E, 0xC5, 0x6B, 0xAF, 0x88, 0x94, 0x47, 0x94, 0x6A, 0x99, 0x98, 0x94, 0xB7,
+    0xA6, 0x85, 0xAB, 0x84, 0xAF, 0x97, 0x55, 0x9D, 0x99, 0x41, 0x66, 0xC0, 0x51, 0x6E, 0x5A, 0x66,
+    0xC0, 0x66, 0xC1, 0x55, 0x6B, 0x19, 0xC0, 0x51, 0x6B, 0xC0, 0x55, 0xC0, 0x0C, 0xC2, 0x6F, 0xC0,
+    0x7E, 0x6F, 0x20, 0x2C, 0xC0, 0x6E, 0x2C, 0x20, 0xC2, 0x5A, 0xC0, 0x18, 0x20, 0x1D, 0x18, 0x55,
+    0xC0, 0x66, 0x66, 0x41, 0x9A, 0x99, 0xA3, 0x8B, 0xAA, 0x6B, 0xA8, 0x78, 0x56, 0x8E, 0x88, 0x3E,
+    0xC0, 0xA2, 0x87, 0x7B, 0xA6, 0x96, 0xB5, 0xC6, 0x9F, 0xB7, 0x9B, 0x96, 0x9E, 0x86, 0x7D, 0xA2,
+    0x87, 0xA2, 0x86, 0xA5, 0x88, 0x9B, 0x89, 0x95, 0x88, 0xB0, 0x8A, 0x52, 0x99, 0xAA, 0xA9, 0xAD,
+    0x53, 0x9D, 0x99, 0x9C, 0x78, 0x7A, 0x6E, 0x6B, 0x1C, 0x65, 0xC0, 0x66, 0xC0, 0x10, 0x7E, 0x24,
+    0xC0, 0xA3, 0x89, 0xA4, 0x4A, 0x99, 0x6A, 0x5A, 0x9D, 0x69, 0x9D, 0x68, 0x7F, 0x56, 0x9C, 0x78,
+    0x7A, 0x55, 0xC0, 0x9D, 0x99, 0x51, 0x6F, 0x69, 0x00, 0xC0, 0x14, 0xA5, 0x88, 0x7F, 0x97, 0x98,
+    0x9D, 0x88, 0xC0, 0x6B, 0x34, 0xA4, 0x78, 0x9C, 0x99, 0x18, 0x6E, 0x6B, 0x6F, 0x0C, 0xA4, 0xA7,
+    0xA0, 0xB8, 0x97, 0xA9, 0x61, 0x9D, 0x88, 0x66, 0xB3, 0x68, 0x9E, 0x59, 0x9C, 0x78, 0x9D, 0x8A,
+    0x65, 0x6E, 0x0E, 0x7A, 0x7A, 0x6E, 0x7A, 0x7A, 0xC0, 0x75, 0xC0, 0xA3, 0x99, 0x6E, 0xC0, 0x52,
+    0x55, 0x9C, 0x77, 0xA3, 0x88, 0xAC, 0x87, 0x65, 0x41, 0x55, 0x66, 0x66, 0x17, 0x7F, 0x51, 0xC0,
+    0x26, 0x7F, 0xA2, 0x87, 0x99, 0xA9, 0x9C, 0x79, 0xA4, 0x6A, 0xA8, 0x96, 0xAF, 0xC4, 0x9D, 0xC1,
+    0x9A, 0x83, 0x5A, 0x9D, 0x9A, 0x9C, 0x79, 0x9D, 0x8A, 0xC0, 0x66, 0xC1, 0x5A, 0x65, 0x6B, 0xFF,
+    0x73, 0x6C, 0xA2, 0x87, 0xA2, 0x89, 0xA6, 0x78, 0xA5, 0x99, 0xA4, 0x88, 0x7F, 0x6E, 0xA3, 0x89,
+    0xA2, 0x98, 0x6E, 0xC2, 0x10, 0x55, 0x55, 0x9C, 0x87, 0x9C, 0x87, 0x52, 0x69, 0x07, 0xC0, 0x68,
+    0xA7, 0x94, 0xA7, 0xA2, 0x95, 0x96, 0x50, 0xA2, 0x85, 0xA2, 0x79, 0x99, 0x7D, 0x9D, 0x7D, 0xA1,
+    0xB8, 0x9A, 0xA7, 0x9A, 0x8B, 0xAB, 0x8A, 0xA5, 0x89, 0xA1, 0x9B, 0x6B, 0x7A, 0xC0, 0x07, 0x66,
+    0x65, 0x55, 0x6B, 0x65, 0xC0, 0x56, 0x66, 0xC0, 0x55, 0xC1, 0x66, 0xC1, 0x66, 0x69, 0x6E, 0xC0,
+    0x69, 0x65, 0xC0, 0x7E, 0x6E, 0x6E, 0x69, 0xC0, 0x39, 0x65, 0xC0, 0x39, 0x34, 0x39, 0xC0, 0x6B,
+    0xC0, 0x7F, 0xC0, 0x6B, 0xC0, 0x22, 0x69, 0xC0, 0x7A, 0x6E, 0x7D, 0x29, 0x69, 0x69, 0x69, 0x5B,
+    0x8D, 0x8B, 0x9C, 0x9A, 0xB1, 0xA6, 0xA5, 0x76, 0xA2, 0x85, 0xA3, 0x95, 0xA3, 0x85, 0x68, 0xA4,
+    0x8A, 0xFF, 0xC5, 0xCA, 0xFF, 0x73, 0x6B, 0xA1, 0x8C, 0x6E, 0x7E, 0xC0, 0x6E, 0x6B, 0xC2, 0x6E,
+    0xC2, 0x7F, 0xC2, 0x6E, 0xC1, 0x7E, 0xC3, 0x7F, 0xAF, 0x78, 0x91, 0x59, 0x96, 0x69, 0x99, 0x98,
+    0x97, 0xB7, 0xA7, 0x95, 0xA4, 0x85, 0xAE, 0x86, 0xA2, 0x88, 0x11, 0x55, 0x52, 0x6E, 0x52, 0x69,
+    0x56, 0x26, 0x2D, 0x51, 0xC4, 0x56, 0xC0, 0x66, 0x11, 0xC0, 0x6B, 0x7E, 0x66, 0x6F, 0xA2, 0x88,
+    0xC1, 0x7E, 0x5A, 0x7F, 0xC0, 0x00, 0xC0, 0x51, 0x55, 0x27, 0xC4, 0x2C, 0x27, 0x20, 0x0C, 0xC0,
+    0x6B, 0x55, 0x51, 0x9A, 0x89, 0xA0, 0x9B, 0xAC, 0x5A, 0xA8, 0x79, 0x56, 0x8E, 0x88, 0x7F, 0x6B,
+    0x6D, 0xA1, 0xAA, 0xA6, 0x96, 0xB4, 0xC6, 0xA0, 0xA6, 0x9B, 0xA6, 0x54, 0xA2, 0x87, 0xA2, 0x87,
+    0xA3, 0x97, 0xA3, 0x77, 0x99, 0x89, 0x99, 0x88, 0xB1, 0x9B, 0x9D, 0x99, 0x94, 0x99, 0xA6, 0x9C,
+    0x9B, 0x9B, 0x6B, 0x6E, 0x17, 0x10, 0xC3, 0x6E, 0x10, 0xA2, 0x87, 0x7B, 0x6E, 0xC0, 0x5A, 0xA6,
+    0x6A, 0x9D, 0x6A, 0x9E, 0x69, 0x9D, 0x69, 0x9B, 0x68, 0xA2, 0x79, 0x55, 0x9D, 0x99, 0x56, 0x61,
+    0x55, 0x5A, 0x51, 0x7A, 0xC0, 0x51, 0xC0, 0x14, 0xA4, 0x88, 0x10, 0x00, 0x9C, 0x88, 0xC1, 0xA2,
+    0x88, 0x25, 0x9D, 0x99, 0x9C, 0x78, 0x6E, 0x7F, 0x6E, 0xA3, 0x99, 0xA2, 0xB8, 0xA0, 0xA8, 0x9A,
+    0xA8, 0x9C, 0x88, 0x60, 0x9B, 0x99, 0xAE, 0x68, 0xAA, 0x68, 0x98, 0x68, 0x42, 0x51, 0xC0, 0x6B,
+    0xC0, 0x7A, 0x7E, 0x6B, 0x79, 0x7A, 0xC0, 0x7A, 0x7F, 0x7E, 0x5A, 0x6B, 0x55, 0x56, 0x9C, 0x87,
+    0xA7, 0x87, 0xA9, 0x88, 0x9D, 0x98, 0x51, 0x59, 0x66, 0xA2, 0x88, 0xA2, 0x88, 0x12, 0x6F, 0x2B,
+    0xA2, 0x88, 0xA0, 0xA9, 0x8A, 0xB8, 0xA8, 0x59, 0xAA, 0x58, 0xA5, 0x87, 0xAC, 0xC6, 0xA2, 0xD2,
+    0x98, 0x91, 0x5D, 0x9D, 0x8A, 0x9D, 0x89, 0x9C, 0x8A, 0x66, 0x5A, 0xC0, 0x66, 0x5A, 0x0D, 0xC0,
+    0xFF, 0x7B, 0x8C, 0xA2, 0x78, 0xA3, 0x88, 0xA5, 0x99, 0xA5, 0x89, 0xA3, 0x99, 0x7F, 0xA2, 0x78,
+    0xA2, 0x98, 0xA2, 0x88, 0x6E, 0x6F, 0x66, 0x15, 0xC0, 0x55, 0x51, 0x9C, 0x87, 0x9C, 0x88, 0x65,
+    0x1B, 0xC1, 0x64, 0xA6, 0x84, 0xA8, 0x91, 0x94, 0x95, 0x50, 0x7D, 0xA3, 0x78, 0x99, 0x7D, 0x9E,
+    0x7C, 0xA1, 0xB8, 0x95, 0xA9, 0xA0, 0x8B, 0xAC, 0x88, 0xA2, 0x8A, 0xA1, 0x8A, 0xC0, 0x7B, 0xC0,
+    0x56, 0x65, 0xC0, 0x55, 0xC0, 0x1A, 0xC1, 0x66, 0x66, 0x59, 0xC1, 0x66, 0xC0, 0x66, 0x5A, 0x01,
+    0xC0, 0x79, 0x5A, 0x65, 0x69, 0x6E, 0x7E, 0xC1, 0x6E, 0xC0, 0x34, 0x66, 0x34, 0x2F, 0x34, 0xC0,
+    0x6B, 0x6F, 0xC1, 0x7F, 0x7F, 0xC0, 0x59, 0x7E, 0xC1, 0xA2, 0x86, 0xC0, 0x6D, 0x65, 0x69, 0x56,
+    0x8C, 0x7B, 0x67, 0xB1, 0xA6, 0x14, 0x6C, 0xA3, 0x95, 0xA2, 0x85, 0x6D, 0xA5, 0x8B, 0xFF, 0xAD,
+    0x0A, 0xFF, 0x6B, 0x4C, 0xA2, 0x8A, 0xA2, 0x77, 0xC0, 0x7A, 0x6F, 0xC3, 0x6E, 0xC0, 0x38, 0x3D,
+    0xC0, 0x6B, 0x3D, 0x7F, 0xC0, 0x6E, 0xC3, 0x7A, 0xC0, 0xA3, 0x88, 0xAF, 0x78, 0x8F, 0x59, 0x95,
+    0x7A, 0x97, 0x98, 0xA4, 0xB5, 0xAF, 0x94, 0x90, 0x77, 0xAA, 0x87, 0xA9, 0x98, 0x51, 0x51, 0x55,
+    0xA2, 0x89, 0x51, 0x55, 0x5A, 0x26, 0x6F, 0x51, 0x62, 0x6E, 0x1E, 0x19, 0x1E, 0x14, 0xA2, 0x88,
+    0x6E, 0x6F, 0xC0, 0x6B, 0x7A, 0x56, 0x7F, 0x6E, 0xC1, 0x03, 0x0F, 0x00, 0x6E, 0xC1, 0x3B, 0x55,
+    0x66, 0x59, 0x7A, 0x1D, 0x20, 0x2C, 0x20, 0x56, 0xC0, 0x55, 0x20, 0x55, 0x52, 0x51, 0x9B, 0x99,
+    0x9F, 0x8B, 0xAC, 0x6A, 0xA4, 0x7A, 0xA2, 0x78, 0x90, 0x99, 0x6B, 0x6E, 0xC0, 0xA2, 0x98, 0xA7,
+    0xA7, 0xB1, 0xD6, 0xA1, 0xA7, 0x9D, 0x97, 0x65, 0x7D, 0xA4, 0x77, 0xA3, 0x98, 0x6E, 0x52, 0x97,
+    0x98, 0xAE, 0x77, 0x55, 0x93, 0x99, 0xA3, 0xAC, 0x9D, 0x9C, 0x6B, 0x65, 0x56, 0x65, 0xC0, 0x08,
+    0xC0, 0x10, 0xC1, 0x7E, 0xC3, 0xA5, 0x79, 0xA5, 0x6A, 0x9B, 0x7A, 0x9E, 0x59, 0x99, 0x59, 0xA2,
+    0x68, 0x66, 0x9D, 0x88, 0x61, 0x5A, 0x9C, 0x99, 0xA2, 0x77, 0x51, 0x66, 0x19, 0x51, 0xC0, 0x14,
+    0xA4, 0x88, 0x15, 0x05, 0x9B, 0x99, 0x6E, 0x6B, 0x7E, 0xA7, 0x89, 0x9D, 0x89, 0x9D, 0x88, 0xC0,
+    0x6E, 0x7F, 0xA3, 0x88, 0xA0, 0xB9, 0xA2, 0xA8, 0x9C, 0xA8, 0x99, 0x98, 0x50, 0x9D, 0xA9, 0xA4,
+    0x78, 0xB1, 0x79, 0x9C, 0x68, 0x23, 0x0E, 0x69, 0x0E, 0x6E, 0xC0, 0x7F, 0x7A, 0xC0, 0x75, 0xC0,
+    0x7A, 0x7A, 0xA3, 0x88, 0xC0, 0x6B, 0x56, 0xC0, 0x51, 0x9D, 0x87, 0xA8, 0x87, 0xA8, 0x77, 0x2B,
+    0x17, 0x56, 0xA2, 0x87, 0x2B, 0x52, 0x7E, 0xA2, 0x88, 0xA3, 0x98, 0x9B, 0xA8, 0x82, 0xA9, 0xB1,
+    0x7A, 0xAD, 0x48, 0xA3, 0x98, 0xAB, 0xB7, 0xA5, 0xE3, 0x98, 0x91, 0x68, 0x41, 0x9D, 0x89, 0x9D,
+    0x8B, 0x51, 0x66, 0x5A, 0xC0, 0x56, 0x65, 0xC0, 0xFF, 0x7B, 0xCC, 0x7F, 0xA3, 0x89, 0xA4, 0x88,
+    0xA5, 0x89, 0xA3, 0x99, 0xC0, 0x6F, 0xA3, 0x98, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0xC0, 0x15, 0x5A,
+    0x51, 0x9D, 0x98, 0x9C, 0x88, 0x50, 0x56, 0x1B, 0x6E, 0xC0, 0x65, 0xA4, 0x95, 0xA9, 0x91, 0x95,
+    0x95, 0x9C, 0x87, 0xA2, 0x86, 0xA3, 0x98, 0x9A, 0x6B, 0x9E, 0x7D, 0x75, 0x94, 0x9A, 0xA8, 0x9A,
+    0xA8, 0x89, 0xA2, 0x7A, 0xC0, 0x66, 0x6B, 0xC0, 0x61, 0xC0, 0x59, 0x66, 0xC0, 0x51, 0x66, 0x6B,
+    0x66, 0x59, 0xC0, 0x66, 0xC1, 0x66, 0x59, 0x3C, 0x01, 0xC1, 0x69, 0x65, 0xC0, 0x33, 0x7E, 0x69,
+    0x66, 0x34, 0xC1, 0x3B, 0xC0, 0x34, 0x3B, 0xC1, 0x6B, 0xC1, 0x7F, 0x6F, 0x6E, 0x7D, 0x6F, 0x69,
+    0xC0, 0x7D, 0x6E, 0x69, 0x69, 0x69, 0x52, 0x8B, 0x7B, 0xA3, 0xAA, 0xB0, 0x96, 0xA3, 0x85, 0x6C,
+    0xA3, 0x97, 0xA3, 0x85, 0xA2, 0x87, 0xA3, 0x7D, 0xFF, 0x8C, 0x2B, 0x9A, 0x8D, 0xA2, 0x79, 0x6E,
+    0xC0, 0x7A, 0x6F, 0xC7, 0x6E, 0xC1, 0x7B, 0x6E, 0xC2, 0x6E, 0xC0, 0x7A, 0xC0, 0xA3, 0x88, 0xAD,
+    0x78, 0x8F, 0x59, 0x96, 0x79, 0x96, 0xA8, 0xAF, 0xB2, 0xAE, 0x93, 0x87, 0x6C, 0xA7, 0x88, 0xAC,
+    0x87, 0x65, 0x51, 0x51, 0x6F, 0xC0, 0x55, 0x56, 0x66, 0x26, 0x1E, 0x19, 0x6F, 0x7E, 0x1E, 0xC1,
+    0x2D, 0x39, 0xC1, 0x7B, 0xC0, 0x56, 0x03, 0x6F, 0x69, 0x6F, 0x3B, 0x6E, 0xC0, 0x59, 0x66, 0xC0,
+    0x36, 0x31, 0xC0, 0x55, 0x66, 0xC3, 0x65, 0x56, 0x66, 0xA2, 0x88, 0x1D, 0x04, 0x55, 0x9C, 0x99,
+    0x56, 0xAE, 0x7A, 0x9F, 0x6A, 0xA3, 0x8A, 0x91, 0x9B, 0x66, 0x03, 0x6E, 0x7B, 0xA8, 0xB6, 0xB1,
+    0xD7, 0xA1, 0xA6, 0x9D, 0x97, 0x51, 0xA3, 0x89, 0xA3, 0x98, 0xA3, 0x89, 0x7F, 0xA2, 0x88, 0x37,
+    0xA3, 0x85, 0x9F, 0x86, 0x96, 0x87, 0x9F, 0xAD, 0x9D, 0x9D, 0x56, 0x55, 0x66, 0xC0, 0x39, 0x08,
+    0xC2, 0x69, 0x7A, 0xC1, 0x6E, 0xA2, 0x78, 0x6F, 0xA6, 0x89, 0xA2, 0x69, 0x9C, 0x5A, 0x98, 0x48,
+    0x46, 0xA2, 0x78, 0x52, 0x9C, 0x88, 0xC0, 0x9D, 0x88, 0x66, 0xC0, 0x55, 0x2D, 0x9D, 0x89, 0xC1,
+    0xA4, 0x98, 0xA3, 0x88, 0x9A, 0x78, 0x9A, 0x99, 0x6E, 0x24, 0x29, 0xA7, 0x89, 0x51, 0x9D, 0x88,
+    0xC0, 0x6F, 0x6E, 0xA2, 0xA9, 0x75, 0xA1, 0xB9, 0x75, 0x99, 0x98, 0x51, 0x61, 0x55, 0xAB, 0x99,
+    0xAB, 0x79, 0x99, 0x69, 0x9C, 0x68, 0x52, 0x5E, 0x6B, 0xC1, 0x7E, 0x7A, 0x65, 0x7E, 0xA0, 0xA8,
+    0xC0, 0x7B, 0x38, 0x6B, 0xC2, 0x55, 0x50, 0xA7, 0x87, 0xA6, 0x88, 0x51, 0x51, 0x7E, 0xC0, 0x52,
+    0x7E, 0xA2, 0x88, 0xA5, 0x98, 0x8F, 0xB8, 0x85, 0xD9, 0xB4, 0x49, 0xB2, 0x39, 0xA2, 0x87, 0xA9,
+    0xA7, 0xA8, 0xE3, 0x99, 0xA1, 0x9E, 0x86, 0x51, 0x41, 0x9D, 0x8A, 0x42, 0x66, 0x66, 0x21, 0x66,
+    0x59, 0x66, 0xFF, 0x7B, 0xCC, 0xA2, 0x88, 0xA2, 0x89, 0xA3, 0x89, 0xA5, 0x98, 0xA4, 0x88, 0x6F,
+    0xC0, 0x7F, 0xA3, 0x99, 0xA2, 0x88, 0x6E, 0x10, 0x55, 0x56, 0x50, 0x0A, 0x50, 0x51, 0x56, 0x1B,
+    0x6E, 0xC0, 0x61, 0xA3, 0x96, 0xAB, 0x91, 0x96, 0x93, 0x99, 0x99, 0xA3, 0x86, 0xA3, 0x87, 0x9B,
+    0x7C, 0x9E, 0x7C, 0x9C, 0xA9, 0x97, 0x9B, 0xAD, 0x9A, 0xA5, 0x89, 0xA1, 0x8B, 0x0C, 0xC0, 0x65,
+    0x66, 0xC0, 0x55, 0x66, 0x51, 0x66, 0xC0, 0x51, 0xC0, 0x6B, 0x32, 0x01, 0xC0, 0x32, 0xC1, 0x66,
+    0x32, 0x7B, 0xC1, 0x3A, 0x66, 0x69, 0x6E, 0x7E, 0x66, 0xC4, 0x3B, 0x6B, 0x6E, 0x7A, 0xC0, 0x02,
+    0x3A, 0x7A, 0x0E, 0xC0, 0x7E, 0xA2, 0x88, 0x6E, 0x69, 0x7E, 0x68, 0xA2, 0x87, 0xC0, 0x6D, 0x55,
+    0x9C, 0x89, 0x8B, 0x8C, 0xA9, 0xA9, 0xAC, 0x86, 0xA2, 0x85, 0x7C, 0xA3, 0x87, 0xA2, 0x86, 0xA5,
+    0x88, 0x9C, 0x6F, 0xFF, 0x7B, 0x8C, 0xA0, 0x7A, 0x6F, 0x6E, 0x7A, 0xC0, 0x6F, 0xC7, 0x6E, 0xC2,
+    0x7F, 0xC2, 0x6E, 0xC0, 0x7A, 0xC0, 0x6E, 0xAB, 0x77, 0x94, 0x49, 0x96, 0x7A, 0x95, 0xB8, 0xFF,
+    0x8C, 0x89, 0xA8, 0x92, 0x87, 0x6F, 0xA4, 0x79, 0xAD, 0x87, 0x65, 0x55, 0x56, 0x9D, 0x99, 0x6E,
+    0x6F, 0xC0, 0x66, 0xC0, 0x21, 0x5A, 0x7B, 0x2D, 0xC3, 0x7F, 0x66, 0x5A, 0x37, 0xA2, 0x78, 0x62,
+    0x5A, 0x7E, 0x3B, 0x08, 0x9D, 0x89, 0x34, 0x6E, 0x56, 0xC2, 0x25, 0xC0, 0x56, 0x65, 0xC3, 0x56,
+    0x7F, 0x51, 0x55, 0x18, 0x09, 0x35, 0x9C, 0x89, 0x9D, 0xA9, 0xB4, 0x89, 0x9F, 0x6B, 0x9F, 0x6A,
+    0x91, 0x9B, 0x66, 0x03, 0x6F, 0xA2, 0x97, 0xA7, 0xC7, 0xB1, 0xD7, 0x78, 0x9C, 0x87, 0x9D, 0x99,
+    0xA5, 0x88, 0x7F, 0xA3, 0x99, 0x6F, 0xA5, 0x99, 0xA2, 0x88, 0x9E, 0x76, 0xA1, 0x84, 0x93, 0x87,
+    0xA0, 0x9A, 0x9E, 0x9E, 0x9D, 0x99, 0x51, 0x5B, 0x65, 0x6E, 0xA2, 0x88, 0xC1, 0x65, 0xC0, 0x3C,
+    0x69, 0x6E, 0x7F, 0x15, 0x1A, 0x6F, 0xA8, 0x79, 0x9F, 0x6B, 0x97, 0x49, 0x9D, 0x79, 0xA3, 0x79,
+    0xC0, 0x9C, 0x88, 0x9D, 0x99, 0x41, 0x56, 0x3C, 0x9D, 0x88, 0xA3, 0x89, 0x9D, 0x88, 0x66, 0xC0,
+    0x39, 0xA3, 0x98, 0x9B, 0x89, 0x9B, 0x88, 0x66, 0x5A, 0x7B, 0xA7, 0x88, 0x51, 0x9D, 0x99, 0xC0,
+    0x5E, 0x6E, 0xA2, 0xA9, 0x71, 0xA1, 0xA9, 0x79, 0x99, 0xA9, 0x55, 0x51, 0x61, 0x7E, 0xB1, 0x99,
+    0xA4, 0x58, 0x98, 0x68, 0x9C, 0x69, 0x5B, 0x6E, 0x17, 0xC0, 0x1C, 0x7A, 0x76, 0x7A, 0x7E, 0xC0,
+    0x7A, 0x30, 0x7F, 0xC0, 0x6E, 0xC0, 0x6B, 0xC0, 0x9D, 0x87, 0x7D, 0x37, 0xC0, 0x66, 0x69, 0x52,
+    0x7E, 0xA4, 0x88, 0xA2, 0x97, 0x83, 0xB8, 0x92, 0xC9, 0xAF, 0x5B, 0xB8, 0x37, 0xC0, 0xA7, 0x97,
+    0xAA, 0xD3, 0x9B, 0xC2, 0x9D, 0x95, 0x51, 0x9E, 0x68, 0x9D, 0x8B, 0x42, 0x65, 0x66, 0x5A, 0xC0,
+    0x56, 0x65, 0xFF, 0x7B, 0xED, 0x7F, 0xA2, 0x88, 0xA3, 0x88, 0xA3, 0x99, 0xA4, 0x88, 0xA2, 0x89,
+    0x6E, 0xC0, 0x7F, 0xA2, 0x88, 0x7F, 0x5A, 0x61, 0x19, 0x0A, 0x55, 0x51, 0x1B, 0x56, 0x1B, 0xC0,
+    0x69, 0x66, 0xA3, 0x96, 0xAA, 0x80, 0x98, 0x94, 0x97, 0x98, 0xA3, 0x88, 0xA2, 0x86, 0x9E, 0x6A,
+    0x9D, 0x8C, 0x98, 0xAB, 0xA0, 0x9A, 0xAC, 0x89, 0xA2, 0x7A, 0x6B, 0xC0, 0x7A, 0x62, 0x55, 0xC0,
+    0x65, 0x52, 0x51, 0x55, 0xC0, 0x51, 0x6B, 0x66, 0xC0, 0x32, 0x7B, 0x2D, 0xC3, 0x66, 0xC1, 0x2D,
+    0xC0, 0x69, 0x7F, 0x6E, 0x65, 0xC0, 0x33, 0x2E, 0xC1, 0x7F, 0x6E, 0x6B, 0xC1, 0x02, 0x3A, 0xC0,
+    0x02, 0x6E, 0x7F, 0xA2, 0x87, 0x6E, 0x6E, 0x79, 0x69, 0xA2, 0x77, 0x79, 0x6D, 0x55, 0x9C, 0x88,
+    0x8C, 0x7C, 0xAC, 0x99, 0xA9, 0xA7, 0x6C, 0xA2, 0x86, 0xA2, 0x86, 0x7D, 0xA5, 0x7A, 0xFF, 0xA4,
+    0xEB, 0xFF, 0x6B, 0x4D, 0xA2, 0x89, 0x6E, 0xC0, 0x7E, 0x6B, 0x6E, 0xC7, 0x6E, 0xC2, 0x7F, 0xC2,
+    0x6E, 0xC0, 0x7A, 0xC0, 0x6E, 0xA8, 0x68, 0x97, 0x68, 0x94, 0x7A, 0x9A, 0xA5, 0xFF, 0xAD, 0x69,
+    0xA3, 0xA5, 0xFF, 0x4A, 0xA2, 0x9F, 0x7B, 0xAE, 0x86, 0x6D, 0x56, 0x56, 0x50, 0xC0, 0x6F, 0xC1,
+    0x66, 0xC1, 0x66, 0x32, 0x01, 0x66, 0x2D, 0x6B, 0x3C, 0xC0, 0x34, 0xC0, 0x7F, 0x34, 0x66, 0x03,
+    0x56, 0xC0, 0x2F, 0x55, 0xA2, 0x78, 0x65, 0xC0, 0x6B, 0x59, 0x66, 0xC2, 0x65, 0x5A, 0xC0, 0x66,
+    0x69, 0x0E, 0x61, 0x9C, 0x89, 0xA3, 0x88, 0x3D, 0x9D, 0x8A, 0x50, 0x99, 0xBA, 0xB5, 0xA9, 0xAC,
+    0x69, 0x96, 0x4A, 0x91, 0x8C, 0x51, 0xA2, 0x78, 0x7F, 0x7D, 0xA8, 0xC7, 0xB1, 0xC7, 0x70, 0x9A,
+    0x88, 0x6E, 0xA4, 0x88, 0x02, 0x6E, 0xA2, 0x99, 0xA5, 0x89, 0xA3, 0x99, 0x54, 0xA0, 0x84, 0x93,
+    0x75, 0xA1, 0xAB, 0x9E, 0x8D, 0x9C, 0x89, 0x51, 0x66, 0x55, 0xC0, 0x7E, 0xA2, 0x88, 0xC2, 0x7E,
+    0xC0, 0x6E, 0x06, 0x7E, 0x1A, 0xC0, 0xA4, 0x79, 0xA8, 0x69, 0x98, 0x4A, 0x99, 0x6A, 0xA3, 0x78,
+    0x51, 0x51, 0x52, 0x55, 0x41, 0xC0, 0x9D, 0x88, 0xA2, 0x89, 0x65, 0x41, 0x66, 0x2D, 0xA4, 0x88,
+    0x39, 0x9A, 0x78, 0x66, 0x65, 0x6B, 0xA7, 0x88, 0x66, 0x9D, 0x89, 0xC0, 0x5A, 0x7E, 0x2C, 0x9D,
+    0xA9, 0xA1, 0xA8, 0x76, 0x9C, 0x88, 0x65, 0x50, 0x66, 0x61, 0xA6, 0x98, 0xB1, 0x78, 0x9D, 0x8A,
+    0x98, 0x58, 0x9E, 0x59, 0x6E, 0xC2, 0x7B, 0x75, 0xC0, 0x7E, 0x7A, 0xC1, 0xA2, 0x88, 0x7E, 0x5A,
+    0x04, 0xA2, 0x88, 0x7F, 0x51, 0x9D, 0x96, 0x9A, 0x87, 0xAE, 0x78, 0xA2, 0x89, 0xC0, 0x9D, 0x98,
+    0xC0, 0xA7, 0x99, 0x95, 0xA7, 0x86, 0xA8, 0x9C, 0xA9, 0xA9, 0x69, 0xB8, 0x49, 0xA5, 0x78, 0xA3,
+    0xB7, 0xA9, 0xD4, 0x9F, 0xC2, 0x9C, 0x85, 0x56, 0x9D, 0x88, 0x9D, 0x7A, 0x53, 0x55, 0x66, 0x5A,
+    0x65, 0xC0, 0x56, 0xFF, 0x7B, 0xCD, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x78, 0xA2, 0x98, 0xA2, 0x88,
+    0xA2, 0x89, 0xA2, 0x88, 0x6E, 0x7B, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0x51, 0x56, 0x65, 0x31, 0x50,
+    0x56, 0xC0, 0xA2, 0x87, 0xC0, 0x69, 0x56, 0xA1, 0xA6, 0xA9, 0x92, 0x9B, 0x94, 0x94, 0x89, 0xA4,
+    0x87, 0x5E, 0x6F, 0x9C, 0x8A, 0x9B, 0xAB, 0xA4, 0x99, 0xA8, 0x8A, 0xA1, 0x8B, 0x56, 0x7A, 0x6F,
+    0x61, 0x66, 0x55, 0xC0, 0x51, 0x51, 0x66, 0x55, 0x66, 0x56, 0x66, 0xC0, 0x32, 0x7B, 0x2D, 0x66,
+    0xC0, 0x2D, 0x28, 0x56, 0xC1, 0x28, 0xC0, 0x69, 0xA2, 0x88, 0x3A, 0x35, 0xC2, 0x66, 0x35, 0x6F,
+    0xC1, 0x3C, 0xC0, 0x01, 0x3A, 0x35, 0x3A, 0xA2, 0x98, 0xA2, 0x77, 0x7E, 0x6E, 0x69, 0xC0, 0xA2,
+    0x86, 0x7E, 0x59, 0x79, 0xA1, 0x75, 0x9B, 0x9B, 0x8D, 0x8C, 0xAB, 0xAA, 0xA8, 0x86, 0x7C, 0xA3,
+    0x97, 0xA4, 0x76, 0x7E, 0xA2, 0x6B, 0xFF, 0x7B, 0xEA, 0x9C, 0x8F, 0x7F, 0x6E, 0xC0, 0x7E, 0xC0,
+    0x38, 0xC7, 0x6E, 0xC1, 0x7B, 0x6E, 0xC2, 0x6E, 0xC1, 0x7A, 0x11, 0xA7, 0x78, 0x9A, 0x68, 0x93,
+    0x8B, 0xA2, 0x93, 0xFF, 0xBD, 0xEA, 0x9F, 0xA6, 0xFF, 0x4A, 0x82, 0x9F, 0x6B, 0xAF, 0x97, 0xA2,
+    0x76, 0x51, 0x55, 0x62, 0x59, 0x6F, 0xC1, 0x66, 0xC1, 0x56, 0x2D, 0xC0, 0x7B, 0x6E, 0x52, 0x69,
+    0x37, 0x28, 0x37, 0xC0, 0x2F, 0x6E, 0x56, 0xC0, 0x34, 0xC0, 0x51, 0x25, 0x56, 0xC2, 0x65, 0x1D,
+    0x11, 0xC2, 0x1D, 0x55, 0xC1, 0x66, 0x9C, 0x98, 0x6E, 0x6F, 0x9D, 0x99, 0x61, 0x98, 0x99, 0xB2,
+    0xA9, 0xB3, 0x87, 0x95, 0x3B, 0x94, 0x7D, 0x9B, 0x89, 0xA2, 0x87, 0xC0, 0xA1, 0xA8, 0xAC, 0xB6,
+    0xAF, 0xC7, 0x9A, 0xA8, 0x9C, 0x88, 0xA3, 0x88, 0x2E, 0x7F, 0x6E, 0xA3, 0x89, 0xA3, 0x99, 0xA3,
+    0x99, 0x69, 0xA4, 0x75, 0x94, 0x73, 0x9C, 0xAA, 0x9E, 0x8C, 0x43, 0x66, 0x65, 0x51, 0x55, 0xC0,
+    0x7E, 0x6F, 0x2D, 0xC2, 0x7E, 0x6E, 0x06, 0x7E, 0x6F, 0x6F, 0xA6, 0x79, 0xA3, 0x5A, 0x96, 0x5A,
+    0x46, 0x5A, 0x51, 0x56, 0x55, 0x9D, 0x89, 0x55, 0x51, 0x7F, 0x01, 0x9D, 0x89, 0x65, 0xA3, 0x89,
+    0xA3, 0x98, 0x56, 0x99, 0x88, 0x52, 0x66, 0xC0, 0xA6, 0x77, 0x7F, 0x9C, 0x89, 0xC0, 0x5A, 0x7F,
+    0xA1, 0xA8, 0x9D, 0x98, 0xA2, 0xA8, 0x61, 0x51, 0x61, 0x55, 0x66, 0x61, 0x65, 0xAB, 0xA9, 0xA9,
+    0x88, 0x9E, 0x59, 0x9C, 0x69, 0x9D, 0x68, 0x5A, 0xC0, 0x6B, 0x7A, 0xC0, 0x76, 0x7D, 0xC0, 0x7B,
+    0x6E, 0x7A, 0x08, 0xC0, 0x7E, 0x6E, 0xA2, 0x88, 0xA1, 0xA9, 0x9D, 0x96, 0x8A, 0x96, 0xAB, 0x89,
+    0xB3, 0x79, 0x9D, 0x89, 0x9A, 0x98, 0xA3, 0x89, 0x7A, 0x92, 0xA7, 0x92, 0xA7, 0x9D, 0xA9, 0xA6,
+    0x69, 0xB7, 0x39, 0xA8, 0x88, 0x2A, 0xA6, 0xC4, 0xA3, 0xC2, 0x9B, 0x96, 0x56, 0x9D, 0x89, 0x9D,
+    0x89, 0x43, 0x51, 0xC0, 0x59, 0x66, 0xC0, 0x59, 0x9A, 0xBF, 0x7F, 0xA2, 0x88, 0x6F, 0xA2, 0x87,
+    0x6F, 0x6B, 0xA2, 0x88, 0xA2, 0x88, 0x7E, 0x6F, 0xA2, 0x88, 0x7F, 0x5A, 0x36, 0x55, 0x62, 0x0E,
+    0x55, 0x3A, 0x7E, 0xC0, 0x59, 0x66, 0xA3, 0x96, 0xA9, 0xA1, 0x9B, 0x95, 0x8D, 0x8C, 0xAB, 0x88,
+    0x96, 0x78, 0xA8, 0x88, 0x56, 0x7A, 0xA6, 0xAA, 0xA4, 0x7B, 0xA1, 0x8A, 0x66, 0x66, 0xC0, 0x7A,
+    0x55, 0x51, 0xC1, 0x9C, 0x88, 0xC0, 0x51, 0x66, 0x66, 0x56, 0x6E, 0xC0, 0x7B, 0x32, 0x2D, 0x56,
+    0x32, 0x2D, 0x25, 0x66, 0xC0, 0x25, 0x20, 0x69, 0x3C, 0xC0, 0x65, 0x3C, 0xC0, 0x30, 0xC0, 0x3C,
+    0xC2, 0x66, 0x2D, 0x3C, 0x6E, 0x35, 0x3A, 0xA3, 0x98, 0x6E, 0xC0, 0xA2, 0x87, 0x69, 0x6E, 0xA2,
+    0x86, 0x7E, 0x69, 0x68, 0x58, 0x9A, 0x9B, 0x8E, 0x7C, 0xAB, 0x99, 0xA9, 0xA6, 0x68, 0xA3, 0x97,
+    0xA4, 0x76, 0xA2, 0x88, 0x9B, 0x6F, 0x90, 0x6F, 0xA0, 0x8C, 0x7F, 0x69, 0x6E, 0xC0, 0x7F, 0xC8,
+    0x7E, 0xC1, 0x6B, 0x0C, 0xC3, 0x6E, 0xC0, 0x7A, 0x11, 0xA5, 0x88, 0x4F, 0x92, 0x7A, 0xA1, 0xA4,
+    0xFF, 0xC6, 0x2B, 0x9E, 0x96, 0x86, 0x6F, 0x9E, 0x6B, 0xB0, 0x86, 0xA2, 0x76, 0x9D, 0x99, 0x51,
+    0xC0, 0x56, 0x69, 0x6F, 0xC0, 0x2D, 0xC2, 0x32, 0x2D, 0x7F, 0x56, 0x66, 0x55, 0x7E, 0xC0, 0x34,
+    0xC1, 0x7F, 0x34, 0x56, 0x20, 0xC0, 0x51, 0xA2, 0x78, 0xC0, 0x65, 0x1D, 0xC0, 0x11, 0x1D, 0x69,
+    0x11, 0xC0, 0x5A, 0x11, 0xC1, 0x0E, 0xC0, 0x62, 0x55, 0xC0, 0x51, 0x51, 0x98, 0x99, 0xAE, 0xB8,
+    0xB7, 0x99, 0x96, 0x4A, 0x93, 0x6D, 0x9B, 0x8A, 0x6D, 0xC0, 0xA0, 0xA8, 0xB1, 0xD6, 0xAA, 0xB6,
+    0x9B, 0x99, 0x55, 0x2E, 0xC1, 0xA2, 0x89, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x89, 0xA3, 0x98, 0xA4,
+    0x75, 0x94, 0x73, 0x9D, 0xA9, 0x9E, 0x8C, 0x52, 0x6B, 0xC0, 0x51, 0x55, 0x66, 0xC0, 0x6B, 0x32,
+    0x66, 0x51, 0xC0, 0x23, 0x32, 0x6E, 0x06, 0x7F, 0xA2, 0x78, 0xA2, 0x78, 0xA5, 0x8A, 0x9C, 0x4A,
+    0x9C, 0x49, 0xC0, 0x41, 0x7F, 0x9D, 0x89, 0x9D, 0x88, 0x55, 0x66, 0x56, 0xA3, 0x88, 0x9C, 0x88,
+    0x56, 0x39, 0x15, 0x6B, 0x99, 0x88, 0x41, 0x66, 0xC0, 0xA4, 0x88, 0xA3, 0x89, 0x9C, 0x98, 0x57,
+    0x6D, 0x6F, 0x7A, 0x9C, 0xA8, 0xA3, 0x98, 0x9D, 0x99, 0x65, 0x7A, 0x9D, 0x99, 0xC0, 0x65, 0x60,
+    0xA4, 0xA9, 0xAA, 0x88, 0x46, 0xA3, 0x79, 0x9E, 0x68, 0x9E, 0x58, 0x56, 0x5A, 0x2B, 0x66, 0x66,
+    0x7E, 0xC0, 0x7E, 0xC1, 0xA1, 0xA9, 0xA2, 0x77, 0xC0, 0x7E, 0xA2, 0x88, 0xA5, 0xA7, 0x94, 0xA7,
+    0x90, 0x77, 0xA3, 0x88, 0xA8, 0x89, 0xA3, 0x89, 0xA3, 0x88, 0x66, 0x61, 0x9B, 0xA9, 0x92, 0xA7,
+    0xC0, 0xA3, 0x79, 0xB3, 0x59, 0xAD, 0x79, 0xA3, 0xA8, 0xA0, 0xC4, 0xA8, 0xC2, 0x9B, 0x94, 0x62,
+    0x9D, 0x8A, 0x9D, 0x79, 0x9D, 0x8B, 0x55, 0x66, 0x69, 0x5A, 0x69, 0xC0, 0x99, 0xBF, 0x7F, 0xA3,
+    0x78, 0x7A, 0x6E, 0x3A, 0x37, 0xC0, 0xA2, 0x88, 0xA2, 0x89, 0xA2, 0x88, 0xA2, 0x87, 0x6F, 0xC0,
+    0x7F, 0xC0, 0x65, 0x13, 0x07, 0x56, 0x65, 0x51, 0x66, 0xC0, 0xA2, 0x86, 0xFF, 0xD6, 0x4C, 0x9C,
+    0x84, 0x8D, 0x9D, 0xA9, 0x79, 0x98, 0x7A, 0xA5, 0x99, 0x9D, 0x88, 0xA9, 0xA8, 0xA5, 0x9A, 0xA2,
+    0x9A, 0x6B, 0xC0, 0x56, 0x66, 0xC0, 0x66, 0x50, 0xC1, 0x9C, 0x87, 0x66, 0x56, 0x65, 0x6B, 0x52,
+    0x6E, 0xC0, 0x2D, 0xC0, 0x56, 0x69, 0x2D, 0xC0, 0x66, 0x25, 0x66, 0xC0, 0x65, 0x20, 0xA3, 0x88,
+    0x66, 0x2D, 0x34, 0x7A, 0x2D, 0x7F, 0xC2, 0x2D, 0xC1, 0xA2, 0x88, 0x7E, 0x3A, 0xA3, 0x98, 0x6E,
+    0xC0, 0x69, 0x6E, 0x7E, 0x6E, 0xA2, 0x87, 0xA2, 0x86, 0x6E, 0x64, 0x68, 0x9B, 0x8A, 0x8C, 0x8D,
+    0xA5, 0x99, 0xAD, 0xA5, 0xA4, 0x86, 0xA3, 0x86, 0x7E, 0xA4, 0x7B, 0xFF, 0x94, 0x6B, 0x98, 0x6F,
+    0xA2, 0x88, 0xC0, 0x69, 0x7F, 0xC0, 0x6E, 0x7B, 0xC6, 0x00, 0xC3, 0x6F, 0xC3, 0x6E, 0xC1, 0x7E,
+    0x6F, 0xA8, 0x68, 0x96, 0x7A, 0x97, 0xA4, 0xFF, 0xCE, 0x6D, 0x9D, 0xA8, 0x87, 0x6E, 0x9A, 0x59,
+    0xB1, 0x98, 0xA2, 0x86, 0x51, 0x55, 0x62, 0x55, 0x6E, 0x6F, 0xC0, 0x26, 0xC0, 0x32, 0x6E, 0x32,
+    0x5A, 0x7F, 0x62, 0x59, 0x66, 0x7A, 0x25, 0x34, 0xC2, 0x2C, 0x25, 0x56, 0xC0, 0x65, 0x6E, 0xC4,
+    0x6E, 0x16, 0x56, 0xC0, 0x16, 0x1D, 0x6E, 0x1D, 0xC0, 0x0E, 0x66, 0x55, 0x66, 0xC0, 0x51, 0x9A,
+    0x88, 0xA8, 0xB8, 0xB9, 0xBA, 0x99, 0x5B, 0x05, 0x9C, 0x68, 0xA2, 0x77, 0x9D, 0x99, 0xA5, 0xC8,
+    0xB4, 0xC6, 0xA1, 0xB6, 0x51, 0x65, 0xC0, 0x56, 0x7F, 0xA2, 0x88, 0xA2, 0x89, 0xA2, 0x88, 0xA2,
+    0x88, 0xA3, 0x99, 0xA3, 0x85, 0x96, 0x73, 0x9D, 0x9A, 0x9D, 0x9C, 0x53, 0xC3, 0x7F, 0x6E, 0x6B,
+    0xC0, 0x51, 0x50, 0x51, 0x66, 0xC0, 0xA3, 0x78, 0x06, 0x21, 0xA2, 0x89, 0x6E, 0xA3, 0x79, 0x47,
+    0x9C, 0x49, 0xA0, 0x59, 0x9C, 0x88, 0xA2, 0x87, 0x67, 0x9E, 0x67, 0x9D, 0x89, 0xC0, 0x9D, 0x88,
+    0xA2, 0x99, 0x15, 0x9C, 0x89, 0x6E, 0x15, 0x6B, 0x9B, 0x88, 0x41, 0x55, 0x62, 0x0E, 0xA5, 0x99,
+    0x9C, 0x89, 0x55, 0xC0, 0x6F, 0x24, 0x9C, 0x98, 0xA4, 0x87, 0x9D, 0xA9, 0x9D, 0x99, 0xA2, 0x88,
+    0x60, 0x62, 0x65, 0x65, 0xA0, 0xA8, 0xAC, 0x98, 0x42, 0x9D, 0x88, 0x5F, 0xA3, 0x58, 0x5F, 0x56,
+    0x56, 0xC0, 0x66, 0xC0, 0x7A, 0xC0, 0x7E, 0xC1, 0xA2, 0x98, 0xA2, 0x88, 0xA2, 0x87, 0x75, 0xA3,
+    0xB7, 0x97, 0x97, 0x95, 0x77, 0xA3, 0x79, 0x7F, 0xA3, 0x88, 0xA2, 0x89, 0x7E, 0xA4, 0x89, 0x95,
+    0xB9, 0x95, 0xA8, 0xA2, 0x88, 0x5F, 0xAA, 0x69, 0xB3, 0x69, 0xA4, 0x97, 0x9F, 0xB5, 0xA9, 0xE2,
+    0x9B, 0xA5, 0x9D, 0x99, 0x9D, 0x8A, 0x9D, 0x7A, 0x9D, 0x8B, 0x56, 0x69, 0xC0, 0x69, 0x59, 0x66,
+    0x99, 0xBE, 0xA2, 0x78, 0xA2, 0x87, 0xC0, 0x65, 0x55, 0x6F, 0xC0, 0xA1, 0x9A, 0xA2, 0x88, 0xA2,
+    0x78, 0xA2, 0x88, 0x7F, 0x6E, 0x7F, 0xA2, 0x77, 0x13, 0xC0, 0x0E, 0x3A, 0x50, 0x55, 0x66, 0x06,
+    0x58, 0xFF, 0xCE, 0x4C, 0x9E, 0x94, 0x8D, 0x9D, 0xA5, 0x79, 0x9F, 0x8D, 0x9D, 0x8A, 0xA2, 0x87,
+    0xAC, 0x97, 0xA2, 0x98, 0xA1, 0x9A, 0x67, 0xC0, 0x56, 0x65, 0xC0, 0x65, 0x51, 0xC0, 0x56, 0x9C,
+    0x87, 0xC1, 0x66, 0x57, 0x65, 0x56, 0xC0, 0x66, 0x65, 0xC1, 0x25, 0xC0, 0x66, 0x25, 0x61, 0xC1,
+    0x5A, 0xA3, 0x98, 0x6B, 0xC0, 0x65, 0x2D, 0x28, 0xA2, 0x88, 0x66, 0x2D, 0x3C, 0x2D, 0xC1, 0x7E,
+    0xA2, 0x88, 0x6E, 0x65, 0xA2, 0x88, 0x6E, 0xC0, 0xA2, 0x77, 0x69, 0x7E, 0xA3, 0x97, 0x05, 0x7E,
+    0x68, 0x68, 0x98, 0x8A, 0x8D, 0x8D, 0xA6, 0x86, 0xA9, 0xA5, 0xA8, 0x86, 0xA4, 0x87, 0x7F, 0x9D,
+    0x6F, 0xFF, 0x6B, 0x8B, 0xA0, 0x8C, 0x6E, 0x69, 0xC0, 0x7F, 0xC1, 0x6F, 0x7A, 0xC4, 0x7E, 0xC0,
+    0x6B, 0xC2, 0x6E, 0xC1, 0x7A, 0x6E, 0xC0, 0x5A, 0xC0, 0x7F, 0x69, 0xA5, 0x79, 0x9D, 0x6A, 0x95,
+    0xA4, 0xFF, 0xDE, 0xB0, 0x9C, 0x97, 0x89, 0x5E, 0x96, 0x58, 0xB1, 0x97, 0x7D, 0x55, 0x09, 0x51,
+    0x55, 0x6F, 0x3A, 0x32, 0x26, 0x32, 0xC1, 0x55, 0x6B, 0x32, 0x2A, 0x66, 0x2A, 0x25, 0xC0, 0x66,
+    0x25, 0x7E, 0x20, 0x25, 0xC0, 0x20, 0x5A, 0x69, 0xC1, 0x6F, 0x16, 0xC1, 0x6E, 0x22, 0x16, 0x5A,
+    0x1D, 0x22, 0xC0, 0x1D, 0x22, 0x1D, 0x51, 0xC0, 0x55, 0xC0, 0x51, 0x9C, 0x88, 0xA2, 0xC9, 0xFF,
+    0xCE, 0x12, 0x9E, 0x4A, 0x8E, 0x5D, 0x9B, 0x79, 0xA4, 0x67, 0x9C, 0x98, 0xA6, 0xB8, 0xAE, 0xC6,
+    0xA5, 0xB6, 0x62, 0x54, 0x55, 0x66, 0x7F, 0x3D, 0xA3, 0x88, 0xA2, 0x89, 0xA2, 0x88, 0xA3, 0x99,
+    0xA0, 0x75, 0x9C, 0x72, 0x9B, 0xAA, 0x9B, 0x9C, 0x67, 0x57, 0x69, 0xA2, 0x88, 0x6F, 0xC0, 0x7F,
+    0x6B, 0x6E, 0x30, 0x50, 0x9D, 0x88, 0x9D, 0x99, 0x56, 0xA3, 0x88, 0xA3, 0x99, 0xA3, 0x89, 0xA2,
+    0x88, 0x7F, 0xA2, 0x78, 0xA2, 0x69, 0x9A, 0x59, 0xA0, 0x59, 0x9A, 0x78, 0x56, 0xA3, 0x98, 0x6F,
+    0x9C, 0x78, 0x55, 0x56, 0x9D, 0x99, 0xA4, 0x88, 0x56, 0x9D, 0x88, 0x15, 0x24, 0x39, 0x9E, 0x68,
+    0x51, 0x61, 0xA2, 0x88, 0xA5, 0x99, 0x9D, 0x89, 0x56, 0x65, 0xA2, 0x78, 0x75, 0x9D, 0x99, 0xA2,
+    0x98, 0xC0, 0x9B, 0x99, 0xA2, 0x98, 0x65, 0x51, 0x65, 0x76, 0x61, 0xA7, 0xA8, 0xA6, 0x99, 0x9B,
+    0x88, 0x9D, 0x79, 0x9D, 0x77, 0x9C, 0x78, 0xA4, 0x79, 0xA8, 0x78, 0xA3, 0x79, 0x56, 0x52, 0xC0,
+    0x7A, 0x6E, 0x7A, 0x6E, 0x7F, 0xA2, 0x98, 0x65, 0xA3, 0xB8, 0x96, 0xA6, 0xA3, 0xA8, 0x9C, 0x66,
+    0x9E, 0x68, 0xA3, 0x89, 0x6E, 0x7F, 0xA4, 0x78, 0xA1, 0xA9, 0x92, 0x99, 0x99, 0xA8, 0xA3, 0x89,
+    0xA2, 0x78, 0xA2, 0x78, 0xB6, 0x59, 0xA5, 0xA8, 0x9F, 0xB5, 0xA8, 0xD2, 0x9C, 0xA4, 0x9D, 0x9A,
+    0x9C, 0x8A, 0x9D, 0x7B, 0x42, 0x52, 0x69, 0xC0, 0x59, 0x69, 0xC0, 0x97, 0xAD, 0x7E, 0xA2, 0x88,
+    0x55, 0x69, 0xC0, 0x6E, 0x7F, 0xA2, 0x88, 0xA2, 0x89, 0x6F, 0xA2, 0x88, 0x7F, 0x6E, 0x7F, 0x6E,
+    0xC0, 0x56, 0xC0, 0x2E, 0x1F, 0x56, 0x0B, 0x56, 0x9F, 0x96, 0xAF, 0x92, 0xA1, 0x92, 0x8D, 0x9D,
+    0xA2, 0x6C, 0xA2, 0x7B, 0x51, 0xA8, 0x95, 0xA6, 0x88, 0xA1, 0xAA, 0x67, 0xC0, 0x7B, 0x55, 0x66,
+    0xC0, 0x55, 0x62, 0x6E, 0x51, 0x9C, 0x88, 0x6E, 0x0B, 0x66, 0x56, 0x9D, 0x89, 0x66, 0xC0, 0x7E,
+    0x65, 0x56, 0xC0, 0x19, 0x6B, 0x19, 0x66, 0xC1, 0x56, 0x65, 0x25, 0x7F, 0xC0, 0x65, 0xC1, 0x34,
+    0x69, 0x28, 0x2D, 0xC0, 0x28, 0x2D, 0x7E, 0xC0, 0x6E, 0xC0, 0xA3, 0x98, 0xA2, 0x78, 0x7D, 0x6E,
+    0xC0, 0x7E, 0xA2, 0x87, 0xA2, 0x87, 0x6E, 0x6C, 0x64, 0x92, 0x8A, 0x92, 0x9C, 0xAE, 0x83, 0xA3,
+    0x95, 0xAA, 0x86, 0xA6, 0x88, 0x9E, 0x6C, 0xFF, 0x94, 0x8B, 0x97, 0x7F, 0xA1, 0x9A, 0x6E, 0x1C,
+    0x21, 0x7A, 0xC0, 0x6E, 0xC0, 0x7F, 0xC3, 0x6E, 0x7A, 0xC0, 0x6B, 0x6E, 0xC2, 0x7A, 0xC0, 0x6E,
+    0xC2, 0x5A, 0xC1, 0xA2, 0x88, 0xA3, 0x69, 0x95, 0xA6, 0xBA, 0xA1, 0x9C, 0xA8, 0x8B, 0x5D, 0x92,
+    0x58, 0xB0, 0x86, 0xA2, 0x86, 0x69, 0x7B, 0x01, 0x55, 0x69, 0x3A, 0x51, 0xC0, 0x32, 0xC0, 0x51,
+    0xC1, 0x6F, 0xC0, 0x66, 0xC2, 0x55, 0x7B, 0x25, 0x20, 0x25, 0x56, 0x16, 0xC2, 0x6F, 0x25, 0xC0,
+    0x22, 0x69, 0xC0, 0x22, 0x16, 0x56, 0x16, 0xC1, 0x1D, 0x22, 0x1D, 0x0E, 0x09, 0x51, 0xC0, 0x55,
+    0x9C, 0x88, 0xA0, 0xC9, 0xFF, 0xC5, 0xD0, 0x9F, 0x5B, 0x90, 0x5D, 0x9C, 0x68, 0xA5, 0x78, 0x61,
+    0xA1, 0xB8, 0xAC, 0xC6, 0xA9, 0xC7, 0x9C, 0x89, 0x50, 0x59, 0x66, 0x6F, 0xA2, 0x88, 0xA2, 0x99,
+    0xA3, 0x88, 0xA2, 0x88, 0xA2, 0x88, 0x9B, 0x86, 0xA4, 0x73, 0x99, 0xAA, 0x99, 0x9D, 0x6B, 0xC1,
+    0x6F, 0x1A, 0xC0, 0x7F, 0x6F, 0x30, 0x35, 0x30, 0x9B, 0x98, 0x9C, 0x88, 0x56, 0xA3, 0x88, 0xA4,
+    0x88, 0x30, 0xA2, 0x78, 0xA1, 0xA9, 0xA2, 0x78, 0xA4, 0x69, 0x9C, 0x68, 0x98, 0x48, 0x9C, 0x6A,
+    0x9D, 0x89, 0x9B, 0x98, 0xA9, 0x89, 0xA6, 0x88, 0x99, 0x89, 0xA2, 0x77, 0x9B, 0x99, 0x5A, 0xA5,
+    0x99, 0x9D, 0x89, 0x7E, 0x7F, 0x9E, 0x67, 0x9D, 0x79, 0x9D, 0x98, 0x62, 0xC0, 0xA7, 0x88, 0x9D,
+    0x99, 0x56, 0x56, 0xA2, 0x87, 0x61, 0x9D, 0x99, 0xA2, 0x88, 0x7F, 0x9B, 0x98, 0x7E, 0x7B, 0x50,
+    0x66, 0x65, 0x75, 0xA1, 0xA9, 0xAA, 0x99, 0x9D, 0x88, 0x40, 0x9D, 0x99, 0x98, 0x88, 0x9B, 0x99,
+    0xA4, 0x67, 0xA5, 0x89, 0xA8, 0x68, 0xA4, 0x78, 0x57, 0x6B, 0xC0, 0x7E, 0xA2, 0x88, 0xA0, 0xA8,
+    0x75, 0xA2, 0x97, 0x9C, 0x97, 0x90, 0xA8, 0xA8, 0x97, 0xAC, 0x67, 0x97, 0x68, 0xA2, 0x78, 0x6F,
+    0xA2, 0x88, 0xA2, 0x89, 0x65, 0x92, 0x99, 0x9B, 0xA8, 0xA3, 0x89, 0xA4, 0x78, 0x9D, 0x89, 0xB4,
+    0x69, 0xAA, 0x87, 0x9D, 0xC5, 0xA8, 0xC2, 0x9D, 0xB5, 0x9D, 0x9A, 0x9B, 0x9B, 0x9E, 0x6A, 0x9D,
+    0x8A, 0x52, 0x5A, 0x69, 0x69, 0x69, 0xC0, 0x96, 0x9B, 0x69, 0xC0, 0x7A, 0x6E, 0xC0, 0x6E, 0x7F,
+    0xA3, 0x88, 0xA3, 0x89, 0xA2, 0x88, 0xA2, 0x88, 0x7F, 0xA2, 0x78, 0x7B, 0x5A, 0xC1, 0x65, 0x52,
+    0x65, 0x55, 0xC0, 0x03, 0x50, 0xAE, 0x91, 0xA2, 0x92, 0x8E, 0x8D, 0x9E, 0x6D, 0xA7, 0x8A, 0x6C,
+    0xA8, 0x96, 0x06, 0xA1, 0x9B, 0x66, 0x6B, 0x66, 0x66, 0xC0, 0x5A, 0x65, 0x66, 0x0C, 0x51, 0x9B,
+    0x89, 0xC0, 0x66, 0x55, 0x9F, 0x9B, 0x9B, 0x98, 0x55, 0xA3, 0x99, 0x7E, 0x51, 0x65, 0xC0, 0x11,
+    0x7E, 0xC0, 0x66, 0x19, 0xC0, 0x11, 0x66, 0xA2, 0x88, 0x7E, 0x20, 0x19, 0x25, 0x28, 0xC0, 0x20,
+    0x19, 0xA2, 0x88, 0xC0, 0x19, 0xA3, 0x89, 0x7E, 0x69, 0xC0, 0x7E, 0xA2, 0x88, 0xA2, 0x78, 0x7E,
+    0xA2, 0x77, 0x65, 0x6E, 0xA2, 0x97, 0xA2, 0x88, 0xA2, 0x76, 0x69, 0x69, 0x8D, 0x9A, 0x9D, 0x98,
+    0xAC, 0x93, 0xA4, 0x85, 0xAA, 0x87, 0xA4, 0x7A, 0x95, 0x6F, 0xFF, 0x6B, 0x8A, 0xA0, 0x8C, 0x6B,
+    0x6E, 0x1C, 0x21, 0x7A, 0xC0, 0x6E, 0xC0, 0x7F, 0xC2, 0x6E, 0x7A, 0xC0, 0x6B, 0xC0, 0x6E, 0xC1,
+    0x7A, 0xC1, 0x6E, 0xC2, 0x5A, 0xC1, 0x6E, 0xA4, 0x79, 0x98, 0x86, 0xB6, 0xB2, 0x9C, 0xA7, 0x8E,
+    0x5C, 0x8F, 0x59, 0xAF, 0x96, 0xA5, 0x86, 0x51, 0xC0, 0x7F, 0x35, 0x59, 0x6B, 0x65, 0x6B, 0xA2,
+    0x88, 0x59, 0x32, 0xC1, 0x51, 0x6B, 0x55, 0xC1, 0x25, 0x16, 0xC0, 0x25, 0xC1, 0x56, 0xC0, 0x25,
+    0x5A, 0x16, 0xC2, 0x22, 0x69, 0x16, 0x56, 0xC0, 0x16, 0xC1, 0x0E, 0xC0, 0x1D, 0xC1, 0x0E, 0x9D,
+    0x99, 0xC0, 0x56, 0x9C, 0x87, 0x9F, 0xCA, 0xFF, 0xBD, 0xD0, 0x9E, 0x6B, 0x90, 0x5D, 0x45, 0xA3,
+    0x78, 0x69, 0xA2, 0xA8, 0xA8, 0xC7, 0xAA, 0xB6, 0x9D, 0x99, 0x9D, 0x98, 0x18, 0x66, 0x22, 0xA2,
+    0x88, 0xA3, 0x89, 0xA2, 0x88, 0xA2, 0x88, 0xC0, 0x97, 0x86, 0xAA, 0x74, 0x99, 0xA9, 0x98, 0x9D,
+    0x5B, 0x69, 0x66, 0x32, 0xA3, 0x99, 0xA2, 0x88, 0xC0, 0x6B, 0xC1, 0x51, 0x9C, 0x88, 0x9C, 0x88,
+    0x66, 0xA3, 0x88, 0xA5, 0x99, 0x30, 0xA4, 0x78, 0x7F, 0x7B, 0xA3, 0x78, 0xA2, 0x68, 0x91, 0x59,
+    0x9B, 0x5B, 0x56, 0x9B, 0x88, 0x9D, 0x98, 0xAC, 0x78, 0x6F, 0x7E, 0x6B, 0x9B, 0x88, 0x6F, 0xA3,
+    0x88, 0x6B, 0xA2, 0x98, 0x45, 0x9C, 0x78, 0x9D, 0x88, 0x9D, 0xA9, 0x56, 0x0A, 0x52, 0x51, 0x5A,
+    0x7E, 0x65, 0x9C, 0x89, 0xA2, 0x98, 0xA2, 0x98, 0x9A, 0x88, 0x6E, 0xA1, 0xA9, 0x51, 0x55, 0x76,
+    0x65, 0x76, 0xA8, 0x98, 0xA2, 0x88, 0x9C, 0x88, 0x50, 0x9B, 0x99, 0x9C, 0x88, 0x7A, 0x41, 0x6E,
+    0xA3, 0x79, 0xA3, 0x89, 0xA4, 0x79, 0x7A, 0x9C, 0x98, 0x14, 0x3E, 0xA6, 0x98, 0x94, 0x88, 0x96,
+    0x97, 0x7E, 0xA3, 0x98, 0xB4, 0x87, 0x99, 0x58, 0x9C, 0x78, 0xA2, 0x88, 0xA3, 0x89, 0xA3, 0x89,
+    0x99, 0x99, 0x96, 0x98, 0x9C, 0xA8, 0xA4, 0x79, 0xA4, 0x78, 0x9A, 0x79, 0xB0, 0x88, 0xAF, 0x88,
+    0x9C, 0xA4, 0xA7, 0xE4, 0x9D, 0xB5, 0x9D, 0x9A, 0x9C, 0x8A, 0x9D, 0x7B, 0x9D, 0x8A, 0x52, 0x59,
+    0xC0, 0x69, 0x69, 0x6E, 0x95, 0xAA, 0xC0, 0x55, 0xC0, 0x7E, 0x6E, 0xC1, 0xA3, 0x99, 0xA4, 0x77,
+    0xA3, 0x9A, 0xA2, 0x88, 0x6F, 0xA2, 0x88, 0x6F, 0xC1, 0x66, 0x65, 0x56, 0x51, 0x69, 0x56, 0x65,
+    0x50, 0xAC, 0x93, 0xA6, 0x83, 0x8C, 0x7D, 0x9E, 0x7C, 0xAC, 0x78, 0x7D, 0xA7, 0xA5, 0x06, 0xA0,
+    0x9A, 0x57, 0x7A, 0x6B, 0x66, 0x20, 0x55, 0x66, 0x6B, 0xC0, 0x9D, 0x89, 0x99, 0x88, 0x6B, 0xC1,
+    0x6B, 0x9B, 0x99, 0x9C, 0x88, 0xA5, 0x98, 0x7E, 0x65, 0x55, 0xC0, 0x11, 0x6E, 0x7A, 0x6B, 0xC0,
+    0x65, 0x11, 0x14, 0x20, 0x19, 0x11, 0x14, 0x20, 0x6E, 0x20, 0x14, 0xC0, 0xA3, 0x88, 0xC0, 0x55,
+    0xA2, 0x98, 0x6E, 0xC1, 0x6E, 0x7E, 0xA2, 0x88, 0xA2, 0x87, 0x6F, 0x69, 0x7F, 0xA2, 0x87, 0xA2,
+    0x87, 0x6E, 0x6D, 0x7D, 0x8E, 0x88, 0xA3, 0x95, 0xA7, 0xA5, 0xA5, 0x86, 0xAB, 0x79, 0x9C, 0x8D,
+    0xFF, 0x7B, 0xE8, 0x9C, 0x7E, 0xA1, 0x9B, 0xC0, 0x21, 0xC1, 0x7A, 0x6E, 0xC1, 0x7F, 0xC2, 0x7E,
+    0x6F, 0x69, 0x67, 0x0C, 0xC2, 0x7A, 0xC0, 0x6E, 0xC5, 0x5A, 0x0C, 0xA6, 0x67, 0x9B, 0x97, 0xB2,
+    0xA3, 0x9D, 0xB7, 0x93, 0x6C, 0x8E, 0x58, 0xA8, 0x76, 0xA9, 0x97, 0x9D, 0x88, 0xC0, 0xA2, 0x88,
+    0x55, 0x56, 0xC2, 0x6E, 0x32, 0xC0, 0x55, 0x6F, 0x61, 0x5A, 0x66, 0xC4, 0x7F, 0x66, 0x16, 0xC1,
+    0x25, 0xC1, 0x1B, 0x6B, 0x16, 0xC0, 0x56, 0x16, 0x5A, 0x16, 0xC0, 0x0E, 0xC0, 0x7F, 0xC3, 0x0E,
+    0x51, 0x66, 0x56, 0x50, 0x9C, 0xB9, 0xFF, 0xB5, 0x8F, 0x9F, 0x7B, 0x90, 0x5C, 0xA3, 0x79, 0x5E,
+    0x7E, 0xA1, 0xA8, 0xA4, 0xA7, 0xAC, 0xD7, 0x51, 0x9D, 0x98, 0x69, 0x56, 0x22, 0xA3, 0x88, 0x16,
+    0xA2, 0x88, 0xA5, 0x88, 0x97, 0x88, 0x9A, 0x86, 0xAD, 0x85, 0x9A, 0x98, 0x97, 0x9D, 0x57, 0x7A,
+    0x55, 0x23, 0xA3, 0x99, 0xA2, 0x88, 0x7F, 0x67, 0xC0, 0x69, 0x51, 0x9B, 0x89, 0x51, 0x55, 0x0C,
+    0xA5, 0x88, 0xA5, 0x99, 0xA4, 0x88, 0xA2, 0x88, 0x6B, 0x6F, 0xA4, 0x77, 0x98, 0x59, 0x92, 0x3A,
+    0x46, 0xC0, 0x9A, 0x77, 0xA3, 0x99, 0xA5, 0x99, 0x6E, 0xA4, 0x89, 0x51, 0x9C, 0x78, 0xC0, 0xA5,
+    0x88, 0xA4, 0x98, 0x5E, 0x9C, 0x78, 0x9B, 0x99, 0x9D, 0x99, 0x51, 0xA5, 0x89, 0xC0, 0x41, 0x56,
+    0xC0, 0x65, 0x9C, 0x98, 0xA3, 0x89, 0xA3, 0x99, 0x9A, 0x98, 0x66, 0xA3, 0x88, 0x61, 0x51, 0xC0,
+    0x75, 0x66, 0xA3, 0xA8, 0xA6, 0x88, 0x9D, 0x98, 0x9D, 0x98, 0x52, 0x9B, 0x98, 0x6F, 0xC0, 0x61,
+    0x9D, 0x89, 0x51, 0xA3, 0x88, 0x7A, 0x9D, 0x98, 0x52, 0xA5, 0x98, 0xA3, 0x98, 0x9A, 0x88, 0xA4,
+    0x88, 0xA3, 0x88, 0x7F, 0xAD, 0x98, 0xA8, 0x56, 0x93, 0x78, 0xA4, 0x78, 0xA2, 0x89, 0xA2, 0x88,
+    0x96, 0x99, 0x9B, 0x98, 0x9C, 0x99, 0xA5, 0x88, 0xA4, 0x68, 0x9A, 0x89, 0xA7, 0x99, 0xB4, 0x78,
+    0x9D, 0xC5, 0xA6, 0xC3, 0x9D, 0xC7, 0x9D, 0x99, 0x9C, 0x7A, 0x9D, 0x8A, 0x42, 0x52, 0x5A, 0x66,
+    0x69, 0x69, 0x6E, 0x96, 0x99, 0xC0, 0x69, 0x69, 0x66, 0xC1, 0x0F, 0xA2, 0x88, 0xA3, 0x88, 0xA4,
+    0x89, 0xA3, 0x88, 0x7F, 0xA2, 0x88, 0xA1, 0x8A, 0xC2, 0x55, 0x61, 0x55, 0x66, 0x59, 0x37, 0x51,
+    0xA8, 0x94, 0xAB, 0x75, 0x89, 0x7D, 0xA0, 0x8B, 0xB1, 0x87, 0x9E, 0xA6, 0xA5, 0x96, 0x65, 0x7B,
+    0x6B, 0x6B, 0xC0, 0x66, 0xC0, 0x51, 0xC1, 0x56, 0x9C, 0x88, 0x99, 0x8A, 0xA2, 0x89, 0x06, 0xC0,
+    0x6B, 0x39, 0x9A, 0x97, 0x69, 0xA2, 0x98, 0x7E, 0x09, 0x11, 0xC0, 0x66, 0x11, 0x7F, 0xC1, 0x5A,
+    0x11, 0xC3, 0x7A, 0x20, 0xC0, 0x69, 0xC1, 0x7F, 0xC0, 0x6E, 0x6D, 0x7E, 0xC0, 0x6E, 0x7F, 0xA2,
+    0x88, 0xA2, 0x77, 0x7F, 0xC0, 0xA2, 0x87, 0x7F, 0xA2, 0x87, 0x6E, 0x6C, 0x69, 0x92, 0x95, 0xA6,
+    0x95, 0xA2, 0x96, 0xA7, 0x87, 0xA9, 0x6A, 0xFF, 0xA4, 0xE9, 0xFF, 0x5B, 0x2B, 0xA3, 0x8B, 0xC0,
+    0x7E, 0xC2, 0x7A, 0x6E, 0xC0, 0x6B, 0x7E, 0xC1, 0x6E, 0x00, 0x05, 0x6B, 0xC3, 0x7A, 0x6E, 0xC7,
+    0x5A, 0x0C, 0xA5, 0x77, 0x9D, 0x97, 0xAF, 0xA4, 0xA1, 0xA7, 0x96, 0x6B, 0x97, 0x78, 0x97, 0x87,
+    0xAC, 0x77, 0x41, 0x65, 0x6E, 0xC0, 0x55, 0x6B, 0x3A, 0xC0, 0x32, 0x55, 0xC3, 0x66, 0x5A, 0x66,
+    0x1E, 0x16, 0x1B, 0x16, 0x7F, 0x51, 0xC0, 0xA2, 0x78, 0x66, 0x16, 0xC0, 0x25, 0x16, 0x25, 0x16,
+    0xC2, 0x5A, 0x1B, 0xC0, 0x22, 0x16, 0xC1, 0x22, 0x1D, 0xC0, 0x55, 0x66, 0x51, 0x55, 0x66, 0x9B,
+    0xB9, 0xB8, 0xB8, 0xA2, 0x6A, 0x90, 0x6C, 0xA2, 0x68, 0x6F, 0x6E, 0xA1, 0xA8, 0xA0, 0xA8, 0xAE,
+    0xB7, 0xA0, 0xA7, 0x9D, 0x97, 0x69, 0x57, 0x7F, 0xA3, 0x88, 0xA3, 0x99, 0xA3, 0x89, 0x54, 0x91,
+    0x78, 0xA7, 0x97, 0xA9, 0x96, 0x9C, 0x87, 0x95, 0x9D, 0x1C, 0xC1, 0x56, 0x66, 0xA2, 0x89, 0xA3,
+    0x99, 0xC1, 0x65, 0x52, 0x9D, 0x88, 0x65, 0xC0, 0x56, 0x11, 0xA6, 0x98, 0xA6, 0x79, 0xA3, 0x88,
+    0x7B, 0x7F, 0xA2, 0x77, 0xA2, 0x58, 0x8E, 0x5A, 0x9A, 0x49, 0x6F, 0x40, 0xC0, 0xA5, 0x99, 0x9C,
+    0x88, 0xC0, 0xA4, 0x78, 0x52, 0x55, 0x3C, 0x7E, 0xA3, 0x88, 0xA3, 0x89, 0x56, 0x9C, 0x88, 0x9D,
+    0x89, 0xA2, 0x88, 0xA2, 0x88, 0x9D, 0x89, 0x55, 0x6B, 0x61, 0x9C, 0x88, 0xA3, 0x88, 0xA3, 0x99,
+    0x9D, 0x98, 0x9B, 0x99, 0xA3, 0x99, 0x5A, 0x51, 0x75, 0x66, 0x75, 0x7E, 0xA6, 0x88, 0xC0, 0x9D,
+    0x98, 0x3F, 0x9D, 0x88, 0x9D, 0xA9, 0x6B, 0xC1, 0x50, 0xC0, 0xA2, 0x98, 0xC0, 0x61, 0x66, 0x38,
+    0xC0, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0xA4, 0x98, 0xB1, 0x86, 0x96, 0x57, 0x5B, 0xA2, 0x89, 0x66,
+    0x97, 0x88, 0x61, 0x9B, 0x99, 0xA7, 0x79, 0xA3, 0x79, 0x9A, 0x88, 0xA2, 0x98, 0xB6, 0x88, 0xA0,
+    0xA6, 0xA2, 0xE3, 0x9D, 0xB7, 0x52, 0x9D, 0x8A, 0x9D, 0x8A, 0x52, 0x46, 0x56, 0x00, 0x69, 0xC1,
+    0x9A, 0x87, 0x51, 0xC0, 0x69, 0xC1, 0x61, 0xC0, 0xA2, 0x77, 0x7F, 0xA4, 0x88, 0xA4, 0x88, 0xA2,
+    0x79, 0xA2, 0x88, 0x7F, 0xC1, 0x5A, 0x66, 0x55, 0x61, 0x5A, 0x65, 0xC0, 0x65, 0x7D, 0xB2, 0x66,
+    0x8B, 0x6C, 0xA2, 0x89, 0xAD, 0x97, 0x9C, 0xA6, 0xA5, 0xA5, 0xC0, 0x7F, 0xA0, 0x9A, 0xC0, 0x5A,
+    0x65, 0x66, 0x51, 0x6B, 0xC0, 0x52, 0x0F, 0x41, 0xA1, 0x9A, 0x5A, 0xC0, 0x6B, 0x7A, 0x9D, 0x88,
+    0x9B, 0x98, 0xA2, 0x97, 0x7F, 0x65, 0x1D, 0x61, 0x5A, 0x11, 0xC3, 0x0C, 0x55, 0x11, 0xC0, 0x0C,
+    0xC0, 0x7E, 0x6F, 0xC0, 0x14, 0x9D, 0x88, 0xA2, 0x88, 0x11, 0xA2, 0x87, 0x7E, 0x6E, 0x7F, 0x6E,
+    0x7E, 0xA2, 0x88, 0xA2, 0x77, 0x7F, 0xC0, 0xA2, 0x88, 0x7E, 0xA2, 0x88, 0xA2, 0x77, 0x7C, 0x9F,
+    0x96, 0x96, 0x94, 0xA4, 0x87, 0x9D, 0xA8, 0xB1, 0x67, 0x98, 0x7D, 0xFF, 0x6B, 0x89, 0x9F, 0x8E,
+    0x6F, 0xC0, 0x7E, 0xC3, 0x7E, 0xC0, 0x6B, 0x7E, 0xC1, 0x00, 0xC0, 0x6E, 0x6B, 0xC1, 0x7A, 0x6E,
+    0xC1, 0x6B, 0xC1, 0x14, 0xC3, 0x5A, 0x0C, 0xA4, 0x77, 0x17, 0xAD, 0x94, 0xA4, 0xA6, 0x95, 0x8B,
+    0x99, 0x78, 0x97, 0x78, 0xAA, 0x66, 0x6E, 0x9D, 0x99, 0x9D, 0x99, 0xA2, 0x77, 0x55, 0x6B, 0xC2,
+    0x66, 0x5A, 0x6E, 0x2A, 0x65, 0xC0, 0x56, 0xC1, 0x6E, 0xC0, 0x16, 0x66, 0xC0, 0x16, 0xC0, 0x1B,
+    0x6B, 0x16, 0xC3, 0x1B, 0x16, 0xC1, 0x1B, 0x16, 0x22, 0x16, 0xC0, 0x6B, 0x22, 0x1D, 0x55, 0xC0,
+    0x66, 0x51, 0x55, 0x66, 0x9A, 0xA8, 0xB7, 0xC9, 0xA3, 0x7B, 0x93, 0x6C, 0x4F, 0x6E, 0x1F, 0xA2,
+    0x97, 0x9C, 0x98, 0xAB, 0xB8, 0xA9, 0xC7, 0x9C, 0x87, 0x65, 0x13, 0x7F, 0xA3, 0x88, 0xA3, 0x99,
+    0xA3, 0x88, 0x96, 0x77, 0x99, 0x88, 0xAC, 0x87, 0xA3, 0x96, 0x9D, 0x98, 0x98, 0x8C, 0xC0, 0x56,
+    0x66, 0x52, 0xC0, 0x7F, 0xA2, 0x88, 0xC0, 0x52, 0x1E, 0x66, 0x51, 0x69, 0x6E, 0x52, 0x69, 0x19,
+    0xA7, 0x89, 0xA5, 0x89, 0xA3, 0x98, 0x7B, 0x6F, 0xA3, 0x78, 0x9A, 0x59, 0x8F, 0x4A, 0x9F, 0x69,
+    0x6E, 0x9D, 0x89, 0x7E, 0xA3, 0xA9, 0x0D, 0xA4, 0x88, 0x7B, 0x41, 0xC0, 0x9C, 0x87, 0xC0, 0x35,
+    0xA7, 0x99, 0x6F, 0x9A, 0x79, 0x55, 0xA3, 0x88, 0x51, 0x52, 0x66, 0xC0, 0x9A, 0x88, 0xA2, 0x88,
+    0xA2, 0x98, 0x6F, 0x9A, 0x87, 0xA2, 0x88, 0x10, 0x9D, 0x99, 0x75, 0xC0, 0x65, 0x76, 0xA5, 0x98,
+    0xA2, 0x88, 0x9D, 0x99, 0x55, 0x66, 0x9B, 0x99, 0x7E, 0x6F, 0x7A, 0x12, 0x51, 0x12, 0xA1, 0xA9,
+    0x65, 0xC1, 0x66, 0x24, 0x7E, 0x7F, 0x6D, 0xAA, 0x97, 0x9B, 0x67, 0xA5, 0x78, 0xA3, 0x8A, 0x9B,
+    0x99, 0x99, 0x88, 0x66, 0x9B, 0x99, 0xA9, 0x79, 0x5F, 0x9B, 0x98, 0x66, 0xB5, 0x98, 0xA3, 0xB6,
+    0xA0, 0xD4, 0x9C, 0xA8, 0x66, 0x52, 0x41, 0x52, 0x52, 0x55, 0x56, 0x7A, 0xC0, 0x6D, 0x56, 0x9D,
+    0x88, 0x9B, 0x98, 0x59, 0x7F, 0xC0, 0x75, 0x55, 0xC0, 0x7A, 0xA3, 0x79, 0xA4, 0x88, 0xA3, 0x98,
+    0xA2, 0x78, 0x7F, 0x6F, 0xC0, 0x66, 0x56, 0x06, 0x56, 0x69, 0xC0, 0x66, 0x59, 0x7A, 0xB0, 0x69,
+    0x8F, 0x59, 0xA4, 0xA8, 0xA9, 0xA6, 0x9D, 0x97, 0xA5, 0xA5, 0xC0, 0xA1, 0x9A, 0x6B, 0x23, 0x66,
+    0x51, 0x69, 0x52, 0xA1, 0x9A, 0x66, 0x9D, 0x89, 0x9C, 0x78, 0x66, 0xA1, 0x8A, 0x06, 0x6E, 0xA1,
+    0x8A, 0x61, 0x01, 0x9B, 0x98, 0x7E, 0x7E, 0x65, 0x1D, 0x11, 0xC3, 0x66, 0x55, 0x0C, 0xC1, 0x11,
+    0x0C, 0x69, 0x0C, 0x11, 0xC0, 0x05, 0x3D, 0x7A, 0xC0, 0xA3, 0x88, 0xA2, 0x87, 0xC0, 0x6E, 0x7F,
+    0xA3, 0x87, 0xA2, 0x88, 0x6F, 0xC0, 0x34, 0xA3, 0x88, 0x7F, 0xA2, 0x88, 0x6D, 0x7D, 0x68, 0x9B,
+    0xA4, 0x96, 0x9A, 0xA9, 0x76, 0xAC, 0x69, 0xFF, 0x84, 0x08, 0xFF, 0x63, 0x2C, 0xA2, 0x79, 0x6F,
+    0x6E, 0xC0, 0x7A, 0xC2, 0x7E, 0x6B, 0xC0, 0x7A, 0x6E, 0xC0, 0x7E, 0xC0, 0x6E, 0x6B, 0xC1, 0x7A,
+    0x6E, 0xC1, 0x6B, 0xC0, 0x6E, 0x14, 0xC3, 0x5A, 0xC0, 0xA2, 0x87, 0xA3, 0x88, 0xA6, 0x95, 0xAA,
+    0xA4, 0x36, 0x9B, 0x87, 0x96, 0x68, 0xA8, 0x68, 0x6E, 0x51, 0x51, 0x5A, 0x65, 0xC0, 0x32, 0xC1,
+    0x51, 0x6E, 0x6B, 0x66, 0x59, 0x65, 0xC1, 0x6B, 0x1B, 0x16, 0x65, 0x56, 0x16, 0x66, 0x59, 0x16,
+    0xC0, 0x1B, 0xC0, 0x16, 0xC0, 0x11, 0x16, 0x07, 0x16, 0xC0, 0x1B, 0x16, 0xC2, 0x6F, 0xC0, 0x66,
+    0x55, 0x66, 0x56, 0x65, 0x55, 0x51, 0x9A, 0xB9, 0xB6, 0xB8, 0xA5, 0x7A, 0x94, 0x6D, 0x4E, 0xC0,
+    0x6F, 0x7E, 0x9D, 0x98, 0x9D, 0xC8, 0xAD, 0xC7, 0xA6, 0x86, 0x51, 0x66, 0x6F, 0xA2, 0x88, 0xA4,
+    0x88, 0x9D, 0x88, 0x0B, 0x5A, 0xAE, 0x88, 0x9F, 0xA6, 0x9D, 0x98, 0x9C, 0x8A, 0x57, 0x6B, 0x66,
+    0x66, 0x06, 0x55, 0x66, 0x5A, 0x51, 0x65, 0x65, 0x55, 0x66, 0x34, 0x65, 0x5A, 0x6E, 0xA2, 0x89,
+    0xA6, 0x99, 0xA6, 0x88, 0xA4, 0x88, 0x6F, 0x77, 0xA4, 0x58, 0x90, 0x4A, 0x96, 0x49, 0xA2, 0x79,
+    0x69, 0x9A, 0x88, 0xA8, 0x99, 0x30, 0x9D, 0x88, 0xA6, 0x99, 0x30, 0x56, 0x55, 0x51, 0x55, 0x7E,
+    0xAA, 0x89, 0xA2, 0x99, 0x9D, 0x89, 0x59, 0x65, 0x52, 0x46, 0x7A, 0x9A, 0x88, 0x6E, 0xA2, 0x88,
+    0x00, 0x04, 0x5A, 0xA2, 0x88, 0x01, 0x61, 0x76, 0xC0, 0x71, 0xA2, 0x88, 0xA5, 0x89, 0x9D, 0x99,
+    0x55, 0x7A, 0x9C, 0x88, 0x61, 0xA2, 0x88, 0x7F, 0x59, 0xC0, 0x61, 0x7F, 0x7A, 0xC0, 0x6B, 0x24,
+    0x6F, 0x7F, 0x6E, 0xA2, 0x87, 0xA6, 0x97, 0x94, 0x86, 0x59, 0xB0, 0x79, 0x9C, 0x78, 0x9B, 0x8A,
+    0x56, 0x9B, 0x99, 0xA8, 0x78, 0x5F, 0x9C, 0x97, 0x9D, 0x89, 0xB0, 0x98, 0xA8, 0xB6, 0x9F, 0xE6,
+    0x9C, 0xA6, 0x66, 0x5A, 0x42, 0x9D, 0x99, 0x52, 0x55, 0x66, 0xC0, 0x08, 0xC0, 0xA6, 0x78, 0x50,
+    0x9A, 0x88, 0x9B, 0x88, 0x65, 0xC1, 0x7A, 0x65, 0x55, 0x7B, 0xA3, 0x88, 0xA4, 0x78, 0xA2, 0x88,
+    0xA2, 0x88, 0x6B, 0x6E, 0x06, 0x56, 0xC0, 0x65, 0xC0, 0x6E, 0x56, 0x69, 0xC0, 0xAC, 0x79, 0x91,
+    0x59, 0xA8, 0xA8, 0xA7, 0xA6, 0x9D, 0x97, 0xA5, 0xA5, 0xC0, 0x7B, 0x6B, 0xC0, 0x50, 0x55, 0x66,
+    0xC0, 0xA1, 0x9A, 0x56, 0x9C, 0x89, 0x9B, 0x99, 0x6F, 0x1A, 0x37, 0x56, 0xA3, 0x99, 0x3E, 0x32,
+    0x9C, 0x88, 0x75, 0x7E, 0x7A, 0x09, 0x7E, 0xC2, 0x0C, 0xC4, 0x11, 0xC1, 0x0C, 0x66, 0x69, 0xC0,
+    0x0C, 0x69, 0x00, 0x05, 0xA2, 0x77, 0xC0, 0x7E, 0xC0, 0xA3, 0x88, 0xA5, 0x98, 0x2C, 0xC0, 0x7E,
+    0xA3, 0x89, 0x7E, 0xA2, 0x88, 0xA2, 0x87, 0x6E, 0x7C, 0x97, 0x96, 0x93, 0xA9, 0xB9, 0x67, 0x8E,
+    0x7F, 0x94, 0x7E, 0xA3, 0x7B, 0x6D, 0xC0, 0x6F, 0xC0, 0x7A, 0xC2, 0x7E, 0x6B, 0xC0, 0x7A, 0x6E,
+    0xC0, 0x7E, 0xC0, 0x6E, 0xC0, 0x6B, 0xC1, 0x7A, 0x6E, 0xC0, 0x6B, 0xC1, 0x14, 0xC3, 0x5A, 0xC0,
+    0x7E, 0xA6, 0x77, 0x9D, 0x97, 0xB1, 0xA3, 0x95, 0xA9, 0x9A, 0x77, 0x97, 0x79, 0xA3, 0x68, 0xA4,
+    0x78, 0x55, 0x52, 0x69, 0x55, 0x52, 0xA2, 0x88, 0xC0, 0x65, 0x6B, 0x32, 0x55, 0xC0, 0x1E, 0x55,
+    0x6F, 0xC3, 0x0F, 0x67, 0x6E, 0x0F, 0xC0, 0x16, 0xC1, 0x11, 0x16, 0x11, 0xC0, 0x59, 0x16, 0xC2,
+    0x1B, 0x16, 0xC0, 0x5A, 0xC0, 0x66, 0xC1, 0x66, 0x35, 0xC0, 0x55, 0x51, 0x9B, 0xB9, 0xB3, 0xC8,
+    0xA7, 0x7C, 0x94, 0x6C, 0x4E, 0x6F, 0x7A, 0x6E, 0x9B, 0x99, 0x98, 0xB6, 0xB3, 0xC7, 0xA9, 0x98,
+    0x9D, 0x98, 0x56, 0x7F, 0x0F, 0xA3, 0x88, 0x95, 0x87, 0x9D, 0x78, 0x6F, 0xAD, 0x98, 0x9E, 0x95,
+    0x61, 0x52, 0x57, 0xA1, 0x8A, 0x7F, 0x67, 0x51, 0x52, 0xC0, 0x55, 0x9D, 0x88, 0x9D, 0x98, 0x55,
+    0x65, 0xC0, 0x65, 0x6E, 0xC1, 0x6E, 0xA2, 0x88, 0xA5, 0x89, 0xA6, 0x88, 0xA3, 0x9A, 0xA2, 0x88,
+    0xA2, 0x8A, 0x9C, 0x6A, 0x8E, 0x39, 0xA0, 0x49, 0xA3, 0x99, 0x99, 0x99, 0xA2, 0x88, 0xA4, 0x88,
+    0x9B, 0x88, 0xA4, 0x88, 0x09, 0x35, 0x51, 0x45, 0x51, 0x51, 0x7F, 0xA4, 0x99, 0xA3, 0x88, 0xA5,
+    0x99, 0x55, 0x52, 0x55, 0x6B, 0x9B, 0x88, 0x56, 0x7B, 0xA5, 0x88, 0x9D, 0x88, 0x9B, 0x99, 0x15,
+    0x66, 0x3C, 0x65, 0x76, 0x66, 0x7F, 0xA3, 0x98, 0x66, 0x55, 0x6B, 0x60, 0x9C, 0x88, 0xA2, 0x98,
+    0x6F, 0xC0, 0x2F, 0x1E, 0x66, 0xA3, 0x99, 0xC0, 0x65, 0xC0, 0x3C, 0xC0, 0x6F, 0xA2, 0x87, 0xA6,
+    0x86, 0x9B, 0xB7, 0x89, 0xA9, 0xA7, 0x78, 0xB1, 0x68, 0x5F, 0x9D, 0x8A, 0x9D, 0x99, 0xA8, 0x68,
+    0x56, 0x61, 0x9D, 0x88, 0xAC, 0x98, 0xAA, 0xB6, 0x9E, 0xD5, 0x9C, 0x97, 0x7A, 0xC0, 0x53, 0x41,
+    0x51, 0x51, 0xC3, 0xAA, 0x78, 0x55, 0x9C, 0x88, 0x05, 0x99, 0x88, 0x65, 0xC0, 0x79, 0x69, 0x66,
+    0x66, 0x1E, 0x2A, 0xA3, 0x99, 0xA3, 0x88, 0x6F, 0x6E, 0xC0, 0x32, 0x56, 0xC1, 0x69, 0xC2, 0x0B,
+    0x93, 0x59, 0xAC, 0xA7, 0xA3, 0xA7, 0x9F, 0x96, 0xA4, 0x95, 0x65, 0x67, 0x7F, 0x56, 0x64, 0x55,
+    0x66, 0x6F, 0x7F, 0x52, 0x9D, 0x99, 0x9C, 0x79, 0x5B, 0xA1, 0x9A, 0x32, 0x9D, 0x89, 0xA3, 0x89,
+    0x7A, 0x2A, 0x9C, 0x97, 0x51, 0xA1, 0xA8, 0x7E, 0xC0, 0x7F, 0xC0, 0x66, 0x5A, 0x07, 0x04, 0x0C,
+    0xC3, 0x6F, 0x0C, 0xC0, 0x04, 0xC0, 0x0C, 0x6E, 0xC1, 0x3D, 0x69, 0x6E, 0x6E, 0x61, 0x00, 0xA9,
+    0x98, 0xA2, 0x88, 0xC0, 0xA2, 0x88, 0xA3, 0x88, 0x7E, 0xA2, 0x88, 0x7F, 0xA2, 0x77, 0x79, 0x88,
+    0x86, 0xB1, 0x98, 0x9D, 0x7C, 0x8E, 0x6F, 0xA3, 0x8A, 0x6E, 0x6E, 0xC0, 0x6B, 0x6E, 0xC0, 0x7A,
+    0xC1, 0x7A, 0x6E, 0x6F, 0x7A, 0xC1, 0x7E, 0x05, 0xC0, 0x6B, 0xC2, 0x7A, 0xC1, 0x6E, 0x6B, 0xC1,
+    0x14, 0xC2, 0x5A, 0xC1, 0xA9, 0x98, 0x96, 0x76, 0xB0, 0xA4, 0xA0, 0x95, 0x97, 0x99, 0x99, 0x78,
+    0x9C, 0x58, 0xA6, 0x68, 0xC0, 0x9D, 0x99, 0x6E, 0x56, 0x51, 0xA2, 0x87, 0x6F, 0x61, 0x5A, 0x32,
+    0x59, 0x23, 0x56, 0xC0, 0x66, 0x69, 0xC0, 0x16, 0x1B, 0x0F, 0xC0, 0x16, 0x0F, 0x16, 0xC2, 0x55,
+    0x7B, 0xC0, 0x16, 0xC2, 0x11, 0x16, 0xC0, 0x56, 0x13, 0xC0, 0x0E, 0xC2, 0x65, 0x56, 0x66, 0x55,
+    0x51, 0x9B, 0xB9, 0xB1, 0xC9, 0xA9, 0x7B, 0x94, 0x6C, 0x4E, 0xC0, 0x7F, 0x66, 0x94, 0x87, 0xA7,
+    0xC7, 0xB7, 0xB7, 0x64, 0x56, 0x66, 0x7E, 0xA3, 0x89, 0x08, 0x94, 0x66, 0x6E, 0xA3, 0x89, 0xA6,
+    0x98, 0x7C, 0x79, 0x57, 0xA1, 0x8A, 0xA2, 0x8A, 0x1B, 0xC0, 0x56, 0x52, 0x66, 0x59, 0x9D, 0x98,
+    0x9B, 0x87, 0x9D, 0x87, 0x65, 0x5A, 0x65, 0x69, 0xC1, 0x6F, 0x7E, 0xA2, 0x87, 0xA3, 0x89, 0xA2,
+    0x99, 0xA4, 0x89, 0xA3, 0x8A, 0xA2, 0x8A, 0x98, 0x49, 0x95, 0x3C, 0xA3, 0x89, 0x9D, 0x89, 0x9C,
+    0x98, 0xA6, 0x88, 0x51, 0x9D, 0x88, 0xA6, 0x99, 0x5A, 0x2D, 0x55, 0x55, 0x52, 0x65, 0x66, 0xA2,
+    0x99, 0x2D, 0xA5, 0x99, 0xA3, 0x88, 0x9C, 0x99, 0x13, 0x42, 0x51, 0x42, 0xA3, 0x78, 0xA2, 0x88,
+    0x9A, 0x98, 0xC0, 0xA2, 0x88, 0x9C, 0x89, 0x65, 0xC0, 0x76, 0xC0, 0x7F, 0x7E, 0xC0, 0x65, 0xC0,
+    0x9B, 0x99, 0x7F, 0x7E, 0xC2, 0x51, 0x2A, 0x7F, 0xC1, 0x6E, 0x6B, 0x7E, 0xA2, 0x78, 0xA2, 0x97,
+    0xA5, 0xA6, 0x88, 0xC8, 0x45, 0xA5, 0x79, 0xA5, 0x6A, 0xA7, 0x88, 0x6F, 0xA4, 0x68, 0x5A, 0x32,
+    0x9A, 0x98, 0xAC, 0x88, 0xAA, 0xB5, 0x9E, 0xC6, 0x9C, 0xA8, 0x79, 0x6B, 0x56, 0x51, 0x1C, 0x51,
+    0x7A, 0x08, 0xC1, 0xAE, 0x78, 0x51, 0x9D, 0x98, 0x9C, 0x89, 0x98, 0x88, 0x9B, 0x88, 0xC0, 0x79,
+    0x69, 0x69, 0x66, 0x66, 0x5A, 0x19, 0xA4, 0x78, 0xA2, 0x88, 0x6F, 0xC6, 0x6E, 0x5A, 0xA8, 0x79,
+    0x96, 0x69, 0xAD, 0xA7, 0xA1, 0xA7, 0x78, 0xA3, 0x94, 0x61, 0x9F, 0x9B, 0xA2, 0x87, 0x56, 0x55,
+    0x65, 0x66, 0xA2, 0x88, 0x3E, 0x56, 0x51, 0x9A, 0x8A, 0x9D, 0x89, 0x6B, 0x1E, 0x56, 0x7F, 0xA2,
+    0x78, 0x25, 0x9D, 0x87, 0x2A, 0xA2, 0x97, 0xC1, 0x7A, 0x6F, 0x3D, 0xC0, 0x6B, 0x09, 0x7A, 0x04,
+    0x66, 0xC0, 0x04, 0x7F, 0x04, 0x7A, 0x04, 0x0C, 0xC0, 0x6E, 0xC0, 0x5A, 0x55, 0x65, 0xA2, 0x88,
+    0x6E, 0x9C, 0x89, 0x9C, 0x88, 0xAF, 0x87, 0xA3, 0x99, 0x7E, 0xA3, 0x98, 0xA2, 0x88, 0xA2, 0x77,
+    0x7F, 0x7E, 0xA3, 0x88, 0x95, 0x97, 0x95, 0x99, 0xAF, 0x9B, 0x8A, 0x5D, 0xA1, 0x7A, 0xA2, 0x78,
+    0xC0, 0x7A, 0x6E, 0xC0, 0x6F, 0xC0, 0x7A, 0xC1, 0x7A, 0x6E, 0x6B, 0x7E, 0xC0, 0x6E, 0xC0, 0x7A,
+    0x6E, 0x6B, 0xC2, 0x7A, 0x6E, 0xC1, 0x6B, 0x6E, 0x1B, 0x14, 0xC3, 0x5A, 0x05, 0xA9, 0x89, 0x97,
+    0x87, 0xA8, 0x95, 0xAC, 0xA4, 0x96, 0x97, 0x9A, 0x77, 0x97, 0x69, 0x4F, 0xA6, 0x78, 0x66, 0x55,
+    0x51, 0x5A, 0x7F, 0xC0, 0x69, 0x23, 0x2B, 0x5A, 0x55, 0x23, 0x51, 0x66, 0xC0, 0x5A, 0x0A, 0x6F,
+    0x0A, 0x07, 0x0F, 0x16, 0xC2, 0x66, 0x16, 0x11, 0xC2, 0x5A, 0x16, 0x11, 0x0E, 0xC4, 0x55, 0x0E,
+    0xC0, 0x3F, 0xC0, 0x66, 0x66, 0x51, 0x99, 0xA8, 0xB0, 0xC9, 0xAB, 0x7B, 0x95, 0x6C, 0x5E, 0x27,
+    0x7F, 0x9A, 0x88, 0x97, 0xC7, 0xFF, 0xBD, 0x92, 0xA6, 0x97, 0x9D, 0x88, 0xC0, 0xA2, 0x88, 0xA2,
+    0x89, 0xA2, 0x88, 0x98, 0x76, 0x97, 0x88, 0xA3, 0x88, 0xA2, 0x88, 0xA3, 0x88, 0xA4, 0x95, 0x7A,
+    0x57, 0xA1, 0x8A, 0xA3, 0x8A, 0xA1, 0x9B, 0x6B, 0x66, 0x51, 0x66, 0x59, 0x50, 0x9A, 0x87, 0x9C,
+    0x87, 0x54, 0x59, 0x65, 0x6E, 0x12, 0xC0, 0x17, 0x7E, 0xA2, 0x87, 0xA2, 0x88, 0xC0, 0xA2, 0x89,
+    0xA2, 0x89, 0xA2, 0x99, 0xA3, 0x7B, 0x95, 0x3C, 0x99, 0x6C, 0xA2, 0x79, 0x9D, 0x99, 0xA2, 0x77,
+    0xA2, 0x87, 0x9C, 0x88, 0xA2, 0x99, 0xA5, 0x89, 0x9D, 0x88, 0x41, 0x55, 0x61, 0xC0, 0x52, 0xA3,
+    0x98, 0x51, 0x3D, 0xA1, 0xA8, 0x75, 0x99, 0x99, 0x9C, 0xA8, 0xAB, 0x88, 0xA4, 0x5A, 0x9F, 0x69,
+    0xA2, 0x89, 0x69, 0x9C, 0x88, 0xA2, 0x89, 0x9D, 0x99, 0x51, 0xC1, 0x7A, 0x7E, 0x6E, 0x76, 0xC0,
+    0x56, 0x60, 0x9D, 0x99, 0xA2, 0x88, 0xC2, 0x7A, 0x27, 0x7B, 0x7E, 0x5A, 0x6F, 0x6E, 0x7F, 0x6E,
+    0xA1, 0xA8, 0xA8, 0x96, 0x92, 0xB7, 0x98, 0x98, 0xA9, 0x6A, 0x5F, 0xC0, 0xA7, 0x79, 0xA2, 0x67,
+    0x5A, 0x66, 0x9B, 0x98, 0xA9, 0x98, 0xA9, 0xD6, 0x9D, 0xC6, 0x7A, 0x7A, 0x56, 0x62, 0x55, 0x52,
+    0x65, 0x56, 0xC2, 0xB0, 0x77, 0x51, 0x9D, 0x89, 0x9C, 0x89, 0x9B, 0x98, 0x97, 0x88, 0x51, 0x69,
+    0x79, 0x66, 0x69, 0x56, 0xC0, 0x66, 0x16, 0xA3, 0x89, 0x7E, 0x6F, 0xA2, 0x88, 0xC0, 0x66, 0xC1,
+    0x1E, 0xC0, 0x5E, 0xA6, 0x79, 0x99, 0x69, 0xAE, 0xA8, 0xA0, 0x95, 0x9F, 0xA6, 0xA2, 0x95, 0x64,
+    0x6B, 0xA2, 0x89, 0x66, 0x55, 0x52, 0xC0, 0x7E, 0x2F, 0x67, 0x9D, 0x88, 0x9A, 0x89, 0x99, 0x8A,
+    0xA2, 0x89, 0x6F, 0x56, 0x6B, 0xA2, 0x88, 0x0A, 0x02, 0x25, 0xA3, 0x98, 0x7E, 0xC1, 0x65, 0xC0,
+    0x6B, 0xC2, 0x55, 0xC0, 0x04, 0xC0, 0x7F, 0x09, 0x04, 0xC0, 0x09, 0xC1, 0x35, 0x6E, 0xA2, 0x78,
+    0x6F, 0xA2, 0x98, 0xA2, 0x78, 0x9D, 0x98, 0x97, 0x89, 0xAA, 0x87, 0xA4, 0x98, 0xA4, 0x88, 0xA7,
+    0x98, 0x6D, 0x7A, 0xA2, 0x77, 0x7F, 0xA2, 0x87, 0x97, 0x97, 0x67, 0x91, 0x7E, 0x9C, 0x5B, 0xA3,
+    0x88, 0x66, 0x0A, 0x7A, 0x6E, 0xC0, 0x6F, 0xC0, 0x7A, 0xC1, 0x7A, 0xC0, 0x29, 0x7F, 0xC1, 0x6E,
+    0x7A, 0x6E, 0xC0, 0x67, 0x6E, 0xC0, 0x7A, 0x6E, 0xC1, 0x6B, 0xC0, 0x14, 0xC5, 0x05, 0xA7, 0x88,
+    0x51, 0x9B, 0x87, 0x15, 0x3F, 0x9D, 0x86, 0x96, 0x79, 0x9A, 0x59, 0xA9, 0x79, 0x6E, 0x09, 0x9D,
+    0x88, 0x5A, 0x7F, 0x69, 0x5A, 0x23, 0xC2, 0x56, 0x65, 0xC0, 0x66, 0xC0, 0x0F, 0x1B, 0x0A, 0x5A,
+    0x0A, 0x6F, 0x0A, 0x16, 0xC0, 0x66, 0x16, 0x11, 0x0A, 0x11, 0x5A, 0xC0, 0x16, 0x0E, 0xC5, 0x55,
+    0x7A, 0xC0, 0x3F, 0xC0, 0x66, 0x66, 0x51, 0x9B, 0xA9, 0xB2, 0xB9, 0xA4, 0x7A, 0x98, 0x6B, 0x5E,
+    0x56, 0x2F, 0x94, 0x97, 0xAB, 0xD8, 0xB2, 0xA7, 0x9D, 0x87, 0x66, 0xA2, 0x78, 0xA2, 0x88, 0xA3,
+    0x99, 0x7E, 0x96, 0x77, 0x99, 0x77, 0xA6, 0x78, 0x9D, 0xA9, 0xA4, 0x87, 0xA8, 0x86, 0x9C, 0x97,
+    0x10, 0xA2, 0x79, 0xA2, 0x8B, 0xA1, 0x9A, 0x6B, 0xC0, 0x52, 0x1A, 0x66, 0x44, 0x9B, 0x97, 0x9B,
+    0x87, 0x54, 0x55, 0x69, 0xC0, 0x69, 0xC0, 0x7B, 0xA2, 0x87, 0xA2, 0x77, 0x7E, 0x7F, 0xA2, 0x78,
+    0x7E, 0x7B, 0xA3, 0x8A, 0xA0, 0x5C, 0x94, 0x5D, 0x9E, 0x4B, 0x59, 0x62, 0xA3, 0x87, 0x51, 0x9D,
+    0x99, 0xA7, 0x99, 0x5A, 0x9D, 0x89, 0x50, 0x56, 0x66, 0x65, 0xC0, 0xA4, 0x88, 0x56, 0x9D, 0xA8,
+    0x65, 0x66, 0x92, 0xC7, 0x9A, 0xA8, 0xA9, 0x78, 0xA9, 0x6A, 0xA6, 0x6A, 0xA3, 0x69, 0x59, 0x9D,
+    0x89, 0x66, 0x9D, 0x99, 0xC1, 0x66, 0x7E, 0x6E, 0x7A, 0x6B, 0x65, 0x66, 0x9C, 0x88, 0x7A, 0x2C,
+    0x66, 0x2C, 0x6B, 0x27, 0x66, 0xA2, 0x89, 0x6E, 0xC0, 0x6E, 0x6F, 0x7F, 0x7E, 0xA5, 0xA7, 0x9F,
+    0xB6, 0x92, 0x88, 0xA8, 0x8A, 0xA4, 0x79, 0x9B, 0x78, 0x5A, 0xAC, 0x67, 0x9D, 0x89, 0x61, 0x7F,
+    0xA8, 0x96, 0xA2, 0xC6, 0x9C, 0xC6, 0xA2, 0x88, 0x7A, 0x42, 0x65, 0x56, 0xC2, 0x62, 0x59, 0xC0,
+    0xB0, 0x78, 0x55, 0x9D, 0x98, 0x9B, 0x9A, 0x9D, 0x88, 0x96, 0x88, 0x9D, 0x87, 0x67, 0xC0, 0x65,
+    0x64, 0xC1, 0x66, 0xC0, 0xA2, 0x88, 0x6E, 0xA2, 0x88, 0xA2, 0x88, 0x6F, 0x66, 0x1E, 0xC2, 0x5E,
+    0xA6, 0x79, 0x9A, 0x69, 0xAF, 0xB8, 0x9E, 0x85, 0x9D, 0xA6, 0xA4, 0x95, 0x9F, 0x96, 0xC0, 0xA3,
+    0x8B, 0x66, 0x52, 0x66, 0x59, 0x66, 0x66, 0x56, 0x9A, 0x99, 0x9C, 0x78, 0x99, 0x8A, 0x6F, 0xA4,
+    0x89, 0xC0, 0x53, 0x6E, 0x7F, 0x6E, 0x9C, 0x97, 0xA2, 0x88, 0x7A, 0xC0, 0x7E, 0x65, 0x56, 0x7A,
+    0x35, 0x66, 0xC1, 0x6F, 0x7E, 0x66, 0x04, 0xC0, 0x3F, 0xC0, 0x04, 0x09, 0x01, 0x9C, 0x88, 0xA3,
+    0x88, 0x12, 0xA2, 0x79, 0xA2, 0x88, 0x7F, 0x66, 0x02, 0x9D, 0x98, 0xA8, 0x87, 0xA9, 0x98, 0xA7,
+    0x98, 0x69, 0x7D, 0x7E, 0x6F, 0x7E, 0x62, 0x8C, 0x6C, 0x99, 0x6B, 0xA3, 0x89, 0xC1, 0x6E, 0x7A,
+    0x6E, 0xC0, 0x6F, 0xC0, 0x7A, 0xC2, 0x7A, 0x6E, 0x6B, 0x7E, 0xC0, 0x6E, 0x7A, 0x6E, 0x00, 0x6B,
+    0x6E, 0xC1, 0x7A, 0x6E, 0xC9, 0x05, 0xA4, 0x78, 0xA7, 0x97, 0x90, 0x88, 0xB3, 0xA6, 0x9F, 0xA5,
+    0x9B, 0x85, 0x9A, 0x79, 0x96, 0x59, 0xA9, 0x79, 0xC0, 0x55, 0x56, 0x65, 0x32, 0x6E, 0x55, 0xC0,
+    0x23, 0x1B, 0x23, 0x1B, 0x65, 0xC0, 0x52, 0x69, 0x6F, 0xC2, 0x7A, 0x6F, 0x0F, 0xC0, 0x67, 0xC1,
+    0x16, 0x11, 0xC2, 0x16, 0x11, 0x5A, 0xC1, 0x6E, 0xC0, 0x07, 0x02, 0xC0, 0x0E, 0xC0, 0x55, 0xC0,
+    0x62, 0x9D, 0x89, 0x72, 0xB2, 0xC9, 0xA1, 0x7A, 0x99, 0x6A, 0x5F, 0x51, 0xC0, 0x9A, 0xA7, 0xB5,
+    0xC7, 0xA3, 0xA8, 0x9D, 0x98, 0x6F, 0x0F, 0x6E, 0xA2, 0x98, 0x6F, 0x96, 0x76, 0x9B, 0x88, 0xA6,
+    0x88, 0x0B, 0xA9, 0x98, 0xA8, 0x76, 0x99, 0x98, 0x9C, 0x89, 0xA2, 0x9B, 0xA3, 0x8B, 0xA1, 0x9A,
+    0x6E, 0xC0, 0x29, 0x55, 0xC0, 0x50, 0x9B, 0x87, 0x0B, 0x9E, 0x76, 0x17, 0xC0, 0x69, 0xC1, 0x7E,
+    0xA2, 0x87, 0x7F, 0x6E, 0x6E, 0x7F, 0xA2, 0x88, 0xC0, 0x7F, 0xA3, 0x8C, 0x9C, 0x6C, 0x99, 0x4C,
+    0x9C, 0x4A, 0xC0, 0x7A, 0xC0, 0x9D, 0x88, 0xA1, 0x9A, 0xA6, 0x88, 0x9D, 0x88, 0x41, 0xC0, 0x51,
+    0x65, 0x66, 0x28, 0x6E, 0x28, 0x65, 0x7F, 0x9B, 0xB8, 0x8F, 0xC7, 0x9A, 0xA8, 0xA3, 0x78, 0xA7,
+    0x79, 0xAA, 0x6A, 0xAA, 0x59, 0x4F, 0x9D, 0x89, 0x9D, 0x89, 0x65, 0xC2, 0x7A, 0xC0, 0x7F, 0x65,
+    0x56, 0x61, 0x9D, 0x99, 0xA2, 0x88, 0x7A, 0x66, 0x33, 0x2E, 0x66, 0x33, 0x7F, 0x5E, 0xC0, 0x6F,
+    0x7F, 0x7E, 0xA2, 0x97, 0xA6, 0xA6, 0x95, 0xA9, 0xA2, 0x89, 0xA5, 0x79, 0x5A, 0x9A, 0x97, 0x9A,
+    0x88, 0xAE, 0x67, 0x62, 0x99, 0x98, 0xB2, 0x87, 0xA1, 0xD6, 0x9B, 0xA7, 0xA1, 0xA9, 0x66, 0x56,
+    0x65, 0xC0, 0x3F, 0xC1, 0x55, 0x66, 0x65, 0xB0, 0x68, 0x66, 0x9D, 0x88, 0x9D, 0x89, 0x9C, 0x88,
+    0x97, 0x88, 0x9A, 0x87, 0x7F, 0x66, 0x65, 0x65, 0x69, 0xC0, 0x66, 0xC0, 0xA2, 0x88, 0xC0, 0x6E,
+    0xA2, 0x88, 0x7F, 0x6E, 0xC0, 0x6F, 0xC1, 0x5E, 0xA7, 0x79, 0x9B, 0x7A, 0xAF, 0xA7, 0x9C, 0xA7,
+    0x99, 0x86, 0xA6, 0x94, 0xA2, 0x95, 0x66, 0xA2, 0x8A, 0x67, 0x52, 0x55, 0xC1, 0x6B, 0x51, 0x9A,
+    0x99, 0x9C, 0x78, 0x97, 0x8A, 0xC0, 0xA7, 0x89, 0x67, 0x5B, 0x6B, 0xA2, 0x87, 0xA3, 0x98, 0x9B,
+    0x99, 0x9D, 0x98, 0x7E, 0x6E, 0x7A, 0xC0, 0x66, 0xC5, 0x6F, 0x35, 0xC0, 0x7B, 0x30, 0x35, 0x3C,
+    0x6E, 0x9C, 0x88, 0x55, 0xA2, 0x88, 0xA5, 0x79, 0x00, 0xA2, 0x78, 0xA2, 0x88, 0x11, 0x9C, 0x88,
+    0x98, 0x97, 0xAA, 0x87, 0xA8, 0x88, 0xA7, 0x97, 0xA4, 0x96, 0x64, 0x6F, 0x7E, 0xA2, 0x88, 0x90,
+    0x7C, 0x91, 0x6C, 0xA3, 0x79, 0x7A, 0xC2, 0x7E, 0xC0, 0x6E, 0x6F, 0xC0, 0x7A, 0xC3, 0x7A, 0x6F,
+    0x7E, 0xC1, 0x6E, 0x00, 0xC0, 0x6B, 0x6E, 0xC1, 0x7A, 0xC5, 0x6E, 0xC3, 0x11, 0x69, 0xAB, 0x98,
+    0x92, 0x88, 0xA8, 0x97, 0xAA, 0xA3, 0x99, 0x85, 0x9B, 0x79, 0x94, 0x59, 0xA6, 0x68, 0xA3, 0x99,
+    0x26, 0x6E, 0xC1, 0x6F, 0x66, 0x55, 0x5A, 0x66, 0xC1, 0x51, 0x7E, 0xC0, 0x66, 0x0F, 0x07, 0xC2,
+    0x0F, 0x0A, 0xC0, 0x07, 0x7B, 0xC0, 0x6E, 0xC0, 0x11, 0xC0, 0x5A, 0xC0, 0x11, 0x0E, 0xC0, 0x65,
+    0x0E, 0xC2, 0x6E, 0x0E, 0xC1, 0x55, 0x61, 0x9D, 0x9A, 0x9B, 0xAA, 0xAC, 0xB8, 0xA9, 0x7B, 0x9C,
+    0x59, 0x42, 0x61, 0x50, 0xA7, 0xB8, 0xAE, 0xB6, 0x51, 0x61, 0xA2, 0x88, 0xA2, 0x88, 0xC0, 0xA2,
+    0x88, 0xA2, 0x87, 0x94, 0x77, 0x41, 0xA5, 0x98, 0x98, 0x98, 0xB1, 0x88, 0xA5, 0x88, 0x96, 0x87,
+    0x98, 0x99, 0xA4, 0x8A, 0xA4, 0x8A, 0xA2, 0x89, 0x6F, 0x6F, 0x2E, 0x56, 0x65, 0x54, 0x9B, 0x87,
+    0x17, 0x9E, 0x76, 0x64, 0xC0, 0x69, 0x5A, 0x18, 0x6E, 0xA2, 0x87, 0x7E, 0x6E, 0x7F, 0xC0, 0x6F,
+    0x7F, 0x6E, 0xA0, 0x9A, 0xA3, 0x8B, 0xA0, 0x6D, 0x95, 0x5C, 0x9B, 0x5A, 0x5E, 0x7A, 0x55, 0x9D,
+    0x99, 0xA6, 0x89, 0x6F, 0x9D, 0x88, 0x32, 0x51, 0x52, 0x65, 0x11, 0x32, 0x66, 0x76, 0xC0, 0x7E,
+    0x94, 0xB7, 0x94, 0xA8, 0x7A, 0x9D, 0x98, 0x6E, 0xAA, 0x69, 0xAD, 0x6A, 0xA5, 0x5A, 0x46, 0x9B,
+    0x88, 0x56, 0x7F, 0x08, 0xC1, 0x7F, 0xC0, 0x61, 0x66, 0x9D, 0x98, 0x7F, 0x6E, 0x30, 0x66, 0x30,
+    0xC0, 0x2B, 0xA2, 0x88, 0x6E, 0x01, 0x7F, 0x7F, 0x6E, 0xA1, 0xA8, 0xA6, 0x97, 0x75, 0x9B, 0x8A,
+    0xA5, 0x88, 0xC0, 0xA1, 0xA7, 0x89, 0xA7, 0x6E, 0x9C, 0x99, 0xA5, 0x89, 0xBE, 0x77, 0x9E, 0xC6,
+    0x9C, 0x97, 0x7B, 0x66, 0x3F, 0x7E, 0x6F, 0xC1, 0x55, 0x61, 0x56, 0xC0, 0xB1, 0x78, 0x51, 0x9D,
+    0x99, 0x9C, 0x88, 0x9B, 0x89, 0x98, 0x77, 0x9B, 0x88, 0x7B, 0xC0, 0x65, 0x64, 0x66, 0x69, 0x66,
+    0xC0, 0x16, 0x7F, 0x6E, 0x6F, 0x3E, 0x6F, 0x7E, 0x6F, 0xC1, 0x5A, 0xA8, 0x68, 0x9D, 0x79, 0xAE,
+    0xA8, 0x9D, 0x97, 0x95, 0x97, 0xA4, 0x85, 0xA5, 0x93, 0x76, 0xA0, 0x9A, 0x6F, 0x67, 0x55, 0x6B,
+    0xC0, 0x37, 0x52, 0x9B, 0x9A, 0x98, 0x79, 0x94, 0x89, 0x6F, 0xA8, 0x88, 0x6F, 0x0A, 0xA2, 0x89,
+    0x55, 0xA2, 0x88, 0x9C, 0x98, 0x9C, 0x87, 0x7E, 0x7E, 0x6B, 0x7A, 0xC1, 0x55, 0xC2, 0x6B, 0x30,
+    0xC1, 0x28, 0xC0, 0x2D, 0xC0, 0x19, 0x9C, 0x88, 0xA2, 0x77, 0x6F, 0xA7, 0x8A, 0xA5, 0x8A, 0xA3,
+    0x89, 0xA2, 0x88, 0x31, 0x9C, 0x88, 0x9A, 0x98, 0xA8, 0x77, 0xA6, 0x97, 0xA4, 0x96, 0xA6, 0x95,
+    0x65, 0x15, 0x7E, 0xA2, 0x79, 0x8A, 0x7C, 0x98, 0x6A, 0xA2, 0x79, 0x7A, 0xC2, 0x7E, 0x6B, 0x6E,
+    0xC1, 0x7E, 0xC3, 0x7A, 0x6E, 0x6B, 0x7E, 0xC0, 0x6E, 0x00, 0x6F, 0xC0, 0x7A, 0x0C, 0x0F, 0xC3,
+    0x0C, 0xC1, 0x7F, 0xC1, 0x6E, 0xC1, 0x69, 0xA7, 0x87, 0x9B, 0x98, 0x9B, 0x97, 0xB1, 0xA7, 0x9C,
+    0x85, 0x99, 0x88, 0x96, 0x68, 0x46, 0xA5, 0x78, 0x5E, 0x69, 0xC1, 0x37, 0x66, 0x59, 0x52, 0xC1,
+    0x65, 0x56, 0x0F, 0xC1, 0x66, 0x07, 0xC1, 0x0A, 0xC0, 0x07, 0x0F, 0x67, 0x6E, 0xC0, 0x11, 0xC0,
+    0x07, 0x6B, 0x65, 0x0E, 0xC3, 0x07, 0x0E, 0x6E, 0xC0, 0x6B, 0x0E, 0x56, 0x0E, 0xC0, 0x51, 0x51,
+    0x99, 0xAA, 0xA2, 0xB9, 0xB1, 0x7A, 0x47, 0x9C, 0x78, 0x51, 0x7A, 0xB1, 0xC7, 0xA1, 0xB8, 0x55,
+    0x66, 0x6F, 0xA3, 0x98, 0x6E, 0xA2, 0x89, 0x7E, 0x95, 0x88, 0x40, 0xA4, 0x88, 0x51, 0xB0, 0x98,
+    0x6E, 0x93, 0x98, 0x97, 0x89, 0xA4, 0x9A, 0xA5, 0x8A, 0xA3, 0x89, 0xA2, 0x88, 0x7F, 0x5A, 0x2E,
+    0x55, 0x50, 0x9B, 0x87, 0x9C, 0x87, 0x65, 0x58, 0x54, 0x69, 0xC2, 0xA2, 0x87, 0x7E, 0xA2, 0x78,
+    0x7E, 0x66, 0x0B, 0x7F, 0x6E, 0x6B, 0xA0, 0x9A, 0xA5, 0x8D, 0x9A, 0x7C, 0x9A, 0x4A, 0x9C, 0x59,
+    0x9E, 0x68, 0x6B, 0x65, 0x56, 0xA8, 0x88, 0x9D, 0x99, 0x41, 0x59, 0x51, 0x62, 0xC0, 0x2D, 0x7F,
+    0x65, 0x6E, 0x7A, 0x9C, 0xA9, 0x90, 0xB7, 0x9D, 0xA8, 0xC0, 0x9C, 0x88, 0x66, 0xA3, 0x89, 0xAC,
+    0x68, 0xAD, 0x4A, 0x4F, 0x99, 0x89, 0x6E, 0xC0, 0x6B, 0x66, 0x14, 0x7B, 0x14, 0x61, 0x76, 0x51,
+    0x7A, 0x6F, 0x2D, 0xC0, 0x7B, 0x65, 0x37, 0x3C, 0x6F, 0x6F, 0x7E, 0x6E, 0xA1, 0xA8, 0xA4, 0x97,
+    0xA5, 0xA9, 0x9B, 0x89, 0xA2, 0x87, 0x7E, 0x74, 0x8D, 0xB8, 0x9B, 0x89, 0x9A, 0x98, 0xAA, 0x68,
+    0xBD, 0x88, 0x9D, 0xC7, 0x9D, 0xA7, 0x7F, 0x7B, 0xA2, 0x87, 0x6E, 0x6B, 0x20, 0x1B, 0x55, 0x51,
+    0x52, 0x69, 0xB1, 0x79, 0x51, 0x9D, 0x99, 0x9C, 0x88, 0x31, 0x97, 0x88, 0x51, 0x7A, 0xC0, 0x65,
+    0x69, 0x66, 0x65, 0x69, 0x66, 0x69, 0x7F, 0x6F, 0x6E, 0x36, 0xA2, 0x87, 0x7F, 0x6E, 0x6B, 0xC0,
+    0x5A, 0xA7, 0x79, 0x4A, 0xAD, 0xA9, 0x9C, 0x97, 0x96, 0x86, 0x9E, 0x96, 0x32, 0xA1, 0xA6, 0xA0,
+    0x8A, 0x18, 0x6B, 0x62, 0x6B, 0xC0, 0x6F, 0x63, 0x99, 0x89, 0x9B, 0x8A, 0x8F, 0x9A, 0x56, 0xA8,
+    0x88, 0xA6, 0x78, 0xA4, 0x89, 0x6F, 0x66, 0x16, 0x2A, 0x9C, 0x88, 0x7E, 0x7E, 0x19, 0x7E, 0xC3,
+    0x66, 0x19, 0x1C, 0x6F, 0x1C, 0x19, 0xC0, 0x21, 0x19, 0x66, 0x69, 0x9B, 0x88, 0x5F, 0xA4, 0x88,
+    0xA8, 0x7A, 0xA5, 0x89, 0xA3, 0x89, 0xC1, 0x9D, 0x99, 0xC0, 0xA6, 0x87, 0xA3, 0x97, 0x33, 0xA4,
+    0x96, 0xC0, 0x6E, 0x7E, 0x5B, 0x89, 0x7D, 0x9B, 0x7B, 0x7F, 0x5E, 0xC0, 0x05, 0xC0, 0x7E, 0x6B,
+    0x6E, 0xC1, 0x7E, 0xC4, 0x7E, 0xC1, 0x7F, 0xC0, 0x6E, 0x7F, 0xC3, 0x7A, 0xC1, 0x0C, 0xC2, 0x7F,
+    0xC0, 0x6E, 0x7E, 0xC2, 0xA3, 0x87, 0xA6, 0x86, 0x90, 0x98, 0xB0, 0x87, 0x78, 0x9B, 0x88, 0x95,
+    0x88, 0x9E, 0x68, 0xA3, 0x67, 0xA3, 0x78, 0xC0, 0x69, 0x37, 0xC1, 0x51, 0x66, 0x5A, 0x65, 0xC2,
+    0x56, 0x66, 0x07, 0xC1, 0x65, 0x07, 0x7F, 0xC1, 0x07, 0x7B, 0x07, 0xC0, 0x7A, 0x07, 0x11, 0x5A,
+    0xC0, 0x02, 0x0E, 0xC0, 0x6E, 0x0E, 0xC0, 0x13, 0xC0, 0x6B, 0xC0, 0x51, 0x6E, 0x0E, 0x51, 0x66,
+    0x9B, 0x9A, 0x9C, 0x98, 0xAC, 0x89, 0xA7, 0x7A, 0x9C, 0x89, 0x9A, 0x88, 0xAC, 0xB7, 0xAB, 0xC8,
+    0x33, 0x65, 0xC0, 0xA2, 0x88, 0xA2, 0x88, 0x6F, 0xA3, 0x98, 0xC0, 0x96, 0x77, 0x41, 0xA2, 0x88,
+    0xA9, 0x98, 0xA8, 0x99, 0x55, 0x91, 0x99, 0x98, 0x88, 0xA5, 0x99, 0xA4, 0x79, 0xA3, 0x9A, 0xA3,
+    0x88, 0x6F, 0xC0, 0x51, 0x65, 0x40, 0x9D, 0x98, 0x06, 0x65, 0x58, 0x54, 0x9D, 0x87, 0x65, 0x29,
+    0x79, 0x6E, 0xA2, 0x87, 0x7F, 0x6E, 0x06, 0xC0, 0x6F, 0x7E, 0x6E, 0x67, 0xA4, 0x9D, 0xA0, 0x7B,
+    0x98, 0x6A, 0x46, 0x99, 0x4B, 0x9F, 0x69, 0x7F, 0x9D, 0x88, 0xA4, 0x98, 0xA5, 0x8A, 0x9C, 0x88,
+    0x55, 0x55, 0x51, 0x66, 0x7F, 0x08, 0x69, 0x35, 0xC0, 0x7B, 0x97, 0xB9, 0x92, 0xC7, 0xA4, 0x98,
+    0x9A, 0x77, 0x66, 0x61, 0x66, 0xA7, 0x79, 0xAF, 0x59, 0xA7, 0x4A, 0x9E, 0x58, 0x50, 0x67, 0x56,
+    0x7A, 0x6F, 0x7A, 0x0F, 0x71, 0x56, 0x65, 0x39, 0xC0, 0x2D, 0x6B, 0x7A, 0x56, 0xA2, 0x87, 0x6F,
+    0x5A, 0x7E, 0x7F, 0xA2, 0x87, 0xA2, 0x98, 0xA5, 0xA8, 0xC1, 0xA3, 0xA7, 0x99, 0xB7, 0x93, 0x99,
+    0xC0, 0x96, 0x88, 0xA6, 0x78, 0xBD, 0x88, 0x9F, 0xC7, 0x9C, 0x97, 0xA3, 0x99, 0x7A, 0x7E, 0x6E,
+    0x2F, 0x5A, 0xC0, 0x61, 0x40, 0x62, 0x59, 0xAF, 0x8A, 0x55, 0x9C, 0x89, 0x9A, 0x88, 0x97, 0x88,
+    0x9B, 0x88, 0x66, 0xC1, 0x65, 0xC0, 0x69, 0x66, 0x65, 0xC0, 0x55, 0x7A, 0xA2, 0x88, 0xC0, 0x6E,
+    0xA2, 0x88, 0x7F, 0x6E, 0x17, 0x6B, 0x5A, 0xA7, 0x79, 0x5F, 0xAC, 0xA8, 0x9B, 0x97, 0x98, 0x77,
+    0x9C, 0x87, 0xA3, 0xA1, 0xA3, 0xA3, 0xC0, 0xA2, 0x8A, 0x6B, 0x67, 0x6B, 0x5B, 0x9E, 0x9B, 0x9C,
+    0x8B, 0x9C, 0x98, 0x9D, 0x8A, 0x8F, 0x89, 0x51, 0xA6, 0x78, 0xA4, 0x88, 0xA7, 0x89, 0x6F, 0x9D,
+    0x99, 0x7E, 0x55, 0x60, 0xC0, 0x7F, 0xC0, 0x7E, 0x7F, 0x6E, 0xC1, 0x62, 0x51, 0x5A, 0x7E, 0x6B,
+    0xC0, 0x0D, 0xC0, 0x6F, 0xC0, 0x12, 0x9C, 0x88, 0x9C, 0x78, 0x13, 0xA8, 0x8A, 0xA2, 0x79, 0xA2,
+    0x88, 0xA2, 0x88, 0x6E, 0x7F, 0x7F, 0xA6, 0x76, 0xA1, 0xA7, 0x78, 0xA3, 0x97, 0xA2, 0x87, 0x7A,
+    0xA2, 0x88, 0x9C, 0x7A, 0x88, 0x6C, 0x9F, 0x7B, 0x7A, 0x6E, 0xC2, 0x7E, 0x6B, 0x6E, 0xC1, 0x7E,
+    0xC4, 0x7A, 0x6E, 0xC1, 0x7F, 0x6E, 0x7A, 0x6B, 0xC0, 0x6E, 0xC5, 0x7E, 0xC0, 0x6E, 0x6B, 0x7E,
+    0xC1, 0x6E, 0xC0, 0x69, 0xAA, 0x86, 0x92, 0x97, 0xA5, 0x98, 0xA8, 0x88, 0x9A, 0x98, 0x96, 0x87,
+    0x9F, 0x66, 0xA2, 0x57, 0xA2, 0x78, 0x5A, 0x69, 0x37, 0xC1, 0x9D, 0x89, 0xC1, 0x61, 0x6E, 0xC1,
+    0x0A, 0xC2, 0x5A, 0xC0, 0x65, 0x0A, 0x6F, 0x0A, 0x07, 0x7B, 0x55, 0xC2, 0x6F, 0x02, 0xC1, 0x0E,
+    0x07, 0x02, 0xC0, 0x5A, 0x0E, 0x6E, 0x6F, 0x66, 0x13, 0x56, 0x0E, 0x3F, 0x66, 0x9C, 0x99, 0x9C,
+    0x89, 0x52, 0xB0, 0x89, 0x53, 0x98, 0x97, 0xB4, 0xB7, 0xA4, 0xA8, 0x65, 0x55, 0x7B, 0xA4, 0x88,
+    0x6E, 0xA2, 0x88, 0xA2, 0x89, 0x9D, 0x98, 0x97, 0x77, 0x32, 0xA4, 0x98, 0xAB, 0x99, 0xA2, 0x88,
+    0x7F, 0x18, 0x99, 0x89, 0xA5, 0x89, 0xA3, 0x9A, 0xA3, 0x99, 0xA2, 0x78, 0x7E, 0x52, 0x55, 0xC0,
+    0x6D, 0x66, 0x54, 0x64, 0x55, 0x54, 0x9C, 0x87, 0x9E, 0x76, 0x7A, 0xC0, 0x6D, 0xA2, 0x87, 0x6F,
+    0x7E, 0x6B, 0x6B, 0x7A, 0x6E, 0xC0, 0x6B, 0xA2, 0x9B, 0xA4, 0x7B, 0x95, 0x8A, 0x51, 0xA0, 0x59,
+    0x9A, 0x4B, 0x4B, 0x6E, 0x9C, 0x89, 0xA7, 0x99, 0xA2, 0x88, 0x9D, 0x89, 0x55, 0x55, 0x51, 0x7B,
+    0x39, 0xA2, 0x88, 0x65, 0x65, 0x6B, 0x71, 0x90, 0xB7, 0x9F, 0xB9, 0x52, 0x9D, 0x88, 0x7A, 0x60,
+    0x9C, 0x88, 0x6F, 0xAC, 0x59, 0xAC, 0x49, 0xA4, 0x48, 0x56, 0x9D, 0x99, 0x66, 0xC0, 0x6F, 0x7A,
+    0x51, 0x65, 0x66, 0xC2, 0x66, 0xC2, 0x6F, 0x6E, 0x7E, 0x6F, 0xA2, 0x87, 0xA1, 0xA9, 0xA5, 0x97,
+    0xA3, 0xA9, 0x60, 0xA4, 0x98, 0x95, 0xB8, 0x98, 0x88, 0xA4, 0x68, 0x94, 0x98, 0xA2, 0x88, 0xBC,
+    0x87, 0xA0, 0xC6, 0x9D, 0xA8, 0xA3, 0x88, 0x7E, 0xC0, 0x66, 0xC1, 0x69, 0x66, 0x40, 0x51, 0x66,
+    0xAE, 0x69, 0x51, 0x9B, 0x99, 0x99, 0x89, 0x98, 0x77, 0x06, 0xC1, 0x66, 0x69, 0xC0, 0x66, 0x69,
+    0x65, 0x66, 0x55, 0x65, 0x7F, 0xA2, 0x88, 0x6E, 0x6E, 0x7F, 0x7F, 0x6E, 0x6F, 0x5A, 0xA6, 0x69,
+    0xA5, 0x78, 0xAA, 0xA8, 0x9A, 0xA7, 0x99, 0x78, 0x9C, 0x66, 0x9C, 0xA3, 0xA8, 0xA2, 0x78, 0xA2,
+    0x89, 0xA1, 0x8B, 0x67, 0xA1, 0x8A, 0x9F, 0x9B, 0x9D, 0x8C, 0x9C, 0x8B, 0xA2, 0x89, 0x9C, 0x87,
+    0x8C, 0x89, 0x9D, 0x88, 0xA4, 0x98, 0xA3, 0x88, 0xA5, 0x89, 0xC0, 0x59, 0x7F, 0x7E, 0x65, 0xC0,
+    0x7E, 0x66, 0x7F, 0xA2, 0x88, 0xC0, 0x6E, 0x6B, 0x0D, 0x51, 0x56, 0x7F, 0x0D, 0x6B, 0x6E, 0x6E,
+    0xA2, 0x99, 0x69, 0x0D, 0x9C, 0x77, 0x9C, 0x89, 0xA9, 0x79, 0xA8, 0x7A, 0x6B, 0x09, 0xA3, 0x89,
+    0xA4, 0x88, 0xA3, 0x98, 0xC0, 0xA4, 0x87, 0xA2, 0x97, 0x9F, 0xA6, 0xA2, 0x85, 0xA2, 0x98, 0xC0,
+    0xA4, 0x88, 0x97, 0x7B, 0x8A, 0x6C, 0xA0, 0x7A, 0x7A, 0x6E, 0x5A, 0x05, 0xC0, 0x7E, 0x6B, 0x6E,
+    0xC1, 0x7E, 0xC5, 0x7E, 0xC1, 0x7F, 0xC1, 0x7E, 0xC0, 0x6B, 0x6E, 0xC2, 0x7A, 0x6E, 0xC0, 0x6E,
+    0xC1, 0x7F, 0x6E, 0xC2, 0x65, 0xA7, 0x86, 0xA0, 0x85, 0x96, 0xA8, 0xAC, 0x9B, 0x9B, 0x88, 0x99,
+    0x87, 0x9B, 0x77, 0xA3, 0x77, 0x4E, 0x5D, 0xC0, 0x6F, 0x66, 0x55, 0x62, 0x5A, 0x1E, 0x56, 0xC0,
+    0x69, 0xC0, 0x66, 0xC0, 0x5A, 0xC2, 0x61, 0x6F, 0x07, 0xC1, 0x7B, 0x07, 0x02, 0xC5, 0x07, 0x02,
+    0x5A, 0xC0, 0x66, 0xA2, 0x77, 0x7B, 0x6F, 0x0E, 0x1A, 0x0E, 0x5A, 0x0E, 0x3A, 0x9D, 0x99, 0x9D,
+    0x99, 0x9A, 0x9A, 0xAF, 0x89, 0xA0, 0x8A, 0x98, 0x98, 0xB3, 0xB7, 0xA5, 0xA8, 0x61, 0xC0, 0xA2,
+    0x88, 0xA3, 0x88, 0x6B, 0xA3, 0x98, 0x6F, 0x27, 0x99, 0x88, 0xA2, 0x88, 0xAC, 0x88, 0xA4, 0x99,
+    0xC0, 0x33, 0x91, 0x89, 0x9A, 0x78, 0xA5, 0x9A, 0xA2, 0x88, 0xA4, 0x88, 0x6F, 0x6E, 0x26, 0x66,
+    0x26, 0x7F, 0x6D, 0x1A, 0x9E, 0x86, 0x59, 0x69, 0x9D, 0x87, 0x9B, 0x86, 0x65, 0x6E, 0xC0, 0xA2,
+    0x86, 0x7F, 0xA1, 0x9A, 0x6F, 0xA1, 0x9A, 0x6B, 0x6E, 0x05, 0xC0, 0xA0, 0x8A, 0xA6, 0x8A, 0x97,
+    0x89, 0x9B, 0x87, 0xA2, 0x7A, 0x43, 0x99, 0x4B, 0x4F, 0x51, 0x6F, 0xA8, 0x88, 0x66, 0x41, 0x41,
+    0x51, 0x7A, 0x7E, 0x0D, 0x6E, 0x61, 0x66, 0x69, 0x98, 0xA8, 0x10, 0xA4, 0x9A, 0x98, 0x88, 0x79,
+    0x7E, 0x9D, 0x98, 0x9C, 0x98, 0x51, 0xA5, 0x79, 0xAD, 0x5A, 0xAB, 0x59, 0x55, 0x56, 0x9D, 0x8A,
+    0x5B, 0xA2, 0x87, 0x66, 0x51, 0x66, 0x55, 0xC0, 0x6E, 0x62, 0x7E, 0xC0, 0x31, 0x66, 0x05, 0x7E,
+    0x6B, 0xA2, 0x87, 0xA2, 0x88, 0xA3, 0xA8, 0xA4, 0xA7, 0x7A, 0xA3, 0x98, 0x92, 0xB7, 0x42, 0xA5,
+    0x79, 0x94, 0x87, 0x51, 0xBB, 0xA8, 0xA0, 0xC6, 0x70, 0xA3, 0x88, 0xC0, 0x69, 0x66, 0xC2, 0x55,
+    0x9D, 0x98, 0x56, 0x65, 0xAB, 0x5A, 0x9D, 0x99, 0x9C, 0x88, 0x98, 0x88, 0x9C, 0x77, 0x66, 0xC2,
+    0x66, 0xC0, 0x69, 0x66, 0x65, 0x65, 0x56, 0x69, 0x66, 0x7E, 0xA2, 0x88, 0x2A, 0x6E, 0x7F, 0xA2,
+    0x88, 0xC0, 0x5B, 0xA6, 0x68, 0xA7, 0x79, 0xAA, 0xA7, 0x9A, 0x98, 0x99, 0x78, 0x9B, 0x77, 0x93,
+    0xA5, 0xAF, 0xB3, 0xA2, 0x84, 0xA3, 0x99, 0xA1, 0x9A, 0x9F, 0x9B, 0xA2, 0x8A, 0x9E, 0x8C, 0x9D,
+    0x8D, 0xA0, 0x7B, 0xA3, 0x88, 0x9A, 0x88, 0x3A, 0x93, 0x98, 0x9C, 0x98, 0xA3, 0x88, 0xA4, 0x88,
+    0xA2, 0x77, 0xA2, 0x88, 0x7F, 0x79, 0x56, 0x69, 0x7B, 0xC0, 0xA2, 0x88, 0x7F, 0x7E, 0xC0, 0x6F,
+    0x19, 0x9D, 0x99, 0x55, 0x00, 0x6E, 0x19, 0x2D, 0xA3, 0x88, 0xC0, 0x61, 0x50, 0x9C, 0x78, 0x9C,
+    0x78, 0x0E, 0xA8, 0x7A, 0xA3, 0x89, 0xA2, 0x88, 0xC0, 0xA6, 0x88, 0xA3, 0x99, 0x6E, 0xA2, 0x87,
+    0xA2, 0x97, 0x9F, 0xA6, 0xA2, 0x95, 0xA3, 0x88, 0x66, 0xA5, 0x89, 0x92, 0x7A, 0x8D, 0x7D, 0xA1,
+    0x8A, 0xC0, 0x6E, 0xC2, 0x7E, 0x6B, 0x6E, 0xC1, 0x6E, 0x7A, 0xC3, 0x7A, 0x29, 0xC2, 0x7F, 0xC0,
+    0x7E, 0xC0, 0x6E, 0xC1, 0x7F, 0xC2, 0x6E, 0xC1, 0x7E, 0x6B, 0xC1, 0x6E, 0xC0, 0x69, 0x6C, 0xAB,
+    0x96, 0x92, 0xA7, 0xA7, 0x9B, 0x66, 0x9B, 0x89, 0x99, 0x86, 0xA4, 0x66, 0x4D, 0x9E, 0x68, 0x6F,
+    0xC0, 0x2B, 0x56, 0x52, 0x6E, 0xC0, 0x16, 0x0F, 0xC1, 0x66, 0x5A, 0x66, 0x07, 0x02, 0x69, 0x66,
+    0x3B, 0x07, 0xC0, 0x02, 0xC3, 0x6F, 0xC0, 0x02, 0xC2, 0x5A, 0x07, 0x3F, 0x66, 0xC0, 0xA2, 0x78,
+    0x66, 0x0B, 0x0E, 0x6F, 0x0B, 0x76, 0x3A, 0x9D, 0x99, 0x08, 0x9C, 0x89, 0xA6, 0x89, 0xA4, 0x8A,
+    0x98, 0x98, 0xB2, 0xB7, 0xA9, 0xA8, 0x9D, 0x98, 0xA2, 0x99, 0xA2, 0x77, 0x7B, 0xA2, 0x88, 0xA3,
+    0x88, 0xC0, 0x95, 0x99, 0x41, 0x10, 0xAB, 0xA9, 0xC0, 0xA3, 0x88, 0xA2, 0x88, 0x22, 0x9A, 0x68,
+    0xA5, 0x9A, 0xA3, 0x88, 0xA2, 0x99, 0xA3, 0x89, 0x6E, 0x7F, 0xC0, 0x3A, 0x09, 0xC0, 0x50, 0x40,
+    0x64, 0x6E, 0x50, 0x9A, 0x75, 0x9E, 0x86, 0xC0, 0x6D, 0x7F, 0xA1, 0x9A, 0xA2, 0x89, 0xA2, 0x89,
+    0xA1, 0x9A, 0xA1, 0x8A, 0x7A, 0xC1, 0x56, 0xA4, 0x89, 0x9B, 0x89, 0x98, 0x87, 0x5A, 0xA2, 0x99,
+    0x9E, 0x5A, 0x9A, 0x4B, 0x9D, 0x59, 0x9D, 0x99, 0xA4, 0x88, 0xA8, 0x88, 0x6B, 0x9C, 0x77, 0x56,
+    0x65, 0x66, 0xA2, 0x88, 0xA3, 0x98, 0x66, 0x55, 0x65, 0x65, 0x95, 0xB9, 0xA2, 0x9A, 0x32, 0x9C,
+    0x98, 0x7E, 0x65, 0x60, 0x9C, 0x98, 0x51, 0x6F, 0xA6, 0x68, 0xA9, 0x69, 0xA2, 0x69, 0x46, 0xA3,
+    0x8A, 0xA4, 0x78, 0x5A, 0x66, 0x51, 0x56, 0x65, 0x6E, 0x36, 0xC0, 0x7F, 0x61, 0x56, 0x36, 0x05,
+    0x7E, 0x6F, 0xA2, 0x98, 0xA2, 0x97, 0xA5, 0xB8, 0xA3, 0x97, 0x76, 0x91, 0xA8, 0xA3, 0x89, 0xA6,
+    0x69, 0x95, 0x98, 0x9A, 0x87, 0xBC, 0x97, 0x9F, 0xC6, 0xA0, 0xA7, 0x7F, 0x69, 0xC0, 0x66, 0xC1,
+    0x69, 0x9D, 0x99, 0x51, 0x55, 0xC0, 0xA7, 0x5A, 0x56, 0x9B, 0x98, 0x98, 0x88, 0x51, 0xC4, 0x66,
+    0xC0, 0x65, 0x66, 0x69, 0x65, 0xC0, 0x55, 0xC0, 0x7E, 0xA2, 0x88, 0x6F, 0x7E, 0x6E, 0x6B, 0x6E,
+    0xA5, 0x6A, 0xA8, 0x79, 0xAA, 0xA6, 0x9A, 0x88, 0x99, 0x78, 0x9C, 0x78, 0x8B, 0xB8, 0xB3, 0xA1,
+    0xA6, 0x82, 0xA1, 0xA8, 0xA2, 0x8A, 0xA1, 0x8B, 0xA0, 0x9C, 0x9A, 0x8E, 0xA1, 0x7B, 0xA3, 0x8A,
+    0x9D, 0x99, 0x98, 0x78, 0x69, 0x97, 0x98, 0x95, 0x97, 0xA3, 0x98, 0xA3, 0x78, 0x7E, 0xA3, 0x98,
+    0x6F, 0x7E, 0x55, 0xC0, 0x7A, 0xC0, 0x7F, 0xA2, 0x88, 0x66, 0x0A, 0xC0, 0x7B, 0x51, 0x6E, 0x19,
+    0xC0, 0x1E, 0xA2, 0x88, 0x7F, 0xC0, 0x50, 0x55, 0x9D, 0x88, 0x9D, 0x88, 0x57, 0xA4, 0x8A, 0xAC,
+    0x7A, 0x7F, 0x6E, 0xA4, 0x88, 0xA5, 0x88, 0xA2, 0x98, 0x56, 0xA4, 0x96, 0xA2, 0x95, 0x7D, 0xA2,
+    0x96, 0x66, 0xA5, 0x7A, 0x8B, 0x8B, 0x94, 0x6C, 0x6B, 0xC0, 0x6E, 0x6E, 0x05, 0xC1, 0x7F, 0xC0,
+    0x6E, 0xC2, 0x7A, 0xC0, 0x6E, 0xC0, 0x30, 0x69, 0xC2, 0x7F, 0x7A, 0x6E, 0x6E, 0x7A, 0x6E, 0xC3,
+    0x6F, 0x7A, 0x19, 0x6E, 0x7A, 0x6E, 0xC0, 0x21, 0xC1, 0x26, 0x54, 0xA9, 0xA6, 0x9E, 0xA4, 0x9A,
+    0x89, 0xA6, 0x9B, 0x9A, 0x8A, 0x98, 0x76, 0xA5, 0x65, 0xA2, 0x67, 0x9D, 0x79, 0x5A, 0x6E, 0x41,
+    0x62, 0x5A, 0xC0, 0x7E, 0x1B, 0x65, 0xC1, 0x56, 0xC3, 0x66, 0x65, 0x5A, 0xA3, 0x88, 0x07, 0x02,
+    0xC3, 0x5A, 0x02, 0xC0, 0x66, 0x02, 0x6F, 0x3F, 0x0E, 0x6E, 0x3F, 0x51, 0x7F, 0xC0, 0x6F, 0x0E,
+    0x5A, 0x06, 0x61, 0xC0, 0x51, 0x9D, 0x99, 0x56, 0x61, 0xA1, 0x8A, 0x9D, 0xA9, 0xA3, 0xA9, 0xB8,
+    0xA8, 0x7A, 0xA4, 0x87, 0x66, 0x7F, 0xA2, 0x88, 0xA3, 0x99, 0x9C, 0x77, 0x96, 0x88, 0x6F, 0xA8,
+    0x88, 0xA9, 0x98, 0x65, 0xA2, 0x89, 0xA3, 0x88, 0x2C, 0x96, 0x89, 0xA6, 0x79, 0xA3, 0x99, 0xA2,
+    0x89, 0xA4, 0x88, 0xA2, 0x88, 0x6E, 0x09, 0xC0, 0x0E, 0xC0, 0x51, 0x54, 0x65, 0x55, 0x64, 0x9C,
+    0x76, 0x9B, 0x86, 0x68, 0xC0, 0xA1, 0x9A, 0xA3, 0x89, 0xA2, 0x9A, 0xA2, 0x8A, 0xA2, 0x89, 0x09,
+    0x6B, 0x6E, 0xC0, 0x10, 0x24, 0x9D, 0x88, 0x97, 0x98, 0x59, 0x66, 0xA2, 0x79, 0xA0, 0x7A, 0x9A,
+    0x5A, 0x9A, 0x5A, 0x9C, 0x78, 0xA2, 0x78, 0xAB, 0x98, 0xA2, 0x89, 0x9C, 0x78, 0x41, 0x61, 0x7E,
+    0xA3, 0x99, 0x6E, 0x10, 0x55, 0x69, 0x98, 0xA9, 0x9A, 0xAA, 0x7F, 0x9B, 0x98, 0x61, 0x79, 0x75,
+    0x65, 0x51, 0x66, 0xA5, 0x77, 0x9C, 0x78, 0x15, 0xA6, 0x69, 0x4F, 0x6F, 0xA4, 0x89, 0xA5, 0x88,
+    0x46, 0x9C, 0x78, 0x55, 0xC0, 0x6B, 0xC0, 0x7A, 0x62, 0xC1, 0x6E, 0x7A, 0xA2, 0x78, 0xA2, 0x88,
+    0xA4, 0xA7, 0x9F, 0xB7, 0xA5, 0xA8, 0xC0, 0x94, 0x98, 0xA4, 0x79, 0xA5, 0x79, 0x98, 0x97, 0x95,
+    0x97, 0xBC, 0x97, 0x9F, 0xC6, 0x79, 0xA1, 0xA8, 0x6E, 0xC0, 0x1C, 0xC0, 0x66, 0x55, 0x51, 0x65,
+    0xC0, 0x66, 0xA5, 0x4A, 0x55, 0x99, 0x99, 0x9A, 0x88, 0x56, 0x06, 0xC3, 0x66, 0xC0, 0x66, 0x65,
+    0x69, 0xC0, 0x69, 0x66, 0xC0, 0x22, 0x7F, 0x6E, 0x7F, 0xC0, 0x6E, 0x5A, 0x04, 0xA8, 0x79, 0xA9,
+    0xA7, 0x9B, 0x98, 0x99, 0x78, 0x9B, 0x89, 0x8B, 0xA9, 0xAF, 0xA2, 0xAA, 0x90, 0x7D, 0xA1, 0x9A,
+    0x9E, 0x9E, 0x9D, 0x8F, 0x9F, 0x7C, 0xA2, 0x79, 0x9B, 0x99, 0xA6, 0x88, 0xA2, 0x89, 0x59, 0x9C,
+    0x87, 0x9A, 0x97, 0x93, 0x97, 0x9D, 0x88, 0xA5, 0x88, 0xA2, 0x98, 0x6F, 0x7E, 0x5A, 0x33, 0x6E,
+    0x07, 0x65, 0x67, 0x6E, 0x3D, 0x65, 0x3D, 0x7E, 0xA2, 0x88, 0x6E, 0xC0, 0x6E, 0x7A, 0xC0, 0x6F,
+    0x23, 0x60, 0x41, 0x69, 0x97, 0x8A, 0x9D, 0x8A, 0xB4, 0x7A, 0xA6, 0x89, 0x6E, 0x7F, 0xA6, 0x88,
+    0xA3, 0x88, 0xC0, 0xA2, 0x97, 0x7C, 0xA1, 0xA7, 0xA3, 0x97, 0xA2, 0x88, 0x56, 0x87, 0x7C, 0x9C,
+    0x7C, 0xC0, 0x69, 0x6F, 0xC2, 0x6E, 0x7A, 0x6B, 0x6E, 0xC3, 0x7A, 0xC0, 0x6E, 0x7A, 0xC0, 0x6E,
+    0xC1, 0x7F, 0x7E, 0x6E, 0x7A, 0x6E, 0x6E, 0xC3, 0x7F, 0x6E, 0x21, 0xC1, 0x26, 0x21, 0x59, 0x12,
+    0xC1, 0x26, 0xA2, 0x95, 0xA9, 0xA4, 0x98, 0x87, 0xA3, 0x9A, 0x9C, 0x9B, 0x98, 0x77, 0xA0, 0x75,
+    0xA6, 0x68, 0x45, 0x9D, 0x89, 0x4E, 0x41, 0x66, 0x56, 0x65, 0x23, 0x66, 0x56, 0x0F, 0x66, 0x5A,
+    0xC3, 0x66, 0x69, 0x56, 0x07, 0xC0, 0x52, 0xC0, 0x33, 0x6F, 0x02, 0x3A, 0x02, 0xC0, 0x66, 0xC0,
+    0xA2, 0x78, 0x3F, 0xC0, 0x6F, 0xC0, 0x3F, 0x3A, 0xC0, 0x5A, 0x0B, 0x3F, 0x37, 0x62, 0x65, 0xC0,
+    0x52, 0x65, 0x56, 0x55, 0x72, 0x99, 0x9A, 0xB2, 0xA9, 0xB1, 0xB8, 0xA2, 0x87, 0x66, 0x7F, 0xA2,
+    0x98, 0xA3, 0x88, 0x96, 0x78, 0x9C, 0x88, 0xA3, 0x88, 0xAA, 0x89, 0xA4, 0x98, 0x59, 0xA2, 0x99,
+    0xA3, 0x88, 0x95, 0x88, 0x92, 0x88, 0xA5, 0x8A, 0xA5, 0x89, 0xA4, 0x99, 0xA4, 0x89, 0xA2, 0x88,
+    0xC0, 0x59, 0x66, 0x0E, 0x7F, 0x0E, 0x51, 0x54, 0x66, 0x68, 0x9D, 0x86, 0x99, 0x86, 0x9E, 0x76,
+    0x7A, 0xA2, 0x89, 0xA3, 0x9B, 0xA3, 0x8A, 0xA2, 0x9A, 0xA1, 0x8A, 0x7B, 0x1F, 0x6F, 0x66, 0x59,
+    0x2B, 0x1F, 0x98, 0x86, 0x9D, 0x78, 0x66, 0xC0, 0xA1, 0x9A, 0xA2, 0x78, 0x9C, 0x5A, 0x98, 0x5A,
+    0x9A, 0x69, 0xA2, 0x78, 0xAF, 0x88, 0x6F, 0x9A, 0x89, 0x51, 0x7A, 0xA2, 0x87, 0x6B, 0x6E, 0x55,
+    0x51, 0x71, 0x94, 0xAA, 0xA4, 0x99, 0x9B, 0x89, 0x61, 0x9D, 0xB7, 0xA2, 0x98, 0x69, 0x51, 0x61,
+    0x27, 0xA5, 0x98, 0x94, 0x87, 0x5E, 0xA8, 0x79, 0xA1, 0x8A, 0x9C, 0x79, 0xA4, 0x68, 0xAA, 0x79,
+    0xA2, 0x78, 0x9D, 0x78, 0xC0, 0x56, 0x56, 0x61, 0x7A, 0xC0, 0x7F, 0xC1, 0x6F, 0xA2, 0x87, 0xA4,
+    0x97, 0x9D, 0xB8, 0xA7, 0xA8, 0x9B, 0x98, 0x9D, 0x99, 0xA2, 0x78, 0xA5, 0x89, 0x9A, 0x98, 0x91,
+    0x97, 0xBD, 0x97, 0x9E, 0xB6, 0x9C, 0xA7, 0xA3, 0x97, 0xA2, 0x88, 0x6B, 0x65, 0x66, 0x55, 0x66,
+    0xC1, 0x69, 0xC0, 0xA2, 0x4A, 0x9C, 0x88, 0x99, 0x88, 0x51, 0xC0, 0x7F, 0xC3, 0x66, 0xC0, 0x66,
+    0x69, 0x66, 0x35, 0x69, 0x66, 0x69, 0x7F, 0x6E, 0xC1, 0x7F, 0x6E, 0x56, 0xA6, 0x69, 0xAA, 0x68,
+    0xA8, 0xA6, 0x9B, 0x98, 0x99, 0x7A, 0x98, 0x79, 0x91, 0x98, 0xA9, 0x97, 0xA4, 0xA0, 0xA6, 0xB3,
+    0xA4, 0x87, 0xFF, 0x94, 0x48, 0x9E, 0x7F, 0x9C, 0x8B, 0x9C, 0x88, 0xAA, 0x89, 0xA6, 0x88, 0x56,
+    0x9B, 0x88, 0x7E, 0xA3, 0x88, 0x99, 0x99, 0x93, 0x86, 0x9C, 0x86, 0xA5, 0x98, 0xC1, 0x6F, 0x51,
+    0xA2, 0x98, 0x7F, 0x9D, 0x99, 0x51, 0xA3, 0x88, 0x02, 0x66, 0x7F, 0xA3, 0x88, 0xA2, 0x88, 0x59,
+    0x61, 0x69, 0x66, 0xC0, 0x17, 0xC0, 0x64, 0x66, 0x5A, 0x98, 0x89, 0x9A, 0x79, 0xAC, 0x7A, 0xAD,
+    0x8A, 0xA4, 0x89, 0x6E, 0xA5, 0x99, 0xA3, 0x98, 0x51, 0x99, 0x99, 0x96, 0x87, 0xA8, 0x87, 0xA2,
+    0x87, 0x3A, 0x0E, 0x88, 0x89, 0x9B, 0x7A, 0x6F, 0x66, 0x05, 0x6E, 0xC1, 0x7A, 0xC0, 0x6F, 0xC4,
+    0x7A, 0xC0, 0x6E, 0xC1, 0x7A, 0x6E, 0x6E, 0x7F, 0x79, 0x6E, 0x7F, 0x6E, 0x7E, 0xC0, 0x6B, 0xC0,
+    0x1A, 0x21, 0x26, 0x21, 0xC0, 0x1A, 0x5A, 0x12, 0x65, 0x5A, 0xC0, 0x7E, 0x26, 0x6D, 0xA7, 0xA5,
+    0xA5, 0x94, 0x9A, 0x97, 0x67, 0x97, 0x9A, 0x9D, 0x87, 0xA3, 0x78, 0xA2, 0x79, 0x9C, 0x5A, 0xA2,
+    0x66, 0x55, 0x9D, 0x9A, 0x41, 0x7E, 0xA3, 0x89, 0xC0, 0x9D, 0x99, 0xC0, 0x07, 0x66, 0x07, 0xC2,
+    0x02, 0xC1, 0xA2, 0x78, 0xC0, 0x02, 0xC7, 0x66, 0x5E, 0x7F, 0x51, 0x3F, 0xC0, 0x6E, 0x67, 0x3F,
+    0x3A, 0x0E, 0x06, 0x51, 0x66, 0x65, 0x6B, 0xC1, 0x51, 0x65, 0x52, 0x9D, 0x99, 0x71, 0xB7, 0xB9,
+    0xAB, 0x99, 0x61, 0x7F, 0xA2, 0x98, 0x5A, 0x97, 0x88, 0x5A, 0xA5, 0x98, 0xA9, 0x99, 0xC1, 0xA3,
+    0x99, 0xA2, 0x78, 0x98, 0x87, 0x8F, 0x99, 0xA4, 0x88, 0xA5, 0x7A, 0xA6, 0x99, 0xA3, 0x89, 0xA2,
+    0x88, 0x6E, 0xC0, 0x09, 0xC0, 0xA2, 0x88, 0xC0, 0x09, 0x55, 0x65, 0x69, 0x9E, 0x76, 0x99, 0x86,
+    0x9B, 0x86, 0x69, 0xA2, 0x9A, 0xA4, 0x8A, 0xA3, 0x9B, 0xA2, 0x8A, 0xA2, 0x89, 0xC0, 0x6F, 0xC1,
+    0x69, 0x32, 0xA2, 0x87, 0x99, 0x97, 0x98, 0x77, 0xC0, 0x7F, 0x6F, 0xC0, 0x46, 0x9C, 0x79, 0x9B,
+    0x79, 0x9A, 0x5A, 0xA1, 0x7A, 0xAF, 0x98, 0x5A, 0x9A, 0x79, 0xC0, 0x7A, 0x6F, 0xA2, 0x87, 0x5A,
+    0x9D, 0x88, 0x7A, 0x96, 0xA9, 0x73, 0xA2, 0x8A, 0x9B, 0x89, 0x9C, 0xA6, 0x9F, 0xB7, 0x7F, 0xC0,
+    0x18, 0x62, 0xA5, 0x98, 0xAA, 0x86, 0x95, 0x88, 0x9A, 0x89, 0xA3, 0x79, 0xA5, 0x89, 0x9D, 0x79,
+    0x9C, 0x89, 0xA7, 0x89, 0xA5, 0x78, 0xA3, 0x88, 0x56, 0x9F, 0x69, 0x57, 0xC0, 0x7A, 0x7F, 0x6E,
+    0x7F, 0x69, 0x7F, 0xA5, 0xA7, 0x70, 0x9C, 0xA8, 0x7E, 0xA3, 0x89, 0x4B, 0xA4, 0x79, 0x9E, 0x85,
+    0x8B, 0xB7, 0xBD, 0x98, 0x9F, 0xC7, 0x9A, 0xB7, 0xA2, 0x78, 0x7E, 0xC0, 0x66, 0x20, 0x6B, 0x7E,
+    0xC0, 0x6E, 0xC1, 0x9C, 0x49, 0x9B, 0x99, 0x9C, 0x88, 0x6E, 0xC0, 0x6B, 0x7A, 0xC3, 0x66, 0xC0,
+    0x69, 0xC0, 0x7E, 0xC1, 0x69, 0x3D, 0xC0, 0x36, 0xC0, 0x7F, 0x6E, 0x55, 0xA6, 0x6A, 0xAA, 0x68,
+    0xA8, 0xA6, 0x9B, 0x98, 0x99, 0x7A, 0x97, 0x89, 0x92, 0x88, 0xAA, 0x88, 0x97, 0xA4, 0xAA, 0xB2,
+    0xB0, 0x95, 0x9A, 0x7F, 0x35, 0x96, 0x89, 0xA4, 0x89, 0xB1, 0x99, 0x50, 0x6F, 0xA4, 0x88, 0x9B,
+    0x89, 0xA3, 0x99, 0x27, 0x9E, 0x86, 0x8C, 0x87, 0x69, 0x6E, 0xC0, 0x6F, 0xA2, 0x98, 0xA2, 0x88,
+    0x17, 0x51, 0x7F, 0xA5, 0x99, 0xA3, 0x98, 0x55, 0x25, 0xA2, 0x88, 0x7E, 0x55, 0x55, 0x65, 0x51,
+    0x65, 0x03, 0x7E, 0x65, 0xC0, 0x69, 0x41, 0x97, 0x8A, 0xA0, 0x7A, 0xAD, 0x8A, 0x27, 0xA2, 0x78,
+    0xA4, 0x88, 0x9D, 0x98, 0x94, 0x88, 0x9D, 0x89, 0xA2, 0x88, 0xA6, 0x88, 0x9D, 0x98, 0xAA, 0x88,
+    0xA9, 0x96, 0xA9, 0x99, 0x88, 0x79, 0x99, 0x8A, 0xA2, 0x87, 0x5A, 0x7F, 0xC0, 0x66, 0x19, 0xC5,
+    0x1C, 0xC1, 0x6E, 0xC1, 0x7A, 0x6E, 0x7E, 0x3D, 0x7D, 0x7E, 0x6E, 0x7F, 0x6E, 0xC0, 0x1A, 0xC2,
+    0x6B, 0xC0, 0x1A, 0xC0, 0x0B, 0x06, 0x55, 0x6E, 0x6B, 0x0B, 0x1A, 0xA2, 0x78, 0xA2, 0x86, 0xA8,
+    0xA3, 0xA1, 0x94, 0x9E, 0x96, 0x99, 0xAA, 0x99, 0x89, 0x9D, 0x79, 0xA3, 0x6A, 0xA0, 0x59, 0x5F,
+    0x56, 0x51, 0x9D, 0x99, 0x6E, 0xA3, 0x99, 0x56, 0x0F, 0x0A, 0x5A, 0x66, 0x07, 0xC3, 0x02, 0x55,
+    0x02, 0xC4, 0x5A, 0x02, 0x56, 0xC0, 0x7F, 0xC0, 0x51, 0xA2, 0x78, 0x3F, 0x06, 0x3F, 0x6F, 0xC0,
+    0x06, 0xC0, 0x0B, 0x06, 0x51, 0x35, 0x2D, 0x7A, 0xC0, 0x2D, 0x61, 0xC0, 0x56, 0x61, 0x98, 0xA9,
+    0xAA, 0xA9, 0xBA, 0x98, 0x65, 0x76, 0xA3, 0x89, 0x9D, 0x88, 0x96, 0x88, 0xA4, 0x88, 0xAA, 0x88,
+    0xA3, 0x99, 0xC0, 0x6E, 0xA3, 0x99, 0x6E, 0x9B, 0x88, 0x8E, 0x88, 0x03, 0xA5, 0x79, 0xA5, 0x9A,
+    0xA2, 0x89, 0xA2, 0x88, 0x7F, 0xA2, 0x77, 0x6B, 0x3A, 0xA2, 0x88, 0xA2, 0x88, 0x66, 0x51, 0x3A,
+    0x2E, 0x54, 0x9B, 0x86, 0x98, 0x85, 0x54, 0xA3, 0x9B, 0xA5, 0x8A, 0xA3, 0x9C, 0xA1, 0x9A, 0xA2,
+    0x89, 0x7F, 0x6F, 0xC0, 0x59, 0x66, 0x69, 0x6E, 0x9D, 0x97, 0x98, 0x86, 0x51, 0x6B, 0x55, 0xC0,
+    0x51, 0x6B, 0x50, 0x9D, 0x7A, 0x99, 0x6C, 0xA2, 0x79, 0xAE, 0x67, 0x9D, 0x7A, 0x9D, 0x89, 0x5A,
+    0x7F, 0xA2, 0x88, 0x6E, 0x9D, 0x88, 0x50, 0xA0, 0xA9, 0x90, 0xAA, 0xAA, 0x89, 0x9C, 0x8A, 0x9B,
+    0x98, 0x9C, 0xA6, 0xA0, 0xA8, 0xA2, 0x87, 0x66, 0x55, 0x7A, 0xA9, 0x99, 0xA7, 0x97, 0x8F, 0x88,
+    0x98, 0x88, 0xC0, 0xAB, 0x6A, 0xA2, 0x78, 0x99, 0x99, 0x59, 0xA5, 0x89, 0xA5, 0x88, 0xA4, 0x79,
+    0xA0, 0x6A, 0x9E, 0x69, 0x7A, 0xC0, 0x7A, 0xA3, 0x88, 0xC0, 0xA4, 0x98, 0xA1, 0xA6, 0x9A, 0xA7,
+    0x62, 0xA6, 0x78, 0xA3, 0x99, 0x43, 0xA3, 0x79, 0x9F, 0xA5, 0x87, 0xC7, 0xBF, 0x87, 0xA0, 0xB7,
+    0x9B, 0xB8, 0xA2, 0x77, 0x66, 0xC1, 0x7F, 0x6E, 0x7F, 0x6E, 0xC0, 0x7A, 0xC0, 0x95, 0x4A, 0x51,
+    0xC3, 0x6E, 0x32, 0xC0, 0x6F, 0x66, 0x7A, 0xC0, 0x65, 0x6E, 0xC0, 0x7E, 0xC2, 0x55, 0x66, 0x2E,
+    0xA2, 0x98, 0x6F, 0x55, 0xA6, 0x79, 0xAA, 0x78, 0xA6, 0x97, 0x50, 0x97, 0x8A, 0x95, 0x89, 0x96,
+    0x88, 0xA9, 0x88, 0x95, 0xA7, 0xAD, 0xA4, 0xAE, 0x95, 0x98, 0x8D, 0x88, 0x7E, 0x99, 0x88, 0xA6,
+    0x89, 0xB3, 0x98, 0xA8, 0x88, 0x51, 0xA2, 0x78, 0xA5, 0x99, 0x98, 0x88, 0x6E, 0xA6, 0x88, 0x8B,
+    0x97, 0x98, 0x87, 0x7F, 0x69, 0xA2, 0x89, 0xA3, 0x88, 0x7E, 0x6E, 0x26, 0xC0, 0xA5, 0x99, 0xA2,
+    0x88, 0x55, 0x31, 0x7E, 0x59, 0x61, 0xC0, 0x69, 0x51, 0x55, 0x7E, 0xC0, 0x7A, 0x6E, 0x7D, 0xA2,
+    0x77, 0x9C, 0x88, 0x99, 0x8B, 0xA7, 0x9D, 0xAA, 0x7A, 0xA4, 0x88, 0x9A, 0x78, 0x9B, 0x98, 0x6F,
+    0xA8, 0x89, 0xA6, 0x88, 0x6E, 0x98, 0x87, 0x9C, 0x98, 0xA7, 0x97, 0xB2, 0x88, 0x42, 0x87, 0x8A,
+    0x69, 0x6F, 0xC0, 0x7E, 0xC8, 0x66, 0xC0, 0x21, 0xC0, 0x24, 0x6E, 0xC0, 0x7E, 0x7F, 0x6D, 0x7E,
+    0x6E, 0x7E, 0x6F, 0xC7, 0x66, 0x59, 0x0B, 0x55, 0xC0, 0x7E, 0x0B, 0xA2, 0x87, 0x6F, 0xA2, 0x87,
+    0xA2, 0x96, 0xA6, 0xA3, 0xA0, 0x92, 0xA2, 0x96, 0x97, 0x9A, 0x99, 0x7B, 0x9B, 0x6B, 0xA2, 0x49,
+    0xA4, 0x79, 0x46, 0x52, 0x51, 0x65, 0xA2, 0x88, 0xC0, 0x52, 0x55, 0xC2, 0x66, 0x07, 0xC1, 0x02,
+    0x55, 0x6F, 0x02, 0x3F, 0xC0, 0x02, 0x56, 0xC1, 0x66, 0xC1, 0x7F, 0x3A, 0x7F, 0x6E, 0x56, 0xC1,
+    0x6E, 0x06, 0xC0, 0x0B, 0x3A, 0x56, 0x3A, 0x35, 0xC2, 0x52, 0xC1, 0x61, 0x9B, 0x99, 0xA1, 0xB9,
+    0xFF, 0xBD, 0x91, 0xA2, 0x88, 0x66, 0xA2, 0x98, 0x9B, 0x89, 0x99, 0x78, 0xAB, 0x99, 0xA5, 0x98,
+    0xC1, 0x7F, 0xA3, 0x88, 0xA2, 0x88, 0x9D, 0x88, 0x8E, 0x88, 0x51, 0xA4, 0x89, 0xA4, 0x79, 0xA2,
+    0x89, 0xA2, 0x88, 0x12, 0xA2, 0x88, 0x7F, 0xC0, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0x56, 0x51, 0x65,
+    0x50, 0x9D, 0x87, 0x98, 0x75, 0x9D, 0x86, 0xA3, 0x9A, 0xA5, 0x9B, 0xA3, 0x9B, 0xA2, 0x8A, 0xA2,
+    0x98, 0x6B, 0xA1, 0x8A, 0x6E, 0x69, 0x65, 0xC0, 0x5A, 0x78, 0x9A, 0x86, 0x9B, 0x88, 0xC0, 0x9D,
+    0x89, 0x65, 0x9B, 0x99, 0x6E, 0x7F, 0x22, 0x57, 0x9A, 0x79, 0xA2, 0x69, 0xAA, 0x5A, 0x4B, 0x9E,
+    0x69, 0x7A, 0x6E, 0xA2, 0x88, 0x15, 0x9D, 0x88, 0xA1, 0xA8, 0x94, 0xA9, 0x9A, 0xA9, 0xAE, 0x7A,
+    0x97, 0x8A, 0x9C, 0x87, 0x9E, 0xB6, 0xA1, 0xA9, 0xC0, 0x55, 0x7A, 0x7A, 0xAB, 0x98, 0xA2, 0x86,
+    0x8C, 0x88, 0x99, 0x99, 0xA2, 0x78, 0xA9, 0x7A, 0xA7, 0x89, 0x9C, 0x77, 0x9B, 0x88, 0x7F, 0xA5,
+    0x89, 0xA6, 0x78, 0xA1, 0x6A, 0x47, 0xC0, 0x7F, 0xA3, 0x98, 0x7A, 0x74, 0x1A, 0xA3, 0x98, 0xAE,
+    0x68, 0x42, 0xA1, 0x9A, 0x66, 0xA4, 0x78, 0x9C, 0xB6, 0x24, 0xFF, 0x84, 0x72, 0xA3, 0xB7, 0x9B,
+    0x98, 0x7E, 0xC1, 0x6B, 0xA2, 0x87, 0x7F, 0x6E, 0xC1, 0x7A, 0x6E, 0x90, 0x4A, 0xA3, 0x88, 0x7F,
+    0x56, 0x37, 0x7B, 0x55, 0xC0, 0x01, 0x56, 0x65, 0xC1, 0x7F, 0xA2, 0x87, 0xC0, 0x7F, 0x6E, 0xC0,
+    0xA4, 0x88, 0xA6, 0x88, 0x65, 0x9D, 0x89, 0x97, 0x98, 0x9D, 0x99, 0xA4, 0x88, 0x9C, 0x79, 0x39,
+    0x64, 0xA2, 0x88, 0x99, 0x99, 0x9D, 0x89, 0x39, 0x6F, 0x69, 0x9E, 0x96, 0xA2, 0x97, 0xA2, 0x7A,
+    0x9C, 0x8A, 0x6B, 0x98, 0x87, 0xA4, 0x88, 0xB2, 0x89, 0xA5, 0x99, 0x9C, 0x78, 0x51, 0xA3, 0x98,
+    0xA3, 0x89, 0x59, 0x99, 0x98, 0x0C, 0xA4, 0x87, 0xA4, 0x88, 0x9D, 0x99, 0x51, 0xA3, 0x88, 0x2D,
+    0x99, 0x99, 0xA2, 0x87, 0xA4, 0x88, 0x66, 0x51, 0x21, 0xC1, 0xA2, 0x88, 0x55, 0x7E, 0x7E, 0x03,
+    0x6E, 0x7E, 0xA3, 0x96, 0xA4, 0x87, 0xA2, 0x87, 0x6C, 0xA3, 0x89, 0x9A, 0x9C, 0x99, 0x8E, 0xA4,
+    0x8B, 0x9D, 0x88, 0x99, 0x78, 0xA6, 0x88, 0xA4, 0x89, 0xA9, 0x9A, 0x65, 0xA4, 0x78, 0x97, 0x97,
+    0x94, 0x88, 0xAF, 0xA8, 0xAA, 0x79, 0xB3, 0x87, 0x8A, 0x8A, 0x91, 0x88, 0xA3, 0x88, 0xC0, 0x6F,
+    0xC1, 0x30, 0x2D, 0xC1, 0x21, 0xC4, 0x29, 0xC1, 0x6E, 0x7A, 0x7E, 0xA2, 0x77, 0x7D, 0x6B, 0x7E,
+    0x6E, 0xC0, 0x6F, 0x7A, 0x6F, 0xC0, 0x27, 0x56, 0x18, 0x13, 0x5A, 0x04, 0xC0, 0x56, 0xC0, 0x04,
+    0x18, 0xA2, 0x77, 0x7F, 0x6F, 0xA3, 0xA6, 0xA6, 0xA2, 0xA1, 0xA3, 0x9D, 0x97, 0x98, 0x8A, 0x99,
+    0x7B, 0x9B, 0x5A, 0xA6, 0x5A, 0xA2, 0x69, 0x52, 0x9D, 0x99, 0x51, 0x6E, 0x2A, 0x1B, 0x52, 0xC1,
+    0x65, 0x5A, 0x02, 0xC1, 0x6E, 0x02, 0xC1, 0x56, 0xC2, 0x02, 0x3A, 0x7A, 0x6B, 0x51, 0xA2, 0x78,
+    0xC0, 0x7E, 0x5A, 0xC1, 0x01, 0x06, 0x6B, 0x55, 0x66, 0x65, 0x6E, 0x06, 0x61, 0x2D, 0x30, 0x6F,
+    0xC0, 0x30, 0xC0, 0x51, 0x9D, 0x99, 0x9A, 0xA9, 0xB6, 0xA9, 0xAC, 0xA8, 0x51, 0x7F, 0x9A, 0x88,
+    0xA3, 0x78, 0xA6, 0x98, 0x6E, 0x7A, 0xC0, 0xA2, 0x88, 0xA2, 0x88, 0xA3, 0x88, 0x51, 0x8F, 0x79,
+    0x51, 0xA3, 0x99, 0xA4, 0x79, 0xA1, 0x9A, 0xA2, 0x88, 0xA2, 0x88, 0x6F, 0x7E, 0x6F, 0xA2, 0x88,
+    0x7F, 0xA2, 0x88, 0x65, 0x55, 0x52, 0x54, 0x50, 0x9A, 0x75, 0x99, 0x86, 0x7B, 0xA6, 0x8A, 0xA5,
+    0x9B, 0xA2, 0x9A, 0xA2, 0x89, 0x6F, 0xC0, 0x6F, 0x6D, 0x66, 0x01, 0x5A, 0x0E, 0x9D, 0x97, 0x97,
+    0x87, 0x55, 0x19, 0x0A, 0x9D, 0x88, 0x66, 0xC1, 0x61, 0x46, 0x9C, 0x69, 0xA5, 0x79, 0xA7, 0x7B,
+    0xA1, 0x6A, 0x56, 0x51, 0xA4, 0x88, 0x56, 0x9C, 0x78, 0x51, 0x9C, 0x97, 0x8C, 0xD8, 0xAE, 0x6B,
+    0xA8, 0x7A, 0x95, 0x79, 0x9D, 0xB8, 0x9D, 0xB8, 0xA2, 0x98, 0xC0, 0x65, 0x6E, 0x76, 0xAE, 0x96,
+    0xA2, 0x87, 0x8A, 0x78, 0x9A, 0x88, 0x66, 0xA4, 0x78, 0xA9, 0x89, 0xA3, 0x79, 0x9A, 0x88, 0x9D,
+    0x88, 0xA4, 0x78, 0xA4, 0x88, 0xA3, 0x89, 0xA0, 0x7A, 0x7E, 0x6E, 0x71, 0x9D, 0x97, 0x60, 0x99,
+    0x98, 0xB4, 0x69, 0xA5, 0x6A, 0x52, 0x7A, 0xA5, 0x99, 0x96, 0xB6, 0x86, 0xB6, 0xFF, 0x7C, 0x31,
+    0xA5, 0xB7, 0x9A, 0x97, 0xC0, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0xC0, 0x6E, 0xC0, 0x7A, 0xC0, 0xA6,
+    0x39, 0xA5, 0x99, 0xA4, 0x88, 0x9A, 0x88, 0x99, 0x89, 0x65, 0xC0, 0xA6, 0x88, 0x2B, 0x9A, 0x99,
+    0xA2, 0x88, 0xA2, 0x88, 0x7E, 0xA2, 0x89, 0x69, 0x7F, 0x6E, 0xA3, 0x98, 0xA4, 0x88, 0xA5, 0x89,
+    0xA3, 0x98, 0x15, 0x91, 0x89, 0x9C, 0x88, 0x9C, 0x99, 0x9C, 0x88, 0x9D, 0x88, 0x5A, 0xA5, 0x99,
+    0x50, 0x00, 0xA3, 0x98, 0x24, 0x9A, 0x87, 0xA2, 0x88, 0x9C, 0x89, 0x7A, 0x30, 0xA3, 0x89, 0x61,
+    0x9B, 0x88, 0x96, 0x88, 0x30, 0xAB, 0x89, 0x52, 0x7E, 0x9A, 0x88, 0xA3, 0x89, 0xA6, 0x88, 0x99,
+    0x88, 0x90, 0x98, 0x17, 0xA6, 0x87, 0x98, 0x88, 0x51, 0x51, 0x6F, 0xA4, 0x87, 0x28, 0xC0, 0x7F,
+    0x40, 0x14, 0xC0, 0xA3, 0x89, 0x3C, 0xC0, 0x69, 0x9A, 0x98, 0xC0, 0x6D, 0xA2, 0x88, 0xA2, 0x87,
+    0xA3, 0x97, 0xA3, 0x87, 0xA4, 0x87, 0xA6, 0x87, 0xA8, 0x8B, 0x91, 0x8C, 0x95, 0x9A, 0x99, 0x89,
+    0xA3, 0x78, 0xAA, 0x99, 0xA8, 0x78, 0xA6, 0x9A, 0x51, 0xA2, 0x78, 0x10, 0x95, 0x99, 0xB1, 0x98,
+    0xAE, 0x89, 0xAF, 0x87, 0x9A, 0x88, 0x87, 0x89, 0x51, 0x6F, 0x6E, 0xC3, 0x30, 0xC1, 0x59, 0xC0,
+    0x66, 0xC0, 0x29, 0xC2, 0x6E, 0x7A, 0x6E, 0x7D, 0x7E, 0x6E, 0x7F, 0x6E, 0xA2, 0x87, 0x6B, 0x6E,
+    0x7F, 0xC0, 0x2C, 0x66, 0x18, 0xC0, 0x55, 0x04, 0x55, 0xC1, 0x6E, 0xA2, 0x88, 0xA2, 0x88, 0x7E,
+    0x6F, 0x7F, 0xA4, 0x86, 0xA4, 0xB2, 0xA1, 0xA3, 0x9C, 0x86, 0x97, 0x9C, 0x99, 0x6B, 0xA0, 0x4A,
+    0xA5, 0x6A, 0x56, 0x9C, 0x89, 0x9D, 0x99, 0x6E, 0x7F, 0x16, 0xC0, 0x56, 0x55, 0xC0, 0x66, 0x3F,
+    0x3A, 0x7E, 0xC2, 0x3A, 0xC0, 0x69, 0x66, 0xC0, 0x3A, 0x2E, 0x6B, 0x7F, 0x35, 0xC0, 0x6F, 0xC2,
+    0x6E, 0xC0, 0x56, 0x01, 0x56, 0x65, 0x6E, 0x01, 0xA2, 0x88, 0x01, 0x9C, 0x99, 0xA3, 0x88, 0x04,
+    0x01, 0x3C, 0x65, 0x56, 0x61, 0x99, 0x99, 0xAA, 0xA8, 0xB6, 0xBA, 0x7A, 0x66, 0x9D, 0x78, 0xA7,
+    0x98, 0xC0, 0x69, 0x6F, 0x7A, 0xA2, 0x78, 0xA2, 0x98, 0xA3, 0x88, 0x55, 0x8F, 0x89, 0x41, 0xA1,
+    0x9A, 0xA4, 0x89, 0xA4, 0x89, 0xA3, 0x88, 0x7F, 0xC0, 0x6F, 0x7F, 0x7F, 0xA2, 0x77, 0x7F, 0xC0,
+    0x56, 0x51, 0x32, 0x17, 0x9D, 0x87, 0x98, 0x86, 0x9D, 0x87, 0xA5, 0x9A, 0xA6, 0x9A, 0x17, 0xA1,
+    0x9A, 0xA2, 0x89, 0x0D, 0xC2, 0x01, 0x56, 0x01, 0xA4, 0x86, 0x96, 0x86, 0x9A, 0x88, 0x55, 0x0A,
+    0x9D, 0x99, 0xC0, 0x55, 0x31, 0x22, 0x51, 0x9B, 0x79, 0xA2, 0x89, 0xA3, 0x88, 0x9C, 0x6A, 0xA5,
+    0x79, 0x9D, 0x8A, 0xA7, 0x89, 0xA6, 0x69, 0x9D, 0x89, 0x9B, 0x88, 0x9D, 0xA8, 0x8D, 0xC8, 0x9C,
+    0x9A, 0xB5, 0x6C, 0x9E, 0x68, 0x97, 0x99, 0x71, 0x70, 0xA2, 0x98, 0xC1, 0x7E, 0x7A, 0xAB, 0x97,
+    0xA6, 0x86, 0x8C, 0x78, 0x98, 0x88, 0x55, 0x66, 0xA7, 0x8A, 0xA8, 0x78, 0x9D, 0x89, 0x9A, 0x87,
+    0x52, 0xA4, 0x77, 0xA4, 0x89, 0xA2, 0x97, 0x65, 0x9D, 0x99, 0x9D, 0x88, 0x9C, 0x97, 0x9B, 0xA8,
+    0xAD, 0x5A, 0xB4, 0x5A, 0x9D, 0x8A, 0x7A, 0xA6, 0x87, 0x8E, 0xD6, 0x8C, 0xA6, 0x82, 0x78, 0xA3,
+    0xA8, 0x9B, 0xA7, 0xC0, 0x6E, 0x7F, 0x7F, 0x6E, 0x6B, 0x7E, 0x6E, 0xC1, 0x7A, 0xAB, 0x6B, 0x9B,
+    0x98, 0x9B, 0x89, 0x2F, 0xA6, 0x78, 0x98, 0x87, 0xA3, 0x99, 0x96, 0x98, 0x9D, 0x89, 0x99, 0x88,
+    0x51, 0xA5, 0x88, 0xA5, 0x99, 0xA2, 0x88, 0x9C, 0x88, 0x3C, 0xA5, 0x98, 0x08, 0xA8, 0x88, 0x69,
+    0x9D, 0x99, 0x30, 0x95, 0x89, 0x28, 0x99, 0x99, 0x51, 0xA7, 0x88, 0x24, 0x65, 0xC0, 0x04, 0x6F,
+    0x9D, 0x99, 0x54, 0xA2, 0x89, 0x37, 0x9D, 0x99, 0x9C, 0x87, 0x04, 0x9C, 0x88, 0x99, 0x89, 0x61,
+    0xA5, 0x88, 0x37, 0xA9, 0x89, 0xA5, 0x98, 0x98, 0x88, 0x13, 0xC0, 0x40, 0x96, 0x98, 0x7F, 0x7E,
+    0xC0, 0xA4, 0x87, 0x6F, 0x9D, 0x98, 0x56, 0x04, 0x18, 0x9C, 0x98, 0x98, 0x78, 0xA4, 0x98, 0x6E,
+    0x51, 0x9C, 0x88, 0x33, 0x51, 0x9B, 0x88, 0x3C, 0x6B, 0x3C, 0x9D, 0x99, 0x9B, 0x98, 0x6E, 0x7E,
+    0x6D, 0x6E, 0xA2, 0x89, 0xA1, 0x8A, 0x97, 0x99, 0xA2, 0x78, 0x1C, 0xB0, 0x89, 0x9B, 0x8A, 0x13,
+    0xA2, 0x88, 0x99, 0x88, 0x98, 0x97, 0xAC, 0x98, 0xB1, 0x99, 0xA2, 0x87, 0x98, 0x68, 0xC0, 0x1C,
+    0xA2, 0x88, 0xA2, 0x77, 0x7B, 0xC1, 0x3A, 0x35, 0xC1, 0x30, 0x69, 0x56, 0x29, 0xC2, 0x69, 0x6F,
+    0x7A, 0x6E, 0x79, 0x6D, 0xA2, 0x88, 0x6E, 0xA2, 0x87, 0xA2, 0x88, 0xC0, 0x7F, 0xC2, 0x56, 0x65,
+    0x52, 0x09, 0x04, 0x55, 0xC1, 0x6E, 0xA2, 0x87, 0x16, 0x2A, 0x6F, 0x39, 0x6F, 0xA3, 0x97, 0xA6,
+    0xB2, 0x9F, 0xA3, 0x98, 0x99, 0x9B, 0x5B, 0x95, 0x4B, 0xAA, 0x6A, 0x6B, 0x9D, 0x88, 0x9B, 0x99,
+    0x6E, 0x6F, 0x16, 0x5A, 0x62, 0x55, 0x09, 0xC0, 0x3A, 0xC0, 0x69, 0x6F, 0x3A, 0x33, 0x52, 0x3A,
+    0x33, 0x66, 0xC0, 0x3A, 0x2E, 0x66, 0x6F, 0x6F, 0x66, 0x01, 0x35, 0xA2, 0x78, 0xC0, 0x15, 0x5A,
+    0x51, 0x01, 0xC0, 0x51, 0x6F, 0xA2, 0x88, 0x7F, 0x65, 0x9A, 0x88, 0x3C, 0x7E, 0x3C, 0x65, 0x6B,
+    0x30, 0x61, 0x9C, 0x98, 0x9B, 0x9A, 0xB5, 0xB9, 0xAC, 0x99, 0x51, 0x54, 0xA7, 0x98, 0x66, 0xC0,
+    0x0D, 0x7B, 0xA2, 0x78, 0xA2, 0x98, 0xA2, 0x78, 0x7E, 0x90, 0x77, 0x9C, 0x89, 0x6B, 0xA4, 0x8A,
+    0xA5, 0x89, 0xA3, 0x99, 0xA2, 0x78, 0xC0, 0x6B, 0xA2, 0x88, 0x7F, 0xA2, 0x87, 0x6F, 0x7A, 0x56,
+    0x1C, 0x50, 0x9D, 0x88, 0x9E, 0x86, 0x9B, 0x87, 0x07, 0x7F, 0xA6, 0x99, 0xA4, 0x8A, 0xA1, 0x9A,
+    0xA2, 0x88, 0x6F, 0x0D, 0xC1, 0x01, 0xC0, 0x51, 0x1D, 0x9B, 0x86, 0x99, 0x88, 0x3E, 0x9D, 0x98,
+    0x9D, 0x99, 0x59, 0x66, 0xC0, 0x65, 0x9C, 0x89, 0x9C, 0x89, 0x59, 0xA7, 0x88, 0x99, 0x78, 0x45,
+    0x9D, 0x7B, 0xA6, 0x79, 0xAB, 0x8A, 0xA3, 0x8A, 0x9C, 0x79, 0x9B, 0x98, 0x8E, 0xB7, 0x98, 0xA9,
+    0xA6, 0x7B, 0xB4, 0x5A, 0x98, 0x69, 0x99, 0xA9, 0x9D, 0xB7, 0x9F, 0xB8, 0xA3, 0x99, 0x69, 0xC0,
+    0x6F, 0x79, 0xAC, 0x96, 0xA7, 0x88, 0x8C, 0x87, 0x99, 0x89, 0x51, 0x9C, 0x88, 0x6F, 0xA8, 0x79,
+    0xA5, 0x89, 0x9C, 0x97, 0x51, 0x69, 0x41, 0x3F, 0x69, 0x66, 0xA2, 0x87, 0xC0, 0x33, 0xB3, 0x6B,
+    0x1A, 0x50, 0xA3, 0xC7, 0x87, 0xC7, 0x97, 0x97, 0x84, 0x77, 0xA3, 0xB9, 0x99, 0x97, 0xC0, 0x6B,
+    0x7E, 0x6E, 0x1B, 0xC0, 0x6F, 0x7E, 0x6E, 0xC1, 0x94, 0x7B, 0x9D, 0x98, 0xC0, 0x0E, 0xC0, 0x51,
+    0x2E, 0xA5, 0x89, 0x0E, 0xA4, 0x88, 0x65, 0xC0, 0x55, 0xA2, 0x88, 0xA2, 0x88, 0x6F, 0xA4, 0x87,
+    0xB1, 0x89, 0xA4, 0x88, 0x7E, 0x8C, 0x88, 0x97, 0x88, 0x9D, 0x99, 0x6F, 0x9D, 0x99, 0x22, 0xC0,
+    0x3F, 0x24, 0x98, 0x88, 0xA6, 0x98, 0xA5, 0x89, 0x9D, 0x98, 0x6F, 0xC0, 0x0F, 0x13, 0x18, 0xA3,
+    0x99, 0x27, 0x9B, 0x89, 0x9D, 0x98, 0x9D, 0x88, 0xA7, 0x89, 0xAA, 0x99, 0x9B, 0x89, 0xA5, 0x88,
+    0xC0, 0x5A, 0x61, 0x9A, 0x87, 0x3F, 0x0E, 0x9A, 0x88, 0x9B, 0x88, 0xA4, 0x88, 0xA8, 0x88, 0x55,
+    0xA2, 0x98, 0x0C, 0x13, 0x17, 0x6E, 0x9D, 0x98, 0xA3, 0x88, 0xA2, 0x88, 0x9D, 0x99, 0xA5, 0x99,
+    0x59, 0x15, 0x12, 0x03, 0xC0, 0x2B, 0x3F, 0x03, 0xA5, 0x98, 0x9C, 0x87, 0x6B, 0x3C, 0x52, 0x7F,
+    0x5A, 0xA8, 0x88, 0xAA, 0x89, 0x9D, 0x88, 0xA3, 0x89, 0x93, 0x98, 0xA2, 0x87, 0xAD, 0xA8, 0xA9,
+    0x98, 0x89, 0x88, 0xA9, 0x88, 0xB4, 0x89, 0x93, 0x8A, 0x97, 0x88, 0x56, 0xA2, 0x87, 0x6B, 0xC1,
+    0x3D, 0x38, 0x5A, 0xC0, 0x30, 0x55, 0xC0, 0x7E, 0xC1, 0x69, 0xC0, 0x6F, 0x7A, 0x68, 0xA2, 0x87,
+    0xA2, 0x88, 0xA2, 0x87, 0xA3, 0x88, 0x7E, 0x6F, 0xC0, 0x66, 0xC1, 0x2A, 0x56, 0x11, 0x56, 0x65,
+    0x56, 0x69, 0x66, 0x2E, 0xA2, 0x88, 0xA2, 0x87, 0x6F, 0x2A, 0x39, 0x6F, 0xC0, 0xA3, 0x96, 0xA6,
+    0xB3, 0x9A, 0xA5, 0x9D, 0x78, 0x8E, 0x3C, 0xA4, 0x5B, 0xA9, 0x88, 0x9D, 0x99, 0x9B, 0x88, 0x11,
+    0xA3, 0x88, 0xC0, 0x42, 0x06, 0x65, 0x06, 0x7E, 0x3A, 0x66, 0x55, 0x7E, 0xC0, 0x5A, 0x26, 0xA2,
+    0x87, 0x3A, 0x2E, 0x3A, 0xC0, 0x2E, 0x67, 0x35, 0x6B, 0xC1, 0x55, 0x3C, 0x6E, 0x6F, 0xC0, 0x51,
+    0x6E, 0x39, 0x51, 0x39, 0x7F, 0x0D, 0x08, 0x9A, 0x98, 0xA3, 0x88, 0x3C, 0xC0, 0x30, 0xC0, 0x66,
+    0x69, 0x61, 0x99, 0x99, 0xA2, 0x99, 0xAC, 0x99, 0x65, 0xAE, 0x98, 0xA8, 0x88, 0x7E, 0xC1, 0x7B,
+    0xA2, 0x77, 0xA2, 0x89, 0xA2, 0x88, 0xA2, 0x87, 0x91, 0x88, 0x9A, 0x88, 0x5B, 0xA4, 0x9B, 0xA5,
+    0x89, 0xA3, 0x99, 0xA2, 0x78, 0xC0, 0x7F, 0x6F, 0xA2, 0x88, 0xA2, 0x88, 0x7F, 0xC1, 0x9D, 0x98,
+    0x0D, 0x9D, 0x98, 0x9C, 0x86, 0x9D, 0x88, 0x9D, 0x87, 0x65, 0xA2, 0x8A, 0xA4, 0x9A, 0xA3, 0x89,
+    0xA2, 0x89, 0xA2, 0x88, 0xC0, 0x0D, 0x69, 0x01, 0xC0, 0x34, 0x06, 0x64, 0x9B, 0x87, 0x9C, 0x88,
+    0x9D, 0x98, 0x9D, 0x88, 0x66, 0x55, 0xC0, 0x51, 0x9C, 0x99, 0x9D, 0x89, 0x9A, 0x88, 0xAB, 0x77,
+    0xA2, 0x76, 0x9C, 0x78, 0x42, 0x9A, 0x7A, 0xA2, 0x79, 0xAB, 0x8A, 0xA5, 0x79, 0x99, 0x99, 0x8D,
+    0xB9, 0x77, 0x9C, 0x89, 0xAA, 0x69, 0xB0, 0x6B, 0x96, 0x79, 0x9A, 0xA8, 0x9D, 0xA7, 0xA0, 0xA7,
+    0xA2, 0x99, 0x6E, 0xC0, 0x79, 0x6E, 0xAC, 0x97, 0xA8, 0x97, 0x8B, 0x88, 0x9A, 0x77, 0x66, 0x9D,
+    0x89, 0x9D, 0x99, 0xA2, 0x79, 0xAA, 0x97, 0xA5, 0x88, 0x99, 0x88, 0x44, 0x62, 0x55, 0x51, 0xA5,
+    0x89, 0x51, 0x9B, 0xA9, 0xA2, 0x78, 0xB8, 0x5A, 0x76, 0x93, 0xB7, 0x8D, 0xB8, 0x6D, 0x82, 0x98,
+    0xA6, 0x97, 0x98, 0x98, 0x55, 0x6B, 0x07, 0xC0, 0x6F, 0x7E, 0x6F, 0x7E, 0xC0, 0x6E, 0xC0, 0x95,
+    0x8B, 0x41, 0xA2, 0x88, 0xAA, 0x88, 0xA5, 0x98, 0x98, 0x89, 0x9C, 0x87, 0x7F, 0xC0, 0x41, 0x13,
+    0xA7, 0x98, 0x52, 0x9C, 0x88, 0x7E, 0xA3, 0x88, 0xA7, 0x89, 0xA9, 0x88, 0xAC, 0x87, 0x92, 0x89,
+    0x89, 0x98, 0x18, 0xAC, 0x98, 0x9B, 0x89, 0x2A, 0x3F, 0x99, 0x88, 0x51, 0x7F, 0x34, 0xA8, 0x88,
+    0x62, 0x34, 0x2F, 0x22, 0x27, 0x9D, 0x98, 0x16, 0x18, 0xA3, 0x99, 0x99, 0x88, 0x95, 0x89, 0xA6,
+    0x98, 0xA4, 0x78, 0xA8, 0x88, 0x9C, 0x89, 0x7F, 0xA9, 0x88, 0x9A, 0x88, 0x51, 0x7E, 0x9B, 0x98,
+    0x9C, 0x88, 0x2F, 0x30, 0x18, 0x66, 0x18, 0x30, 0x66, 0x2F, 0x03, 0x24, 0xA6, 0x88, 0x51, 0x9D,
+    0x99, 0x97, 0x88, 0xA7, 0x99, 0x1C, 0x56, 0x13, 0x2B, 0x18, 0x23, 0x95, 0x89, 0x17, 0xA5, 0x88,
+    0x13, 0x2B, 0x2F, 0x66, 0xC0, 0x6F, 0xAE, 0x88, 0xA7, 0x89, 0x9A, 0x88, 0x6E, 0x8E, 0x87, 0xAD,
+    0x98, 0xA1, 0xA8, 0x9C, 0x78, 0x9B, 0x98, 0xA8, 0x88, 0xAB, 0x88, 0xB7, 0x8A, 0x95, 0x88, 0x95,
+    0x88, 0x9D, 0x99, 0x9D, 0x89, 0x56, 0x65, 0xC0, 0x6B, 0xC0, 0x55, 0x61, 0xC0, 0x5A, 0x7E, 0xC2,
+    0x69, 0x29, 0x7E, 0xA2, 0x87, 0xA2, 0x87, 0xA2, 0x87, 0xA3, 0x88, 0x0D, 0x6E, 0xC0, 0x65, 0x66,
+    0x5A, 0xC0, 0x65, 0x51, 0x51, 0x55, 0x66, 0x56, 0x69, 0x66, 0x5A, 0xA2, 0x87, 0xA2, 0x88, 0x7F,
+    0xA2, 0x88, 0xA1, 0x9A, 0x6B, 0x6E, 0x00, 0xA6, 0x84, 0xA4, 0xB3, 0x9A, 0xA5, 0x92, 0x4B, 0x95,
+    0x5D, 0xAE, 0x78, 0x51, 0x9D, 0x88, 0x42, 0xA2, 0x88, 0xA2, 0x88, 0x55, 0x9D, 0x89, 0x66, 0x69,
+    0x06, 0xC0, 0x51, 0x65, 0xC0, 0x56, 0x26, 0x55, 0x1E, 0x3A, 0x55, 0x3A, 0xC2, 0x32, 0x66, 0x32,
+    0xC0, 0x2D, 0x6F, 0xC2, 0x25, 0xA2, 0x78, 0x39, 0x56, 0xA2, 0x98, 0x6F, 0x7F, 0x61, 0x9B, 0x99,
+    0x7E, 0xA3, 0x78, 0xC0, 0x69, 0x65, 0x65, 0xA2, 0x88, 0x9D, 0x99, 0x9D, 0x98, 0x66, 0x9B, 0x9A,
+    0x61, 0xB7, 0xA8, 0xAF, 0x99, 0xA2, 0x87, 0x66, 0x76, 0x6E, 0x6F, 0xA2, 0x88, 0xA2, 0x88, 0xA4,
+    0x77, 0x93, 0x88, 0x97, 0x9A, 0x6F, 0xA4, 0x8A, 0xA4, 0x89, 0xA2, 0x89, 0xA2, 0x88, 0x6F, 0xC0,
+    0xA2, 0x89, 0xA3, 0x98, 0xC0, 0x7F, 0x6E, 0xC0, 0x30, 0x51, 0x50, 0x9B, 0x88, 0x9C, 0x87, 0x9E,
+    0x86, 0xC0, 0x00, 0xA2, 0x99, 0xA2, 0x8A, 0x19, 0xA2, 0x89, 0x7E, 0x01, 0xC0, 0x56, 0x2D, 0xC0,
+    0x01, 0x9C, 0x87, 0x9C, 0x87, 0x50, 0x61, 0x40, 0x51, 0x55, 0x66, 0x50, 0x9B, 0x9A, 0x9A, 0x89,
+    0x98, 0x78, 0xAD, 0x77, 0xAB, 0x86, 0x9C, 0x67, 0xC0, 0x9B, 0x8A, 0x99, 0x8A, 0x9D, 0x7A, 0xA1,
+    0x9A, 0xA2, 0x88, 0x9D, 0xAA, 0x52, 0x63, 0x9B, 0x89, 0xAD, 0x6A, 0xAC, 0x7A, 0x94, 0x79, 0x9C,
+    0xA8, 0x9C, 0xA6, 0xA1, 0xA8, 0xA3, 0x99, 0xC0, 0x79, 0x6E, 0x7E, 0xAD, 0x98, 0xA2, 0x87, 0x8D,
+    0x98, 0x55, 0x56, 0x9C, 0x98, 0x9C, 0x78, 0xA5, 0x98, 0xB0, 0x88, 0x97, 0x78, 0xA2, 0x76, 0x56,
+    0x9B, 0x9A, 0xC0, 0xA5, 0x89, 0x9C, 0x89, 0x9D, 0x98, 0x9B, 0xA8, 0xC0, 0x7F, 0x99, 0xA8, 0x69,
+    0xA5, 0x98, 0xBA, 0x98, 0xA9, 0x98, 0x99, 0x98, 0x66, 0x5A, 0x07, 0x0C, 0x6B, 0x7E, 0x6E, 0x6B,
+    0xC0, 0x7E, 0xC0, 0xA0, 0x7A, 0x96, 0x78, 0x9D, 0x99, 0xA7, 0x88, 0x13, 0xA8, 0x88, 0x9D, 0x98,
+    0x9A, 0x89, 0x23, 0xA3, 0x98, 0x93, 0x89, 0x65, 0xA4, 0x88, 0xA5, 0x89, 0x03, 0xA4, 0x88, 0xA8,
+    0x88, 0xC0, 0xA3, 0x88, 0x33, 0x41, 0xA3, 0x98, 0x1B, 0x99, 0x89, 0x51, 0x65, 0x56, 0x55, 0x03,
+    0x33, 0x3F, 0x17, 0xA5, 0x88, 0x9D, 0x99, 0xA2, 0x98, 0x0E, 0xC0, 0x9D, 0x98, 0x55, 0x9B, 0x88,
+    0x9D, 0x89, 0x66, 0xC0, 0x41, 0xAC, 0x88, 0xA7, 0x99, 0x51, 0xA8, 0x78, 0x1F, 0x9D, 0x89, 0x33,
+    0x9A, 0x88, 0x0C, 0xA6, 0x88, 0xA9, 0x99, 0x17, 0x9D, 0x88, 0x7F, 0x65, 0x03, 0x37, 0x9D, 0x88,
+    0x66, 0x14, 0xC0, 0x0F, 0xA2, 0x88, 0x14, 0xA6, 0x88, 0xA3, 0x99, 0xC0, 0x03, 0x3F, 0xA8, 0x88,
+    0x27, 0x2B, 0x04, 0xA5, 0x99, 0x17, 0xC0, 0x2B, 0x17, 0x03, 0xAB, 0x89, 0x1F, 0xA6, 0x89, 0x33,
+    0x89, 0x87, 0xA6, 0x87, 0x9A, 0xA8, 0xA3, 0x89, 0xB9, 0x99, 0x9B, 0x88, 0x9C, 0x88, 0x81, 0x88,
+    0xA4, 0x79, 0x69, 0x51, 0x9B, 0x89, 0x39, 0x9B, 0x99, 0x9B, 0x88, 0x9D, 0x89, 0x51, 0x7E, 0xC0,
+    0x9C, 0x89, 0x51, 0x29, 0x51, 0x21, 0x6E, 0x29, 0x6E, 0xA1, 0xA9, 0xA2, 0x87, 0xA3, 0x87, 0xA3,
+    0x98, 0xA2, 0x77, 0xA2, 0x98, 0xA2, 0x87, 0xC0, 0x56, 0x51, 0x65, 0x6E, 0x52, 0x50, 0x51, 0x55,
+    0x65, 0x5A, 0x66, 0xC0, 0x69, 0x2C, 0xA2, 0x88, 0x7E, 0xA2, 0x88, 0x7F, 0x39, 0x6B, 0xC0, 0x68,
+    0xAB, 0xA3, 0x9D, 0xB3, 0x96, 0x89, 0x90, 0x3E, 0xA2, 0x6B, 0xA7, 0x89, 0x50, 0x1D, 0x65, 0xA2,
+    0x78, 0x1A, 0x66, 0x55, 0x9D, 0x99, 0x55, 0xA2, 0x88, 0x1E, 0x2D, 0x1E, 0xC1, 0x66, 0x55, 0x2D,
+    0xC2, 0x7E, 0x32, 0xC0, 0x55, 0xC0, 0x2D, 0x6F, 0xC1, 0x6B, 0x51, 0x6E, 0x00, 0x6E, 0xC0, 0x7F,
+    0x7B, 0xC0, 0x61, 0x9C, 0x99, 0xA2, 0x87, 0x5E, 0x7A, 0x6E, 0x6D, 0xC0, 0x65, 0x65, 0x51, 0x66,
+    0xC0, 0x9A, 0x88, 0xA4, 0xA9, 0xB8, 0xA9, 0xA7, 0x98, 0x7A, 0x0B, 0x10, 0x6F, 0xA2, 0x88, 0x6E,
+    0xA4, 0x87, 0x95, 0x88, 0x98, 0x79, 0xA1, 0x9B, 0xA3, 0x8A, 0xA5, 0x89, 0x7F, 0x7F, 0xC0, 0x6B,
+    0xA2, 0x88, 0xA3, 0x89, 0x7E, 0x6E, 0x7B, 0x6E, 0x35, 0x61, 0x9D, 0x88, 0x9C, 0x88, 0x9C, 0x87,
+    0x9D, 0x87, 0x65, 0x00, 0xA1, 0x9A, 0xA2, 0x89, 0x7F, 0xA3, 0x89, 0x2D, 0x6E, 0x2D, 0xC0, 0x01,
+    0x04, 0x94, 0x87, 0x8B, 0x88, 0x79, 0xA4, 0x98, 0xA9, 0x98, 0x5D, 0x40, 0x9D, 0x89, 0x9D, 0x98,
+    0x7F, 0x9B, 0x99, 0x92, 0x89, 0x9A, 0x89, 0xAF, 0x66, 0xB2, 0x76, 0x9B, 0x77, 0x55, 0x51, 0x9C,
+    0x7A, 0x9D, 0x8A, 0x9A, 0x99, 0x9D, 0x99, 0xA2, 0x79, 0xA3, 0x9A, 0x9D, 0x9A, 0x9D, 0x99, 0x9B,
+    0x89, 0xAE, 0x6A, 0xA9, 0x7C, 0x95, 0x89, 0x9C, 0xA8, 0x9C, 0xA6, 0xA2, 0xA8, 0xA2, 0x88, 0x79,
+    0x7E, 0xA2, 0x88, 0x6E, 0xAB, 0x98, 0x7E, 0x91, 0x87, 0x9C, 0x89, 0x65, 0x9D, 0x89, 0x9C, 0x88,
+    0xAD, 0x87, 0xA6, 0x78, 0x9A, 0x77, 0xA5, 0x78, 0x56, 0x62, 0xA2, 0x79, 0x9A, 0x99, 0x65, 0x9C,
+    0xA7, 0x93, 0xB9, 0x69, 0x6F, 0x69, 0xAC, 0x98, 0xB3, 0xA8, 0xA8, 0x87, 0x9B, 0x88, 0x66, 0x66,
+    0xC0, 0x0C, 0x7F, 0xC0, 0x6E, 0xC0, 0x1B, 0x20, 0xC0, 0x43, 0x9D, 0x89, 0xA2, 0x98, 0xA9, 0x88,
+    0x9A, 0x88, 0x8D, 0x99, 0xA8, 0x88, 0x55, 0xAD, 0x99, 0x9D, 0x89, 0x33, 0x6F, 0xC0, 0x7F, 0x9B,
+    0x98, 0x02, 0x17, 0xA5, 0x88, 0x3B, 0x98, 0x87, 0xA7, 0x99, 0x9D, 0x89, 0x03, 0x9C, 0x88, 0x7E,
+    0xA5, 0x89, 0x13, 0xC0, 0x55, 0x13, 0x9C, 0x88, 0x9D, 0x98, 0xA2, 0x78, 0x9A, 0x88, 0x32, 0x2B,
+    0xA8, 0x99, 0xA2, 0x77, 0x9D, 0x99, 0x9D, 0x87, 0x1C, 0xA7, 0x99, 0x95, 0x88, 0x94, 0x89, 0x34,
+    0xAE, 0x89, 0xA3, 0x88, 0xA2, 0x88, 0x07, 0x96, 0x88, 0x0F, 0x23, 0x98, 0x87, 0xA4, 0x88, 0x66,
+    0x04, 0x2B, 0x99, 0x98, 0xC0, 0x00, 0xA2, 0x88, 0xA4, 0x88, 0x33, 0x23, 0xC0, 0x6E, 0x1C, 0x65,
+    0x3C, 0xAE, 0x88, 0x9B, 0x89, 0x13, 0x0F, 0x3F, 0x55, 0x27, 0x13, 0x18, 0x2B, 0xA5, 0x98, 0x9A,
+    0x88, 0x1C, 0x2B, 0x27, 0xAA, 0x78, 0x9D, 0x99, 0x94, 0x88, 0x8D, 0x87, 0xA2, 0x87, 0xB6, 0xA8,
+    0xB1, 0x89, 0xA6, 0x88, 0x95, 0x89, 0x93, 0x98, 0xB1, 0x88, 0x52, 0xAE, 0x88, 0xA2, 0x87, 0x6F,
+    0xA3, 0x88, 0x6B, 0xC0, 0x50, 0x51, 0x66, 0x02, 0x51, 0x01, 0x6B, 0x9C, 0x88, 0x9A, 0x78, 0x99,
+    0x99, 0x9D, 0x88, 0xC1, 0xA4, 0x86, 0xA3, 0x98, 0xA2, 0x87, 0xA2, 0x88, 0x7E, 0xA2, 0x88, 0xA2,
+    0x87, 0xC0, 0x29, 0x51, 0x55, 0x51, 0x65, 0x55, 0x55, 0xC0, 0x51, 0x65, 0x56, 0xC0, 0xA2, 0x87,
+    0x7F, 0xA2, 0x78, 0x7E, 0x6F, 0x7F, 0x32, 0x6B, 0x52, 0xA6, 0x93, 0xA7, 0xB2, 0x99, 0xA6, 0x98,
+    0x5C, 0x90, 0x5D, 0x9A, 0x7C, 0xB1, 0x78, 0x5D, 0x9A, 0x87, 0xA2, 0x88, 0x6F, 0x56, 0x51, 0x9D,
+    0x98, 0x41, 0x7F, 0x65, 0x25, 0x6E, 0x65, 0x25, 0x1E, 0x51, 0x19, 0x2D, 0x19, 0xC0, 0x7F, 0x25,
+    0x2A, 0x1E, 0x19, 0xC0, 0x25, 0xC0, 0x7B, 0x5A, 0x65, 0xA3, 0x89, 0x6F, 0x7E, 0xC0, 0x6E, 0x7B,
+    0xC0, 0x9A, 0x99, 0x61, 0xA2, 0x88, 0x6E, 0x7E, 0x6E, 0x6D, 0x09, 0x61, 0xC0, 0x65, 0xC0, 0x38,
+    0x9B, 0xA8, 0x98, 0x9A, 0xAE, 0x99, 0xB4, 0xA8, 0xA4, 0x87, 0x76, 0x0D, 0x7A, 0xA2, 0x89, 0xA2,
+    0x77, 0xA4, 0x87, 0x97, 0x88, 0x26, 0xA1, 0x8A, 0xA2, 0x8A, 0xA5, 0x99, 0xA2, 0x89, 0x6E, 0x2D,
+    0xC0, 0x6F, 0xA3, 0x99, 0xA2, 0x88, 0xC0, 0x6E, 0x7A, 0x30, 0x55, 0x9D, 0x98, 0x9D, 0x99, 0x9D,
+    0x87, 0x9B, 0x88, 0x65, 0x07, 0x7F, 0x6B, 0xA2, 0x88, 0xA2, 0x88, 0x6F, 0x7E, 0xA5, 0x99, 0xA7,
+    0x88, 0x52, 0x99, 0x98, 0x98, 0x88, 0x91, 0x88, 0x96, 0x87, 0xA2, 0x98, 0xA7, 0x98, 0xAA, 0x77,
+    0x54, 0x9C, 0x88, 0x9C, 0x88, 0x6F, 0xA2, 0x98, 0x8F, 0x9A, 0x96, 0x79, 0xAD, 0x76, 0xB8, 0x76,
+    0x9C, 0x66, 0x55, 0x51, 0x9D, 0x7A, 0x9D, 0x9A, 0x9D, 0x99, 0x2F, 0x9C, 0x89, 0x6B, 0xA2, 0x89,
+    0x51, 0x9D, 0xA9, 0x9A, 0x7A, 0xB1, 0x7C, 0xA5, 0x6B, 0x95, 0x9A, 0x60, 0x9B, 0xC7, 0xA2, 0x98,
+    0xA3, 0x98, 0xC0, 0x7E, 0x7E, 0x6E, 0xAD, 0x98, 0x69, 0x8E, 0x88, 0x61, 0x55, 0x9D, 0x89, 0x50,
+    0xAF, 0x88, 0x5E, 0xA2, 0x67, 0xA1, 0x8A, 0x55, 0xA1, 0x9A, 0x99, 0x99, 0x7F, 0x9A, 0xA7, 0x92,
+    0xA7, 0x76, 0xA2, 0x78, 0x69, 0xB7, 0xA8, 0xA6, 0x98, 0xA3, 0x88, 0x7E, 0x9D, 0x89, 0x7A, 0xC0,
+    0x6E, 0xC0, 0x6B, 0x7E, 0x13, 0x0C, 0xC1, 0x92, 0x7A, 0xAB, 0x89, 0xA4, 0x98, 0x99, 0x89, 0x69,
+    0x22, 0x96, 0x88, 0xA6, 0x88, 0xAB, 0x88, 0x22, 0x9B, 0x88, 0x9D, 0x99, 0xA3, 0x98, 0xA4, 0x88,
+    0xC0, 0x12, 0x2B, 0x3B, 0x16, 0x98, 0x77, 0xA7, 0x99, 0x27, 0x51, 0xA3, 0x98, 0xA2, 0x88, 0xC0,
+    0x2E, 0xA2, 0x78, 0x07, 0x99, 0x89, 0x6E, 0x27, 0x9B, 0x88, 0x9D, 0x99, 0xA4, 0x98, 0x2B, 0x16,
+    0xA5, 0x89, 0x27, 0x3F, 0xA5, 0x88, 0x98, 0x88, 0x98, 0x88, 0x51, 0xA7, 0x89, 0xAC, 0x88, 0x7B,
+    0x41, 0xAA, 0x88, 0x97, 0x98, 0x27, 0x17, 0xC0, 0x3B, 0x27, 0x17, 0x9C, 0x88, 0x17, 0xA2, 0x88,
+    0x69, 0x1B, 0x7F, 0x3C, 0xA2, 0x88, 0xA9, 0x99, 0x55, 0x3C, 0xC0, 0x9D, 0x99, 0x2F, 0x3B, 0x03,
+    0x55, 0x99, 0x99, 0x34, 0x2B, 0x65, 0x0B, 0x3F, 0x1B, 0x1F, 0x08, 0x12, 0xA2, 0x78, 0xA8, 0x88,
+    0xA9, 0x88, 0x89, 0x99, 0x97, 0x87, 0xAC, 0x97, 0xB3, 0x99, 0xA9, 0x99, 0xA7, 0x88, 0x97, 0x88,
+    0x8D, 0x99, 0xB3, 0x89, 0x9B, 0x98, 0xAC, 0x88, 0x98, 0x99, 0xA5, 0x88, 0xA8, 0x77, 0x6B, 0x6E,
+    0xA4, 0x88, 0x6F, 0x69, 0x61, 0x38, 0x98, 0x87, 0x28, 0xA5, 0x88, 0x66, 0xA4, 0x89, 0x38, 0x99,
+    0x88, 0x99, 0x88, 0x9B, 0x98, 0x6E, 0xA3, 0x97, 0x6F, 0x7E, 0x7F, 0xA2, 0x87, 0x6F, 0x38, 0x51,
+    0x40, 0x55, 0x69, 0xC0, 0x69, 0xC0, 0x55, 0x51, 0x61, 0x56, 0x6E, 0x7E, 0x7F, 0x6E, 0xA2, 0x78,
+    0xC0, 0x67, 0x9F, 0x9B, 0x67, 0x68, 0xAA, 0xA1, 0xA2, 0xB3, 0x9A, 0x89, 0x8F, 0x4E, 0x8E, 0x7E,
+    0xAD, 0x7A, 0xAB, 0x77, 0x99, 0x77, 0x6E, 0xA3, 0x99, 0x56, 0x9C, 0x88, 0x51, 0x51, 0xC0, 0x6E,
+    0x34, 0xC0, 0x25, 0x7A, 0x6E, 0x9D, 0x89, 0x66, 0x28, 0x51, 0xC1, 0x6E, 0xC2, 0x14, 0x0C, 0x11,
+    0x7B, 0x5A, 0xA2, 0x88, 0xA2, 0x89, 0x7E, 0xC0, 0xA2, 0x77, 0x7F, 0x66, 0x66, 0x9A, 0x98, 0x7A,
+    0x6F, 0x69, 0x6E, 0x6E, 0x6D, 0xC0, 0x69, 0x7B, 0x65, 0xC1, 0x55, 0x9B, 0x9A, 0x95, 0xAD, 0xB6,
+    0xA9, 0xB2, 0x95, 0xA4, 0x86, 0x62, 0x6E, 0xA2, 0x88, 0x7F, 0xA4, 0x87, 0x99, 0x88, 0x96, 0x79,
+    0x6B, 0xA2, 0x7A, 0xA4, 0x89, 0xA3, 0x99, 0xA2, 0x88, 0x52, 0xC1, 0xA2, 0x88, 0xA3, 0x99, 0xA2,
+    0x88, 0xC0, 0x6E, 0x30, 0x66, 0x40, 0x9D, 0x98, 0x9D, 0x88, 0x9B, 0x98, 0x55, 0xC0, 0x6B, 0x7A,
+    0x6F, 0x22, 0xA3, 0x99, 0xAA, 0x88, 0x9D, 0x9A, 0x9D, 0x88, 0x51, 0x90, 0x88, 0x9D, 0x98, 0x95,
+    0x88, 0x7E, 0xA5, 0x98, 0x9C, 0x89, 0xAD, 0x87, 0xA2, 0x76, 0x9D, 0x99, 0x52, 0x7F, 0xA7, 0x88,
+    0xA4, 0x88, 0x8A, 0x88, 0x9A, 0x77, 0xB9, 0x77, 0x9F, 0x76, 0x55, 0x45, 0x9C, 0x89, 0x52, 0x56,
+    0x51, 0x9D, 0x99, 0x57, 0x62, 0xA1, 0xA8, 0xA9, 0xA7, 0x9A, 0x77, 0x96, 0x7C, 0xAE, 0x6D, 0xA1,
+    0x6D, 0x97, 0x99, 0x9D, 0xA8, 0x9C, 0xB6, 0xA3, 0xA8, 0xA2, 0x88, 0xC0, 0x7E, 0xA2, 0x87, 0x7E,
+    0xAC, 0x88, 0x69, 0x90, 0x88, 0x9C, 0x98, 0x59, 0x9C, 0x88, 0xA2, 0x78, 0xAE, 0x88, 0x4E, 0xA2,
+    0x69, 0x6B, 0xC0, 0x98, 0x98, 0xA2, 0x88, 0x9A, 0xA7, 0x90, 0xB7, 0x7A, 0xA3, 0x98, 0x6E, 0xBA,
+    0x99, 0x7A, 0x9D, 0x87, 0xA7, 0x98, 0x51, 0x66, 0x55, 0x6F, 0xC0, 0x07, 0xC4, 0x8E, 0x6A, 0x61,
+    0xA6, 0x78, 0xA6, 0x98, 0x9D, 0x88, 0xAA, 0x88, 0x52, 0xA6, 0x87, 0x51, 0x13, 0x97, 0x98, 0xA2,
+    0x88, 0xA7, 0x99, 0x13, 0xA6, 0x98, 0xA3, 0x89, 0xA7, 0x88, 0x16, 0x55, 0xA4, 0x88, 0x66, 0x95,
+    0x89, 0xB3, 0x88, 0x7F, 0x07, 0x51, 0x9B, 0x89, 0x9D, 0x98, 0x52, 0x07, 0xA7, 0x89, 0x51, 0x99,
+    0x88, 0xA4, 0x98, 0x2F, 0x98, 0x89, 0x36, 0x3B, 0x7E, 0x1B, 0x55, 0x98, 0x89, 0x55, 0xC0, 0x9B,
+    0x99, 0xAA, 0x88, 0xA2, 0x78, 0xAA, 0x88, 0x66, 0x13, 0x99, 0x89, 0x9C, 0x88, 0xAA, 0x88, 0x3B,
+    0xA4, 0x88, 0x2B, 0x03, 0x51, 0xA2, 0x87, 0xAB, 0x99, 0xA2, 0x88, 0x95, 0x88, 0xC0, 0x9B, 0x98,
+    0x6F, 0xA3, 0x98, 0x99, 0x89, 0x28, 0xAC, 0x88, 0x97, 0x99, 0x98, 0x78, 0xA4, 0x98, 0xA9, 0x89,
+    0x13, 0x3C, 0xAE, 0x88, 0x6B, 0x91, 0x98, 0xC0, 0x6F, 0x23, 0x3F, 0x2B, 0x0F, 0xA5, 0x89, 0x9B,
+    0x88, 0x8A, 0x88, 0x7D, 0xAA, 0x98, 0xAD, 0x99, 0xA2, 0x88, 0xC0, 0x95, 0x88, 0xA9, 0x88, 0xB8,
+    0x88, 0x98, 0x99, 0x55, 0x9C, 0x99, 0x99, 0x88, 0x9B, 0x88, 0xA6, 0x88, 0xA2, 0x88, 0x6F, 0xA6,
+    0x87, 0xA4, 0x89, 0xA3, 0x98, 0xA5, 0x88, 0x6F, 0x94, 0x88, 0x97, 0x98, 0x9D, 0x99, 0x6B, 0xA9,
+    0x88, 0x25, 0x6F, 0x9A, 0x97, 0x9B, 0x88, 0x9C, 0x88, 0x50, 0x55, 0x7A, 0x6E, 0x7E, 0xC0, 0x51,
+    0x40, 0x69, 0x69, 0xC0, 0x6D, 0xC1, 0x55, 0x51, 0x51, 0xC0, 0x7A, 0x6E, 0x13, 0x6F, 0xC0, 0x1A,
+    0x9F, 0x9B, 0x67, 0xC0, 0xA3, 0x95, 0xAA, 0xB1, 0x9D, 0xA6, 0x94, 0x6B, 0xFF, 0x31, 0xA0, 0xA1,
+    0x8C, 0xB7, 0x67, 0x98, 0x66, 0x9C, 0x89, 0xA2, 0x88, 0x55, 0x51, 0x9C, 0x88, 0xC0, 0xA3, 0x88,
+    0x34, 0xC0, 0x56, 0x65, 0xC0, 0x25, 0x61, 0x52, 0x20, 0x66, 0x14, 0x1B, 0x59, 0x7E, 0x14, 0x25,
+    0x20, 0x0C, 0xC0, 0x07, 0xC0, 0xA2, 0x89, 0xA3, 0x88, 0x6E, 0xC0, 0xA2, 0x88, 0x7F, 0x66, 0x9D,
+    0x99, 0x9C, 0x98, 0x66, 0x20, 0x64, 0x5A, 0x6E, 0xA3, 0x88, 0x7E, 0x7E, 0x6E, 0x69, 0x66, 0xC1,
+    0x53, 0x8F, 0xAC, 0x9D, 0xAA, 0xB3, 0x98, 0xB5, 0x86, 0xA8, 0xA6, 0x7B, 0x7F, 0x6E, 0xA4, 0x77,
+    0x9A, 0x87, 0x95, 0x8A, 0x67, 0xA1, 0x8A, 0xA3, 0x8A, 0xA3, 0x99, 0xA3, 0x88, 0x66, 0x66, 0x05,
+    0x6B, 0xA4, 0x88, 0xA4, 0x88, 0x6E, 0x7A, 0x21, 0xC0, 0x51, 0x9C, 0x88, 0x05, 0x9C, 0x87, 0x55,
+    0xC0, 0x67, 0xC0, 0x55, 0xA5, 0x99, 0xAE, 0x88, 0x25, 0x96, 0x99, 0xA6, 0x88, 0x94, 0x88, 0x9B,
+    0x88, 0x99, 0x98, 0x99, 0x89, 0xA8, 0x87, 0xA3, 0x98, 0xA4, 0x88, 0xAE, 0x87, 0x55, 0x61, 0x1E,
+    0x7F, 0xA2, 0x88, 0xA4, 0x88, 0x9C, 0x78, 0x8B, 0x77, 0xAB, 0x86, 0xA3, 0x77, 0x40, 0x5A, 0x9C,
+    0x89, 0x56, 0x41, 0x51, 0x08, 0x00, 0x52, 0xA3, 0xB7, 0xAD, 0xA6, 0x50, 0x98, 0x9A, 0x97, 0x6D,
+    0xAD, 0x5D, 0x9D, 0x7C, 0x98, 0x8A, 0x9C, 0xA8, 0x9C, 0xB6, 0xA3, 0xA8, 0xA2, 0x88, 0x7E, 0xA2,
+    0x87, 0x7F, 0x69, 0xAD, 0x88, 0xA1, 0xA9, 0x8E, 0x77, 0x9D, 0x98, 0x55, 0x9C, 0x78, 0xA7, 0x88,
+    0xAF, 0x79, 0x47, 0x6E, 0x56, 0x97, 0xA9, 0xA2, 0x87, 0x99, 0xA8, 0x91, 0xC8, 0xA2, 0x97, 0xA2,
+    0x88, 0x6E, 0xB7, 0xA9, 0xA3, 0x99, 0x98, 0x87, 0xA6, 0x87, 0x6F, 0x38, 0xC3, 0x6B, 0x7E, 0xC1,
+    0x6E, 0x92, 0x7A, 0x6E, 0x6B, 0xAA, 0x88, 0xA3, 0x98, 0x51, 0x9A, 0x88, 0xC0, 0x9B, 0x99, 0xA3,
+    0x88, 0xA4, 0x88, 0xA2, 0x88, 0xC0, 0x9B, 0x99, 0x07, 0xAE, 0x88, 0x97, 0x99, 0x07, 0xA7, 0x88,
+    0x3E, 0x93, 0x88, 0x51, 0xA6, 0x88, 0x02, 0x99, 0x89, 0x23, 0xA3, 0x99, 0xC0, 0x02, 0xA6, 0x88,
+    0x03, 0x07, 0x37, 0x9C, 0x88, 0x37, 0x10, 0x1A, 0x33, 0x0B, 0x0F, 0x65, 0xA4, 0x78, 0x9A, 0x88,
+    0x9C, 0x89, 0x51, 0xAC, 0x88, 0xAA, 0x78, 0xC0, 0xA7, 0x99, 0xC0, 0x8B, 0x88, 0x50, 0xA3, 0x99,
+    0x7E, 0x28, 0x9C, 0x88, 0x14, 0x0F, 0xA3, 0x99, 0xAB, 0x88, 0x65, 0x98, 0x88, 0xA5, 0x99, 0xA6,
+    0x78, 0x55, 0x9D, 0x98, 0x1F, 0x6E, 0x51, 0x33, 0x28, 0xC0, 0xA3, 0x89, 0x51, 0x66, 0x23, 0x56,
+    0x6E, 0x1B, 0x9C, 0x88, 0x34, 0x20, 0x08, 0xA4, 0x89, 0xA6, 0x88, 0x7F, 0x2F, 0x10, 0x9A, 0x98,
+    0xC0, 0x3F, 0x51, 0x3F, 0xAA, 0x88, 0x13, 0xAA, 0x87, 0xA3, 0x99, 0x55, 0x94, 0x98, 0x56, 0x30,
+    0x9A, 0x88, 0x9C, 0x88, 0xAB, 0x99, 0x59, 0xA9, 0x99, 0x99, 0x89, 0x9A, 0x98, 0x59, 0x9C, 0x89,
+    0xAE, 0x88, 0x95, 0x98, 0xA3, 0x98, 0xA6, 0x78, 0x7F, 0xA5, 0x88, 0xA2, 0x79, 0x65, 0x19, 0x99,
+    0x88, 0x9B, 0x98, 0x51, 0x50, 0x6D, 0xC0, 0x51, 0x55, 0x7D, 0x69, 0x69, 0xC0, 0x6E, 0x55, 0x66,
+    0x55, 0x55, 0x66, 0x0C, 0x7A, 0x1B, 0x6B, 0x66, 0x9F, 0x8B, 0x67, 0x6B, 0x65, 0xA9, 0xA3, 0xA6,
+    0xA0, 0x9B, 0x88, 0xFF, 0x62, 0xC1, 0x92, 0x6E, 0xFF, 0x84, 0xD0, 0x59, 0x92, 0x77, 0x9C, 0x88,
+    0xA2, 0x78, 0x51, 0x51, 0x7F, 0xA4, 0x87, 0x6E, 0x5A, 0x65, 0x52, 0x65, 0xC0, 0x11, 0x0C, 0x11,
+    0x7A, 0x66, 0xC0, 0x14, 0x6F, 0x11, 0x20, 0xC0, 0x13, 0x65, 0x3F, 0xC1, 0x27, 0x6F, 0xC0, 0xA2,
+    0x88, 0xA3, 0x99, 0x51, 0x9C, 0x98, 0x9A, 0x99, 0xA2, 0x88, 0x64, 0x55, 0xA3, 0x88, 0xC0, 0xA3,
+    0x88, 0xA2, 0x87, 0x55, 0x2E, 0x7F, 0xC0, 0x7A, 0x65, 0x3D, 0x8E, 0xAD, 0x99, 0xBB, 0xB1, 0x78,
+    0xAD, 0x86, 0xB2, 0xA5, 0xA2, 0xA9, 0x6E, 0xC0, 0xA4, 0x88, 0x9D, 0x86, 0x93, 0x8A, 0x9F, 0x9B,
+    0xA0, 0x7A, 0xA2, 0x89, 0xA2, 0x98, 0xA3, 0x89, 0x0D, 0x05, 0x51, 0x66, 0xA2, 0x88, 0xA4, 0x78,
+    0xA2, 0x88, 0x7F, 0x6E, 0xC0, 0x39, 0x9C, 0x98, 0x31, 0x9C, 0x88, 0x69, 0xC1, 0x51, 0x31, 0xAC,
+    0x88, 0x00, 0x99, 0x89, 0x9C, 0x98, 0xA8, 0x88, 0x98, 0x79, 0xA3, 0x98, 0x99, 0x89, 0x9B, 0x88,
+    0x95, 0x98, 0x79, 0xAC, 0x87, 0xAD, 0x89, 0x9D, 0x98, 0xC0, 0xA2, 0x88, 0xA3, 0x88, 0x2D, 0xA3,
+    0x89, 0xA3, 0x88, 0x9C, 0x87, 0x9A, 0x67, 0x9F, 0x66, 0x54, 0x5A, 0x9C, 0x88, 0x56, 0x51, 0x41,
+    0x12, 0x67, 0x61, 0xA9, 0xA8, 0xA6, 0xA5, 0x9E, 0x86, 0x66, 0x9B, 0x8A, 0x9B, 0x6D, 0xA8, 0x5D,
+    0x9B, 0x7D, 0x97, 0x9B, 0x9D, 0xA8, 0x9C, 0xB6, 0xA4, 0x97, 0xA3, 0x98, 0xC0, 0xA2, 0x88, 0xC0,
+    0x79, 0xAB, 0x99, 0xA3, 0x87, 0x8E, 0x98, 0x9D, 0x88, 0x52, 0x9D, 0x78, 0xAF, 0x88, 0xAA, 0x69,
+    0x55, 0x9D, 0x88, 0x94, 0x98, 0xA7, 0x99, 0x95, 0xB8, 0x93, 0xA8, 0xA3, 0x98, 0xA3, 0x88, 0x7E,
+    0xB5, 0x98, 0xA6, 0x98, 0x96, 0x99, 0xA3, 0x88, 0x6E, 0x7A, 0x6E, 0xC1, 0x6F, 0xC0, 0x7A, 0x6E,
+    0xC1, 0x97, 0x7A, 0xC1, 0xA2, 0x88, 0x9B, 0x99, 0x9D, 0x99, 0x51, 0x6E, 0x6F, 0xA6, 0x98, 0x9B,
+    0x88, 0x99, 0x99, 0x69, 0x6F, 0x55, 0x03, 0xC0, 0x0F, 0x6E, 0xA2, 0x88, 0x02, 0x06, 0x0A, 0x0F,
+    0x0B, 0x37, 0x9D, 0x89, 0x0F, 0x32, 0xA2, 0x77, 0x99, 0x99, 0xC0, 0x0F, 0x3B, 0x0B, 0xA3, 0x88,
+    0xC0, 0x0F, 0x28, 0x38, 0x66, 0xA2, 0x88, 0x9D, 0x99, 0x0A, 0x45, 0x7F, 0xAE, 0x88, 0xA4, 0x88,
+    0xA4, 0x78, 0xA4, 0x88, 0x8C, 0x88, 0x15, 0xAD, 0x98, 0x33, 0x37, 0x9B, 0x88, 0x03, 0x0F, 0x03,
+    0x36, 0xA6, 0x88, 0x97, 0x88, 0x9D, 0x99, 0xA9, 0x88, 0x51, 0xA3, 0x89, 0xA2, 0x88, 0x99, 0x98,
+    0x33, 0x9B, 0x98, 0xA2, 0x78, 0x2E, 0x41, 0x37, 0x1F, 0x3C, 0x33, 0x56, 0x0B, 0x37, 0x9D, 0x89,
+    0x65, 0xA3, 0x89, 0x9D, 0x88, 0xA8, 0x89, 0xC0, 0x0F, 0x27, 0x66, 0x1F, 0x9A, 0x88, 0xA2, 0x87,
+    0x0F, 0x27, 0x3B, 0x33, 0xA8, 0x88, 0xAE, 0x87, 0xA4, 0x88, 0x97, 0x99, 0x6E, 0x9C, 0x88, 0x9A,
+    0x88, 0x9B, 0x99, 0xAA, 0x88, 0xAC, 0x88, 0xA2, 0x78, 0x8A, 0x87, 0xB3, 0x99, 0xAC, 0x78, 0x30,
+    0x96, 0x88, 0x3D, 0x9A, 0x88, 0x62, 0xAE, 0x88, 0xA9, 0x89, 0x65, 0x3C, 0xA9, 0x99, 0xA3, 0x78,
+    0x9C, 0xA8, 0x9C, 0x77, 0x9A, 0x86, 0x9D, 0x87, 0x51, 0xC0, 0x79, 0x68, 0x6D, 0xC1, 0x59, 0x5A,
+    0x65, 0x51, 0x66, 0xC0, 0x14, 0xC0, 0x6B, 0x67, 0x57, 0x67, 0x67, 0x56, 0xA3, 0x96, 0xAB, 0xB3,
+    0xA2, 0x95, 0x8F, 0x6D, 0x86, 0x6D, 0xB9, 0x8B, 0xAE, 0x67, 0x8F, 0x89, 0x90, 0x77, 0x59, 0xC0,
+    0xA2, 0x88, 0x9D, 0xAA, 0xA2, 0x88, 0xA3, 0x88, 0x5D, 0xC0, 0x61, 0xC0, 0x66, 0xA2, 0x78, 0xC0,
+    0x7A, 0x6E, 0x65, 0x16, 0xA2, 0x77, 0x55, 0x66, 0x1B, 0x18, 0x62, 0x07, 0x3F, 0x0E, 0xC0, 0x13,
+    0xA3, 0x89, 0xC0, 0x6B, 0xA4, 0x87, 0x62, 0x98, 0xA9, 0x6E, 0xA4, 0x98, 0x9C, 0x77, 0x65, 0xA3,
+    0x88, 0x0F, 0x7F, 0x6D, 0x65, 0xA2, 0x78, 0xA2, 0x87, 0x7E, 0x7F, 0x66, 0xA2, 0x78, 0x8D, 0xAD,
+    0x97, 0xCC, 0xB4, 0x57, 0xAA, 0x75, 0xA4, 0xA6, 0xB2, 0xB8, 0xC0, 0x66, 0xA5, 0x88, 0x9D, 0x86,
+    0x94, 0x79, 0xA0, 0x8B, 0x67, 0xA1, 0x8A, 0xA2, 0x87, 0x7F, 0x7F, 0x5A, 0x62, 0x55, 0xC0, 0xA2,
+    0x88, 0xA3, 0x88, 0xA2, 0x89, 0xC0, 0x69, 0x66, 0x36, 0x1D, 0x50, 0x51, 0xC0, 0x02, 0xAA, 0x88,
+    0xA9, 0x89, 0x1D, 0x98, 0x99, 0xA2, 0x98, 0x9C, 0x78, 0xA8, 0x88, 0x9B, 0x89, 0xA5, 0x89, 0x9B,
+    0x88, 0x23, 0x97, 0x89, 0xA2, 0x96, 0xA4, 0x87, 0x14, 0xC0, 0x7E, 0x2D, 0xA3, 0x98, 0xA3, 0x99,
+    0xA6, 0x78, 0xA3, 0x98, 0xA5, 0x88, 0x9C, 0x67, 0x98, 0x55, 0x55, 0x59, 0x9D, 0x89, 0x51, 0x55,
+    0x9D, 0x9A, 0x55, 0x67, 0x61, 0xAD, 0xA8, 0xA4, 0xA5, 0x9C, 0x97, 0x66, 0x59, 0x9B, 0x9A, 0x9C,
+    0x6B, 0xA7, 0x5F, 0x9A, 0x7D, 0x9A, 0x79, 0x9C, 0x98, 0x9B, 0xC7, 0xA4, 0x97, 0xA3, 0x98, 0xC0,
+    0xA2, 0x88, 0xC0, 0x65, 0xAC, 0x88, 0xA3, 0x97, 0x8E, 0x98, 0x9D, 0x89, 0x9D, 0x89, 0x6E, 0xB4,
+    0x67, 0xA5, 0x79, 0x93, 0xA8, 0x90, 0xA8, 0xB2, 0x88, 0x93, 0xA8, 0x95, 0x98, 0xA3, 0x98, 0xA4,
+    0x77, 0xA3, 0x88, 0xB3, 0xA9, 0xA5, 0xA9, 0x97, 0x99, 0xA2, 0x88, 0xC0, 0x69, 0x6F, 0xC0, 0x69,
+    0xC0, 0x33, 0xC0, 0x38, 0x3F, 0x38, 0x47, 0x98, 0x99, 0x9D, 0x88, 0x55, 0x9A, 0x88, 0x7F, 0xAF,
+    0x99, 0x6E, 0x51, 0x9A, 0x88, 0x3C, 0x51, 0x7F, 0x00, 0xA3, 0x99, 0x0B, 0xA6, 0x88, 0x99, 0x98,
+    0x28, 0xA8, 0x99, 0x1B, 0x0B, 0x37, 0x02, 0x1F, 0x0F, 0xA5, 0x89, 0x1F, 0xC0, 0x23, 0x37, 0xC0,
+    0x1F, 0xC0, 0x65, 0x9C, 0x89, 0xA4, 0x77, 0x0B, 0xA5, 0x98, 0x5A, 0x3C, 0x28, 0x3C, 0x23, 0x56,
+    0x9B, 0x89, 0xAC, 0x87, 0xAB, 0x99, 0x94, 0x78, 0xAC, 0x88, 0x9D, 0x99, 0x93, 0x87, 0xAA, 0x87,
+    0xA1, 0xA9, 0x56, 0x14, 0x34, 0x9C, 0x98, 0x37, 0x9C, 0x98, 0x37, 0xC0, 0x65, 0xA5, 0x99, 0x12,
+    0x55, 0x51, 0x3F, 0xAA, 0x88, 0x6F, 0xA2, 0x88, 0x1F, 0xC0, 0x0C, 0x07, 0xA3, 0x88, 0xA2, 0x99,
+    0x9D, 0x88, 0x2F, 0x1B, 0x1F, 0x3C, 0x97, 0x99, 0xA9, 0x89, 0x51, 0xA5, 0x89, 0x37, 0x3F, 0xC0,
+    0x0B, 0xA4, 0x88, 0x3B, 0x14, 0xA5, 0x99, 0x1B, 0x10, 0xA3, 0x98, 0x1B, 0xAC, 0x87, 0xAC, 0x89,
+    0x9B, 0x98, 0x6E, 0x99, 0x99, 0x95, 0x88, 0x0F, 0xC0, 0x34, 0xA4, 0x98, 0x20, 0x0C, 0xAD, 0x89,
+    0x1C, 0x99, 0x88, 0x09, 0x9D, 0x9A, 0xA8, 0x78, 0x96, 0x98, 0xA3, 0x89, 0xA8, 0x88, 0xAB, 0x98,
+    0x5A, 0xAA, 0x88, 0xA2, 0x78, 0x65, 0x9C, 0x87, 0x99, 0x97, 0x9B, 0x88, 0x64, 0x65, 0x58, 0x7D,
+    0x6E, 0x69, 0x56, 0x55, 0x55, 0x66, 0xC2, 0x67, 0x5B, 0x63, 0x57, 0x66, 0x6B, 0xA2, 0x89, 0xA6,
+    0x96, 0x7A, 0x9D, 0x89, 0x94, 0x7B, 0x5F, 0xAC, 0x88, 0x9B, 0x88, 0x92, 0x77, 0x9B, 0x88, 0x9D,
+    0x89, 0x69, 0x9C, 0x89, 0x55, 0xA3, 0x87, 0xA3, 0x88, 0xC0, 0x66, 0x3A, 0xC0, 0x7E, 0x6E, 0x02,
+    0xA2, 0x88, 0x07, 0xC0, 0x6F, 0x69, 0xC0, 0x52, 0x07, 0x5A, 0x77, 0x3F, 0xA2, 0x89, 0x65, 0x3A,
+    0x13, 0x7F, 0x5A, 0x7B, 0x66, 0x9C, 0xA9, 0xA4, 0x88, 0xA3, 0x88, 0x9B, 0x97, 0x55, 0x6E, 0x6E,
+    0xA3, 0x88, 0x55, 0x7E, 0x7E, 0xA2, 0x77, 0x7A, 0xA3, 0x88, 0x66, 0x7F, 0x8E, 0x9C, 0x96, 0xBC,
+    0xB1, 0x68, 0xB4, 0x75, 0x8B, 0x97, 0xAC, 0xB8, 0xB8, 0xA7, 0x69, 0xA4, 0x77, 0x50, 0x94, 0x79,
+    0xA1, 0x9C, 0xA1, 0x8A, 0xA2, 0x89, 0x66, 0x55, 0x51, 0xC0, 0x51, 0x56, 0x3D, 0x02, 0xA2, 0x89,
+    0xA3, 0x88, 0x39, 0xC0, 0x2A, 0x16, 0x02, 0xC0, 0x3E, 0xA6, 0x88, 0xA6, 0x88, 0x51, 0x39, 0x94,
+    0x89, 0x99, 0x99, 0x9A, 0x88, 0x65, 0xAA, 0x89, 0x41, 0xA6, 0x89, 0xA6, 0x88, 0x98, 0x88, 0x13,
+    0x3D, 0x9A, 0x88, 0x99, 0x98, 0xA2, 0x88, 0xC0, 0x66, 0xA2, 0x88, 0xA2, 0x77, 0xA2, 0x99, 0xA5,
+    0x88, 0xA4, 0x78, 0x44, 0xA0, 0x56, 0x9E, 0x66, 0xC0, 0x51, 0x9C, 0x88, 0x56, 0x65, 0x52, 0x51,
+    0x67, 0xAD, 0xB7, 0xA3, 0xA6, 0x64, 0x52, 0x65, 0x55, 0x99, 0x99, 0x9C, 0x6D, 0xA7, 0x5F, 0x9C,
+    0x7B, 0x9C, 0x8B, 0x99, 0xA8, 0x9D, 0xB6, 0xA3, 0x98, 0xA3, 0x98, 0x7E, 0x7E, 0xC0, 0x2B, 0xAB,
+    0x98, 0xA3, 0x98, 0x91, 0x88, 0x9A, 0x89, 0x9D, 0x88, 0xA9, 0x88, 0xAC, 0x77, 0x8C, 0xA8, 0x61,
+    0xB1, 0x98, 0x96, 0x98, 0x92, 0x87, 0xA4, 0x88, 0xA3, 0x89, 0xA4, 0x87, 0xB4, 0x98, 0xA3, 0x99,
+    0x97, 0x98, 0x6F, 0xC1, 0x6E, 0x6F, 0x18, 0xA2, 0x88, 0xA3, 0x89, 0xA4, 0x87, 0xA3, 0x99, 0xA3,
+    0x88, 0x7B, 0xBC, 0x79, 0xA3, 0x88, 0xAC, 0x88, 0x28, 0x0F, 0x32, 0xA2, 0x78, 0x9D, 0x98, 0x37,
+    0xC0, 0x0B, 0xA4, 0x88, 0x9D, 0x99, 0x0F, 0x23, 0xA3, 0x88, 0xAA, 0x99, 0x55, 0x33, 0x7F, 0x1A,
+    0x33, 0xA5, 0x89, 0x1A, 0x6E, 0xA4, 0x88, 0x1F, 0x1A, 0x9A, 0x88, 0xA4, 0x87, 0x37, 0x0F, 0x33,
+    0x7E, 0x37, 0x0B, 0x1F, 0xC0, 0x28, 0x0F, 0x1F, 0x33, 0x0B, 0x23, 0xC0, 0x9B, 0x89, 0xA7, 0x88,
+    0xA9, 0x99, 0xA4, 0x89, 0xA3, 0x88, 0x55, 0x93, 0x98, 0x95, 0x87, 0xA1, 0xA9, 0xC0, 0xA3, 0x89,
+    0x3C, 0x7E, 0x3F, 0x3B, 0x9C, 0x88, 0x0B, 0x13, 0x7F, 0xA7, 0x88, 0x3B, 0x3F, 0x7F, 0x9B, 0x88,
+    0x51, 0x0B, 0x3C, 0xA2, 0x88, 0x9C, 0x98, 0x9C, 0x89, 0xA3, 0x88, 0x10, 0xA6, 0x88, 0xA5, 0x99,
+    0x38, 0x0B, 0x3C, 0x97, 0x99, 0x37, 0x34, 0x7F, 0x37, 0x0F, 0xC0, 0x13, 0x1F, 0x23, 0x2B, 0xA7,
+    0x89, 0xA2, 0x87, 0xA4, 0x88, 0x07, 0x3B, 0xC0, 0xA4, 0x78, 0x9A, 0x98, 0xC0, 0xAF, 0x89, 0xA4,
+    0x88, 0x9B, 0x98, 0xA4, 0x88, 0x98, 0x88, 0xAF, 0x88, 0x9B, 0x99, 0x9C, 0x78, 0xA7, 0x98, 0x96,
+    0x88, 0xA2, 0x88, 0x7F, 0x95, 0x88, 0xB4, 0x89, 0x65, 0x3F, 0x1B, 0xA5, 0x89, 0x50, 0x29, 0xA4,
+    0x89, 0xA3, 0x88, 0x56, 0xA3, 0x99, 0xA3, 0x87, 0x9D, 0x98, 0x9B, 0x88, 0x9C, 0x86, 0x9D, 0x87,
+    0x50, 0x78, 0x6D, 0x55, 0x41, 0x66, 0x66, 0x14, 0xC0, 0x56, 0x67, 0x67, 0x53, 0x67, 0xA5, 0x9B,
+    0xA2, 0x79, 0x97, 0x88, 0x97, 0x99, 0xA3, 0x99, 0xA6, 0x89, 0x97, 0x88, 0x51, 0xA7, 0x89, 0xA3,
+    0x88, 0x9D, 0x89, 0xA4, 0x88, 0x9D, 0x98, 0x59, 0x99, 0x88, 0x9A, 0x77, 0x9D, 0x88, 0x50, 0x6E,
+    0x7F, 0x6E, 0xC0, 0x7E, 0x6E, 0xC1, 0x56, 0x6E, 0x69, 0x3F, 0x65, 0x3A, 0x3F, 0xC0, 0x67, 0x6E,
+    0x51, 0x51, 0x66, 0xC0, 0xA2, 0x88, 0x37, 0xA2, 0x99, 0xA3, 0x9A, 0x9B, 0x99, 0xA2, 0x86, 0x58,
+    0x50, 0xA2, 0x88, 0x6E, 0x6E, 0x6E, 0xA2, 0x88, 0x6D, 0xC0, 0xA3, 0x98, 0xA2, 0x87, 0xC0, 0x6B,
+    0x8D, 0xBD, 0x97, 0xBC, 0xAD, 0x68, 0xBB, 0x76, 0x8D, 0xA7, 0x94, 0xB8, 0x85, 0xA6, 0xA6, 0x87,
+    0x6D, 0xA3, 0x88, 0x95, 0x8A, 0xA1, 0x8C, 0xA1, 0x8A, 0xA0, 0x8A, 0x65, 0x56, 0x61, 0x51, 0x9D,
+    0x88, 0x51, 0x6E, 0x7A, 0xC0, 0x6E, 0x2E, 0xC0, 0x66, 0x2E, 0x7F, 0xA9, 0x88, 0xA7, 0x89, 0x9D,
+    0x98, 0xC0, 0x95, 0xA9, 0x94, 0x88, 0x9A, 0x78, 0x99, 0x89, 0x98, 0x88, 0x7A, 0xA6, 0x78, 0xA6,
+    0x89, 0xA9, 0x99, 0x6F, 0x1B, 0x93, 0x98, 0x54, 0xA8, 0x97, 0x69, 0x5A, 0x06, 0xC0, 0x66, 0xA2,
+    0x88, 0xC0, 0xA7, 0x79, 0x9C, 0x87, 0xA5, 0x78, 0xA6, 0x67, 0x9C, 0x55, 0x6E, 0x51, 0x9C, 0x99,
+    0x55, 0x56, 0x51, 0x51, 0xA1, 0x9A, 0xAD, 0xC7, 0x78, 0x69, 0x61, 0x5A, 0x65, 0x9A, 0x88, 0x99,
+    0x9A, 0xA5, 0x6E, 0xA0, 0x6D, 0x9B, 0x8C, 0xA1, 0x8A, 0x98, 0xA8, 0x9D, 0xA7, 0xA3, 0xA7, 0xA3,
+    0x98, 0x6E, 0xC0, 0x2E, 0x5A, 0xAA, 0x98, 0xA4, 0x87, 0x90, 0x88, 0x9B, 0x89, 0xC0, 0xA4, 0x87,
+    0x93, 0xA7, 0xA5, 0x97, 0xA7, 0x99, 0x51, 0x9B, 0x98, 0x7F, 0xA3, 0x88, 0x9D, 0x89, 0xB5, 0x98,
+    0xA7, 0x99, 0x97, 0x98, 0xA5, 0x89, 0xA4, 0x78, 0xA5, 0x88, 0xA3, 0x99, 0xA4, 0x87, 0xA5, 0x99,
+    0xA3, 0x88, 0xC0, 0x6F, 0x9D, 0x99, 0xA2, 0x88, 0xA3, 0x78, 0xAC, 0x99, 0x7F, 0xA3, 0x88, 0x51,
+    0xA3, 0x99, 0x65, 0x9A, 0x89, 0xA6, 0x88, 0xA3, 0x88, 0x9B, 0x99, 0xA4, 0x77, 0x17, 0x9C, 0x88,
+    0xA2, 0x88, 0x23, 0xA3, 0x98, 0x51, 0x2F, 0xC0, 0x37, 0xA7, 0x88, 0x9D, 0x99, 0x9B, 0x99, 0x9D,
+    0x88, 0x1F, 0xA4, 0x88, 0x0A, 0x3B, 0x0A, 0x23, 0x0A, 0x0F, 0x17, 0x23, 0xA4, 0x88, 0x55, 0x0B,
+    0x2B, 0x1F, 0x6E, 0x23, 0xA7, 0x98, 0x41, 0x2C, 0x66, 0x6F, 0x9D, 0x88, 0xB6, 0x88, 0x9D, 0x99,
+    0xA2, 0x78, 0x9B, 0x98, 0x50, 0x14, 0x9D, 0x88, 0x7A, 0xA4, 0x88, 0xA2, 0x88, 0xA5, 0x99, 0x1F,
+    0x27, 0x3F, 0xC2, 0xA5, 0x89, 0x17, 0xC0, 0x27, 0x3F, 0x7F, 0x2B, 0xC0, 0x3F, 0xC0, 0x1F, 0x65,
+    0x37, 0x17, 0x2F, 0x6B, 0xA8, 0x88, 0x14, 0x95, 0x99, 0xA5, 0x89, 0x7F, 0xA2, 0x88, 0x0F, 0x17,
+    0x3F, 0xA8, 0x88, 0x9B, 0x88, 0xA9, 0x89, 0xA6, 0x98, 0x41, 0x99, 0x99, 0x7E, 0x3F, 0x3C, 0xA2,
+    0x88, 0xAD, 0x98, 0x97, 0x99, 0xC0, 0xA3, 0x88, 0x13, 0x07, 0x33, 0xA8, 0x78, 0x9A, 0x98, 0x1B,
+    0x9C, 0x87, 0xB1, 0x89, 0x7A, 0x9D, 0x88, 0x98, 0x88, 0x33, 0x18, 0x9A, 0x98, 0x56, 0xA4, 0x88,
+    0x34, 0xAF, 0x98, 0xA7, 0x98, 0x39, 0xA5, 0x99, 0x98, 0x88, 0xC0, 0xAC, 0x78, 0xA4, 0x88, 0x2A,
+    0xC0, 0x9D, 0x98, 0x9A, 0x87, 0x9C, 0x86, 0x9B, 0x86, 0x9E, 0x86, 0x54, 0x65, 0xC1, 0x6E, 0x57,
+    0x67, 0x52, 0x67, 0xA1, 0x9B, 0xA2, 0x8A, 0x94, 0x8B, 0xA2, 0x88, 0xA6, 0x88, 0x96, 0x88, 0x33,
+    0x9D, 0x88, 0x99, 0x89, 0x9D, 0x88, 0x6F, 0xA7, 0x98, 0xA4, 0x87, 0x39, 0x6E, 0xA5, 0x77, 0x7F,
+    0x9C, 0x87, 0x93, 0x78, 0x9D, 0x88, 0x7E, 0x7F, 0x6E, 0xC0, 0x6E, 0x30, 0x69, 0xC0, 0x6E, 0xC0,
+    0x6F, 0x7F, 0x3A, 0xC0, 0x35, 0x30, 0x9D, 0x88, 0xA2, 0x89, 0xA9, 0x9A, 0xA6, 0x89, 0xA5, 0x98,
+    0x76, 0x7F, 0x56, 0x65, 0x95, 0x89, 0x9B, 0x97, 0x9D, 0x76, 0xA2, 0x87, 0x6F, 0xC0, 0x6E, 0x7E,
+    0x6E, 0xA3, 0x87, 0x69, 0x7E, 0xA2, 0x88, 0xA3, 0x88, 0x6B, 0x8D, 0xAD, 0x97, 0xCC, 0xAA, 0x67,
+    0xFF, 0x8D, 0x52, 0x91, 0xA8, 0x8B, 0xB9, 0xFF, 0xA4, 0x8B, 0xAE, 0x86, 0x41, 0xA9, 0x87, 0x94,
+    0x7A, 0xA1, 0x9C, 0xA0, 0x8A, 0x6B, 0x66, 0x59, 0x62, 0x55, 0x55, 0x51, 0xC0, 0xA2, 0x98, 0xA3,
+    0x89, 0x7E, 0x3E, 0x7F, 0xA3, 0x88, 0xA2, 0x88, 0x66, 0xA6, 0x78, 0x9C, 0x98, 0x0D, 0x3E, 0xA8,
+    0x98, 0x8A, 0x89, 0x50, 0xA2, 0x79, 0x9C, 0x88, 0x7F, 0x93, 0x88, 0x96, 0x89, 0xAD, 0x89, 0xAA,
+    0x88, 0xA8, 0x98, 0x9A, 0x88, 0x96, 0x87, 0xA6, 0x87, 0xA6, 0x88, 0x54, 0x7B, 0x7E, 0xA2, 0x89,
+    0xA2, 0x87, 0xC0, 0x35, 0x05, 0x2B, 0xAC, 0x57, 0x9C, 0x55, 0x55, 0xC0, 0x9D, 0x88, 0x52, 0x51,
+    0x51, 0x51, 0xA4, 0x99, 0xAC, 0xB7, 0x9E, 0x96, 0x65, 0x66, 0x69, 0xC0, 0x9B, 0x89, 0x9C, 0x88,
+    0x67, 0xA2, 0x7D, 0x9D, 0x6D, 0x9B, 0x8C, 0xA3, 0x99, 0x99, 0x98, 0x9C, 0x97, 0xA5, 0xA7, 0xA2,
+    0x88, 0xC0, 0x66, 0x5A, 0xC0, 0xAA, 0x88, 0xA4, 0x97, 0x8F, 0x88, 0x9C, 0x89, 0xA3, 0x98, 0xA0,
+    0x95, 0x95, 0x98, 0xA3, 0x88, 0xA3, 0x98, 0xA4, 0x99, 0xA6, 0x88, 0xA5, 0x88, 0x92, 0x89, 0xAF,
+    0x98, 0xB6, 0x88, 0xA3, 0x99, 0xA5, 0x89, 0x59, 0x65, 0xA3, 0x89, 0x61, 0x99, 0x89, 0xC0, 0x51,
+    0x9D, 0x88, 0xC0, 0x30, 0xA6, 0x88, 0xB8, 0x89, 0x9A, 0x88, 0x6E, 0x10, 0xC0, 0xA7, 0x99, 0x98,
+    0x87, 0x99, 0x99, 0x9C, 0x88, 0x6E, 0xA5, 0x99, 0xA6, 0x88, 0x6E, 0x9A, 0x99, 0xA2, 0x77, 0xC0,
+    0xA7, 0x99, 0x17, 0x9D, 0x89, 0xA5, 0x98, 0x17, 0x1B, 0xC0, 0xA3, 0x88, 0x27, 0x7E, 0x03, 0x04,
+    0x17, 0x26, 0x2B, 0x55, 0xC0, 0x17, 0x55, 0x6B, 0x17, 0x1C, 0xC1, 0x03, 0x0F, 0x34, 0x20, 0xC0,
+    0x56, 0x51, 0xB1, 0x89, 0xA5, 0x99, 0xA4, 0x78, 0x94, 0x98, 0x95, 0x88, 0xA5, 0x97, 0x51, 0xC0,
+    0x1C, 0x03, 0xA6, 0x88, 0x65, 0x9A, 0x89, 0x03, 0x9D, 0x99, 0x34, 0xA3, 0x99, 0xC1, 0x2B, 0x3F,
+    0x9B, 0x99, 0xAA, 0x77, 0x52, 0x03, 0x17, 0x13, 0x17, 0xA7, 0x88, 0x9C, 0x88, 0x13, 0x3F, 0x56,
+    0x1E, 0x9B, 0x88, 0x9A, 0x88, 0xA5, 0x88, 0x36, 0x9D, 0x88, 0x23, 0x1C, 0xA4, 0x99, 0xA2, 0x77,
+    0xA7, 0x99, 0x55, 0xA7, 0x99, 0xA4, 0x88, 0xC0, 0x93, 0x88, 0x3F, 0xA2, 0x88, 0xA2, 0x88, 0x18,
+    0xC0, 0x10, 0xA5, 0x99, 0xA7, 0x88, 0x9B, 0x99, 0x2C, 0x56, 0xA8, 0x98, 0xAD, 0x89, 0x8D, 0x98,
+    0xA5, 0x89, 0xAE, 0x88, 0xAA, 0x88, 0x9B, 0x98, 0x37, 0x07, 0xA8, 0x88, 0xA4, 0x88, 0x65, 0x23,
+    0x10, 0x08, 0xA6, 0x88, 0xA8, 0x88, 0x99, 0x98, 0xA3, 0x88, 0x66, 0xC0, 0xA6, 0x88, 0xA4, 0x88,
+    0xA8, 0x88, 0xA3, 0x79, 0xC0, 0x98, 0x97, 0x9C, 0x75, 0x9C, 0x86, 0x9B, 0x97, 0x9F, 0x76, 0x7A,
+    0xC0, 0x56, 0x67, 0x52, 0x9F, 0x9B, 0xA6, 0x8B, 0x99, 0x9B, 0x41, 0x7F, 0xA6, 0x88, 0x98, 0x88,
+    0x94, 0x88, 0x59, 0xA6, 0x88, 0x7F, 0x9D, 0x89, 0x99, 0x88, 0x64, 0xC0, 0x51, 0xA7, 0x89, 0x59,
+    0xA5, 0x88, 0x9B, 0x88, 0x96, 0x88, 0xA2, 0x77, 0x28, 0xC1, 0x69, 0x1C, 0x66, 0x1C, 0x7F, 0x6E,
+    0xC0, 0x6E, 0x30, 0x21, 0x51, 0x52, 0xA9, 0xAA, 0xB0, 0x99, 0xA3, 0x9A, 0x7F, 0x3D, 0x7E, 0x3D,
+    0x7A, 0x05, 0x9A, 0x88, 0x99, 0x88, 0x90, 0x86, 0x58, 0xA5, 0x88, 0x6F, 0x69, 0xC0, 0x6E, 0xA2,
+    0x87, 0xC0, 0x6D, 0xA3, 0x89, 0xA4, 0x98, 0x56, 0x8C, 0xBC, 0x9A, 0xAB, 0xA8, 0x67, 0xBE, 0x87,
+    0x99, 0x97, 0x85, 0xAA, 0xB7, 0xA4, 0xB5, 0x97, 0x9C, 0x78, 0xAC, 0x77, 0x95, 0x8B, 0x9F, 0x9C,
+    0xA2, 0x9A, 0xA2, 0x78, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x88, 0x7E, 0xC0, 0x6E, 0xA2, 0x88, 0x66,
+    0x9D, 0x99, 0x99, 0x88, 0x20, 0x51, 0xAD, 0x88, 0x66, 0x0D, 0x36, 0xA3, 0x99, 0x51, 0x31, 0x04,
+    0x92, 0x88, 0x99, 0x88, 0xA3, 0x89, 0xA5, 0x99, 0x2F, 0x55, 0x99, 0x89, 0x99, 0x89, 0xAB, 0x98,
+    0xA7, 0x89, 0xA6, 0x98, 0x92, 0x77, 0x9C, 0x98, 0xAD, 0x87, 0x66, 0x9B, 0x98, 0x51, 0xA3, 0x89,
+    0x39, 0x9C, 0x89, 0x9A, 0x88, 0x9B, 0x88, 0xC0, 0xB9, 0x57, 0xA7, 0x56, 0x9D, 0x77, 0x7A, 0x9C,
+    0x88, 0x51, 0x56, 0x61, 0x9D, 0x89, 0xA7, 0xAA, 0xAA, 0xB7, 0x9E, 0x96, 0x65, 0x55, 0x69, 0x7A,
+    0x9C, 0x88, 0x9B, 0x8A, 0xC0, 0xA0, 0x8A, 0xA2, 0x6C, 0x99, 0x8C, 0x99, 0x7C, 0xA6, 0x99, 0x9D,
+    0xA7, 0x9A, 0x97, 0xA4, 0x98, 0xA2, 0x77, 0xC0, 0x66, 0xC0, 0x33, 0xA9, 0x89, 0xA2, 0x97, 0x91,
+    0x99, 0x9C, 0x87, 0xA8, 0x87, 0x96, 0x97, 0x97, 0x87, 0x32, 0xA5, 0x99, 0xA7, 0x99, 0x9D, 0x99,
+    0x9C, 0x78, 0xA9, 0x98, 0xBC, 0x88, 0x7F, 0xC0, 0x98, 0x88, 0xA2, 0x78, 0x9B, 0x98, 0xA3, 0x89,
+    0xA4, 0x88, 0x7E, 0x6F, 0xC0, 0x31, 0x04, 0x97, 0x98, 0x85, 0x8A, 0xA5, 0x99, 0x55, 0x23, 0x51,
+    0xA6, 0x87, 0x9B, 0x89, 0x00, 0xC0, 0xA2, 0x98, 0x55, 0xA3, 0x99, 0xA2, 0x88, 0x9D, 0x88, 0x9D,
+    0x99, 0x17, 0x26, 0x17, 0xC0, 0x9D, 0x88, 0x2B, 0xC1, 0x7E, 0x51, 0x03, 0x3F, 0xC0, 0x2B, 0xA8,
+    0x88, 0x51, 0x9B, 0x88, 0x3F, 0x7E, 0x2B, 0x26, 0x27, 0x04, 0x03, 0x1C, 0x04, 0x17, 0x03, 0x1C,
+    0x9A, 0x88, 0x9D, 0x89, 0xC0, 0xB3, 0x89, 0x99, 0x99, 0x9B, 0x88, 0x10, 0x93, 0x88, 0x65, 0xA4,
+    0x99, 0x69, 0x34, 0x28, 0x17, 0xA2, 0x87, 0x1F, 0xC0, 0x08, 0x2B, 0x33, 0x30, 0x33, 0x07, 0x6F,
+    0x6F, 0x3F, 0x27, 0x3F, 0x26, 0x1B, 0x27, 0x3F, 0xC0, 0xA8, 0x88, 0x13, 0xA3, 0x98, 0xA4, 0x89,
+    0x1C, 0x95, 0x89, 0x17, 0x1A, 0x26, 0x3B, 0x55, 0x95, 0x99, 0x1C, 0x65, 0x2C, 0xA4, 0x88, 0xA7,
+    0x89, 0x99, 0x99, 0x9C, 0x88, 0xA2, 0x88, 0xA3, 0x98, 0x9D, 0x88, 0x3F, 0x3B, 0xA5, 0x89, 0x00,
+    0xA8, 0x88, 0x66, 0x55, 0x6F, 0x07, 0x33, 0x2B, 0x9D, 0x89, 0xC0, 0x3B, 0xA5, 0x88, 0x6F, 0x37,
+    0x08, 0xA3, 0x98, 0xA6, 0x89, 0x99, 0x98, 0x07, 0x33, 0xAA, 0x88, 0xAC, 0x88, 0x9C, 0x87, 0x7F,
+    0xA3, 0x88, 0xA2, 0x88, 0x10, 0x38, 0xAE, 0x88, 0x31, 0x6B, 0xC0, 0x08, 0xC0, 0xA6, 0x86, 0x9B,
+    0x75, 0x97, 0x99, 0x55, 0x7E, 0xC0, 0x03, 0xA1, 0x9C, 0xAA, 0x8B, 0x99, 0x8A, 0x51, 0x9C, 0x98,
+    0x9C, 0x88, 0x9A, 0x77, 0x97, 0x99, 0x9A, 0x77, 0xAD, 0x99, 0x3C, 0xA6, 0x78, 0x95, 0x98, 0x8F,
+    0x98, 0xA3, 0x88, 0xA4, 0x88, 0xA2, 0x88, 0xC0, 0xA4, 0x77, 0xAC, 0x78, 0x91, 0x78, 0x55, 0x7E,
+    0xC0, 0x66, 0x14, 0x17, 0xC0, 0x14, 0x1C, 0x7F, 0x1C, 0xC0, 0x14, 0x17, 0x55, 0xAF, 0x9A, 0xAD,
+    0xAB, 0x52, 0x61, 0x0F, 0x9A, 0x78, 0xA4, 0x88, 0xA3, 0x98, 0x99, 0x99, 0x9D, 0x88, 0x51, 0xC0,
+    0x93, 0x87, 0x98, 0x65, 0xA6, 0x87, 0xA2, 0x88, 0x5A, 0x65, 0x7A, 0x6E, 0x6E, 0x69, 0xA6, 0x77,
+    0xA6, 0x88, 0x9B, 0x9A, 0x8B, 0xCE, 0x62, 0xA4, 0x77, 0xBB, 0x98, 0xA6, 0x87, 0x8A, 0x97, 0xB1,
+    0x97, 0xB8, 0x88, 0x9C, 0x88, 0xA9, 0x78, 0x9C, 0x9A, 0xA1, 0x8B, 0xA2, 0x88, 0x7F, 0x6F, 0x51,
+    0x66, 0x2C, 0xC0, 0x64, 0x3D, 0x9D, 0x99, 0x9B, 0x98, 0x9B, 0x99, 0xA2, 0x88, 0xA9, 0x88, 0xA2,
+    0x77, 0x9A, 0x98, 0xA2, 0x78, 0x9B, 0x99, 0x6E, 0xA2, 0x88, 0x21, 0xC0, 0x9A, 0x88, 0x9D, 0x89,
+    0x51, 0x9C, 0x88, 0x97, 0x99, 0x51, 0x6B, 0x93, 0x89, 0xAC, 0x87, 0xA9, 0x89, 0x69, 0x94, 0x88,
+    0x9B, 0x99, 0x9B, 0x97, 0xA3, 0x89, 0x7E, 0x9D, 0x99, 0x6E, 0xA5, 0x89, 0x7A, 0x51, 0x9D, 0x99,
+    0x41, 0xB2, 0x45, 0xB2, 0x56, 0x9C, 0x76, 0x56, 0x9D, 0x99, 0x50, 0x06, 0x61, 0x9D, 0x9A, 0xAB,
+    0xA9, 0xA5, 0xB9, 0x9E, 0x86, 0x6E, 0x65, 0x65, 0x7A, 0x9C, 0x88, 0x9D, 0x88, 0xC0, 0x7F, 0x9F,
+    0x8C, 0x9F, 0x7C, 0x99, 0x8B, 0x97, 0x7B, 0xA8, 0x98, 0x9F, 0xB8, 0x99, 0xA8, 0xA5, 0x78, 0x6E,
+    0x2E, 0x33, 0x2E, 0x5A, 0xA9, 0x98, 0xA3, 0x98, 0x91, 0x98, 0x55, 0xA5, 0x98, 0x90, 0x96, 0xA3,
+    0x98, 0xA8, 0x88, 0xA4, 0x88, 0x66, 0x9C, 0x88, 0xA8, 0x88, 0xB1, 0x99, 0xA4, 0x78, 0xAB, 0x98,
+    0x9D, 0x89, 0x34, 0x9A, 0x78, 0xA9, 0x98, 0x18, 0x65, 0x55, 0x9C, 0x89, 0x35, 0xA4, 0x98, 0x55,
+    0xB9, 0x8A, 0xA3, 0x98, 0xA3, 0x89, 0x51, 0x9A, 0x88, 0x9C, 0x88, 0xA6, 0x87, 0xA4, 0x88, 0x9D,
+    0x99, 0x14, 0x61, 0x9C, 0x88, 0xC0, 0xA3, 0x99, 0x9C, 0x87, 0xA2, 0x78, 0x62, 0x3E, 0xA5, 0x88,
+    0x51, 0x7F, 0x2B, 0x17, 0x55, 0x7B, 0x2B, 0x03, 0x08, 0xA5, 0x99, 0x2B, 0x2F, 0x17, 0x65, 0x26,
+    0x30, 0x17, 0x9B, 0x99, 0x3E, 0x30, 0xA4, 0x98, 0x26, 0x03, 0x2B, 0x03, 0x55, 0x56, 0x9B, 0x88,
+    0xA8, 0x89, 0x00, 0xA5, 0x88, 0xA6, 0x99, 0x90, 0x87, 0xC0, 0x30, 0x2F, 0x0F, 0xA4, 0x88, 0xA3,
+    0x88, 0x0B, 0x17, 0x03, 0x08, 0x10, 0xA3, 0x99, 0xA2, 0x88, 0x0B, 0x2F, 0x34, 0x03, 0xA3, 0x89,
+    0xA4, 0x98, 0x41, 0x17, 0xA6, 0x88, 0xA6, 0x88, 0x9B, 0x88, 0x7F, 0x0F, 0xC0, 0x66, 0x18, 0x94,
+    0x89, 0x20, 0x2F, 0xC0, 0x03, 0x07, 0x0B, 0x9C, 0x88, 0x1C, 0x08, 0x30, 0xC0, 0x9C, 0x89, 0x37,
+    0xA6, 0x88, 0xA3, 0x98, 0x93, 0x89, 0xA2, 0x88, 0xC0, 0x37, 0xA6, 0x87, 0xA2, 0x88, 0x3F, 0x1C,
+    0xA4, 0x88, 0x2C, 0x6F, 0x3F, 0x33, 0x3B, 0x2B, 0xA4, 0x78, 0x66, 0x37, 0xAB, 0x98, 0x3B, 0xA2,
+    0x78, 0xA8, 0x98, 0x5A, 0xA6, 0x98, 0x93, 0x89, 0x94, 0x87, 0xA6, 0x89, 0x2C, 0xA6, 0x88, 0x1B,
+    0xB3, 0x87, 0xAB, 0x99, 0x92, 0x88, 0x96, 0x88, 0xA8, 0x88, 0xAA, 0x88, 0xA2, 0x88, 0x8A, 0x89,
+    0x37, 0xAA, 0x87, 0xA5, 0x88, 0x14, 0x51, 0xA3, 0x87, 0xA2, 0x87, 0xA2, 0x89, 0xAB, 0x8A, 0x97,
+    0x8A, 0x7F, 0xA6, 0x89, 0x92, 0x88, 0x50, 0xC0, 0x95, 0x88, 0x7E, 0xA7, 0x89, 0xA7, 0x88, 0x94,
+    0x88, 0x65, 0x91, 0x88, 0x7F, 0xA3, 0x88, 0x66, 0xA3, 0x88, 0xAB, 0x88, 0xAB, 0x88, 0x90, 0x78,
+    0x9A, 0x88, 0xA2, 0x78, 0x6D, 0x56, 0xC4, 0xA3, 0x88, 0x66, 0x55, 0x76, 0x52, 0xAA, 0x98, 0xB3,
+    0x9A, 0x99, 0x9B, 0x9D, 0x99, 0xAD, 0x98, 0xC0, 0x61, 0xA3, 0x87, 0x9A, 0x88, 0x28, 0x61, 0x56,
+    0xAC, 0x88, 0x95, 0x87, 0x8F, 0x77, 0xA5, 0x87, 0x7F, 0x69, 0x5A, 0xA3, 0x99, 0x7E, 0xA2, 0x88,
+    0xA2, 0x88, 0xA3, 0x88, 0xA5, 0x88, 0x9C, 0x99, 0x9B, 0xAB, 0xA3, 0x99, 0xA5, 0x89, 0xA9, 0x98,
+    0x7E, 0xAA, 0x88, 0xAD, 0x98, 0xC0, 0x42, 0x6E, 0xA4, 0x98, 0xA2, 0x78, 0x62, 0xC0, 0x66, 0x56,
+    0xA3, 0x88, 0xC0, 0x9C, 0x88, 0x64, 0x6E, 0x98, 0x99, 0x99, 0x89, 0xA9, 0x98, 0x9A, 0x88, 0x30,
+    0xA2, 0x78, 0x7E, 0x31, 0x51, 0x96, 0x88, 0x10, 0x65, 0xA6, 0x89, 0x0C, 0x9B, 0x99, 0x69, 0x1F,
+    0xA4, 0x78, 0x7A, 0x56, 0x9A, 0x78, 0xC0, 0x04, 0x96, 0x88, 0x98, 0x88, 0x50, 0xA4, 0x88, 0xA4,
+    0x88, 0xA3, 0x99, 0x50, 0x9A, 0x89, 0xA4, 0x88, 0xC0, 0x51, 0xA5, 0x88, 0x9B, 0x89, 0xA7, 0x67,
+    0xBA, 0x56, 0x9D, 0x76, 0x55, 0x51, 0x9D, 0x98, 0x56, 0x51, 0x67, 0xAB, 0xBA, 0xA3, 0xB8, 0x50,
+    0xC0, 0x69, 0x65, 0xC0, 0x9C, 0x98, 0x9D, 0x99, 0x6E, 0x7F, 0x5B, 0x99, 0x8B, 0x9D, 0x8B, 0x9F,
+    0x7B, 0x95, 0x8B, 0xA7, 0xB8, 0xA2, 0xA8, 0x9B, 0x87, 0xA3, 0x88, 0x6B, 0x66, 0x2E, 0xC0, 0x6F,
+    0xAA, 0x87, 0x65, 0x92, 0x88, 0xA3, 0x98, 0x3C, 0x97, 0x97, 0xA6, 0x88, 0xA3, 0x99, 0x5A, 0x9A,
+    0x98, 0xAB, 0x99, 0xB2, 0x77, 0x66, 0x56, 0xAC, 0x88, 0xC0, 0x7E, 0x9D, 0x88, 0x9C, 0x89, 0x9A,
+    0x88, 0x9D, 0x88, 0x66, 0xA8, 0x87, 0x04, 0x9B, 0x88, 0xB9, 0x99, 0xA6, 0x77, 0xA3, 0x9A, 0x9D,
+    0x98, 0x28, 0x05, 0x28, 0x69, 0x98, 0x88, 0x2C, 0x08, 0x9D, 0x99, 0x08, 0xA2, 0x88, 0x99, 0x99,
+    0x08, 0x1C, 0x2F, 0xC0, 0x55, 0xC0, 0xA2, 0x98, 0x20, 0xA5, 0x99, 0x7E, 0x6F, 0x9C, 0x88, 0x1B,
+    0xC1, 0x08, 0xA8, 0x88, 0x1C, 0x2F, 0x1B, 0x20, 0x08, 0xA4, 0x98, 0x1F, 0x2F, 0xC0, 0x20, 0x17,
+    0x03, 0x20, 0xA2, 0x88, 0x2C, 0x9C, 0x88, 0x2C, 0x28, 0x66, 0x08, 0x1C, 0x37, 0xA3, 0x88, 0xA5,
+    0x99, 0x03, 0x9B, 0x98, 0xA3, 0x88, 0x34, 0xA2, 0x98, 0xA4, 0x78, 0x28, 0x2F, 0x37, 0x03, 0x2B,
+    0x17, 0x9B, 0x99, 0x03, 0xA3, 0x99, 0x2B, 0x17, 0x2B, 0xA3, 0x99, 0x6E, 0xA3, 0x99, 0xA6, 0x77,
+    0x66, 0x13, 0x0F, 0x1B, 0x20, 0x1C, 0x62, 0x65, 0x17, 0x1F, 0x2B, 0xA4, 0x87, 0x18, 0x38, 0x0B,
+    0x17, 0x5A, 0xA5, 0x99, 0x3B, 0x56, 0x69, 0x3B, 0x9A, 0x88, 0xA7, 0x89, 0x69, 0x99, 0x89, 0x13,
+    0x55, 0x9A, 0x89, 0x30, 0x14, 0xA8, 0x88, 0xA8, 0x98, 0x98, 0x88, 0x07, 0x00, 0x13, 0xC0, 0x17,
+    0xAE, 0x78, 0xAB, 0x99, 0x0B, 0x37, 0x9D, 0x88, 0x3B, 0xA9, 0x88, 0xA2, 0x88, 0x7F, 0xA9, 0x89,
+    0x95, 0x88, 0xA7, 0x98, 0x7F, 0x6E, 0xAC, 0x78, 0x98, 0x98, 0xC0, 0xA2, 0x88, 0x93, 0x89, 0x9C,
+    0x98, 0x9A, 0x78, 0x96, 0x99, 0xA8, 0x89, 0xA2, 0x88, 0x32, 0xA6, 0x88, 0xB0, 0x78, 0x9D, 0x89,
+    0x9D, 0x89, 0x95, 0x99, 0xA6, 0x77, 0x61, 0x99, 0x88, 0x90, 0x88, 0xA5, 0x98, 0xA2, 0x78, 0xAC,
+    0x98, 0x55, 0x95, 0x99, 0x9B, 0x88, 0x10, 0x55, 0xA2, 0x88, 0xA3, 0x88, 0xA7, 0x88, 0xA5, 0x88,
+    0x93, 0x99, 0x55, 0xA4, 0x88, 0x52, 0x9D, 0x88, 0x10, 0x52, 0x08, 0x10, 0x08, 0x51, 0xC2, 0x03,
+    0xAE, 0x99, 0x13, 0x41, 0x9B, 0x99, 0xB3, 0x88, 0x97, 0x99, 0x65, 0xA7, 0x98, 0x8F, 0x88, 0x89,
+    0x98, 0xA4, 0x88, 0xA2, 0x98, 0xAC, 0x78, 0x7E, 0x1E, 0xA3, 0x88, 0x69, 0x6F, 0xA3, 0x99, 0xA3,
+    0x98, 0xA3, 0x89, 0x51, 0x7F, 0xA5, 0x98, 0xA2, 0x78, 0xA2, 0x99, 0x72, 0x5A, 0x55, 0x9D, 0x88,
+    0xC0, 0xAB, 0x99, 0x6E, 0x35, 0xC0, 0x2C, 0xA7, 0x88, 0x9C, 0x88, 0x2D, 0x51, 0xA6, 0x99, 0x9D,
+    0x88, 0xC0, 0xA7, 0x89, 0xA4, 0x88, 0x9A, 0x86, 0x51, 0x9D, 0x99, 0x91, 0x99, 0xA4, 0x88, 0x66,
+    0xA8, 0x88, 0x9D, 0x88, 0x35, 0xA8, 0x88, 0xA2, 0x88, 0x35, 0x94, 0x98, 0x9B, 0x99, 0x36, 0x6E,
+    0xA6, 0x88, 0x9B, 0x89, 0x6F, 0xA6, 0x88, 0x9D, 0x98, 0x13, 0x6E, 0x97, 0x99, 0x25, 0xA9, 0x99,
+    0x92, 0x88, 0x9B, 0x99, 0xA4, 0x87, 0xA5, 0x88, 0x10, 0x66, 0x50, 0x52, 0x6E, 0x9B, 0x88, 0x6F,
+    0x15, 0xA5, 0x88, 0xBB, 0x46, 0xA2, 0x65, 0x9D, 0x88, 0x51, 0x9D, 0x99, 0x55, 0x66, 0x9D, 0x89,
+    0xA9, 0xBA, 0xA7, 0xB9, 0x9D, 0x98, 0x6E, 0x59, 0x75, 0x66, 0x9D, 0x98, 0x9D, 0x99, 0x7F, 0xA3,
+    0x88, 0x6B, 0x99, 0x89, 0x96, 0x79, 0xA3, 0x7A, 0xA1, 0x8D, 0x94, 0x8A, 0xA6, 0x97, 0xA4, 0xA7,
+    0x9B, 0xA8, 0x5B, 0x6E, 0x1A, 0x1F, 0xC0, 0xA3, 0x98, 0xAA, 0x88, 0x9A, 0x88, 0x95, 0x99, 0xA8,
+    0x97, 0x9A, 0x85, 0x9C, 0x87, 0xA3, 0x99, 0xC0, 0x9A, 0x89, 0xAB, 0x98, 0xA9, 0x89, 0x98, 0x88,
+    0xA4, 0x88, 0xC0, 0x51, 0xA7, 0x98, 0x24, 0xC0, 0xA3, 0x98, 0xA4, 0x88, 0xC0, 0x93, 0x89, 0x9C,
+    0x88, 0x69, 0x34, 0xA2, 0x88, 0x9C, 0x88, 0xA3, 0x88, 0x52, 0x69, 0x34, 0x08, 0xA2, 0x88, 0x34,
+    0x9C, 0x88, 0xA7, 0x98, 0x20, 0x65, 0x7F, 0x08, 0x65, 0x20, 0x7E, 0x20, 0x34, 0xC0, 0x08, 0x3C,
+    0x34, 0x08, 0x34, 0x3C, 0x52, 0x28, 0xC0, 0x1C, 0x10, 0x28, 0x10, 0x1C, 0x34, 0x9D, 0x99, 0x10,
+    0xC0, 0x20, 0x14, 0x0C, 0x20, 0x14, 0x1B, 0x20, 0x0C, 0xC0, 0xA7, 0x99, 0xA6, 0x77, 0x0C, 0x14,
+    0xA3, 0x99, 0xA8, 0x78, 0xC0, 0x9D, 0x99, 0x3C, 0x37, 0x10, 0xA3, 0x99, 0xA2, 0x88, 0x17, 0x7E,
+    0x17, 0x10, 0x66, 0xC0, 0x3F, 0xA2, 0x88, 0x17, 0xC0, 0x51, 0x28, 0x1C, 0x33, 0xC0, 0x1F, 0x0B,
+    0x28, 0x9D, 0x99, 0xC0, 0x56, 0x3F, 0x33, 0x9B, 0x99, 0x33, 0xA4, 0x88, 0xA2, 0x88, 0x1B, 0x55,
+    0xA2, 0x88, 0x9A, 0x88, 0x04, 0x9C, 0x89, 0x17, 0x2B, 0xA6, 0x88, 0x33, 0x04, 0x27, 0x6F, 0xA3,
+    0x98, 0xA2, 0x88, 0x0F, 0x56, 0x13, 0x3F, 0x13, 0x2B, 0x03, 0x2B, 0x3F, 0x23, 0xA3, 0x89, 0x27,
+    0x13, 0xC0, 0x6F, 0xA8, 0x87, 0x23, 0xA2, 0x88, 0xA8, 0x78, 0x65, 0x9C, 0x88, 0x66, 0x6F, 0xA8,
+    0x88, 0xA6, 0x87, 0x95, 0x99, 0x28, 0xA6, 0x88, 0x99, 0x89, 0x97, 0x98, 0xB0, 0x89, 0x0F, 0xA4,
+    0x78, 0x2B, 0x98, 0x88, 0x9A, 0x89, 0x9C, 0x88, 0xA7, 0x88, 0x9B, 0x99, 0xA7, 0x89, 0xA5, 0x89,
+    0x99, 0x88, 0x96, 0x88, 0xAD, 0x98, 0x9D, 0x88, 0x8A, 0x98, 0x55, 0xA3, 0x89, 0xA2, 0x88, 0xA5,
+    0x98, 0x6F, 0xA5, 0x98, 0xA2, 0x88, 0xC0, 0xA6, 0x88, 0x9D, 0x98, 0x0D, 0x51, 0x40, 0x7F, 0xA4,
+    0x88, 0x7F, 0x61, 0xA3, 0x88, 0xA3, 0x88, 0x29, 0x21, 0x24, 0x29, 0x99, 0x89, 0x39, 0x12, 0x7A,
+    0x51, 0x67, 0xAF, 0x79, 0xA1, 0x9A, 0x9D, 0x88, 0xA4, 0x88, 0x9C, 0x87, 0xA3, 0x99, 0x60, 0x34,
+    0x51, 0xA7, 0x99, 0xA5, 0x88, 0x3F, 0xA4, 0x88, 0xA2, 0x87, 0x6E, 0xC0, 0x7F, 0x5A, 0xA3, 0x98,
+    0x9D, 0x88, 0x98, 0x88, 0xAC, 0x88, 0x98, 0x88, 0x98, 0x88, 0x34, 0xA8, 0x99, 0x6E, 0x34, 0x51,
+    0xB4, 0x88, 0xA3, 0x98, 0x9B, 0x89, 0xAA, 0x88, 0x51, 0x99, 0x99, 0x9D, 0x88, 0x99, 0x98, 0x00,
+    0x1C, 0xA3, 0x89, 0x90, 0x88, 0xA7, 0x99, 0x24, 0x66, 0x04, 0x97, 0x88, 0x9A, 0x99, 0x9D, 0x88,
+    0xA5, 0x99, 0x14, 0xA3, 0x98, 0x55, 0xA6, 0x88, 0x96, 0x99, 0x9A, 0x77, 0xAA, 0x99, 0xA2, 0x88,
+    0xC0, 0x17, 0x93, 0x98, 0xAB, 0x89, 0x9C, 0x88, 0x56, 0xA8, 0x88, 0x13, 0x97, 0x88, 0xA6, 0x88,
+    0x99, 0x99, 0x9D, 0x88, 0xB0, 0x88, 0x8D, 0x99, 0x9D, 0x99, 0xA2, 0x87, 0xA3, 0x88, 0xA4, 0x88,
+    0x7F, 0x51, 0x28, 0x51, 0x9A, 0x88, 0x00, 0x55, 0x5B, 0xB4, 0x56, 0xAC, 0x55, 0x9C, 0x77, 0x64,
+    0x9D, 0x89, 0x51, 0x66, 0x51, 0xA4, 0x99, 0xA6, 0xBA, 0x7D, 0xA2, 0x88, 0x56, 0x38, 0x7A, 0x55,
+    0x9D, 0xA9, 0x6E, 0x7F, 0x6B, 0x9A, 0x77, 0x96, 0x77, 0x9B, 0x9A, 0xA4, 0x7C, 0xA4, 0x7C, 0x95,
+    0x89, 0xA3, 0xA9, 0xA5, 0xB8, 0x9C, 0x87, 0xC0, 0x6E, 0x61, 0x1A, 0x1F, 0xA5, 0x98, 0xA6, 0x88,
+    0x96, 0x88, 0x65, 0xA7, 0x97, 0x93, 0x97, 0xA2, 0x88, 0x7A, 0x9B, 0x88, 0xAC, 0x88, 0xA7, 0x99,
+    0x99, 0x89, 0xA2, 0x88, 0x66, 0x50, 0x00, 0xA8, 0x87, 0xA7, 0x9A, 0x50, 0x51, 0x6B, 0x65, 0x98,
+    0x78, 0x20, 0x11, 0x65, 0xA2, 0x88, 0xA9, 0x89, 0x7F, 0x9B, 0x98, 0x51, 0xC0, 0xA2, 0x89, 0x10,
+    0x6F, 0x9C, 0x98, 0xC0, 0xA2, 0x88, 0x3C, 0x51, 0x6F, 0x9D, 0x99, 0x34, 0x3C, 0x1C, 0x24, 0x3C,
+    0x9D, 0x89, 0x65, 0x1B, 0x20, 0x28, 0x14, 0x28, 0x14, 0x56, 0x28, 0x66, 0x37, 0x3C, 0x34, 0x20,
+    0x14, 0x66, 0x3C, 0x6F, 0x28, 0x34, 0x3C, 0x37, 0x28, 0x9C, 0x88, 0x56, 0x34, 0xA5, 0x99, 0x34,
+    0x0C, 0xC0, 0x20, 0x10, 0x28, 0x37, 0x23, 0x3C, 0xA3, 0x99, 0x34, 0x3C, 0x34, 0x28, 0x3C, 0x1F,
+    0x0B, 0x1F, 0x10, 0xC0, 0xA3, 0x89, 0xA2, 0x98, 0x1F, 0x07, 0xA2, 0x88, 0x0B, 0x37, 0x1F, 0x0B,
+    0xC0, 0x37, 0x28, 0x37, 0x56, 0x0B, 0x24, 0xA8, 0x99, 0x55, 0x07, 0xA7, 0x99, 0x40, 0x9A, 0x88,
+    0x0B, 0x1F, 0x7F, 0x6E, 0xA5, 0x88, 0x38, 0x9A, 0x89, 0xA8, 0x87, 0xA7, 0x89, 0xA3, 0x99, 0x51,
+    0x3B, 0xA2, 0x88, 0x6F, 0x37, 0x3B, 0x6E, 0x9A, 0x99, 0x08, 0xA2, 0x99, 0x0E, 0x3B, 0x0E, 0x00,
+    0x9C, 0x88, 0x9B, 0x89, 0x0F, 0xA8, 0x78, 0x61, 0x97, 0x88, 0xA6, 0x89, 0x69, 0x97, 0x99, 0x56,
+    0x13, 0x23, 0xAD, 0x89, 0x98, 0x87, 0x56, 0xA6, 0x98, 0x08, 0x0B, 0x9A, 0x88, 0xA3, 0x99, 0xA5,
+    0x88, 0xA4, 0x88, 0x95, 0x89, 0x66, 0xA6, 0x88, 0xA3, 0x88, 0x7F, 0xAD, 0x89, 0x6E, 0x8E, 0x88,
+    0x9D, 0x88, 0x7A, 0x96, 0x88, 0x2F, 0xA3, 0x88, 0xA2, 0x89, 0xA5, 0x98, 0x2B, 0x9B, 0x89, 0x6E,
+    0xA3, 0x98, 0xA2, 0x88, 0x13, 0x2B, 0x69, 0x1C, 0xC0, 0x29, 0x01, 0x62, 0x29, 0xC0, 0x24, 0x01,
+    0xA7, 0x99, 0xA4, 0x88, 0x9B, 0x89, 0xC1, 0x9C, 0x99, 0x2B, 0x23, 0xAD, 0x89, 0x9B, 0x89, 0x27,
+    0xA3, 0x89, 0x69, 0x3E, 0x99, 0x98, 0x90, 0x77, 0x1C, 0x30, 0xC0, 0x2B, 0xA2, 0x88, 0xA3, 0x99,
+    0x3A, 0x2B, 0xA2, 0x98, 0x13, 0x04, 0xA3, 0x98, 0xA6, 0x88, 0xA2, 0x88, 0x99, 0x89, 0xA2, 0x88,
+    0xA2, 0x88, 0x65, 0xA5, 0x99, 0xC0, 0x51, 0xA7, 0x98, 0xA9, 0x89, 0x9D, 0x98, 0xA7, 0x89, 0x9A,
+    0x87, 0x2B, 0x51, 0x51, 0x5A, 0x51, 0x9C, 0x88, 0x7F, 0x00, 0xA7, 0x98, 0xA4, 0x88, 0x98, 0x88,
+    0x8C, 0x88, 0xA9, 0x89, 0x51, 0xA2, 0x98, 0xA7, 0x88, 0xA4, 0x88, 0xA7, 0x99, 0x55, 0x9D, 0x99,
+    0x2B, 0x3F, 0x90, 0x88, 0x52, 0x95, 0x88, 0x32, 0xA2, 0x88, 0xA5, 0x88, 0x9A, 0x88, 0x5A, 0x66,
+    0xC0, 0x02, 0xA3, 0x88, 0x33, 0xA6, 0x88, 0x95, 0x88, 0x0C, 0x61, 0xA4, 0x88, 0xC0, 0x9D, 0x88,
+    0x23, 0x37, 0x9B, 0x99, 0x3B, 0xA4, 0x77, 0x51, 0x9B, 0x89, 0xAF, 0x57, 0xB4, 0x67, 0x9C, 0x76,
+    0x68, 0x9D, 0x88, 0x52, 0x56, 0x51, 0x61, 0xA5, 0xA9, 0xA6, 0x99, 0xA2, 0x88, 0x7A, 0xC0, 0x65,
+    0xC0, 0x9D, 0x98, 0x7F, 0x6F, 0xA2, 0x88, 0x98, 0x88, 0x97, 0x88, 0x9C, 0x88, 0x99, 0x9A, 0xA8,
+    0x7C, 0xA3, 0x7C, 0x95, 0x99, 0xA3, 0xB8, 0xA6, 0x97, 0x50, 0x41, 0x76, 0xC0, 0x6F, 0x27, 0xA5,
+    0x99, 0xA3, 0x88, 0x99, 0x98, 0xA9, 0x98, 0x94, 0x96, 0x50, 0x9D, 0x99, 0x9D, 0x99, 0xAA, 0x78,
+    0xAD, 0x98, 0x97, 0x89, 0xA4, 0x88, 0xA4, 0x98, 0x52, 0x69, 0x56, 0xC0, 0x6E, 0x9A, 0x98, 0x9D,
+    0x89, 0x55, 0x27, 0xA4, 0x88, 0x8C, 0x77, 0x66, 0xA5, 0x88, 0x21, 0x9D, 0x99, 0x9B, 0x98, 0xA7,
+    0x99, 0x6E, 0x9B, 0x89, 0x7E, 0xC0, 0x9B, 0x89, 0x14, 0x0C, 0x14, 0x9D, 0x99, 0x0C, 0x14, 0x7F,
+    0x14, 0xC0, 0x0C, 0x65, 0xC0, 0xA3, 0x89, 0x61, 0xA3, 0x88, 0x7F, 0xA4, 0x78, 0x24, 0x3C, 0x6E,
+    0x9C, 0x88, 0x23, 0x20, 0x28, 0x23, 0x28, 0x34, 0x37, 0x34, 0x19, 0x14, 0x3C, 0x10, 0x37, 0x23,
+    0x0F, 0x14, 0x1C, 0x08, 0x9B, 0x88, 0x7B, 0x23, 0x00, 0x14, 0xC0, 0x0F, 0x14, 0x0F, 0x14, 0x52,
+    0x0F, 0xC0, 0x37, 0x0F, 0x1B, 0x37, 0x28, 0x3B, 0x3C, 0xA5, 0x99, 0x9D, 0x99, 0x3C, 0x7B, 0xAC,
+    0x88, 0x9D, 0x88, 0x1F, 0x65, 0x56, 0xA3, 0x98, 0x0B, 0x2E, 0x24, 0x23, 0x0B, 0xC0, 0x1F, 0xA3,
+    0x88, 0x18, 0x03, 0x1B, 0xC0, 0x33, 0xAA, 0x88, 0x03, 0x3C, 0xA5, 0x89, 0x04, 0x66, 0x9C, 0x88,
+    0x04, 0x3F, 0xC0, 0xA7, 0x88, 0x7B, 0x9D, 0x88, 0x9B, 0x89, 0x27, 0xAE, 0x88, 0x9C, 0x88, 0x3F,
+    0x27, 0xA4, 0x88, 0x9D, 0x99, 0x9C, 0x88, 0x9C, 0x88, 0x3F, 0x18, 0x1C, 0x04, 0xA4, 0x89, 0x99,
+    0x88, 0x17, 0x33, 0x0F, 0xA3, 0x89, 0x9D, 0x88, 0x30, 0x3F, 0x18, 0x0B, 0xA2, 0x88, 0xA7, 0x89,
+    0x92, 0x88, 0x9A, 0x88, 0xA5, 0x89, 0xA5, 0x98, 0x97, 0x99, 0x99, 0x78, 0xA6, 0x88, 0x66, 0xA3,
+    0x88, 0x7F, 0xA2, 0x79, 0xA2, 0x88, 0x97, 0x98, 0x94, 0x87, 0xA7, 0x99, 0x20, 0xAA, 0x88, 0xC0,
+    0x9C, 0x99, 0x1C, 0x30, 0x9D, 0x89, 0x3F, 0xA5, 0x88, 0x97, 0x99, 0x3A, 0x9A, 0x88, 0x3F, 0xAC,
+    0x88, 0x2C, 0x30, 0x9D, 0x98, 0x33, 0x39, 0x6F, 0x51, 0x96, 0x88, 0x65, 0xA5, 0x99, 0x17, 0x3F,
+    0x51, 0x17, 0x51, 0xAA, 0x89, 0xA2, 0x78, 0x9D, 0x99, 0xA6, 0x78, 0xA4, 0x98, 0xA7, 0x88, 0x99,
+    0x97, 0x87, 0x99, 0xC0, 0xB0, 0x88, 0x2C, 0x51, 0xA3, 0x99, 0x13, 0x27, 0x7A, 0xA3, 0x89, 0x22,
+    0xA7, 0x88, 0xA5, 0x88, 0x9C, 0x88, 0x9C, 0x88, 0xA5, 0x98, 0x51, 0xA6, 0x88, 0xC0, 0x93, 0x99,
+    0x2F, 0x9C, 0x88, 0x66, 0xA7, 0x88, 0xAB, 0x98, 0xB0, 0x78, 0x9C, 0x98, 0x94, 0x78, 0x9D, 0x98,
+    0x1C, 0xA9, 0x99, 0x69, 0x18, 0xA6, 0x88, 0xA7, 0x99, 0x9B, 0x88, 0x9D, 0x98, 0xAA, 0x88, 0x9C,
+    0x88, 0x0C, 0xA2, 0x88, 0x08, 0x99, 0x99, 0x99, 0x88, 0xA4, 0x88, 0x9B, 0x99, 0x55, 0x07, 0x34,
+    0xC0, 0x8E, 0x89, 0x9B, 0x99, 0x6E, 0x33, 0xA3, 0x99, 0x03, 0xA2, 0x88, 0x9B, 0x89, 0xA2, 0x88,
+    0x03, 0x9B, 0x98, 0x95, 0x89, 0x6E, 0x07, 0x92, 0x88, 0x6E, 0xA2, 0x88, 0x7E, 0x52, 0x14, 0xA3,
+    0x99, 0x14, 0x3B, 0xA2, 0x77, 0xA2, 0x88, 0x9B, 0x99, 0x9B, 0x79, 0xAA, 0x66, 0xBA, 0x68, 0x9F,
+    0x66, 0x69, 0x9B, 0x98, 0xC0, 0x45, 0x9D, 0x99, 0x65, 0xA1, 0xA9, 0xA2, 0x98, 0xA2, 0x88, 0xA3,
+    0x99, 0x2D, 0xC0, 0x51, 0x9D, 0x98, 0xA1, 0xA9, 0xA3, 0x89, 0xC0, 0x93, 0x88, 0x65, 0x9B, 0x99,
+    0x9C, 0x89, 0x9C, 0x89, 0xA9, 0x7C, 0xA4, 0x8B, 0x95, 0x99, 0xA3, 0x98, 0xA6, 0xA6, 0x51, 0x41,
+    0x7F, 0x66, 0x1F, 0xA2, 0x98, 0xA5, 0x88, 0x1E, 0x60, 0xA5, 0x86, 0x98, 0x98, 0x97, 0x98, 0x56,
+    0xA8, 0x98, 0xA9, 0x89, 0x51, 0xA7, 0x98, 0x9D, 0x89, 0x9B, 0x88, 0x23, 0xA6, 0x87, 0x9D, 0x99,
+    0x9B, 0x88, 0xA2, 0x88, 0x9D, 0x9A, 0x33, 0x98, 0x98, 0x55, 0x99, 0x88, 0x51, 0xC0, 0xA3, 0x98,
+    0xC0, 0xA2, 0x88, 0x56, 0x28, 0x34, 0x61, 0x0C, 0x65, 0x3C, 0x20, 0x14, 0xA5, 0x89, 0x7A, 0x6E,
+    0x28, 0x14, 0xC1, 0x00, 0x7F, 0x14, 0x0C, 0xA4, 0x98, 0x10, 0x20, 0xA2, 0x87, 0x3C, 0x28, 0x9D,
+    0x88, 0x14, 0x28, 0xC2, 0x14, 0x23, 0x20, 0x14, 0xA5, 0x88, 0x08, 0x28, 0x00, 0x6B, 0x9D, 0x98,
+    0x34, 0x33, 0x93, 0x98, 0x05, 0x2D, 0x10, 0x20, 0xC0, 0x37, 0x14, 0xA7, 0x99, 0x10, 0x20, 0x28,
+    0x3C, 0x0F, 0x28, 0x37, 0x28, 0x14, 0x28, 0x3C, 0x28, 0x0F, 0x7E, 0x23, 0xA5, 0x98, 0x6B, 0x9C,
+    0x87, 0x1F, 0xA4, 0x88, 0x51, 0x1F, 0x9D, 0x99, 0x0B, 0xA3, 0x88, 0x37, 0x3C, 0x06, 0x14, 0x37,
+    0x24, 0x6F, 0xA8, 0x98, 0x99, 0x98, 0x1F, 0x33, 0x2F, 0x3C, 0x07, 0xA2, 0x88, 0x41, 0x9B, 0x99,
+    0xA8, 0x88, 0xAA, 0x88, 0x95, 0x88, 0x9D, 0x99, 0xA3, 0x99, 0xA3, 0x88, 0x22, 0xC0, 0xA4, 0x77,
+    0x18, 0x9C, 0x99, 0x27, 0x6F, 0xC0, 0xA4, 0x98, 0x55, 0x04, 0x00, 0x51, 0x3F, 0x27, 0x18, 0x30,
+    0xA4, 0x89, 0x2C, 0x3F, 0x0F, 0x6F, 0xA2, 0x88, 0xA9, 0x98, 0x98, 0x88, 0x51, 0xC0, 0xA5, 0x89,
+    0x1B, 0x9B, 0x99, 0x51, 0x1B, 0xA6, 0x78, 0x66, 0x51, 0x9A, 0x88, 0x93, 0x89, 0xA4, 0x88, 0xA9,
+    0x89, 0x95, 0x98, 0x9A, 0x87, 0xA7, 0x99, 0xA2, 0x88, 0xA6, 0x88, 0x6E, 0x7F, 0x30, 0x3F, 0x2B,
+    0x3B, 0xC0, 0xA4, 0x88, 0x99, 0x99, 0x02, 0xA2, 0x78, 0x66, 0x02, 0x33, 0xA5, 0x89, 0xA3, 0x88,
+    0xAB, 0x98, 0x9C, 0x88, 0x3F, 0x69, 0xA2, 0x88, 0x9B, 0x89, 0x3F, 0x6F, 0x13, 0x9A, 0x88, 0x66,
+    0xAD, 0x89, 0x9D, 0x88, 0x9D, 0x89, 0xAB, 0x89, 0x97, 0x98, 0xA3, 0x98, 0x3B, 0x8F, 0x88, 0xA7,
+    0x98, 0x3F, 0xAB, 0x88, 0x23, 0xA6, 0x88, 0x9D, 0x99, 0x9B, 0x98, 0xA3, 0x89, 0xA3, 0x98, 0xA2,
+    0x88, 0xA2, 0x78, 0x04, 0x56, 0x99, 0x98, 0xC0, 0xA4, 0x88, 0x9A, 0x88, 0x9B, 0x99, 0xAA, 0x88,
+    0x23, 0x79, 0xA4, 0x88, 0xA5, 0x89, 0x9D, 0x98, 0xB1, 0x89, 0x65, 0x9B, 0x89, 0x92, 0x88, 0x1B,
+    0xA3, 0x89, 0x6E, 0x2C, 0x1C, 0xA7, 0x98, 0x9B, 0x89, 0x17, 0x00, 0x7E, 0x8F, 0x89, 0x9B, 0x98,
+    0xA9, 0x99, 0x9D, 0x88, 0xA6, 0x88, 0x51, 0x95, 0x99, 0xC0, 0x51, 0xA7, 0x88, 0xA8, 0x89, 0x17,
+    0x99, 0x99, 0x38, 0x02, 0x34, 0x2B, 0xC0, 0x3C, 0x0F, 0x95, 0x98, 0x9B, 0x99, 0x99, 0x88, 0xA2,
+    0x88, 0x27, 0x6E, 0xA4, 0x88, 0xA5, 0x99, 0xA4, 0x87, 0x98, 0x88, 0x9B, 0x89, 0x14, 0xA3, 0x99,
+    0x14, 0xA4, 0x88, 0xC0, 0x9B, 0x99, 0x15, 0x5E, 0xB7, 0x78, 0xA9, 0x67, 0x40, 0x9C, 0x77, 0x79,
+    0x5A, 0x51, 0x9D, 0x98, 0x7E, 0x7A, 0x9D, 0x98, 0x6B, 0x6B, 0xA3, 0x99, 0xA1, 0x8A, 0x51, 0xA2,
+    0x98, 0xA2, 0x78, 0x99, 0x98, 0x9D, 0x98, 0xA2, 0x98, 0x99, 0x99, 0x59, 0x9D, 0xA9, 0x9B, 0x99,
+    0xAC, 0x8C, 0xA2, 0x6B, 0x95, 0x99, 0xA2, 0x98, 0xA6, 0x97, 0x69, 0xC0, 0x67, 0xC0, 0x36, 0xA2,
+    0x88, 0xA3, 0x88, 0xC0, 0x7E, 0x20, 0x91, 0x98, 0x9C, 0x98, 0xAC, 0x77, 0x66, 0x52, 0xA5, 0x99,
+    0x55, 0x9B, 0x98, 0x3F, 0x55, 0x7E, 0x7F, 0xA9, 0x89, 0x9B, 0x88, 0x27, 0x13, 0x27, 0x94, 0x77,
+    0x9D, 0x99, 0xC0, 0xA2, 0x87, 0x6B, 0x65, 0x0C, 0xA2, 0x98, 0xA3, 0x88, 0x1C, 0x08, 0x50, 0x6B,
+    0x65, 0x9D, 0x99, 0x28, 0xC0, 0x23, 0x14, 0x19, 0x23, 0xC0, 0x3C, 0x30, 0x3C, 0x14, 0x0C, 0x28,
+    0x19, 0x28, 0x3C, 0xA7, 0x88, 0x9D, 0x99, 0x9B, 0x99, 0x23, 0x3C, 0x08, 0xC0, 0x28, 0x14, 0x23,
+    0x2D, 0x1C, 0x34, 0x14, 0x28, 0x3C, 0x99, 0x99, 0x34, 0xA5, 0x99, 0x0C, 0x05, 0x2D, 0x34, 0x3C,
+    0x34, 0xA3, 0x98, 0x28, 0x23, 0x28, 0xC0, 0x23, 0x2D, 0x28, 0xC0, 0xA5, 0x99, 0xA5, 0x88, 0xC0,
+    0x37, 0x28, 0x2D, 0x3C, 0x28, 0x37, 0xA2, 0x88, 0x9D, 0x98, 0x1F, 0x07, 0xC0, 0xA4, 0x88, 0x65,
+    0x9A, 0x88, 0x10, 0x1F, 0x33, 0x3C, 0x37, 0xAA, 0x88, 0x0C, 0x33, 0xC0, 0x1B, 0x33, 0x7F, 0x1B,
+    0x99, 0x99, 0x0C, 0xA4, 0x88, 0x1F, 0x3C, 0x18, 0x3F, 0x1C, 0xA9, 0x99, 0x1F, 0x30, 0xA2, 0x99,
+    0x1C, 0xC0, 0x30, 0xA5, 0x99, 0xA3, 0x88, 0x98, 0x99, 0x55, 0x36, 0xA4, 0x77, 0x13, 0x00, 0x2C,
+    0x14, 0x00, 0x27, 0x18, 0x13, 0x3F, 0xC1, 0x6F, 0xA8, 0x88, 0xA6, 0x87, 0xAA, 0x88, 0x97, 0x99,
+    0x13, 0x6F, 0xC0, 0x66, 0x9B, 0x88, 0xA7, 0x99, 0xA2, 0x88, 0xA3, 0x78, 0xA3, 0x99, 0x51, 0x98,
+    0x88, 0x97, 0x89, 0xA6, 0x88, 0x56, 0x50, 0x7E, 0xC0, 0xAA, 0x88, 0x61, 0xA7, 0x89, 0x55, 0xA2,
+    0x98, 0x5A, 0x3B, 0xA2, 0x88, 0x9B, 0x88, 0x3B, 0x27, 0xA3, 0x99, 0x3B, 0x61, 0xA8, 0x88, 0x5A,
+    0x9D, 0x98, 0x6F, 0x0F, 0x2C, 0x7E, 0xA3, 0x89, 0x9C, 0x98, 0x27, 0x52, 0x9D, 0x98, 0xA4, 0x88,
+    0xC0, 0x3A, 0x9D, 0x89, 0x9D, 0x89, 0xB4, 0x87, 0xA4, 0x89, 0x94, 0x77, 0x27, 0x3B, 0x20, 0xA7,
+    0x99, 0x18, 0xA8, 0x88, 0xA2, 0x98, 0x14, 0x23, 0xA5, 0x98, 0x0F, 0x22, 0xA2, 0x88, 0x1B, 0x6E,
+    0xA7, 0x99, 0x1B, 0xAB, 0x88, 0x51, 0x92, 0x88, 0x2C, 0x17, 0x2F, 0x30, 0x17, 0x51, 0x30, 0x17,
+    0xA3, 0x98, 0xA8, 0x89, 0x6E, 0xAA, 0x88, 0x65, 0x96, 0x78, 0xA3, 0x99, 0x13, 0x2B, 0x30, 0xA6,
+    0x88, 0x13, 0x1B, 0x1F, 0xA8, 0x87, 0x7F, 0x9A, 0x88, 0x55, 0xA2, 0x88, 0x7F, 0xAB, 0x88, 0x28,
+    0x20, 0x37, 0xA2, 0x78, 0x99, 0x99, 0x20, 0x9C, 0x88, 0x66, 0x07, 0x1B, 0x38, 0x98, 0x89, 0x61,
+    0xA2, 0x88, 0x33, 0x32, 0x9D, 0x88, 0xA3, 0x88, 0x1C, 0xA3, 0x89, 0x24, 0xC0, 0x0F, 0x69, 0xA2,
+    0x89, 0x9C, 0x87, 0xA3, 0x89, 0xC1, 0x9D, 0x89, 0x15, 0xB0, 0x68, 0xB1, 0x57, 0x9C, 0x77, 0x50,
+    0x54, 0x26, 0x65, 0x9D, 0x88, 0x7E, 0x7E, 0x55, 0x61, 0x57, 0xA1, 0x9A, 0xA1, 0x9A, 0x56, 0x7F,
+    0x35, 0x96, 0x88, 0xC0, 0x65, 0x65, 0x55, 0x9A, 0xB8, 0x9F, 0xB9, 0x9E, 0x68, 0xA7, 0x7C, 0xA5,
+    0x8D, 0x95, 0xA9, 0x7E, 0xA6, 0x97, 0x6E, 0x5A, 0x7F, 0x7A, 0x6F, 0x7E, 0xA3, 0x88, 0x7F, 0x7D,
+    0x9C, 0x97, 0x91, 0x88, 0x0C, 0x51, 0xA3, 0x89, 0xA6, 0x88, 0x9C, 0x88, 0x9C, 0x88, 0x51, 0x3B,
+    0x69, 0x38, 0x9C, 0x89, 0x55, 0xA8, 0x99, 0x14, 0x99, 0x99, 0x94, 0x87, 0x56, 0x6E, 0x08, 0x51,
+    0x14, 0xA2, 0x88, 0x7F, 0x28, 0xC0, 0xA2, 0x88, 0xC1, 0x01, 0x9C, 0x99, 0xA5, 0x88, 0x3C, 0x08,
+    0x34, 0x9C, 0x87, 0x23, 0x28, 0x2D, 0x10, 0x37, 0x28, 0x10, 0xC0, 0x2D, 0x3C, 0x10, 0xA2, 0x88,
+    0x3C, 0x10, 0x34, 0xC0, 0x2D, 0x3C, 0x23, 0xC0, 0x37, 0x28, 0x14, 0x6E, 0x01, 0x7E, 0x10, 0x19,
+    0x05, 0xC0, 0x51, 0x19, 0x05, 0x7A, 0x37, 0x01, 0x10, 0x9D, 0x98, 0x3C, 0x28, 0x65, 0x14, 0x3C,
+    0x37, 0x28, 0x9D, 0x99, 0xA3, 0x98, 0x37, 0x28, 0x24, 0x10, 0x28, 0xA4, 0x98, 0x30, 0x9D, 0x99,
+    0x0F, 0x30, 0x3C, 0x9A, 0x88, 0x28, 0x3C, 0x7F, 0xC0, 0x23, 0x37, 0xC0, 0x24, 0xA7, 0x99, 0x04,
+    0x9C, 0x98, 0xC1, 0xA3, 0x99, 0x0B, 0xC0, 0xA7, 0x98, 0x56, 0x28, 0x37, 0x10, 0x1F, 0x0B, 0x9D,
+    0x89, 0x51, 0x28, 0xA4, 0x89, 0x7F, 0x0B, 0x5A, 0x17, 0x07, 0xA3, 0x89, 0x9B, 0x99, 0x08, 0xA4,
+    0x98, 0x07, 0xC0, 0x0E, 0x27, 0x22, 0xA5, 0x88, 0xC0, 0x2C, 0xA9, 0x99, 0x99, 0x99, 0x98, 0x78,
+    0xAA, 0x88, 0xA2, 0x87, 0x6B, 0xC0, 0x03, 0x9A, 0x87, 0x99, 0x99, 0x27, 0x51, 0x99, 0x89, 0xA7,
+    0x99, 0xA6, 0x77, 0x37, 0xA6, 0x78, 0x7A, 0x9D, 0x89, 0x55, 0x6B, 0x99, 0x99, 0xC0, 0x55, 0xA6,
+    0x87, 0xAC, 0x88, 0x0C, 0x66, 0xC0, 0x20, 0x03, 0x9B, 0x89, 0x51, 0x13, 0xC0, 0xA6, 0x88, 0x66,
+    0xC0, 0x98, 0x88, 0xA2, 0x88, 0xA4, 0x88, 0x7E, 0x0A, 0x2F, 0x33, 0x0E, 0x07, 0x1B, 0x07, 0x0E,
+    0x9D, 0x88, 0x3A, 0x66, 0x51, 0x97, 0x88, 0x9A, 0x88, 0xB0, 0x88, 0xB1, 0x89, 0x9D, 0x88, 0xA4,
+    0x88, 0x2F, 0x08, 0x7E, 0x03, 0x56, 0x65, 0xC0, 0x96, 0x88, 0xC0, 0x3A, 0x2E, 0xA2, 0x88, 0x3A,
+    0x3F, 0xA6, 0x87, 0xA3, 0x99, 0x2F, 0x20, 0x0C, 0x6F, 0xA9, 0x98, 0xC0, 0xA3, 0x99, 0x93, 0x99,
+    0x9A, 0x87, 0x10, 0xAC, 0x88, 0x9A, 0x98, 0x17, 0x33, 0xB1, 0x98, 0xA3, 0x88, 0x9A, 0x89, 0xA6,
+    0x88, 0xA7, 0x88, 0x97, 0x98, 0x93, 0x89, 0x9A, 0x88, 0xC0, 0xA9, 0x98, 0x0F, 0x0C, 0xAA, 0x98,
+    0x27, 0x0F, 0xA4, 0x88, 0xA2, 0x88, 0x28, 0x0F, 0x07, 0x0F, 0x03, 0x96, 0x88, 0x9B, 0x98, 0xA8,
+    0x88, 0x13, 0xA3, 0x89, 0x3B, 0x9B, 0x89, 0x9B, 0x99, 0x6E, 0x02, 0x0F, 0x0B, 0x99, 0x99, 0xA4,
+    0x77, 0x7F, 0x28, 0x7E, 0xC0, 0x10, 0x04, 0x1F, 0x13, 0x98, 0x78, 0x10, 0x61, 0xC0, 0x30, 0x9C,
+    0x78, 0xA2, 0x79, 0xB7, 0x58, 0x9E, 0x56, 0x55, 0x64, 0x6D, 0x66, 0x54, 0x64, 0xA2, 0x88, 0x65,
+    0x52, 0x66, 0xA1, 0x8A, 0xA1, 0x9A, 0x66, 0x7F, 0x6E, 0x96, 0x88, 0x51, 0x7E, 0xA2, 0x88, 0x60,
+    0x98, 0xA8, 0xA3, 0xB8, 0x51, 0x98, 0x6A, 0xAB, 0x8D, 0xA7, 0x9C, 0x94, 0x89, 0x64, 0xA6, 0x97,
+    0x5E, 0x66, 0xA2, 0x88, 0xA2, 0x88, 0x7A, 0x6E, 0xA3, 0x99, 0xA2, 0x88, 0xA2, 0x97, 0x97, 0x97,
+    0x7D, 0xA3, 0x89, 0xA4, 0x88, 0x00, 0x95, 0x99, 0x30, 0xA3, 0x98, 0x6F, 0x0F, 0x9D, 0x88, 0x7E,
+    0x66, 0x30, 0xA6, 0x99, 0x2C, 0x90, 0x88, 0xA2, 0x88, 0x11, 0x0C, 0xC0, 0x51, 0x14, 0xC0, 0x0C,
+    0x14, 0xA2, 0x88, 0x2D, 0x28, 0x9B, 0x98, 0xA2, 0x88, 0x14, 0xC0, 0x66, 0xC0, 0x14, 0x1C, 0x28,
+    0x19, 0xC0, 0x51, 0x14, 0xA3, 0x99, 0x2D, 0x62, 0x1C, 0x23, 0x05, 0x08, 0x14, 0xA3, 0x98, 0x2D,
+    0x23, 0xC0, 0xA3, 0x88, 0xC0, 0x34, 0x6B, 0x08, 0x56, 0x05, 0xA3, 0x98, 0x2D, 0xC0, 0x3C, 0x1C,
+    0x3C, 0x6E, 0x2D, 0x37, 0x1C, 0x23, 0x1C, 0x14, 0x7A, 0xA2, 0x88, 0x14, 0x61, 0x17, 0x23, 0x28,
+    0xC0, 0x23, 0x08, 0x1C, 0x30, 0xC0, 0x28, 0x1C, 0xC0, 0xA9, 0x99, 0x9D, 0x88, 0x9D, 0x88, 0x7F,
+    0xA3, 0x89, 0xC0, 0x18, 0x9D, 0x99, 0x17, 0x03, 0x56, 0x51, 0x3B, 0x14, 0x9C, 0x88, 0x31, 0x03,
+    0x3B, 0x03, 0x27, 0x00, 0xAD, 0x99, 0xA3, 0x88, 0x28, 0xA5, 0x99, 0x24, 0xA2, 0x88, 0x1F, 0xC0,
+    0x3C, 0x1F, 0x66, 0xA3, 0x78, 0x9D, 0x98, 0x56, 0x38, 0x08, 0x38, 0xA3, 0x89, 0x24, 0x10, 0x6B,
+    0xA2, 0x88, 0xA2, 0x88, 0x20, 0xA4, 0x89, 0x6E, 0x61, 0x14, 0xA2, 0x98, 0x98, 0x88, 0x9A, 0x78,
+    0x17, 0x0F, 0xA8, 0x88, 0x91, 0x89, 0x3F, 0x13, 0xAA, 0x88, 0xA3, 0x88, 0x14, 0x99, 0x9A, 0xA2,
+    0x77, 0x9C, 0x99, 0xA2, 0x77, 0x0B, 0x24, 0x9D, 0x89, 0x97, 0x99, 0xA6, 0x88, 0x33, 0xC0, 0x2F,
+    0xA9, 0x88, 0x65, 0x56, 0xA6, 0x98, 0xAB, 0x88, 0x9A, 0x88, 0x99, 0x89, 0xA5, 0x99, 0xA2, 0x88,
+    0x9A, 0x88, 0x18, 0x27, 0x3E, 0xA6, 0x78, 0x98, 0x98, 0x9D, 0x89, 0xA6, 0x88, 0x55, 0x66, 0x0E,
+    0x3E, 0x36, 0x23, 0xA3, 0x99, 0x51, 0x0F, 0x9A, 0x99, 0x0A, 0x0E, 0x9B, 0x88, 0x98, 0x89, 0x9A,
+    0x88, 0xB3, 0x98, 0xA7, 0x89, 0x55, 0xC0, 0x3B, 0x8B, 0x98, 0xA6, 0x88, 0xAD, 0x88, 0x9D, 0x99,
+    0x38, 0x61, 0x20, 0xC0, 0x66, 0x3E, 0x9C, 0x88, 0x3E, 0x6E, 0x99, 0x98, 0x3E, 0xA9, 0x88, 0x2F,
+    0x94, 0x88, 0x5E, 0x30, 0x03, 0x96, 0x88, 0x98, 0x88, 0xAA, 0x88, 0x20, 0x16, 0x1F, 0x3B, 0x1B,
+    0xA9, 0x88, 0x98, 0x98, 0xA5, 0x89, 0xC0, 0x99, 0x98, 0xA4, 0x78, 0x30, 0x14, 0x2F, 0x9D, 0x88,
+    0x2F, 0x23, 0x98, 0x88, 0xA3, 0x88, 0x13, 0x0C, 0x3B, 0xA3, 0x99, 0x2F, 0x3B, 0xC0, 0xA6, 0x88,
+    0xC0, 0x23, 0x2F, 0x3B, 0x7F, 0x3B, 0x0B, 0x1F, 0x9B, 0x99, 0x0B, 0x1F, 0xC0, 0x07, 0x3F, 0x0F,
+    0x9B, 0x88, 0x27, 0x9A, 0x78, 0x65, 0x10, 0x65, 0xC0, 0x27, 0x14, 0x2C, 0xA2, 0x88, 0x99, 0x89,
+    0x98, 0x88, 0x9D, 0x89, 0xB9, 0x59, 0xA6, 0x56, 0x9D, 0x77, 0x69, 0x6D, 0x65, 0x50, 0x64, 0xA2,
+    0x88, 0x55, 0x62, 0x67, 0xC0, 0xA2, 0x8A, 0x6B, 0x7E, 0x9D, 0x88, 0x97, 0x98, 0x6F, 0xA2, 0x87,
+    0xA3, 0x98, 0x9C, 0x98, 0x97, 0xB8, 0xA5, 0xB8, 0x56, 0x9A, 0x79, 0x9A, 0x8C, 0xAA, 0x8B, 0xAA,
+    0x8A, 0x94, 0x89, 0x50, 0xA5, 0x87, 0xA2, 0x98, 0x56, 0x13, 0xA2, 0x88, 0x6F, 0x7E, 0xA2, 0x88,
+    0xA2, 0x88, 0xA4, 0x97, 0x64, 0x91, 0x98, 0xA2, 0x98, 0x5A, 0x7E, 0x30, 0xA3, 0x98, 0xA2, 0x88,
+    0xA7, 0x89, 0x18, 0xA2, 0x88, 0x28, 0xA2, 0x88, 0x97, 0x99, 0x0A, 0x8B, 0x77, 0x19, 0x7F, 0x25,
+    0xC0, 0x9D, 0xA9, 0x05, 0x0F, 0x05, 0x66, 0x65, 0x55, 0x34, 0xA6, 0x88, 0x28, 0x00, 0xC0, 0x0F,
+    0xC0, 0x00, 0xA2, 0x88, 0x65, 0x14, 0x00, 0x05, 0x0F, 0x19, 0x28, 0x19, 0x28, 0x2D, 0xC1, 0x14,
+    0xC0, 0x00, 0x2D, 0x7F, 0x50, 0xA2, 0x98, 0x9D, 0x88, 0xC0, 0x7E, 0x9D, 0x89, 0x6E, 0x7B, 0x15,
+    0x10, 0x08, 0x6E, 0x10, 0x0D, 0x7F, 0x7F, 0x52, 0x0F, 0x2B, 0x56, 0xC0, 0xA6, 0x88, 0x7F, 0x9D,
+    0x88, 0x51, 0x1E, 0x23, 0x37, 0x23, 0xA4, 0x87, 0x00, 0x1C, 0x3C, 0xC0, 0x2B, 0x51, 0x04, 0x30,
+    0x21, 0x1C, 0x28, 0x17, 0x1C, 0x30, 0x0B, 0x7F, 0x0B, 0x6E, 0x1F, 0x37, 0xC1, 0x0F, 0x3C, 0x37,
+    0xA3, 0x98, 0x23, 0x14, 0x0B, 0x14, 0x28, 0xA6, 0x88, 0x33, 0x3C, 0xC0, 0x0B, 0x33, 0x1F, 0x24,
+    0xC0, 0x6F, 0x1F, 0x10, 0x1F, 0x5A, 0x33, 0x6E, 0x9C, 0x89, 0xA6, 0x88, 0x7A, 0xA2, 0x88, 0x3F,
+    0x38, 0x33, 0x27, 0xA5, 0x98, 0xC0, 0x27, 0xC0, 0x18, 0xAB, 0x99, 0x9C, 0x88, 0x6E, 0x92, 0x89,
+    0x9D, 0x98, 0xAE, 0x88, 0xA9, 0x89, 0x9C, 0x88, 0x1B, 0x98, 0x88, 0x55, 0x0B, 0x5A, 0x9A, 0x88,
+    0xA4, 0x88, 0x66, 0x92, 0x88, 0xA7, 0x98, 0xA9, 0x89, 0x65, 0x41, 0x03, 0xAC, 0x88, 0xA8, 0x88,
+    0xC0, 0x3B, 0x51, 0x7E, 0x52, 0x9D, 0x88, 0x99, 0x99, 0xA4, 0x87, 0x36, 0x22, 0xA4, 0x88, 0xA2,
+    0x88, 0x9D, 0x98, 0x22, 0x98, 0x88, 0xB0, 0x88, 0xA5, 0x88, 0x7F, 0x65, 0x94, 0x88, 0x56, 0x9D,
+    0x98, 0x0E, 0x99, 0x98, 0x03, 0xC0, 0x99, 0x99, 0xAE, 0x78, 0xA2, 0x88, 0x9A, 0x88, 0x12, 0xA4,
+    0x88, 0x95, 0x88, 0xA8, 0x98, 0xA4, 0x77, 0xA4, 0x88, 0x9C, 0x98, 0x37, 0x2F, 0xA5, 0x88, 0x0A,
+    0x2F, 0x0A, 0x7E, 0xA5, 0x88, 0x97, 0x98, 0x13, 0xA6, 0x89, 0xA4, 0x77, 0x9C, 0x88, 0x5A, 0xA9,
+    0x99, 0x9C, 0x88, 0x98, 0x98, 0x55, 0x1B, 0x2A, 0x1B, 0xA5, 0x98, 0x3F, 0x7E, 0x51, 0x9A, 0x88,
+    0x9D, 0x88, 0x96, 0x89, 0xA2, 0x88, 0x30, 0xA5, 0x99, 0x1B, 0x2F, 0xC0, 0x2B, 0x96, 0x88, 0x51,
+    0x3B, 0xA8, 0x88, 0x51, 0x3B, 0x6E, 0x7B, 0x56, 0x2F, 0x23, 0x27, 0x66, 0xC0, 0x0F, 0x1B, 0x07,
+    0x99, 0x98, 0xC0, 0x6F, 0x27, 0x3B, 0xA9, 0x89, 0x50, 0x8F, 0x99, 0x18, 0x97, 0x99, 0xA3, 0x88,
+    0x99, 0x99, 0xA2, 0x88, 0x1C, 0xC0, 0x03, 0x18, 0x00, 0x3F, 0x9C, 0x78, 0x1B, 0xA3, 0x88, 0xA2,
+    0x88, 0xAA, 0x59, 0xB1, 0x58, 0x9B, 0x67, 0x6D, 0x64, 0x69, 0x65, 0x50, 0xA2, 0x87, 0x65, 0x52,
+    0x35, 0x5A, 0xA2, 0x99, 0xA1, 0x8A, 0x7B, 0x9A, 0x77, 0x99, 0x98, 0xA3, 0x98, 0xA2, 0x77, 0xA2,
+    0x99, 0x9D, 0x98, 0x97, 0xC8, 0xA8, 0xA6, 0x9D, 0x89, 0x9A, 0x8A, 0x9D, 0x8A, 0x95, 0x9C, 0xAE,
+    0x79, 0xAC, 0x8B, 0x31, 0x9E, 0x86, 0xA3, 0x88, 0xA2, 0x98, 0x6F, 0x7A, 0xA2, 0x78, 0xA2, 0x87,
+    0x6B, 0x7E, 0xA3, 0x98, 0xA9, 0xA8, 0x90, 0x86, 0x9B, 0x98, 0x7F, 0x18, 0xC0, 0x61, 0x10, 0x6F,
+    0xA2, 0x88, 0xA3, 0x98, 0xAA, 0x88, 0x9A, 0x89, 0x99, 0x98, 0xC0, 0xA6, 0x77, 0x55, 0x51, 0x25,
+    0x9D, 0x98, 0x7F, 0x05, 0x14, 0xC0, 0x51, 0x9B, 0x99, 0x41, 0x10, 0x9C, 0x88, 0x11, 0xA2, 0x89,
+    0xA4, 0x88, 0xC1, 0x1C, 0xA2, 0x88, 0xA2, 0x78, 0x7E, 0x51, 0x01, 0x09, 0x04, 0x02, 0x51, 0x97,
+    0x89, 0x7F, 0x28, 0x55, 0xA7, 0x99, 0x55, 0xA4, 0x88, 0x9A, 0x88, 0x9E, 0x86, 0xA3, 0x97, 0xA3,
+    0x97, 0x7A, 0xA2, 0x77, 0xA4, 0x88, 0x65, 0xA2, 0x88, 0x66, 0x32, 0x66, 0x51, 0x6F, 0x9C, 0x88,
+    0x66, 0x5B, 0x51, 0x52, 0xC0, 0x52, 0x66, 0xC0, 0xA2, 0x89, 0xC0, 0x6F, 0x7E, 0x9C, 0x88, 0x52,
+    0xA3, 0x89, 0xC0, 0xA4, 0x87, 0xA2, 0x88, 0xC0, 0x9D, 0x88, 0x18, 0x05, 0x9A, 0x88, 0x38, 0x04,
+    0x09, 0x9A, 0x99, 0x30, 0x9D, 0x89, 0x17, 0x23, 0x14, 0xA4, 0x99, 0xA2, 0x77, 0x66, 0xA3, 0x98,
+    0x04, 0x18, 0x6B, 0x18, 0xA3, 0x89, 0x33, 0x00, 0x18, 0x30, 0x0B, 0x10, 0x9D, 0x99, 0x9A, 0x88,
+    0x10, 0xC0, 0x14, 0xA2, 0x98, 0x23, 0xC0, 0xA2, 0x78, 0x08, 0x10, 0xA2, 0x89, 0xA4, 0x88, 0x51,
+    0x55, 0x38, 0x2B, 0x38, 0xC0, 0x33, 0x07, 0xA2, 0x88, 0x1F, 0x1B, 0x33, 0x13, 0xAE, 0x88, 0x95,
+    0x88, 0x62, 0x13, 0xA3, 0x89, 0xA5, 0x98, 0xA7, 0x88, 0x90, 0x88, 0x9C, 0x89, 0xA4, 0x88, 0xA2,
+    0x88, 0x7E, 0x97, 0x89, 0x33, 0xA9, 0x88, 0x20, 0x6B, 0x9A, 0x87, 0x0B, 0xC0, 0x8E, 0x88, 0xA7,
+    0x88, 0xAA, 0x88, 0xA2, 0x89, 0xA5, 0x98, 0x5A, 0xA4, 0x98, 0x07, 0xA9, 0x88, 0x33, 0xA3, 0x89,
+    0x1E, 0x55, 0x2F, 0xA2, 0x89, 0xA6, 0x87, 0x52, 0x98, 0x88, 0x7E, 0xA6, 0x88, 0xA2, 0x88, 0x26,
+    0x0A, 0xC0, 0xA3, 0x99, 0xA3, 0x88, 0x9D, 0x88, 0x36, 0x98, 0x88, 0x51, 0x7E, 0x26, 0x9B, 0x88,
+    0x9D, 0x99, 0xA5, 0x89, 0xAA, 0x88, 0xAC, 0x88, 0x96, 0x88, 0x9C, 0x88, 0x97, 0x98, 0x9C, 0x87,
+    0xB0, 0x88, 0x20, 0x27, 0xA3, 0x98, 0x99, 0x99, 0xA3, 0x88, 0x3F, 0x9A, 0x89, 0x22, 0x1B, 0x3E,
+    0xAF, 0x98, 0x1F, 0x9B, 0x99, 0x33, 0x2F, 0xA9, 0x89, 0x20, 0x51, 0x1C, 0x9C, 0x88, 0x13, 0xA9,
+    0x98, 0x34, 0x1C, 0xA4, 0x88, 0x61, 0x94, 0x88, 0x9C, 0x88, 0xA2, 0x88, 0x2C, 0xA5, 0x99, 0x03,
+    0x1F, 0xA2, 0x88, 0xC0, 0x1B, 0x07, 0x08, 0x7E, 0xA2, 0x88, 0x10, 0xA5, 0x99, 0x41, 0x23, 0x2F,
+    0x9C, 0x98, 0x1F, 0x27, 0x9C, 0x88, 0x51, 0x13, 0x9D, 0x99, 0x27, 0x23, 0x66, 0x55, 0x97, 0x89,
+    0xC0, 0x61, 0x27, 0x2C, 0x2B, 0x9B, 0x88, 0xA2, 0x88, 0x34, 0xC0, 0xA6, 0x88, 0xA7, 0x88, 0x9D,
+    0x99, 0x2C, 0x99, 0x98, 0x9C, 0x89, 0xC0, 0x08, 0xA2, 0x88, 0xC0, 0x66, 0x40, 0xA9, 0x79, 0xB4,
+    0x59, 0x9B, 0x57, 0x54, 0x69, 0x69, 0x69, 0x9D, 0x97, 0xA2, 0x88, 0x65, 0x52, 0x66, 0x5A, 0xA1,
+    0x9A, 0xA2, 0x89, 0x7A, 0x97, 0x88, 0x51, 0xA2, 0x87, 0x6E, 0xA2, 0x99, 0x75, 0x99, 0xB7, 0xA5,
+    0xB7, 0x9D, 0x98, 0x9A, 0x7A, 0x9F, 0x8B, 0x97, 0x8B, 0x9A, 0x9A, 0xB0, 0x79, 0xAD, 0x8A, 0x93,
+    0x98, 0x9D, 0x89, 0x7E, 0xA3, 0x89, 0xA2, 0x88, 0x7A, 0xA2, 0x77, 0x7F, 0xC0, 0x7F, 0xA6, 0x96,
+    0xA7, 0x97, 0x94, 0x98, 0x55, 0x51, 0x99, 0x99, 0xA3, 0x88, 0xA3, 0x88, 0x0C, 0x1C, 0x24, 0x0C,
+    0x99, 0x89, 0x24, 0xA2, 0x89, 0xAC, 0x88, 0x55, 0x56, 0xC0, 0x1B, 0x20, 0xA2, 0x88, 0xC0, 0x69,
+    0x97, 0x89, 0x9B, 0x99, 0x3C, 0xA4, 0x78, 0xA2, 0x98, 0xA4, 0x78, 0xA2, 0x88, 0x7F, 0xC0, 0x6E,
+    0x7E, 0x05, 0x6E, 0x0D, 0x05, 0x69, 0x0D, 0xA3, 0x88, 0xA5, 0x98, 0x99, 0x88, 0x83, 0x99, 0xAD,
+    0x98, 0x0C, 0x3D, 0xB0, 0x88, 0xC0, 0xA2, 0x88, 0x8F, 0x77, 0xA3, 0x87, 0xA7, 0x94, 0x9F, 0xA6,
+    0x79, 0x56, 0x69, 0xA2, 0x98, 0x7E, 0xC0, 0x1F, 0x69, 0xC0, 0xA3, 0x89, 0x7B, 0x9C, 0x88, 0xC0,
+    0xA4, 0x78, 0xC0, 0x66, 0x41, 0x9D, 0x9A, 0x9D, 0x99, 0x9C, 0x8A, 0xC0, 0x6F, 0x9D, 0x99, 0xA0,
+    0x8A, 0xA2, 0x8A, 0x97, 0x8B, 0xC0, 0x55, 0xA4, 0x88, 0xA3, 0x88, 0x61, 0x24, 0x9C, 0x87, 0x9C,
+    0x88, 0xA2, 0x99, 0xA6, 0x77, 0xA2, 0x99, 0x99, 0x88, 0xC0, 0x2B, 0xA4, 0x88, 0xA5, 0x88, 0x91,
+    0x99, 0xA8, 0x89, 0x13, 0x99, 0x89, 0x37, 0x51, 0x0F, 0x14, 0xA5, 0x98, 0x37, 0x0F, 0x30, 0x37,
+    0x50, 0x14, 0xC0, 0x7A, 0x2B, 0xA2, 0x78, 0xA9, 0x98, 0x9A, 0x89, 0x51, 0x13, 0x23, 0x0F, 0x37,
+    0x2B, 0x37, 0x0B, 0x10, 0x24, 0x7A, 0x6F, 0x6E, 0x0C, 0x1F, 0x24, 0xA4, 0x99, 0x55, 0x33, 0x56,
+    0x7A, 0x41, 0xAB, 0x99, 0x2C, 0xA5, 0x99, 0xAA, 0x78, 0xA3, 0x99, 0x8F, 0x98, 0x51, 0xA4, 0x78,
+    0x96, 0x88, 0x7E, 0x7F, 0x56, 0xA3, 0x98, 0xA5, 0x89, 0xA2, 0x78, 0xA2, 0x98, 0x9D, 0x89, 0x94,
+    0x88, 0x69, 0x9A, 0x88, 0x66, 0xAD, 0x88, 0x2F, 0xA4, 0x78, 0x7F, 0x50, 0x92, 0x89, 0x0C, 0xAA,
+    0x88, 0x66, 0x9C, 0x89, 0x97, 0x88, 0xAA, 0x98, 0xA8, 0x88, 0x5A, 0x92, 0x88, 0x23, 0x2F, 0x2B,
+    0x9B, 0x99, 0xA5, 0x98, 0xA2, 0x78, 0xA4, 0x88, 0x7F, 0xA3, 0x88, 0x65, 0x23, 0x66, 0x9A, 0x88,
+    0x13, 0x61, 0x9D, 0x89, 0x55, 0x26, 0xA7, 0x89, 0xA6, 0x88, 0xA9, 0x98, 0x98, 0x88, 0x8C, 0x88,
+    0x69, 0xA7, 0x99, 0x13, 0x98, 0x87, 0xA3, 0x99, 0xA9, 0x98, 0xA5, 0x89, 0x08, 0x98, 0x99, 0x9B,
+    0x89, 0x22, 0x69, 0x66, 0x2F, 0x07, 0x9A, 0x88, 0x65, 0xAA, 0x88, 0x37, 0x1B, 0x03, 0x2F, 0xA4,
+    0x88, 0xA4, 0x88, 0x04, 0xC0, 0x61, 0x95, 0x99, 0x96, 0x78, 0x3B, 0xAD, 0x88, 0x33, 0x9C, 0x88,
+    0xA2, 0x78, 0x38, 0x33, 0x99, 0x88, 0x08, 0x03, 0x2B, 0x30, 0x61, 0xA5, 0x88, 0x04, 0x33, 0x03,
+    0x61, 0xA4, 0x88, 0x0B, 0x3B, 0x9B, 0x99, 0xA2, 0x77, 0xA4, 0x88, 0x9B, 0x99, 0xC0, 0xAF, 0x88,
+    0xA3, 0x99, 0x1F, 0x93, 0x98, 0x3B, 0x9D, 0x89, 0x0E, 0x9A, 0x78, 0x51, 0xA4, 0x98, 0xA3, 0x88,
+    0x7E, 0xA6, 0x88, 0xA2, 0x88, 0x0B, 0xC0, 0x2C, 0x9A, 0x98, 0xA2, 0x78, 0x9A, 0x98, 0xA3, 0x89,
+    0x6E, 0x9C, 0x88, 0x61, 0x51, 0xA6, 0x66, 0xBB, 0x78, 0x9C, 0x4A, 0x9C, 0x57, 0x7D, 0x6E, 0x74,
+    0x9D, 0x88, 0x7E, 0xC0, 0x55, 0x62, 0x5A, 0x7F, 0xA2, 0x8A, 0x65, 0x96, 0x88, 0x6E, 0x7E, 0x6F,
+    0xA1, 0xA8, 0xA2, 0x97, 0x9A, 0xB7, 0xA3, 0xB7, 0x9D, 0x88, 0x9A, 0x8A, 0x9F, 0x7B, 0x99, 0x9B,
+    0x97, 0x9B, 0xA3, 0x78, 0xB5, 0x89, 0xA3, 0x99, 0x96, 0x89, 0x9C, 0x89, 0xC0, 0xA2, 0x98, 0xA3,
+    0x88, 0x6F, 0x7E, 0xA2, 0x88, 0xC0, 0x65, 0x2F, 0xA8, 0x87, 0x91, 0x98, 0xA3, 0x89, 0x3D, 0x66,
+    0xA2, 0x88, 0x04, 0x38, 0xC0, 0x7F, 0x20, 0x2C, 0x7A, 0xA0, 0x6A, 0x55, 0x7A, 0x37, 0x6E, 0x65,
+    0x6E, 0x7F, 0x6E, 0xC0, 0xA3, 0x99, 0x6F, 0x69, 0x7F, 0x31, 0xC2, 0x2C, 0x31, 0xC3, 0x7E, 0x31,
+    0xA2, 0x87, 0xAA, 0x87, 0x90, 0x88, 0x8A, 0x98, 0xB5, 0x88, 0xA4, 0x99, 0x9C, 0x98, 0xA7, 0x89,
+    0xA3, 0x88, 0x04, 0x95, 0x57, 0xA2, 0x76, 0xA6, 0xA2, 0x9F, 0xB5, 0xC0, 0x7A, 0x66, 0x04, 0x7E,
+    0x6E, 0x04, 0xC0, 0x56, 0xA4, 0x87, 0x7A, 0x9D, 0x99, 0x11, 0xA4, 0x87, 0x55, 0x66, 0xA2, 0x78,
+    0x7E, 0x67, 0x6B, 0xA2, 0x69, 0x66, 0x98, 0x8A, 0xA7, 0x8B, 0x9A, 0x8C, 0xA0, 0x8B, 0xAB, 0x99,
+    0x9D, 0x88, 0x9C, 0x88, 0x9B, 0x98, 0x9A, 0x88, 0x56, 0x61, 0x9D, 0x88, 0xA2, 0x88, 0x9D, 0x99,
+    0x9B, 0x98, 0xA4, 0x87, 0x56, 0xA3, 0x98, 0xA2, 0x89, 0x9D, 0x99, 0x7E, 0xA3, 0x89, 0x2C, 0x13,
+    0x9D, 0x88, 0x9C, 0x88, 0xA4, 0x89, 0xA2, 0x87, 0x37, 0x65, 0x9D, 0x89, 0xA5, 0x98, 0x5A, 0x13,
+    0xA2, 0x88, 0x13, 0xA2, 0x78, 0x10, 0x37, 0x08, 0x13, 0xA6, 0x88, 0xA6, 0x78, 0x9C, 0x98, 0x37,
+    0xC0, 0x3F, 0x9D, 0x89, 0x6E, 0xA3, 0x99, 0xC0, 0xAA, 0x88, 0x10, 0x0B, 0x7F, 0xA3, 0x88, 0x7F,
+    0x0B, 0x10, 0xA5, 0x99, 0x1A, 0x41, 0x9D, 0x99, 0xA7, 0x88, 0xAC, 0x88, 0x51, 0xA3, 0x88, 0xA5,
+    0x99, 0x0F, 0xA3, 0x89, 0x95, 0x98, 0xA4, 0x78, 0x99, 0x99, 0xA2, 0x88, 0xA8, 0x88, 0x51, 0x2B,
+    0xAB, 0x89, 0xA7, 0x89, 0x1B, 0x98, 0x88, 0xA2, 0x88, 0x98, 0x88, 0xC0, 0xAD, 0x89, 0x1B, 0x99,
+    0x89, 0x9C, 0x87, 0x0B, 0xA9, 0x89, 0x13, 0x51, 0xA9, 0x98, 0x66, 0x17, 0xA4, 0x88, 0xA2, 0x88,
+    0xC0, 0x3F, 0x65, 0xC0, 0x2F, 0x1F, 0x2E, 0xAE, 0x88, 0xC0, 0x95, 0x89, 0xA9, 0x98, 0xA4, 0x88,
+    0x9B, 0x89, 0x26, 0x50, 0x1B, 0xA3, 0x99, 0x9A, 0x78, 0x9C, 0x88, 0x51, 0xA2, 0x89, 0x7E, 0xA4,
+    0x88, 0x23, 0x88, 0x98, 0xA6, 0x88, 0x1F, 0x9D, 0x99, 0x6E, 0xA9, 0x98, 0x7F, 0x9D, 0x88, 0x51,
+    0x0F, 0x23, 0xA3, 0x89, 0xA3, 0x99, 0x50, 0x33, 0x9D, 0x89, 0x2F, 0x0F, 0x23, 0x0F, 0x23, 0x96,
+    0x88, 0xA2, 0x88, 0x0B, 0x97, 0x99, 0x55, 0x99, 0x99, 0xA4, 0x88, 0xA4, 0x87, 0x13, 0x27, 0x23,
+    0x9D, 0x88, 0xA5, 0x99, 0x0F, 0x23, 0xA4, 0x78, 0x37, 0xC0, 0x03, 0x33, 0xA3, 0x89, 0x0B, 0x0F,
+    0x37, 0x9D, 0x98, 0x27, 0x61, 0x17, 0xA5, 0x88, 0x51, 0x7F, 0x9A, 0x88, 0x66, 0xAA, 0x77, 0x30,
+    0x9A, 0x88, 0x9C, 0x88, 0xC1, 0x3B, 0xC0, 0x9D, 0x98, 0x27, 0x2B, 0x6E, 0x61, 0x51, 0xA2, 0x78,
+    0x0B, 0x10, 0xC0, 0x9B, 0x99, 0x0B, 0xAA, 0x78, 0x38, 0x10, 0x38, 0x0C, 0x0B, 0x9A, 0x88, 0xA4,
+    0x75, 0xBF, 0x75, 0xA0, 0x5A, 0x98, 0x4B, 0x5A, 0x7D, 0x6D, 0x9D, 0x97, 0x79, 0x6B, 0x55, 0x66,
+    0x56, 0x7B, 0xA4, 0x78, 0x9B, 0xAA, 0x98, 0x77, 0xA2, 0x88, 0x7E, 0xA2, 0x78, 0xA1, 0xA9, 0xA2,
+    0x97, 0x9A, 0xC6, 0xA4, 0xA6, 0x9D, 0x89, 0x9A, 0x79, 0xA0, 0x8B, 0x99, 0x8B, 0x96, 0x8A, 0x66,
+    0xB0, 0x77, 0xA4, 0x78, 0xA7, 0x99, 0x97, 0x9B, 0x9A, 0x89, 0x7A, 0x6E, 0xA3, 0x88, 0xA3, 0x99,
+    0x6F, 0x7A, 0x7D, 0x51, 0x37, 0xA2, 0x87, 0x0C, 0x9D, 0x89, 0xA6, 0x87, 0x7F, 0x9B, 0x99, 0x51,
+    0x55, 0xA2, 0x98, 0xA4, 0x78, 0x9D, 0x98, 0x07, 0xA3, 0x6B, 0x69, 0xC0, 0x2F, 0x6E, 0x7E, 0x6E,
+    0x7A, 0x6F, 0x7E, 0xC0, 0x6E, 0xC0, 0x7F, 0xC3, 0x31, 0xC5, 0x7E, 0x5A, 0xA9, 0x97, 0x8F, 0x99,
+    0x8D, 0x98, 0xB1, 0x98, 0xAB, 0x99, 0x9C, 0x88, 0xA3, 0x99, 0xA5, 0x89, 0x9B, 0x88, 0x95, 0x57,
+    0xA2, 0x77, 0xA6, 0xA2, 0xA0, 0xB4, 0x7A, 0x66, 0x66, 0x3F, 0x7E, 0xC0, 0x3F, 0xC0, 0x04, 0xA2,
+    0x78, 0x75, 0xC0, 0xA4, 0x76, 0x66, 0xC4, 0xA0, 0x8A, 0x4B, 0x9D, 0x8A, 0x9C, 0x8A, 0xAA, 0x8B,
+    0x91, 0x8C, 0xB6, 0x8A, 0xA4, 0x88, 0xC0, 0x55, 0x7A, 0x3B, 0x66, 0x65, 0x51, 0x51, 0x9B, 0x99,
+    0x99, 0x88, 0x79, 0x98, 0x88, 0x99, 0x98, 0xA4, 0x88, 0x77, 0x40, 0x62, 0xC0, 0xA3, 0x89, 0xC0,
+    0x41, 0x51, 0xA8, 0x88, 0x9D, 0x99, 0x28, 0x9D, 0x98, 0xA7, 0x89, 0xA2, 0x98, 0x55, 0xC0, 0xA2,
+    0x88, 0x27, 0x13, 0xC1, 0x9B, 0x89, 0x7E, 0xA2, 0x88, 0x38, 0xC0, 0x00, 0x7F, 0x27, 0x98, 0x88,
+    0x2B, 0x3F, 0x13, 0x24, 0xA3, 0x99, 0x9A, 0x88, 0xC0, 0x38, 0x66, 0x0B, 0x07, 0xC0, 0x0B, 0xA3,
+    0x89, 0xC0, 0xA2, 0x88, 0xA3, 0x99, 0xA2, 0x88, 0x6E, 0x96, 0x88, 0xA3, 0x99, 0xAA, 0x77, 0x51,
+    0x9D, 0x99, 0x17, 0xA3, 0x89, 0xA9, 0x88, 0xA2, 0x88, 0x9A, 0x88, 0xA2, 0x88, 0xAC, 0x99, 0x51,
+    0x90, 0x77, 0x99, 0x99, 0xC0, 0xAB, 0x89, 0xA3, 0x98, 0x9B, 0x89, 0x61, 0x0C, 0xA3, 0x99, 0x9A,
+    0x88, 0x2F, 0x7B, 0x50, 0x6B, 0x33, 0x36, 0xA4, 0x78, 0x33, 0x51, 0x37, 0xA9, 0x98, 0x6B, 0x06,
+    0xAD, 0x89, 0xA2, 0x88, 0x95, 0x98, 0x26, 0xA9, 0x98, 0x96, 0x88, 0x22, 0x1F, 0x66, 0x1F, 0x37,
+    0xA2, 0x89, 0x55, 0x9C, 0x88, 0xA7, 0x88, 0x17, 0x0C, 0x95, 0x99, 0x1F, 0x9B, 0x99, 0xA4, 0x87,
+    0x36, 0xA4, 0x87, 0x22, 0x3F, 0xAD, 0x99, 0xA4, 0x88, 0x9B, 0x88, 0xC0, 0x66, 0x27, 0x13, 0xA5,
+    0x99, 0xA4, 0x77, 0x66, 0x9C, 0x88, 0x9C, 0x99, 0x55, 0x51, 0x0E, 0x3F, 0x9C, 0x88, 0xAA, 0x98,
+    0x9D, 0x88, 0xA6, 0x89, 0xB0, 0x88, 0x97, 0x88, 0x3B, 0x06, 0xA2, 0x87, 0x41, 0x98, 0x87, 0xA7,
+    0x99, 0x28, 0x97, 0x99, 0xC0, 0x9C, 0x88, 0x3F, 0x3B, 0x36, 0x9D, 0x87, 0x1B, 0xA2, 0x88, 0x9D,
+    0x98, 0x55, 0xAA, 0x89, 0x1B, 0x51, 0xA6, 0x87, 0x97, 0x99, 0xA2, 0x88, 0x5A, 0x9A, 0x98, 0x41,
+    0x3F, 0x10, 0x9B, 0x99, 0x10, 0x7F, 0x07, 0x51, 0x17, 0x1F, 0x07, 0x38, 0x1F, 0xC0, 0x97, 0x99,
+    0xA2, 0x88, 0xA3, 0x88, 0x0B, 0xA3, 0x88, 0x1F, 0x24, 0x38, 0x07, 0x1F, 0x37, 0xA5, 0x75, 0xB9,
+    0x84, 0xA4, 0x68, 0x98, 0x4D, 0x9D, 0x6A, 0x6D, 0x7D, 0x9D, 0xA8, 0x54, 0xA2, 0x88, 0x3F, 0x66,
+    0x56, 0xC0, 0x21, 0x99, 0x9A, 0x9B, 0x87, 0xA2, 0x88, 0x7F, 0x11, 0xA1, 0xA9, 0xA3, 0xA7, 0x9A,
+    0xB5, 0xA4, 0xA6, 0x52, 0x99, 0x8A, 0xA2, 0x7A, 0x9A, 0x7A, 0x94, 0x9B, 0x9C, 0x9A, 0xB0, 0x66,
+    0xA4, 0x77, 0xA4, 0x89, 0xA8, 0x88, 0x97, 0x9A, 0x96, 0x9A, 0x6B, 0x7E, 0xA2, 0x88, 0xA2, 0x88,
+    0x7E, 0xA2, 0x88, 0x7E, 0x1C, 0xAD, 0xA7, 0x95, 0x89, 0x9A, 0x88, 0x38, 0xA5, 0x98, 0x9D, 0x99,
+    0x9D, 0x88, 0xC2, 0x51, 0xA4, 0x88, 0xA2, 0x5B, 0xC2, 0x7E, 0x34, 0x7E, 0x7E, 0x6F, 0xC0, 0x7E,
+    0x6E, 0xC0, 0x6B, 0xC0, 0x7E, 0xC1, 0x6E, 0xC5, 0x7E, 0x5A, 0x02, 0x92, 0x88, 0x8B, 0x98, 0xA9,
+    0x98, 0xAF, 0x99, 0xA3, 0x98, 0xA2, 0x88, 0xA5, 0x8A, 0x97, 0x78, 0x97, 0x58, 0x7D, 0xA5, 0xA3,
+    0xA3, 0xB4, 0x75, 0x66, 0xC0, 0x04, 0x7E, 0x66, 0x3F, 0xC0, 0x04, 0x56, 0x04, 0xA3, 0x97, 0xA2,
+    0x77, 0x66, 0x19, 0x5A, 0x66, 0xC0, 0xA3, 0x78, 0xA0, 0x8A, 0x13, 0x9D, 0x8A, 0xA5, 0x8A, 0x9D,
+    0x9B, 0x9E, 0x8C, 0xB6, 0x78, 0x51, 0x66, 0xC0, 0x51, 0x65, 0x22, 0x55, 0x7E, 0x16, 0x22, 0x50,
+    0xC0, 0x6D, 0x9C, 0x98, 0x9B, 0xA9, 0xC0, 0x9D, 0x98, 0x9A, 0x89, 0x9A, 0x88, 0x51, 0x9C, 0x89,
+    0xC1, 0x6F, 0x7E, 0x7F, 0x51, 0x9D, 0x88, 0x1F, 0xA3, 0x98, 0x13, 0x3B, 0x13, 0x30, 0x66, 0x66,
+    0x2B, 0x9C, 0x88, 0x6E, 0x1C, 0x6B, 0xA7, 0x98, 0xA3, 0x89, 0x38, 0x1F, 0x13, 0x6E, 0x3C, 0x3F,
+    0xAA, 0x88, 0x3B, 0x27, 0x6B, 0x0B, 0x2E, 0xA4, 0x77, 0x2E, 0x07, 0x9D, 0x89, 0xA5, 0x99, 0x2B,
+    0x51, 0xA9, 0x88, 0x61, 0x1F, 0x41, 0xA7, 0x99, 0xA2, 0x88, 0x2B, 0x2C, 0x51, 0x2C, 0x9C, 0x89,
+    0xC0, 0xA3, 0x88, 0xAC, 0x99, 0x9A, 0x77, 0x0B, 0x51, 0x9D, 0x89, 0xA8, 0x88, 0x7A, 0x6E, 0x0B,
+    0x56, 0xA6, 0x98, 0x97, 0x88, 0xA3, 0x99, 0x02, 0x98, 0x88, 0x66, 0xA4, 0x87, 0xA6, 0x88, 0xA3,
+    0x88, 0x37, 0xA4, 0x88, 0xA3, 0x98, 0xA9, 0x89, 0x51, 0x02, 0x2E, 0x99, 0x89, 0x06, 0xAB, 0x88,
+    0x26, 0x9A, 0x88, 0x0B, 0x65, 0x02, 0x0B, 0xA6, 0x88, 0xA2, 0x88, 0x9A, 0x89, 0x97, 0x88, 0xC0,
+    0x7E, 0xA5, 0x89, 0x9A, 0x98, 0xA3, 0x88, 0x3F, 0x0B, 0xA6, 0x98, 0xA9, 0x98, 0x9C, 0x78, 0x13,
+    0xA3, 0x99, 0x27, 0xC0, 0x66, 0x13, 0x3F, 0xA8, 0x88, 0x37, 0x2C, 0x99, 0x99, 0x22, 0xA3, 0x98,
+    0xA3, 0x89, 0x0A, 0xA3, 0x98, 0x98, 0x88, 0x51, 0x3B, 0xA5, 0x99, 0xA4, 0x88, 0x50, 0xA3, 0x89,
+    0x37, 0x1E, 0x50, 0x3B, 0x03, 0x9D, 0x88, 0xA7, 0x89, 0x7E, 0x16, 0x22, 0x27, 0xA8, 0x98, 0x99,
+    0x88, 0x95, 0x99, 0xA7, 0x88, 0x3A, 0x9D, 0x88, 0x95, 0x98, 0xC0, 0x55, 0x27, 0xA6, 0x88, 0xC0,
+    0x9B, 0x88, 0x18, 0x2C, 0xA4, 0x88, 0xC0, 0x99, 0x89, 0x7F, 0x07, 0x9D, 0x88, 0xC0, 0x1F, 0xC0,
+    0x13, 0x60, 0x56, 0xC0, 0x07, 0xC0, 0x33, 0xA3, 0x98, 0xC0, 0x10, 0x9D, 0x99, 0x07, 0x9B, 0x99,
+    0x1F, 0x33, 0x24, 0xA2, 0x86, 0xB2, 0x72, 0xAB, 0x87, 0x99, 0x5E, 0x9B, 0x4B, 0x5A, 0x7D, 0x9E,
+    0x96, 0x50, 0xA2, 0x88, 0x3F, 0x66, 0x66, 0x5A, 0xA3, 0x99, 0x98, 0x89, 0x51, 0xA2, 0x77, 0x7A,
+    0x6F, 0xA1, 0xA9, 0xA3, 0xA7, 0x9C, 0xB4, 0xA2, 0xA6, 0x6B, 0x98, 0x8A, 0xA2, 0x6A, 0x9C, 0x8A,
+    0x94, 0x8B, 0x99, 0xAB, 0xAA, 0x66, 0xAD, 0x77, 0x66, 0x6F, 0x9B, 0x99, 0xA7, 0xAA, 0x95, 0x9A,
+    0x52, 0x7F, 0x6E, 0xA2, 0x98, 0xA2, 0x87, 0xA4, 0x88, 0x6F, 0x7D, 0xB1, 0xA8, 0x92, 0x87, 0x93,
+    0x99, 0x0F, 0x27, 0x18, 0x0F, 0x9A, 0x88, 0xC0, 0x5A, 0x24, 0xA5, 0x6B, 0xC2, 0x7E, 0x34, 0x7E,
+    0x6E, 0x7F, 0xC0, 0x6E, 0x7A, 0xC1, 0x6E, 0x7F, 0xC1, 0x6E, 0xC7, 0xA3, 0x98, 0x54, 0x86, 0x98,
+    0xA2, 0x88, 0xB0, 0x98, 0xA9, 0x98, 0xC0, 0xA4, 0x89, 0x93, 0x59, 0x9F, 0x57, 0x64, 0xA2, 0xB5,
+    0xA6, 0xB2, 0x60, 0x66, 0xC1, 0xA2, 0x87, 0x04, 0x62, 0x3F, 0x56, 0x5A, 0xA4, 0x96, 0xA3, 0x87,
+    0x66, 0xC0, 0x56, 0x11, 0x0C, 0x16, 0xA3, 0x7A, 0x9A, 0x6A, 0x9E, 0x9B, 0xC0, 0xA6, 0x89, 0x93,
+    0x9D, 0xB3, 0x8A, 0xA7, 0x99, 0x56, 0x69, 0x66, 0x55, 0x66, 0xC0, 0x56, 0xC1, 0x65, 0x51, 0x6D,
+    0x7E, 0x7E, 0x7E, 0xC1, 0x7E, 0x9D, 0x99, 0x55, 0x52, 0x9B, 0x99, 0x9B, 0x99, 0x6E, 0x99, 0x89,
+    0x25, 0x9D, 0x99, 0x9C, 0x88, 0x9C, 0x89, 0x55, 0x03, 0xA4, 0x88, 0xA3, 0x98, 0x51, 0xC0, 0x41,
+    0x66, 0x7E, 0x24, 0x03, 0x9D, 0x88, 0xA4, 0x88, 0x2B, 0x08, 0xAB, 0x99, 0x27, 0x2B, 0xA5, 0x88,
+    0x27, 0x9B, 0x89, 0xA4, 0x88, 0x18, 0xA4, 0x89, 0x13, 0x37, 0xA6, 0x88, 0x66, 0x07, 0x33, 0x6F,
+    0x9D, 0x88, 0xA7, 0x99, 0xA4, 0x88, 0x3F, 0xA2, 0x88, 0x3F, 0x56, 0x3F, 0x27, 0xA3, 0x89, 0x9C,
+    0x88, 0xA9, 0x98, 0x1F, 0x96, 0x88, 0xA2, 0x88, 0xA5, 0x88, 0xA4, 0x88, 0x7F, 0xC0, 0x98, 0x88,
+    0x7F, 0x3C, 0xAF, 0x99, 0xA5, 0x88, 0x98, 0x89, 0x51, 0xA2, 0x98, 0x9C, 0x88, 0x3E, 0x16, 0x51,
+    0x16, 0x02, 0x3F, 0xAA, 0x88, 0xA6, 0x88, 0x23, 0xA4, 0x88, 0xA3, 0x89, 0x7F, 0x27, 0x99, 0x99,
+    0x07, 0x9D, 0x99, 0x9C, 0x88, 0x2E, 0xA9, 0x98, 0x33, 0x98, 0x88, 0xA2, 0x88, 0x33, 0x56, 0x33,
+    0x9B, 0x89, 0x96, 0x88, 0x9D, 0x88, 0xAD, 0x98, 0x13, 0x52, 0x07, 0x2E, 0x7E, 0x9B, 0x98, 0x22,
+    0x6E, 0x36, 0x59, 0x0B, 0x9D, 0x99, 0x5A, 0x51, 0x65, 0x36, 0xA5, 0x88, 0x33, 0x36, 0x32, 0x66,
+    0x96, 0x88, 0xA2, 0x88, 0xAE, 0x77, 0x7A, 0x96, 0x88, 0x51, 0xAB, 0x88, 0x52, 0x13, 0x9A, 0x88,
+    0x99, 0x89, 0xA3, 0x98, 0xA5, 0x88, 0x95, 0x99, 0xA3, 0x88, 0xAB, 0x89, 0x99, 0x99, 0x9D, 0x99,
+    0xA4, 0x87, 0x02, 0x9C, 0x88, 0xA5, 0x88, 0x7E, 0x07, 0x03, 0x9D, 0x88, 0x9C, 0x98, 0x14, 0xA3,
+    0x99, 0x40, 0x0F, 0xA5, 0x88, 0x51, 0xA4, 0x88, 0x37, 0xA5, 0x88, 0x03, 0x20, 0x7A, 0x07, 0x0F,
+    0x2F, 0x3E, 0x97, 0x88, 0x6E, 0x7A, 0x51, 0x23, 0xA9, 0x89, 0x03, 0x07, 0x23, 0xA6, 0x89, 0x6E,
+    0x98, 0x88, 0x33, 0x13, 0x1A, 0x1F, 0x9D, 0x88, 0x64, 0xB1, 0x83, 0xB3, 0xA4, 0x99, 0x6C, 0x9D,
+    0x3D, 0x9E, 0x4A, 0x7D, 0x64, 0x9D, 0x97, 0xA2, 0x88, 0x3F, 0x35, 0xC0, 0x5A, 0xA2, 0x89, 0x98,
+    0x99, 0x5A, 0xA2, 0x87, 0x65, 0x11, 0xA1, 0xA9, 0xA4, 0xA6, 0x9C, 0xB5, 0xA1, 0xB6, 0xA2, 0x79,
+    0x98, 0x79, 0xA1, 0x8A, 0x53, 0x94, 0x8D, 0x00, 0xA5, 0x78, 0xB4, 0x65, 0x9D, 0x88, 0xA4, 0x89,
+    0x89, 0xBA, 0xAD, 0x98, 0xB1, 0x88, 0x92, 0x9A, 0x98, 0x89, 0xA1, 0x9A, 0x7E, 0xA3, 0x88, 0xA2,
+    0x88, 0xA4, 0x89, 0x50, 0xA6, 0x97, 0xB4, 0x87, 0x0C, 0x95, 0x98, 0x24, 0xA2, 0x98, 0x51, 0xA3,
+    0x89, 0x14, 0xC0, 0x0C, 0xA1, 0x6B, 0xC2, 0x7E, 0x6F, 0x7E, 0x6E, 0x7A, 0x6F, 0xC0, 0x15, 0xC0,
+    0x7A, 0xC0, 0xA2, 0x88, 0xC2, 0x31, 0xC6, 0x2C, 0x9B, 0x87, 0x91, 0x97, 0x9C, 0x98, 0xAD, 0x99,
+    0xAA, 0x87, 0xA4, 0x88, 0xA4, 0x88, 0x90, 0x49, 0xA4, 0x57, 0x61, 0xA0, 0xA5, 0xA8, 0xB1, 0x70,
+    0x66, 0xC1, 0xA2, 0x87, 0x04, 0x52, 0xC1, 0xA2, 0x77, 0xA5, 0x97, 0x65, 0x56, 0xC0, 0x0C, 0x5A,
+    0x16, 0xA2, 0x8A, 0x9D, 0x7B, 0x95, 0x7C, 0xA8, 0x86, 0xA4, 0x88, 0x63, 0x99, 0x8D, 0xB6, 0x8A,
+    0xC1, 0x69, 0x56, 0x66, 0x65, 0xC0, 0x56, 0xC1, 0x65, 0x55, 0x69, 0x7E, 0x69, 0x7E, 0x66, 0x6D,
+    0xC0, 0x7B, 0x6E, 0xC1, 0x7A, 0x6F, 0x3D, 0xC0, 0x9D, 0x99, 0x52, 0x98, 0x89, 0x21, 0x98, 0x89,
+    0x99, 0x99, 0xA2, 0x88, 0x65, 0xA2, 0x88, 0xA9, 0x89, 0x7E, 0x3B, 0x65, 0x55, 0x9D, 0x89, 0x62,
+    0x2B, 0x6E, 0x7F, 0x30, 0x52, 0x3F, 0xC0, 0x2B, 0xA5, 0x89, 0x2B, 0xA4, 0x88, 0xA8, 0x88, 0x3B,
+    0x9A, 0x78, 0x66, 0x1F, 0x07, 0x1F, 0xA2, 0x88, 0xA5, 0x89, 0xA3, 0x88, 0x07, 0xA4, 0x89, 0x9B,
+    0x88, 0x51, 0x6E, 0xA3, 0x99, 0x2B, 0x51, 0xA5, 0x99, 0x5A, 0x6E, 0x0B, 0xA6, 0x88, 0x9D, 0x99,
+    0xA6, 0x77, 0x6B, 0x96, 0x98, 0x07, 0x10, 0x07, 0xA8, 0x88, 0x07, 0x66, 0xA8, 0x88, 0x9B, 0x88,
+    0x7F, 0xA2, 0x88, 0x65, 0x3E, 0x97, 0x88, 0x7E, 0xA6, 0x88, 0xA3, 0x99, 0x55, 0xA9, 0x89, 0x51,
+    0x93, 0x98, 0xA2, 0x88, 0xA8, 0x89, 0x97, 0x98, 0x0B, 0xA7, 0x99, 0x07, 0x1B, 0x3E, 0x02, 0x27,
+    0xA2, 0x78, 0x9C, 0x89, 0x10, 0x97, 0x99, 0x9A, 0x88, 0xA2, 0x88, 0xAA, 0x88, 0xA3, 0x99, 0x37,
+    0x7E, 0x1A, 0x1D, 0x0E, 0xC0, 0xA5, 0x98, 0x9B, 0x88, 0xA2, 0x88, 0xAB, 0x89, 0x0A, 0x55, 0x23,
+    0x0F, 0x06, 0xA7, 0x88, 0x9B, 0x99, 0xA2, 0x88, 0x0A, 0x27, 0x32, 0xC0, 0x06, 0x32, 0x9D, 0x98,
+    0x27, 0x3B, 0x9C, 0x88, 0x3F, 0x9B, 0x98, 0x33, 0xA5, 0x98, 0xA3, 0x89, 0x9B, 0x88, 0x9A, 0x88,
+    0xA4, 0x88, 0xA5, 0x99, 0x66, 0x51, 0x55, 0x1B, 0x03, 0x7E, 0xC0, 0x96, 0x88, 0x51, 0xA6, 0x88,
+    0xA4, 0x87, 0xA2, 0x88, 0x0B, 0x9D, 0x88, 0x65, 0xC1, 0x9C, 0x88, 0xA2, 0x88, 0x27, 0x6E, 0xC0,
+    0x13, 0xA5, 0x88, 0x28, 0x03, 0x33, 0x55, 0xA2, 0x99, 0x33, 0x27, 0x14, 0x27, 0x18, 0x27, 0x2F,
+    0x9B, 0x98, 0x27, 0x07, 0x2C, 0x52, 0x13, 0xC0, 0x9A, 0x77, 0xAE, 0x84, 0xBA, 0x91, 0x99, 0x68,
+    0x9D, 0x6D, 0x9F, 0x4E, 0x9F, 0x69, 0x9F, 0xA6, 0x9D, 0x97, 0xA2, 0x88, 0x3F, 0x62, 0x5A, 0x7B,
+    0x55, 0x9B, 0x8A, 0x6E, 0x69, 0x05, 0x6F, 0xA2, 0x98, 0xA4, 0xA6, 0x9D, 0xC5, 0xA0, 0xA6, 0xA2,
+    0x89, 0x98, 0x79, 0xA1, 0x8A, 0xA0, 0x7A, 0x94, 0x8D, 0x95, 0x9B, 0xC0, 0xB5, 0x65, 0x55, 0xA5,
+    0x8A, 0x8E, 0xA9, 0x9D, 0xB7, 0xFF, 0x9C, 0xEF, 0xA2, 0x78, 0x8F, 0x9B, 0x95, 0x9A, 0x66, 0x7F,
+    0xA2, 0x88, 0xA4, 0x89, 0xA3, 0x88, 0x51, 0xAA, 0x97, 0xAE, 0x97, 0x82, 0x88, 0x55, 0x00, 0x56,
+    0x24, 0x00, 0x9D, 0x99, 0x3C, 0xA9, 0x6B, 0xC1, 0x7E, 0xC0, 0x6E, 0x7B, 0x6E, 0x6E, 0x7F, 0xC3,
+    0x7E, 0x6F, 0x7A, 0x6E, 0x6B, 0xC0, 0x6D, 0xC0, 0x6B, 0xC0, 0x31, 0xC0, 0x7E, 0x31, 0x8B, 0x98,
+    0x9A, 0x87, 0x56, 0xA6, 0x97, 0xA8, 0x97, 0xAF, 0x97, 0xA3, 0x79, 0x92, 0x4A, 0xA5, 0x68, 0x60,
+    0x9C, 0xB6, 0xAA, 0xA1, 0x9F, 0xB7, 0x56, 0xC0, 0x04, 0xC0, 0x66, 0xC0, 0x56, 0xC0, 0xA6, 0x86,
+    0xA2, 0x86, 0x9D, 0x9A, 0x5A, 0x62, 0x04, 0xA2, 0x77, 0xA4, 0x79, 0x9D, 0x8C, 0x97, 0x7D, 0x9D,
+    0x88, 0xAA, 0x95, 0xA5, 0xA9, 0x94, 0x8C, 0xAC, 0x7B, 0xAC, 0x89, 0x51, 0xC1, 0x66, 0x22, 0x66,
+    0x69, 0x56, 0x65, 0xC0, 0x55, 0x55, 0x7A, 0x6E, 0x7D, 0xC0, 0x7A, 0x6D, 0xC2, 0x7A, 0x6B, 0x55,
+    0x31, 0x66, 0x31, 0x6E, 0x6B, 0x57, 0x67, 0x27, 0x9B, 0x89, 0x9A, 0x99, 0x97, 0xA9, 0x9D, 0x99,
+    0xC0, 0x65, 0x50, 0xA7, 0x88, 0xA4, 0x88, 0x9D, 0x99, 0x41, 0xC0, 0x9D, 0x99, 0x51, 0x6E, 0x9D,
+    0x99, 0x51, 0x13, 0xC0, 0x6E, 0x6B, 0x13, 0x2C, 0x1F, 0x13, 0x56, 0x2B, 0x1F, 0xA2, 0x88, 0x1F,
+    0xC0, 0x6F, 0x51, 0xA6, 0x88, 0x51, 0x9A, 0x88, 0x17, 0x13, 0x99, 0x99, 0x17, 0x9C, 0x88, 0x17,
+    0xA7, 0x89, 0x55, 0xA5, 0x99, 0x97, 0x99, 0x59, 0xA2, 0x99, 0xA3, 0x98, 0xAA, 0x78, 0xA4, 0x98,
+    0x93, 0x88, 0x96, 0x88, 0x2B, 0x56, 0x10, 0xB0, 0x98, 0x56, 0x1F, 0x51, 0x13, 0x23, 0xA9, 0x88,
+    0x1F, 0x98, 0x88, 0xA8, 0x87, 0xA6, 0x88, 0x98, 0x99, 0x98, 0x77, 0x23, 0x3F, 0xAE, 0x88, 0xC0,
+    0x51, 0x6F, 0x9A, 0x98, 0x37, 0x9D, 0x89, 0x9C, 0x88, 0x99, 0x98, 0x17, 0xC0, 0x9A, 0x88, 0x9C,
+    0x88, 0xA5, 0x88, 0xA6, 0x88, 0x3F, 0x2B, 0x1C, 0x0A, 0xA6, 0x88, 0x65, 0x9C, 0x89, 0x9A, 0x88,
+    0x69, 0x37, 0xA2, 0x98, 0x9C, 0x78, 0x9B, 0x98, 0x9B, 0x99, 0x16, 0xAE, 0x88, 0x3A, 0x22, 0x2F,
+    0xA2, 0x88, 0xAB, 0x99, 0x96, 0x77, 0x9C, 0x88, 0x2F, 0x08, 0x9A, 0x98, 0x9C, 0x89, 0x20, 0x08,
+    0x2F, 0x51, 0x16, 0x55, 0x3B, 0xA6, 0x88, 0x51, 0x9D, 0x99, 0x59, 0x3B, 0x00, 0x04, 0x0F, 0x7E,
+    0x9B, 0x88, 0x7F, 0x56, 0x2F, 0xA7, 0x88, 0x66, 0x9C, 0x88, 0x17, 0x9D, 0x88, 0x55, 0x51, 0x9D,
+    0x99, 0xA2, 0x88, 0x20, 0x00, 0x2C, 0xA4, 0x88, 0xA2, 0x88, 0x9D, 0x98, 0x14, 0x0F, 0x14, 0x3B,
+    0xC0, 0x9C, 0x88, 0x04, 0x20, 0x2C, 0x00, 0x27, 0x20, 0x9A, 0x88, 0x9C, 0x89, 0xA3, 0x88, 0x13,
+    0x6E, 0x62, 0x55, 0x40, 0xA5, 0x95, 0xFF, 0xD5, 0xEB, 0x9D, 0x76, 0x98, 0x6B, 0xA3, 0x6D, 0xA0,
+    0x3B, 0x60, 0x9D, 0x87, 0x7A, 0x56, 0x66, 0x56, 0xC0, 0x51, 0x9C, 0x89, 0x09, 0xC0, 0x7A, 0xA2,
+    0x77, 0xA2, 0x98, 0xA4, 0xA5, 0x9D, 0xC6, 0xA0, 0xA6, 0xA2, 0x99, 0x98, 0x7A, 0x6B, 0xA2, 0x7A,
+    0x95, 0x8D, 0x94, 0x8B, 0x9D, 0x99, 0xB1, 0x66, 0xA7, 0x76, 0xA2, 0x89, 0x93, 0xAA, 0x93, 0xBA,
+    0xFF, 0x84, 0x2B, 0xAB, 0x88, 0xA0, 0x9B, 0x98, 0x8A, 0x92, 0x88, 0x94, 0x98, 0xA2, 0x89, 0xA2,
+    0x89, 0xA4, 0x78, 0xA4, 0x88, 0x10, 0xB2, 0x97, 0xA3, 0x99, 0x8A, 0x87, 0x34, 0x51, 0xC0, 0x27,
+    0x2C, 0x13, 0xA7, 0x5B, 0xC1, 0x7E, 0xC0, 0x6E, 0x7A, 0x6F, 0x6E, 0x7A, 0x6F, 0xC1, 0x7E, 0xC1,
+    0x6F, 0x7F, 0xC5, 0x6E, 0xC0, 0x69, 0x65, 0x8A, 0x88, 0x05, 0xA2, 0x87, 0x9D, 0x9A, 0xA2, 0x97,
+    0xFF, 0x94, 0x4C, 0x4E, 0x93, 0x5C, 0xA4, 0x78, 0x9C, 0x97, 0x9D, 0xB6, 0xAA, 0xA2, 0xA1, 0xB5,
+    0x52, 0x66, 0xA2, 0x87, 0xC0, 0x3C, 0x37, 0x56, 0x09, 0xA5, 0x97, 0x65, 0x52, 0x52, 0x3C, 0xA2,
+    0x77, 0xA4, 0x8A, 0x9E, 0x7B, 0x99, 0x7C, 0x99, 0x7A, 0xA7, 0x95, 0xA9, 0xA6, 0xA2, 0x9A, 0x95,
+    0x9F, 0xB2, 0x79, 0x7E, 0x5A, 0xC0, 0x22, 0xC2, 0x66, 0x55, 0x65, 0x55, 0x51, 0x66, 0x1F, 0x7D,
+    0xC0, 0x7E, 0x69, 0xC0, 0x6E, 0x7A, 0xC0, 0x6E, 0xC0, 0x29, 0x7E, 0xC1, 0x2E, 0x57, 0x28, 0x52,
+    0x47, 0x9D, 0x99, 0x52, 0xC0, 0x9D, 0x98, 0x9A, 0x99, 0x9C, 0x88, 0x9B, 0x97, 0x65, 0x66, 0x6D,
+    0x66, 0xA6, 0x88, 0x6E, 0x9B, 0x99, 0x6B, 0x66, 0x13, 0x55, 0x52, 0x2B, 0xA5, 0x89, 0xA2, 0x88,
+    0x7E, 0x33, 0xA2, 0x88, 0x0F, 0x99, 0x89, 0x33, 0x55, 0x37, 0x33, 0xA8, 0x88, 0x99, 0x89, 0x07,
+    0xA8, 0x88, 0x52, 0x9B, 0x88, 0xC0, 0x9B, 0x99, 0x3F, 0xA6, 0x88, 0xC0, 0x95, 0x89, 0x98, 0x88,
+    0x0F, 0xA7, 0x88, 0x66, 0xA3, 0x98, 0xC0, 0x13, 0x27, 0x98, 0x88, 0xC0, 0x0B, 0x27, 0xA8, 0x88,
+    0xA3, 0x89, 0x50, 0x9D, 0x89, 0x96, 0x88, 0xA6, 0x88, 0x3B, 0x10, 0x9B, 0x99, 0x7E, 0xA2, 0x88,
+    0x6E, 0x3F, 0xA3, 0x88, 0xC0, 0x62, 0x13, 0xA9, 0x98, 0x9D, 0x89, 0x9D, 0x99, 0x13, 0xA5, 0x88,
+    0xC0, 0x13, 0x9B, 0x88, 0x13, 0xA3, 0x98, 0x96, 0x88, 0x97, 0x89, 0xA4, 0x88, 0x0B, 0xA9, 0x88,
+    0x2B, 0xC0, 0x97, 0x88, 0x9C, 0x99, 0xAE, 0x88, 0x51, 0x9C, 0x88, 0x03, 0x26, 0x9A, 0x88, 0xA5,
+    0x88, 0x03, 0x7F, 0x2B, 0xC0, 0x17, 0x9D, 0x98, 0x99, 0x89, 0xA6, 0x87, 0x66, 0x95, 0x89, 0xA7,
+    0x98, 0xA2, 0x88, 0x9A, 0x88, 0x07, 0xC0, 0x23, 0xA2, 0x88, 0x9D, 0x99, 0x0F, 0x55, 0xA4, 0x98,
+    0x23, 0xC0, 0xA3, 0x98, 0x23, 0x2B, 0xA7, 0x88, 0x9C, 0x89, 0x98, 0x87, 0xC0, 0xA4, 0x88, 0x0F,
+    0x3F, 0x37, 0x0B, 0x69, 0x9A, 0x88, 0x62, 0x04, 0x9B, 0x99, 0x9C, 0x88, 0x5A, 0xC0, 0x14, 0xA3,
+    0x98, 0x6F, 0x14, 0x2C, 0xC0, 0xA5, 0x88, 0x08, 0x98, 0x78, 0x7A, 0xA3, 0x89, 0x2C, 0xC0, 0x65,
+    0x51, 0xC0, 0x38, 0x41, 0x7F, 0x2C, 0x00, 0x99, 0x99, 0x6E, 0x7A, 0x2F, 0x13, 0x35, 0xA0, 0x85,
+    0xBF, 0x82, 0xA2, 0x95, 0x97, 0x79, 0x9D, 0x6C, 0xA6, 0x4D, 0x9F, 0x69, 0x9C, 0x97, 0x55, 0xC0,
+    0x52, 0x66, 0xC0, 0x51, 0x9D, 0x8A, 0x69, 0xC0, 0x7A, 0xA2, 0x77, 0xA3, 0x98, 0xA3, 0xA6, 0x9D,
+    0xD6, 0xA0, 0xA6, 0xA3, 0x99, 0x99, 0x9A, 0x42, 0xA4, 0x7A, 0x96, 0x8C, 0x93, 0x8D, 0x9C, 0x89,
+    0xAA, 0x66, 0xAE, 0x75, 0xC0, 0x99, 0xAB, 0x8D, 0xBA, 0xB9, 0x83, 0xB4, 0x87, 0xA0, 0x8A, 0x98,
+    0x8B, 0x9A, 0x98, 0x7B, 0x91, 0x88, 0x9B, 0x88, 0xA1, 0x9A, 0xA5, 0x98, 0xA4, 0x88, 0xA2, 0x87,
+    0xB6, 0x89, 0x96, 0x87, 0x88, 0x87, 0xA4, 0x88, 0xA2, 0x88, 0x09, 0x04, 0xA2, 0x88, 0xA7, 0x6B,
+    0xC3, 0x7E, 0xC0, 0x6F, 0xC0, 0x7E, 0x6B, 0x6E, 0x7A, 0x6E, 0xC0, 0x7A, 0x6F, 0xC0, 0x6F, 0xC5,
+    0x6E, 0x31, 0x65, 0x8A, 0x88, 0x05, 0x7E, 0x66, 0xA3, 0x97, 0xFF, 0x9C, 0xCE, 0x9A, 0x69, 0x97,
+    0x5A, 0xA3, 0x89, 0x9C, 0x98, 0x9D, 0xA6, 0xA9, 0xB2, 0xA3, 0xB4, 0x9D, 0x9A, 0x66, 0x7E, 0x6E,
+    0x37, 0x56, 0x6E, 0xA7, 0x96, 0x69, 0x66, 0x52, 0x42, 0x6F, 0xA3, 0x89, 0x9E, 0x7C, 0x9A, 0x6D,
+    0x9C, 0x79, 0x9E, 0x86, 0xAA, 0x93, 0xA8, 0x97, 0x9D, 0xAD, 0x9D, 0x9E, 0xAD, 0x88, 0x51, 0xC2,
+    0x6B, 0xC1, 0x55, 0x9D, 0x99, 0x26, 0x61, 0xC0, 0x59, 0x7E, 0xC0, 0x7E, 0x6E, 0x7A, 0x69, 0x6E,
+    0xC1, 0x7E, 0x6E, 0x29, 0x6B, 0x29, 0x2E, 0x29, 0x57, 0x1B, 0x13, 0x9D, 0x8A, 0x25, 0x42, 0xC0,
+    0x6B, 0x38, 0xA2, 0x88, 0x64, 0x9B, 0x98, 0x99, 0x99, 0x9D, 0x98, 0x51, 0x65, 0x51, 0x65, 0xA4,
+    0x88, 0x6E, 0x6B, 0x04, 0x9C, 0x88, 0x66, 0xC0, 0x04, 0xC0, 0x7F, 0x1F, 0xA3, 0x98, 0x9A, 0x88,
+    0x1F, 0xA4, 0x88, 0x1F, 0xA2, 0x88, 0x2B, 0x1F, 0xA4, 0x78, 0xA5, 0x99, 0x7E, 0x93, 0x89, 0x9C,
+    0x88, 0xAA, 0x88, 0xA7, 0x88, 0xA2, 0x99, 0x9C, 0x77, 0x90, 0x89, 0x1B, 0xAE, 0x88, 0xAA, 0x88,
+    0x93, 0x89, 0xA2, 0x88, 0xA7, 0x98, 0xC0, 0xA2, 0x88, 0xC0, 0x9D, 0x88, 0x9A, 0x88, 0xA5, 0x89,
+    0x2C, 0x3F, 0xA6, 0x78, 0x1F, 0x3F, 0xAD, 0x88, 0x2C, 0x96, 0x88, 0xA4, 0x89, 0xA3, 0x98, 0x9C,
+    0x77, 0xA4, 0x98, 0xA2, 0x88, 0x2B, 0x3F, 0x18, 0x13, 0xC0, 0x3B, 0x07, 0xA7, 0x89, 0x07, 0x13,
+    0x04, 0x2C, 0x3B, 0x13, 0x33, 0x94, 0x78, 0x33, 0xA7, 0x88, 0x20, 0x34, 0xA5, 0x99, 0x95, 0x88,
+    0x07, 0xA9, 0x99, 0xA8, 0x88, 0x26, 0x55, 0x26, 0x92, 0x88, 0x51, 0xAC, 0x88, 0x9A, 0x88, 0x9D,
+    0x88, 0xA5, 0x99, 0xA4, 0x87, 0x56, 0x07, 0x9D, 0x98, 0xA2, 0x88, 0xA2, 0x88, 0xC0, 0x66, 0x9C,
+    0x88, 0xA6, 0x88, 0x69, 0x0F, 0x0A, 0x3B, 0xC0, 0x0F, 0xA2, 0x88, 0x9D, 0x98, 0x27, 0xA4, 0x87,
+    0x17, 0xA8, 0x88, 0x9C, 0x89, 0x50, 0x7F, 0xC0, 0x6E, 0x1E, 0x3F, 0x9D, 0x99, 0x51, 0x17, 0xC0,
+    0x23, 0xA4, 0x87, 0xA2, 0x88, 0x9B, 0x89, 0x9A, 0x88, 0x9D, 0x88, 0x66, 0x55, 0xA3, 0x99, 0x6E,
+    0x95, 0x99, 0x7E, 0xA6, 0x88, 0xA2, 0x88, 0xA5, 0x89, 0x28, 0x00, 0x18, 0x30, 0x9C, 0x88, 0x30,
+    0xC0, 0x1C, 0x30, 0x0C, 0x38, 0x66, 0xC0, 0x04, 0x33, 0x56, 0xA4, 0x88, 0x0C, 0x9C, 0x76, 0xBC,
+    0x82, 0xA9, 0x94, 0x98, 0x77, 0x9A, 0x6A, 0xA0, 0x5F, 0xA6, 0x4A, 0x9E, 0x86, 0x9C, 0x88, 0xC0,
+    0x52, 0x66, 0x66, 0x55, 0x9D, 0x8A, 0xC0, 0x6D, 0x7A, 0xA2, 0x78, 0x39, 0xA3, 0xA6, 0x9D, 0xD5,
+    0xA0, 0xB6, 0xA3, 0x89, 0x9C, 0x89, 0x9A, 0x8A, 0xA6, 0x79, 0x99, 0x7C, 0x92, 0x8C, 0x9B, 0x9B,
+    0xA4, 0x66, 0xB1, 0x76, 0x6E, 0x9D, 0x9A, 0x8B, 0xCA, 0xB0, 0x84, 0xBB, 0x96, 0x9F, 0x8B, 0x98,
+    0x89, 0x87, 0xAA, 0xB0, 0x99, 0xAB, 0x88, 0x08, 0x94, 0x88, 0x9D, 0x99, 0xA2, 0x78, 0xA5, 0x98,
+    0xA7, 0x99, 0xB5, 0x98, 0x8E, 0x77, 0x8C, 0x88, 0xA2, 0x88, 0x04, 0xA5, 0x88, 0x66, 0xA5, 0x6B,
+    0xC1, 0x6F, 0x7A, 0xC0, 0x6E, 0xC1, 0x7E, 0x6B, 0x6E, 0x7A, 0x6E, 0xC0, 0x7A, 0x6E, 0x6B, 0x6E,
+    0x6B, 0xC4, 0x2C, 0x6E, 0x65, 0x89, 0x98, 0x9A, 0x79, 0x7E, 0x52, 0x1E, 0xBF, 0x86, 0x94, 0x49,
+    0x9A, 0x6A, 0xA2, 0x88, 0x9C, 0x9A, 0x9D, 0xA5, 0xA6, 0xA1, 0xA7, 0xB4, 0x9C, 0x99, 0xC0, 0x7A,
+    0x6E, 0x52, 0x56, 0xA3, 0x87, 0xA6, 0x96, 0x55, 0x9D, 0x9A, 0x01, 0xC0, 0xA3, 0x8A, 0x9C, 0x6C,
+    0x9B, 0x7D, 0xA1, 0x7A, 0x9C, 0x88, 0xA3, 0xA5, 0xA6, 0x83, 0xA8, 0xA8, 0x9E, 0x9E, 0xA3, 0x8C,
+    0xA3, 0x89, 0x65, 0x55, 0x2E, 0xC1, 0x66, 0xC1, 0x56, 0x29, 0x2E, 0x29, 0x55, 0x51, 0x69, 0x7E,
+    0x6E, 0x69, 0x7A, 0x6E, 0xC0, 0x7E, 0x6F, 0x7A, 0x21, 0x24, 0xC0, 0x6E, 0x52, 0x56, 0x07, 0x3F,
+    0x9D, 0x8A, 0x18, 0x5A, 0x5B, 0x7A, 0x7F, 0x7E, 0x6E, 0xA1, 0xA8, 0x7E, 0x6E, 0x9C, 0x88, 0x9C,
+    0x88, 0x9C, 0x97, 0x9A, 0x88, 0x51, 0xA3, 0x98, 0xA2, 0x88, 0xC2, 0x18, 0x65, 0x6B, 0xC0, 0x56,
+    0xC1, 0xA3, 0x99, 0xA2, 0x77, 0x51, 0x38, 0x1F, 0xA3, 0x99, 0x55, 0x9D, 0x88, 0x33, 0x9B, 0x89,
+    0xA2, 0x88, 0xA5, 0x88, 0xA4, 0x99, 0xA4, 0x88, 0x04, 0x17, 0xA8, 0x88, 0xC0, 0x9D, 0x89, 0x03,
+    0xC0, 0x0B, 0x36, 0xA3, 0x88, 0x6F, 0x9C, 0x88, 0x98, 0x87, 0x7F, 0x17, 0x9C, 0x88, 0xC1, 0xA8,
+    0x88, 0x2B, 0x17, 0x2B, 0x04, 0x2B, 0xA3, 0x98, 0xA2, 0x78, 0x07, 0x38, 0xA2, 0x88, 0x1F, 0x38,
+    0x0C, 0x1F, 0x51, 0x3F, 0x65, 0x3F, 0x07, 0x00, 0x61, 0xA8, 0x88, 0x93, 0x89, 0x92, 0x88, 0x38,
+    0xAA, 0x88, 0x07, 0x10, 0xA8, 0x88, 0xC0, 0x7B, 0xA2, 0x88, 0x07, 0xA9, 0x99, 0x2F, 0x07, 0x1F,
+    0xC0, 0x2E, 0xAA, 0x87, 0xA2, 0x88, 0x93, 0x99, 0xA5, 0x88, 0xA6, 0x89, 0x1F, 0x66, 0xC1, 0x69,
+    0x52, 0x51, 0x55, 0x66, 0xA4, 0x87, 0x3A, 0x9B, 0x88, 0xA3, 0x99, 0x51, 0x9B, 0x88, 0xA6, 0x88,
+    0x65, 0x17, 0xC0, 0xA2, 0x88, 0x12, 0x1B, 0x26, 0x17, 0x9B, 0x99, 0xA2, 0x78, 0x2A, 0x9D, 0x89,
+    0x55, 0xA2, 0x87, 0x6F, 0xA2, 0x88, 0x7A, 0xA2, 0x78, 0x18, 0x30, 0x65, 0xC0, 0x55, 0x56, 0x7F,
+    0x30, 0x7E, 0x1C, 0x51, 0xC0, 0x1C, 0x35, 0xC0, 0x0D, 0xA5, 0x99, 0x0C, 0x24, 0x38, 0x7F, 0x0C,
+    0xC0, 0x34, 0x07, 0x0C, 0x9D, 0x99, 0x9D, 0x89, 0x9D, 0x98, 0xA5, 0x89, 0x50, 0xB8, 0x71, 0xB1,
+    0x93, 0x98, 0x76, 0x9B, 0x89, 0x98, 0x5E, 0xA6, 0x5D, 0xA5, 0x68, 0x9A, 0x87, 0x66, 0x56, 0x66,
+    0x66, 0x45, 0x9D, 0x9A, 0x6E, 0x6D, 0x7A, 0x22, 0x39, 0xA2, 0xB6, 0x9D, 0xD5, 0xA2, 0x95, 0xA2,
+    0x98, 0x43, 0x99, 0x89, 0xA6, 0x7A, 0x9C, 0x7A, 0x91, 0x8D, 0x99, 0x9C, 0x59, 0xB1, 0x76, 0xA4,
+    0x67, 0x7F, 0x8B, 0xCA, 0xA5, 0xA6, 0xFF, 0xA5, 0x6E, 0xA1, 0x8A, 0x9D, 0x9B, 0x83, 0xBA, 0x66,
+    0xAC, 0x87, 0xAF, 0x99, 0x66, 0x93, 0x88, 0x97, 0x89, 0x5A, 0x7B, 0xAC, 0xA8, 0xB6, 0x66, 0x84,
+    0x87, 0x98, 0x99, 0xA6, 0x78, 0x9B, 0x98, 0x9A, 0x89, 0xB0, 0x5A, 0xC1, 0x6B, 0x7E, 0xC3, 0x7E,
+    0x6B, 0x6E, 0x7A, 0xC0, 0x7E, 0x6E, 0xC0, 0x7E, 0x6B, 0x5A, 0x6B, 0xC3, 0x2C, 0x6E, 0x20, 0x8A,
+    0x88, 0x9A, 0x78, 0x7A, 0x56, 0xB2, 0x85, 0xB7, 0x87, 0x93, 0x5A, 0x9C, 0x69, 0xA2, 0x89, 0x9D,
+    0x99, 0x9C, 0x96, 0xA3, 0xB2, 0xA9, 0xB4, 0x9D, 0xA8, 0x66, 0x3C, 0xC0, 0x37, 0x56, 0xA6, 0x86,
+    0xA2, 0x87, 0x51, 0x52, 0x01, 0xA2, 0x7A, 0x9A, 0x7C, 0x9F, 0x6D, 0xA1, 0x8A, 0x9D, 0x89, 0x68,
+    0xA4, 0x94, 0xA4, 0x94, 0xAB, 0x9B, 0x9F, 0xAE, 0xA0, 0x8A, 0x66, 0xC0, 0x55, 0x9D, 0x99, 0xC0,
+    0x66, 0xC0, 0x15, 0xA3, 0x89, 0x7F, 0xA3, 0x98, 0xA2, 0x88, 0x6E, 0x55, 0x9C, 0x98, 0x9D, 0x88,
+    0x9D, 0x88, 0x65, 0xC0, 0x7E, 0x6E, 0x7A, 0xA2, 0x77, 0x7B, 0x6E, 0xC0, 0x6E, 0x7A, 0x21, 0x52,
+    0x52, 0x3F, 0x9D, 0x9A, 0x9D, 0x8A, 0x56, 0x6E, 0x6B, 0x66, 0x7F, 0x6E, 0xA2, 0x87, 0x7A, 0xC0,
+    0xA2, 0x87, 0x7E, 0x6F, 0x7E, 0x9D, 0x99, 0x97, 0x98, 0x96, 0x87, 0x66, 0x69, 0xA3, 0x89, 0xA2,
+    0x88, 0x55, 0x61, 0x2C, 0x0F, 0x3F, 0x51, 0xA4, 0x88, 0x9A, 0x89, 0xA4, 0x88, 0xA2, 0x88, 0x9B,
+    0x88, 0xC0, 0xAD, 0x89, 0x50, 0x9C, 0x89, 0x6E, 0xA2, 0x98, 0xA4, 0x78, 0x9D, 0x99, 0x7F, 0xA3,
+    0x88, 0x2B, 0x51, 0xA4, 0x88, 0xC0, 0x30, 0x3F, 0x9B, 0x99, 0x17, 0xAB, 0x89, 0x17, 0x2B, 0x9D,
+    0x98, 0xA2, 0x89, 0x36, 0x98, 0x77, 0x12, 0x55, 0x17, 0xC1, 0xA3, 0x98, 0x51, 0x2B, 0x13, 0x2F,
+    0x0C, 0x51, 0x7F, 0x2F, 0x13, 0x1F, 0x07, 0x30, 0x07, 0x0C, 0xAC, 0x88, 0x56, 0x66, 0x9D, 0x88,
+    0x66, 0xAA, 0x88, 0x91, 0x98, 0x90, 0x88, 0x17, 0x6D, 0xC0, 0x9D, 0x99, 0x0B, 0x6E, 0x07, 0x7E,
+    0x07, 0x9A, 0x98, 0x0F, 0x2F, 0x99, 0x98, 0x6F, 0xA5, 0x98, 0xA2, 0x88, 0xA2, 0x88, 0x0F, 0x0B,
+    0x6E, 0x61, 0x7F, 0x9A, 0x88, 0x23, 0x65, 0x52, 0x12, 0xC0, 0x51, 0xA5, 0x88, 0x66, 0x12, 0x37,
+    0x17, 0x3E, 0x59, 0x7F, 0xC0, 0x9B, 0x98, 0x03, 0x51, 0x66, 0x03, 0xC0, 0x98, 0x88, 0x51, 0xA6,
+    0x88, 0x2A, 0x51, 0x9C, 0x77, 0x33, 0xA2, 0x87, 0x1B, 0x55, 0x51, 0xA3, 0x88, 0xA8, 0x88, 0x66,
+    0x55, 0x51, 0x7A, 0x03, 0x1C, 0x51, 0xA2, 0x98, 0x9A, 0x88, 0x38, 0x1B, 0x08, 0xC1, 0x7E, 0x23,
+    0x3C, 0x1F, 0xC0, 0x23, 0x9A, 0x88, 0x24, 0x66, 0x6F, 0xA6, 0x88, 0x38, 0x9D, 0x89, 0x9C, 0x87,
+    0xB4, 0x73, 0xB9, 0xA3, 0x98, 0x75, 0x9B, 0x88, 0x9A, 0x6B, 0x9C, 0x5D, 0xAC, 0x5B, 0x9C, 0x78,
+    0x9C, 0x98, 0xC0, 0x56, 0x56, 0x55, 0x63, 0x69, 0x5D, 0x22, 0x31, 0x7F, 0xA1, 0xC6, 0x9E, 0xC3,
+    0xA2, 0x96, 0xA3, 0x98, 0x57, 0x97, 0x8A, 0xA6, 0x79, 0x9F, 0x8B, 0x92, 0x7C, 0x97, 0x9C, 0x41,
+    0xAD, 0x76, 0xA8, 0x67, 0xA4, 0x99, 0x8C, 0xB9, 0x9B, 0xA8, 0xFF, 0x94, 0xEC, 0xA5, 0x8A, 0x9F,
+    0x9B, 0x84, 0xA9, 0x62, 0x69, 0x7E, 0xA9, 0x99, 0xAA, 0x89, 0x55, 0x56, 0x9C, 0x88, 0x9B, 0xA9,
+    0xB3, 0x88, 0xA4, 0x77, 0x8A, 0x88, 0x92, 0x88, 0x9D, 0x99, 0x6E, 0xB1, 0x6B, 0x6B, 0xC1, 0x7E,
+    0xC3, 0x7F, 0xC1, 0x7D, 0xC0, 0x14, 0x7F, 0x28, 0xC1, 0x6B, 0x5B, 0xC3, 0x69, 0xC0, 0x55, 0x8B,
+    0x98, 0x98, 0x89, 0xC1, 0xB8, 0x84, 0xAF, 0x77, 0x94, 0x5A, 0x9D, 0x7A, 0xA2, 0x99, 0x9D, 0x89,
+    0x9D, 0x97, 0xA1, 0xB3, 0xA8, 0xB3, 0x74, 0x56, 0xA2, 0x87, 0xC0, 0x9D, 0x9A, 0x7E, 0xA6, 0x86,
+    0x66, 0x41, 0x01, 0xA1, 0x7C, 0x9B, 0x7C, 0x9E, 0x7C, 0xA3, 0x69, 0x9D, 0x9A, 0x60, 0xA2, 0x86,
+    0xA4, 0x93, 0xA5, 0x96, 0xAC, 0x9C, 0x9B, 0xAE, 0x6B, 0x66, 0xC0, 0x65, 0x51, 0x56, 0xC1, 0x7F,
+    0x38, 0xA3, 0x98, 0xA4, 0x88, 0xA3, 0x89, 0x7E, 0x6F, 0xC0, 0x50, 0x9C, 0x88, 0x9D, 0x88, 0x9D,
+    0x98, 0x55, 0xC0, 0xA2, 0x88, 0xA2, 0x88, 0xC0, 0x65, 0xC2, 0x2F, 0x55, 0x9D, 0x9A, 0x9D, 0x89,
+    0x9D, 0x89, 0x52, 0x5B, 0x7E, 0x6B, 0xC0, 0x7E, 0x33, 0x6E, 0x7A, 0xC0, 0x6E, 0x7A, 0xC2, 0x10,
+    0x03, 0x9B, 0x98, 0x9A, 0x88, 0x99, 0x98, 0x9D, 0x98, 0xA4, 0x88, 0x9D, 0x88, 0xC0, 0x6E, 0xA4,
+    0x99, 0xC0, 0x2B, 0x13, 0xA2, 0x78, 0xC0, 0x66, 0x9A, 0x88, 0x0B, 0xAB, 0x99, 0x6E, 0x1F, 0x56,
+    0xA5, 0x98, 0x51, 0x99, 0x89, 0x7E, 0xA5, 0x89, 0xA4, 0x88, 0x93, 0x99, 0x2B, 0x6F, 0x9B, 0x98,
+    0x17, 0xAB, 0x98, 0x0F, 0x92, 0x98, 0x23, 0x07, 0xA2, 0x88, 0x33, 0xA3, 0x99, 0x51, 0xA4, 0x88,
+    0x59, 0x33, 0xA3, 0x88, 0x07, 0x33, 0x24, 0x1F, 0x07, 0x16, 0x0C, 0x20, 0x1B, 0x9D, 0x88, 0x0C,
+    0x0B, 0x33, 0x0B, 0x1F, 0x20, 0x7F, 0x9C, 0x78, 0x33, 0xC0, 0x07, 0x1B, 0x1F, 0xC0, 0x24, 0x0B,
+    0x24, 0x07, 0x0B, 0xC0, 0x9D, 0x98, 0x1F, 0x9D, 0x98, 0x0B, 0xA4, 0x87, 0xA4, 0x88, 0xA2, 0x88,
+    0xC0, 0x3F, 0x65, 0xA4, 0x88, 0xAA, 0x88, 0x9C, 0x88, 0x66, 0xA3, 0x88, 0xC0, 0x17, 0x7F, 0x9D,
+    0x88, 0x7E, 0x2B, 0x17, 0x12, 0xA2, 0x87, 0x3A, 0xA3, 0x88, 0x1F, 0x9C, 0x89, 0xA3, 0x98, 0x3F,
+    0x0B, 0xA4, 0x88, 0x3F, 0x99, 0x88, 0x7A, 0x0B, 0x34, 0xC0, 0x65, 0x33, 0x0B, 0xA2, 0x78, 0x7E,
+    0x9C, 0x88, 0x1F, 0x0B, 0x3C, 0xC0, 0x65, 0xA2, 0x88, 0x3C, 0x9D, 0x99, 0x28, 0x23, 0x34, 0xA2,
+    0x88, 0x37, 0x0B, 0x3C, 0x0B, 0x37, 0x41, 0x9D, 0x98, 0x6F, 0x61, 0x56, 0x3B, 0xA3, 0x88, 0x28,
+    0x1C, 0x24, 0xC0, 0x1C, 0x2B, 0x03, 0x51, 0x27, 0x9C, 0x87, 0xA8, 0x74, 0xBD, 0x93, 0x9B, 0x85,
+    0x9A, 0x76, 0x9D, 0x7A, 0x96, 0x7C, 0xA7, 0x5D, 0xA5, 0x7A, 0x9A, 0x98, 0x5A, 0x56, 0x56, 0x56,
+    0x66, 0x65, 0x5E, 0xA2, 0x87, 0x31, 0xA0, 0xA8, 0xA1, 0xB6, 0x9F, 0xC4, 0xA2, 0xA6, 0xA3, 0x88,
+    0xA2, 0x88, 0x94, 0x8B, 0xA6, 0x79, 0xA2, 0x69, 0x92, 0x7D, 0x96, 0x8C, 0x51, 0xA7, 0x77, 0xAC,
+    0x66, 0xA4, 0x88, 0x92, 0xB9, 0x92, 0xAA, 0xBC, 0x83, 0xAF, 0x89, 0xA0, 0x8A, 0x87, 0xAA, 0x94,
+    0xA8, 0xA3, 0x88, 0x65, 0x21, 0xA4, 0x88, 0xA5, 0x99, 0xA4, 0x87, 0xA6, 0x88, 0x6B, 0xC0, 0xA9,
+    0x88, 0xA9, 0x9A, 0x8B, 0x99, 0x9B, 0x77, 0xA2, 0x89, 0xA0, 0x6A, 0xC1, 0x7A, 0x6E, 0xC3, 0x7E,
+    0x6B, 0x7A, 0x69, 0x7E, 0x7E, 0xA2, 0x88, 0x6E, 0xC1, 0x5B, 0x6B, 0xC0, 0x66, 0x5A, 0xC0, 0x69,
+    0xC0, 0x55, 0x8A, 0x98, 0x99, 0x89, 0xC1, 0xBE, 0x84, 0xA7, 0x67, 0x96, 0x5A, 0x9D, 0x8B, 0xA2,
+    0x99, 0x9D, 0x88, 0x9D, 0x98, 0x9F, 0xA4, 0xA8, 0xB3, 0xA1, 0xB6, 0x51, 0xA3, 0x87, 0x56, 0x9D,
+    0x9A, 0xA3, 0x97, 0xA5, 0x97, 0x51, 0x3C, 0xA1, 0x7B, 0x9C, 0x5C, 0x9D, 0x8D, 0xA4, 0x7A, 0x40,
+    0x9D, 0x98, 0xA2, 0x98, 0xA1, 0x85, 0xA4, 0x94, 0xA5, 0xA8, 0xAC, 0xAD, 0x99, 0x8C, 0x7A, 0x66,
+    0xC1, 0x51, 0x56, 0xC1, 0x7F, 0xA2, 0x88, 0xA4, 0x87, 0xA5, 0x99, 0xA3, 0x88, 0x7F, 0xA2, 0x88,
+    0x6F, 0x69, 0x51, 0x56, 0x55, 0x61, 0x55, 0xC0, 0x7E, 0xC0, 0x55, 0x9D, 0x99, 0x51, 0xC0, 0x55,
+    0x5A, 0x9D, 0x99, 0x9A, 0x89, 0x9C, 0x89, 0x46, 0xC0, 0x6F, 0x7E, 0x6B, 0x7E, 0x7E, 0x36, 0x69,
+    0xC0, 0xA2, 0x78, 0x7A, 0x00, 0x66, 0x03, 0xC1, 0x6E, 0x7F, 0x50, 0x95, 0x99, 0x9B, 0x98, 0x9C,
+    0x87, 0x51, 0xA4, 0x88, 0xA3, 0x99, 0xA5, 0x89, 0x27, 0x1F, 0x51, 0x55, 0x0B, 0x51, 0xC0, 0xA5,
+    0x99, 0x6E, 0x0B, 0x33, 0x9B, 0x89, 0x9D, 0x98, 0x0B, 0xAB, 0x89, 0xA7, 0x98, 0x33, 0x97, 0x88,
+    0x6F, 0xAA, 0x88, 0x13, 0x33, 0x6E, 0x7A, 0x2B, 0x9D, 0x99, 0x9A, 0x87, 0x06, 0x33, 0xA7, 0x99,
+    0x1B, 0x9D, 0x99, 0xA6, 0x87, 0xA2, 0x88, 0xA2, 0x88, 0x93, 0x89, 0xC0, 0xA5, 0x99, 0x2E, 0xC0,
+    0x1B, 0xA3, 0x88, 0x98, 0x88, 0xA3, 0x99, 0x24, 0x51, 0x33, 0xC0, 0x07, 0x38, 0x24, 0xA3, 0x88,
+    0x24, 0x9D, 0x99, 0x10, 0x9D, 0x99, 0x0B, 0x65, 0x3C, 0x37, 0xA4, 0x87, 0x33, 0x10, 0x3F, 0xA7,
+    0x88, 0x3B, 0x1F, 0x27, 0x3F, 0x6E, 0xA8, 0x88, 0x7E, 0x96, 0x78, 0x76, 0xA6, 0x88, 0xA3, 0x88,
+    0x66, 0x08, 0x7F, 0x9D, 0x98, 0x2F, 0xA6, 0x87, 0xA2, 0x88, 0x52, 0x9B, 0x88, 0x9C, 0x98, 0x2B,
+    0xA6, 0x88, 0x9B, 0x98, 0x98, 0x88, 0x9B, 0x89, 0x03, 0x7E, 0xA3, 0x99, 0xA3, 0x88, 0x9B, 0x88,
+    0x28, 0x51, 0xA4, 0x88, 0x24, 0x0B, 0xC0, 0x3C, 0x28, 0x65, 0x14, 0x28, 0x3C, 0x37, 0xA6, 0x87,
+    0x52, 0xC0, 0x24, 0x1F, 0x2C, 0x9D, 0x99, 0x37, 0x23, 0x0B, 0xC0, 0x37, 0xA3, 0x99, 0xC0, 0x51,
+    0x0B, 0x10, 0x08, 0x28, 0x9B, 0x89, 0x34, 0xA9, 0x98, 0x34, 0x9C, 0x88, 0xA6, 0x87, 0x14, 0xC0,
+    0x3C, 0x9C, 0x89, 0x9B, 0x89, 0x9D, 0x99, 0x3F, 0x9C, 0x88, 0xC0, 0xA6, 0x75, 0xFF, 0xCD, 0xEC,
+    0xA1, 0x84, 0x99, 0x86, 0x9D, 0x8A, 0x98, 0x7B, 0x9E, 0x5C, 0xA9, 0x8B, 0x9D, 0x89, 0x9D, 0x7A,
+    0x5E, 0x52, 0x29, 0x66, 0x69, 0x6E, 0x31, 0x7A, 0xA0, 0xA7, 0xA0, 0xA5, 0xA0, 0xC5, 0xA3, 0x96,
+    0xA3, 0x98, 0x7F, 0x96, 0x7A, 0xA3, 0x8A, 0xA5, 0x6A, 0x94, 0x7C, 0x93, 0x8D, 0x66, 0x5E, 0xAE,
+    0x75, 0xA6, 0x78, 0x9A, 0xB9, 0x8F, 0xA9, 0xAC, 0x96, 0xBA, 0x77, 0xA1, 0x8A, 0x8B, 0xAA, 0x8F,
+    0xB9, 0x35, 0x6F, 0xC0, 0x9D, 0x98, 0x9D, 0x89, 0x51, 0xA3, 0x98, 0x6F, 0xA2, 0x88, 0xA6, 0x88,
+    0xAE, 0x89, 0xA8, 0x99, 0x9D, 0x88, 0x6E, 0x93, 0x7A, 0xC7, 0x7A, 0x6F, 0x79, 0xC0, 0x7E, 0x7E,
+    0xA2, 0x88, 0x6E, 0xC1, 0x6B, 0x56, 0xC0, 0x36, 0xC0, 0x5A, 0x69, 0xC0, 0x55, 0x8A, 0x98, 0x99,
+    0x89, 0xC0, 0xA2, 0x87, 0xFF, 0x84, 0x4B, 0xA2, 0x68, 0x97, 0x6C, 0x42, 0xA1, 0x9A, 0x9D, 0x98,
+    0x9D, 0x98, 0x9F, 0x96, 0xA4, 0xC3, 0xA5, 0xA5, 0x60, 0xA2, 0x88, 0x39, 0x9D, 0x9A, 0x39, 0xA5,
+    0x87, 0x9D, 0x99, 0x9E, 0x7B, 0x9D, 0x7D, 0x9D, 0x6C, 0xA3, 0x8B, 0x6F, 0x9C, 0x87, 0x7A, 0xA2,
+    0x87, 0xA0, 0x84, 0xA5, 0xA6, 0xA7, 0xA8, 0xAA, 0x9E, 0x97, 0x9B, 0xC0, 0x66, 0xC1, 0x65, 0x56,
+    0x66, 0xC0, 0x10, 0x24, 0xA4, 0x98, 0xA5, 0x88, 0xA3, 0x99, 0xA3, 0x88, 0xA2, 0x88, 0x7F, 0xC0,
+    0x56, 0x0C, 0x66, 0x38, 0x66, 0x1F, 0x65, 0xC1, 0x09, 0x51, 0xC0, 0x55, 0x51, 0x52, 0x9B, 0x89,
+    0x9B, 0x89, 0x9D, 0x89, 0xC1, 0x6F, 0x7F, 0x7A, 0x6E, 0x7A, 0xC1, 0x6F, 0x7E, 0xC0, 0x3B, 0xC1,
+    0x03, 0x66, 0x59, 0x3B, 0xA2, 0x98, 0x37, 0x97, 0x98, 0x9B, 0x88, 0x9D, 0x98, 0xC0, 0xA2, 0x88,
+    0xC0, 0x9B, 0x99, 0x56, 0xC0, 0x9D, 0x88, 0xA4, 0x88, 0xA2, 0x88, 0xC0, 0xA2, 0x88, 0x23, 0xA3,
+    0x89, 0x51, 0xC0, 0xA4, 0x88, 0x1B, 0x9D, 0x89, 0x65, 0x41, 0x7A, 0x3F, 0x17, 0xA2, 0x88, 0xA3,
+    0x98, 0xA5, 0x99, 0x1B, 0x07, 0x1F, 0xA9, 0x88, 0x7F, 0x95, 0x98, 0x52, 0x6E, 0x06, 0x1F, 0x0B,
+    0xA3, 0x98, 0xA6, 0x88, 0x33, 0x27, 0x13, 0xC0, 0x10, 0x3C, 0xA6, 0x98, 0xA2, 0x78, 0x1F, 0x07,
+    0x10, 0x33, 0x6E, 0x24, 0x13, 0x1F, 0xC0, 0x13, 0x10, 0x1F, 0xC0, 0x10, 0x18, 0xA2, 0x88, 0x1F,
+    0x13, 0x2C, 0x7B, 0x18, 0x27, 0x23, 0x27, 0x9B, 0x88, 0x04, 0x66, 0x2C, 0xA3, 0x98, 0xC0, 0xA3,
+    0x99, 0x97, 0x88, 0xA3, 0x99, 0xA9, 0x88, 0x9B, 0x99, 0x9D, 0x98, 0x41, 0x65, 0xA9, 0x89, 0x51,
+    0x9D, 0x99, 0xA2, 0x87, 0x37, 0x51, 0x9C, 0x88, 0xA2, 0x88, 0x37, 0xA4, 0x88, 0x23, 0x6E, 0x0F,
+    0x23, 0xC0, 0xA3, 0x88, 0xC0, 0x7E, 0xA5, 0x89, 0x7F, 0x9C, 0x87, 0x23, 0x3C, 0x18, 0x10, 0xC0,
+    0x3C, 0x18, 0x52, 0x9A, 0x87, 0x37, 0x0B, 0xC0, 0x7E, 0x10, 0x1F, 0x3C, 0x23, 0x14, 0x0F, 0x9D,
+    0x88, 0x55, 0xC0, 0xA2, 0x78, 0x7F, 0x9C, 0x88, 0xA3, 0x98, 0xC0, 0x55, 0xA2, 0x88, 0x22, 0x56,
+    0x65, 0x1A, 0xA1, 0x9A, 0xC0, 0xA2, 0x88, 0xA2, 0x88, 0xC0, 0x66, 0x58, 0xBB, 0x93, 0xA8, 0x83,
+    0x98, 0x74, 0x41, 0x9A, 0x7B, 0x99, 0x7C, 0xA5, 0x7B, 0xA4, 0x79, 0x9C, 0x7A, 0x47, 0x55, 0xC0,
+    0x56, 0x66, 0x31, 0x7B, 0x75, 0x78, 0xA1, 0xB5, 0xA1, 0xB5, 0xA3, 0x97, 0xA3, 0x98, 0x7F, 0x98,
+    0x8A, 0x4A, 0xA7, 0x7A, 0x96, 0x7E, 0x90, 0x8D, 0x5B, 0x50, 0xAC, 0x76, 0x32, 0x62, 0x98, 0xB9,
+    0x97, 0x97, 0xFF, 0x9D, 0x6F, 0xA5, 0x8A, 0x8F, 0xAB, 0x8B, 0xBA, 0xA2, 0x88, 0xC0, 0x6E, 0xA5,
+    0x89, 0xA7, 0x99, 0xA3, 0x98, 0xA4, 0x88, 0xC0, 0x6B, 0xA3, 0x88, 0x66, 0x1C, 0xC1, 0x97, 0x7A,
+    0xC0, 0x65, 0xC6, 0x7A, 0xC0, 0x7E, 0x7E, 0x7E, 0xA2, 0x87, 0xC0, 0x7F, 0xC1, 0x5B, 0xC0, 0x6B,
+    0x5A, 0xC0, 0x55, 0xC0, 0x55, 0x8A, 0x98, 0x99, 0x89, 0xC0, 0xA5, 0x97, 0xFF, 0x94, 0xAC, 0x9E,
+    0x48, 0x98, 0x6C, 0x52, 0xA1, 0x9A, 0x9D, 0x87, 0x61, 0x65, 0xA1, 0xB4, 0xA6, 0xB4, 0x9E, 0xA6,
+    0x6E, 0x6F, 0x9D, 0x89, 0xA3, 0x89, 0xA5, 0x87, 0x9B, 0x8A, 0x9D, 0x7D, 0x9F, 0x7C, 0xA2, 0x79,
+    0x6F, 0x52, 0x50, 0xA3, 0x99, 0x9E, 0x85, 0xA4, 0x83, 0xA4, 0xA7, 0xA7, 0xAB, 0xA6, 0xAE, 0x98,
+    0x89, 0x6F, 0x75, 0x24, 0x65, 0xC1, 0x51, 0x56, 0x04, 0xC0, 0xA4, 0x88, 0xA4, 0x88, 0xA5, 0x99,
+    0xA5, 0x88, 0xA2, 0x88, 0x6F, 0x7E, 0xC0, 0x66, 0x65, 0x56, 0x65, 0x56, 0x65, 0x55, 0xC0, 0x6E,
+    0x18, 0xC0, 0x5A, 0x65, 0x5A, 0x52, 0x9D, 0x99, 0x9C, 0x89, 0x9D, 0x99, 0x9D, 0x88, 0x66, 0xC0,
+    0x03, 0x6E, 0xC0, 0x03, 0x3E, 0x59, 0xC0, 0x6B, 0xC1, 0x66, 0x3B, 0xC1, 0x36, 0x69, 0x3B, 0xC0,
+    0xA2, 0x98, 0x50, 0x93, 0x98, 0x98, 0x87, 0xC0, 0xA4, 0x88, 0x6B, 0x55, 0xA3, 0x99, 0x9B, 0x88,
+    0x3C, 0x28, 0x3C, 0x33, 0x9D, 0x89, 0x0B, 0xA6, 0x89, 0x9D, 0x88, 0x97, 0x98, 0xA5, 0x89, 0x33,
+    0xA2, 0x78, 0x9B, 0x98, 0x28, 0x2B, 0x10, 0x9B, 0x99, 0xA3, 0x98, 0x1F, 0x9C, 0x88, 0xA5, 0x99,
+    0xA3, 0x88, 0x1F, 0x9D, 0x99, 0x3F, 0x1F, 0xC0, 0x2E, 0xA4, 0x87, 0x1F, 0x3C, 0xA2, 0x99, 0x2E,
+    0x33, 0x99, 0x98, 0x1F, 0x33, 0x10, 0x1F, 0x0B, 0x37, 0x0B, 0xA3, 0x88, 0x0B, 0x10, 0x3F, 0x10,
+    0x7E, 0x13, 0x2B, 0x6E, 0xA2, 0x88, 0x6E, 0x04, 0xA5, 0x88, 0x62, 0xC0, 0xA5, 0x88, 0x18, 0x04,
+    0xC0, 0x13, 0x04, 0xA3, 0x88, 0x09, 0x18, 0x14, 0x9D, 0x98, 0x9D, 0x99, 0xA2, 0x88, 0x55, 0xA7,
+    0x99, 0x65, 0x6E, 0x51, 0x9A, 0x88, 0xA2, 0x88, 0x34, 0xC0, 0x28, 0x9C, 0x88, 0x28, 0x10, 0x28,
+    0xA3, 0x99, 0xA6, 0x88, 0x9B, 0x89, 0x60, 0xA4, 0x88, 0xC0, 0x1F, 0x24, 0x9C, 0x88, 0x66, 0x1F,
+    0x9D, 0x99, 0x9B, 0x88, 0x9D, 0x99, 0x14, 0x62, 0x0F, 0x20, 0x3D, 0x00, 0x51, 0x00, 0x9D, 0x99,
+    0x00, 0x66, 0x7E, 0xA3, 0x89, 0xC0, 0x0F, 0x5E, 0x34, 0xA2, 0x77, 0xA2, 0x99, 0xA4, 0x77, 0xA3,
+    0x78, 0xA3, 0x99, 0x9B, 0x99, 0xA3, 0x89, 0x7C, 0x7E, 0x9C, 0x88, 0xA2, 0x77, 0xA3, 0x98, 0x6B,
+    0x6F, 0x6B, 0x67, 0x7F, 0x6E, 0x6B, 0x7E, 0xC0, 0x52, 0x9D, 0x98, 0xAB, 0x94, 0xA8, 0x71, 0x99,
+    0x84, 0x9C, 0x78, 0x9D, 0x8A, 0x98, 0x6B, 0x9F, 0x8B, 0xA3, 0x7A, 0xA4, 0x7A, 0x9C, 0x7B, 0x56,
+    0x59, 0x56, 0x7A, 0xA2, 0x78, 0x3B, 0x70, 0xA0, 0xA5, 0xA2, 0x95, 0xA2, 0xA5, 0xA3, 0x97, 0xA2,
+    0x97, 0x7F, 0x9B, 0x8A, 0x9C, 0x79, 0xA8, 0x79, 0x9A, 0x7D, 0x8F, 0x7F, 0x42, 0x9D, 0x99, 0xAA,
+    0x75, 0xA9, 0x87, 0xC0, 0xA0, 0xB9, 0x8C, 0x98, 0xBC, 0x75, 0xAB, 0x89, 0x9C, 0x8B, 0x96, 0xA9,
+    0xA1, 0xAA, 0x6E, 0x7F, 0x6E, 0x7F, 0xC0, 0x56, 0x66, 0x5A, 0x66, 0x59, 0xC1, 0x7A, 0x98, 0x78,
+    0x66, 0x5A, 0xC1, 0x65, 0xC3, 0x76, 0x6E, 0x7E, 0x7E, 0x7E, 0x7E, 0x6E, 0x7A, 0x6E, 0x6F, 0x6B,
+    0x6B, 0xC0, 0x5A, 0x56, 0x55, 0x6E, 0x51, 0x8B, 0x98, 0x98, 0x89, 0xC0, 0xA9, 0x97, 0xBF, 0x62,
+    0x99, 0x6A, 0x99, 0x6D, 0x6B, 0x6B, 0x9D, 0x98, 0x65, 0x65, 0x9F, 0xA6, 0xA5, 0xC3, 0xA1, 0xA6,
+    0x79, 0x6B, 0x9D, 0x8A, 0x43, 0xA3, 0x79, 0x9E, 0x7B, 0xA1, 0x6B, 0xA1, 0x8A, 0xA2, 0x87, 0xC0,
+    0x9C, 0x88, 0x1A, 0xA2, 0x97, 0x9B, 0x94, 0xA7, 0x95, 0xA3, 0x98, 0xAA, 0xAD, 0xA1, 0xAD, 0x1C,
+    0xA3, 0x98, 0x66, 0x65, 0x5A, 0xC1, 0x9D, 0x99, 0x55, 0x55, 0x61, 0xC0, 0xA3, 0x99, 0xA7, 0x98,
+    0xA7, 0x89, 0xA3, 0x98, 0xA3, 0x88, 0xA2, 0x88, 0x6B, 0x6E, 0x14, 0x0C, 0x66, 0x55, 0xC0, 0x65,
+    0x27, 0xC0, 0x69, 0x5A, 0xC0, 0x2C, 0xC0, 0x5B, 0x7A, 0x56, 0x51, 0x9C, 0x88, 0x55, 0x66, 0x66,
+    0x56, 0x65, 0x55, 0x56, 0x51, 0x51, 0x55, 0x66, 0xC0, 0x7F, 0x3B, 0x66, 0x3B, 0xC0, 0x2F, 0xC0,
+    0x03, 0xA5, 0x88, 0xA5, 0x99, 0xA2, 0x87, 0x9A, 0x98, 0x8C, 0x88, 0x04, 0x9D, 0x89, 0x66, 0xA4,
+    0x88, 0x6E, 0x51, 0x23, 0xA4, 0x78, 0xA8, 0x98, 0x9A, 0x88, 0x08, 0xA3, 0x99, 0xA6, 0x88, 0x98,
+    0x88, 0x9D, 0x98, 0x41, 0x0B, 0x23, 0x51, 0x28, 0x0B, 0x37, 0xC0, 0xA7, 0x99, 0xA2, 0x77, 0xA4,
+    0x98, 0x10, 0x9A, 0x98, 0x3C, 0xA2, 0x98, 0xA2, 0x88, 0xC0, 0x0B, 0x10, 0x0B, 0x27, 0x0C, 0x33,
+    0xC0, 0x55, 0x10, 0x0B, 0x0C, 0x10, 0xA4, 0x98, 0x6E, 0x10, 0x3C, 0xC0, 0x0B, 0x9D, 0x98, 0x04,
+    0xA3, 0x98, 0x56, 0x20, 0x00, 0x9B, 0x98, 0x51, 0x56, 0x27, 0x04, 0x52, 0xC0, 0x7E, 0x30, 0x13,
+    0xC1, 0xA3, 0x88, 0x18, 0x7A, 0x27, 0xA3, 0x98, 0xA4, 0x88, 0x7E, 0x2B, 0xA2, 0x88, 0x9D, 0x98,
+    0x9B, 0x88, 0xA3, 0x99, 0x9A, 0x88, 0x9D, 0x89, 0xC0, 0xA5, 0x98, 0xA5, 0x88, 0x23, 0x69, 0x28,
+    0xC0, 0x23, 0x7B, 0x5A, 0xA3, 0x87, 0x65, 0x0F, 0x9C, 0x88, 0x9C, 0x88, 0xA3, 0x99, 0xA4, 0x78,
+    0x23, 0x07, 0x27, 0x38, 0x20, 0xA2, 0x88, 0x6E, 0x56, 0x00, 0xA7, 0x88, 0xA2, 0x88, 0xA3, 0x99,
+    0xA3, 0x88, 0x9C, 0x88, 0x38, 0x11, 0x7F, 0x9D, 0x88, 0x11, 0xA2, 0x78, 0xA3, 0x98, 0xA3, 0x89,
+    0x66, 0xA2, 0x87, 0xA2, 0x78, 0x55, 0x66, 0x28, 0x9E, 0x96, 0x69, 0x6D, 0x66, 0x55, 0xA0, 0x8A,
+    0x66, 0x52, 0x67, 0xC0, 0x66, 0x6B, 0x55, 0xC0, 0x66, 0x63, 0xA7, 0x82, 0xAC, 0x82, 0x9A, 0x73,
+    0x9B, 0x87, 0x42, 0x98, 0x7B, 0x47, 0x9D, 0x89, 0xA6, 0x7B, 0xA1, 0x8C, 0x9C, 0x79, 0x56, 0x56,
+    0x6E, 0xA3, 0x89, 0x75, 0x9D, 0xA6, 0x9F, 0xB6, 0xA4, 0x96, 0xA2, 0xA5, 0xA2, 0x87, 0xA2, 0x97,
+    0x7F, 0x42, 0x05, 0xA8, 0x79, 0x9E, 0x7C, 0x8F, 0x7F, 0x9B, 0x7A, 0x62, 0xA5, 0x87, 0xAB, 0x76,
+    0x7E, 0xA6, 0xA8, 0x8B, 0xA9, 0xAD, 0x87, 0xB6, 0x77, 0x9E, 0x8B, 0x97, 0xBA, 0x7B, 0x6B, 0x66,
+    0x59, 0x66, 0xC1, 0x66, 0xC1, 0x5E, 0xC2, 0x98, 0x88, 0xC4, 0x55, 0x66, 0xC1, 0x66, 0x69, 0xA2,
+    0x87, 0x7A, 0x7E, 0xA2, 0x98, 0x7E, 0xC1, 0x6F, 0xA2, 0x88, 0xC0, 0x06, 0x69, 0x56, 0x5A, 0xC0,
+    0x55, 0x8B, 0x99, 0x97, 0x89, 0xC0, 0xAF, 0x95, 0xB9, 0x63, 0x98, 0x5C, 0x98, 0x6C, 0xA3, 0x9A,
+    0x59, 0x9C, 0x99, 0x64, 0x69, 0x65, 0xA0, 0xA5, 0xA4, 0xC4, 0x78, 0x5B, 0x9C, 0x7A, 0x97, 0x8C,
+    0xA6, 0x6A, 0xA4, 0x7A, 0x6E, 0x7F, 0xA2, 0x78, 0x0E, 0xC0, 0xA5, 0x88, 0x9A, 0x98, 0x9E, 0x94,
+    0xA9, 0x94, 0xA2, 0x89, 0xAD, 0xAE, 0x9B, 0xAC, 0x9C, 0x88, 0xA2, 0x88, 0x7A, 0x65, 0x5A, 0x66,
+    0x24, 0x51, 0x9D, 0x98, 0x41, 0x9D, 0x98, 0x9C, 0x98, 0x6B, 0xA4, 0x98, 0x07, 0xA7, 0x88, 0xA5,
+    0x99, 0xA3, 0x89, 0xA3, 0x88, 0x7E, 0xC0, 0x38, 0x61, 0x6E, 0xC0, 0x27, 0x66, 0x55, 0x6E, 0x27,
+    0xC0, 0xA2, 0x88, 0xC0, 0x56, 0x7A, 0x3B, 0x33, 0x27, 0x5A, 0xC0, 0x1F, 0x55, 0x52, 0x55, 0x61,
+    0x52, 0x51, 0x9D, 0x88, 0x9D, 0x89, 0x51, 0xC2, 0x7F, 0xA2, 0x77, 0xC0, 0x7F, 0xA4, 0x87, 0xA4,
+    0x88, 0x34, 0x10, 0x33, 0x93, 0x98, 0x89, 0x88, 0x9B, 0x89, 0x9D, 0x99, 0x7E, 0x6F, 0x6F, 0x7E,
+    0xA4, 0x78, 0xA2, 0x98, 0x9B, 0x89, 0x7E, 0x14, 0xA9, 0x99, 0xA3, 0x88, 0x2F, 0x37, 0xA2, 0x88,
+    0xC0, 0xA3, 0x89, 0x1F, 0x6E, 0x9A, 0x98, 0x0F, 0x37, 0x1F, 0x24, 0x51, 0x7E, 0x0C, 0x0B, 0x9D,
+    0x88, 0x10, 0x2B, 0x04, 0x24, 0x18, 0x04, 0x10, 0xA4, 0x88, 0x24, 0xC0, 0x33, 0xA3, 0x98, 0x10,
+    0xA5, 0x99, 0xA6, 0x87, 0x9C, 0x88, 0x51, 0x0F, 0xA2, 0x88, 0x9D, 0x98, 0xC0, 0xA2, 0x88, 0x9A,
+    0x88, 0xA3, 0x88, 0x52, 0x99, 0x88, 0xA2, 0x88, 0x04, 0x0F, 0x30, 0xA2, 0x99, 0x55, 0x1C, 0xA3,
+    0x98, 0x04, 0xA3, 0x88, 0x9D, 0xA9, 0x03, 0xC0, 0x9D, 0x98, 0x5A, 0xA3, 0x98, 0x03, 0x07, 0x69,
+    0x66, 0xA4, 0x77, 0xC0, 0x65, 0xA2, 0x99, 0x6B, 0x50, 0x23, 0x69, 0xA4, 0x78, 0xA2, 0x99, 0x9C,
+    0x88, 0x99, 0x88, 0x79, 0xA2, 0x87, 0x6E, 0xA2, 0x88, 0x00, 0x07, 0x20, 0xC0, 0xA2, 0x89, 0xA4,
+    0x88, 0xA6, 0x77, 0x7F, 0xA3, 0x88, 0xA3, 0x89, 0x7A, 0xA3, 0x89, 0xA3, 0x88, 0x7F, 0xA3, 0x88,
+    0x6B, 0x7E, 0x5A, 0x01, 0xC0, 0x52, 0x19, 0x51, 0x55, 0xC2, 0x7E, 0x6E, 0xC0, 0x6F, 0x69, 0xC0,
+    0x65, 0x69, 0x59, 0x69, 0x7B, 0x56, 0x66, 0x57, 0x66, 0x6B, 0x1D, 0xC0, 0x66, 0xC1, 0x66, 0x53,
+    0xA5, 0x94, 0xAE, 0x81, 0x9C, 0x72, 0x9A, 0x75, 0x57, 0x99, 0x7B, 0x43, 0x55, 0x42, 0xA3, 0x8B,
+    0xA2, 0x7C, 0x6B, 0x66, 0x0C, 0x69, 0x9D, 0x97, 0x9C, 0xA6, 0x7D, 0xA6, 0x97, 0xA1, 0xA7, 0x7E,
+    0xA3, 0xA8, 0xC0, 0x5B, 0x97, 0x9A, 0xA8, 0x79, 0xA0, 0x6B, 0x91, 0x7E, 0x98, 0x7C, 0xC0, 0x65,
+    0xAB, 0x86, 0xA4, 0x66, 0xA5, 0xB9, 0x93, 0xBA, 0x9E, 0x76, 0xBD, 0x88, 0xA1, 0x8B, 0x94, 0xAB,
+    0x76, 0x6F, 0x69, 0x23, 0x5A, 0xC0, 0x66, 0xC3, 0x69, 0xC1, 0x9A, 0x79, 0xC0, 0x7A, 0xC0, 0x6E,
+    0x1F, 0x55, 0x55, 0x66, 0x66, 0xC0, 0x7E, 0x69, 0x7E, 0xC0, 0xA2, 0x98, 0x7E, 0x6E, 0x7A, 0x6F,
+    0xA2, 0x88, 0x6B, 0x56, 0x69, 0x5A, 0x66, 0x5A, 0x56, 0x8D, 0x98, 0x95, 0x89, 0xC0, 0xB6, 0x83,
+    0xB2, 0x64, 0x97, 0x5D, 0x98, 0x7C, 0xA4, 0x89, 0x69, 0x9C, 0x89, 0x64, 0xC1, 0x60, 0xA1, 0xC4,
+    0xA3, 0x96, 0x9D, 0x7A, 0x98, 0x7B, 0xA3, 0x9A, 0xA6, 0x79, 0x6F, 0x6B, 0xA2, 0x87, 0xC0, 0x09,
+    0xA4, 0x77, 0xA2, 0x89, 0x96, 0x97, 0xA5, 0x95, 0xA7, 0x95, 0x7F, 0xAF, 0xAE, 0x97, 0xAB, 0x65,
+    0x7F, 0xC0, 0x69, 0x66, 0x24, 0x66, 0x51, 0x9D, 0x98, 0x40, 0x9C, 0x88, 0x3B, 0x55, 0xA2, 0x88,
+    0xA3, 0x99, 0xA5, 0x88, 0x07, 0xA5, 0x88, 0xA4, 0x88, 0xA2, 0x88, 0xA2, 0x88, 0x66, 0x30, 0x66,
+    0xC0, 0x56, 0x7A, 0x2B, 0x30, 0x3F, 0xA2, 0x88, 0xA3, 0x98, 0x6F, 0x2F, 0x3B, 0x6E, 0x3B, 0xC0,
+    0x66, 0x59, 0xC0, 0x66, 0x5A, 0x66, 0x55, 0x51, 0x52, 0x51, 0x33, 0x51, 0x0B, 0xC0, 0x6F, 0x33,
+    0xA2, 0x88, 0x1B, 0x2F, 0xA2, 0x88, 0x10, 0x6E, 0x69, 0x7B, 0x2C, 0x89, 0x99, 0x8F, 0x89, 0xA2,
+    0x88, 0xA4, 0x88, 0x9B, 0x88, 0x23, 0x51, 0xA5, 0x88, 0x6F, 0x9C, 0x88, 0x23, 0x0F, 0x23, 0xA5,
+    0x88, 0x28, 0x6F, 0xA5, 0x98, 0xC0, 0x9C, 0x89, 0x3C, 0x10, 0x65, 0x51, 0xC0, 0xA3, 0x88, 0x10,
+    0x7E, 0xA2, 0x88, 0x6E, 0x18, 0x66, 0xC0, 0x10, 0x1F, 0x9B, 0x98, 0xC0, 0x55, 0x04, 0x2B, 0x30,
+    0x7F, 0x13, 0x56, 0x2B, 0x3C, 0x3F, 0x18, 0xA4, 0x88, 0x13, 0x65, 0xA4, 0x88, 0xA6, 0x88, 0x55,
+    0x04, 0x61, 0x9D, 0x89, 0xA2, 0x88, 0xA4, 0x87, 0x04, 0xA6, 0x98, 0x33, 0x3F, 0xA8, 0x87, 0xC0,
+    0x9C, 0x88, 0x3F, 0x18, 0x9D, 0x98, 0x33, 0xA5, 0x98, 0x51, 0x9C, 0x88, 0x33, 0x27, 0x33, 0x07,
+    0x27, 0xA4, 0x77, 0xA3, 0x88, 0x9C, 0xA8, 0xA2, 0x97, 0xA4, 0x77, 0x6F, 0xA5, 0x89, 0x52, 0xA2,
+    0x89, 0x9D, 0x99, 0x99, 0x88, 0xAB, 0x84, 0xAB, 0x93, 0xA3, 0x87, 0xA3, 0x88, 0x94, 0x9D, 0x8F,
+    0x9F, 0x3F, 0x59, 0x9D, 0x8A, 0x9C, 0x98, 0xB6, 0x88, 0xB0, 0x77, 0x9B, 0x99, 0xA2, 0x78, 0x7E,
+    0x2D, 0xC0, 0x56, 0x7A, 0xC0, 0x25, 0x69, 0xC0, 0x19, 0xC0, 0x55, 0x51, 0x65, 0x5A, 0xC1, 0x7E,
+    0x6E, 0x7E, 0x6B, 0x6E, 0xC0, 0x69, 0x65, 0x59, 0x65, 0xC0, 0x6B, 0x66, 0x6B, 0x56, 0x67, 0x66,
+    0xC0, 0x66, 0xC0, 0x56, 0xC0, 0x7B, 0x56, 0xA2, 0x85, 0xAF, 0x92, 0x9F, 0x82, 0x99, 0x85, 0x52,
+    0x9C, 0x6A, 0x9C, 0x6A, 0xC0, 0x9D, 0x89, 0x9D, 0x99, 0xA2, 0x7A, 0xA6, 0x89, 0x66, 0x9D, 0x97,
+    0x9C, 0x97, 0xC0, 0x69, 0x7E, 0xA6, 0x87, 0xA1, 0xA8, 0xA2, 0x87, 0xA2, 0x98, 0x7E, 0x6B, 0x98,
+    0x89, 0xA5, 0x8A, 0xA3, 0x7B, 0x93, 0x6E, 0x95, 0x7D, 0xA2, 0x89, 0x9A, 0x97, 0xAA, 0x76, 0xA7,
+    0x86, 0xA4, 0x88, 0x9E, 0xB9, 0x8E, 0x87, 0xBF, 0x87, 0xA7, 0x8B, 0x94, 0x9B, 0x9C, 0xA9, 0x7F,
+    0xC1, 0x5A, 0xC0, 0x14, 0xC5, 0x56, 0x9B, 0x88, 0xC0, 0x6B, 0xC0, 0x7A, 0x6E, 0xC0, 0x51, 0x55,
+    0x66, 0xC1, 0x7A, 0x69, 0x7E, 0x7A, 0xA2, 0x88, 0xA2, 0x87, 0x7B, 0xA2, 0x87, 0xA2, 0x88, 0xA1,
+    0x8A, 0xC0, 0x1A, 0x55, 0x56, 0x55, 0x7B, 0x8E, 0x77, 0x93, 0x99, 0x5A, 0xBC, 0x82, 0xAB, 0x65,
+    0x97, 0x6D, 0x99, 0x6D, 0xA4, 0x99, 0xC0, 0x9C, 0x88, 0x64, 0xC0, 0x66, 0x69, 0x74, 0x74, 0x9C,
+    0x79, 0x53, 0xA8, 0x78, 0xA2, 0x88, 0x6B, 0x6E, 0x7A, 0x1A, 0x1D, 0xA4, 0x77, 0x15, 0x9C, 0x77,
+    0xA6, 0x95, 0xA5, 0x95, 0xA5, 0xAB, 0xAB, 0xAB, 0x95, 0xAB, 0x7A, 0xA2, 0x88, 0xC3, 0x55, 0x51,
+    0x9D, 0x98, 0x9D, 0x89, 0x9C, 0x87, 0x9C, 0x98, 0x2C, 0xC0, 0x00, 0xA2, 0x88, 0xA3, 0x89, 0xA4,
+    0x87, 0xA3, 0x99, 0x11, 0xA2, 0x99, 0xC0, 0x55, 0x66, 0x20, 0xC0, 0x7A, 0x2F, 0x7F, 0xA2, 0x77,
+    0xA2, 0x98, 0xA3, 0x89, 0xA4, 0x88, 0xA2, 0x88, 0xC1, 0x7E, 0xC0, 0x3B, 0x65, 0x6B, 0x2F, 0x27,
+    0xC0, 0x65, 0x56, 0x55, 0x51, 0x52, 0x55, 0xC0, 0x66, 0x6B, 0xA2, 0x77, 0x7F, 0xA2, 0x87, 0xA2,
+    0x88, 0x7F, 0x6D, 0xC1, 0x7A, 0x6F, 0x94, 0x89, 0x86, 0x87, 0x56, 0xC0, 0x6E, 0x9B, 0x99, 0x28,
+    0xA2, 0x88, 0x9C, 0x89, 0x7E, 0x28, 0x7F, 0x3C, 0x37, 0x41, 0xA6, 0x87, 0x66, 0x28, 0x00, 0xA2,
+    0x88, 0x28, 0x65, 0xA4, 0x88, 0xC0, 0x3C, 0xA3, 0x98, 0xA2, 0x88, 0x55, 0x3C, 0xC0, 0x7F, 0xA8,
+    0x87, 0x9B, 0x99, 0x3C, 0x61, 0x30, 0x1C, 0x28, 0x1C, 0x56, 0x28, 0x37, 0x27, 0x37, 0x9C, 0x87,
+    0x66, 0xC0, 0x04, 0xC0, 0x07, 0x9C, 0x88, 0x6E, 0x30, 0x7A, 0x6F, 0x30, 0xA3, 0x99, 0xC0, 0xA6,
+    0x87, 0x04, 0x30, 0xA4, 0x98, 0x6E, 0xA3, 0x99, 0x9C, 0x87, 0xA3, 0x89, 0xA5, 0x99, 0x99, 0x99,
+    0x1F, 0x1B, 0x32, 0x6E, 0x1B, 0x07, 0xA3, 0x98, 0x6F, 0x20, 0xA8, 0x77, 0x99, 0xA7, 0xA5, 0xA5,
+    0xA6, 0x85, 0xA5, 0x87, 0x9E, 0x7B, 0x8C, 0x7E, 0x43, 0x9C, 0x98, 0x55, 0x6E, 0xB8, 0x92, 0xB5,
+    0x90, 0x9D, 0x94, 0xA5, 0x89, 0x98, 0x8E, 0x1A, 0x30, 0x99, 0x79, 0x7F, 0x66, 0xA3, 0x88, 0xB6,
+    0x98, 0xA9, 0x78, 0x9C, 0x87, 0x7E, 0x6F, 0xA2, 0x88, 0xA2, 0x88, 0x7E, 0x5A, 0x0A, 0x69, 0xC0,
+    0x66, 0xC0, 0x55, 0x55, 0x66, 0xC0, 0x69, 0x1B, 0x20, 0x7E, 0x6E, 0x6E, 0xC1, 0x7A, 0x55, 0x69,
+    0x66, 0xC0, 0x21, 0x28, 0x67, 0x22, 0x67, 0xC0, 0x66, 0x59, 0x66, 0x66, 0x10, 0xC1, 0x64, 0xAD,
+    0x94, 0xA5, 0x81, 0x98, 0x74, 0x9D, 0x98, 0x43, 0x9A, 0x6A, 0x5F, 0x51, 0x52, 0x9C, 0x99, 0xA5,
+    0x87, 0xA2, 0x87, 0x9D, 0x99, 0x66, 0x56, 0x7B, 0xA2, 0x87, 0xA4, 0x97, 0xA2, 0x87, 0xA1, 0xA8,
+    0xA2, 0x98, 0xA2, 0x88, 0xC0, 0x98, 0x8A, 0xA1, 0x8A, 0xA7, 0x6A, 0x95, 0x7E, 0x92, 0x7D, 0xA3,
+    0x89, 0x9A, 0x88, 0xA5, 0x97, 0xAB, 0x76, 0x6E, 0xAB, 0xB8, 0x84, 0x99, 0xB7, 0x87, 0xB0, 0x79,
+    0x96, 0x9B, 0x98, 0xA9, 0x7F, 0x6B, 0x6E, 0x1B, 0x14, 0x66, 0xC0, 0x14, 0xC1, 0x0F, 0x5A, 0xC0,
+    0x9A, 0x88, 0xC0, 0x6F, 0xC0, 0x7E, 0xC1, 0x66, 0x10, 0x66, 0xC0, 0x65, 0xC1, 0x79, 0xC0, 0xA2,
+    0x87, 0xA2, 0x98, 0xA2, 0x88, 0x7E, 0xA2, 0x88, 0xA2, 0x89, 0x6F, 0xC0, 0x56, 0x55, 0x52, 0x7E,
+    0x8D, 0x88, 0x91, 0x89, 0x6E, 0xFF, 0x84, 0x4A, 0xA3, 0x76, 0x32, 0x99, 0x7C, 0xA5, 0x9A, 0x6E,
+    0x9B, 0x99, 0x64, 0xC0, 0x76, 0xC0, 0x59, 0x65, 0x99, 0x99, 0xA4, 0x88, 0xA5, 0x99, 0x6E, 0xC0,
+    0xA2, 0x88, 0x52, 0x6E, 0xA2, 0x98, 0x6E, 0x98, 0x78, 0x37, 0xA3, 0x97, 0xA3, 0x96, 0xAD, 0xAA,
+    0xA4, 0xAA, 0x96, 0xA9, 0x1F, 0x2E, 0xA2, 0x77, 0xC2, 0x66, 0x1F, 0x51, 0x50, 0x9B, 0x88, 0x9C,
+    0x98, 0x51, 0x65, 0x00, 0xC0, 0x7F, 0x14, 0x7F, 0x6E, 0xA3, 0x98, 0x6F, 0x66, 0xC0, 0xA2, 0x88,
+    0xA3, 0x88, 0x3B, 0xC0, 0x6F, 0xC1, 0xA4, 0x88, 0xA5, 0x98, 0xA5, 0x89, 0x7E, 0x6F, 0x7E, 0x6F,
+    0x2F, 0xC2, 0x27, 0xC0, 0x1B, 0x5A, 0xC0, 0x61, 0x41, 0x66, 0x55, 0xC0, 0x6B, 0xA2, 0x88, 0x6E,
+    0x7E, 0x13, 0xA2, 0x87, 0xC0, 0x5A, 0xC0, 0x18, 0x27, 0x8D, 0x89, 0x8A, 0x88, 0x6E, 0x0F, 0xA5,
+    0x88, 0x9D, 0x99, 0xA2, 0x78, 0xA2, 0x88, 0x9D, 0x98, 0x08, 0x7A, 0x69, 0x14, 0x7E, 0x28, 0x3C,
+    0x66, 0x28, 0x9D, 0x98, 0x28, 0x04, 0x51, 0xC0, 0x04, 0x30, 0x08, 0xC0, 0xA5, 0x99, 0x1C, 0x14,
+    0x28, 0x7A, 0x04, 0x6F, 0x04, 0x28, 0x37, 0x3F, 0x30, 0x1C, 0x30, 0x04, 0x0B, 0x3F, 0xA4, 0x78,
+    0x61, 0xC0, 0x9A, 0x88, 0x3F, 0x13, 0x9D, 0x98, 0x17, 0x7E, 0xA4, 0x88, 0xA2, 0x88, 0x6E, 0x1B,
+    0x04, 0xA5, 0x98, 0x9B, 0x98, 0x9C, 0x88, 0x00, 0x9C, 0x78, 0x65, 0xA5, 0x89, 0xA2, 0x88, 0xA3,
+    0x88, 0x20, 0xA3, 0x99, 0x6E, 0x9D, 0x99, 0x5A, 0x6E, 0xA4, 0x88, 0x5A, 0x99, 0x88, 0xA2, 0x78,
+    0x64, 0xA9, 0xB5, 0xAA, 0xB2, 0xA4, 0x85, 0xA5, 0x78, 0x9B, 0x8C, 0xFF, 0x31, 0x00, 0x99, 0x8C,
+    0xA3, 0x87, 0xA2, 0x88, 0xA2, 0x87, 0xA7, 0xA5, 0xFF, 0xCD, 0xC7, 0xA1, 0x93, 0xA2, 0x87, 0xA1,
+    0x9C, 0xFF, 0x83, 0x64, 0x96, 0x7F, 0x9B, 0x7A, 0x9B, 0x98, 0x7F, 0x51, 0xA4, 0x88, 0xB7, 0x98,
+    0xA5, 0x87, 0x51, 0x55, 0x69, 0xA2, 0x88, 0x6F, 0x66, 0x20, 0x7A, 0xC0, 0x14, 0x6E, 0xC0, 0x14,
+    0x19, 0xC0, 0x65, 0xC1, 0x6E, 0x6E, 0xC0, 0x7F, 0xC0, 0x69, 0x69, 0x56, 0x17, 0x7A, 0xA0, 0x8A,
+    0x6B, 0x57, 0x66, 0x66, 0xC0, 0x66, 0x55, 0x66, 0xC0, 0x6F, 0xC0, 0x10, 0x9D, 0x98, 0xAA, 0x94,
+    0xAB, 0x82, 0x98, 0x72, 0x9D, 0x87, 0x57, 0x99, 0x6B, 0x5F, 0x62, 0x51, 0x51, 0xA2, 0x98, 0xA5,
+    0x87, 0x9D, 0x88, 0x66, 0x63, 0x56, 0x7D, 0xA5, 0x98, 0xA2, 0x87, 0xA1, 0xA9, 0xA2, 0x97, 0x7F,
+    0x6F, 0x99, 0x8A, 0x52, 0xA9, 0x7A, 0x98, 0x6D, 0x8F, 0x7E, 0xA4, 0x79, 0x9B, 0x99, 0x64, 0xAE,
+    0x76, 0x68, 0xAE, 0xA8, 0x87, 0xA9, 0xA9, 0x88, 0xB8, 0x79, 0x9A, 0x9B, 0x94, 0x99, 0xA1, 0xA9,
+    0x6E, 0xC2, 0x0F, 0xC2, 0x5A, 0xC1, 0x66, 0x9C, 0x77, 0xC1, 0x6F, 0x7A, 0x6E, 0x24, 0xC0, 0x56,
+    0x65, 0xC1, 0x65, 0xC0, 0x65, 0x7A, 0x6E, 0xA1, 0xA9, 0x30, 0xA1, 0xA8, 0xA2, 0x78, 0xA2, 0x89,
+    0x7F, 0xC0, 0x6E, 0x27, 0x5B, 0xA2, 0x87, 0x8C, 0x88, 0x8E, 0x79, 0xA4, 0x86, 0xFF, 0x94, 0xAB,
+    0x9F, 0x67, 0x98, 0x5D, 0x9A, 0x7C, 0xA5, 0x89, 0x7E, 0x9B, 0x99, 0x64, 0xC0, 0x76, 0xC0, 0x6E,
+    0x41, 0x9A, 0x98, 0xA6, 0x98, 0x0E, 0x66, 0x0E, 0x7F, 0x0E, 0xA3, 0x88, 0x7F, 0x51, 0x99, 0x8A,
+    0xA5, 0x78, 0xA3, 0x87, 0x9F, 0xA6, 0xB0, 0xBA, 0xA0, 0xBA, 0x99, 0x99, 0x7E, 0x7E, 0x6F, 0x7E,
+    0xC1, 0x33, 0x27, 0x55, 0x50, 0x9B, 0x89, 0x9B, 0xA9, 0x51, 0x65, 0x56, 0x65, 0xC0, 0x6E, 0xC1,
+    0x3B, 0x7A, 0x03, 0x6E, 0x7F, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0xC0, 0x3F, 0x5A, 0x7F, 0xA4, 0x88,
+    0xA5, 0x98, 0xA4, 0x89, 0xA3, 0x88, 0x7E, 0x6F, 0x7A, 0x6E, 0x6F, 0xC4, 0x6E, 0x13, 0x55, 0x33,
+    0x2B, 0x65, 0x5A, 0x2B, 0x3F, 0xC0, 0xA2, 0x87, 0x18, 0x7E, 0xC0, 0x18, 0xC0, 0x9C, 0x88, 0x82,
+    0x89, 0x9D, 0x88, 0x7F, 0x28, 0xA7, 0x99, 0x9D, 0x88, 0x51, 0x10, 0xC1, 0xA2, 0x88, 0x99, 0x98,
+    0x28, 0x7E, 0xC0, 0xA3, 0x99, 0x55, 0x1C, 0x9C, 0x88, 0xA3, 0x89, 0x30, 0x3C, 0x9C, 0x98, 0xA8,
+    0x77, 0x04, 0x9B, 0x88, 0x62, 0x0D, 0xA2, 0x98, 0x30, 0x2C, 0x10, 0x04, 0xA3, 0x99, 0x2C, 0xA7,
+    0x99, 0x9B, 0x88, 0x27, 0x2C, 0x27, 0x33, 0x50, 0x9D, 0x99, 0x13, 0x18, 0x3F, 0xA2, 0x87, 0x5A,
+    0x1C, 0xA2, 0x98, 0xA5, 0x99, 0x0C, 0x51, 0x62, 0x5A, 0x38, 0x65, 0x6D, 0x7F, 0xA5, 0x87, 0xA3,
+    0x99, 0x1F, 0x9D, 0x88, 0x51, 0xA6, 0x88, 0x5B, 0x9D, 0x89, 0xA2, 0x89, 0xC0, 0xA3, 0x79, 0x9D,
+    0x88, 0x6B, 0x6E, 0x6F, 0x69, 0x2D, 0xC0, 0x60, 0xA8, 0xB3, 0xA8, 0xB1, 0xA4, 0x75, 0xA5, 0x87,
+    0x9F, 0x9C, 0xFF, 0x62, 0x62, 0x91, 0x8E, 0x6F, 0xA2, 0x78, 0xA2, 0x87, 0x68, 0xB9, 0xA1, 0xAF,
+    0x90, 0x9E, 0x86, 0xA5, 0x9A, 0x92, 0x7F, 0xFF, 0x4A, 0x04, 0xA2, 0x7B, 0x9A, 0x87, 0x9C, 0x99,
+    0xC0, 0x51, 0x10, 0xB5, 0x88, 0x69, 0x54, 0x69, 0x67, 0x00, 0xC0, 0x7E, 0xC0, 0x6E, 0xC1, 0x7E,
+    0x59, 0x7E, 0x5A, 0x62, 0x5A, 0x65, 0xC0, 0x6E, 0x0B, 0x10, 0xC1, 0x69, 0x10, 0x6B, 0x7B, 0x6B,
+    0x67, 0x57, 0x67, 0xC0, 0x66, 0x55, 0xC0, 0x66, 0x17, 0x7E, 0x66, 0x59, 0x9D, 0x98, 0xA6, 0x84,
+    0xAF, 0x93, 0x9A, 0x72, 0x9C, 0x76, 0x66, 0x9A, 0x6A, 0x47, 0x5A, 0x51, 0x9D, 0xA9, 0x7F, 0xA6,
+    0x86, 0x40, 0x66, 0x63, 0x55, 0x66, 0xA6, 0x87, 0xA2, 0x98, 0x7A, 0xA2, 0x97, 0x7E, 0xA2, 0x79,
+    0x9A, 0x89, 0x9B, 0x9A, 0xAA, 0x69, 0x9C, 0x7C, 0x8E, 0x6E, 0xA1, 0x7B, 0x52, 0x9B, 0x97, 0xAD,
+    0x87, 0xA3, 0x76, 0xAD, 0xB7, 0x91, 0xA9, 0x96, 0x99, 0xBF, 0x78, 0xA0, 0x8B, 0x90, 0xAA, 0x7F,
+    0x7A, 0xC0, 0x6E, 0xC2, 0x0F, 0xC1, 0x0C, 0x66, 0x69, 0x9B, 0x89, 0xC0, 0x6E, 0x6F, 0xA2, 0x88,
+    0x7A, 0xC0, 0x35, 0x61, 0x56, 0x66, 0x10, 0x15, 0x65, 0x76, 0xC0, 0x69, 0x7E, 0xA3, 0x99, 0xA2,
+    0x87, 0x7F, 0xA2, 0x88, 0xA2, 0x78, 0x7B, 0x69, 0x56, 0xC0, 0xA2, 0x78, 0x8F, 0x88, 0x8B, 0x8A,
+    0xA8, 0x86, 0xFF, 0x9D, 0x0C, 0x9B, 0x78, 0x97, 0x5E, 0x9C, 0x6B, 0xA5, 0x9A, 0x7D, 0x9B, 0x98,
+    0x55, 0x7A, 0x76, 0xC0, 0x6E, 0x9C, 0x88, 0x61, 0xA5, 0x98, 0x6E, 0xC0, 0x0E, 0x7A, 0x6E, 0xA2,
+    0x78, 0xA2, 0x88, 0x06, 0x9D, 0x79, 0xA6, 0x78, 0xA3, 0x88, 0x74, 0xB1, 0xDA, 0x9A, 0xBA, 0x9E,
+    0x86, 0xC0, 0x7A, 0x36, 0xA2, 0x77, 0x7B, 0x5A, 0x00, 0xC0, 0x2C, 0x9D, 0x98, 0x9B, 0x89, 0x9C,
+    0x97, 0x51, 0x51, 0x51, 0x51, 0xC4, 0x7A, 0x6B, 0x6E, 0xC0, 0x7E, 0x6E, 0x6B, 0x3C, 0xC0, 0x08,
+    0xC0, 0xA2, 0x89, 0xA4, 0x88, 0xA4, 0x88, 0xA3, 0x98, 0x6F, 0xC0, 0x7E, 0xA2, 0x88, 0xA2, 0x88,
+    0x6B, 0x6E, 0x7E, 0xA2, 0x88, 0x6E, 0xC0, 0x6B, 0xC0, 0x38, 0x52, 0x17, 0x0B, 0x17, 0x2B, 0x3F,
+    0x6E, 0xC2, 0x51, 0x9B, 0x88, 0x8F, 0x89, 0x92, 0x98, 0xAB, 0x89, 0x99, 0x99, 0x9B, 0x88, 0xAB,
+    0x89, 0xA2, 0x88, 0x9A, 0x98, 0xA4, 0x88, 0x38, 0x33, 0x99, 0x88, 0x7A, 0x6E, 0x6E, 0xA5, 0x99,
+    0xA2, 0x88, 0x9A, 0x88, 0x08, 0x28, 0xA6, 0x98, 0x9C, 0x88, 0x08, 0x6E, 0x30, 0xC0, 0x7E, 0x04,
+    0x7E, 0xA2, 0x78, 0x0C, 0x2C, 0x51, 0x30, 0x38, 0x30, 0x0C, 0x6B, 0x27, 0x56, 0x18, 0x04, 0x30,
+    0x04, 0x18, 0x30, 0x3F, 0x04, 0xA4, 0x87, 0x9F, 0x86, 0xA4, 0x96, 0x9D, 0x8B, 0x5B, 0x17, 0x64,
+    0xC0, 0xA5, 0x87, 0xA3, 0x87, 0xC0, 0x79, 0x6F, 0x59, 0x51, 0x7F, 0xC0, 0xA0, 0x8A, 0xA0, 0x6A,
+    0x57, 0x56, 0x56, 0x56, 0x52, 0x56, 0x7F, 0xA2, 0x77, 0x7A, 0x36, 0x2C, 0x74, 0xA9, 0xC2, 0xA8,
+    0xA2, 0xA3, 0x85, 0xA4, 0x87, 0xA1, 0x8A, 0xFF, 0xA4, 0x47, 0x18, 0x95, 0x79, 0xA2, 0x98, 0xA2,
+    0x78, 0x54, 0xAC, 0xA3, 0xFF, 0xDE, 0x26, 0x9E, 0x84, 0xA5, 0x88, 0x9B, 0x9E, 0xFF, 0x62, 0xC3,
+    0x9B, 0x8E, 0x5F, 0x9A, 0x98, 0x9C, 0x99, 0xC0, 0x9D, 0x98, 0xAE, 0x87, 0xB3, 0x87, 0x50, 0x55,
+    0x6B, 0xC0, 0x6B, 0x6E, 0xC0, 0x7E, 0xC0, 0x7D, 0x6E, 0x6D, 0xC1, 0x52, 0x69, 0x56, 0x65, 0xC0,
+    0x6E, 0x04, 0x6E, 0xC1, 0x6B, 0x67, 0x19, 0x6B, 0x67, 0x6B, 0x67, 0x66, 0x65, 0x5A, 0x1A, 0x6E,
+    0xA2, 0x88, 0xC0, 0x65, 0x50, 0x9C, 0x88, 0xA2, 0x86, 0xB3, 0x83, 0x9D, 0x82, 0x9A, 0x75, 0x66,
+    0x9C, 0x7A, 0x9C, 0x69, 0xA2, 0x78, 0x51, 0x9D, 0x99, 0x66, 0xA7, 0x97, 0x58, 0x62, 0x53, 0x55,
+    0x66, 0xA4, 0x98, 0xA3, 0x98, 0x7A, 0x7E, 0xA2, 0x97, 0xA2, 0x78, 0x9C, 0x8A, 0x98, 0x8A, 0xAA,
+    0x78, 0xA0, 0x7B, 0x8E, 0x6E, 0x9D, 0x6D, 0x6F, 0x99, 0xA8, 0xAB, 0x87, 0xA4, 0x86, 0xAB, 0x95,
+    0x9C, 0xA8, 0x8A, 0x9A, 0xBD, 0x88, 0xAA, 0x7A, 0x05, 0x6B, 0xC1, 0x7A, 0x6E, 0xC1, 0x0F, 0x0C,
+    0xC1, 0x66, 0x69, 0x9B, 0x79, 0x7A, 0xA2, 0x78, 0xA2, 0x88, 0x7F, 0x0C, 0xC0, 0x5A, 0x61, 0x51,
+    0x56, 0xC0, 0x24, 0x65, 0x66, 0x69, 0x7E, 0x66, 0xA2, 0x88, 0xA2, 0x97, 0xA2, 0x88, 0xA2, 0x88,
+    0x6F, 0xC2, 0x56, 0xA3, 0x88, 0x92, 0x88, 0x88, 0x79, 0xAD, 0x85, 0xBC, 0x73, 0x99, 0x79, 0x96,
+    0x5D, 0x9F, 0x7C, 0xA4, 0x89, 0x7D, 0x9B, 0x98, 0x55, 0x7A, 0x01, 0xC0, 0x6E, 0x9C, 0x88, 0x79,
+    0xA2, 0x88, 0x6F, 0x7E, 0xC0, 0x6E, 0xA2, 0x89, 0xA2, 0x88, 0x5A, 0x99, 0x89, 0xA2, 0x89, 0xA4,
+    0x67, 0xA2, 0x88, 0xA3, 0xA8, 0xB0, 0xC9, 0x95, 0xDA, 0x6D, 0xC0, 0x7A, 0x6E, 0x7F, 0xA2, 0x78,
+    0x7E, 0xC0, 0x55, 0x51, 0x9C, 0x88, 0x9B, 0x98, 0x9C, 0x88, 0x60, 0x9C, 0x89, 0x41, 0x61, 0x55,
+    0xC2, 0x6F, 0x1B, 0xC1, 0x6E, 0x7A, 0x6E, 0xC1, 0x23, 0xC0, 0x28, 0xA2, 0x88, 0xA2, 0x89, 0x6E,
+    0xA2, 0x88, 0xA3, 0x99, 0xA3, 0x89, 0xC0, 0x7E, 0xA2, 0x78, 0x7A, 0x6F, 0x7E, 0x6F, 0xA2, 0x87,
+    0x6B, 0xA2, 0x87, 0x7F, 0xC1, 0x10, 0x9D, 0x99, 0x55, 0x03, 0xA2, 0x88, 0x65, 0x37, 0xC0, 0x03,
+    0x37, 0x95, 0x79, 0x91, 0x88, 0xA4, 0x88, 0x98, 0x99, 0xC0, 0xAC, 0x88, 0x9D, 0x88, 0x9D, 0x99,
+    0x24, 0xA3, 0x88, 0x24, 0x9D, 0x88, 0x7F, 0x9C, 0x97, 0x56, 0xC0, 0x18, 0xA4, 0x88, 0x9A, 0x88,
+    0x18, 0xA8, 0x88, 0xC0, 0x99, 0x99, 0x98, 0x77, 0x1C, 0xA5, 0x99, 0x1C, 0xA3, 0x99, 0x04, 0x3F,
+    0x55, 0x7A, 0xA3, 0x88, 0xC1, 0x18, 0x30, 0x04, 0x20, 0x5A, 0xC0, 0xA4, 0x99, 0x6E, 0xA6, 0x88,
+    0xA5, 0x88, 0xA7, 0x99, 0x40, 0x7F, 0x9D, 0x9A, 0xA5, 0x86, 0xA6, 0x80, 0x9B, 0xA4, 0x95, 0x7E,
+    0x98, 0x6E, 0xA2, 0x96, 0xA8, 0x94, 0x6C, 0x9D, 0x99, 0x54, 0x66, 0x65, 0x67, 0x5E, 0x9C, 0x99,
+    0x6E, 0x6F, 0x53, 0x9F, 0x7B, 0xA1, 0x7A, 0x57, 0x56, 0x6B, 0xC0, 0x9D, 0x99, 0x5B, 0xA2, 0x87,
+    0x6B, 0x36, 0x62, 0x9F, 0xA6, 0xAB, 0xC2, 0xA7, 0xB2, 0xA2, 0x76, 0xA3, 0x88, 0x7F, 0xFF, 0xA4,
+    0x05, 0xFF, 0x62, 0x67, 0x42, 0x96, 0x78, 0x6F, 0xA2, 0x86, 0x78, 0xFF, 0xBD, 0x26, 0xA7, 0x92,
+    0x6D, 0xA3, 0x8B, 0xFF, 0x8B, 0xC4, 0xFF, 0x52, 0x25, 0xA1, 0x7B, 0x69, 0x9A, 0x88, 0x9C, 0x99,
+    0x6E, 0x9D, 0x98, 0xB2, 0x87, 0xAE, 0x86, 0x40, 0x6B, 0x66, 0x6B, 0x00, 0xC0, 0xA2, 0x88, 0xA2,
+    0x87, 0x6D, 0x7E, 0x6D, 0xC1, 0x52, 0x51, 0x56, 0x65, 0xC0, 0x6E, 0x04, 0x6E, 0xC1, 0x6B, 0x12,
+    0x19, 0x9F, 0x9B, 0x6B, 0x66, 0x6B, 0x66, 0x69, 0x66, 0x24, 0xA2, 0x98, 0xA2, 0x88, 0x55, 0x51,
+    0x9D, 0x98, 0x9C, 0x88, 0x9D, 0x87, 0xB5, 0x94, 0xA2, 0x81, 0x99, 0x74, 0x52, 0x42, 0x9A, 0x6A,
+    0xA2, 0x78, 0x51, 0x52, 0x61, 0xA5, 0x98, 0xA3, 0x86, 0x51, 0x16, 0x56, 0x71, 0xA4, 0x88, 0xA3,
+    0xA8, 0x6E, 0x7A, 0xA3, 0x98, 0x6E, 0x53, 0x97, 0x9A, 0xA8, 0x77, 0xA3, 0x7B, 0xFF, 0x4B, 0x28,
+    0x9A, 0x6C, 0xA2, 0x89, 0x98, 0x98, 0xA9, 0x87, 0xA6, 0x86, 0xA7, 0x95, 0xA8, 0xA8, 0x82, 0x9A,
+    0xB6, 0x77, 0xB2, 0x8A, 0x8F, 0xAC, 0x9C, 0x98, 0x6B, 0x6E, 0xC0, 0x7A, 0xC1, 0x0C, 0x00, 0xC1,
+    0x07, 0x0C, 0x9A, 0x78, 0x7F, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x87, 0x6B, 0x6E, 0x18, 0x55, 0x30,
+    0x55, 0x1C, 0xC0, 0x7E, 0x65, 0xC0, 0x7A, 0x6E, 0x7A, 0x7E, 0xA3, 0x88, 0xA2, 0x88, 0x7F, 0xC2,
+    0x1F, 0xA3, 0x88, 0x94, 0x88, 0x87, 0x89, 0xB2, 0x74, 0xB7, 0x74, 0x97, 0x7A, 0x96, 0x5D, 0xA1,
+    0x7B, 0xA3, 0x99, 0x7E, 0x9B, 0x98, 0x55, 0x76, 0x7A, 0x06, 0x59, 0x9B, 0xAA, 0xA3, 0x97, 0x66,
+    0x2E, 0xA2, 0x88, 0xC0, 0x7E, 0xA2, 0x79, 0xA4, 0x78, 0x9B, 0x99, 0x9B, 0x79, 0x0F, 0xA4, 0x68,
+    0xC0, 0xA8, 0xB7, 0xAC, 0xC8, 0x96, 0xB9, 0x7E, 0x38, 0x3B, 0x7F, 0xA2, 0x88, 0xA2, 0x88, 0xA2,
+    0x78, 0x7A, 0x55, 0x9C, 0x88, 0x9C, 0x87, 0x9A, 0x88, 0x9C, 0x88, 0x9C, 0x98, 0x9D, 0x88, 0x9D,
+    0x99, 0x55, 0x66, 0x0C, 0xC0, 0x1B, 0x6E, 0x6E, 0xC0, 0x6B, 0xC0, 0x25, 0x20, 0xC1, 0x69, 0x66,
+    0xC0, 0x7F, 0xC0, 0x6F, 0x7E, 0xA2, 0x78, 0xA2, 0x88, 0x7F, 0x6E, 0x7F, 0x6F, 0xA2, 0x88, 0x7E,
+    0xA2, 0x78, 0x7E, 0x7F, 0xA3, 0x88, 0x6B, 0x28, 0x6F, 0x7A, 0x9D, 0x88, 0x9C, 0x88, 0x27, 0xA2,
+    0x88, 0xC1, 0x6F, 0xC0, 0x51, 0x95, 0x88, 0x95, 0x88, 0xA3, 0x89, 0x7A, 0x9C, 0x89, 0xAA, 0x78,
+    0x9C, 0x98, 0x9B, 0x88, 0xA6, 0x88, 0xA2, 0x88, 0xC0, 0x99, 0x99, 0xA5, 0x98, 0x99, 0x88, 0x51,
+    0xA7, 0x98, 0x0C, 0x9B, 0x89, 0x34, 0xA8, 0x88, 0x0C, 0x04, 0xA2, 0x88, 0xA4, 0x98, 0xA3, 0x88,
+    0x56, 0x03, 0x1C, 0xA4, 0x89, 0x27, 0x3B, 0x33, 0xA4, 0x87, 0x7F, 0x56, 0x55, 0x2C, 0x51, 0x5A,
+    0xA3, 0x87, 0xA2, 0x89, 0xA3, 0x89, 0xA3, 0x98, 0xA2, 0x99, 0xA2, 0x79, 0x7E, 0xA2, 0x88, 0x66,
+    0x59, 0x69, 0xA7, 0xA0, 0x99, 0x91, 0x96, 0x8D, 0xFF, 0x6B, 0x27, 0x9D, 0x79, 0xA5, 0xA4, 0xA6,
+    0x83, 0x61, 0x62, 0x55, 0xC0, 0x66, 0xC0, 0x56, 0x9D, 0x8A, 0xA2, 0x77, 0x57, 0x9C, 0x7B, 0xA4,
+    0x6A, 0xA0, 0x8A, 0x52, 0x5A, 0x3E, 0x6B, 0x56, 0x69, 0x3D, 0xC0, 0x29, 0xA1, 0xA5, 0xAB, 0xD2,
+    0xA6, 0xA2, 0x6D, 0xA3, 0x98, 0x56, 0xA0, 0x8D, 0xFF, 0x5A, 0x44, 0x9F, 0x7C, 0x7B, 0x99, 0x88,
+    0x51, 0x6C, 0xB4, 0xA0, 0xB4, 0x80, 0x9E, 0x85, 0xA5, 0x9A, 0x97, 0x8F, 0xFF, 0x5A, 0x64, 0x30,
+    0x6E, 0x55, 0x9A, 0x88, 0x9D, 0x99, 0xC0, 0x69, 0xB2, 0x87, 0xAC, 0x76, 0x51, 0x67, 0xC0, 0x65,
+    0x0C, 0xA2, 0x87, 0xA3, 0x87, 0xA2, 0x87, 0x7D, 0x69, 0xC0, 0x5A, 0x9D, 0x9A, 0x51, 0x51, 0x66,
+    0xC0, 0x35, 0x6B, 0x7E, 0x09, 0xC0, 0x67, 0x19, 0x67, 0x22, 0x66, 0x6B, 0xC0, 0x66, 0xC0, 0x7E,
+    0xA3, 0x88, 0xA2, 0x89, 0x7A, 0x50, 0x51, 0x14, 0x9B, 0x88, 0x98, 0x87, 0xB3, 0x85, 0xAB, 0x92,
+    0x98, 0x64, 0x9D, 0x98, 0x56, 0x9A, 0x6A, 0x5F, 0x55, 0x0E, 0x9D, 0x99, 0xA3, 0x98, 0xA6, 0x86,
+    0x9D, 0x89, 0x56, 0x11, 0x61, 0xA4, 0x98, 0xA4, 0x88, 0x69, 0x7A, 0xA3, 0x98, 0x7E, 0x5B, 0x97,
+    0x9A, 0xA4, 0x77, 0xA7, 0x7B, 0xFF, 0x63, 0xA9, 0x96, 0x5C, 0xA5, 0x8A, 0x97, 0xA9, 0xA4, 0x87,
+    0xA8, 0x76, 0xA5, 0x95, 0xAE, 0xA7, 0x83, 0xAB, 0xA9, 0x89, 0xBC, 0x89, 0x94, 0x9A, 0x94, 0x9A,
+    0xA2, 0x87, 0xC0, 0x6B, 0x6E, 0x07, 0x00, 0xC1, 0x66, 0x00, 0x07, 0x0C, 0x9B, 0x88, 0x6F, 0xA2,
+    0x98, 0xA3, 0x88, 0x6B, 0x6E, 0x7A, 0xC0, 0x0C, 0x41, 0x66, 0x21, 0x66, 0x7E, 0xC0, 0x7A, 0x69,
+    0xC0, 0x7A, 0xC0, 0xA2, 0x87, 0x7F, 0x7F, 0x6E, 0x7F, 0x6E, 0x1F, 0xA3, 0x88, 0x96, 0x88, 0x85,
+    0x89, 0xB8, 0x73, 0xB0, 0x75, 0x97, 0x5B, 0x95, 0x7D, 0xA3, 0x7B, 0xA2, 0x98, 0xA2, 0x87, 0x9B,
+    0x98, 0x65, 0x66, 0x7A, 0x6E, 0x55, 0x9D, 0x99, 0x2E, 0x56, 0xA2, 0x87, 0x7F, 0x6E, 0xA2, 0x88,
+    0x6F, 0xA1, 0x9A, 0x98, 0x79, 0x6E, 0xA4, 0x78, 0xA5, 0x68, 0x60, 0xAE, 0xC9, 0xA3, 0xD8, 0x99,
+    0xB9, 0x38, 0xC0, 0x7F, 0xA2, 0x98, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0x06, 0x55, 0x9C, 0x87, 0x13,
+    0x9B, 0x88, 0x9B, 0x98, 0x9B, 0x98, 0x9D, 0x99, 0x55, 0xC1, 0x1B, 0x6F, 0x34, 0x6F, 0x7E, 0x6E,
+    0x56, 0xC1, 0x65, 0xC1, 0x65, 0x52, 0x65, 0xC2, 0x7F, 0x6E, 0xC2, 0x7F, 0xA2, 0x88, 0xA2, 0x88,
+    0x6F, 0xA2, 0x87, 0x6B, 0x6E, 0xA3, 0x99, 0xA2, 0x88, 0x5A, 0x66, 0x69, 0x9D, 0x99, 0x9D, 0x88,
+    0x51, 0x2B, 0x3F, 0x6F, 0xC0, 0x3F, 0x2C, 0x94, 0x89, 0x9A, 0x77, 0x97, 0x99, 0xA2, 0x88, 0xA8,
+    0x89, 0xA3, 0x88, 0x9D, 0x89, 0x9D, 0x98, 0x08, 0x69, 0x62, 0x51, 0x69, 0xA4, 0x88, 0x51, 0xA4,
+    0x88, 0x66, 0x00, 0xC0, 0xA3, 0x88, 0xA2, 0x88, 0x7F, 0x7F, 0xC0, 0x6E, 0x7A, 0x9D, 0x89, 0x3C,
+    0x38, 0xC0, 0x33, 0x7E, 0x38, 0x51, 0x10, 0x65, 0x37, 0x2B, 0x59, 0x5E, 0x7F, 0xA3, 0x99, 0xA7,
+    0x89, 0xA3, 0x99, 0x7F, 0xA3, 0x89, 0x7E, 0x6F, 0x7D, 0x55, 0xA7, 0x92, 0xFF, 0xE6, 0x06, 0x97,
+    0x98, 0xFF, 0x83, 0xC4, 0x9A, 0x5E, 0x60, 0xA8, 0xA2, 0x29, 0x9D, 0x99, 0x51, 0x66, 0x7E, 0x37,
+    0x5A, 0x9D, 0x8A, 0xC0, 0xA0, 0x7A, 0x99, 0x7C, 0xA6, 0x6A, 0xA1, 0x9A, 0x55, 0x56, 0xC0, 0x7B,
+    0xC0, 0x55, 0x6B, 0xC0, 0x51, 0xA3, 0xA4, 0xAB, 0xD2, 0xA3, 0xB3, 0x5E, 0xA5, 0x98, 0x51, 0xA3,
+    0x9B, 0xFF, 0x7B, 0x46, 0x96, 0x7D, 0x9D, 0x9A, 0xA4, 0x77, 0x9C, 0x89, 0x9D, 0x87, 0xA9, 0xA3,
+    0xFF, 0xD5, 0xC6, 0xA1, 0x84, 0xA4, 0x87, 0xA2, 0x8C, 0xFF, 0x93, 0xE5, 0x25, 0xA1, 0x8A, 0x5A,
+    0x5A, 0x99, 0x98, 0x9D, 0x9A, 0x79, 0xA3, 0x88, 0xB6, 0x76, 0xA4, 0x87, 0x51, 0xC0, 0x6B, 0xA2,
+    0x88, 0xA2, 0x87, 0xA3, 0x86, 0xA2, 0x87, 0x7E, 0x69, 0x69, 0x56, 0x52, 0x9D, 0x99, 0x51, 0x52,
+    0xC0, 0x6B, 0x6E, 0x7E, 0xC0, 0x6F, 0x67, 0x19, 0x67, 0x1D, 0x6B, 0xC1, 0x66, 0x24, 0xA2, 0x88,
+    0xA3, 0x98, 0x7F, 0x69, 0x9D, 0x98, 0x9D, 0x99, 0x9D, 0x88, 0x9A, 0x88, 0x98, 0x87, 0xAD, 0x86,
+    0xB4, 0x82, 0x99, 0x72, 0x9D, 0x98, 0x57, 0x9A, 0x69, 0x4B, 0x65, 0x56, 0x9D, 0x99, 0x7E, 0xA7,
+    0x98, 0x50, 0x52, 0x56, 0x61, 0xA3, 0xA9, 0xA4, 0x88, 0x69, 0x7E, 0xA1, 0xA8, 0xA2, 0x88, 0xA1,
+    0x8A, 0x98, 0x89, 0x69, 0xA9, 0x7A, 0x95, 0x6F, 0x92, 0x5E, 0xA6, 0x7A, 0x9A, 0xA8, 0x69, 0xA5,
+    0x87, 0xA5, 0x86, 0xB2, 0x95, 0x8A, 0xBA, 0x99, 0x8A, 0x82, 0x78, 0x9A, 0x9B, 0x90, 0xA9, 0xA2,
+    0x88, 0x6B, 0x00, 0xC1, 0x66, 0xC1, 0x00, 0xC0, 0x07, 0x6E, 0x9B, 0x88, 0xA2, 0x88, 0xA3, 0x88,
+    0x7F, 0x7F, 0xC1, 0x66, 0x0C, 0x51, 0xC0, 0x56, 0x65, 0xC0, 0x7A, 0xC1, 0x7E, 0xC0, 0x65, 0x7F,
+    0xA2, 0x77, 0x7A, 0xC0, 0x7F, 0x6E, 0xC0, 0xA2, 0x88, 0x23, 0x86, 0x87, 0xBB, 0x74, 0xAB, 0x65,
+    0x96, 0x6C, 0x96, 0x6C, 0xA4, 0x7A, 0xA2, 0x78, 0xA1, 0xA8, 0x9B, 0x98, 0x3E, 0xC0, 0x7A, 0x6E,
+    0x55, 0x9D, 0x98, 0xA3, 0x98, 0x52, 0x33, 0x7F, 0xA2, 0x77, 0xA3, 0x99, 0x5B, 0x9D, 0x89, 0x9A,
+    0x89, 0xA4, 0x89, 0x27, 0xA5, 0x77, 0x9D, 0xA9, 0xB2, 0xC8, 0x9C, 0xC8, 0x9C, 0x97, 0x6F, 0x6E,
+    0xA2, 0x98, 0xA3, 0x99, 0xA2, 0x88, 0xC1, 0x55, 0x9D, 0x99, 0x9C, 0x87, 0x9A, 0x88, 0x9B, 0x89,
+    0x99, 0xA8, 0x9D, 0x98, 0x56, 0x55, 0xC0, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x78, 0x7F, 0xA2, 0x78,
+    0x6E, 0x25, 0xC1, 0x56, 0x69, 0x66, 0xC0, 0x05, 0x66, 0x55, 0xC0, 0x65, 0x20, 0xC1, 0x69, 0x66,
+    0xC0, 0x7E, 0x6F, 0x7F, 0xA2, 0x88, 0xC1, 0x6E, 0x7F, 0xA2, 0x88, 0x04, 0xC0, 0x66, 0x51, 0x55,
+    0x51, 0x37, 0x6B, 0x03, 0x0B, 0x6F, 0xA8, 0x88, 0x34, 0x95, 0x89, 0xC0, 0xA5, 0x89, 0xA2, 0x98,
+    0x9D, 0x89, 0x9C, 0x88, 0x6E, 0xA2, 0x88, 0x37, 0x51, 0x0F, 0x28, 0x13, 0x40, 0x00, 0xA9, 0x99,
+    0xA2, 0x78, 0x9D, 0x99, 0x65, 0x51, 0x56, 0x51, 0x51, 0xC1, 0x1B, 0xC0, 0x6E, 0x7A, 0xC0, 0x6E,
+    0xC0, 0x20, 0x65, 0x66, 0x5A, 0x11, 0x05, 0x6E, 0x11, 0x7E, 0xA8, 0x78, 0x3D, 0xA1, 0xA9, 0xA3,
+    0x88, 0x7F, 0x6E, 0x7E, 0x3C, 0xA4, 0x94, 0xFF, 0xEE, 0x49, 0x97, 0x94, 0x9A, 0x6D, 0xFF, 0x63,
+    0x66, 0x9A, 0x7C, 0xA1, 0xA5, 0xA9, 0xA3, 0x7C, 0x9D, 0x99, 0x62, 0x6E, 0xC0, 0x5A, 0x9D, 0x8A,
+    0x57, 0x43, 0x99, 0x7C, 0xA6, 0x7A, 0xA3, 0x89, 0x66, 0xC0, 0x55, 0x02, 0x7A, 0x02, 0xC0, 0x52,
+    0x65, 0xA4, 0xA4, 0xAB, 0xC1, 0xA3, 0xB3, 0x56, 0xA6, 0x87, 0x50, 0xA4, 0x8A, 0xFF, 0x9C, 0x27,
+    0x0C, 0x9D, 0x89, 0x9B, 0x88, 0xA4, 0x88, 0x6E, 0x9B, 0x96, 0xFF, 0xB4, 0xE6, 0xA9, 0x92, 0x68,
+    0xA5, 0x89, 0xFF, 0xDE, 0x0A, 0xFF, 0x8B, 0xA8, 0x25, 0xA1, 0x7A, 0x30, 0x21, 0x9A, 0x88, 0x66,
+    0x55, 0xAB, 0x87, 0xB2, 0x76, 0x66, 0x66, 0x7E, 0xA2, 0x88, 0xA3, 0x87, 0xA2, 0x87, 0x0D, 0x6E,
+    0x6D, 0x66, 0x66, 0x51, 0x9D, 0x8A, 0x9D, 0x99, 0x52, 0x66, 0x37, 0x6E, 0xC0, 0x04, 0x6B, 0x6B,
+    0x14, 0x6B, 0x67, 0x6B, 0xC0, 0x66, 0xC0, 0x2C, 0xA2, 0x89, 0xA2, 0x88, 0x7E, 0x65, 0x9D, 0x98,
+    0x9D, 0x88, 0x9C, 0x88, 0x99, 0x88, 0x99, 0x98, 0xA7, 0x86, 0xBB, 0x94, 0x9B, 0x72, 0x9C, 0x86,
+    0x5B, 0x9B, 0x79, 0x9D, 0x7A, 0x6F, 0x55, 0x9D, 0x99, 0x66, 0xA8, 0x86, 0x65, 0x51, 0x53, 0x61,
+    0xA3, 0x99, 0xA5, 0x98, 0x65, 0x7E, 0x7E, 0xA2, 0x98, 0xA2, 0x78, 0x9A, 0x89, 0x9C, 0x89, 0xAA,
+    0x78, 0x99, 0x7F, 0x8F, 0x5F, 0xA4, 0x7B, 0x9D, 0xA8, 0x2D, 0xA5, 0x87, 0xA2, 0x86, 0xB2, 0x85,
+    0x95, 0xB9, 0x8D, 0x9B, 0x81, 0x89, 0xA3, 0x9A, 0x8D, 0xAB, 0x7E, 0xC1, 0x66, 0xC3, 0x00, 0xC0,
+    0x6B, 0x7E, 0x9B, 0x78, 0xA2, 0x88, 0xA3, 0x88, 0x7F, 0x6F, 0x7A, 0x66, 0x69, 0x56, 0x00, 0x5B,
+    0x38, 0x66, 0xC0, 0x69, 0x66, 0x2C, 0x7A, 0xC1, 0x7E, 0x7F, 0x6E, 0x65, 0xC0, 0x0B, 0x3F, 0xA2,
+    0x88, 0x9C, 0x88, 0x8A, 0x77, 0xBC, 0x73, 0xA3, 0x76, 0x97, 0x5C, 0x97, 0x6E, 0xA4, 0x8A, 0xA2,
+    0x77, 0x7E, 0x9B, 0xA8, 0x2D, 0x6F, 0x7E, 0xC0, 0x69, 0x9D, 0x88, 0xA2, 0x98, 0x6E, 0x3A, 0x7E,
+    0xA4, 0x78, 0xA2, 0x88, 0x57, 0x99, 0x89, 0x66, 0xA3, 0x89, 0xA3, 0x79, 0x00, 0xA3, 0xA8, 0xB1,
+    0xC8, 0x98, 0xC8, 0x51, 0xC0, 0x3D, 0xA4, 0x98, 0xA3, 0x99, 0x6E, 0x0B, 0x65, 0x55, 0x9C, 0x88,
+    0x13, 0x9B, 0x88, 0x9A, 0x98, 0x9A, 0x98, 0x59, 0xC0, 0x5A, 0x7E, 0xA2, 0x89, 0xA2, 0x88, 0xA2,
+    0x78, 0xA2, 0x88, 0x6F, 0xC0, 0x5A, 0x66, 0x69, 0x57, 0xC0, 0x69, 0x66, 0xC0, 0x65, 0x66, 0x65,
+    0xC0, 0x55, 0xC0, 0x65, 0x20, 0x65, 0xC2, 0x7E, 0x6F, 0xC0, 0x6E, 0xC0, 0x7B, 0xA2, 0x88, 0xA2,
+    0x88, 0xC1, 0x0B, 0x66, 0x37, 0x51, 0xC0, 0x28, 0x37, 0xA2, 0x78, 0xA3, 0x98, 0x9A, 0x89, 0x97,
+    0x88, 0x9D, 0x89, 0xA8, 0x88, 0x6B, 0x9C, 0x87, 0xA3, 0x89, 0x51, 0x9D, 0x99, 0xC0, 0x51, 0xA4,
+    0x88, 0xA2, 0x88, 0xA3, 0x98, 0xAB, 0x88, 0xA5, 0x99, 0x41, 0x9D, 0x99, 0x56, 0xC0, 0x65, 0x56,
+    0x65, 0x0C, 0xC4, 0x7A, 0x0C, 0x6E, 0xC0, 0x0C, 0xC2, 0x11, 0xC1, 0x0C, 0x11, 0xA3, 0x89, 0xA9,
+    0x98, 0xA7, 0x99, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0xC0, 0x62, 0xA2, 0x86, 0xFF, 0xEE, 0x8E, 0x98,
+    0x90, 0x9A, 0x8A, 0xFF, 0x83, 0xE5, 0x99, 0x6F, 0x9C, 0x79, 0xA4, 0xA3, 0xA9, 0xA3, 0x9D, 0x97,
+    0x9D, 0xAA, 0x6E, 0x5A, 0xC0, 0x53, 0x9D, 0x8A, 0x9C, 0x6B, 0x9C, 0x6B, 0xA3, 0x9B, 0xA5, 0x88,
+    0xC1, 0x55, 0x66, 0x7F, 0x5A, 0x66, 0x56, 0x64, 0xA6, 0xA3, 0xA9, 0xD2, 0x3E, 0x56, 0xA6, 0x87,
+    0x50, 0xA3, 0x99, 0xFF, 0xB4, 0xC7, 0xFF, 0x6A, 0xE9, 0x53, 0x9D, 0x88, 0x9B, 0x88, 0x6F, 0x7D,
+    0xAF, 0xA0, 0xB3, 0x90, 0x9E, 0x85, 0xA5, 0x89, 0xA1, 0x9D, 0xFF, 0xE6, 0x0F, 0x8B, 0x7E, 0x99,
+    0x8B, 0x45, 0x30, 0x51, 0x9B, 0x88, 0x66, 0xC0, 0xAC, 0x76, 0xAF, 0x87, 0x7F, 0xC0, 0xA2, 0x87,
+    0xA2, 0x87, 0xA3, 0x87, 0xA2, 0x87, 0x7D, 0x59, 0xC0, 0x66, 0x9D, 0x9A, 0x9D, 0x89, 0x9D, 0x9A,
+    0x9D, 0x99, 0xC0, 0x6F, 0xC0, 0x6E, 0x7A, 0xC0, 0x6B, 0xA0, 0x8A, 0x67, 0x6B, 0xC1, 0x66, 0xC0,
+    0xA4, 0x88, 0xA2, 0x88, 0x7E, 0xC0, 0x9D, 0x98, 0x50, 0x9C, 0x88, 0x98, 0x88, 0x99, 0x98, 0x41,
+    0xA3, 0x96, 0xBE, 0x74, 0x9F, 0x83, 0x9B, 0x85, 0x26, 0x9D, 0x79, 0x9B, 0x7A, 0xA2, 0x88, 0x41,
+    0x62, 0x51, 0x2F, 0xA2, 0x86, 0x9D, 0x99, 0x67, 0x51, 0x7F, 0xA6, 0x88, 0x65, 0xA1, 0xA7, 0x7F,
+    0xA2, 0x97, 0x6F, 0x9C, 0x8A, 0x9A, 0x89, 0xAA, 0x77, 0x9D, 0x7E, 0x8E, 0x5F, 0xA2, 0x6B, 0x77,
+    0x9B, 0x97, 0xA7, 0x87, 0x9E, 0x76, 0xB1, 0x95, 0xA1, 0xA8, 0x84, 0x9B, 0xBC, 0x78, 0xAD, 0x9A,
+    0x8B, 0xBC, 0x9D, 0x99, 0x7E, 0xC6, 0x6E, 0x6B, 0x7E, 0x9B, 0x78, 0xA2, 0x88, 0xA2, 0x88, 0x6F,
+    0x0C, 0xC5, 0x07, 0x3B, 0x5A, 0x65, 0x66, 0x2C, 0x7A, 0xC0, 0x7F, 0x6E, 0x7E, 0xC4, 0x6E, 0x9D,
+    0x99, 0x8F, 0x86, 0xBA, 0x83, 0x9E, 0x46, 0x96, 0x5D, 0x99, 0x8E, 0xA5, 0x79, 0x6E, 0x7E, 0x9B,
+    0xB9, 0x9C, 0x97, 0x6B, 0xC0, 0xA3, 0x87, 0x65, 0x9D, 0x99, 0x3A, 0x7E, 0x6B, 0xA2, 0x77, 0xA4,
+    0x89, 0x6F, 0x1E, 0x9B, 0x89, 0xA2, 0x88, 0xA2, 0x89, 0x33, 0x6D, 0xAB, 0xB8, 0xA8, 0xD9, 0x99,
+    0xB7, 0x5A, 0x66, 0x7F, 0xA4, 0x87, 0xA2, 0x88, 0x7B, 0x3F, 0x56, 0x9D, 0x98, 0x9B, 0x88, 0x9A,
+    0x88, 0x99, 0x88, 0x9B, 0x99, 0x65, 0xC0, 0x2C, 0xA2, 0x77, 0x7F, 0x19, 0xA2, 0x79, 0xA2, 0x88,
+    0x6F, 0x6F, 0x69, 0x11, 0x5A, 0x65, 0x56, 0xC3, 0x66, 0x69, 0x66, 0x66, 0x65, 0x5A, 0x65, 0x65,
+    0x66, 0x61, 0x20, 0x66, 0x69, 0xC4, 0x6E, 0x7F, 0xA2, 0x88, 0xC0, 0x66, 0x51, 0x14, 0xC1, 0x19,
+    0x28, 0x37, 0x08, 0xA2, 0x88, 0x56, 0x9B, 0x89, 0x66, 0x65, 0x99, 0x89, 0xA3, 0x88, 0x51, 0xC0,
+    0xA6, 0x88, 0xA4, 0x89, 0xA4, 0x88, 0x7E, 0xA4, 0x88, 0xA2, 0x88, 0x17, 0x65, 0x5B, 0x52, 0x79,
+    0x5A, 0x66, 0x27, 0xC1, 0x65, 0xC1, 0x27, 0xC3, 0x69, 0xC0, 0x1B, 0x20, 0xC2, 0x55, 0x20, 0x31,
+    0xA3, 0x98, 0xA6, 0x99, 0x00, 0xA4, 0x88, 0xA2, 0x88, 0xC1, 0x69, 0xA8, 0x81, 0x99, 0xB0, 0x99,
+    0x97, 0x9D, 0x7D, 0x98, 0x4E, 0x9B, 0x7F, 0x9C, 0x87, 0xA7, 0xB3, 0xA5, 0x93, 0x61, 0x56, 0xC1,
+    0x52, 0x9D, 0x8B, 0x9B, 0x6C, 0x9D, 0x7C, 0xA2, 0x89, 0xA5, 0x88, 0x7F, 0xC0, 0x65, 0x56, 0x6F,
+    0x66, 0x55, 0x6F, 0x2A, 0xA7, 0xB3, 0xA7, 0xC2, 0xA3, 0xA5, 0x5A, 0xA4, 0x97, 0x69, 0xA2, 0x78,
+    0xA0, 0x8D, 0xFF, 0x73, 0x28, 0x9E, 0x7B, 0x66, 0x9D, 0x88, 0x9B, 0x88, 0x9D, 0x98, 0xAA, 0x93,
+    0xB9, 0xA0, 0xA0, 0x82, 0xA4, 0x78, 0xA3, 0x9A, 0xA1, 0x9F, 0xFF, 0xDD, 0xD1, 0x17, 0x1D, 0x9B,
+    0x99, 0x35, 0x51, 0x9A, 0x99, 0xC0, 0x6D, 0xA8, 0x77, 0xAD, 0x98, 0xA8, 0x77, 0x65, 0xA2, 0x87,
+    0xA3, 0x87, 0xA2, 0x87, 0x69, 0x69, 0xC0, 0x66, 0x52, 0x9D, 0x8A, 0x9D, 0x99, 0x9D, 0x9A, 0xC1,
+    0x6E, 0xC0, 0x6E, 0x7B, 0x67, 0x6B, 0x6B, 0x67, 0xC2, 0xA3, 0x99, 0xA3, 0x88, 0x28, 0xC0, 0x9D,
+    0x99, 0x50, 0x9C, 0x98, 0x9A, 0x87, 0x97, 0x89, 0x9B, 0x98, 0x6E, 0x69, 0xBB, 0x85, 0xA9, 0x82,
+    0x99, 0x85, 0x45, 0x52, 0x99, 0x7A, 0xA2, 0x78, 0x51, 0x56, 0x9D, 0x99, 0x1B, 0xA5, 0x97, 0x9D,
+    0x98, 0x1E, 0x66, 0xC0, 0xA5, 0x98, 0x7A, 0x6D, 0xA1, 0xA9, 0xA2, 0x97, 0x6F, 0x53, 0x98, 0x89,
+    0xA9, 0x88, 0xA0, 0x6C, 0xFF, 0x4B, 0x29, 0x9F, 0x6C, 0xA2, 0x99, 0x99, 0x98, 0xA4, 0x86, 0x9E,
+    0x76, 0xAF, 0x96, 0xA9, 0xA6, 0x84, 0x9B, 0xB0, 0x89, 0xB7, 0x89, 0x8E, 0xAC, 0x97, 0x99, 0xA2,
+    0x88, 0xC0, 0x7A, 0xC5, 0x6E, 0x7B, 0x9C, 0x67, 0x6F, 0xA2, 0x88, 0x7E, 0xC1, 0x7F, 0xC3, 0x00,
+    0xC0, 0x38, 0x65, 0x66, 0x7E, 0x6E, 0x3B, 0x7E, 0x7E, 0x6E, 0xC0, 0x0B, 0xC2, 0x65, 0x5A, 0x9A,
+    0x85, 0xB2, 0x73, 0x98, 0x58, 0x95, 0x6E, 0x9D, 0x7C, 0xA4, 0x79, 0x6E, 0xA1, 0xA8, 0x9B, 0xA9,
+    0x9A, 0x97, 0x7F, 0x6E, 0xA2, 0x88, 0x65, 0x55, 0xA3, 0x88, 0x6B, 0xA2, 0x88, 0xA2, 0x88, 0xA3,
+    0x89, 0x56, 0x98, 0x88, 0xC0, 0xA2, 0x79, 0xA2, 0x78, 0xA4, 0x78, 0x74, 0xB1, 0xD9, 0x9E, 0xB7,
+    0x9B, 0x98, 0xC1, 0x7F, 0xA3, 0x98, 0x7B, 0x6E, 0xC0, 0x51, 0x9C, 0x87, 0x99, 0x88, 0x98, 0x98,
+    0x9C, 0x88, 0x65, 0xA2, 0x78, 0x6F, 0xA2, 0x88, 0xA2, 0x78, 0xA2, 0x88, 0x6F, 0x7F, 0xA2, 0x78,
+    0x6B, 0x6E, 0xC0, 0x56, 0x65, 0xC0, 0x56, 0xC1, 0x66, 0x7E, 0x66, 0xC0, 0x69, 0x56, 0x66, 0x69,
+    0x66, 0x18, 0x56, 0x65, 0x65, 0x66, 0x69, 0x20, 0x25, 0x20, 0x66, 0x14, 0x66, 0xC0, 0x14, 0x20,
+    0x14, 0x0F, 0xC1, 0x1B, 0xA2, 0x88, 0x6F, 0x7F, 0x6E, 0x6F, 0xA2, 0x88, 0xA2, 0x89, 0x6E, 0x65,
+    0x0F, 0x51, 0x69, 0xA3, 0x88, 0xA3, 0x89, 0xA0, 0x9A, 0x59, 0x66, 0x66, 0xC0, 0x64, 0xC1, 0x0F,
+    0x0A, 0xC0, 0x3B, 0xC2, 0x55, 0xC0, 0x7A, 0x6B, 0x3B, 0x6E, 0x0F, 0x17, 0xA3, 0x88, 0x7F, 0xC1,
+    0x6E, 0x3F, 0x51, 0x17, 0x03, 0x59, 0x03, 0x17, 0x04, 0xA4, 0x88, 0xA3, 0x98, 0xA2, 0x88, 0xA2,
+    0x78, 0x66, 0xA5, 0x94, 0xFF, 0xE6, 0x49, 0x95, 0xA5, 0x9F, 0x8B, 0x9C, 0x5C, 0x97, 0x7F, 0x9D,
+    0x6D, 0x9D, 0xA6, 0xA8, 0xA2, 0xA2, 0x96, 0x54, 0x66, 0xC1, 0x9D, 0x7C, 0x99, 0x7D, 0x9E, 0x7B,
+    0xA2, 0x79, 0xA3, 0x87, 0xA3, 0x98, 0x6B, 0xC0, 0x51, 0xC0, 0x6B, 0x55, 0x6B, 0xA1, 0xA7, 0xA7,
+    0xB1, 0xA5, 0xC3, 0xA4, 0x95, 0x5A, 0xA3, 0x98, 0xA2, 0x87, 0xC0, 0xA3, 0x8C, 0xFF, 0x83, 0x88,
+    0x9C, 0x7D, 0x65, 0x9D, 0x89, 0x9D, 0x99, 0x9E, 0x67, 0x9D, 0x97, 0xB7, 0xB1, 0xFF, 0xD5, 0xE4,
+    0x7C, 0xA6, 0x79, 0x9F, 0x9C, 0xFF, 0xEE, 0xB1, 0xFF, 0xA4, 0xD1, 0x9B, 0x89, 0x98, 0x89, 0x9A,
+    0x97, 0x56, 0x9C, 0x88, 0xC1, 0x54, 0xA2, 0x87, 0xAF, 0x88, 0xAC, 0x87, 0x6E, 0x7D, 0xA2, 0x87,
+    0x69, 0x69, 0xC0, 0x56, 0x53, 0x9D, 0x9A, 0x9D, 0x9A, 0x51, 0x56, 0x00, 0xC0, 0x6E, 0xC0, 0x6B,
+    0x6B, 0x6B, 0x76, 0x6B, 0xC1, 0xA3, 0x89, 0xA3, 0x98, 0xA2, 0x88, 0xC0, 0x1E, 0x40, 0x9D, 0x98,
+    0x99, 0x98, 0x98, 0x88, 0x9A, 0x88, 0x55, 0x7E, 0x69, 0xB4, 0x85, 0xB1, 0x83, 0x99, 0x73, 0x55,
+    0x57, 0x98, 0x79, 0x5B, 0x5A, 0x51, 0x51, 0x7F, 0xA6, 0x96, 0x51, 0x55, 0x63, 0xC0, 0xA5, 0x98,
+    0x7A, 0x6D, 0xA1, 0xA9, 0xA2, 0x87, 0x7F, 0x57, 0x98, 0x89, 0xA7, 0x88, 0xA3, 0x8B, 0xFF, 0x5B,
+    0x89, 0x9B, 0x6D, 0xA4, 0x89, 0x9A, 0x98, 0x7D, 0x9F, 0x76, 0xAC, 0x85, 0xAD, 0xA6, 0x88, 0x9B,
+    0xA5, 0x8A, 0xBB, 0x9A, 0x95, 0xBB, 0x91, 0x9A, 0xA2, 0x87, 0xC0, 0x7B, 0xC2, 0x6E, 0xC1, 0x6E,
+    0x6B, 0x9B, 0x78, 0x7E, 0xA2, 0x88, 0x6F, 0x7A, 0x6E, 0xC0, 0x7F, 0x6E, 0xC0, 0x0C, 0x00, 0xC0,
+    0x3B, 0x2C, 0x7A, 0x3B, 0x00, 0x7A, 0x6E, 0x7E, 0x6B, 0x10, 0x66, 0x66, 0xC0, 0x03, 0x65, 0x69,
+    0xA7, 0x86, 0xA7, 0x73, 0x94, 0x59, 0x97, 0x6E, 0x9F, 0x7C, 0xA3, 0x89, 0xA2, 0x77, 0xA0, 0xA9,
+    0x9B, 0xA8, 0x99, 0xA8, 0x7E, 0x6F, 0xA2, 0x88, 0x59, 0xC0, 0xA3, 0x88, 0x12, 0xA2, 0x88, 0xA2,
+    0x89, 0xA2, 0x78, 0x9C, 0x87, 0x9A, 0x89, 0xA2, 0x88, 0x13, 0xA2, 0x78, 0x3D, 0xA3, 0xB8, 0xB0,
+    0xD8, 0x96, 0xB8, 0x50, 0xC0, 0x5A, 0xA1, 0xA9, 0xA2, 0x88, 0x6E, 0x3B, 0x55, 0x9D, 0x98, 0x9A,
+    0x88, 0x98, 0x87, 0x9D, 0x99, 0x55, 0x25, 0x7F, 0xA2, 0x78, 0xA2, 0x78, 0xA2, 0x88, 0xA2, 0x88,
+    0x6F, 0x6F, 0x6B, 0xC0, 0x5A, 0x6E, 0x1A, 0x56, 0x65, 0xC0, 0x66, 0xC1, 0x06, 0x7B, 0x69, 0x66,
+    0xC0, 0x66, 0x6D, 0x56, 0x65, 0x66, 0x65, 0x66, 0xC0, 0x69, 0x56, 0x7A, 0x69, 0x55, 0x66, 0x20,
+    0xC0, 0x66, 0x20, 0xC1, 0x6B, 0x7E, 0x6F, 0xA2, 0x88, 0x6F, 0x6F, 0xC0, 0x7F, 0xA2, 0x87, 0x6F,
+    0x6E, 0x7F, 0x6E, 0x37, 0x6E, 0x56, 0xC0, 0x66, 0x6B, 0x2F, 0x66, 0xC0, 0x23, 0x66, 0x23, 0x1E,
+    0x5A, 0x66, 0x0F, 0xC1, 0x56, 0x65, 0xC2, 0x6E, 0x14, 0x23, 0x7F, 0xA3, 0x98, 0xA4, 0x88, 0x7E,
+    0x6F, 0x6E, 0xA2, 0x88, 0x66, 0x0F, 0x51, 0x9D, 0x88, 0x66, 0x30, 0x66, 0xA3, 0x88, 0xA3, 0x88,
+    0x7F, 0xA2, 0x88, 0x67, 0xA3, 0x85, 0xFF, 0xE6, 0x8C, 0x97, 0xB2, 0x9A, 0x9A, 0xA0, 0x6B, 0x9A,
+    0x5C, 0x98, 0x7F, 0x9E, 0x6B, 0x9F, 0x94, 0xA8, 0xA3, 0x7C, 0x61, 0xC0, 0x7F, 0x9B, 0x7C, 0x9A,
+    0x5D, 0x9F, 0x8B, 0x5F, 0x7D, 0xA4, 0x88, 0x7F, 0xC0, 0x51, 0x56, 0x6B, 0x2E, 0x66, 0xA4, 0x95,
+    0xA7, 0xC2, 0xA4, 0xB2, 0xA2, 0x87, 0xA2, 0x87, 0xA2, 0x88, 0xA2, 0x87, 0x55, 0xA5, 0x9C, 0xFF,
+    0x9C, 0x28, 0x97, 0x7F, 0x6B, 0x51, 0x55, 0x9D, 0x99, 0x9A, 0x78, 0xA9, 0xA3, 0xB2, 0xA1, 0xA4,
+    0x73, 0xA7, 0x97, 0xA4, 0x89, 0x9E, 0x8F, 0xFF, 0xC5, 0x93, 0x97, 0x7B, 0x69, 0x28, 0x09, 0x30,
+    0x51, 0x55, 0x65, 0x55, 0x69, 0xAB, 0x88, 0xB0, 0x87, 0xA4, 0x86, 0x6E, 0x69, 0x6D, 0x66, 0x57,
+    0x63, 0x9D, 0x9A, 0x9D, 0x8A, 0x51, 0xC1, 0x7D, 0xC0, 0x6B, 0x6B, 0xC0, 0x15, 0x6B, 0xC0, 0x7A,
+    0x33, 0xA3, 0x99, 0xA3, 0x88, 0xC0, 0x23, 0x0F, 0x9D, 0x98, 0x9B, 0x88, 0x97, 0x98, 0x99, 0x98,
+    0x41, 0x7E, 0x11, 0xA2, 0x98, 0xAC, 0x75, 0xB6, 0x83, 0x9A, 0x72, 0x9E, 0x86, 0x5B, 0x9A, 0x78,
+    0x9D, 0x7A, 0x5B, 0x55, 0x62, 0x65, 0xA6, 0x87, 0x7D, 0x9D, 0x9A, 0x56, 0x66, 0xA5, 0x97, 0x7A,
+    0x6E, 0x7F, 0xA1, 0xA8, 0xA2, 0x88, 0x67, 0x99, 0x7A, 0xA4, 0x97, 0xA6, 0x7A, 0xFF, 0x6C, 0x0A,
+    0x96, 0x6C, 0xA4, 0x7A, 0x61, 0x9D, 0x98, 0x6C, 0xA7, 0x85, 0xB0, 0x96, 0x8E, 0xAA, 0x9A, 0x7A,
+    0xBD, 0x99, 0x9E, 0x9B, 0x8D, 0xAA, 0x7E, 0xC0, 0x6B, 0x7A, 0xC1, 0x6E, 0xC1, 0x6E, 0xC0, 0x9B,
+    0x78, 0x7F, 0xA2, 0x88, 0x6F, 0x7A, 0x6E, 0x7F, 0xC2, 0x00, 0x3B, 0x00, 0xC0, 0x55, 0x3B, 0x00,
+    0x7A, 0x6E, 0x7F, 0xC0, 0x6E, 0x17, 0x65, 0xC0, 0x6B, 0x03, 0x3C, 0x65, 0xAD, 0x85, 0x9F, 0x74,
+    0x95, 0x5A, 0x98, 0x5E, 0xA0, 0x7A, 0x6F, 0xA3, 0x89, 0xA1, 0xA8, 0x99, 0xB8, 0x9B, 0x98, 0x76,
+    0xA2, 0x78, 0x01, 0x55, 0x6F, 0xA2, 0x88, 0x6F, 0xA2, 0x88, 0xA2, 0x88, 0x5A, 0x9B, 0x99, 0x51,
+    0x6E, 0x6F, 0xA3, 0x89, 0x6D, 0xA9, 0xC8, 0xAA, 0xD8, 0x98, 0x98, 0x69, 0x66, 0x51, 0x66, 0xC0,
+    0x18, 0x65, 0x9D, 0x99, 0x9B, 0x88, 0x9A, 0x88, 0x9C, 0x98, 0x6E, 0x6F, 0x6E, 0xA2, 0x88, 0xA2,
+    0x88, 0x6F, 0xA2, 0x88, 0xA2, 0x78, 0x6F, 0xC1, 0x1A, 0xC1, 0x56, 0x65, 0xC0, 0x56, 0xC1, 0x7F,
+    0xC0, 0x7A, 0xC1, 0x66, 0x69, 0xC1, 0x65, 0xC0, 0x65, 0x56, 0xC4, 0x65, 0x65, 0x66, 0x00, 0x07,
+    0xC0, 0x0C, 0x7A, 0x6E, 0x6B, 0x6E, 0x7F, 0x6F, 0x6E, 0x7F, 0xC0, 0x6E, 0x6F, 0x7E, 0xC0, 0x6B,
+    0xC1, 0x6E, 0xC0, 0x6B, 0xC2, 0x36, 0x2F, 0xC0, 0x66, 0xC0, 0x55, 0xC2, 0x0F, 0x56, 0x00, 0x07,
+    0x00, 0xC0, 0x6F, 0xA2, 0x98, 0x7F, 0x7E, 0x13, 0xA3, 0x99, 0xA3, 0x88, 0xC0, 0x7E, 0x6F, 0x7E,
+    0xC2, 0x23, 0x0F, 0x9D, 0x98, 0x41, 0xC0, 0x7F, 0x6E, 0x6B, 0x2C, 0xFF, 0xDE, 0x2E, 0x9F, 0xA0,
+    0x96, 0x98, 0x57, 0xA1, 0x6A, 0x96, 0x6E, 0xFF, 0x4A, 0xC9, 0x41, 0xA2, 0x93, 0xA5, 0xB4, 0x7D,
+    0x65, 0x7B, 0x9B, 0x7B, 0x9A, 0x5D, 0xA1, 0x7C, 0x5A, 0x79, 0x2E, 0xA2, 0x88, 0x6E, 0x62, 0x2E,
+    0x6B, 0x7A, 0x79, 0xA5, 0xA5, 0xA6, 0xA1, 0xA3, 0xA4, 0xA2, 0x97, 0xA2, 0x87, 0x7F, 0xA3, 0x87,
+    0x51, 0xA6, 0x89, 0x98, 0x6F, 0xFF, 0x6B, 0x29, 0x39, 0x53, 0x55, 0x51, 0x9C, 0x88, 0x64, 0xAB,
+    0xA3, 0xA1, 0x94, 0xAB, 0x85, 0xAD, 0x96, 0xA0, 0x8D, 0xFF, 0xCD, 0xB3, 0x98, 0x6B, 0x9D, 0x98,
+    0xA2, 0x88, 0x10, 0x14, 0x09, 0x9A, 0x88, 0xC0, 0x65, 0x51, 0x6D, 0xB4, 0x76, 0xAB, 0x88, 0x65,
+    0x6E, 0x7A, 0x3F, 0x66, 0x52, 0x52, 0x52, 0x52, 0xC0, 0x69, 0xC1, 0x6E, 0x7B, 0x6B, 0xC0, 0x6F,
+    0x10, 0x1F, 0xA4, 0x88, 0xA4, 0x88, 0xC1, 0x50, 0x51, 0x9B, 0x99, 0x98, 0x97, 0x97, 0x98, 0x9C,
+    0x78, 0x7E, 0xA2, 0x88, 0xA4, 0x88, 0xA4, 0x88, 0xA4, 0x87, 0xB6, 0x73, 0x9E, 0x81, 0x9D, 0x76,
+    0x5A, 0x9B, 0x89, 0x9B, 0x7A, 0x6F, 0x52, 0x51, 0x56, 0xA4, 0x97, 0xA3, 0x97, 0x51, 0x52, 0x66,
+    0xA5, 0x97, 0xC0, 0x7A, 0xA2, 0x88, 0xA1, 0xA8, 0xA2, 0x88, 0x7B, 0x9A, 0x79, 0x69, 0xA8, 0x7A,
+    0x96, 0x6F, 0x93, 0x6E, 0xA3, 0x7A, 0xA2, 0x87, 0x9B, 0x98, 0x69, 0xA6, 0x75, 0xAE, 0x95, 0x97,
+    0xBB, 0x91, 0x8A, 0xBB, 0x8A, 0xA7, 0xAA, 0x8B, 0xAB, 0x61, 0x6E, 0xC0, 0x6B, 0x7A, 0xC1, 0x6E,
+    0xC1, 0x6E, 0x9B, 0x78, 0x7F, 0xA3, 0x88, 0x7F, 0xC0, 0x7F, 0xC3, 0x00, 0x3B, 0x00, 0xC0, 0x69,
+    0x00, 0x7E, 0xC0, 0x6F, 0x7A, 0xC0, 0x6E, 0x17, 0x10, 0xC0, 0x17, 0x52, 0x08, 0x68, 0xAE, 0x85,
+    0x99, 0x74, 0x97, 0x5C, 0x98, 0x6D, 0xA2, 0x7A, 0x5E, 0x7F, 0x7A, 0x9C, 0xA8, 0x9B, 0xA8, 0x60,
+    0x6F, 0x35, 0x5A, 0xA2, 0x88, 0xA2, 0x78, 0x6B, 0xA3, 0x89, 0x6E, 0x52, 0x9D, 0x88, 0x65, 0x6B,
+    0xA2, 0x78, 0x38, 0x7D, 0xAF, 0xD9, 0xA4, 0xC7, 0x9C, 0x98, 0x51, 0x51, 0x9D, 0x99, 0x9D, 0x98,
+    0x9D, 0x88, 0xC0, 0x9D, 0x99, 0x9C, 0x88, 0x9C, 0x87, 0x9D, 0x99, 0x6B, 0xA2, 0x77, 0xA2, 0x78,
+    0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x78, 0x7F, 0x6F, 0xA2, 0x88, 0xC1, 0x5A, 0x66, 0x1A, 0x51, 0xC2,
+    0x66, 0xC0, 0x6B, 0x6E, 0xC0, 0x7A, 0xC1, 0x08, 0x01, 0xC1, 0x7A, 0x66, 0x69, 0xC4, 0x66, 0x5A,
+    0x69, 0x66, 0xC0, 0x7A, 0xC0, 0x33, 0xC0, 0x7A, 0x6E, 0x6E, 0x7B, 0x6E, 0xA2, 0x78, 0x7A, 0xC0,
+    0x6B, 0xC0, 0x5E, 0xC3, 0x7F, 0xC7, 0x65, 0x2A, 0x5A, 0x65, 0xC1, 0x55, 0x66, 0x65, 0x00, 0x3B,
+    0xC0, 0x0C, 0x20, 0x2F, 0x7E, 0xA2, 0x97, 0xA3, 0x89, 0xA3, 0x99, 0x6D, 0x7F, 0x6F, 0x7E, 0x6E,
+    0xC0, 0x2B, 0x66, 0x59, 0x23, 0x51, 0x55, 0x66, 0xC1, 0x27, 0xA7, 0x93, 0xFF, 0xEE, 0x69, 0x96,
+    0x85, 0x9B, 0xAA, 0xA2, 0x78, 0x9D, 0x6C, 0x97, 0x6F, 0x9C, 0x6D, 0x42, 0xA1, 0xA5, 0xA5, 0xB4,
+    0xA2, 0x95, 0x65, 0x9A, 0x7C, 0x9A, 0x6C, 0xA3, 0x7C, 0x5A, 0x66, 0x6F, 0x35, 0x7E, 0xC0, 0x2E,
+    0x7E, 0x7E, 0xA1, 0xA7, 0xA4, 0x95, 0xA4, 0xA2, 0xA3, 0xA5, 0xA2, 0x87, 0xA2, 0x88, 0x0A, 0xA5,
+    0x87, 0x9D, 0x98, 0xA5, 0x89, 0x9E, 0x7E, 0xFF, 0x73, 0x48, 0xA0, 0x8A, 0x6B, 0x67, 0x51, 0x41,
+    0x9C, 0x88, 0xA6, 0xA5, 0x9E, 0x96, 0xA3, 0x85, 0xAC, 0x84, 0xAD, 0x8B, 0x98, 0x7F, 0x97, 0x8B,
+    0xC2, 0xA3, 0x88, 0x7F, 0x9A, 0x88, 0x9B, 0x88, 0x9C, 0x88, 0x61, 0xA3, 0x88, 0xAF, 0x87, 0xA5,
+    0x87, 0x56, 0x7A, 0x01, 0x55, 0x56, 0x62, 0x56, 0x62, 0x56, 0xC4, 0x6E, 0x15, 0x6B, 0xC0, 0x7A,
+    0xA3, 0x88, 0xA4, 0x88, 0xA2, 0x88, 0xC0, 0x66, 0x14, 0x9B, 0x99, 0x99, 0x97, 0x98, 0x88, 0x99,
+    0x98, 0x56, 0xA3, 0x98, 0x08, 0xA4, 0x88, 0xA3, 0x98, 0xA2, 0x88, 0xB2, 0x73, 0xA2, 0x81, 0x9C,
+    0x74, 0x56, 0x9D, 0x79, 0x99, 0x8A, 0x5F, 0x56, 0x51, 0x52, 0xA2, 0x97, 0xA5, 0x97, 0x51, 0x52,
+    0x66, 0xA4, 0x98, 0x79, 0x6E, 0xA2, 0x88, 0xA1, 0xA8, 0xA2, 0x88, 0x7B, 0x9C, 0x78, 0x9D, 0x99,
+    0xA9, 0x79, 0x99, 0x6F, 0x90, 0x6E, 0xA3, 0x7B, 0xA3, 0x87, 0x9B, 0x98, 0x51, 0xA8, 0x85, 0xAA,
+    0x85, 0x9F, 0xB9, 0x89, 0x9B, 0xB8, 0x79, 0xB0, 0x9A, 0x8B, 0xBB, 0x9B, 0x89, 0x2C, 0xC2, 0x6B,
+    0x7A, 0xC0, 0x6E, 0xC1, 0x9C, 0x67, 0x7F, 0xA3, 0x89, 0x7E, 0x7F, 0xC1, 0x6E, 0x0C, 0xC0, 0x65,
+    0xC0, 0x7E, 0x6B, 0x59, 0x08, 0x0F, 0x7E, 0x6E, 0x17, 0xC0, 0x1C, 0xC0, 0x17, 0x1C, 0x17, 0x6B,
+    0x68, 0x0E, 0xAE, 0x84, 0x95, 0x65, 0x97, 0x6D, 0x9A, 0x6D, 0xA2, 0x79, 0x5A, 0x7F, 0xC0, 0x70,
+    0x9B, 0xB9, 0x9D, 0x97, 0xC0, 0xA3, 0x88, 0x6F, 0xA2, 0x78, 0xA2, 0x78, 0x6F, 0xA2, 0x89, 0x5A,
+    0x27, 0x51, 0x66, 0x13, 0xA2, 0x89, 0xA2, 0x77, 0xA3, 0x97, 0xFF, 0xBE, 0x58, 0x9E, 0xC8, 0x51,
+    0x50, 0x9C, 0x89, 0x50, 0x9C, 0x88, 0x9A, 0x88, 0x9C, 0x88, 0x9B, 0x99, 0x9D, 0x98, 0x6F, 0x6E,
+    0x3B, 0xA2, 0x78, 0xA3, 0x88, 0xA2, 0x88, 0x6F, 0x6F, 0xA2, 0x88, 0xA2, 0x88, 0x08, 0x6E, 0x56,
+    0xC0, 0x3D, 0x55, 0x51, 0x15, 0x59, 0xC0, 0x67, 0x66, 0x0D, 0xC0, 0x7A, 0xC0, 0x66, 0xC2, 0x69,
+    0xCB, 0x65, 0xC0, 0x7A, 0x6F, 0xC1, 0x7E, 0x6E, 0x6F, 0xC0, 0x7A, 0x6F, 0xC3, 0x5A, 0xC3, 0x7F,
+    0xC7, 0x2F, 0x66, 0xC0, 0x5A, 0x65, 0xC0, 0x0F, 0x07, 0xC0, 0x65, 0x38, 0xC0, 0x7E, 0x0F, 0x23,
+    0x7E, 0x6E, 0xA2, 0x99, 0xA4, 0x87, 0xA2, 0x88, 0x6E, 0x7F, 0x6F, 0x7E, 0xC1, 0x55, 0xC0, 0x6F,
+    0x23, 0x55, 0x66, 0x55, 0x66, 0x56, 0x7C, 0xFF, 0xE6, 0x6C, 0x9B, 0x92, 0x96, 0x9A, 0x76, 0xA3,
+    0x79, 0x9C, 0x5B, 0x96, 0x6F, 0x9D, 0x6D, 0x55, 0xA0, 0x95, 0xA7, 0xC4, 0xA2, 0x96, 0x99, 0x7C,
+    0x99, 0x8B, 0xA3, 0x7B, 0xA0, 0x7A, 0x56, 0x6B, 0xA2, 0x88, 0x7E, 0x36, 0x65, 0x79, 0xA3, 0x96,
+    0xA2, 0x97, 0xA3, 0xA6, 0xA3, 0x95, 0xA2, 0xA5, 0xA2, 0x87, 0xA3, 0x88, 0x75, 0xA5, 0x87, 0x55,
+    0xA4, 0x87, 0xA1, 0x8E, 0xFF, 0x7B, 0x88, 0x9E, 0x8B, 0x6B, 0xC0, 0x67, 0x51, 0x9D, 0x88, 0xA2,
+    0x87, 0x74, 0x64, 0xA2, 0x85, 0xB2, 0x89, 0x9F, 0x7C, 0x95, 0x7B, 0xA3, 0x98, 0xC2, 0xA2, 0x88,
+    0xA4, 0x88, 0x6E, 0x29, 0x41, 0xC0, 0xA3, 0x87, 0xC1, 0x6E, 0xC0, 0x24, 0x69, 0x66, 0x66, 0x56,
+    0x66, 0xC4, 0x6B, 0x7E, 0x6B, 0x7A, 0x33, 0x14, 0xA3, 0x89, 0xC0, 0x66, 0x23, 0x51, 0x98, 0x87,
+    0x97, 0x98, 0x99, 0x98, 0x9C, 0x88, 0xA3, 0x99, 0xA6, 0x78, 0xA4, 0x88, 0xA3, 0x98, 0xA2, 0x89,
+    0x6F, 0xAF, 0x84, 0xA6, 0x81, 0x9B, 0x74, 0x50, 0x46, 0x98, 0x89, 0x5B, 0x5A, 0x51, 0x56, 0x61,
+    0xA6, 0x87, 0x79, 0x9D, 0x9A, 0x56, 0xA4, 0x98, 0x7D, 0xC0, 0x7F, 0x7E, 0xA3, 0x98, 0xC0, 0x52,
+    0x9B, 0x89, 0xA7, 0x99, 0x9E, 0x5D, 0x8E, 0x6F, 0xA1, 0x7C, 0xA4, 0x77, 0x9D, 0x97, 0x9C, 0x88,
+    0xA8, 0x86, 0xA7, 0x95, 0xA4, 0x98, 0x89, 0x9B, 0xB1, 0x8A, 0xB6, 0x99, 0x8F, 0xAB, 0x95, 0xA9,
+    0xA2, 0x88, 0x66, 0xC1, 0x2C, 0xC0, 0x6B, 0x7A, 0xC0, 0x6E, 0x9C, 0x67, 0x7F, 0xA3, 0x88, 0x3D,
+    0x7F, 0x6E, 0xC0, 0x7A, 0x11, 0x0C, 0x69, 0xC0, 0x7B, 0x14, 0x0F, 0x69, 0x14, 0x7E, 0xC4, 0x66,
+    0xC1, 0x6B, 0x65, 0xA5, 0x86, 0xAB, 0x84, 0x93, 0x66, 0x98, 0x5C, 0x9B, 0x7D, 0xA2, 0x79, 0x59,
+    0xA1, 0x9A, 0xC0, 0x79, 0x9B, 0xC9, 0x9C, 0x96, 0x55, 0xA3, 0x89, 0x6F, 0xA3, 0x78, 0xA2, 0x78,
+    0xA2, 0x79, 0x6B, 0x33, 0x27, 0x51, 0xC0, 0x6F, 0x33, 0x55, 0xAB, 0xB7, 0xB1, 0xF9, 0x9A, 0xA8,
+    0x65, 0x55, 0x9C, 0x88, 0x9C, 0x88, 0x9C, 0x88, 0x9A, 0x87, 0x99, 0x89, 0x9D, 0x98, 0xC0, 0xA2,
+    0x89, 0xA2, 0x78, 0xA2, 0x88, 0xA3, 0x89, 0x6E, 0x6F, 0x7F, 0xA3, 0x89, 0x14, 0x6E, 0xC0, 0x14,
+    0xC0, 0x5A, 0x65, 0xC0, 0x5A, 0x2E, 0x51, 0x15, 0x66, 0xC3, 0x66, 0xC1, 0x10, 0x7A, 0x6E, 0x55,
+    0xC0, 0x66, 0xC5, 0x10, 0x13, 0x18, 0xC0, 0x13, 0x18, 0xC1, 0x7A, 0x20, 0x7B, 0xC2, 0x6E, 0xC3,
+    0x2C, 0xC3, 0x7F, 0xC7, 0x2F, 0xC0, 0x2A, 0xC0, 0x1B, 0x69, 0x66, 0x5A, 0x65, 0x66, 0x55, 0x6B,
+    0x3B, 0xC1, 0x7A, 0x69, 0x3E, 0xA2, 0x87, 0x6F, 0xA3, 0x98, 0x07, 0xA4, 0x88, 0xA3, 0x88, 0x7F,
+    0x6E, 0xC1, 0x17, 0x56, 0xC2, 0x55, 0x66, 0x51, 0xAB, 0x90, 0xFF, 0xE6, 0x46, 0x95, 0x98, 0x9B,
+    0xAB, 0xA3, 0x98, 0x5A, 0x9A, 0x4D, 0x98, 0x6D, 0x9D, 0x7E, 0x51, 0xA1, 0xA4, 0xA8, 0x95, 0x9C,
+    0x89, 0x9B, 0x89, 0xA3, 0x8A, 0x9E, 0x7B, 0x43, 0xA1, 0x9A, 0x6D, 0xA2, 0x87, 0x6E, 0x79, 0xA0,
+    0xA6, 0xA2, 0x85, 0xA3, 0xA6, 0xA2, 0x97, 0xA2, 0x96, 0xA2, 0x96, 0xA2, 0x87, 0xA2, 0x88, 0x69,
+    0xA4, 0x87, 0x7E, 0xA2, 0x76, 0xA4, 0x8B, 0xFF, 0x94, 0x08, 0x98, 0x8E, 0xA2, 0x88, 0x5A, 0xC0,
+    0x66, 0x9D, 0x99, 0x6E, 0xA2, 0x87, 0x99, 0x96, 0x79, 0xAF, 0x89, 0xAA, 0x7A, 0x92, 0x79, 0xA2,
+    0x79, 0xC2, 0x66, 0x2A, 0x7F, 0x6E, 0x6E, 0x6E, 0xC0, 0x6F, 0xC0, 0x7E, 0xC0, 0x66, 0xC1, 0x65,
+    0xC0, 0x66, 0xC4, 0x0D, 0x7F, 0xC0, 0x7E, 0xA4, 0x88, 0xA3, 0x98, 0x6B, 0xC1, 0x9D, 0x98, 0x9B,
+    0x98, 0x97, 0x97, 0x97, 0x89, 0x9D, 0x88, 0x7A, 0xA6, 0x88, 0xA5, 0x89, 0xA3, 0x98, 0xA2, 0x88,
+    0xA3, 0x9A, 0x07, 0xA8, 0x76, 0xAD, 0x81, 0x99, 0x93, 0x9F, 0x76, 0x5A, 0x99, 0x8A, 0x9C, 0x89,
+    0x5F, 0x55, 0x56, 0x9D, 0x99, 0xA3, 0xA8, 0xA3, 0x98, 0x61, 0x52, 0xA3, 0x99, 0xA2, 0x87, 0x69,
+    0x7E, 0x7F, 0xA2, 0x97, 0x6F, 0x6B, 0x99, 0x9A, 0xA6, 0x77, 0xA2, 0x6C, 0x8E, 0x6F, 0x9D, 0x7D,
+    0xA5, 0x79, 0x64, 0x99, 0x97, 0x32, 0xA6, 0x85, 0xA7, 0x97, 0x8C, 0x9B, 0xA6, 0x8A, 0xBA, 0x89,
+    0x96, 0xAA, 0x8F, 0xBA, 0xA2, 0x88, 0xC5, 0x6E, 0xC1, 0x9C, 0x78, 0x10, 0xA3, 0x88, 0xA2, 0x88,
+    0x7F, 0x11, 0xC0, 0x7B, 0xC0, 0x69, 0x55, 0xC0, 0x7B, 0x14, 0x69, 0x66, 0x14, 0x7F, 0x6E, 0x65,
+    0xC1, 0x66, 0x65, 0xC0, 0x56, 0x66, 0x59, 0xA9, 0x96, 0xA9, 0x83, 0x91, 0x68, 0x98, 0x5D, 0x9D,
+    0x7D, 0xA2, 0x68, 0x65, 0xA2, 0x89, 0xA2, 0x88, 0x65, 0x9D, 0xB8, 0x1D, 0x55, 0x31, 0x5A, 0xA3,
+    0x79, 0xA2, 0x79, 0xA3, 0x89, 0x41, 0x33, 0x24, 0x61, 0x1F, 0x7E, 0x33, 0x54, 0xB3, 0xC8, 0xA7,
+    0xF9, 0x9A, 0x98, 0x65, 0x59, 0x9C, 0x99, 0x9B, 0x88, 0x9B, 0x88, 0x99, 0x99, 0x9D, 0x88, 0x66,
+    0x00, 0xA2, 0x89, 0xA2, 0x88, 0xA2, 0x78, 0xA2, 0x88, 0xA2, 0x88, 0x5F, 0x7F, 0x08, 0x6F, 0x6E,
+    0xC0, 0x14, 0xC0, 0x19, 0x11, 0xC2, 0x3D, 0x9D, 0x98, 0x10, 0x66, 0x10, 0xC0, 0x0B, 0xC1, 0x10,
+    0xA2, 0x98, 0x6E, 0xC0, 0x27, 0x55, 0x65, 0x66, 0xC1, 0x09, 0xC0, 0x10, 0xC1, 0x18, 0x6B, 0xC2,
+    0x7A, 0xC0, 0x27, 0x7A, 0x6E, 0xC4, 0x2A, 0x2C, 0xC4, 0x7F, 0xC7, 0x2F, 0xC1, 0x2A, 0x59, 0x65,
+    0x66, 0xC0, 0x55, 0x66, 0x55, 0xC2, 0x66, 0xC0, 0x1B, 0x55, 0x66, 0x69, 0xC0, 0x7F, 0x23, 0xA3,
+    0x88, 0x24, 0xA3, 0x99, 0xA2, 0x88, 0xA2, 0x88, 0x6F, 0x6E, 0xC0, 0x7A, 0xC0, 0x00, 0x3B, 0x51,
+    0xA5, 0x83, 0xFF, 0xEE, 0x8A, 0x97, 0x94, 0x99, 0xAB, 0x6B, 0xA2, 0x86, 0x9E, 0x6B, 0x9B, 0x6D,
+    0x99, 0x7E, 0x9C, 0x6B, 0x9D, 0x98, 0xA2, 0x95, 0x7D, 0x7E, 0xA3, 0x98, 0x9D, 0x7C, 0x9C, 0x7C,
+    0x6B, 0xA2, 0x77, 0xA2, 0x86, 0x7D, 0xA2, 0x97, 0xA0, 0xA6, 0xA1, 0x95, 0xA4, 0x96, 0xA1, 0xA8,
+    0xA2, 0x87, 0x7D, 0xA2, 0x87, 0x02, 0x69, 0xA3, 0x98, 0xA2, 0x87, 0xA2, 0x76, 0xA5, 0x8A, 0xFF,
+    0xCD, 0xAC, 0x93, 0x8F, 0x99, 0x99, 0x57, 0xA2, 0x78, 0xC0, 0x66, 0x9D, 0x99, 0x28, 0x99, 0x97,
+    0xA2, 0x87, 0xA6, 0x88, 0xB1, 0x89, 0x96, 0x69, 0x57, 0xC4, 0x6E, 0xC0, 0x6E, 0x7F, 0x6F, 0xC5,
+    0x7A, 0xC1, 0x66, 0xC1, 0x69, 0xC0, 0x0D, 0xC0, 0x7B, 0x1C, 0xA3, 0x98, 0xA3, 0x99, 0xA2, 0x87,
+    0x66, 0xC0, 0x1B, 0x9C, 0x87, 0x98, 0x97, 0x96, 0x98, 0x9B, 0x88, 0xC0, 0xA3, 0x99, 0xA6, 0x88,
+    0xA4, 0x88, 0xA3, 0x89, 0xA2, 0x89, 0xA2, 0x88, 0x6E, 0xA2, 0x77, 0xB0, 0x82, 0x9C, 0x71, 0x9E,
+    0x85, 0x5A, 0x9B, 0x89, 0x99, 0x8A, 0xA2, 0x78, 0x45, 0x52, 0x9D, 0x99, 0xA1, 0xA9, 0xA5, 0x97,
+    0x65, 0x9D, 0x9A, 0xA3, 0x99, 0xA2, 0x87, 0x69, 0x6E, 0xA1, 0xA9, 0xA2, 0x88, 0x7E, 0xA2, 0x88,
+    0x99, 0x8A, 0xA2, 0x98, 0xA5, 0x6C, 0x91, 0x6F, 0x98, 0x6D, 0xA5, 0x89, 0xA2, 0x86, 0x98, 0x87,
+    0xA8, 0x86, 0xA5, 0x97, 0xA9, 0x86, 0x91, 0xAB, 0x9A, 0x8A, 0xFF, 0xAE, 0x56, 0x77, 0x8B, 0xBA,
+    0x7F, 0x5A, 0x66, 0x27, 0xC4, 0x6E, 0x9A, 0x88, 0xA2, 0x78, 0x24, 0x3D, 0x7E, 0x6B, 0x7E, 0xC2,
+    0x51, 0xC0, 0x7E, 0x66, 0xC0, 0x08, 0xC0, 0x17, 0x6E, 0xC2, 0x17, 0x69, 0x08, 0x03, 0x56, 0x64,
+    0xAE, 0x84, 0xA5, 0x74, 0x90, 0x68, 0x99, 0x5F, 0x9F, 0x7C, 0x5A, 0xC0, 0xA2, 0x88, 0x7F, 0x66,
+    0x9E, 0xA6, 0x9B, 0xA7, 0x60, 0xA2, 0x88, 0x2E, 0xA5, 0x79, 0xA1, 0x7A, 0x6F, 0x9D, 0x89, 0x33,
+    0x1F, 0x65, 0x24, 0x7B, 0x33, 0xA2, 0x86, 0xFF, 0xB6, 0x58, 0x9E, 0xD8, 0x9C, 0x87, 0x51, 0x51,
+    0x9C, 0x98, 0x9A, 0x77, 0x9A, 0x88, 0x52, 0x56, 0x7A, 0xA2, 0x78, 0xA2, 0x99, 0xA2, 0x78, 0xA2,
+    0x88, 0x6F, 0xA2, 0x77, 0x7F, 0x6F, 0x6E, 0xC0, 0x14, 0x19, 0xC2, 0x14, 0x5A, 0xC1, 0x66, 0x51,
+    0x9D, 0x88, 0x66, 0x0B, 0xC1, 0x5E, 0x66, 0x15, 0x38, 0x79, 0xC0, 0x2F, 0xC0, 0x55, 0x62, 0x56,
+    0xC0, 0x10, 0xC2, 0x15, 0xC0, 0x6B, 0x7A, 0xC3, 0x7E, 0x2F, 0xC0, 0x6F, 0xC1, 0x34, 0x2F, 0x2C,
+    0x27, 0xC0, 0x2C, 0xC2, 0x3B, 0xC7, 0x2F, 0xC1, 0x23, 0xC0, 0x55, 0x0F, 0x66, 0x55, 0xC0, 0x65,
+    0x5A, 0xC0, 0x3B, 0xC1, 0x66, 0x55, 0x66, 0x65, 0x59, 0x65, 0x56, 0x7A, 0x0C, 0xC0, 0x7A, 0xA3,
+    0x88, 0xA3, 0x89, 0xA5, 0x99, 0xA4, 0x87, 0x6F, 0x7F, 0xC0, 0x66, 0x55, 0xA3, 0x95, 0xFF, 0xE6,
+    0x6C, 0x9B, 0x92, 0x98, 0x99, 0x52, 0x7E, 0x67, 0x9E, 0x6A, 0xA0, 0x6B, 0x99, 0x7C, 0x9A, 0x7A,
+    0xA2, 0x87, 0x79, 0xA1, 0xA6, 0xA5, 0x97, 0x9E, 0x6A, 0x98, 0x7E, 0x9E, 0x7B, 0xA3, 0x88, 0xA2,
+    0x86, 0xA1, 0xA7, 0xA2, 0x96, 0xA0, 0x95, 0xA2, 0x96, 0xA3, 0x97, 0xA1, 0xA7, 0x6E, 0xA2, 0x87,
+    0x7A, 0xA3, 0x87, 0x7F, 0x7E, 0xA4, 0x76, 0x7D, 0xA2, 0x8A, 0xFF, 0xFF, 0x31, 0x9E, 0x7D, 0x92,
+    0x9A, 0x96, 0x88, 0x9B, 0x99, 0x5B, 0x5B, 0x51, 0x28, 0x9D, 0x97, 0x50, 0xA4, 0x88, 0x2E, 0x9C,
+    0x69, 0x9C, 0x7A, 0xC1, 0x6E, 0x7B, 0x6E, 0x5A, 0xC0, 0x7E, 0xC0, 0x6F, 0xC2, 0x6B, 0x0F, 0xC0,
+    0x7A, 0xC2, 0x66, 0xC1, 0x69, 0x0D, 0xC0, 0x17, 0xA3, 0x88, 0xA3, 0x98, 0xA2, 0x98, 0xC1, 0x56,
+    0x9B, 0xA8, 0x9B, 0x88, 0x97, 0x97, 0x99, 0x99, 0x45, 0x7E, 0xA5, 0x99, 0xA5, 0x89, 0xA4, 0x89,
+    0xA3, 0x99, 0xA2, 0x88, 0x6F, 0x2A, 0x45, 0xAF, 0x93, 0xA1, 0x83, 0x9C, 0x84, 0x59, 0x9D, 0x88,
+    0x99, 0x79, 0x6B, 0x45, 0x52, 0x52, 0x65, 0xA5, 0x98, 0x69, 0x62, 0x7F, 0xA3, 0x98, 0x69, 0xC0,
+    0x7F, 0xA3, 0x98, 0x7E, 0xA2, 0x87, 0x9B, 0x8A, 0x66, 0xA6, 0x7B, 0x94, 0x5E, 0x95, 0x6E, 0xA5,
+    0x8A, 0xA4, 0x86, 0x99, 0x87, 0xA4, 0x87, 0xA6, 0x86, 0xA8, 0x96, 0x97, 0x99, 0x93, 0x9C, 0xB9,
+    0x8B, 0xA7, 0xAA, 0x8A, 0xB9, 0x66, 0xC0, 0x66, 0xC0, 0x27, 0x22, 0xC0, 0x27, 0xC0, 0x2C, 0x9A,
+    0x88, 0x6E, 0xA2, 0x88, 0x2C, 0xA2, 0x88, 0x6E, 0x6B, 0x7E, 0xC0, 0x0C, 0x00, 0xC1, 0x65, 0xC0,
+    0x00, 0x7A, 0x6E, 0x7B, 0x6E, 0x12, 0xC0, 0x69, 0x08, 0x0B, 0x08, 0x03, 0x34, 0xB0, 0x83, 0xA0,
+    0x74, 0x91, 0x59, 0x99, 0x5F, 0xA0, 0x7B, 0xC1, 0xA2, 0x88, 0x7F, 0x66, 0x70, 0x3F, 0x9D, 0xA8,
+    0xA2, 0x88, 0xA1, 0x7A, 0xA4, 0x79, 0x5F, 0x9D, 0x89, 0x7E, 0x6F, 0x27, 0x52, 0x1F, 0x33, 0x24,
+    0xA8, 0xA7, 0xB3, 0xE9, 0x99, 0xC7, 0x9C, 0x88, 0x9C, 0x88, 0x9C, 0x88, 0x98, 0x98, 0x9C, 0x77,
+    0x55, 0x08, 0x6F, 0x6F, 0xA2, 0x88, 0xA3, 0x89, 0xA2, 0x88, 0x6F, 0x03, 0x6E, 0x6F, 0x6E, 0x7A,
+    0x6F, 0xC0, 0x6E, 0xC2, 0x28, 0x19, 0x14, 0xC0, 0x5A, 0x00, 0x41, 0x15, 0x62, 0xC0, 0x6E, 0x56,
+    0x6E, 0xA2, 0x97, 0x34, 0xC0, 0x65, 0x34, 0xC0, 0x28, 0x52, 0x55, 0x6B, 0x10, 0xC2, 0x15, 0x6B,
+    0xC0, 0x7E, 0x66, 0xC2, 0x7E, 0x2C, 0x7A, 0x6F, 0xC2, 0x34, 0xC0, 0x2F, 0x27, 0xC1, 0x2C, 0xC0,
+    0x3B, 0xC7, 0x2F, 0xC0, 0x28, 0x66, 0x5A, 0x61, 0xC0, 0x65, 0x56, 0xC0, 0x66, 0x59, 0x7A, 0x3B,
+    0x6F, 0xC2, 0x3B, 0x36, 0x55, 0x65, 0x55, 0xC0, 0x1B, 0x2F, 0x03, 0x65, 0x9C, 0x89, 0x1B, 0xA5,
+    0x98, 0xA5, 0x88, 0x18, 0xA3, 0x99, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x96, 0xA7, 0x81, 0x9D, 0x91,
+    0x97, 0x97, 0x9C, 0x8A, 0xA2, 0x98, 0x7A, 0x9C, 0x79, 0xA2, 0x7A, 0xA2, 0x79, 0x9B, 0x79, 0x9D,
+    0x89, 0x66, 0xA1, 0xA6, 0xA3, 0x87, 0x57, 0x9A, 0x7D, 0x9A, 0x7C, 0xA2, 0x79, 0xA3, 0x98, 0xA1,
+    0xA7, 0x7C, 0x64, 0xA4, 0x86, 0x04, 0xA2, 0x87, 0x7E, 0x7E, 0x6E, 0xA3, 0x97, 0xA2, 0x88, 0x65,
+    0xA5, 0x97, 0xA2, 0x76, 0x6B, 0xFF, 0xF6, 0xEE, 0xA8, 0x5F, 0x9B, 0xBA, 0x98, 0x98, 0x98, 0x87,
+    0x97, 0x89, 0x9A, 0x8A, 0x41, 0x52, 0x69, 0x9B, 0xA8, 0xA3, 0x98, 0xB1, 0x79, 0x5B, 0x98, 0x79,
+    0xA2, 0x89, 0x3E, 0xC0, 0x6E, 0xC0, 0x6B, 0x6E, 0xC0, 0x7A, 0x6E, 0x5B, 0x0F, 0x1B, 0xC0, 0x76,
+    0xC1, 0x12, 0xC0, 0x66, 0xC4, 0x7A, 0x7F, 0xA4, 0x88, 0xA2, 0x88, 0x23, 0x66, 0x1B, 0x9C, 0x98,
+    0x9A, 0x97, 0x98, 0x87, 0x99, 0x88, 0x9D, 0x89, 0x6E, 0xA2, 0x99, 0xA5, 0x99, 0xA5, 0x88, 0xA4,
+    0x89, 0xA3, 0x99, 0xA2, 0x78, 0x7E, 0x6B, 0x40, 0xAD, 0x85, 0xA7, 0x82, 0x9A, 0x83, 0x58, 0x55,
+    0x97, 0x8A, 0x51, 0x5B, 0x45, 0x66, 0x9D, 0x99, 0x1B, 0xA3, 0xA8, 0x9D, 0x99, 0x6F, 0xA3, 0xA9,
+    0x65, 0x6D, 0x7F, 0xA2, 0x98, 0xA2, 0x87, 0xA2, 0x86, 0x9D, 0x8A, 0x9D, 0x99, 0xA6, 0x7B, 0x98,
+    0x5E, 0x91, 0x6E, 0xA4, 0x7A, 0xA4, 0x97, 0x9D, 0x76, 0x7D, 0xA4, 0x87, 0xAA, 0x96, 0x51, 0x8B,
+    0x9C, 0xB5, 0x8B, 0xAE, 0xAA, 0x00, 0x9C, 0x89, 0x7E, 0x66, 0xC0, 0x27, 0xC0, 0x22, 0x27, 0x7F,
+    0xC0, 0x99, 0x78, 0x30, 0x6F, 0xA2, 0x88, 0xA3, 0x98, 0x6E, 0x00, 0xC5, 0x34, 0xC0, 0x00, 0xC0,
+    0x7A, 0x6E, 0xC4, 0x7A, 0x6B, 0x08, 0x65, 0xB3, 0x83, 0x99, 0x74, 0x92, 0x5C, 0x9A, 0x5E, 0xA1,
+    0x7A, 0x66, 0x6F, 0xA2, 0x88, 0x7E, 0x65, 0x61, 0x9E, 0x96, 0x60, 0xA2, 0x89, 0x5B, 0xA4, 0x79,
+    0x1F, 0x65, 0xA2, 0x88, 0x6F, 0x27, 0x1F, 0xC0, 0x33, 0x54, 0xB0, 0xB8, 0xA8, 0xE8, 0x95, 0xB8,
+    0x9B, 0x98, 0x9A, 0x88, 0x99, 0x88, 0x9D, 0x98, 0x6F, 0xA2, 0x78, 0xA2, 0x88, 0xA2, 0x78, 0xA2,
+    0x89, 0xA3, 0x88, 0x7F, 0x34, 0x7F, 0xC0, 0xA2, 0x78, 0x7E, 0x6B, 0x6E, 0x7F, 0x6E, 0x7F, 0xC0,
+    0x6E, 0x56, 0x69, 0x56, 0x28, 0x5A, 0x66, 0x51, 0x51, 0x51, 0x51, 0x66, 0xC0, 0x69, 0x10, 0xA2,
+    0x87, 0x7E, 0x7A, 0xC1, 0x6E, 0x52, 0x61, 0x56, 0xC0, 0x09, 0xC0, 0x10, 0x6E, 0xC0, 0x6B, 0xC0,
+    0x24, 0xC0, 0x66, 0xC1, 0x7E, 0xC0, 0x2C, 0x7A, 0xC0, 0x6F, 0xC0, 0x03, 0x6F, 0x7E, 0x14, 0x3B,
+    0x2F, 0x27, 0x2C, 0x3B, 0xC7, 0x2F, 0xC0, 0x28, 0x66, 0x65, 0x56, 0xC0, 0x65, 0x56, 0xC0, 0x66,
+    0xC0, 0x3B, 0xC0, 0x07, 0x6E, 0xC2, 0x07, 0x3B, 0xC1, 0x0F, 0xA3, 0x98, 0x7F, 0xC0, 0x59, 0x2B,
+    0x17, 0x6E, 0xA3, 0x98, 0xA6, 0x88, 0xA5, 0x9A, 0xA4, 0x88, 0xA2, 0x87, 0x6D, 0xA2, 0x83, 0x9F,
+    0x90, 0x95, 0xA6, 0x9B, 0x8A, 0x7E, 0xA3, 0x98, 0x9D, 0x9A, 0x9D, 0x89, 0xA6, 0x78, 0x9D, 0x98,
+    0x41, 0x5B, 0x7A, 0x26, 0x5A, 0x9D, 0x8C, 0x9A, 0x8C, 0x5F, 0xA3, 0x98, 0x69, 0x61, 0x6C, 0xA2,
+    0x97, 0xC0, 0x79, 0xA3, 0x87, 0x7A, 0x26, 0xA3, 0x97, 0xA2, 0x88, 0x65, 0xA5, 0x97, 0xA2, 0x76,
+    0xC0, 0xA8, 0x7D, 0xFF, 0xFF, 0xF9, 0x9E, 0x9B, 0x64, 0x64, 0x98, 0x98, 0x97, 0x99, 0x98, 0x89,
+    0x9B, 0x99, 0x51, 0x9B, 0x88, 0xC0, 0xAE, 0x88, 0xA7, 0x69, 0x19, 0xA3, 0x89, 0x6E, 0x6E, 0xC0,
+    0x7F, 0xC0, 0x6B, 0x6D, 0x6B, 0xC6, 0x19, 0xC0, 0x12, 0x66, 0xC2, 0x66, 0xC0, 0x7F, 0xA3, 0x88,
+    0xA2, 0x98, 0xA2, 0x87, 0x6B, 0x65, 0x51, 0x9B, 0x98, 0x97, 0xA8, 0x99, 0x88, 0x9D, 0x88, 0x5A,
+    0xA2, 0x88, 0xA2, 0x89, 0xA4, 0x88, 0xA5, 0x99, 0xA4, 0x89, 0xA2, 0x88, 0x7F, 0x6E, 0x1D, 0x40,
+    0xA9, 0x97, 0xAF, 0x83, 0x98, 0x71, 0xA0, 0x85, 0x5A, 0x99, 0x89, 0x9A, 0x89, 0xA2, 0x78, 0x45,
+    0x56, 0x9D, 0x9A, 0x69, 0xA5, 0x98, 0x61, 0x7B, 0xA3, 0x99, 0x65, 0x6D, 0x7B, 0xA3, 0x97, 0xA2,
+    0x88, 0x7D, 0x56, 0x9C, 0x89, 0xA6, 0x7A, 0x9B, 0x6E, 0x8E, 0x6F, 0xA2, 0x7B, 0xA5, 0x87, 0xA0,
+    0x75, 0x64, 0xA3, 0x98, 0xA9, 0x96, 0xA4, 0x98, 0x89, 0x8B, 0xAD, 0x8C, 0xB4, 0xAB, 0x8E, 0xA8,
+    0x98, 0x98, 0x7F, 0x66, 0x27, 0xC1, 0x6E, 0x7B, 0x6E, 0xC0, 0x99, 0x88, 0xC0, 0x6F, 0x7E, 0x18,
+    0x2C, 0x6F, 0x7E, 0xC2, 0x3B, 0xC0, 0x69, 0x3B, 0x7E, 0xC0, 0x08, 0x7F, 0xC0, 0x66, 0xC0, 0x69,
+    0xC0, 0x17, 0x12, 0x0B, 0xA2, 0x77, 0xB3, 0x82, 0x94, 0x65, 0x93, 0x6D, 0x9C, 0x5E, 0x5B, 0x66,
+    0x6F, 0xA2, 0x88, 0x7A, 0x65, 0x69, 0x60, 0x50, 0xA1, 0x9A, 0xA2, 0x78, 0x5B, 0x9C, 0x88, 0xA2,
+    0x88, 0xA2, 0x89, 0x33, 0x27, 0x1F, 0x27, 0x33, 0x69, 0xB6, 0xC7, 0x94, 0xD8, 0x94, 0xA7, 0x9C,
+    0x98, 0x9D, 0x88, 0x56, 0x6E, 0xA1, 0x9A, 0xA3, 0x88, 0xA3, 0x89, 0xA3, 0x78, 0xA3, 0x99, 0xA3,
+    0x88, 0xC0, 0x08, 0xC0, 0x6B, 0xA2, 0x87, 0x6F, 0x7F, 0x6E, 0x7F, 0x6E, 0xC0, 0x6E, 0x6B, 0x15,
+    0x10, 0x56, 0x3C, 0x56, 0x51, 0x51, 0x00, 0x38, 0x9D, 0x88, 0x62, 0xC0, 0x6E, 0x6D, 0x7A, 0x7A,
+    0xC0, 0x7E, 0xC0, 0x66, 0x14, 0x65, 0x56, 0x6B, 0x6E, 0x5A, 0x10, 0x15, 0xC0, 0x6B, 0x6E, 0x7A,
+    0xC1, 0x66, 0xC0, 0x7E, 0xC0, 0x6E, 0x7A, 0xC0, 0x3B, 0x6E, 0x0F, 0xA2, 0x88, 0x28, 0x7E, 0x23,
+    0x50, 0x2C, 0x27, 0x3B, 0xC7, 0x2F, 0xC0, 0x69, 0x66, 0x14, 0x65, 0xC0, 0x56, 0x66, 0x69, 0x67,
+    0x3B, 0xC1, 0x00, 0x5A, 0xC2, 0xA1, 0x9A, 0xA2, 0x98, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x87, 0x7A,
+    0xC0, 0x6E, 0xA2, 0x88, 0xA2, 0x88, 0x7E, 0x6E, 0x6B, 0xA3, 0x88, 0xA2, 0x99, 0xA2, 0x88, 0x69,
+    0xC0, 0xA2, 0x85, 0xA1, 0x90, 0x98, 0x91, 0x99, 0x8A, 0x52, 0xA3, 0x98, 0xC0, 0x9B, 0x9A, 0xA5,
+    0x88, 0x6E, 0x3B, 0x56, 0x67, 0x59, 0xC0, 0x57, 0x52, 0x57, 0xA2, 0x88, 0x69, 0x9D, 0x99, 0x55,
+    0xA2, 0x88, 0x1D, 0x61, 0xA3, 0x88, 0x79, 0x6E, 0x33, 0xA3, 0x98, 0x69, 0xA4, 0x86, 0x7E, 0xA2,
+    0x78, 0xA3, 0x9B, 0xFF, 0xE6, 0xD3, 0xA6, 0x8E, 0x6D, 0x64, 0x6E, 0x9D, 0xA8, 0x9C, 0x88, 0x98,
+    0xA7, 0x9C, 0x89, 0x93, 0x88, 0x97, 0x98, 0xAE, 0x78, 0xB0, 0x69, 0x8E, 0x7B, 0xA1, 0x8A, 0x6E,
+    0x7B, 0x6E, 0xC2, 0x6E, 0x6B, 0xC7, 0x19, 0xC0, 0x0D, 0xC1, 0x66, 0x69, 0x08, 0xA2, 0x88, 0xA2,
+    0x98, 0xA2, 0x87, 0x6B, 0xC0, 0x65, 0x9C, 0x97, 0x98, 0x88, 0x98, 0x87, 0x9D, 0x89, 0x55, 0x7E,
+    0xA2, 0x89, 0xA3, 0x89, 0xA4, 0x89, 0xA4, 0x88, 0xA3, 0x99, 0xA2, 0x88, 0x6F, 0xC1, 0x50, 0xA5,
+    0x87, 0xB3, 0x85, 0x9A, 0x80, 0x9E, 0x84, 0x5E, 0x9C, 0x89, 0x97, 0x89, 0x6B, 0x5E, 0x41, 0x52,
+    0x61, 0xA4, 0x87, 0x7E, 0x66, 0xA3, 0xAA, 0x65, 0x6D, 0xC0, 0xA3, 0x98, 0xA2, 0x98, 0x31, 0x6F,
+    0x9B, 0x99, 0xA5, 0x8A, 0x9E, 0x6D, 0x8E, 0x5F, 0xA0, 0x7B, 0xA5, 0x88, 0x6C, 0x9E, 0x86, 0xA3,
+    0x87, 0xA6, 0x97, 0xAA, 0x97, 0x8B, 0x9B, 0xA3, 0x8B, 0xFF, 0xBE, 0xBA, 0x92, 0xA8, 0x18, 0xA2,
+    0x88, 0x66, 0xC0, 0x6F, 0x7A, 0xC0, 0x6E, 0xC0, 0x6E, 0x98, 0x88, 0xC0, 0xA2, 0x88, 0x6E, 0x18,
+    0x2C, 0x7E, 0x00, 0xC1, 0x34, 0xC2, 0x3B, 0x7E, 0xC0, 0x6E, 0x7B, 0xC2, 0x6E, 0xC2, 0x65, 0xA5,
+    0x87, 0xB1, 0x72, 0x90, 0x76, 0x95, 0x5E, 0x9D, 0x6E, 0x56, 0xC0, 0xA2, 0x78, 0x7F, 0x7E, 0x65,
+    0x55, 0x50, 0x76, 0x7F, 0xA3, 0x78, 0x9C, 0x89, 0x41, 0xA2, 0x99, 0xA3, 0x88, 0x3B, 0x1F, 0xC0,
+    0x33, 0x59, 0xA4, 0xA8, 0xB2, 0xC7, 0x87, 0xD8, 0x9A, 0x97, 0x1B, 0xC0, 0x20, 0xA2, 0x78, 0xA2,
+    0x88, 0x2F, 0xA4, 0x78, 0xA4, 0x88, 0x0D, 0x6E, 0xC0, 0x7B, 0xC1, 0x6F, 0x7F, 0x7E, 0x6F, 0x6E,
+    0x7A, 0x6F, 0xC0, 0x6E, 0xC0, 0x55, 0x10, 0x59, 0x62, 0x28, 0x51, 0x00, 0x56, 0x41, 0x61, 0xC0,
+    0x6E, 0x79, 0x65, 0x66, 0xC0, 0x7E, 0xC0, 0x65, 0x6B, 0x08, 0x03, 0xC0, 0x5B, 0x09, 0x15, 0x10,
+    0x15, 0x6B, 0xC0, 0x7E, 0x66, 0xC0, 0x24, 0x1F, 0x7E, 0xC0, 0x6E, 0xC0, 0x7A, 0x6F, 0x6E, 0x14,
+    0x7E, 0x6B, 0x7E, 0xC0, 0x23, 0x3B, 0x27, 0x2F, 0x3B, 0xC5, 0x2F, 0xC1, 0x65, 0xC0, 0x55, 0x08,
+    0xC0, 0x56, 0x65, 0x66, 0x5A, 0x34, 0xC0, 0x6B, 0x00, 0x14, 0x23, 0xA3, 0x88, 0xA3, 0x88, 0xA2,
+    0x89, 0xA2, 0x98, 0xA3, 0x99, 0x6E, 0xC0, 0x65, 0x66, 0x2F, 0x7F, 0x69, 0x6E, 0x7F, 0x7F, 0x6E,
+    0x1A, 0x7F, 0xA3, 0x87, 0x66, 0x69, 0xA3, 0x81, 0xFF, 0xDD, 0xE5, 0x98, 0x87, 0x9C, 0x8A, 0x7E,
+    0xA2, 0x87, 0x2E, 0x6F, 0xA5, 0x97, 0x9C, 0x88, 0x62, 0x6F, 0x59, 0x2E, 0x33, 0x52, 0x56, 0x7F,
+    0xC0, 0x9D, 0x99, 0x42, 0xA2, 0x87, 0xA2, 0x88, 0x11, 0x25, 0x79, 0x26, 0x33, 0x08, 0x6E, 0x7E,
+    0xA3, 0x97, 0x6E, 0xA5, 0x8B, 0xFF, 0xCD, 0xCD, 0xFF, 0xAD, 0x32, 0xAE, 0x88, 0xA2, 0x86, 0x65,
+    0xA3, 0x98, 0xA2, 0x78, 0x60, 0x9D, 0xA8, 0x90, 0x97, 0x96, 0x87, 0xA8, 0x77, 0xB0, 0x7A, 0x8E,
+    0x6C, 0x9D, 0x8B, 0x6E, 0x7B, 0x12, 0xC0, 0x19, 0xC0, 0x6E, 0xC4, 0x6E, 0x1E, 0xC0, 0x19, 0xC1,
+    0x12, 0x0D, 0xC0, 0x66, 0xC0, 0x7E, 0xA2, 0x88, 0x7F, 0x6E, 0xC0, 0x33, 0x0E, 0x9A, 0x97, 0x98,
+    0x87, 0x9C, 0x78, 0x65, 0xC0, 0xA2, 0x88, 0xA3, 0x89, 0xA3, 0x89, 0xA4, 0x89, 0xA3, 0x89, 0xA2,
+    0x88, 0xA2, 0x89, 0x7A, 0xC0, 0x69, 0x56, 0xA2, 0x87, 0xB4, 0x74, 0x9F, 0x92, 0x9B, 0x83, 0x6D,
+    0x56, 0x97, 0x89, 0x9C, 0x89, 0xA2, 0x78, 0x42, 0x41, 0x02, 0x7F, 0xA4, 0x87, 0x65, 0xA3, 0x99,
+    0x66, 0x09, 0x79, 0xA2, 0x98, 0xA3, 0x98, 0x68, 0xA2, 0x89, 0x9A, 0x8A, 0xA3, 0x89, 0xA2, 0x6C,
+    0xFF, 0x53, 0x69, 0x9B, 0x7C, 0xA6, 0x87, 0xA4, 0x75, 0x9C, 0x87, 0xA3, 0x87, 0xA5, 0x98, 0xAB,
+    0x97, 0x91, 0xAA, 0x99, 0x8C, 0xFF, 0xAE, 0x58, 0x98, 0xB9, 0x94, 0xA9, 0x6E, 0x36, 0xC3, 0x3B,
+    0xC1, 0x99, 0x77, 0x7B, 0xA2, 0x77, 0xA2, 0x88, 0x18, 0x7E, 0x6E, 0x7F, 0xC1, 0x66, 0xC1, 0x34,
+    0x7B, 0x6E, 0xC0, 0x08, 0xC0, 0x7A, 0x12, 0x6E, 0xC3, 0x0B, 0xA9, 0x86, 0xAB, 0x73, 0x8F, 0x76,
+    0x99, 0x6D, 0x9B, 0x6F, 0x57, 0x6E, 0xA2, 0x78, 0xA2, 0x98, 0xC0, 0x65, 0x51, 0x51, 0xA2, 0x87,
+    0x6F, 0xA2, 0x88, 0x9A, 0x89, 0xC0, 0x1F, 0x3B, 0x56, 0x1F, 0xC0, 0x33, 0x55, 0xAB, 0xB8, 0xA7,
+    0xD8, 0x88, 0xB7, 0x69, 0xC0, 0x65, 0x7F, 0xA2, 0x78, 0xA4, 0x79, 0xA4, 0x88, 0xA5, 0x89, 0xA2,
+    0x88, 0x66, 0xC2, 0x28, 0xC0, 0x7E, 0x6F, 0x7F, 0xC0, 0x6E, 0x7F, 0x6E, 0xC0, 0x6E, 0x24, 0xC0,
+    0x59, 0x66, 0x51, 0x51, 0x51, 0x9D, 0x89, 0x9D, 0x88, 0x55, 0x66, 0x66, 0xC0, 0x79, 0xC0, 0x31,
+    0x66, 0xA1, 0xA8, 0xA2, 0x88, 0x6E, 0xA2, 0x89, 0xA3, 0x98, 0x6F, 0x07, 0x9D, 0x79, 0x9C, 0x79,
+    0x6F, 0xC0, 0x6E, 0xC0, 0x6B, 0xC0, 0x7A, 0xC0, 0x6E, 0xC1, 0x7A, 0xC1, 0x6E, 0x2F, 0x36, 0x08,
+    0xA2, 0x88, 0xC0, 0x7F, 0xC1, 0x9D, 0x99, 0x9C, 0x88, 0x27, 0x2F, 0xC5, 0x27, 0x69, 0x66, 0xC0,
+    0x69, 0x65, 0x56, 0xC0, 0x7A, 0xA3, 0x88, 0xA3, 0x89, 0xA2, 0x88, 0x13, 0xA2, 0x88, 0xA3, 0x88,
+    0xA3, 0x89, 0xA2, 0x98, 0xA2, 0x88, 0xA2, 0x78, 0x7F, 0x65, 0x55, 0x0B, 0x66, 0x37, 0x6F, 0xC0,
+    0x0B, 0xC3, 0x7F, 0x1F, 0xC0, 0x69, 0x7F, 0xC0, 0x18, 0xA2, 0x94, 0xFF, 0xEE, 0x49, 0x97, 0x85,
+    0x9B, 0x9A, 0xC0, 0xA2, 0x88, 0x36, 0x56, 0xA6, 0x87, 0x0A, 0x36, 0x6E, 0x36, 0x2E, 0x7A, 0x2E,
+    0xC0, 0x7F, 0xC0, 0x41, 0x9C, 0x8A, 0xC0, 0xA4, 0x77, 0x9D, 0x9A, 0x7E, 0x7D, 0xC0, 0x2E, 0xA4,
+    0x86, 0xC0, 0xA2, 0x87, 0xA3, 0x97, 0x6E, 0xA4, 0x89, 0xFF, 0xE6, 0x6D, 0xFF, 0x9C, 0xD0, 0xA2,
+    0x8A, 0xAC, 0x86, 0xA5, 0x98, 0x50, 0x79, 0xA4, 0x88, 0xA3, 0x77, 0x98, 0xB8, 0x94, 0x86, 0xA3,
+    0x87, 0xAC, 0x7B, 0x90, 0x7B, 0x97, 0x8C, 0x0D, 0x6E, 0xC0, 0x6F, 0xC2, 0x7A, 0x1E, 0xC4, 0x19,
+    0xC0, 0x0D, 0xC0, 0x66, 0xC3, 0x17, 0xA2, 0x97, 0xC1, 0x66, 0x07, 0x9B, 0x88, 0x99, 0x98, 0x9B,
+    0x88, 0x61, 0xC0, 0x7F, 0xA3, 0x88, 0xA3, 0x8A, 0xA4, 0x88, 0xA3, 0x89, 0xA2, 0x89, 0xA2, 0x88,
+    0x6F, 0x69, 0xC2, 0x51, 0xB2, 0x85, 0xA9, 0x72, 0x97, 0x93, 0x69, 0x68, 0x99, 0x89, 0x99, 0x8A,
+    0xA2, 0x78, 0x56, 0x45, 0x62, 0x52, 0xA2, 0x88, 0xA3, 0x96, 0xA1, 0x9A, 0x7A, 0x6E, 0x79, 0xA2,
+    0x88, 0xA3, 0x98, 0x79, 0xA2, 0x78, 0x9B, 0x9B, 0x6F, 0xA4, 0x7B, 0x91, 0x6F, 0x97, 0x6D, 0xA6,
+    0x78, 0xA6, 0x96, 0x9B, 0x97, 0xA3, 0x76, 0xA4, 0x97, 0xAA, 0x87, 0x99, 0x99, 0x93, 0x9D, 0xB6,
+    0x9C, 0x9C, 0xB8, 0x96, 0xA9, 0x56, 0x69, 0x56, 0x65, 0x66, 0x2F, 0xC0, 0x56, 0xC0, 0xA3, 0x87,
+    0x66, 0x41, 0x61, 0x6E, 0x1B, 0x6E, 0xC0, 0x6E, 0x2F, 0xC0, 0x20, 0x7A, 0x2F, 0x34, 0x03, 0xC0,
+    0x6E, 0x12, 0x6E, 0xC5, 0x08, 0xAD, 0x95, 0xA5, 0x73, 0x90, 0x76, 0x9C, 0x5E, 0x98, 0x5E, 0x6B,
+    0x6F, 0xA2, 0x87, 0xA2, 0x88, 0xC0, 0x33, 0x51, 0x69, 0xA2, 0x88, 0x7F, 0xC0, 0x9A, 0x88, 0x6F,
+    0xA3, 0x98, 0x3B, 0x33, 0x1F, 0x27, 0xA2, 0x78, 0x18, 0xB3, 0xC8, 0x9A, 0xC7, 0x8F, 0xB8, 0x6E,
+    0xC0, 0x00, 0xA3, 0x78, 0xA3, 0x8A, 0xA5, 0x88, 0xA3, 0x99, 0xA2, 0x88, 0x66, 0xC0, 0x21, 0xC1,
+    0x67, 0x6E, 0x7E, 0x6F, 0x7F, 0x6E, 0x7F, 0xC0, 0x6E, 0x29, 0x6B, 0x29, 0x24, 0xC0, 0x59, 0x51,
+    0x2D, 0x9D, 0x89, 0x9C, 0x88, 0x51, 0x55, 0x66, 0x66, 0x69, 0xC0, 0x75, 0xC1, 0x7E, 0xA4, 0x98,
+    0xA3, 0x89, 0xA5, 0x98, 0xA4, 0x78, 0xA2, 0x98, 0x6F, 0x9D, 0x89, 0x98, 0x88, 0x99, 0x79, 0x5B,
+    0x7E, 0x15, 0x6B, 0xC0, 0x7A, 0xC2, 0x69, 0xC2, 0x7B, 0x6E, 0x7E, 0xA4, 0x87, 0xA3, 0x89, 0xA2,
+    0x88, 0x65, 0x6B, 0xA2, 0x88, 0x7A, 0x55, 0x9D, 0x89, 0x17, 0x03, 0xC0, 0x66, 0x03, 0xC1, 0x55,
+    0x7A, 0x6E, 0xC1, 0x7A, 0x6E, 0xA2, 0x89, 0xA3, 0x98, 0x1B, 0xA4, 0x87, 0xA2, 0x88, 0xA2, 0x88,
+    0xA3, 0x99, 0x6F, 0xA2, 0x87, 0x6B, 0xC0, 0x55, 0x07, 0x66, 0x59, 0x24, 0x9D, 0x99, 0x3C, 0x7E,
+    0x0B, 0xC6, 0x10, 0x04, 0x65, 0x56, 0x55, 0x9F, 0x96, 0xFF, 0xEE, 0x6B, 0x99, 0x93, 0x99, 0x8A,
+    0x52, 0xA2, 0x88, 0x6E, 0x9C, 0x89, 0xA5, 0x98, 0x6E, 0x3B, 0xC1, 0x36, 0xC0, 0x6B, 0xC0, 0x02,
+    0xC0, 0x3D, 0x9B, 0x8A, 0x56, 0xA4, 0x87, 0x52, 0x52, 0xA3, 0x97, 0x69, 0x2E, 0xA3, 0x87, 0x7E,
+    0x7E, 0xA3, 0x87, 0xA2, 0x87, 0xA3, 0x89, 0xA6, 0x8F, 0xFF, 0xBD, 0xB2, 0x9D, 0x8B, 0x66, 0xA5,
+    0x98, 0xA9, 0x88, 0xA4, 0x86, 0x64, 0x51, 0xA3, 0x98, 0x9C, 0x96, 0x9C, 0x86, 0xA9, 0x7B, 0x8F,
+    0x8C, 0x39, 0x0D, 0xC0, 0x6E, 0x6B, 0x1E, 0xC1, 0x7A, 0x1E, 0xC4, 0x19, 0xC0, 0x0D, 0xC0, 0x56,
+    0x7A, 0xC2, 0x7E, 0x7E, 0xC0, 0x66, 0x3F, 0x9C, 0x87, 0x99, 0x98, 0x9C, 0x87, 0x9D, 0x99, 0xC0,
+    0x6F, 0xA2, 0x98, 0xA3, 0x89, 0xA4, 0x79, 0xA3, 0x99, 0xA2, 0x88, 0xA2, 0x89, 0x6F, 0x69, 0x6E,
+    0xC2, 0x37, 0xAA, 0x87, 0xB3, 0x82, 0x98, 0x83, 0x9E, 0x76, 0x9F, 0x96, 0x9C, 0x77, 0x98, 0x89,
+    0x5A, 0x5B, 0x51, 0x53, 0x56, 0x65, 0xA4, 0x87, 0xA3, 0x98, 0x7B, 0x65, 0x6E, 0xA1, 0xA8, 0xA3,
+    0x98, 0x69, 0xA3, 0x88, 0x30, 0x56, 0xA4, 0x8B, 0x94, 0x5E, 0x94, 0x6D, 0xA4, 0x79, 0xA8, 0x86,
+    0x9D, 0x86, 0x69, 0xA5, 0x87, 0xA8, 0x97, 0x62, 0x92, 0x8B, 0xB2, 0x9C, 0x9D, 0xCA, 0x17, 0x66,
+    0x3E, 0x65, 0x56, 0x55, 0xC2, 0x56, 0xAA, 0x87, 0x7F, 0x56, 0x17, 0x34, 0xC1, 0x66, 0x69, 0x5A,
+    0x76, 0x1B, 0xC0, 0x23, 0x2F, 0x7E, 0x6F, 0x6E, 0x17, 0xC6, 0x08, 0xB0, 0x83, 0xA0, 0x72, 0x92,
+    0x78, 0x9D, 0x5E, 0x97, 0x6F, 0x6B, 0x6F, 0xA2, 0x87, 0xA2, 0x88, 0x66, 0x51, 0x55, 0x6E, 0xA2,
+    0x98, 0x07, 0x9D, 0x98, 0x9B, 0x89, 0x13, 0x2E, 0x3B, 0x2E, 0x1F, 0x2E, 0xA2, 0x77, 0x79, 0xB4,
+    0xC8, 0x8F, 0xB8, 0x9A, 0x87, 0x7A, 0x61, 0x22, 0xA3, 0x99, 0xA4, 0x88, 0xA4, 0x78, 0x6B, 0xC2,
+    0x7E, 0xC0, 0x19, 0xC0, 0x7F, 0x30, 0x6F, 0x7F, 0x6E, 0x7F, 0xC0, 0x6E, 0xC0, 0x6E, 0xC0, 0x24,
+    0xC0, 0x55, 0x51, 0x9D, 0x89, 0x9D, 0x98, 0x41, 0x51, 0x51, 0xC0, 0x66, 0x35, 0xC0, 0x65, 0x2C,
+    0xC0, 0x7E, 0xA3, 0x99, 0xA6, 0x87, 0xA5, 0x99, 0xA4, 0x88, 0xA3, 0x88, 0x6F, 0xC0, 0x9D, 0x9A,
+    0x96, 0x78, 0x98, 0x78, 0x56, 0xA2, 0x78, 0x7E, 0x66, 0xC0, 0xA2, 0x87, 0x7F, 0xC0, 0xA2, 0x88,
+    0x0A, 0x6E, 0x17, 0x7F, 0x30, 0xA2, 0x98, 0xA3, 0x99, 0x3E, 0xA2, 0x87, 0x51, 0x56, 0xA2, 0x88,
+    0xA3, 0x88, 0x7F, 0x66, 0x55, 0x66, 0x59, 0x12, 0x17, 0x6F, 0xC0, 0x17, 0xC0, 0x1C, 0x7A, 0x2B,
+    0x69, 0x1F, 0xC0, 0x55, 0x51, 0x0B, 0x2B, 0xA3, 0x98, 0xA2, 0x88, 0x6E, 0x6B, 0xC0, 0x6E, 0x62,
+    0x55, 0x07, 0x51, 0x24, 0x0B, 0x37, 0x3C, 0x51, 0x65, 0x6E, 0xA2, 0x88, 0x7B, 0xC0, 0x55, 0xC0,
+    0x66, 0x9D, 0x88, 0x9C, 0x88, 0x9C, 0x88, 0x9C, 0x88, 0x9D, 0x97, 0xB2, 0x91, 0xA6, 0x80, 0x96,
+    0x87, 0x9C, 0x8A, 0xA2, 0x87, 0x7F, 0x9C, 0x89, 0xA3, 0x88, 0xA3, 0x98, 0x02, 0x3B, 0xC5, 0x6F,
+    0x0A, 0x9B, 0x8A, 0x52, 0xA4, 0x76, 0x67, 0x9C, 0x89, 0xA3, 0x98, 0x21, 0x29, 0x3B, 0x08, 0x7E,
+    0xA3, 0x87, 0xA2, 0x87, 0xA2, 0x88, 0xA7, 0x8E, 0xFF, 0xD6, 0x32, 0x98, 0x7E, 0x7E, 0x55, 0x20,
+    0xA6, 0x87, 0x16, 0xA5, 0x87, 0x7E, 0xA2, 0x77, 0x66, 0x9C, 0x99, 0x90, 0x7A, 0x9B, 0x89, 0x66,
+    0xC0, 0x66, 0x19, 0xC1, 0x21, 0x5A, 0xC4, 0x19, 0xC0, 0x66, 0x69, 0xC4, 0x7A, 0xC1, 0x66, 0x32,
+    0x9D, 0x97, 0x9C, 0x87, 0x9A, 0x88, 0x9D, 0x88, 0x66, 0x7E, 0xA2, 0x88, 0xA3, 0x99, 0xA4, 0x79,
+    0xA3, 0x89, 0xA2, 0x89, 0xA3, 0x99, 0x6E, 0xC1, 0x6E, 0xC1, 0x06, 0x59, 0x10, 0xB6, 0x85, 0xA1,
+    0x93, 0x9C, 0x74, 0x9D, 0x86, 0x9C, 0x86, 0x9A, 0x78, 0x9C, 0x89, 0x6F, 0x5B, 0x42, 0x9D, 0x8A,
+    0x9B, 0x99, 0xA4, 0x86, 0xA6, 0xA7, 0xA1, 0xA9, 0x55, 0x6E, 0xA1, 0xA8, 0xA2, 0x98, 0x6D, 0xA2,
+    0x97, 0x47, 0x52, 0xA4, 0x8A, 0x97, 0x6F, 0x93, 0x6E, 0xA1, 0x7A, 0xA8, 0x96, 0x9F, 0x86, 0x54,
+    0xA5, 0x87, 0xA6, 0x97, 0xA3, 0xAA, 0x99, 0x9A, 0xAC, 0xAC, 0x11, 0x98, 0xA8, 0x67, 0x55, 0x41,
+    0x52, 0x55, 0xC0, 0x66, 0x5A, 0xC0, 0xAD, 0x98, 0xC0, 0x7E, 0x5A, 0x3F, 0x65, 0x56, 0x51, 0x51,
+    0x51, 0xC0, 0x23, 0x5A, 0x23, 0x2F, 0x7E, 0x03, 0x0B, 0x17, 0xC2, 0x66, 0xC0, 0x17, 0xC0, 0x0B,
+    0xB3, 0x73, 0x9A, 0x83, 0x94, 0x77, 0x9D, 0x5E, 0x98, 0x5F, 0x6B, 0xA2, 0x78, 0xA2, 0x88, 0x7E,
+    0x65, 0x9D, 0x99, 0x5A, 0xA2, 0x87, 0x3B, 0x07, 0x1F, 0x9C, 0x88, 0x1F, 0xA2, 0x88, 0x3B, 0x1F,
+    0x6E, 0x7B, 0x24, 0xA6, 0xA7, 0xAF, 0xD8, 0x8C, 0x97, 0xA2, 0x88, 0x7A, 0x6B, 0xA3, 0x98, 0xA3,
+    0x88, 0x7F, 0x5B, 0xC1, 0x66, 0x19, 0xC1, 0x14, 0x19, 0x7F, 0x7E, 0x6F, 0x7F, 0x6E, 0xC0, 0x7F,
+    0x6E, 0xC0, 0x6E, 0xC0, 0x24, 0x55, 0x55, 0x51, 0x19, 0x9D, 0x89, 0x55, 0x65, 0x41, 0x62, 0x55,
+    0x66, 0x79, 0x66, 0x7E, 0x7E, 0xC0, 0x7F, 0xA7, 0x98, 0xA7, 0x89, 0xA4, 0x87, 0xA2, 0x88, 0x6E,
+    0x6B, 0x7E, 0x9D, 0x8A, 0x99, 0x89, 0x99, 0x88, 0x9D, 0x89, 0xA2, 0x88, 0x05, 0xA4, 0x98, 0xA4,
+    0x88, 0xA2, 0x88, 0xA2, 0x88, 0x7F, 0x7A, 0x6E, 0x7F, 0x6E, 0x7E, 0x6F, 0x33, 0x62, 0x59, 0xC0,
+    0x10, 0x7A, 0xA3, 0x88, 0x6F, 0xC0, 0x3F, 0xA2, 0x87, 0xC0, 0x1B, 0xC0, 0x27, 0xC0, 0x69, 0xC1,
+    0x1B, 0xC0, 0x5A, 0x61, 0x33, 0x1F, 0x51, 0x10, 0xA2, 0x88, 0x07, 0x27, 0x6E, 0x27, 0x7E, 0xC0,
+    0x27, 0x0C, 0x38, 0x65, 0x1F, 0x9D, 0x88, 0x9D, 0x98, 0x51, 0x51, 0x51, 0x6E, 0x34, 0x65, 0x20,
+    0x65, 0x56, 0x65, 0x9C, 0x89, 0x9C, 0x88, 0x50, 0x51, 0x65, 0xAB, 0x94, 0xB4, 0x80, 0x97, 0x94,
+    0x9A, 0x8A, 0x5A, 0x7E, 0x52, 0xC0, 0xA5, 0x98, 0x55, 0x3B, 0x6B, 0x6E, 0x3B, 0xC0, 0x6E, 0x3B,
+    0x00, 0x0F, 0x9C, 0x8A, 0x9B, 0x9A, 0xA4, 0x76, 0xA2, 0x89, 0x9A, 0x89, 0xA3, 0x88, 0x26, 0xC0,
+    0x36, 0xA3, 0x88, 0x7D, 0xA2, 0x87, 0xA3, 0x87, 0x7E, 0xA7, 0x8D, 0xFF, 0xDE, 0x70, 0xFF, 0xAD,
+    0x13, 0xA2, 0x88, 0x66, 0x59, 0xC1, 0xA6, 0x88, 0xA7, 0x88, 0xA5, 0x99, 0xA2, 0x88, 0x91, 0x99,
+    0x9C, 0x78, 0x7B, 0x1D, 0x66, 0x55, 0x66, 0x5A, 0x66, 0xC0, 0x69, 0x56, 0xC0, 0x21, 0x5A, 0xC0,
+    0x66, 0xC1, 0x21, 0x2D, 0xC0, 0x30, 0xC2, 0x61, 0x55, 0x9D, 0x99, 0x9C, 0x98, 0x9C, 0x87, 0x9B,
+    0x87, 0x9C, 0x88, 0x65, 0x7F, 0xA2, 0x88, 0xA2, 0x89, 0xA4, 0x78, 0xA3, 0x9A, 0xA3, 0x89, 0xA2,
+    0x88, 0xA2, 0x88, 0xC3, 0x6E, 0x06, 0xC1, 0x40, 0xAF, 0x98, 0xB2, 0x65, 0x99, 0xA4, 0x9C, 0x74,
+    0x9C, 0x95, 0x9B, 0x78, 0x9A, 0x89, 0xA2, 0x78, 0x6F, 0x99, 0x7A, 0x9B, 0x8A, 0x51, 0x69, 0xA9,
+    0xA7, 0xA4, 0xA7, 0x04, 0x6E, 0xA1, 0xA8, 0xA2, 0x88, 0x7D, 0xA2, 0x87, 0x6B, 0x9C, 0x8A, 0xA4,
+    0x89, 0x9B, 0x6E, 0x91, 0x5E, 0x9F, 0x8B, 0xA8, 0x86, 0x68, 0x58, 0xA3, 0x98, 0xA7, 0x97, 0xA4,
+    0x99, 0xA1, 0xAA, 0xAA, 0xAB, 0x8D, 0xBA, 0x9B, 0x9A, 0x3A, 0x55, 0x1E, 0x51, 0x55, 0x52, 0x5A,
+    0xC1, 0xB0, 0x97, 0x66, 0xC0, 0x5E, 0x62, 0x55, 0xC1, 0x69, 0x1F, 0x10, 0x51, 0x37, 0x32, 0xC0,
+    0x3C, 0x6B, 0x7E, 0x6F, 0xC2, 0x66, 0x59, 0x0B, 0x12, 0x10, 0xB3, 0x83, 0x96, 0x73, 0x97, 0x78,
+    0x9A, 0x5F, 0x9B, 0x6E, 0x1A, 0xA2, 0x88, 0xA2, 0x78, 0x7E, 0x51, 0x51, 0x6E, 0x33, 0x07, 0xC0,
+    0x9A, 0x88, 0x65, 0x1F, 0xA3, 0x98, 0x33, 0x65, 0xC0, 0x2E, 0x54, 0xAE, 0xB8, 0xA4, 0xB8, 0x22,
+    0xA5, 0x88, 0x7F, 0x7F, 0xA3, 0x98, 0xC0, 0x35, 0x52, 0x51, 0xC0, 0x56, 0x14, 0xC1, 0x55, 0x14,
+    0x28, 0x30, 0x6F, 0xC0, 0x6F, 0x7E, 0xC0, 0x6E, 0xC0, 0x6B, 0x15, 0x10, 0x5A, 0x55, 0x51, 0x9D,
+    0x99, 0x55, 0x55, 0x51, 0x9D, 0x99, 0x51, 0x55, 0x62, 0x65, 0x65, 0x7E, 0x7F, 0x7E, 0x7F, 0xA6,
+    0x88, 0xA9, 0x98, 0xA6, 0x88, 0x6E, 0xC0, 0x6F, 0xA2, 0x87, 0x7B, 0x5A, 0x52, 0x51, 0xC0, 0x17,
+    0xA2, 0x88, 0x6F, 0xC0, 0x2B, 0x6E, 0x7A, 0x6F, 0x7F, 0x6E, 0x6E, 0xC0, 0x13, 0x9D, 0xA9, 0x27,
+    0x55, 0x66, 0x6F, 0x2C, 0x7F, 0x6F, 0xC0, 0x6E, 0xC0, 0x7F, 0x6E, 0x7F, 0xC4, 0x20, 0x1B, 0x0C,
+    0x51, 0x1F, 0x10, 0x66, 0x2B, 0x07, 0x1B, 0x20, 0x6B, 0x6E, 0xC0, 0x1B, 0x07, 0x9D, 0x98, 0x04,
+    0x9A, 0x88, 0x9B, 0x99, 0x9D, 0x88, 0x55, 0xC2, 0x65, 0x66, 0x66, 0x56, 0x65, 0x5A, 0x65, 0x52,
+    0xC0, 0x6E, 0x23, 0xA1, 0x95, 0xB8, 0x70, 0x9D, 0xA2, 0x99, 0x99, 0x9D, 0x8A, 0xA2, 0x87, 0xC0,
+    0x9D, 0x8A, 0xA5, 0x98, 0x7E, 0x41, 0x3B, 0x6B, 0xC0, 0x3B, 0x02, 0x6D, 0xC0, 0x7F, 0x02, 0x9A,
+    0x8A, 0xA2, 0x87, 0xA4, 0x78, 0x9B, 0x9A, 0x55, 0xA3, 0x98, 0x79, 0xA2, 0x77, 0x0F, 0x7E, 0xA2,
+    0x86, 0xA3, 0x87, 0xA2, 0x87, 0xA6, 0x7B, 0xFF, 0xEE, 0xD0, 0xFF, 0xAD, 0x32, 0xA1, 0x9A, 0x55,
+    0x66, 0xC3, 0xA4, 0x88, 0x6E, 0x20, 0x6F, 0xC0, 0x34, 0x2C, 0xC2, 0x56, 0x69, 0x56, 0x66, 0x69,
+    0x56, 0x66, 0x59, 0x66, 0x7A, 0x35, 0x01, 0x09, 0x0C, 0x6F, 0xC0, 0x11, 0x51, 0x9D, 0x99, 0x9D,
+    0x99, 0x9B, 0x98, 0x9C, 0x98, 0x9B, 0x97, 0x9C, 0x78, 0x9D, 0x98, 0x6F, 0x0C, 0xA3, 0x98, 0xA3,
+    0x89, 0xA3, 0x8A, 0xA3, 0x99, 0xA2, 0x89, 0xA2, 0x88, 0x6E, 0xC3, 0x0B, 0x06, 0x69, 0x56, 0x66,
+    0x37, 0xB4, 0x76, 0xAB, 0x86, 0x9B, 0xA5, 0x9E, 0x74, 0x9D, 0x87, 0x9A, 0x78, 0x98, 0x89, 0x9C,
+    0x78, 0x9B, 0x78, 0x52, 0x5A, 0x55, 0xA5, 0xA7, 0xA8, 0xB8, 0x50, 0x6E, 0x7E, 0xA2, 0x98, 0xA2,
+    0x86, 0x36, 0x6F, 0x9B, 0x9B, 0xA4, 0x89, 0x9E, 0x6C, 0x90, 0x5E, 0x9C, 0x7B, 0xA8, 0x86, 0xA2,
+    0x76, 0x64, 0xA2, 0x88, 0xA7, 0x87, 0xA5, 0xA9, 0xA1, 0xA9, 0xA9, 0xBB, 0x8C, 0xAC, 0x9D, 0xA9,
+    0x5A, 0x65, 0x52, 0x51, 0x55, 0x42, 0x56, 0x6E, 0xC0, 0xAE, 0xA7, 0xC1, 0xA1, 0x8A, 0x50, 0x51,
+    0x24, 0x6B, 0x6E, 0x33, 0x24, 0x61, 0x56, 0x55, 0x32, 0x37, 0x6F, 0xC0, 0x0B, 0x6F, 0xC2, 0x66,
+    0x0B, 0x03, 0x24, 0xB2, 0x71, 0x93, 0x85, 0x99, 0x6A, 0x97, 0x5F, 0x9E, 0x7C, 0x6F, 0xA2, 0x88,
+    0xA2, 0x78, 0x7A, 0x9D, 0x88, 0x1F, 0x6F, 0xA2, 0x88, 0xA2, 0x88, 0x9D, 0x88, 0x9A, 0x98, 0xA2,
+    0x88, 0x33, 0x7F, 0x33, 0x65, 0x6B, 0x33, 0x64, 0xB2, 0xB8, 0xA0, 0xB8, 0x60, 0xA3, 0x89, 0x7A,
+    0xA2, 0x78, 0x7F, 0x51, 0x51, 0x9D, 0x99, 0x51, 0xC1, 0x6E, 0xC0, 0x3C, 0x55, 0x66, 0xC0, 0x2D,
+    0x3C, 0xC0, 0x01, 0xC0, 0x6B, 0xC3, 0x01, 0xC0, 0x55, 0x51, 0x56, 0x55, 0x66, 0x9D, 0x88, 0x9D,
+    0x99, 0x51, 0x55, 0x66, 0x19, 0x51, 0x79, 0x7A, 0x6F, 0x7E, 0xA2, 0x87, 0xA8, 0x99, 0xAA, 0x88,
+    0xA3, 0x98, 0x6E, 0xA3, 0x88, 0xA2, 0x89, 0x7A, 0x38, 0x7F, 0xC0, 0x6E, 0x07, 0xC1, 0x38, 0x66,
+    0xC0, 0xA2, 0x77, 0x07, 0xC0, 0x6F, 0x6E, 0xC0, 0x13, 0x61, 0x51, 0x50, 0x04, 0x7B, 0xA3, 0x88,
+    0x6E, 0xC0, 0x3B, 0x07, 0xC0, 0x7F, 0xA2, 0x77, 0x7B, 0xC1, 0x6E, 0x2A, 0x55, 0xC1, 0x02, 0x27,
+    0x9D, 0x89, 0x51, 0x65, 0x3F, 0xA4, 0x78, 0x07, 0x0C, 0x1B, 0x0C, 0x07, 0x27, 0x0B, 0x9C, 0x87,
+    0x98, 0x98, 0x99, 0x88, 0x9D, 0x89, 0xC0, 0x6E, 0xA2, 0x88, 0xA2, 0x88, 0x7A, 0x15, 0x66, 0xC0,
+    0x66, 0x5A, 0xC1, 0x0B, 0xC2, 0x55, 0xB1, 0x81, 0xA4, 0xA0, 0x98, 0x87, 0x9C, 0x89, 0x7E, 0x6F,
+    0x9D, 0x99, 0xA2, 0x88, 0xA6, 0x77, 0x0F, 0x51, 0xC0, 0x02, 0xC1, 0x7E, 0x69, 0x6E, 0x0F, 0x99,
+    0x9B, 0x5A, 0xA4, 0x87, 0x52, 0x9B, 0x9A, 0x2D, 0x69, 0xA2, 0x87, 0x0F, 0x6E, 0x7D, 0xA4, 0x86,
+    0xA2, 0x77, 0xA5, 0x8A, 0xFF, 0xFF, 0x50, 0xFF, 0xB5, 0x30, 0x9D, 0x8C, 0xC4, 0x6E, 0x7F, 0xC0,
+    0x6F, 0x7E, 0x6F, 0x7A, 0xC0, 0x6E, 0xC1, 0x2F, 0x2C, 0xC0, 0x66, 0x20, 0xC0, 0x5A, 0xC0, 0x18,
+    0x1D, 0x20, 0x27, 0xC0, 0x20, 0xC1, 0x61, 0x9D, 0x88, 0x52, 0x9C, 0x98, 0x9B, 0x98, 0x9B, 0x87,
+    0x9C, 0x87, 0x9D, 0x89, 0xC0, 0x7F, 0xA2, 0x88, 0xA3, 0x99, 0xA2, 0x89, 0xA3, 0x89, 0xA2, 0x88,
+    0xA2, 0x89, 0xA2, 0x88, 0xC0, 0x6E, 0xC1, 0x6E, 0x06, 0x3A, 0xC1, 0x5A, 0x66, 0x37, 0xAB, 0x88,
+    0xAE, 0x85, 0xA4, 0x85, 0x97, 0x85, 0x96, 0x76, 0x95, 0x78, 0x5A, 0xC0, 0x45, 0x66, 0x56, 0x69,
+    0xAB, 0xB7, 0xA0, 0xA8, 0x55, 0x7E, 0xA2, 0x87, 0xA3, 0x98, 0x69, 0xA2, 0x89, 0x9B, 0x9A, 0xA3,
+    0x89, 0xA0, 0x7C, 0x90, 0x5E, 0x9B, 0x7B, 0xA7, 0x87, 0xA4, 0x86, 0x50, 0x0C, 0xA5, 0x87, 0xA7,
+    0x97, 0xA1, 0xBA, 0xAB, 0xBB, 0x8C, 0xAB, 0x9B, 0x9A, 0x7E, 0xC0, 0x3F, 0x65, 0x42, 0x41, 0x9D,
+    0x89, 0x6B, 0xC0, 0xAE, 0xA6, 0x6E, 0x67, 0x6E, 0x51, 0x55, 0x6B, 0x6E, 0xC1, 0x1F, 0x55, 0x66,
+    0x3F, 0x56, 0x5A, 0x37, 0xC0, 0x6F, 0xC0, 0x6E, 0xC2, 0x0B, 0x03, 0xA6, 0x86, 0xB1, 0x82, 0x91,
+    0x75, 0x97, 0x5D, 0x97, 0x6F, 0xA1, 0x8A, 0xA1, 0x8A, 0xA2, 0x88, 0xA2, 0x87, 0x56, 0x9D, 0x98,
+    0xC0, 0xA2, 0x88, 0x07, 0x6F, 0x9A, 0x88, 0x9D, 0x98, 0xA3, 0x88, 0x33, 0x07, 0x9D, 0x99, 0x59,
+    0x2E, 0x33, 0xA1, 0xA8, 0xB6, 0xB7, 0xA0, 0xA8, 0x75, 0x6F, 0x66, 0xC3, 0x11, 0xC1, 0x20, 0x25,
+    0x20, 0xC0, 0x11, 0x9C, 0x99, 0x9D, 0x88, 0x51, 0x66, 0x3C, 0xC1, 0x6E, 0xC3, 0x3C, 0xC0, 0x55,
+    0x55, 0x56, 0x65, 0x41, 0x9D, 0x99, 0x9D, 0x88, 0x66, 0x66, 0x55, 0xC0, 0x62, 0x65, 0x69, 0x7E,
+    0xC0, 0x66, 0xA3, 0x98, 0xA6, 0x98, 0xAA, 0x88, 0xA6, 0x88, 0xA3, 0x88, 0xA3, 0x89, 0xC1, 0xA2,
+    0x88, 0x1B, 0x6E, 0x1B, 0x0C, 0xC0, 0x66, 0x38, 0x66, 0xC0, 0xA2, 0x77, 0x07, 0xC0, 0x0C, 0xC0,
+    0x7B, 0x51, 0x51, 0x3F, 0x03, 0xC0, 0xA5, 0x88, 0x18, 0x7F, 0xC0, 0x6E, 0x33, 0x07, 0x1B, 0x20,
+    0x1B, 0xC0, 0x7E, 0x20, 0x61, 0x07, 0xC0, 0x33, 0x3F, 0x9B, 0x88, 0x9B, 0x99, 0x9D, 0x88, 0xC0,
+    0x1B, 0x08, 0xA3, 0x99, 0x5A, 0x03, 0x9D, 0x89, 0x9D, 0x88, 0x1F, 0x51, 0x55, 0x66, 0x56, 0xC0,
+    0x6E, 0x7F, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0x2B, 0x5A, 0xC0, 0x2B, 0x6F, 0xC4, 0x56, 0xA8, 0x83,
+    0xFF, 0xE6, 0x4B, 0x97, 0x94, 0x9C, 0x88, 0x52, 0x7F, 0xC0, 0x51, 0xA6, 0x87, 0xC0, 0x9D, 0x89,
+    0xC3, 0x7D, 0xC0, 0x6E, 0xA1, 0x8A, 0x99, 0x9B, 0x51, 0xA5, 0x86, 0xA0, 0x8A, 0x99, 0x9A, 0x28,
+    0x6E, 0x7E, 0xA3, 0x87, 0xA3, 0x97, 0x15, 0xA3, 0x87, 0xA3, 0x87, 0xA3, 0x89, 0xAA, 0x7F, 0xFF,
+    0xBD, 0x6F, 0x96, 0x7D, 0x7F, 0x6E, 0x10, 0xC0, 0x15, 0x7F, 0x7E, 0x6F, 0xA2, 0x88, 0x7F, 0x6E,
+    0xC0, 0x6F, 0x7A, 0xC0, 0x56, 0xC2, 0x20, 0xC0, 0x27, 0xC2, 0x2C, 0xC2, 0x20, 0x1B, 0x65, 0x55,
+    0x9C, 0x89, 0x51, 0x9C, 0x98, 0x9A, 0x97, 0x9A, 0x87, 0x9D, 0x88, 0xC0, 0xA2, 0x78, 0x7F, 0xA2,
+    0x98, 0xA3, 0x8A, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x79, 0x7F, 0xA2, 0x87, 0xC0, 0x6B, 0xC0, 0x6E,
+    0x3A, 0x6E, 0x06, 0x0B, 0x7A, 0x0B, 0x06, 0x55, 0x1E, 0xA6, 0x86, 0xAE, 0x72, 0x9A, 0x72, 0x99,
+    0x77, 0x9D, 0x8A, 0xA2, 0x78, 0x9D, 0x89, 0x55, 0x57, 0x56, 0x50, 0xA9, 0xB7, 0xA3, 0xB8, 0x55,
+    0x6E, 0xA1, 0xA8, 0xA3, 0x88, 0x7D, 0xA3, 0x99, 0x9B, 0x8A, 0xA1, 0x8A, 0xA2, 0x8A, 0x92, 0x5E,
+    0x98, 0x6C, 0xA5, 0x88, 0xA7, 0x95, 0x9D, 0x88, 0xA2, 0x89, 0xA5, 0x86, 0xA7, 0x98, 0xA2, 0xB9,
+    0xAB, 0xAB, 0x8C, 0xBB, 0x98, 0x8A, 0x3F, 0x6E, 0x7A, 0xC0, 0x55, 0x2B, 0x42, 0x9D, 0x89, 0x56,
+    0x15, 0xA2, 0x88, 0x24, 0x1F, 0xC1, 0x6F, 0x7E, 0x6E, 0x56, 0x1F, 0x10, 0xC0, 0x61, 0x41, 0x66,
+    0x28, 0xC0, 0x6B, 0xC0, 0x7E, 0xC1, 0x6F, 0xC0, 0x55, 0xA9, 0x96, 0xAE, 0x72, 0x91, 0x75, 0x96,
+    0x5D, 0xFF, 0x1A, 0xCB, 0xA1, 0x9A, 0x7F, 0xA3, 0x78, 0x7E, 0x51, 0x51, 0xC0, 0x33, 0xA3, 0x88,
+    0x07, 0x9A, 0x88, 0x55, 0x1A, 0xA4, 0x87, 0x6B, 0x50, 0x1F, 0x7F, 0x27, 0xA6, 0xA8, 0xB6, 0xB9,
+    0x74, 0x66, 0xC0, 0x65, 0x55, 0x6B, 0xA2, 0x87, 0xC0, 0x00, 0x7E, 0x6E, 0xC0, 0x7F, 0xC0, 0x0D,
+    0xC0, 0x39, 0x9C, 0x98, 0x9B, 0x89, 0x9B, 0x99, 0x59, 0x6B, 0xC0, 0x7E, 0xC4, 0x5A, 0x51, 0x65,
+    0x5A, 0x51, 0x9D, 0x88, 0x9D, 0x99, 0x51, 0xC1, 0x56, 0x65, 0x66, 0x65, 0x66, 0x0D, 0x08, 0x69,
+    0x7F, 0xA1, 0xA8, 0xA4, 0x88, 0xA6, 0x88, 0xAA, 0x87, 0xA7, 0x89, 0x7E, 0x6F, 0xA2, 0x88, 0xA2,
+    0x88, 0xC0, 0x66, 0x51, 0x65, 0xC0, 0x38, 0x24, 0x66, 0x7E, 0x6F, 0xC1, 0x38, 0x62, 0x9D, 0x98,
+    0x9B, 0x98, 0x9A, 0x88, 0x9A, 0x78, 0x51, 0xA4, 0x87, 0xA4, 0x88, 0xA4, 0x78, 0xA2, 0x99, 0x1C,
+    0xC0, 0xA2, 0x88, 0xA4, 0x88, 0xA2, 0x88, 0xC0, 0x27, 0xC0, 0x18, 0x66, 0x51, 0x51, 0x9D, 0x88,
+    0x9B, 0x99, 0x9B, 0x88, 0x9B, 0x99, 0x41, 0x7A, 0xC0, 0xA2, 0x78, 0x37, 0x6E, 0x37, 0xC1, 0x03,
+    0xC0, 0x6F, 0xC0, 0x66, 0x0F, 0xC0, 0x7F, 0x6E, 0xA2, 0x88, 0x7F, 0x6E, 0xC2, 0x6E, 0xC2, 0x0B,
+    0xC0, 0xA2, 0x88, 0x39, 0xAA, 0x91, 0x9A, 0x90, 0x9B, 0x87, 0x9C, 0x9A, 0xA2, 0x77, 0x7B, 0x41,
+    0xA3, 0x98, 0xA4, 0x87, 0x9D, 0x99, 0x02, 0xC2, 0x0A, 0x69, 0x6E, 0x7F, 0x9B, 0x8B, 0x9B, 0x9A,
+    0xA5, 0x86, 0xA2, 0x89, 0x99, 0x8B, 0xA2, 0x87, 0xA2, 0x87, 0x35, 0xA3, 0x87, 0xA3, 0x97, 0xC0,
+    0xA2, 0x86, 0xA4, 0x76, 0xA2, 0x89, 0xAA, 0x7E, 0xFF, 0xC5, 0xCF, 0x8E, 0x8D, 0x24, 0x66, 0x59,
+    0xC0, 0x1F, 0x24, 0xA2, 0x88, 0x6F, 0x7F, 0xA2, 0x88, 0xA3, 0x89, 0x6E, 0xC0, 0x7F, 0xC2, 0x5A,
+    0x66, 0xC0, 0x18, 0x1B, 0xC1, 0x6F, 0xC1, 0x69, 0xC0, 0x1B, 0x65, 0x51, 0x51, 0x04, 0x9C, 0x99,
+    0x9B, 0x98, 0x9B, 0x87, 0x9C, 0x88, 0x55, 0xA2, 0x88, 0x7F, 0x34, 0xA2, 0x89, 0xA3, 0x89, 0xA2,
+    0x88, 0xA2, 0x88, 0x26, 0x6B, 0x6E, 0x3A, 0xC3, 0x0B, 0xA2, 0x98, 0xC1, 0x5A, 0x65, 0x52, 0x37,
+    0x50, 0xAE, 0x82, 0xA4, 0x61, 0x98, 0x75, 0x99, 0x8B, 0xA2, 0x79, 0x52, 0x41, 0x56, 0xC0, 0x9D,
+    0x89, 0xA5, 0xA7, 0xA8, 0xA7, 0x61, 0xC0, 0x7E, 0xA3, 0x97, 0xA2, 0x87, 0xA2, 0x98, 0x9B, 0x8B,
+    0x6E, 0xA3, 0x8B, 0x95, 0x6E, 0x96, 0x5C, 0xA2, 0x98, 0xAA, 0x75, 0x9D, 0x97, 0x6F, 0xA5, 0x87,
+    0xA7, 0x97, 0xA2, 0xA9, 0xAA, 0xBB, 0x8F, 0xAC, 0x17, 0xA6, 0x87, 0xC0, 0x66, 0x0C, 0x6B, 0x10,
+    0x51, 0x9C, 0x88, 0x9D, 0x89, 0x65, 0xA3, 0x89, 0xA2, 0x88, 0x6E, 0x7F, 0x7F, 0x10, 0xA2, 0x88,
+    0xC0, 0x1F, 0xC0, 0x13, 0x56, 0x3C, 0x9D, 0x99, 0x14, 0x6B, 0x23, 0xC1, 0x6F, 0xC2, 0x7F, 0x51,
+    0xAE, 0x74, 0xAA, 0x73, 0x90, 0x75, 0x96, 0x4D, 0x9A, 0x6F, 0xA2, 0x89, 0xA2, 0x88, 0xA2, 0x78,
+    0x7E, 0x51, 0x51, 0x6F, 0xA2, 0x87, 0xA3, 0x99, 0x2B, 0x9D, 0x98, 0xC0, 0x1F, 0xA3, 0x98, 0xC0,
+    0x2E, 0x69, 0x33, 0x27, 0xAE, 0xB8, 0xB1, 0xB9, 0x60, 0x65, 0x6B, 0x65, 0x51, 0xC0, 0x6E, 0x08,
+    0x0D, 0x7F, 0xA2, 0x88, 0x6E, 0xC2, 0x30, 0x1C, 0x08, 0x9A, 0x88, 0x99, 0x99, 0x9D, 0x88, 0x6E,
+    0x6B, 0xC4, 0x2D, 0xC0, 0x56, 0x16, 0x66, 0x40, 0x9C, 0x88, 0x51, 0x66, 0x66, 0x32, 0x56, 0xC0,
+    0x65, 0x66, 0x65, 0x66, 0x0D, 0xA2, 0x88, 0xA3, 0xA9, 0x23, 0x55, 0x66, 0xA4, 0x97, 0xAB, 0x89,
+    0xA7, 0x88, 0x7F, 0xA2, 0x88, 0x6E, 0xC0, 0x07, 0x33, 0x24, 0x66, 0x9C, 0x88, 0x9C, 0x87, 0x9D,
+    0x89, 0x7A, 0x08, 0x23, 0x55, 0x51, 0x9D, 0x99, 0x9B, 0x98, 0x9D, 0x98, 0x55, 0x51, 0x56, 0xC0,
+    0x7F, 0x6E, 0x7F, 0xA2, 0x87, 0x6F, 0x7E, 0x6F, 0x7F, 0x6E, 0xC0, 0x07, 0x38, 0xC0, 0x33, 0x24,
+    0x66, 0x6F, 0xC0, 0x56, 0x0F, 0xC0, 0x55, 0x7A, 0xC0, 0x6E, 0x0F, 0x6E, 0x20, 0x23, 0xC6, 0x6F,
+    0x7E, 0xA2, 0x88, 0x7F, 0x6E, 0xC6, 0xA2, 0x88, 0xA3, 0x98, 0xA2, 0x78, 0xA5, 0xA4, 0xFF, 0xDD,
+    0xE8, 0x99, 0x85, 0x9B, 0x9A, 0xC0, 0x7F, 0x2E, 0x66, 0xA7, 0x88, 0x55, 0x02, 0x3D, 0x02, 0xC0,
+    0x6E, 0x79, 0x6E, 0x7F, 0x3D, 0x9B, 0x8A, 0xA3, 0x87, 0x07, 0x9A, 0x8B, 0x51, 0xA4, 0x87, 0x7E,
+    0x02, 0xA4, 0x76, 0x7A, 0xA2, 0x86, 0xA4, 0x86, 0xA2, 0x78, 0xA8, 0x8D, 0xFF, 0xDE, 0xB0, 0x85,
+    0x9F, 0x9F, 0xAB, 0x30, 0x28, 0xC0, 0x30, 0xC0, 0x37, 0x6E, 0xA2, 0x89, 0xA2, 0x88, 0xA2, 0x88,
+    0xA2, 0x88, 0x6E, 0x6F, 0x7E, 0x33, 0x6E, 0x33, 0xC1, 0x38, 0x7F, 0xC0, 0x6E, 0xC3, 0x07, 0x65,
+    0x27, 0x13, 0x9D, 0x98, 0x17, 0x9C, 0x88, 0x9A, 0x97, 0x50, 0x51, 0xC0, 0x14, 0xA3, 0x89, 0xA2,
+    0x88, 0xA2, 0x8A, 0xA3, 0x88, 0x7F, 0x6F, 0x7E, 0x6B, 0x6E, 0xC0, 0x6E, 0xC0, 0x3A, 0x13, 0x27,
+    0x7F, 0x27, 0xC0, 0x1F, 0x13, 0x0B, 0x06, 0x40, 0xAB, 0x94, 0xA8, 0x71, 0x98, 0x63, 0x98, 0x7A,
+    0x6B, 0x5B, 0x41, 0x66, 0x56, 0x41, 0xA1, 0xA9, 0xAA, 0xB6, 0x69, 0x66, 0x7E, 0xA3, 0x98, 0x7D,
+    0xA3, 0x88, 0x9B, 0x9B, 0xC0, 0xA5, 0x89, 0x97, 0x6E, 0x93, 0x6E, 0x6F, 0xAA, 0x85, 0x68, 0x51,
+    0xA5, 0x88, 0xA8, 0x86, 0xA1, 0xBA, 0xAC, 0xAA, 0x90, 0xAC, 0x8F, 0x9A, 0x3F, 0x18, 0xC0, 0x66,
+    0xC0, 0x27, 0x18, 0x9C, 0x88, 0x9D, 0x89, 0x99, 0x89, 0xA2, 0x88, 0xA2, 0x78, 0x7F, 0x7F, 0x7E,
+    0xA2, 0x87, 0xA2, 0x88, 0x6F, 0x7E, 0x66, 0x69, 0x3F, 0x30, 0x2B, 0x56, 0x65, 0x1B, 0xC1, 0x6E,
+    0xC1, 0x23, 0x6F, 0x23, 0xB0, 0x75, 0xA7, 0x83, 0x8F, 0x67, 0x97, 0x5D, 0x9C, 0x6E, 0xA1, 0x9B,
+    0xA2, 0x87, 0xA2, 0x78, 0x7E, 0x9D, 0x89, 0x65, 0xA2, 0x88, 0x07, 0x6E, 0x9A, 0x88, 0x66, 0x10,
+    0x1F, 0x07, 0x33, 0x2E, 0xC0, 0x33, 0x65, 0xB5, 0xC8, 0xAB, 0xB9, 0x60, 0x66, 0xC0, 0x55, 0x52,
+    0x69, 0x7E, 0x0D, 0x1C, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0x7F, 0x09, 0x04, 0x55, 0x21, 0x0D, 0x9C,
+    0x98, 0x98, 0x79, 0x9A, 0x88, 0x7A, 0xA2, 0x78, 0xC3, 0x69, 0x66, 0x25, 0xC0, 0x55, 0x51, 0x9C,
+    0x88, 0x9D, 0x88, 0x66, 0xC2, 0x56, 0xC0, 0x65, 0x66, 0x7E, 0xA3, 0x99, 0xA4, 0x87, 0xA3, 0x99,
+    0xA2, 0x88, 0x7A, 0x3C, 0x9D, 0x99, 0x17, 0xA2, 0x98, 0x0F, 0xA6, 0x88, 0xA3, 0x98, 0x6E, 0x56,
+    0x60, 0x9D, 0x99, 0x9C, 0x88, 0x9B, 0x88, 0x99, 0x89, 0x9C, 0x88, 0x66, 0x28, 0x7F, 0xA2, 0x78,
+    0x69, 0x66, 0x56, 0x69, 0xC1, 0x34, 0x3C, 0xC2, 0x01, 0x08, 0x10, 0x6E, 0x01, 0x3C, 0xC0, 0x01,
+    0x15, 0xC0, 0x6F, 0x7F, 0x6B, 0xC0, 0x6F, 0xC1, 0x69, 0x2F, 0x55, 0xC1, 0x25, 0x6F, 0x7A, 0xC4,
+    0x37, 0xC0, 0x3E, 0xC1, 0x03, 0x7E, 0x1F, 0x6F, 0xC5, 0x7A, 0xA5, 0x88, 0xA2, 0x87, 0x6B, 0xA2,
+    0x96, 0xFF, 0xE6, 0x4D, 0x97, 0x93, 0x9C, 0x77, 0x62, 0x6F, 0x66, 0x51, 0xA5, 0x98, 0x2A, 0x50,
+    0x52, 0x6E, 0xC1, 0x7D, 0xC0, 0x6F, 0x53, 0x99, 0x9A, 0xA3, 0x87, 0x07, 0x9C, 0x8B, 0x9A, 0x89,
+    0xA5, 0x97, 0x35, 0x02, 0xA3, 0x87, 0xA2, 0x87, 0x69, 0xA4, 0x86, 0xA2, 0x88, 0xA6, 0x7C, 0xA4,
+    0x7F, 0x82, 0x8F, 0x9B, 0xAB, 0xC0, 0x56, 0x65, 0xC1, 0x6B, 0x14, 0x23, 0xA2, 0x78, 0x7F, 0x6E,
+    0x17, 0x6E, 0x7F, 0xC0, 0x30, 0xC1, 0x7F, 0xA2, 0x88, 0x6E, 0x6F, 0x7E, 0x6B, 0xC0, 0x2C, 0x24,
+    0x51, 0x37, 0x17, 0x9D, 0x99, 0x23, 0x0F, 0x9D, 0x98, 0x9D, 0x88, 0x65, 0xC0, 0xA2, 0x78, 0x2F,
+    0xA3, 0x88, 0x23, 0x3E, 0xA2, 0x78, 0x7F, 0x7E, 0xC0, 0x2B, 0x6B, 0xC1, 0x3F, 0x13, 0xA3, 0x98,
+    0x7F, 0x2F, 0xC0, 0x56, 0x65, 0x13, 0xC0, 0x0B, 0x32, 0xA9, 0x84, 0xAB, 0x82, 0x98, 0x63, 0x9B,
+    0x78, 0x9A, 0x8A, 0xA2, 0x79, 0x51, 0x05, 0x3D, 0x56, 0x51, 0xA9, 0xB7, 0xA3, 0xA8, 0x55, 0x7E,
+    0xA2, 0x97, 0xA2, 0x98, 0x6F, 0x9B, 0x8A, 0xA2, 0x97, 0xA5, 0x99, 0x99, 0x6D, 0x92, 0x5D, 0x9F,
+    0x8B, 0xA9, 0x96, 0xA3, 0x86, 0x50, 0xA4, 0x77, 0xA7, 0x98, 0xA2, 0xA9, 0xAB, 0xBB, 0x95, 0x9C,
+    0x89, 0x9B, 0xA6, 0x97, 0xA5, 0x98, 0xA2, 0x88, 0x1B, 0x18, 0xC0, 0x6F, 0x9D, 0x98, 0x9D, 0x8A,
+    0x97, 0x79, 0x7A, 0x6E, 0x6F, 0xA2, 0x88, 0x7E, 0xC0, 0x7A, 0x6E, 0x7F, 0x79, 0xC0, 0xA2, 0x88,
+    0x3F, 0xC1, 0x06, 0x55, 0x55, 0x1B, 0x69, 0xC0, 0x1B, 0x6E, 0x7A, 0x20, 0xB3, 0x95, 0xA2, 0x62,
+    0x91, 0x68, 0x96, 0x5E, 0x9D, 0x7E, 0xA2, 0x89, 0x7E, 0xA2, 0x78, 0x7E, 0x9C, 0x88, 0xC0, 0xA3,
+    0x88, 0xA2, 0x89, 0x9D, 0x98, 0x0B, 0xC0, 0x6F, 0x33, 0x07, 0x33, 0x2E, 0xC1, 0xA3, 0x97, 0xB7,
+    0xC9, 0xA5, 0xB8, 0x65, 0x6B, 0xC0, 0x65, 0x51, 0x56, 0x08, 0x6E, 0x1C, 0xA3, 0x88, 0xA2, 0x88,
+    0x7F, 0xC1, 0x09, 0x66, 0x51, 0x1C, 0x08, 0x96, 0x88, 0x97, 0x99, 0x56, 0xA2, 0x87, 0xA2, 0x88,
+    0xC0, 0x6F, 0xC0, 0x69, 0x56, 0xC0, 0x16, 0x51, 0x9C, 0x88, 0x9D, 0x89, 0x69, 0x66, 0xC2, 0x56,
+    0x65, 0xC0, 0xA4, 0x99, 0x14, 0xA4, 0x87, 0xA2, 0x98, 0x6F, 0x79, 0x3B, 0x9C, 0x88, 0x9D, 0x89,
+    0x50, 0x9C, 0x98, 0x6F, 0xA5, 0x98, 0xA6, 0x88, 0xA2, 0x77, 0x51, 0x9C, 0x98, 0x9B, 0xA9, 0x41,
+    0x41, 0x51, 0x6F, 0x7F, 0xC0, 0x6E, 0xC1, 0x6E, 0x6B, 0x6E, 0x7A, 0xC1, 0x6F, 0xC0, 0x1C, 0x6F,
+    0xC2, 0x1C, 0x55, 0x08, 0x0D, 0x6E, 0x7F, 0x6F, 0x7E, 0xA1, 0x8A, 0x7E, 0x08, 0xC2, 0x6F, 0x0F,
+    0x55, 0xC7, 0x65, 0xC1, 0x6B, 0x7A, 0xC2, 0x6E, 0xA2, 0x88, 0x7E, 0x6F, 0xC4, 0xA3, 0x98, 0xA4,
+    0x87, 0x6B, 0x6E, 0x2F, 0xA6, 0x91, 0x9C, 0x80, 0x9A, 0x86, 0x9C, 0x99, 0xC1, 0x66, 0x69, 0xA6,
+    0x88, 0x69, 0x51, 0x5A, 0xC1, 0x6E, 0x79, 0x6F, 0x67, 0x99, 0x9A, 0x6E, 0xA4, 0x76, 0x9F, 0x9B,
+    0x98, 0x8A, 0xA4, 0x87, 0x35, 0xA2, 0x87, 0xA2, 0x87, 0xA2, 0x88, 0x6C, 0xA3, 0x97, 0xA2, 0x77,
+    0xA5, 0x8C, 0xA9, 0x7F, 0x86, 0x9E, 0x91, 0x9D, 0x7F, 0x66, 0x65, 0xC1, 0x6B, 0x03, 0xC0, 0x08,
+    0x6F, 0x7A, 0x6F, 0x6E, 0xC2, 0x6B, 0xC1, 0xA2, 0x88, 0xA2, 0x88, 0x7F, 0x6E, 0xA2, 0x88, 0x5A,
+    0x2B, 0x55, 0x51, 0x2F, 0x9D, 0x98, 0x51, 0x51, 0x55, 0x60, 0x5A, 0x00, 0xA2, 0x78, 0xA1, 0xA9,
+    0xA3, 0x89, 0xA2, 0x88, 0xA2, 0x89, 0xA3, 0x88, 0xA1, 0x8A, 0x6E, 0x26, 0x2B, 0x6B, 0xC0, 0x6E,
+    0x3F, 0xA2, 0x88, 0xA3, 0x98, 0x7E, 0x6B, 0x37, 0x2F, 0x66, 0x5A, 0x66, 0xC0, 0x13, 0x3F, 0xA5,
+    0x87, 0xAE, 0x72, 0x98, 0x71, 0x9D, 0x76, 0x97, 0x8C, 0xA2, 0x89, 0x4A, 0x51, 0x52, 0x5A, 0x9D,
+    0x99, 0xA2, 0x98, 0xAB, 0x97, 0x75, 0x75, 0xA2, 0x97, 0xA3, 0x88, 0x53, 0x9B, 0x89, 0xA5, 0xA7,
+    0xA6, 0x88, 0x9A, 0x7C, 0x92, 0x4D, 0x9D, 0x8B, 0xA7, 0x97, 0xA6, 0x85, 0x54, 0xA2, 0x78, 0xA6,
+    0x97, 0xA2, 0xAA, 0xAB, 0xBA, 0x99, 0x9D, 0x86, 0x8A, 0xA3, 0x88, 0xA5, 0xA8, 0xA4, 0x98, 0xC0,
+    0x5A, 0xC0, 0x10, 0x3C, 0x66, 0x41, 0x9D, 0x99, 0x9C, 0x78, 0x56, 0x7F, 0x1C, 0x24, 0x6F, 0x7A,
+    0x7E, 0x7E, 0x08, 0xA2, 0x88, 0xA2, 0x98, 0xA2, 0x89, 0x13, 0xC1, 0x56, 0x3C, 0x51, 0x51, 0x56,
+    0x7F, 0xC1, 0xB6, 0x83, 0x9D, 0x73, 0x92, 0x6A, 0x96, 0x5D, 0x9F, 0x6D, 0xA2, 0x89, 0xA2, 0x87,
+    0xA2, 0x78, 0x7A, 0x9C, 0x88, 0xC0, 0xA3, 0x89, 0x07, 0x9B, 0x88, 0x52, 0x0B, 0x1F, 0x33, 0x7F,
+    0x51, 0xC1, 0x1F, 0xA8, 0xB7, 0xB7, 0xB9, 0xA0, 0xA7, 0xC0, 0x7B, 0x5A, 0x51, 0x51, 0x65, 0xC0,
+    0xA2, 0x88, 0x21, 0x7F, 0xA2, 0x88, 0xA2, 0x88, 0xC1, 0x55, 0x04, 0x55, 0x21, 0x9D, 0x98, 0x96,
+    0x88, 0x96, 0x88, 0x55, 0x6F, 0x7F, 0xC0, 0x7F, 0xC1, 0x5A, 0x55, 0x9D, 0x99, 0x40, 0x51, 0x66,
+    0xC2, 0x66, 0x55, 0xC0, 0xA3, 0x99, 0x05, 0xA6, 0x98, 0xA5, 0x88, 0x7B, 0x69, 0x66, 0x69, 0x9D,
+    0x99, 0x2C, 0x9C, 0x88, 0x9C, 0x98, 0x9B, 0x89, 0x9D, 0x98, 0x56, 0xA2, 0x88, 0x7E, 0x69, 0x0F,
+    0xC0, 0x6E, 0x23, 0x2F, 0x6E, 0x6B, 0x6E, 0x7E, 0x6F, 0xC0, 0x6B, 0xC0, 0x6F, 0xC0, 0x20, 0x7F,
+    0xC1, 0x6E, 0xC1, 0x2F, 0xC1, 0x20, 0xC0, 0x7E, 0x34, 0x6D, 0x39, 0x7E, 0x7F, 0x6F, 0x6F, 0xC1,
+    0x66, 0x28, 0x23, 0x59, 0x66, 0xC0, 0x56, 0xC1, 0x05, 0x66, 0xC3, 0x7A, 0xC0, 0x66, 0xC1, 0x03,
+    0x6E, 0x7F, 0x7E, 0x6F, 0xC2, 0x7A, 0xA5, 0x88, 0xA3, 0x88, 0x7E, 0x6B, 0x51, 0xA3, 0x96, 0xFF,
+    0xDE, 0x0C, 0x99, 0x83, 0x9B, 0x99, 0x9D, 0x99, 0xA2, 0x88, 0x66, 0x51, 0xA5, 0x88, 0xA4, 0x87,
+    0x16, 0xC0, 0x55, 0xC0, 0x6E, 0x7A, 0x6E, 0x16, 0x21, 0x1C, 0xA4, 0x76, 0x07, 0x97, 0x9C, 0x5A,
+    0xA6, 0x86, 0x3A, 0xA2, 0x87, 0xA3, 0x97, 0xA2, 0x77, 0xA2, 0x86, 0xA2, 0x87, 0xA4, 0x8A, 0xAA,
+    0x6E, 0x8D, 0x9F, 0x88, 0xAE, 0xA2, 0x88, 0x66, 0x28, 0xC1, 0x6B, 0xC0, 0x6E, 0x37, 0x6F, 0xC0,
+    0x6E, 0xC0, 0x6B, 0x08, 0x03, 0xC2, 0x08, 0x0F, 0xA2, 0x88, 0x6E, 0x7F, 0x5A, 0x28, 0x51, 0x0F,
+    0x51, 0x50, 0x56, 0x65, 0x55, 0x66, 0x3D, 0xA2, 0x88, 0xA3, 0x99, 0x08, 0x23, 0x7F, 0xA2, 0x78,
+    0xA2, 0x88, 0xA2, 0x88, 0xC1, 0x6B, 0xC0, 0x6E, 0x06, 0x13, 0x7F, 0xA2, 0x87, 0x6E, 0x2F, 0xC4,
+    0x56, 0x55, 0x0E, 0xA3, 0x78, 0xB0, 0x82, 0x9A, 0x71, 0x9B, 0x75, 0x98, 0x79, 0x9F, 0x9B, 0x5F,
+    0x51, 0x56, 0x56, 0x56, 0x9D, 0x99, 0xA7, 0x98, 0xA6, 0xA8, 0x64, 0x7E, 0xA2, 0x88, 0x9B, 0x99,
+    0x50, 0xA7, 0xA8, 0xA4, 0x98, 0x9E, 0x7B, 0x92, 0x4E, 0x9B, 0x7B, 0xA5, 0x97, 0xA9, 0x95, 0x54,
+    0x6F, 0xA5, 0x88, 0xA3, 0xBA, 0xAA, 0xAA, 0x9B, 0x9C, 0x85, 0x9B, 0x6F, 0xA3, 0x98, 0xA5, 0xA8,
+    0xA4, 0x87, 0x66, 0x56, 0x56, 0x55, 0x66, 0xA8, 0x88, 0x9D, 0x89, 0x9D, 0x88, 0x9C, 0x89, 0x55,
+    0x61, 0x55, 0x52, 0x24, 0x7E, 0x03, 0xA2, 0x88, 0xC0, 0xA2, 0x88, 0x13, 0xA2, 0x88, 0x56, 0x66,
+    0x10, 0x0B, 0x08, 0x51, 0x51, 0x0C, 0x07, 0xA4, 0x87, 0xB6, 0x83, 0x99, 0x64, 0x92, 0x7B, 0x97,
+    0x5E, 0xA0, 0x6C, 0xA2, 0x88, 0xA2, 0x87, 0xA2, 0x88, 0x55, 0x9C, 0x89, 0xA2, 0x88, 0x07, 0x33,
+    0x9C, 0x88, 0xC1, 0xA3, 0x88, 0x38, 0x7B, 0x51, 0xC1, 0x54, 0xAF, 0xC9, 0xB2, 0xB7, 0x9D, 0xA9,
+    0x6E, 0x6B, 0x1C, 0x51, 0x9D, 0x88, 0x9D, 0x99, 0xC0, 0xA5, 0x88, 0x21, 0x7F, 0x6E, 0xA2, 0x88,
+    0xC1, 0x66, 0x35, 0x30, 0x50, 0x9C, 0x76, 0x95, 0x99, 0x9A, 0x88, 0x51, 0x66, 0x56, 0x66, 0x6B,
+    0xC0, 0x5A, 0xC0, 0x55, 0x51, 0xC4, 0x2D, 0x65, 0xA2, 0x89, 0xA7, 0x97, 0xA8, 0x88, 0xA3, 0x99,
+    0x7A, 0x7E, 0x6F, 0x69, 0x37, 0x66, 0x51, 0x9C, 0x88, 0x3F, 0x9B, 0x98, 0x9B, 0x89, 0x50, 0x3B,
+    0xC1, 0x6F, 0x7E, 0x1B, 0x7E, 0xA2, 0x78, 0x6F, 0x7E, 0x6F, 0x20, 0xC0, 0x6B, 0x7F, 0xC0, 0x5A,
+    0x6B, 0x33, 0xC1, 0x7E, 0xC1, 0x6F, 0x3B, 0xC0, 0x5A, 0xC0, 0x65, 0x7E, 0x6F, 0x6E, 0xC0, 0x69,
+    0x7B, 0xA2, 0x88, 0xA2, 0x88, 0x6F, 0xC1, 0x6E, 0x6B, 0x3C, 0xC0, 0x56, 0x61, 0x55, 0xC0, 0x5A,
+    0x66, 0x05, 0x00, 0xC3, 0x76, 0xC2, 0x6E, 0xC0, 0x6E, 0x7F, 0x1F, 0x6F, 0xC0, 0x1F, 0xA4, 0x88,
+    0xA4, 0x87, 0xA2, 0x88, 0x7F, 0xC0, 0x52, 0x2F, 0xA6, 0x91, 0xFF, 0xCD, 0x85, 0x99, 0x88, 0x9D,
+    0x99, 0x7F, 0xC0, 0x66, 0x51, 0xA8, 0x87, 0x6E, 0x51, 0x5A, 0x65, 0x6E, 0x7A, 0x6E, 0x7B, 0x9A,
+    0x7A, 0x51, 0xA4, 0x86, 0x0C, 0x19, 0x9B, 0x9B, 0x2D, 0xA2, 0x87, 0xA2, 0x86, 0xA4, 0x87, 0x6E,
+    0xA2, 0x87, 0x7D, 0xA3, 0x89, 0xAA, 0x7D, 0x94, 0x8F, 0x83, 0xAE, 0xA1, 0x9A, 0x56, 0x65, 0x6B,
+    0x5A, 0xC0, 0x23, 0xC0, 0x6F, 0xC0, 0x7E, 0xC2, 0x5A, 0xC1, 0x2F, 0xC2, 0x34, 0x7B, 0x6E, 0x5A,
+    0x34, 0xC0, 0x20, 0xC0, 0x51, 0x66, 0x59, 0x66, 0xC0, 0x0C, 0x28, 0xA4, 0x89, 0xA5, 0x89, 0xA3,
+    0x89, 0x7E, 0x6B, 0x51, 0xC0, 0x2B, 0x6B, 0xC1, 0x6E, 0xA2, 0x88, 0x7F, 0x7E, 0x69, 0x7A, 0x6E,
+    0x6B, 0x6E, 0x6E, 0x6B, 0xC0, 0x2F, 0x1B, 0x56, 0x1A, 0xB1, 0x84, 0x9E, 0x71, 0x98, 0x73, 0x9A,
+    0x78, 0x9C, 0x7A, 0xA3, 0x89, 0x41, 0x57, 0x52, 0x56, 0x62, 0x56, 0xA6, 0x97, 0xA6, 0x87, 0x7A,
+    0xC0, 0x98, 0x98, 0xA3, 0x96, 0xA8, 0xA8, 0xA3, 0x98, 0x5B, 0x94, 0x5E, 0x98, 0x6C, 0xA4, 0x97,
+    0xAA, 0x84, 0x6D, 0x55, 0xA4, 0x89, 0xA5, 0xA9, 0xA8, 0xBA, 0x9D, 0x9B, 0x84, 0x8D, 0x6F, 0x69,
+    0xA2, 0x87, 0xA4, 0x98, 0xA4, 0x97, 0x0B, 0x55, 0x66, 0x5A, 0xA9, 0x99, 0x7A, 0x13, 0x51, 0x51,
+    0x51, 0x51, 0x9D, 0x99, 0x40, 0x9D, 0x99, 0x7D, 0xA2, 0x98, 0x6F, 0x7E, 0xA3, 0x89, 0xA3, 0x88,
+    0xA2, 0x88, 0x6B, 0xC1, 0x51, 0x10, 0xC1, 0x08, 0xA4, 0x87, 0xB1, 0x83, 0x95, 0x75, 0x93, 0x7B,
+    0x98, 0x5F, 0xA1, 0x7B, 0xA2, 0x78, 0x7E, 0xA2, 0x88, 0x33, 0x51, 0xA3, 0x88, 0x6F, 0x9D, 0x98,
+    0x51, 0x66, 0x10, 0x2B, 0x33, 0x02, 0x2E, 0x69, 0x24, 0x75, 0xB6, 0xB8, 0xA9, 0xC9, 0x51, 0x6E,
+    0x14, 0x55, 0x9C, 0x98, 0x9C, 0x88, 0x9D, 0x88, 0xC0, 0xA6, 0x88, 0xA6, 0x88, 0xA3, 0x98, 0x6F,
+    0x6E, 0x7A, 0x67, 0xC0, 0x55, 0x51, 0x50, 0x99, 0x86, 0x98, 0x99, 0x40, 0x52, 0x65, 0x9D, 0x99,
+    0x42, 0x56, 0x6B, 0xC0, 0x65, 0x5F, 0x65, 0x56, 0x32, 0xC2, 0x2A, 0xA3, 0xA8, 0xAA, 0x98, 0xA7,
+    0x99, 0x7E, 0x7A, 0xC0, 0x03, 0x65, 0xC1, 0x55, 0x9C, 0x98, 0x18, 0x9A, 0x98, 0x9A, 0x88, 0x9D,
+    0x89, 0x69, 0x07, 0xC0, 0x6E, 0x7F, 0x7F, 0x6E, 0x6F, 0xA2, 0x77, 0xA2, 0x88, 0x6B, 0x6F, 0x6B,
+    0xC6, 0x6E, 0xC0, 0x7A, 0x6E, 0xC1, 0x6E, 0x7B, 0x6E, 0xC0, 0x6E, 0xC0, 0x14, 0x05, 0x6E, 0x05,
+    0xC0, 0x19, 0x30, 0xA2, 0x79, 0x7E, 0x6F, 0x7A, 0x6E, 0xC0, 0x1C, 0x10, 0x51, 0x56, 0x55, 0x19,
+    0x52, 0x05, 0x00, 0xC3, 0x3B, 0x7A, 0xC0, 0x6F, 0xC0, 0x69, 0xC0, 0x6E, 0x7F, 0x7E, 0x6F, 0x7E,
+    0xA4, 0x88, 0xA3, 0x88, 0xA2, 0x88, 0x7F, 0xC1, 0x56, 0xA3, 0x94, 0xFF, 0xD5, 0xC9, 0x99, 0x85,
+    0x9C, 0x99, 0x55, 0x35, 0x66, 0x9D, 0x99, 0xA4, 0x78, 0xA7, 0x87, 0x9D, 0x99, 0x69, 0x56, 0x6D,
+    0x7A, 0x6E, 0x6B, 0x35, 0x9D, 0x89, 0xA4, 0x86, 0xA2, 0x88, 0x9D, 0x8A, 0x98, 0x9B, 0xA6, 0x86,
+    0xA4, 0x77, 0x6C, 0xA4, 0x88, 0xA2, 0x87, 0x79, 0xA2, 0x87, 0xA2, 0x87, 0xA8, 0x6C, 0x9D, 0x9F,
+    0xFF, 0x6A, 0x84, 0x9D, 0x9A, 0x6B, 0x5A, 0x66, 0xC2, 0x6B, 0xC1, 0x7E, 0xC6, 0x5A, 0x23, 0xC2,
+    0x5F, 0x20, 0xC0, 0x56, 0x65, 0xC0, 0x56, 0x65, 0xC0, 0x66, 0x38, 0x20, 0xA3, 0x99, 0xA5, 0x8A,
+    0xA5, 0x88, 0xA3, 0x99, 0xA3, 0x88, 0xA2, 0x88, 0x9D, 0x99, 0x9D, 0x88, 0x9D, 0x99, 0xC0, 0x2B,
+    0xC0, 0x6B, 0xA2, 0x88, 0xA2, 0x87, 0x7E, 0x66, 0xC0, 0x1B, 0x7E, 0x6F, 0x7E, 0x6B, 0xC0, 0x2F,
+    0x1B, 0x13, 0x56, 0xAD, 0x86, 0xA7, 0x82, 0x95, 0x73, 0x9D, 0x86, 0x98, 0x7A, 0xA3, 0x8A, 0x42,
+    0x56, 0x66, 0x52, 0x5B, 0x62, 0x55, 0xA3, 0x98, 0xA3, 0x98, 0xA2, 0x88, 0x9A, 0x98, 0xA4, 0x95,
+    0xA9, 0xA8, 0xA2, 0xA7, 0xA2, 0x79, 0x95, 0x6E, 0x96, 0x6D, 0xA2, 0x87, 0xAB, 0x95, 0xA5, 0x86,
+    0x9C, 0x79, 0xA3, 0x99, 0xA5, 0xA9, 0xA8, 0xA9, 0xA0, 0x9B, 0x84, 0x8C, 0x57, 0xC0, 0x69, 0x6E,
+    0xA2, 0x98, 0xA2, 0x88, 0x6E, 0xC0, 0x20, 0xAA, 0x98, 0x6E, 0x7A, 0x0C, 0x52, 0x65, 0x56, 0x1F,
+    0x9D, 0x89, 0x9C, 0x87, 0x51, 0x14, 0xA2, 0x98, 0xC0, 0xA2, 0x88, 0xA3, 0x88, 0xA2, 0x88, 0xA2,
+    0x88, 0x07, 0xC0, 0x3B, 0x33, 0x55, 0xA2, 0x89, 0xA3, 0x88, 0xA7, 0x97, 0xA8, 0x73, 0x91, 0x65,
+    0x94, 0x7C, 0x98, 0x6E, 0x1A, 0xA2, 0x78, 0xA2, 0x87, 0x7F, 0x9C, 0x89, 0xC0, 0xA4, 0x77, 0x38,
+    0x9D, 0x88, 0x62, 0xC0, 0x6F, 0x2B, 0xA2, 0x88, 0xC0, 0x61, 0x69, 0x65, 0xA2, 0x98, 0xB8, 0xB8,
+    0xA2, 0xA8, 0x51, 0x66, 0x51, 0x55, 0x9C, 0x98, 0x55, 0x54, 0x61, 0x3F, 0xA7, 0x99, 0xA6, 0x88,
+    0xA2, 0x88, 0x6E, 0x7A, 0x67, 0x66, 0x54, 0x9D, 0x88, 0x9B, 0x87, 0x99, 0xA8, 0x55, 0x66, 0x55,
+    0x52, 0x51, 0x56, 0x52, 0x42, 0xC1, 0x5B, 0x66, 0xC0, 0x69, 0xC0, 0x66, 0x55, 0xA5, 0x98, 0x0C,
+    0xA6, 0x98, 0xC0, 0x7A, 0xC1, 0x0B, 0x51, 0x55, 0xC0, 0x9C, 0x88, 0x99, 0x98, 0x9B, 0x98, 0x9C,
+    0x88, 0x52, 0x5A, 0x6E, 0x7B, 0x6E, 0x6F, 0x6F, 0x7F, 0x6E, 0x6F, 0x7F, 0xC0, 0x6E, 0x6B, 0xC5,
+    0x6E, 0xC1, 0x7A, 0xC0, 0x6E, 0x6E, 0x7F, 0x6E, 0x7F, 0x6E, 0xC0, 0x7E, 0x6F, 0x35, 0x2D, 0x28,
+    0x19, 0xC0, 0x2D, 0x01, 0x7F, 0xA2, 0x88, 0x6E, 0x6B, 0xC1, 0x24, 0xC0, 0x15, 0x56, 0x61, 0x9D,
+    0x89, 0x51, 0xC0, 0x66, 0xC0, 0x00, 0xC0, 0x3B, 0xC1, 0x7A, 0x6F, 0x6E, 0xC0, 0x03, 0xC0, 0x6E,
+    0xC0, 0x7F, 0xA4, 0x88, 0xA4, 0x87, 0xA2, 0x88, 0xA2, 0x88, 0x7F, 0xA2, 0x87, 0x6B, 0xC0, 0x24,
+    0x9F, 0xA1, 0x98, 0x81, 0x9D, 0x87, 0x9C, 0x99, 0x6F, 0x7A, 0x56, 0x51, 0x1D, 0x7E, 0x55, 0xC2,
+    0x69, 0x6F, 0x9D, 0x9A, 0x9B, 0x89, 0xA4, 0x86, 0xA2, 0x87, 0x3F, 0x98, 0x9B, 0xA2, 0x88, 0xA6,
+    0x76, 0x68, 0xA4, 0x87, 0xA3, 0x88, 0x79, 0xA2, 0x87, 0xA2, 0x87, 0xA6, 0x6B, 0xA4, 0x8F, 0x81,
+    0xAF, 0x98, 0x8B, 0x6F, 0x2D, 0x66, 0x56, 0x69, 0x66, 0xCC, 0x6B, 0xC3, 0x5A, 0x65, 0x51, 0xC1,
+    0x66, 0xC1, 0xA2, 0x87, 0x28, 0xA4, 0x89, 0xA4, 0x78, 0xA4, 0x89, 0xA3, 0x99, 0xA3, 0x98, 0xA3,
+    0x89, 0xC1, 0x9C, 0x88, 0x9C, 0x88, 0x41, 0xC1, 0xA2, 0x88, 0xA2, 0x87, 0x7E, 0x7A, 0x6E, 0x6B,
+    0x7E, 0x2F, 0xC1, 0x2A, 0x1B, 0x56, 0x1B, 0x13, 0xA6, 0x77, 0xB0, 0x82, 0x95, 0x72, 0x9C, 0x75,
+    0x98, 0x8A, 0xA0, 0x7A, 0x5A, 0x56, 0x52, 0x56, 0x56, 0x67, 0xC1, 0xA2, 0x88, 0xC0, 0x9C, 0x96,
+    0xA7, 0x96, 0xA7, 0xC8, 0xA4, 0x96, 0xA2, 0x79, 0x97, 0x7E, 0x95, 0x6D, 0x57, 0xA9, 0x95, 0xAA,
+    0x95, 0x9D, 0x88, 0xA1, 0x8A, 0xA4, 0x99, 0xA8, 0xAA, 0x9B, 0x9C, 0x87, 0x9B, 0xA0, 0x7A, 0x7E,
+    0xC2, 0x6D, 0x7B, 0x6E, 0x7E, 0xA9, 0x98, 0x7A, 0xA2, 0x78, 0x7A, 0xC0, 0x56, 0x66, 0x24, 0x66,
+    0x9D, 0x98, 0x41, 0x61, 0xC0, 0x2B, 0xA3, 0x98, 0xA2, 0x78, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x88,
+    0x6F, 0x14, 0x00, 0x3B, 0x20, 0xA2, 0x89, 0xA7, 0x97, 0xA4, 0x63, 0x8F, 0x75, 0x95, 0x7D, 0x99,
+    0x6E, 0xA4, 0x69, 0xA2, 0x78, 0x7E, 0x7F, 0x9C, 0x89, 0x6E, 0xA3, 0x88, 0x38, 0x9C, 0x88, 0x66,
+    0xC0, 0x1F, 0xA2, 0x88, 0x6F, 0x66, 0x33, 0x65, 0x51, 0xA8, 0xA8, 0xB4, 0xC8, 0x9B, 0x98, 0x51,
+    0x65, 0x66, 0xC0, 0x69, 0x5A, 0x9D, 0x97, 0x9B, 0x98, 0x5A, 0x33, 0xA5, 0x89, 0xA3, 0x98, 0x6F,
+    0x7E, 0x61, 0x9D, 0x99, 0x40, 0x50, 0x9D, 0x98, 0x65, 0x6E, 0x08, 0x56, 0x56, 0x61, 0x5B, 0x56,
+    0x9D, 0x99, 0x41, 0x66, 0x57, 0xC4, 0xA6, 0x87, 0xAB, 0xA9, 0xA6, 0x97, 0x7F, 0xC1, 0x66, 0xC0,
+    0x51, 0x9D, 0x88, 0x9D, 0x88, 0x9C, 0x88, 0x99, 0x98, 0x9C, 0x88, 0x9D, 0x99, 0x59, 0x11, 0x6B,
+    0x6E, 0x7F, 0xA2, 0x78, 0x6F, 0x7F, 0x6B, 0x6E, 0xC0, 0x7E, 0xC0, 0x6B, 0xC6, 0x6E, 0xC0, 0x7F,
+    0xC1, 0x7E, 0x6E, 0x7F, 0x6E, 0x7E, 0x6F, 0xC0, 0x01, 0xC1, 0x3C, 0x69, 0x56, 0x28, 0x35, 0xA2,
+    0x89, 0x6E, 0x7F, 0x6F, 0xC1, 0x29, 0xC0, 0x24, 0x56, 0xC0, 0x51, 0x51, 0x14, 0x56, 0xC0, 0x07,
+    0xC1, 0x65, 0x7A, 0x3B, 0x3E, 0x6F, 0xC0, 0x0F, 0xC0, 0x0A, 0x69, 0x3E, 0x03, 0xA4, 0x88, 0xA5,
+    0x88, 0xA3, 0x99, 0xA3, 0x98, 0xA2, 0x87, 0x6F, 0x7A, 0x30, 0x24, 0xA0, 0x95, 0xFF, 0xCD, 0x67,
+    0x9B, 0x85, 0x9C, 0x89, 0x6B, 0xC0, 0x67, 0x61, 0xA3, 0x87, 0xA7, 0x88, 0x51, 0x16, 0xC1, 0x59,
+    0x7F, 0x52, 0x9A, 0x89, 0xA3, 0x97, 0xA3, 0x87, 0x0E, 0x99, 0x8A, 0x66, 0xA7, 0x86, 0x6E, 0xA2,
+    0x97, 0xA4, 0x87, 0xC0, 0xA2, 0x86, 0xA3, 0x87, 0xA4, 0x7C, 0xA7, 0x8E, 0xFF, 0xA4, 0x8C, 0x91,
+    0x9C, 0xA2, 0x88, 0xC0, 0x66, 0x59, 0x08, 0xC1, 0x69, 0x66, 0x56, 0x69, 0x66, 0x56, 0x65, 0x5A,
+    0x66, 0x66, 0xC0, 0x0C, 0xC1, 0x7A, 0x11, 0x0C, 0xC0, 0x55, 0x66, 0x56, 0x7A, 0x30, 0x38, 0xC0,
+    0xA2, 0x87, 0x28, 0x17, 0xA4, 0x88, 0xA4, 0x88, 0xA3, 0x89, 0xA2, 0x89, 0xA2, 0x88, 0xA2, 0x88,
+    0x7F, 0xC0, 0x51, 0x9B, 0x88, 0x9C, 0x88, 0x55, 0x6E, 0xA3, 0x99, 0xA2, 0x87, 0x7A, 0x6B, 0x6E,
+    0x6E, 0xC0, 0x1B, 0xC0, 0x16, 0x5A, 0xC0, 0x1B, 0x5A, 0xC0, 0xB3, 0x85, 0x9C, 0x82, 0x97, 0x63,
+    0x9B, 0x89, 0x9C, 0x8A, 0xA2, 0x78, 0x42, 0x56, 0x57, 0x66, 0x66, 0xC0, 0x6F, 0xA3, 0x89, 0x65,
+    0x9A, 0x96, 0xA6, 0x96, 0xA7, 0xB7, 0xA4, 0x97, 0xA3, 0x89, 0x9A, 0x7C, 0x92, 0x5E, 0x6B, 0xA5,
+    0x96, 0xAC, 0x85, 0x69, 0x67, 0xA4, 0x89, 0xA5, 0xAA, 0x91, 0xAD, 0x91, 0x8C, 0xA3, 0x88, 0x7F,
+    0xC2, 0x6E, 0xC0, 0x7A, 0xC0, 0xA3, 0x97, 0x7F, 0xA2, 0x88, 0xA2, 0x88, 0x7E, 0x6F, 0xC0, 0x13,
+    0x0B, 0x65, 0x51, 0x9D, 0x88, 0x62, 0xA3, 0x88, 0x3F, 0x13, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x88,
+    0xA2, 0x78, 0x7E, 0x66, 0x28, 0xA2, 0x88, 0x6B, 0xA7, 0x87, 0xA1, 0x84, 0x8F, 0x65, 0x95, 0x6F,
+    0x9C, 0x6C, 0xA3, 0x79, 0xA2, 0x78, 0xA2, 0x88, 0x7A, 0x9C, 0x89, 0x7E, 0xA2, 0x78, 0x65, 0x40,
+    0x62, 0x6E, 0x1F, 0x33, 0x3F, 0x30, 0x33, 0x65, 0x9D, 0x98, 0xAF, 0xB8, 0xAD, 0xC9, 0x98, 0x98,
+    0x51, 0x6E, 0x6B, 0x7A, 0x6D, 0x9D, 0x88, 0x9C, 0x87, 0x50, 0xC0, 0xA2, 0x88, 0x7F, 0x6F, 0xC0,
+    0x55, 0x04, 0x61, 0x69, 0x6F, 0xA2, 0x98, 0x69, 0xC2, 0x56, 0x38, 0x33, 0x52, 0x56, 0x51, 0x9D,
+    0x89, 0x56, 0x6B, 0x67, 0x59, 0x2D, 0xA8, 0x87, 0xAB, 0xA9, 0xA4, 0x97, 0x1A, 0x7E, 0x6E, 0x22,
+    0x66, 0x55, 0x23, 0x97, 0x88, 0x9A, 0x88, 0x9D, 0x98, 0x51, 0x56, 0xC0, 0x6F, 0x6F, 0x6F, 0x6E,
+    0xA2, 0x88, 0x7F, 0x6F, 0x6E, 0x6B, 0x7A, 0xC8, 0x6E, 0xC1, 0x7A, 0x6F, 0xC0, 0x7E, 0x6E, 0xA2,
+    0x88, 0xC0, 0x7F, 0x6E, 0x6E, 0x7E, 0xC1, 0x01, 0x7F, 0xC0, 0x01, 0x65, 0x01, 0x10, 0x15, 0xA2,
+    0x88, 0x6B, 0xC0, 0x7A, 0x30, 0xC1, 0x65, 0x1C, 0x10, 0x3C, 0x9D, 0x89, 0x55, 0x66, 0x07, 0xC2,
+    0x3B, 0xC1, 0x7A, 0x6F, 0x0F, 0xC0, 0x0A, 0x69, 0x3E, 0x03, 0x7E, 0xA5, 0x89, 0xA7, 0x88, 0xA3,
+    0x98, 0xA2, 0x88, 0x7E, 0x6B, 0x38, 0x51, 0x69, 0x9E, 0xA1, 0x99, 0x82, 0x9B, 0x98, 0x52, 0x6F,
+    0x69, 0x28, 0x51, 0xA7, 0x88, 0xA3, 0x87, 0x61, 0xC1, 0x69, 0xC0, 0x57, 0x9A, 0x89, 0xA2, 0x87,
+    0xA3, 0x97, 0xA2, 0x78, 0x9A, 0x9A, 0x9C, 0x8A, 0xA7, 0x86, 0xA2, 0x87, 0x0C, 0xA5, 0x97, 0xC0,
+    0xA3, 0x87, 0xA3, 0x88, 0xA3, 0x9C, 0xA7, 0x7E, 0x90, 0x9F, 0x8C, 0x8C, 0xA2, 0x89, 0x6B, 0xC0,
+    0x08, 0x03, 0xC1, 0x69, 0xC0, 0x66, 0x28, 0x66, 0x55, 0x55, 0x62, 0x55, 0x51, 0x65, 0x66, 0x59,
+    0x66, 0xC0, 0x3D, 0xC0, 0x38, 0x56, 0x66, 0x69, 0x6E, 0x30, 0x38, 0x6F, 0xA2, 0x87, 0xA1, 0xA9,
+    0xA3, 0x89, 0x37, 0xA5, 0x98, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x89, 0x6F, 0xA2, 0x88, 0x7F, 0x6E,
+    0x55, 0x36, 0x9A, 0x88, 0x17, 0x7F, 0xA3, 0x88, 0x7A, 0x6E, 0x7F, 0x1B, 0xC0, 0x55, 0x07, 0xC1,
+    0x6F, 0x1B, 0xC0, 0x0C, 0xAE, 0x76, 0xA8, 0x83, 0x93, 0x72, 0x9C, 0x77, 0x99, 0x8A, 0xA2, 0x7A,
+    0x55, 0x42, 0x67, 0x56, 0xC1, 0xA2, 0x78, 0xA2, 0x99, 0x51, 0x9A, 0x96, 0xA5, 0x96, 0xA8, 0xA7,
+    0xA4, 0xA7, 0xA2, 0x88, 0x9D, 0x7C, 0x92, 0x6E, 0x47, 0xA2, 0x97, 0xAD, 0x95, 0xA2, 0x87, 0x6B,
+    0x7F, 0xA1, 0x9A, 0x97, 0xAE, 0x91, 0x8B, 0xA2, 0x88, 0x2F, 0x7E, 0xC1, 0x69, 0x6E, 0xC0, 0x30,
+    0x99, 0xA8, 0x7E, 0xA2, 0x88, 0xA3, 0x89, 0x7E, 0x6F, 0xA2, 0x88, 0xA2, 0x87, 0x6B, 0x17, 0x08,
+    0x3B, 0x2F, 0xA2, 0x88, 0x17, 0xA3, 0x88, 0xA3, 0x99, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0x7F, 0xA2,
+    0x88, 0xA2, 0x88, 0x6E, 0x6E, 0xA7, 0x98, 0xA0, 0x64, 0x8C, 0x66, 0x97, 0x6E, 0x9D, 0x7C, 0xA3,
+    0x7A, 0xA2, 0x77, 0xA2, 0x88, 0x66, 0x26, 0xA2, 0x87, 0x6E, 0x33, 0x40, 0x62, 0x6F, 0xA2, 0x87,
+    0x38, 0x7F, 0x52, 0x33, 0x61, 0x64, 0xB4, 0xB8, 0xA5, 0xB8, 0x99, 0x99, 0x52, 0x7E, 0xC1, 0x50,
+    0x9C, 0x78, 0x9D, 0x98, 0x6D, 0xC0, 0x7E, 0xC1, 0x51, 0x51, 0x6E, 0x7A, 0x7E, 0xA2, 0x88, 0x7F,
+    0x6E, 0x7A, 0x6E, 0xC1, 0x57, 0x66, 0x55, 0x56, 0x56, 0x52, 0x9D, 0x89, 0x9D, 0x99, 0x57, 0xA3,
+    0xA7, 0xAA, 0x88, 0xA8, 0x88, 0xA3, 0xA8, 0x7E, 0x7F, 0x6E, 0x22, 0xC0, 0x13, 0x9B, 0x88, 0x95,
+    0x88, 0x99, 0x89, 0x9D, 0x99, 0x69, 0xC0, 0x67, 0x5F, 0x6F, 0xA2, 0x88, 0x6F, 0xA2, 0x78, 0x7E,
+    0x6F, 0x6F, 0x7A, 0xC0, 0x7A, 0xC8, 0x6E, 0xC1, 0x7A, 0x6E, 0x6B, 0x7E, 0xA2, 0x78, 0x7E, 0x6E,
+    0x7F, 0x6E, 0xC0, 0x7E, 0x6F, 0xC0, 0x66, 0x15, 0xC0, 0x10, 0x65, 0x10, 0x15, 0x7F, 0x6E, 0x6B,
+    0xC4, 0x29, 0x24, 0x56, 0x10, 0x2D, 0x9D, 0x99, 0x56, 0xC0, 0x07, 0xC1, 0x3B, 0xC2, 0x3E, 0x6E,
+    0x6B, 0x0F, 0xC1, 0x03, 0xC0, 0xA4, 0x88, 0xA7, 0x98, 0xA4, 0x88, 0xA2, 0x88, 0x7E, 0xA2, 0x78,
+    0xC0, 0x51, 0x65, 0xA1, 0xA5, 0xFF, 0xC5, 0x47, 0x9A, 0x86, 0x52, 0xC0, 0x69, 0x67, 0x65, 0x5A,
+    0xA9, 0x87, 0x65, 0x65, 0xC1, 0x69, 0x56, 0x9A, 0x8A, 0xA2, 0x87, 0xA3, 0x87, 0x07, 0x9D, 0x9A,
+    0x9C, 0x79, 0x01, 0x07, 0x6E, 0xA4, 0x87, 0x6D, 0xA3, 0x98, 0xA3, 0x89, 0xA4, 0x8B, 0xA6, 0x7D,
+    0x97, 0x9F, 0x8A, 0x8D, 0x6B, 0x6F, 0x3B, 0xC1, 0x3E, 0xC0, 0x69, 0x2F, 0x23, 0x56, 0xC0, 0x65,
+    0x55, 0x51, 0x61, 0x51, 0x55, 0x50, 0x62, 0x55, 0x65, 0x56, 0xC0, 0x66, 0x69, 0x56, 0xC0, 0x24,
+    0x30, 0x38, 0xA2, 0x88, 0x7E, 0xA2, 0x88, 0x6F, 0xA3, 0x99, 0xA3, 0x88, 0xA6, 0x88, 0xA2, 0x89,
+    0x7F, 0xA2, 0x88, 0x36, 0xA2, 0x88, 0x7F, 0xC1, 0x0A, 0x9C, 0x87, 0x9B, 0x99, 0x55, 0x2E, 0xA2,
+    0x77, 0x07, 0xC0, 0x66, 0x69, 0x02, 0x07, 0x6F, 0xC0, 0x1B, 0xC0, 0x13, 0xA8, 0x76, 0xB2, 0x84,
+    0x92, 0x72, 0x9B, 0x75, 0x9A, 0x89, 0x47, 0x5B, 0x51, 0x57, 0x66, 0x56, 0x6E, 0x7F, 0xA3, 0x89,
+    0x9C, 0x98, 0x9A, 0x87, 0xA5, 0x96, 0xA8, 0xA7, 0xA5, 0xB7, 0xA2, 0x87, 0x9F, 0x7C, 0x92, 0x6E,
+    0x9D, 0x7B, 0xA2, 0x87, 0xAB, 0xA6, 0xA6, 0x86, 0x6F, 0x62, 0x9D, 0x99, 0xA2, 0x8C, 0x8A, 0x9D,
+    0xA2, 0x88, 0x6B, 0xC0, 0x7E, 0xC0, 0x69, 0xC2, 0x94, 0x97, 0xC0, 0x7E, 0x6F, 0x7F, 0x6E, 0x7F,
+    0xA2, 0x88, 0x6E, 0xC0, 0x7A, 0x6F, 0x7E, 0xC1, 0xA3, 0x88, 0xA4, 0x88, 0xA3, 0x99, 0xA3, 0x88,
+    0x7B, 0x6E, 0x6E, 0xA3, 0x99, 0xA3, 0x88, 0x6E, 0xA7, 0x87, 0xA0, 0x74, 0x8C, 0x68, 0x97, 0x6E,
+    0x9F, 0x7C, 0xA3, 0x79, 0xA2, 0x78, 0xA2, 0x87, 0x66, 0x26, 0x7E, 0xA2, 0x77, 0x66, 0x40, 0x66,
+    0x6B, 0xA2, 0x88, 0x38, 0x7B, 0x56, 0x2E, 0x50, 0xA0, 0xA8, 0xB8, 0xB7, 0x75, 0x9A, 0x98, 0x52,
+    0xC1, 0x55, 0x51, 0x9C, 0x87, 0x55, 0x69, 0x7A, 0xA2, 0x78, 0xC0, 0x17, 0x9D, 0x89, 0x65, 0x6E,
+    0xA2, 0x88, 0x17, 0x7E, 0x7F, 0x6E, 0x7E, 0xA2, 0x88, 0xC3, 0x5A, 0x9D, 0x9A, 0x55, 0x56, 0x9D,
+    0x9A, 0x9C, 0x88, 0xA5, 0x89, 0xAA, 0xA8, 0xA6, 0x88, 0x7E, 0x7E, 0x6F, 0x7E, 0x66, 0x66, 0x55,
+    0x9B, 0x88, 0x97, 0x88, 0x98, 0x88, 0x51, 0x56, 0x5A, 0x66, 0x6F, 0x5B, 0xA2, 0x88, 0xA2, 0x78,
+    0x7F, 0xA2, 0x78, 0x21, 0xC0, 0x6F, 0x7A, 0xC2, 0x7A, 0xC7, 0x6E, 0x7E, 0xC1, 0x6F, 0x7E, 0xA2,
+    0x88, 0x6F, 0x3C, 0xC0, 0x6E, 0xC0, 0x7E, 0x6F, 0xC0, 0x69, 0x09, 0x15, 0x66, 0x09, 0xC0, 0x15,
+    0x7F, 0x6E, 0x6B, 0xC1, 0x29, 0x30, 0xC0, 0x29, 0x24, 0xC0, 0x56, 0x9D, 0x88, 0x9D, 0x99, 0x0C,
+    0xC1, 0x66, 0xC0, 0x65, 0xC0, 0x66, 0x3B, 0xC1, 0x7E, 0x6B, 0x6E, 0xC0, 0x03, 0x7E, 0xA2, 0x89,
+    0xA4, 0x87, 0xA5, 0x98, 0x1F, 0xA2, 0x88, 0x6F, 0x6E, 0x65, 0x51, 0xA1, 0xA7, 0x9C, 0x80, 0x97,
+    0x94, 0x51, 0x66, 0x5A, 0x69, 0x67, 0x51, 0x3C, 0xA7, 0x87, 0x51, 0xC0, 0x55, 0x79, 0x57, 0x9A,
+    0x89, 0xA2, 0x87, 0xA2, 0x87, 0xA2, 0x87, 0x67, 0x9C, 0x79, 0xA4, 0x88, 0xA2, 0x86, 0x7E, 0xA3,
+    0x88, 0x69, 0xA4, 0x77, 0xA3, 0x99, 0xA5, 0x8B, 0xA4, 0x8D, 0x9D, 0x9F, 0x8B, 0x8D, 0x0B, 0x6F,
+    0x6B, 0x17, 0xC3, 0x5A, 0x66, 0xC0, 0x03, 0x5A, 0x61, 0x51, 0x64, 0x51, 0x51, 0x50, 0x51, 0x52,
+    0x61, 0x51, 0x55, 0x55, 0x66, 0xC0, 0x65, 0xA2, 0x88, 0x7F, 0xA2, 0x87, 0xA2, 0x88, 0xA2, 0x88,
+    0x7F, 0x6E, 0x56, 0xC0, 0xA2, 0x88, 0xA7, 0x99, 0xA6, 0x88, 0x16, 0xA2, 0x88, 0xA2, 0x88, 0xA2,
+    0x78, 0x7B, 0xC0, 0x6E, 0x6E, 0x9C, 0x88, 0x9B, 0x98, 0x9C, 0x88, 0xC0, 0x7E, 0x6F, 0xC1, 0x6E,
+    0x07, 0xC0, 0x6F, 0xC0, 0x18, 0xC0, 0xA2, 0x87, 0xB5, 0x85, 0x9A, 0x83, 0x95, 0x74, 0x40, 0x9A,
+    0x7A, 0xA2, 0x79, 0x56, 0x52, 0x56, 0xC1, 0x6F, 0xA2, 0x89, 0x9B, 0xA8, 0x9B, 0x87, 0xA5, 0x97,
+    0xA7, 0xA7, 0xA5, 0xB8, 0xA3, 0x97, 0xA0, 0x8B, 0x93, 0x6D, 0x9B, 0x7C, 0xA2, 0x78, 0xA8, 0x96,
+    0xAB, 0x97, 0x9D, 0x88, 0x9B, 0x99, 0xC0, 0xA8, 0x9B, 0x89, 0x9E, 0x53, 0x7E, 0x6B, 0x6E, 0xC0,
+    0x79, 0x6B, 0x6E, 0xC0, 0x94, 0x97, 0xC4, 0x7A, 0xC1, 0x6E, 0x7E, 0x6F, 0x7E, 0x6E, 0x24, 0x6B,
+    0x7E, 0xA3, 0x99, 0xA5, 0x88, 0xA4, 0x88, 0x7F, 0x6E, 0x7F, 0xA2, 0x77, 0x69, 0xA9, 0x87, 0xA5,
+    0x74, 0x8D, 0x59, 0x97, 0x7F, 0xA1, 0x7B, 0xA2, 0x79, 0xA2, 0x78, 0xA2, 0x88, 0x61, 0x65, 0x69,
+    0xA2, 0x88, 0x56, 0x40, 0x66, 0x7F, 0x6F, 0xA2, 0x88, 0xC0, 0x33, 0x27, 0x9C, 0x98, 0xA7, 0xC8,
+    0xB5, 0xA8, 0x9A, 0x97, 0x9B, 0x9A, 0x65, 0x5A, 0x65, 0x66, 0x40, 0x51, 0x51, 0x69, 0xA2, 0x88,
+    0xC0, 0x0F, 0x9D, 0x98, 0x51, 0xC0, 0x2F, 0xA2, 0x88, 0xA1, 0x9A, 0x7E, 0x6E, 0x7E, 0x7E, 0xA2,
+    0x88, 0xC1, 0x6E, 0x6B, 0x56, 0x51, 0x56, 0x2A, 0x51, 0xA4, 0x98, 0xAA, 0x89, 0xA5, 0xA8, 0x7F,
+    0x59, 0x1F, 0x7E, 0xC0, 0x52, 0x9D, 0x98, 0x9A, 0x87, 0x97, 0x89, 0x9B, 0x88, 0x51, 0x56, 0x5A,
+    0xC0, 0x5B, 0x6F, 0xC0, 0x6F, 0xA2, 0x88, 0xA2, 0x79, 0x7E, 0x6E, 0x7A, 0x6F, 0xC0, 0x7A, 0xC0,
+    0x66, 0x30, 0x7A, 0xC5, 0x6E, 0xC0, 0x7F, 0xC0, 0x6E, 0x7E, 0x6F, 0xA2, 0x87, 0x3C, 0xC0, 0x6E,
+    0xC1, 0x6E, 0x7A, 0x6E, 0xC0, 0x09, 0xC1, 0x01, 0x09, 0x6F, 0x7F, 0x6E, 0x6B, 0xC4, 0x29, 0x24,
+    0x29, 0x24, 0x3C, 0x20, 0x14, 0x66, 0x07, 0xC0, 0x65, 0xC6, 0x7A, 0x6F, 0x17, 0xA2, 0x88, 0x7E,
+    0xC1, 0xA3, 0x98, 0xA4, 0x88, 0xA4, 0x88, 0xA2, 0x88, 0xC1, 0x1F, 0x68, 0xA1, 0x93, 0x96, 0x91,
+    0x9D, 0x88, 0x62, 0x5A, 0x69, 0x77, 0x5A, 0x40, 0xA8, 0x87, 0xA3, 0x98, 0x9D, 0x99, 0x55, 0xA2,
+    0x88, 0x01, 0x9B, 0x99, 0xA3, 0x87, 0xA3, 0x87, 0xA2, 0x87, 0x6B, 0x9A, 0x8A, 0xA5, 0x97, 0xA4,
+    0x76, 0x66, 0x7F, 0x1E, 0xA5, 0x87, 0xA5, 0x99, 0xA2, 0x8B, 0xA4, 0x8D, 0xA2, 0x7D, 0x8C, 0x8D,
+    0x99, 0x8B, 0xA2, 0x89, 0xC4, 0x6E, 0xC2, 0x23, 0xC0, 0x55, 0x69, 0x61, 0x51, 0x51, 0x9D, 0x98,
+    0x9C, 0x88, 0x9D, 0x99, 0x55, 0x61, 0x40, 0x62, 0x6E, 0x7A, 0x69, 0xA2, 0x98, 0xA2, 0x78, 0xA3,
+    0x98, 0xA3, 0x89, 0xA2, 0x98, 0x6F, 0x5A, 0x56, 0x51, 0x9D, 0x99, 0x69, 0xA5, 0x99, 0xA8, 0x78,
+    0xA3, 0x99, 0x7F, 0xA2, 0x88, 0x0F, 0x7A, 0x6F, 0x6E, 0xC0, 0x0F, 0x9C, 0x87, 0x9B, 0x99, 0x51,
+    0x65, 0xA2, 0x78, 0x33, 0x38, 0x7B, 0x6E, 0x6B, 0x6E, 0x18, 0xC0, 0x65, 0xB2, 0x76, 0xA7, 0x84,
+    0x91, 0x83, 0x9D, 0x76, 0x98, 0x79, 0xA2, 0x79, 0x57, 0x51, 0x56, 0x6B, 0x6F, 0x7F, 0xA2, 0x88,
+    0x9A, 0x88, 0x9C, 0x96, 0xA4, 0x87, 0xA6, 0x97, 0xA6, 0xA6, 0xA3, 0xA8, 0xA0, 0x8A, 0x95, 0x7D,
+    0x9A, 0x5B, 0xA3, 0x89, 0xA2, 0x98, 0xB1, 0x86, 0x93, 0x99, 0x97, 0x88, 0xAA, 0x86, 0xAD, 0xAC,
+    0x89, 0xAF, 0x9A, 0x8A, 0xA2, 0x88, 0x6F, 0xC1, 0x7A, 0x6E, 0xC1, 0x97, 0x97, 0xC0, 0x66, 0x66,
+    0x14, 0x0F, 0x59, 0xC0, 0x7A, 0xC0, 0x6E, 0xC0, 0x7A, 0xC1, 0x66, 0x55, 0x6B, 0xA3, 0x98, 0xA3,
+    0x88, 0xA4, 0x89, 0xA3, 0x98, 0x7F, 0xC0, 0x58, 0xAF, 0x86, 0xA5, 0x75, 0x8D, 0x5A, 0x98, 0x6E,
+    0xA3, 0x7A, 0xA2, 0x79, 0xA2, 0x88, 0x6F, 0x51, 0x2B, 0x79, 0xA2, 0x88, 0x55, 0x9D, 0x89, 0xC0,
+    0x7F, 0xA2, 0x88, 0x7F, 0x3F, 0x55, 0x65, 0x9C, 0xA7, 0xAE, 0xC8, 0xAC, 0xA8, 0x97, 0x98, 0x52,
+    0xC1, 0x69, 0x55, 0x51, 0x65, 0x52, 0x6E, 0x79, 0x56, 0x9D, 0x88, 0x9C, 0x98, 0x6E, 0xA2, 0x89,
+    0xA2, 0x87, 0x7F, 0x1E, 0x7B, 0x6E, 0x7E, 0x7E, 0x6F, 0x7E, 0xC1, 0x5A, 0x09, 0x55, 0x32, 0x2D,
+    0xA5, 0x99, 0xA8, 0x88, 0xA5, 0xA9, 0xA2, 0x78, 0x7A, 0x3F, 0x65, 0x2E, 0x51, 0x9C, 0x88, 0x99,
+    0x87, 0x98, 0x87, 0x9B, 0x9A, 0x55, 0x5A, 0x6B, 0x5A, 0x5A, 0x6B, 0x6B, 0x5E, 0x7F, 0x6F, 0xA2,
+    0x88, 0x7E, 0x6E, 0x7B, 0x6E, 0xC0, 0x7A, 0x66, 0xC0, 0x30, 0x7A, 0xC5, 0x6E, 0xC0, 0x7F, 0x6E,
+    0xC0, 0x7F, 0xA2, 0x87, 0x6E, 0x7F, 0xC0, 0x6E, 0xC1, 0x6E, 0x7A, 0xC3, 0x01, 0x65, 0x01, 0xA2,
+    0x88, 0x6B, 0x29, 0x6B, 0xC2, 0x7E, 0xC0, 0x30, 0x29, 0xC0, 0x66, 0x01, 0x9C, 0x89, 0x65, 0x66,
+    0x0C, 0x65, 0x66, 0xC7, 0xA3, 0x98, 0xA4, 0x88, 0xA3, 0x98, 0x6E, 0x51, 0x9D, 0x99, 0x79, 0xA2,
+    0x88, 0xA3, 0x99, 0xA3, 0x89, 0x1A, 0x6E, 0x65, 0x65, 0xA3, 0x85, 0x9B, 0x91, 0x98, 0x85, 0x62,
+    0x5A, 0x69, 0x37, 0x66, 0x40, 0x5A, 0xA8, 0x87, 0x7E, 0xC0, 0x52, 0x14, 0xC0, 0xA2, 0x87, 0xA3,
+    0x87, 0xA3, 0x87, 0x6B, 0x9B, 0x9A, 0xA4, 0x87, 0xA8, 0x75, 0x65, 0x9D, 0x9A, 0x05, 0xA6, 0x87,
+    0xA8, 0x78, 0xA1, 0x9C, 0xA3, 0x8C, 0xA4, 0x7C, 0x91, 0x9E, 0x92, 0x8C, 0xA3, 0x89, 0xC1, 0x6F,
+    0xC2, 0x6E, 0xC1, 0x2F, 0xC0, 0x28, 0xC0, 0x23, 0x55, 0x65, 0x9C, 0x88, 0x9C, 0x98, 0x18, 0x51,
+    0x60, 0x51, 0x55, 0x18, 0x7E, 0x7A, 0x7E, 0xA3, 0x89, 0xA3, 0x88, 0x7F, 0xA3, 0x98, 0x6E, 0x56,
+    0x56, 0x56, 0x61, 0x41, 0x9D, 0x99, 0x7E, 0xA7, 0x89, 0xA7, 0x98, 0xA3, 0x89, 0x7F, 0x6F, 0xA2,
+    0x88, 0x6E, 0x6B, 0x7D, 0x23, 0x9D, 0x98, 0x9C, 0x88, 0x9C, 0x88, 0x55, 0x33, 0x6E, 0x7B, 0x6E,
+    0x6E, 0x6B, 0x6E, 0xC0, 0x07, 0xAC, 0x77, 0xB1, 0x75, 0x92, 0x93, 0x9A, 0x64, 0x9A, 0x77, 0x43,
+    0x6F, 0x51, 0x56, 0x67, 0x6F, 0xA2, 0x88, 0x6E, 0x9A, 0x88, 0x9D, 0x98, 0xA3, 0x98, 0xA4, 0x97,
+    0xA7, 0xB6, 0xA3, 0xA8, 0xA2, 0x89, 0x97, 0x6C, 0x97, 0x6D, 0xA3, 0x8A, 0x64, 0xB1, 0x88, 0x90,
+    0x88, 0x9C, 0x76, 0xAB, 0x97, 0xAD, 0xBC, 0x8D, 0xAE, 0x95, 0x8B, 0xA2, 0x89, 0x7E, 0x6B, 0x6E,
+    0x7A, 0x6E, 0xC0, 0x37, 0x9A, 0x87, 0xC1, 0x66, 0x34, 0xC2, 0x7E, 0xC0, 0x7E, 0xC0, 0x69, 0xC0,
+    0x66, 0x56, 0x61, 0x55, 0x66, 0x5A, 0x0B, 0xA3, 0x88, 0x7F, 0xA2, 0x88, 0x69, 0xB7, 0x76, 0xA2,
+    0x65, 0x8D, 0x5B, 0x9B, 0x7D, 0xA2, 0x7A, 0xA2, 0x78, 0xA2, 0x89, 0x6E, 0x50, 0x2B, 0x79, 0xA2,
+    0x88, 0x27, 0x41, 0xC0, 0x7F, 0xA2, 0x88, 0x7F, 0x5A, 0x2B, 0x64, 0x9E, 0xA6, 0xB3, 0xC9, 0xA1,
+    0xB9, 0x99, 0x99, 0xC0, 0x6F, 0xC0, 0x69, 0x51, 0x51, 0x6E, 0x65, 0x56, 0x61, 0x51, 0x9D, 0x88,
+    0x55, 0xA2, 0x98, 0xA3, 0x89, 0x7E, 0x6F, 0x7F, 0x7E, 0x6F, 0x7E, 0xC4, 0x6F, 0x09, 0x55, 0x67,
+    0xA4, 0x88, 0xA8, 0x88, 0xA4, 0x98, 0xA2, 0x88, 0xA2, 0x88, 0xC0, 0x66, 0x33, 0x61, 0x9B, 0x88,
+    0x98, 0x78, 0x98, 0x98, 0x9D, 0x88, 0x56, 0xC0, 0x5A, 0x6B, 0x5A, 0x5A, 0x6B, 0x5A, 0xC0, 0x6F,
+    0xA2, 0x88, 0x7F, 0x7E, 0x6F, 0x7E, 0xC1, 0x7A, 0x66, 0xC0, 0x7E, 0xC6, 0x6E, 0x7F, 0xC0, 0x6E,
+    0xC0, 0x7E, 0xA2, 0x88, 0x6E, 0x7F, 0xC0, 0x6E, 0xC2, 0x6E, 0x7A, 0x06, 0xC1, 0x61, 0x2D, 0x6E,
+    0x01, 0xA2, 0x88, 0x7F, 0x6E, 0x6B, 0xC1, 0x7E, 0xC1, 0x29, 0xC0, 0x55, 0x9D, 0x98, 0x9D, 0x89,
+    0x14, 0xC0, 0x55, 0x66, 0x66, 0xC5, 0x66, 0x00, 0xA7, 0x98, 0xA3, 0x99, 0x34, 0x7B, 0x55, 0x9D,
+    0x98, 0x9D, 0x88, 0x9D, 0x99, 0xA3, 0x98, 0xA4, 0x88, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0x65, 0x69,
+    0xA3, 0x92, 0x96, 0x83, 0x9D, 0x88, 0x66, 0x39, 0x65, 0x34, 0xC0, 0x9C, 0x88, 0xC0, 0xA7, 0x87,
+    0xA2, 0x99, 0x34, 0x9A, 0x99, 0xA4, 0x76, 0x2D, 0xA2, 0x86, 0xA2, 0x87, 0xA2, 0x88, 0x33, 0xA2,
+    0x77, 0xAA, 0x85, 0xA2, 0x87, 0x9A, 0x8A, 0x99, 0x9B, 0xA6, 0x87, 0xA9, 0x88, 0xA3, 0x9B, 0xA2,
+    0x7B, 0xA4, 0x7C, 0x97, 0x9E, 0x8D, 0x8D, 0xA2, 0x99, 0x6B, 0x5E, 0xC4, 0x6E, 0xC3, 0x69, 0xC0,
+    0x66, 0x55, 0x9D, 0xA9, 0x9D, 0x88, 0x9D, 0x98, 0x9D, 0x98, 0x51, 0x60, 0xC1, 0x6E, 0x7A, 0x7F,
+    0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x87, 0xA2, 0x88, 0xA2, 0x88, 0xC0, 0x5A, 0x56, 0x52, 0x51, 0x51,
+    0x9D, 0x99, 0x34, 0xA4, 0x88, 0xA9, 0x99, 0xA5, 0x99, 0xA2, 0x79, 0xA2, 0x88, 0xC1, 0x7F, 0x6E,
+    0x65, 0x17, 0x51, 0x9D, 0x98, 0x41, 0x66, 0xC0, 0x13, 0xC1, 0x18, 0xC0, 0x0C, 0xA4, 0x88, 0xB7,
+    0x76, 0x99, 0x94, 0x96, 0x73, 0x9C, 0x66, 0x9A, 0x79, 0xA2, 0x8A, 0x55, 0x52, 0x66, 0x6F, 0x6E,
+    0x76, 0x9B, 0x89, 0x55, 0xA2, 0x87, 0xA3, 0x97, 0xA7, 0xB6, 0xA4, 0x98, 0xA2, 0x99, 0x99, 0x7B,
+    0x96, 0x6B, 0xA1, 0x7A, 0x9C, 0x79, 0xAB, 0x88, 0x97, 0x98, 0x6D, 0xA8, 0x98, 0xAC, 0xA9, 0x94,
+    0x9D, 0x90, 0x8C, 0xA2, 0x89, 0x7E, 0xC0, 0x6F, 0x7E, 0xC2, 0x9C, 0x88, 0x65, 0xC0, 0x14, 0x6E,
+    0x7E, 0x28, 0x7E, 0xA2, 0x88, 0x7A, 0x6D, 0xC1, 0x7A, 0xC0, 0x51, 0x56, 0x65, 0x66, 0x51, 0x51,
+    0x56, 0x69, 0xC0, 0x69, 0xBC, 0x75, 0x9D, 0x66, 0x8E, 0x4C, 0x9D, 0x7D, 0xA3, 0x89, 0x6F, 0xA2,
+    0x89, 0x6E, 0x50, 0x65, 0x7A, 0xA2, 0x98, 0x1F, 0x55, 0x6F, 0x1F, 0xA2, 0x88, 0x7F, 0x5A, 0x9D,
+    0x99, 0x9E, 0x96, 0xA2, 0xA5, 0xB5, 0xB9, 0x9B, 0xAA, 0x9D, 0xA9, 0x6E, 0x30, 0xC1, 0x55, 0x55,
+    0x21, 0x0D, 0x9D, 0x98, 0x05, 0x51, 0x51, 0x6E, 0xA2, 0x98, 0xA2, 0x88, 0xC0, 0xA2, 0x78, 0x2D,
+    0x7F, 0x6E, 0x7A, 0xC1, 0x57, 0x3C, 0xC0, 0x01, 0xC0, 0x6E, 0xA4, 0x98, 0xA5, 0x9A, 0xA6, 0x88,
+    0xA2, 0x88, 0xC1, 0x7A, 0xC0, 0x51, 0x9A, 0x88, 0x97, 0x87, 0x98, 0x88, 0x55, 0x56, 0xC0, 0x1D,
+    0x6B, 0x5E, 0x57, 0xC0, 0x5A, 0x5A, 0x6B, 0x7E, 0xA2, 0x88, 0x7F, 0x6F, 0x7E, 0x7E, 0x6B, 0x7A,
+    0x69, 0x66, 0xC1, 0x7E, 0xC5, 0x6E, 0x7F, 0xC0, 0x6E, 0xC0, 0x7E, 0xA2, 0x78, 0x7F, 0x7E, 0xC0,
+    0x3A, 0x6B, 0xC1, 0x6E, 0x7A, 0x06, 0xC0, 0x01, 0x55, 0x21, 0x5A, 0x7F, 0xA3, 0x99, 0x6F, 0x7E,
+    0x6E, 0x6B, 0xC0, 0x7E, 0xC1, 0x29, 0x69, 0x51, 0x32, 0x9D, 0x99, 0xC0, 0x14, 0x55, 0x66, 0x66,
+    0xC6, 0x35, 0xA5, 0x99, 0xA3, 0x98, 0x7F, 0xC0, 0x08, 0x9D, 0x98, 0x9B, 0x99, 0x99, 0x98, 0x51,
+    0xA4, 0x87, 0xA4, 0x88, 0xA3, 0x89, 0x7E, 0x66, 0x50, 0xA6, 0x84, 0x9F, 0x82, 0x99, 0x96, 0x56,
+    0xC1, 0x65, 0x6B, 0x2D, 0x52, 0x66, 0xA7, 0x97, 0x9D, 0x89, 0x9B, 0x89, 0xA2, 0x87, 0x2D, 0x7D,
+    0xA3, 0x87, 0xA2, 0x88, 0x9D, 0x8A, 0x69, 0xAC, 0x74, 0xA4, 0x86, 0x99, 0x9B, 0x97, 0x9C, 0xA4,
+    0x87, 0xAA, 0x88, 0xA6, 0x8B, 0xA0, 0x8C, 0xA2, 0x7B, 0x9F, 0x8D, 0x8A, 0x8C, 0x57, 0x7F, 0x5A,
+    0xC8, 0x69, 0x6F, 0xC0, 0x69, 0x28, 0x65, 0x9D, 0x98, 0x9D, 0x89, 0x9D, 0x98, 0x9D, 0x98, 0x60,
+    0x56, 0xC0, 0xA3, 0x98, 0xA2, 0x98, 0xA4, 0x87, 0x6B, 0xC0, 0x14, 0xA2, 0x87, 0x6F, 0x6E, 0x6B,
+    0x56, 0x65, 0x52, 0x51, 0x52, 0x55, 0x61, 0xA2, 0x88, 0xA7, 0x89, 0xA7, 0x99, 0xA4, 0x78, 0x7A,
+    0x56, 0xC0, 0x23, 0x26, 0x55, 0x0B, 0x6B, 0x55, 0x51, 0x66, 0xC0, 0x56, 0x69, 0xC1, 0x5A, 0xC0,
+    0xB4, 0x87, 0xA5, 0x85, 0x93, 0x83, 0x9B, 0x75, 0x99, 0x88, 0xA0, 0x7A, 0x6F, 0x51, 0x56, 0x6F,
+    0x74, 0xC0, 0x9D, 0x89, 0x9D, 0x8A, 0x6E, 0xA3, 0x96, 0xA7, 0xB7, 0xA4, 0xA8, 0xA3, 0x98, 0x9B,
+    0x8B, 0x98, 0x6A, 0x9C, 0x7A, 0x9E, 0x5A, 0xC0, 0x65, 0xA4, 0x87, 0xA5, 0x98, 0xAD, 0xA9, 0x9A,
+    0x9D, 0x8B, 0x9D, 0xA2, 0x89, 0xC0, 0x7E, 0x6F, 0x7E, 0xC1, 0x66, 0x9D, 0x88, 0xC0, 0x6E, 0x28,
+    0x6E, 0xA2, 0x98, 0x7F, 0xA2, 0x78, 0x7E, 0x7E, 0x7E, 0xC3, 0x66, 0x69, 0x66, 0x55, 0x52, 0x55,
+    0x61, 0x51, 0x55, 0x6D, 0xBB, 0x85, 0x95, 0x57, 0x91, 0x6D, 0x9E, 0x6C, 0xA3, 0x89, 0x6F, 0xA2,
+    0x89, 0xC0, 0x64, 0x27, 0x75, 0xA3, 0x88, 0x9D, 0x79, 0x5A, 0x1F, 0x2B, 0xA2, 0x87, 0x7B, 0x33,
+    0x61, 0x9C, 0x96, 0xA8, 0xA6, 0xB3, 0xB9, 0x99, 0xAA, 0xC0, 0x66, 0x66, 0x35, 0xC0, 0x7E, 0x09,
+    0xC0, 0x35, 0x9C, 0x87, 0x9A, 0x89, 0x9D, 0x98, 0x55, 0x31, 0xA2, 0x88, 0x7F, 0x6E, 0x1C, 0xA2,
+    0x78, 0x3C, 0xC1, 0x66, 0x3C, 0x6B, 0x3C, 0x34, 0x2D, 0x3C, 0xA6, 0x88, 0xA6, 0x88, 0xA4, 0x98,
+    0xA4, 0x78, 0x7A, 0xC0, 0x51, 0x6E, 0x33, 0x9A, 0x88, 0x95, 0x88, 0x9A, 0x87, 0x52, 0x65, 0x5B,
+    0xC0, 0x5A, 0x6B, 0x5A, 0x56, 0xC0, 0x5A, 0x67, 0x5E, 0x7E, 0xA2, 0x88, 0x6F, 0x7E, 0x7F, 0x7E,
+    0x6B, 0xC0, 0x79, 0xC2, 0x7A, 0xC5, 0x6E, 0x7E, 0x6B, 0x6E, 0xC0, 0x7E, 0x6F, 0xA2, 0x87, 0x6F,
+    0x7E, 0xC1, 0x6E, 0x01, 0xC0, 0x06, 0x01, 0xC0, 0x35, 0x2D, 0x51, 0x55, 0x19, 0x35, 0x09, 0x6F,
+    0x7F, 0xC0, 0x6E, 0x7E, 0xC1, 0x55, 0x65, 0x51, 0x41, 0x51, 0xC0, 0x66, 0x52, 0x65, 0x56, 0x7A,
+    0x00, 0x66, 0xC2, 0xA5, 0x98, 0xA6, 0x87, 0xA3, 0x99, 0xA3, 0x89, 0xA2, 0x87, 0x66, 0x1F, 0x9D,
+    0x88, 0x9A, 0x98, 0x96, 0x88, 0x1B, 0x7E, 0xA4, 0x87, 0xA5, 0x89, 0xA2, 0x88, 0x65, 0x9D, 0x99,
+    0x32, 0xAD, 0x82, 0x98, 0x83, 0x51, 0x66, 0xC0, 0x66, 0xC1, 0x7E, 0x9C, 0x79, 0xA7, 0x97, 0x7F,
+    0x98, 0x88, 0x5A, 0xA3, 0x98, 0x6D, 0xA3, 0x97, 0xA2, 0x88, 0x56, 0x9D, 0x89, 0xAC, 0x83, 0xA6,
+    0x75, 0x9B, 0xAB, 0x94, 0x8D, 0xA3, 0x87, 0xAA, 0x89, 0xA7, 0x9C, 0xA1, 0x8D, 0xA0, 0x8B, 0xA3,
+    0x7C, 0x8C, 0x8C, 0x99, 0x99, 0xA2, 0x89, 0xC1, 0x5A, 0xC0, 0x6E, 0xC4, 0x2F, 0x34, 0xC0, 0x2F,
+    0x6D, 0x66, 0x19, 0x9D, 0x98, 0x9D, 0x99, 0x50, 0x60, 0x51, 0x7F, 0xA4, 0x88, 0xA3, 0x98, 0xA1,
+    0xA8, 0xA2, 0x78, 0x7A, 0x55, 0x55, 0x7E, 0x5A, 0xC0, 0x56, 0x66, 0xC0, 0x56, 0x66, 0x66, 0x18,
+    0x52, 0x65, 0x1F, 0xA7, 0x98, 0xA5, 0x89, 0x7B, 0x5A, 0xC0, 0x6E, 0x17, 0x66, 0x5A, 0xC0, 0x03,
+    0x56, 0x65, 0xC0, 0x66, 0x55, 0xC1, 0x55, 0xAC, 0x78, 0xB1, 0x76, 0x95, 0xA4, 0x98, 0x73, 0x9B,
+    0x77, 0x9C, 0x89, 0x5F, 0x56, 0x66, 0xC0, 0x79, 0xA2, 0x87, 0x9C, 0x7A, 0x9C, 0x79, 0x7E, 0x7D,
+    0xA6, 0xA6, 0xA6, 0xA8, 0xA2, 0x98, 0x42, 0x9B, 0x8A, 0x9D, 0x7A, 0x98, 0x5C, 0x5A, 0x51, 0xA5,
+    0x98, 0xA5, 0x86, 0xAB, 0xA9, 0xA0, 0xAD, 0x88, 0x9D, 0xA0, 0x8A, 0x6E, 0x6E, 0x7F, 0x7A, 0xC2,
+    0x9D, 0x88, 0x6E, 0x7F, 0x6E, 0xA2, 0x98, 0xA2, 0x88, 0xA2, 0x88, 0x7E, 0x7F, 0xA2, 0x87, 0x6F,
+    0xC0, 0x7A, 0x6E, 0x6B, 0x24, 0x1F, 0xC0, 0x65, 0x10, 0x61, 0x56, 0x51, 0x9D, 0x98, 0xA4, 0x76,
+    0xB5, 0x85, 0x8F, 0x57, 0x94, 0x5D, 0x9F, 0x7D, 0xA3, 0x78, 0xA2, 0x88, 0xA1, 0xA9, 0xC0, 0x51,
+    0x64, 0x79, 0xA2, 0x89, 0x9C, 0x79, 0xA2, 0x78, 0x6E, 0x7F, 0x6F, 0xC0, 0x2E, 0x60, 0x9D, 0xA7,
+    0xAF, 0xB6, 0xAA, 0xA9, 0x98, 0x99, 0x6F, 0xC0, 0x7B, 0xC0, 0x69, 0xC0, 0xA2, 0x88, 0x7F, 0x0C,
+    0x29, 0x51, 0x55, 0x66, 0x55, 0xA1, 0xA9, 0xA2, 0x88, 0x66, 0x56, 0x55, 0x37, 0x56, 0x69, 0x23,
+    0x28, 0x2F, 0x28, 0x2F, 0x3C, 0xA3, 0x99, 0xA8, 0x88, 0xA3, 0x98, 0xA3, 0x89, 0xA2, 0x88, 0x7A,
+    0xC0, 0x55, 0x66, 0x9A, 0x88, 0x04, 0x9A, 0x87, 0x66, 0x56, 0xC0, 0x6B, 0x5A, 0xC0, 0x5F, 0x66,
+    0xC0, 0x5A, 0x56, 0xC0, 0x56, 0x6E, 0x7F, 0xA2, 0x78, 0x7E, 0x7F, 0x7F, 0xC1, 0x79, 0xC1, 0x7A,
+    0xC6, 0x6E, 0x7E, 0x07, 0x6E, 0xC0, 0x6E, 0x7F, 0x7E, 0xA2, 0x77, 0x7F, 0x6E, 0xC3, 0x01, 0xC0,
+    0x35, 0x56, 0x51, 0x51, 0x6E, 0xC0, 0x7E, 0x2D, 0x7F, 0xA2, 0x88, 0x6E, 0x7A, 0x22, 0x7D, 0x69,
+    0x56, 0x55, 0x61, 0x56, 0x55, 0x66, 0x56, 0x62, 0x56, 0x66, 0xC0, 0x00, 0x65, 0xC1, 0xA3, 0x99,
+    0xA6, 0x88, 0xA5, 0x88, 0xA3, 0x98, 0xA2, 0x98, 0x6E, 0xC0, 0x2B, 0x9C, 0x87, 0x99, 0x99, 0x97,
+    0x99, 0x99, 0x88, 0x9D, 0x98, 0x56, 0xA4, 0x87, 0xA3, 0x88, 0x7F, 0xC0, 0x65, 0xB1, 0x84, 0xA0,
+    0x91, 0x9A, 0x76, 0x66, 0xC0, 0x66, 0xC1, 0xA2, 0x87, 0x51, 0x34, 0xA8, 0x87, 0x2D, 0x9C, 0x89,
+    0xA4, 0x77, 0x7E, 0xA3, 0x86, 0xA2, 0x98, 0x56, 0x51, 0xA9, 0x85, 0xA9, 0x84, 0x9C, 0x8B, 0x95,
+    0x9C, 0x3D, 0xA9, 0x99, 0xA9, 0x8C, 0xA4, 0x7C, 0x9F, 0x9C, 0xA3, 0x7B, 0x93, 0x9B, 0x17, 0x7F,
+    0x6F, 0x5A, 0xC1, 0x6E, 0xC9, 0x69, 0x65, 0x51, 0x41, 0x9D, 0xA9, 0x64, 0xC0, 0xA2, 0x98, 0xA2,
+    0x87, 0x7B, 0x7E, 0x08, 0xC0, 0x7E, 0x9D, 0x88, 0x51, 0x6E, 0x6E, 0xC0, 0x56, 0x7F, 0x31, 0x7F,
+    0x5A, 0xC0, 0x66, 0x9D, 0x99, 0x51, 0x6F, 0xA5, 0x98, 0xA4, 0x88, 0xA3, 0x99, 0xC2, 0x56, 0x65,
+    0xC0, 0x5A, 0x7E, 0x0F, 0x69, 0x03, 0x3B, 0x61, 0x55, 0x07, 0x3B, 0xB8, 0x66, 0x9C, 0x95, 0x96,
+    0x83, 0x9B, 0x76, 0x99, 0x88, 0x5F, 0x6B, 0x65, 0x64, 0x69, 0xA2, 0x88, 0x42, 0x99, 0x8A, 0x6F,
+    0x69, 0xA6, 0xA5, 0xA6, 0xA8, 0xA3, 0x98, 0x67, 0x9D, 0x89, 0x9E, 0x6A, 0x94, 0x5D, 0xA2, 0x78,
+    0x9D, 0x99, 0xA4, 0x77, 0xA5, 0x86, 0xA9, 0xB8, 0xA5, 0xBD, 0x88, 0x8E, 0x9D, 0x9B, 0xC0, 0x6E,
+    0x7F, 0x6E, 0x7A, 0x6E, 0x37, 0x40, 0x7B, 0xA2, 0x77, 0xA3, 0x99, 0x7F, 0xA2, 0x88, 0xA2, 0x97,
+    0x6F, 0x7E, 0xA2, 0x87, 0x7F, 0x6E, 0x6B, 0xC0, 0x6E, 0x76, 0x38, 0x33, 0xC1, 0x66, 0x55, 0x55,
+    0x51, 0xA5, 0x86, 0xAD, 0x85, 0x8D, 0x48, 0x96, 0x6D, 0xA1, 0x7C, 0xA3, 0x89, 0x6E, 0xA2, 0x98,
+    0x56, 0x60, 0x9D, 0xA8, 0xA2, 0x97, 0xA0, 0x7A, 0x41, 0xA2, 0x78, 0x6E, 0x7F, 0x7F, 0x56, 0x60,
+    0x61, 0x9E, 0xA6, 0xB6, 0xA5, 0x9C, 0xA9, 0x9B, 0xAB, 0xA2, 0x78, 0x7E, 0x6B, 0x7E, 0xC0, 0xA2,
+    0x88, 0xA2, 0x87, 0x6B, 0x55, 0x65, 0x38, 0xC0, 0x6E, 0x00, 0x14, 0xA2, 0x88, 0xC0, 0x66, 0x07,
+    0x24, 0x10, 0x0B, 0x10, 0x7F, 0x24, 0x1F, 0xC0, 0x33, 0xA6, 0x88, 0xA4, 0x98, 0xA2, 0x88, 0x6E,
+    0x6F, 0xC0, 0x7A, 0x9D, 0x98, 0x99, 0x89, 0x97, 0x88, 0x9B, 0x88, 0x69, 0x08, 0xC0, 0x6B, 0xC0,
+    0x5E, 0x6B, 0xC0, 0x5A, 0x67, 0x5A, 0x69, 0x56, 0x46, 0x65, 0x7F, 0xA2, 0x78, 0x7F, 0x7E, 0x7F,
+    0xC1, 0x79, 0xC1, 0x7A, 0xC6, 0x6E, 0x7E, 0x6F, 0xC1, 0x7E, 0x6F, 0x7E, 0x6F, 0x7E, 0x6E, 0xC0,
+    0x6E, 0xC1, 0x01, 0x55, 0x66, 0x51, 0x55, 0xC1, 0x66, 0xC0, 0x7E, 0x19, 0xA2, 0x87, 0xA2, 0x87,
+    0x7E, 0xA2, 0x87, 0x6E, 0x69, 0xC0, 0x65, 0x56, 0x66, 0x56, 0x66, 0x56, 0x52, 0x66, 0x56, 0x66,
+    0x66, 0xC1, 0x7F, 0xA6, 0x88, 0x2F, 0xA4, 0x88, 0xA3, 0x98, 0xA2, 0x78, 0x7A, 0xC0, 0x33, 0x9C,
+    0x88, 0x99, 0x98, 0x96, 0x88, 0x99, 0x89, 0x51, 0x51, 0x7E, 0xA2, 0x78, 0x7E, 0xA2, 0x88, 0x6B,
+    0xAB, 0x96, 0xAB, 0x91, 0x97, 0x84, 0x56, 0x65, 0x66, 0xC1, 0xA2, 0x87, 0x0D, 0x9B, 0x89, 0xA9,
+    0x98, 0x9A, 0x98, 0x9C, 0x78, 0xA3, 0x88, 0x7E, 0xA2, 0x87, 0xA2, 0x87, 0x7A, 0x41, 0xA7, 0x85,
+    0xAB, 0x84, 0x57, 0x99, 0xAC, 0x97, 0x8B, 0xA7, 0x99, 0xAB, 0x8C, 0xA4, 0x7D, 0xA0, 0x8B, 0x09,
+    0x95, 0x9A, 0x8F, 0x9C, 0x6F, 0x6F, 0xC2, 0x6E, 0xC5, 0x7A, 0x6E, 0xC1, 0x37, 0x59, 0x19, 0x51,
+    0x51, 0x60, 0xC0, 0xA4, 0x97, 0xA2, 0x88, 0x66, 0x7D, 0x66, 0xC0, 0x0D, 0x50, 0x9C, 0x88, 0x55,
+    0x6E, 0x7F, 0xA2, 0x88, 0x6F, 0x7F, 0x6B, 0xC0, 0x0C, 0xC0, 0x51, 0x51, 0x52, 0xC1, 0xA3, 0x98,
+    0xA4, 0x88, 0xA2, 0x88, 0xC0, 0x66, 0x1B, 0xC0, 0x6F, 0x2F, 0x6F, 0x03, 0xC1, 0x3B, 0x2F, 0x1B,
+    0x5A, 0xB6, 0x78, 0x09, 0x97, 0xA5, 0x99, 0x86, 0x9B, 0x77, 0x9B, 0x88, 0x6F, 0xA2, 0x86, 0xA1,
+    0xA7, 0x50, 0x5B, 0x42, 0x99, 0x8A, 0x5B, 0x69, 0xA5, 0xA6, 0xA7, 0xB8, 0xA3, 0x98, 0x7B, 0x40,
+    0x9E, 0x7B, 0x92, 0x5D, 0xA2, 0x69, 0x51, 0xA3, 0x88, 0xA5, 0x86, 0xA8, 0xA7, 0xA8, 0xAD, 0x89,
+    0xAE, 0x99, 0x8B, 0xA2, 0x88, 0xC0, 0x7F, 0x6E, 0x7A, 0x6E, 0xC0, 0x51, 0x6E, 0xA3, 0x99, 0xA2,
+    0x88, 0xA2, 0x88, 0xA2, 0x98, 0x7E, 0x6F, 0x2B, 0xA2, 0x88, 0x7E, 0x6E, 0x6B, 0xC0, 0x6E, 0x76,
+    0x69, 0x0C, 0x07, 0xC0, 0x66, 0x55, 0x66, 0x50, 0xA7, 0x87, 0xA7, 0x74, 0x8C, 0x48, 0x99, 0x6D,
+    0xA1, 0x7C, 0xA3, 0x89, 0x7E, 0xA2, 0x88, 0x33, 0x64, 0x9C, 0xA7, 0xA4, 0x99, 0x9D, 0x7A, 0x4B,
+    0xA3, 0x77, 0x2B, 0xA2, 0x88, 0xC0, 0x33, 0x61, 0x9C, 0x97, 0xA5, 0xB7, 0xB3, 0xA6, 0x8D, 0xB9,
+    0xA0, 0x9A, 0xA3, 0x89, 0xA2, 0x88, 0x7F, 0x6E, 0x13, 0xA3, 0x89, 0xA2, 0x87, 0x0C, 0xC0, 0x00,
+    0xC1, 0x0C, 0xA2, 0x98, 0xA3, 0x88, 0xA2, 0x88, 0xC0, 0x52, 0x66, 0x55, 0x23, 0x66, 0x6F, 0x3E,
+    0x03, 0x3E, 0x69, 0x03, 0x1A, 0xA2, 0x88, 0x6E, 0xC2, 0x1A, 0x9A, 0x87, 0x98, 0x77, 0x9B, 0x99,
+    0x6E, 0x6B, 0x6E, 0x6F, 0x6B, 0xC1, 0x6B, 0x38, 0xC0, 0x56, 0x55, 0xC0, 0x52, 0x45, 0x56, 0x02,
+    0x6F, 0x7F, 0x7E, 0x7F, 0xC1, 0x30, 0xC1, 0x7A, 0xC6, 0x38, 0x7E, 0x6F, 0xC0, 0x7A, 0x6F, 0x6E,
+    0x7E, 0x6F, 0x6E, 0x7E, 0xC0, 0x6E, 0x01, 0xC0, 0x55, 0x28, 0x55, 0x55, 0x66, 0xC4, 0x6D, 0x7E,
+    0xA3, 0x87, 0xA2, 0x87, 0xA2, 0x87, 0x7D, 0x6E, 0xC0, 0x38, 0x66, 0x56, 0x66, 0x56, 0x66, 0x52,
+    0x56, 0x62, 0x2D, 0xC0, 0x6B, 0x6E, 0xA4, 0x99, 0xA4, 0x87, 0xA4, 0x88, 0xA4, 0x98, 0xA3, 0x88,
+    0x7F, 0x6E, 0xC0, 0x62, 0x1F, 0x17, 0x96, 0x88, 0x98, 0x89, 0x55, 0x51, 0x7E, 0x1B, 0x7E, 0xA2,
+    0x88, 0xA2, 0x78, 0xA3, 0x88, 0xB1, 0x93, 0x9A, 0x92, 0x9B, 0x87, 0x66, 0xC0, 0x65, 0x69, 0x7F,
+    0xA4, 0x77, 0x9A, 0x89, 0xA5, 0x98, 0xC0, 0x9A, 0x78, 0x6E, 0xA2, 0x88, 0xA2, 0x97, 0xA2, 0x86,
+    0x7F, 0x9D, 0x89, 0xA5, 0x86, 0xAC, 0x73, 0x7E, 0x57, 0x93, 0x9D, 0xA1, 0x8A, 0xAD, 0x9C, 0xA6,
+    0x7D, 0xA0, 0x8C, 0xA1, 0x8B, 0x93, 0xAC, 0x91, 0x79, 0x28, 0xC0, 0x6B, 0xC2, 0x6E, 0xC4, 0x7E,
+    0x6B, 0xC0, 0x3C, 0xC0, 0x69, 0x28, 0x55, 0x51, 0x50, 0x65, 0xA2, 0x99, 0xA4, 0x87, 0x7A, 0x65,
+    0xC1, 0x69, 0x55, 0x9D, 0x88, 0x9D, 0x98, 0x55, 0xC0, 0xA3, 0x99, 0xA2, 0x89, 0x6E, 0x6B, 0x7F,
+    0x6B, 0xC0, 0x66, 0x33, 0x51, 0x56, 0x37, 0x45, 0x7F, 0x08, 0x1C, 0xA2, 0x88, 0x7E, 0x6B, 0x07,
+    0x13, 0x7E, 0xC0, 0x27, 0x7E, 0xC1, 0x27, 0x54, 0xAF, 0x89, 0xAD, 0x78, 0x9B, 0xB4, 0x97, 0x84,
+    0x9C, 0x85, 0x9C, 0x78, 0x59, 0x7D, 0xA5, 0x97, 0x9C, 0x88, 0x9C, 0x89, 0x9F, 0x6A, 0x99, 0x7B,
+    0x52, 0xC0, 0xA4, 0x95, 0xA7, 0xB8, 0xA3, 0xA8, 0x7E, 0x2E, 0x9F, 0x8C, 0x90, 0x5D, 0xA2, 0x6A,
+    0x55, 0x7E, 0xA6, 0x76, 0xA6, 0xA6, 0xAB, 0xAC, 0x8D, 0xAF, 0x93, 0x9C, 0xA3, 0x89, 0xC0, 0x7E,
+    0x6F, 0x7A, 0x6E, 0xC0, 0x55, 0xA2, 0x98, 0xA3, 0x88, 0xA2, 0x89, 0xA2, 0x98, 0xA2, 0x88, 0xA2,
+    0x87, 0x7F, 0x6E, 0x7F, 0x18, 0x7A, 0xC0, 0x6E, 0x6B, 0x20, 0xC1, 0x1B, 0xC0, 0x66, 0x55, 0x65,
+    0x41, 0xA8, 0x86, 0xA1, 0x75, 0x8E, 0x48, 0x9A, 0x6D, 0x12, 0xA3, 0x88, 0xA2, 0x87, 0x7F, 0x51,
+    0x60, 0x9D, 0xA6, 0xA5, 0x9A, 0x9B, 0x7B, 0xA2, 0x68, 0xA2, 0x77, 0x7F, 0xA1, 0xA9, 0x5A, 0x61,
+    0x50, 0x9A, 0xA8, 0xB2, 0xB5, 0xA2, 0xA6, 0x8B, 0xAA, 0xA2, 0x89, 0x7F, 0x6E, 0x7F, 0xA2, 0x88,
+    0xA3, 0x89, 0xA4, 0x98, 0xA4, 0x77, 0x7F, 0x6E, 0xC1, 0xA2, 0x88, 0xA2, 0x99, 0xA4, 0x77, 0xA2,
+    0x99, 0xA2, 0x88, 0xC0, 0x5A, 0x66, 0x0B, 0xC1, 0x17, 0x1F, 0x7F, 0xC0, 0x56, 0x1F, 0xC0, 0x2E,
+    0x6E, 0xC0, 0x2E, 0x1F, 0x9A, 0x98, 0x98, 0x77, 0x9B, 0x89, 0x7E, 0xC1, 0xA2, 0x79, 0x6E, 0x6B,
+    0xC1, 0x5A, 0xC0, 0x66, 0x56, 0x55, 0x56, 0x56, 0x56, 0x55, 0xC0, 0xA2, 0x88, 0x6F, 0x7A, 0x7F,
+    0xC1, 0x79, 0xC1, 0x7A, 0xC4, 0x38, 0xC1, 0x7F, 0x6E, 0xC0, 0x7A, 0x6F, 0x6E, 0x7E, 0x6F, 0x6E,
+    0xC0, 0x7E, 0xC0, 0x39, 0x32, 0x66, 0x56, 0x69, 0x05, 0x00, 0x59, 0x66, 0x36, 0x7A, 0x6E, 0x6D,
+    0xA2, 0x88, 0xA3, 0x96, 0xA2, 0x86, 0xA2, 0x87, 0x6E, 0x6E, 0x7A, 0x66, 0x31, 0x65, 0x56, 0x52,
+    0x52, 0x66, 0x57, 0x67, 0x51, 0x67, 0xC0, 0xA3, 0x99, 0xA4, 0x89, 0xA3, 0x88, 0xA3, 0x98, 0x1F,
+    0xA3, 0x98, 0x6F, 0x6E, 0x7A, 0x0C, 0x2E, 0x9C, 0x87, 0x2F, 0x96, 0x88, 0x9C, 0x88, 0x52, 0x6E,
+    0x7F, 0xA2, 0x88, 0xA3, 0x88, 0xA2, 0x88, 0x59, 0xAB, 0x96, 0xA4, 0x92, 0x97, 0x95, 0x56, 0x69,
+    0x65, 0x69, 0x7F, 0xA4, 0x77, 0x9D, 0x99, 0x34, 0xA7, 0x87, 0x97, 0x99, 0x5F, 0xA2, 0x87, 0xA1,
+    0xA8, 0xA3, 0x87, 0x7E, 0x51, 0xA2, 0x77, 0xAD, 0x83, 0xA2, 0x86, 0xA1, 0x8A, 0x95, 0x9D, 0x99,
+    0x8B, 0xAC, 0x8A, 0xA8, 0x8E, 0xA3, 0x8C, 0x98, 0x8C, 0x8F, 0x9C, 0x45, 0x28, 0xC0, 0x6B, 0xC2,
+    0x6E, 0xC4, 0x7E, 0xC4, 0x55, 0x65, 0x19, 0x65, 0x51, 0x7E, 0xA3, 0x98, 0xA2, 0x88, 0x61, 0xC0,
+    0x7E, 0x55, 0x54, 0x50, 0x51, 0x51, 0x55, 0xC0, 0x14, 0x6F, 0x7B, 0x6F, 0x66, 0x6B, 0xC0, 0x52,
+    0x17, 0x51, 0x55, 0x51, 0x55, 0x52, 0xC0, 0x1B, 0x34, 0xA2, 0x88, 0x2B, 0xA2, 0x88, 0x6E, 0x7B,
+    0xA2, 0x77, 0x7E, 0x66, 0x18, 0x1B, 0x55, 0xA8, 0x78, 0xB4, 0x78, 0x9E, 0x96, 0x9B, 0x92, 0x9A,
+    0x94, 0x9F, 0x76, 0x40, 0x60, 0xA5, 0x96, 0x66, 0x97, 0x8B, 0x9F, 0x6A, 0x9A, 0x6B, 0x42, 0xC0,
+    0xA2, 0x96, 0xA7, 0xB7, 0xA4, 0xA8, 0x7E, 0x45, 0xA0, 0x7A, 0x90, 0x6D, 0xA2, 0x6B, 0x59, 0x51,
+    0xA6, 0x86, 0xA6, 0x96, 0xAB, 0xBB, 0x93, 0xAF, 0x8E, 0x8C, 0xA3, 0x89, 0xC0, 0x7E, 0x6F, 0x37,
+    0x6E, 0xC0,
+};
+
+const img_asset_t img_yingwu = {
+    .data = yingwu_data,
+    .size = sizeof(yingwu_data),
+};
@@ -0,0 +1,449 @@
+#!/usr/bin/env python3
+"""从LVGL内置字体(lv_font_conv生成的lv_font_fmt_txt C源文件)中只保留界面用到的字形，输出子集字体C源文件。
+
+用到的字符：扫描界面源码里的字符串字面量和LV_SYMBOL_xxx，跳过日志、printf等调用里的字符串；
+含%的字符串按格式串处理，去掉%d等转换说明。另外总是保留数字和格式化数值会用到的" +-.:%"。
+
+每个--font输出一个<名字>.c；--letters输出一个头文件，以UTF-8字符串定义用到的字符(UI_FONT_LETTERS)，供主机基准校验。
+
+示例：
+  python tools/font_subset.py -o build/fonts --letters build/fonts/ui_font_letters.h \\
+      --font components/lvgl/src/font/lv_font_montserrat_20.c:ui_font_montserrat_20 \\
+      components/ui_app/screens/ui_Screen1.c main/main_update.c
+"""
+
+import argparse
+import os
+import re
+import sys
+
+KEEP = '0123456789 +-.:%'
+IGNORE_CALLS = re.compile(r'^(ESP_LOG[EWIDV]|ESP_EARLY_LOG[EWIDV]|ESP_DRAM_LOG[EWIDV]|printf|fprintf|puts|'
+                          r'ESP_RETURN_ON_\w+|ESP_GOTO_ON_\w+|ESP_ERROR_CHECK\w*|LV_LOG_\w+|LV_ASSERT\w*|'
+                          r'assert|abort)$')
+FORMAT_SPEC = re.compile(r'%(?:%|[-+ #0]*(?:\d+|\*)?(?:\.(?:\d+|\*))?(?:hh|h|ll|l|L|z|j|t)?[diouxXeEfgGcspn])')
+
+CMAP_FORMAT0_TINY = 'LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY'
+CMAP_FORMAT0_FULL = 'LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL'
+CMAP_SPARSE_TINY = 'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY'
+CMAP_BYTES = 20             # 32位目标上lv_font_fmt_txt_cmap_t的大小
+GLYPH_DSC_BYTES = 8         # lv_font_fmt_txt_glyph_dsc_t的大小
+
+
+# ---------- 扫描源码 ----------
+
+def c_unescape(body):
+    """C字符串字面量内容 → bytes(源文件按UTF-8读入)"""
+    out = bytearray()
+    i = 0
+    while i < len(body):
+        c = body[i]
+        if c != '\\':
+            out += c.encode('utf-8')
+            i += 1
+            continue
+        i += 1
+        c = body[i] if i < len(body) else ''
+        if c == 'x':
+            m = re.match(r'[0-9a-fA-F]+', body[i + 1:])
+            out.append(int(m.group(0), 16) & 0xFF)
+            i += 1 + len(m.group(0))
+        elif c in '01234567':
+            m = re.match(r'[0-7]{1,3}', body[i:])
+            out.append(int(m.group(0), 8) & 0xFF)
+            i += len(m.group(0))
+        elif c in 'uU':
+            n = 4 if c == 'u' else 8
+            out += chr(int(body[i + 1:i + 1 + n], 16)).encode('utf-8')
+            i += 1 + n
+        else:
+            out += {'n': b'\n', 't': b'\t', 'r': b'\r', 'a': b'\a', 'b': b'\b', 'f': b'\f', 'v': b'\v'}.get(
+                c, c.encode('utf-8'))
+            i += 1
+    return bytes(out)
+
+
+def scan_strings(text):
+    """返回不在忽略调用里的字符串字面量，跳过注释、字符常量和#define以外的预处理行(#include、#error等)"""
+    strings = []
+    calls = []              # 每层括号对应的调用名(不是调用时为None)
+    i, n = 0, len(text)
+    line_start = True
+    while i < n:
+        c = text[i]
+        if line_start and c == '#':
+            m = re.match(r'#\s*(?!define\b)\w+[^\n]*', text[i:])
+            if m:
+                i += len(m.group(0))
+                continue
+        if c == '\n':
+            line_start = True
+            i += 1
+            continue
+        if c in ' \t\r':
+            i += 1
+            continue
+        line_start = False
+        if text.startswith('//', i):
+            i = text.find('\n', i)
+            i = n if i < 0 else i
+        elif text.startswith('/*', i):
+            i = text.find('*/', i + 2)
+            i = n if i < 0 else i + 2
+        elif c == '"':
+            m = re.match(r'"((?:[^"\\\n]|\\.)*)"', text[i:])
+            if not m:
+                i += 1
+                continue
+            if not any(name and IGNORE_CALLS.match(name) for name in calls):
+                strings.append(c_unescape(m.group(1)))
+            i += len(m.group(0))
+        elif c == "'":
+            m = re.match(r"'(?:[^'\\\n]|\\.)*'", text[i:])
+            i += len(m.group(0)) if m else 1
+        elif c.isalpha() or c == '_':
+            m = re.match(r'\w+', text[i:])
+            name = m.group(0)
+            i += len(name)
+            j = i
+            while j < n and text[j] in ' \t\r\n':
+                j += 1
+            if j < n and text[j] == '(':
+                calls.append(name)
+                i = j + 1
+        elif c == '(':
+            calls.append(None)
+            i += 1
+        elif c == ')':
+            if calls:
+                calls.pop()
+            i += 1
+        else:
+            i += 1
+    return strings
+
+
+def load_symbols(path):
+    """lv_symbol_def.h：LV_SYMBOL_xxx → 字符"""
+    symbols = {}
+    for m in re.finditer(r'#define\s+(LV_SYMBOL_\w+)\s+"((?:[^"\\]|\\.)*)"', open(path, encoding='utf-8').read()):
+        symbols[m.group(1)] = c_unescape(m.group(2)).decode('utf-8', 'ignore')
+    return symbols
+
+
+def collect_letters(paths, symbols):
+    letters = set(ord(c) for c in KEEP)
+    for path in paths:
+        text = open(path, encoding='utf-8', errors='replace').read()
+        for raw in scan_strings(text):
+            s = raw.decode('utf-8', 'ignore')
+            if '%' in s:
+                s = FORMAT_SPEC.sub(lambda m: '%' if m.group(0) == '%%' else '', s)
+            letters.update(ord(c) for c in s if ord(c) >= 0x20)
+        for name in set(re.findall(r'\bLV_SYMBOL_\w+', text)):
+            letters.update(ord(c) for c in symbols.get(name, ''))
+    return letters
+
+
+# ---------- 读取lv_font_fmt_txt字体 ----------
+
+def c_array(text, name):
+    m = re.search(r'\b' + re.escape(name) + r'\[\]\s*=\s*\{(.*?)\};', text, re.S)
+    if not m:
+        return None
+    body = re.sub(r'/\*.*?\*/', '', m.group(1), flags=re.S)
+    return [int(v, 0) for v in body.replace('\n', ' ').split(',') if v.strip()]
+
+
+def c_field(text, name, default=None):
+    m = re.search(r'\.' + name + r'\s*=\s*([^,\s}]+)', text)
+    if not m:
+        if default is None:
+            sys.exit(f'font field .{name} not found')
+        return default
+    return m.group(1)
+
+
+class Font:
+    def __init__(self, path):
+        text = open(path, encoding='utf-8').read()
+        self.path = path
+        self.header = re.search(r'/\*{5,}\n(.*?)\n \*{5,}/', text, re.S).group(1)
+        self.bpp = int(c_field(text, 'bpp'))
+        if int(c_field(text, 'bitmap_format')) != 0:
+            sys.exit(f'{path}: only uncompressed (bitmap_format 0) fonts are supported')
+        self.bitmap = c_array(text, 'glyph_bitmap')
+        self.glyphs = [tuple(int(v) for v in g) for g in re.findall(
+            r'\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), '
+            r'\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}', text)]
+        self.cmap = {}
+        self.cmap_num = 0
+        self.list_length = 0
+        for m in re.finditer(r'\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*'
+                             r'\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), '
+                             r'\.type = (\w+)', text):
+            start, length, gid_start = int(m.group(1)), int(m.group(2)), int(m.group(3))
+            self.cmap_num += 1
+            self.list_length += int(m.group(6))
+            if m.group(7) == CMAP_FORMAT0_TINY:
+                for rcp in range(length):
+                    self.cmap.setdefault(start + rcp, gid_start + rcp)
+            elif m.group(7) == CMAP_SPARSE_TINY:
+                for ofs, rcp in enumerate(c_array(text, m.group(4))):
+                    self.cmap.setdefault(start + rcp, gid_start + ofs)
+            else:
+                sys.exit(f'{path}: cmap type {m.group(7)} is not supported')
+        self.kern_classes = int(c_field(text, 'kern_classes', '0'))
+        self.kern_scale = int(c_field(text, 'kern_scale', '0'))
+        self.kern = None
+        if c_field(text, 'kern_dsc', 'NULL') != 'NULL':
+            if self.kern_classes != 1:
+                sys.exit(f'{path}: only class based kerning (--force-fast-kern-format) is supported')
+            self.kern = (c_array(text, 'kern_left_class_mapping'), c_array(text, 'kern_right_class_mapping'),
+                         c_array(text, 'kern_class_values'), int(c_field(text, 'left_class_cnt')),
+                         int(c_field(text, 'right_class_cnt')))
+        self.metrics = {name: c_field(text, name) for name in
+                        ('line_height', 'base_line', 'subpx', 'underline_position', 'underline_thickness')}
+
+    def glyph_bytes(self, gid):
+        g = self.glyphs[gid]
+        return self.bitmap[g[0]:g[0] + (g[2] * g[3] * self.bpp + 7) // 8]
+
+    def size_bytes(self):
+        """常量数据大小：位图、字形描述、字符映射和字距表"""
+        total = len(self.bitmap) + GLYPH_DSC_BYTES * len(self.glyphs)
+        total += CMAP_BYTES * self.cmap_num + 2 * self.list_length
+        if self.kern:
+            total += 2 * len(self.glyphs) + self.kern[3] * self.kern[4]
+        return total
+
+
+# ---------- 输出子集 ----------
+
+def plan_cmaps(letters):
+    """U+00FF以内的码位用一个FORMAT0_FULL映射：每个码位一字节glyph id，查找不用二分，没有的字符为0；
+    其余(图标等)放进一个SPARSE_TINY映射"""
+    cmaps = []
+    low = [cp for cp in letters if cp <= 0xFF]
+    high = [cp for cp in letters if cp > 0xFF]
+    if low:
+        cmaps.append((CMAP_FORMAT0_FULL, low))
+    if high:
+        cmaps.append((CMAP_SPARSE_TINY, high))
+    return cmaps
+
+
+def c_list(values, per_line, fmt='{}'):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(fmt.format(v) for v in values[i:i + per_line]))
+    return ',\n'.join(lines)
+
+
+def char_comment(cp):
+    ch = chr(cp)
+    return ch if ch.isprintable() and cp < 0xE000 else ''
+
+
+def write_subset(font, name, wanted, out_path):
+    letters = sorted(cp for cp in wanted if cp in font.cmap)
+    cmaps = plan_cmaps(letters)
+    order = [cp for _, group in cmaps for cp in group]         # 新glyph id - 1 → 码位
+
+    bitmap_lines, glyph_lines, bitmap = [], [], []
+    glyph_lines.append('    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} '
+                       '/* id = 0 reserved */')
+    for cp in order:
+        gid = font.cmap[cp]
+        data = font.glyph_bytes(gid)
+        g = font.glyphs[gid]
+        glyph_lines.append(f'    {{.bitmap_index = {len(bitmap)}, .adv_w = {g[1]}, .box_w = {g[2]}, .box_h = {g[3]}, '
+                           f'.ofs_x = {g[4]}, .ofs_y = {g[5]}}}')
+        bitmap_lines.append(f'    /* U+{cp:04X} "{char_comment(cp)}" */')
+        if data:
+            bitmap_lines.append(c_list(data, 8, '0x{:x}') + ',')
+        bitmap_lines.append('')
+        bitmap += data
+
+    cmap_defs, unicode_lists, glyph_id = [], [], 1
+    for kind, group in cmaps:
+        start = group[0]
+        if kind == CMAP_FORMAT0_FULL:
+            # glyph_id_start为0，偏移表里直接是glyph id
+            list_name = f'glyph_id_ofs_list_{len(cmap_defs)}'
+            ids = dict((cp, glyph_id + i) for i, cp in enumerate(group))
+            unicode_lists.append(f'static const uint8_t {list_name}[] = {{\n'
+                                 f'{c_list([ids.get(cp, 0) for cp in range(start, group[-1] + 1)], 8)}\n}};\n')
+            cmap_defs.append(f'        .range_start = {start}, .range_length = {group[-1] - start + 1}, .glyph_id_start = 0,\n'
+                             f'        .unicode_list = NULL, .glyph_id_ofs_list = {list_name}, .list_length = {group[-1] - start + 1}, '
+                             f'.type = {kind}')
+        else:
+            list_name = f'unicode_list_{len(cmap_defs)}'
+            unicode_lists.append(f'static const uint16_t {list_name}[] = {{\n'
+                                 f'{c_list([cp - start for cp in group], 8, "0x{:x}")}\n}};\n')
+            cmap_defs.append(f'        .range_start = {start}, .range_length = {group[-1] - start + 1}, '
+                             f'.glyph_id_start = {glyph_id},\n'
+                             f'        .unicode_list = {list_name}, .glyph_id_ofs_list = NULL, .list_length = {len(group)}, '
+                             f'.type = {kind}')
+        glyph_id += len(group)
+
+    # 字距：只保留用到的左右分类，重新编号后截取分类值矩阵
+    kern_text, kern_size = '', 0
+    if font.kern:
+        left_map, right_map, values, left_cnt, right_cnt = font.kern
+        left_used = sorted({left_map[font.cmap[cp]] for cp in order} - {0})
+        right_used = sorted({right_map[font.cmap[cp]] for cp in order} - {0})
+        matrix = [values[(l - 1) * right_cnt + (r - 1)] for l in left_used for r in right_used]
+        if any(matrix):
+            left_new = {c: i + 1 for i, c in enumerate(left_used)}
+            right_new = {c: i + 1 for i, c in enumerate(right_used)}
+            left = [0] + [left_new.get(left_map[font.cmap[cp]], 0) for cp in order]
+            right = [0] + [right_new.get(right_map[font.cmap[cp]], 0) for cp in order]
+            kern_size = len(left) + len(right) + len(matrix)
+            kern_text = f'''/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {{
+{c_list(left, 8)}
+}};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {{
+{c_list(right, 8)}
+}};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {{
+{c_list(matrix, 8)}
+}};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {{
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = {len(left_used)},
+    .right_class_cnt     = {len(right_used)},
+}};
+
+'''
+
+    size = (len(bitmap) + GLYPH_DSC_BYTES * (len(order) + 1) + CMAP_BYTES * len(cmaps) +
+            sum(2 * len(g) if k == CMAP_SPARSE_TINY else g[-1] - g[0] + 1 for k, g in cmaps) + kern_size)
+    src_name = os.path.basename(font.path)
+    text = f'''/*******************************************************************************
+ * Subset of {src_name}: {len(order)} of {len(font.glyphs) - 1} glyphs, about {size} of {font.size_bytes()} bytes
+ * Generated by tools/font_subset.py from the strings used by the UI, do not edit.
+ *
+{font.header}
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {{
+{chr(10).join(bitmap_lines).rstrip().rstrip(',')}
+}};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {{
+{(',' + chr(10)).join(glyph_lines)}
+}};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+{chr(10).join(unicode_lists)}
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {{
+{(',' + chr(10)).join('    {' + chr(10) + c + chr(10) + '    }' for c in cmap_defs)}
+}};
+
+{kern_text}/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {{
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = {'&kern_classes' if kern_text else 'NULL'},
+    .kern_scale = {font.kern_scale if kern_text else 0},
+    .cmap_num = {len(cmaps)},
+    .bpp = {font.bpp},
+    .kern_classes = {1 if kern_text else 0},
+    .bitmap_format = 0,
+    .cache = &cache
+}};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t {name} = {{
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = {font.metrics['line_height']},          /*The maximum line height required by the font*/
+    .base_line = {font.metrics['base_line']},             /*Baseline measured from the bottom of the line*/
+    .subpx = {font.metrics['subpx']},
+    .underline_position = {font.metrics['underline_position']},
+    .underline_thickness = {font.metrics['underline_thickness']},
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+}};
+'''
+    write_if_changed(out_path, text)
+    missing = sorted(set(wanted) - set(letters))
+    return len(order), len(font.glyphs) - 1, size, font.size_bytes(), missing
+
+
+def write_if_changed(path, text):
+    """内容不变时不改写，避免重新编译"""
+    if os.path.exists(path) and open(path, encoding='utf-8').read() == text:
+        return
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('sources', nargs='+', help='扫描的界面源文件')
+    ap.add_argument('--font', action='append', required=True, metavar='SRC.c:NAME',
+                    help='LVGL字体源文件和子集字体的名字，可重复')
+    ap.add_argument('-o', '--out-dir', required=True, help='输出目录，每个字体输出<NAME>.c')
+    ap.add_argument('--letters', help='输出用到的字符(UI_FONT_LETTERS)的头文件')
+    ap.add_argument('--symbols', help='lv_symbol_def.h，默认取第一个字体所在目录下的')
+    args = ap.parse_args()
+
+    fonts = [f.rsplit(':', 1) for f in args.font]
+    symbols = load_symbols(args.symbols or os.path.join(os.path.dirname(fonts[0][0]), 'lv_symbol_def.h'))
+    letters = collect_letters(args.sources, symbols)
+    os.makedirs(args.out_dir, exist_ok=True)
+
+    for src, name in fonts:
+        kept, total, size, full, missing = write_subset(Font(src), name, letters,
+                                                         os.path.join(args.out_dir, name + '.c'))
+        print(f'{name}: {kept}/{total} glyphs, {size}/{full} bytes'
+              + (f', not in font: {" ".join(f"U+{cp:04X}" for cp in missing)}' if missing else ''))
+
+    if args.letters:
+        text = ''.join(chr(cp) for cp in sorted(letters))
+        escaped = ''.join(f'\\{b:03o}' if b >= 0x80 or chr(b) in '"\\' else chr(b) for b in text.encode('utf-8'))
+        write_if_changed(args.letters, f'// Generated by tools/font_subset.py, do not edit.\n'
+                                       f'#define UI_FONT_LETTERS "{escaped}"\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""把图片转换为压缩RGB565资源(格式见components/img_asset/include/img_asset.h)，输出C源文件。
+
+支持的输入：
+  *.png  8位RGB/RGBA、非隔行(不依赖PIL)
+  *.ppm  P6二进制
+  *.h/*.c  Image2Lcd等工具导出的RGB565大端C数组，需要用--size指定尺寸
+
+示例：
+  python tools/img_asset_pack.py main/yingwu.h --size 320x240 --name yingwu -o main/yingwu_img.c
+"""
+
+import argparse
+import re
+import struct
+import sys
+import time
+import zlib
+
+INDEX_SIZE = 64
+RUN_SHORT_MAX = 32
+RUN_LONG_MAX = RUN_SHORT_MAX + 4096
+
+
+def rgb888_to_565(r, g, b):
+    return ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | ((b * 31 + 127) // 255)
+
+
+def load_png(path):
+    data = open(path, 'rb').read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        sys.exit(f'{path}: not a PNG file')
+    pos, idat, width = 8, b'', 0
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', body)
+            if depth != 8 or color not in (2, 6) or interlace:
+                sys.exit(f'{path}: only 8-bit non-interlaced RGB/RGBA PNG is supported')
+            bpp = 3 if color == 2 else 4
+        elif kind == b'IDAT':
+            idat += body
+        pos += 12 + length
+    raw = zlib.decompress(idat)
+    stride = width * bpp
+    pixels, prev = [], bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        pixels += [rgb888_to_565(line[i], line[i + 1], line[i + 2]) for i in range(0, stride, bpp)]
+        prev = line
+    return width, height, pixels
+
+
+def load_ppm(path):
+    data = open(path, 'rb').read()
+    fields = re.match(rb'P6\s+(?:#.*\s+)*(\d+)\s+(\d+)\s+(\d+)\s', data)
+    if not fields or int(fields.group(3)) != 255:
+        sys.exit(f'{path}: only 8-bit binary PPM (P6) is supported')
+    width, height = int(fields.group(1)), int(fields.group(2))
+    body = data[fields.end():]
+    return width, height, [rgb888_to_565(*body[i:i + 3]) for i in range(0, width * height * 3, 3)]
+
+
+def load_c_array(path, size):
+    if not size:
+        sys.exit(f'{path}: --size WxH is required for C arrays')
+    width, height = (int(v) for v in size.lower().split('x'))
+    text = open(path, encoding='utf-8', errors='ignore').read()
+    body = text[text.index('{') + 1:text.rindex('}')]
+    values = [int(v, 16) for v in re.findall(r'0[xX]([0-9a-fA-F]{1,2})', body)]
+    if len(values) != width * height * 2:
+        sys.exit(f'{path}: {len(values)} bytes, expected {width * height * 2} for {width}x{height}')
+    return width, height, [values[i] << 8 | values[i + 1] for i in range(0, len(values), 2)]
+
+
+def split(v):
+    return v >> 11, (v >> 5) & 0x3F, v & 0x1F
+
+
+def hash565(v):
+    r, g, b = split(v)
+    return (r * 3 + g * 5 + b * 7) % INDEX_SIZE
+
+
+def wrap(d, bits):
+    half = 1 << (bits - 1)
+    return ((d + half) & ((1 << bits) - 1)) - half
+
+
+def encode(width, height, pixels):
+    out = bytearray(b'I565' + struct.pack('<HH', width, height))
+    index = [0] * INDEX_SIZE
+    prev, run = 0, 0
+
+    def flush_run():
+        if run == 0:
+            return
+        if run <= RUN_SHORT_MAX:
+            out.append(0xC0 | (run - 1))
+        else:
+            n = run - RUN_SHORT_MAX - 1
+            out.extend((0xE0 | (n >> 8), n & 0xFF))
+
+    for px in pixels:
+        if px == prev:
+            run += 1
+            if run == RUN_LONG_MAX:
+                flush_run()
+                run = 0
+            continue
+        flush_run()
+        run = 0
+
+        h = hash565(px)
+        if index[h] == px:
+            out.append(h)
+        else:
+            (r, g, b), (pr, pg, pb) = split(px), split(prev)
+            dr, dg, db = wrap(r - pr, 5), wrap(g - pg, 6), wrap(b - pb, 5)
+            half = (dg + 32) // 2 - 16
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -8 <= dr - half <= 7 and -8 <= db - half <= 7:
+                out.extend((0x80 | (dg + 32), (dr - half + 8) << 4 | (db - half + 8)))
+            else:
+                out.extend((0xFF, px >> 8, px & 0xFF))
+        index[h] = px
+        prev = px
+    flush_run()
+    return bytes(out)
+
+
+def decode(data):
+    """参考解码器，用于校验输出(与img_asset.c逻辑一致)"""
+    width, height = struct.unpack('<HH', data[4:8])
+    pixels, index, prev, pos = [], [0] * INDEX_SIZE, 0, 8
+    while len(pixels) < width * height:
+        op = data[pos]
+        pos += 1
+        if op >= 0xC0 and op < 0xF0:
+            if op < 0xE0:
+                n = (op & 0x1F) + 1
+            else:
+                n = ((op & 0x0F) << 8 | data[pos]) + RUN_SHORT_MAX + 1
+                pos += 1
+            pixels += [prev] * n
+            continue
+        r, g, b = split(prev)
+        if op < 0x40:
+            px = index[op]
+        elif op < 0x80:
+            px = (r + (op >> 4 & 3) - 2 & 0x1F) << 11 | (g + (op >> 2 & 3) - 2 & 0x3F) << 5 | (b + (op & 3) - 2 & 0x1F)
+        elif op < 0xC0:
+            dg = (op & 0x3F) - 32
+            half = (dg + 32) // 2 - 16
+            rb = data[pos]
+            pos += 1
+            px = (r + half + (rb >> 4) - 8 & 0x1F) << 11 | (g + dg & 0x3F) << 5 | (b + half + (rb & 0x0F) - 8 & 0x1F)
+        elif op == 0xFF:
+            px = data[pos] << 8 | data[pos + 1]
+            pos += 2
+        else:
+            raise ValueError(f'reserved op 0x{op:02X} at {pos - 1}')
+        index[hash565(px)] = px
+        prev = px
+        pixels.append(px)
+    return width, height, pixels
+
+
+def write_c(path, name, source, width, height, data):
+    raw_size = width * height * 2
+    lines = [
+        f'// 由tools/img_asset_pack.py从{source}生成，不要手动修改',
+        f'// {width}x{height} RGB565：{raw_size} -> {len(data)} 字节({100.0 * len(data) / raw_size:.1f}%)',
+        '#include "img_asset.h"',
+        '',
+        f'static const uint8_t {name}_data[{len(data)}] = {{',
+    ]
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ' '.join(f'0x{b:02X},' for b in data[i:i + 16]))
+    lines += [
+        '};',
+        '',
+        f'const img_asset_t img_{name} = {{',
+        f'    .data = {name}_data,',
+        f'    .size = sizeof({name}_data),',
+        '};',
+        '',
+    ]
+    with open(path, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert an image into a compressed RGB565 asset')
+    parser.add_argument('input', help='PNG, PPM or RGB565 C array')
+    parser.add_argument('-o', '--output', required=True, help='output C file')
+    parser.add_argument('--name', required=True, help='asset name, exported as img_<name>')
+    parser.add_argument('--size', help='WxH, required for C arrays')
+    args = parser.parse_args()
+
+    if args.input.lower().endswith('.png'):
+        width, height, pixels = load_png(args.input)
+    elif args.input.lower().endswith('.ppm'):
+        width, height, pixels = load_ppm(args.input)
+    else:
+        width, height, pixels = load_c_array(args.input, args.size)
+
+    start = time.perf_counter()
+    data = encode(width, height, pixels)
+    elapsed = time.perf_counter() - start
+    if decode(data) != (width, height, pixels):
+        sys.exit('round-trip check failed')
+
+    write_c(args.output, args.name, args.input.replace('\\', '/'), width, height, data)
+    raw_size = width * height * 2
+    print(f'{args.input}: {width}x{height}, {raw_size} -> {len(data)} bytes '
+          f'({100.0 * len(data) / raw_size:.1f}%, ratio {raw_size / len(data):.2f}:1), '
+          f'encoded in {elapsed * 1000:.0f} ms')
+
+
+if __name__ == '__main__':
+    main()